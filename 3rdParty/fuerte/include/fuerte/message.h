@@ -29,6 +29,7 @@
 #include <fuerte/types.h>
 #include <velocypack/Buffer.h>
 #include <velocypack/Builder.h>
+#include <velocypack/SharedSlice.h>
 #include <velocypack/Slice.h>
 
 #include <optional>
@@ -213,7 +214,14 @@ class Request final : public Message {
   void addVPack(velocypack::Slice const slice);
   void addVPack(velocypack::Buffer<uint8_t> const& buffer);
   void addVPack(velocypack::Buffer<uint8_t>&& buffer);
+  /// @brief add a value without copying it. the request only keeps a
+  /// reference to the value, so the same value can be sent with several
+  /// requests. values added this way are sent after all data added via
+  /// the other methods, in the order in which they were added
+  void addVPack(velocypack::SharedSlice slice);
   void addBinary(uint8_t const* data, std::size_t length);
+  /// @brief replace the complete payload, e.g. with a compressed version
+  void setPayload(velocypack::Buffer<uint8_t> buffer);
 
   ///////////////////////////////////////////////
   // get payload
@@ -222,8 +230,18 @@ class Request final : public Message {
   /// @brief get velocypack slices contained in request
   /// only valid iff the data was added via addVPack
   std::vector<velocypack::Slice> slices() const override;
+  /// @brief the payload as a single buffer. if the payload consists of
+  /// multiple parts, they are combined into a single buffer first, so
+  /// prefer payloadBuffers() or copyPayload() when sending the request
   asio_ns::const_buffer payload() const override;
+  /// @brief the parts of the payload, in the order in which they are sent
+  std::vector<asio_ns::const_buffer> payloadBuffers() const;
+  /// @brief copy up to length bytes of the payload, starting at offset,
+  /// into dest. returns the number of bytes copied
+  std::size_t copyPayload(std::size_t offset, uint8_t* dest,
+                          std::size_t length) const;
   std::size_t payloadSize() const override;
+  /// @brief only valid if no values were added without copying them
   velocypack::Buffer<uint8_t>&& moveBuffer() && { return std::move(_payload); }
 
   // get timeout, 0 means no timeout
@@ -251,6 +269,10 @@ class Request final : public Message {
 
  private:
   velocypack::Buffer<uint8_t> _payload;
+  // values that are referenced instead of being copied into _payload
+  std::vector<velocypack::SharedSlice> _sharedPayload;
+  // all parts of the payload combined, only built on demand by payload()
+  mutable velocypack::Buffer<uint8_t> _combinedPayload;
   std::chrono::milliseconds _timeout;
   std::optional<std::string> _fuzzReqHeader = std::nullopt;
   std::chrono::steady_clock::time_point _timeQueued;
@@ -56,6 +56,7 @@ StatusCode constexpr StatusPreconditionFailed = 412;
 StatusCode constexpr StatusMisdirectedRequest = 421;
 StatusCode constexpr StatusInternalError = 500;
 StatusCode constexpr StatusServiceUnavailable = 503;
+StatusCode constexpr StatusGatewayTimeout = 504;
 StatusCode constexpr StatusVersionNotSupported = 505;
 
 std::string status_code_to_string(StatusCode);
@@ -332,13 +332,17 @@ void H1Connection<ST>::asyncWriteNextRequest() {
 
   _item.reset(ptr);
 
-  std::array<asio_ns::const_buffer, 2> buffers;
-  buffers[0] =
-      asio_ns::buffer(_item->requestHeader.data(), _item->requestHeader.size());
+  std::vector<asio_ns::const_buffer> buffers;
+  buffers.emplace_back(
+      asio_ns::buffer(_item->requestHeader.data(), _item->requestHeader.size()));
   // GET and HEAD have no payload
   if (_item->request->header.restVerb != RestVerb::Get &&
       _item->request->header.restVerb != RestVerb::Head) {
-    buffers[1] = _item->request->payload();
+    // the payload may consist of multiple parts, which are written without
+    // combining them first
+    for (auto const& buffer : _item->request->payloadBuffers()) {
+      buffers.emplace_back(buffer);
+    }
   }
 
   this->_writing = true;
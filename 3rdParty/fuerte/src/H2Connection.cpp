@@ -565,19 +565,18 @@ void H2Connection<T>::queueHttp2Requests() {
                size_t length, uint32_t* data_flags, nghttp2_data_source* source,
                void* user_data) -> ssize_t {
           auto strm = static_cast<Stream*>(source->ptr);
-          asio_ns::const_buffer payload = strm->request->payload();
+          size_t const payloadSize = strm->request->payloadSize();
 
           // TODO do not copy the body if it is > 16kb
-          FUERTE_ASSERT(payload.size() > strm->responseOffset);
-          const uint8_t* src =
-              reinterpret_cast<uint8_t const*>(payload.data()) +
-              strm->responseOffset;
-          size_t len = std::min(length, payload.size() - strm->responseOffset);
+          FUERTE_ASSERT(payloadSize > strm->responseOffset);
+          // the payload may consist of multiple parts, which are copied
+          // directly from where they are
+          size_t len =
+              strm->request->copyPayload(strm->responseOffset, buf, length);
           FUERTE_ASSERT(len > 0);
-          std::copy_n(src, len, buf);
 
           strm->responseOffset += len;
-          if (strm->responseOffset == payload.size()) {
+          if (strm->responseOffset == payloadSize) {
             *data_flags |= NGHTTP2_DATA_FLAG_EOF;
           }
 
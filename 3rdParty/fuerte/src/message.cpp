@@ -25,6 +25,8 @@
 #include <fuerte/message.h>
 #include <velocypack/Validator.h>
 
+#include <algorithm>
+#include <cstring>
 #include <sstream>
 
 #include "debugging.h"
@@ -183,6 +185,7 @@ void Request::addVPack(VPackSlice const slice) {
 
   header.contentType(ContentType::VPack);
   _payload.append(slice.start(), slice.byteSize());
+  _combinedPayload.clear();
 }
 
 void Request::addVPack(VPackBuffer<uint8_t> const& buffer) {
@@ -193,6 +196,7 @@ void Request::addVPack(VPackBuffer<uint8_t> const& buffer) {
 #endif
   header.contentType(ContentType::VPack);
   _payload.append(buffer);
+  _combinedPayload.clear();
 }
 
 void Request::addVPack(VPackBuffer<uint8_t>&& buffer) {
@@ -203,11 +207,25 @@ void Request::addVPack(VPackBuffer<uint8_t>&& buffer) {
 #endif
   header.contentType(ContentType::VPack);
   _payload = std::move(buffer);
+  _combinedPayload.clear();
+}
+
+void Request::addVPack(velocypack::SharedSlice slice) {
+  header.contentType(ContentType::VPack);
+  _sharedPayload.emplace_back(std::move(slice));
+  _combinedPayload.clear();
 }
 
 // add binary data
 void Request::addBinary(uint8_t const* data, std::size_t length) {
   _payload.append(data, length);
+  _combinedPayload.clear();
+}
+
+void Request::setPayload(velocypack::Buffer<uint8_t> buffer) {
+  _payload = std::move(buffer);
+  _sharedPayload.clear();
+  _combinedPayload.clear();
 }
 
 // get payload as slices
@@ -225,16 +243,78 @@ std::vector<VPackSlice> Request::slices() const {
       cursor += sliceSize;
       length -= sliceSize;
     }
+    for (auto const& part : _sharedPayload) {
+      slices.emplace_back(part.slice());
+    }
   }
   return slices;
 }
 
 // get payload as binary
 asio_ns::const_buffer Request::payload() const {
-  return asio_ns::const_buffer(_payload.data(), _payload.byteSize());
+  if (_sharedPayload.empty()) {
+    return asio_ns::const_buffer(_payload.data(), _payload.byteSize());
+  }
+  if (_sharedPayload.size() == 1 && _payload.empty()) {
+    VPackSlice slice = _sharedPayload.front().slice();
+    return asio_ns::const_buffer(slice.start(), slice.byteSize());
+  }
+  if (_combinedPayload.empty()) {
+    _combinedPayload.reserve(payloadSize());
+    for (auto const& buffer : payloadBuffers()) {
+      _combinedPayload.append(static_cast<uint8_t const*>(buffer.data()),
+                              buffer.size());
+    }
+  }
+  return asio_ns::const_buffer(_combinedPayload.data(),
+                               _combinedPayload.byteSize());
+}
+
+std::vector<asio_ns::const_buffer> Request::payloadBuffers() const {
+  std::vector<asio_ns::const_buffer> buffers;
+  buffers.reserve(1 + _sharedPayload.size());
+  if (!_payload.empty()) {
+    buffers.emplace_back(_payload.data(), _payload.byteSize());
+  }
+  for (auto const& part : _sharedPayload) {
+    VPackSlice slice = part.slice();
+    buffers.emplace_back(slice.start(), slice.byteSize());
+  }
+  return buffers;
+}
+
+std::size_t Request::copyPayload(std::size_t offset, uint8_t* dest,
+                                 std::size_t length) const {
+  std::size_t copied = 0;
+  auto copyFrom = [&](uint8_t const* data, std::size_t size) {
+    if (offset >= size) {
+      offset -= size;
+      return;
+    }
+    std::size_t n = std::min(length - copied, size - offset);
+    std::memcpy(dest + copied, data + offset, n);
+    copied += n;
+    offset = 0;
+  };
+
+  copyFrom(_payload.data(), _payload.byteSize());
+  for (auto const& part : _sharedPayload) {
+    if (copied == length) {
+      break;
+    }
+    VPackSlice slice = part.slice();
+    copyFrom(slice.start(), slice.byteSize());
+  }
+  return copied;
 }
 
-size_t Request::payloadSize() const { return _payload.byteSize(); }
+size_t Request::payloadSize() const {
+  std::size_t size = _payload.byteSize();
+  for (auto const& part : _sharedPayload) {
+    size += part.slice().byteSize();
+  }
+  return size;
+}
 
 ///////////////////////////////////////////////
 // class Response
@@ -291,11 +371,12 @@ std::shared_ptr<velocypack::Buffer<uint8_t>> Response::stealPayload() {
     return std::make_shared<velocypack::Buffer<uint8_t>>(std::move(_payload));
   }
 
-  auto buffer = std::make_shared<velocypack::Buffer<uint8_t>>();
-  buffer->append(_payload.data() + _payloadOffset,
-                 _payload.byteSize() - _payloadOffset);
-  _payload.clear();
+  // move the body to the front of the buffer instead of allocating and
+  // copying into a new one
+  std::size_t length = _payload.byteSize() - _payloadOffset;
+  std::memmove(_payload.data(), _payload.data() + _payloadOffset, length);
+  _payload.resetTo(length);
   _payloadOffset = 0;
-  return buffer;
+  return std::make_shared<velocypack::Buffer<uint8_t>>(std::move(_payload));
 }
 }}}  // namespace arangodb::fuerte::v1
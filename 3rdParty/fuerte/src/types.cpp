@@ -61,6 +61,8 @@ std::string status_code_to_string(StatusCode statusCode) {
       return "500 Internal Error";
     case StatusServiceUnavailable:
       return "503 Unavailable";
+    case StatusGatewayTimeout:
+      return "504 Gateway Timeout";
     case StatusVersionNotSupported:
       return "505 Version Not Supported";
     default:
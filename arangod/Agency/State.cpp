@@ -104,6 +104,20 @@ inline static std::string stringify(index_t index) {
   return i_str.str();
 }
 
+/// Build the document of a log entry in the log collection
+static void buildLogDocument(Builder& body, index_t index, term_t term,
+                             uint64_t millis,
+                             arangodb::velocypack::Slice const& entry,
+                             std::string const& clientId) {
+  VPackObjectBuilder b(&body);
+  body.add(StaticStrings::KeyString, Value(stringify(index)));
+  body.add("term", Value(term));
+  body.add("request", entry);
+  body.add("clientId", Value(clientId));
+  body.add("timestamp", Value(timestamp(millis)));
+  body.add("epoch_millis", Value(millis));
+}
+
 /// Persist one entry
 bool State::persist(index_t index, term_t term, uint64_t millis,
                     arangodb::velocypack::Slice const& entry,
@@ -115,15 +129,7 @@ bool State::persist(index_t index, term_t term, uint64_t millis,
       << " entry: " << entry.toJson();
 
   Builder body;
-  {
-    VPackObjectBuilder b(&body);
-    body.add(StaticStrings::KeyString, Value(stringify(index)));
-    body.add("term", Value(term));
-    body.add("request", entry);
-    body.add("clientId", Value(clientId));
-    body.add("timestamp", Value(timestamp(millis)));
-    body.add("epoch_millis", Value(millis));
-  }
+  buildLogDocument(body, index, term, millis, entry, clientId);
 
   TRI_ASSERT(_vocbase != nullptr);
   transaction::StandaloneContext ctx(*_vocbase);
@@ -156,6 +162,66 @@ bool State::persist(index_t index, term_t term, uint64_t millis,
   return res.ok();
 }
 
+/// Persist multiple entries in one transaction, so that they are written
+/// (and synced) together
+bool State::persist(std::vector<PendingLogEntry> const& entries) const {
+  if (entries.size() == 1) {
+    auto const& e = entries.front();
+    return persist(e.index, e.term, e.millis, e.entry, e.clientId);
+  }
+
+  TRI_IF_FAILURE("State::persist") { return true; }
+
+  TRI_ASSERT(!entries.empty());
+  LOG_TOPIC("5d2b8", TRACE, Logger::AGENCY)
+      << "persist " << entries.size()
+      << " entries, first index=" << entries.front().index
+      << " last index=" << entries.back().index;
+
+  Builder body;
+  {
+    VPackArrayBuilder a(&body);
+    for (auto const& e : entries) {
+      buildLogDocument(body, e.index, e.term, e.millis, e.entry, e.clientId);
+    }
+  }
+
+  TRI_ASSERT(_vocbase != nullptr);
+  transaction::StandaloneContext ctx(*_vocbase);
+  SingleCollectionTransaction trx(
+      std::shared_ptr<transaction::Context>(
+          std::shared_ptr<transaction::Context>(), &ctx),
+      "log", AccessMode::Type::WRITE);
+
+  Result res = trx.begin();
+
+  if (!res.ok()) {
+    THROW_ARANGO_EXCEPTION(res);
+  }
+
+  try {
+    OperationResult result = trx.insert("log", body.slice(), _options);
+    if (result.ok() && !result.countErrorCodes.empty()) {
+      // at least one of the documents could not be inserted. the error
+      // details are in the result slice
+      res.reset(TRI_ERROR_INTERNAL, "failed to insert log entries");
+    } else {
+      res = result.result;
+    }
+    res = trx.finish(res);
+  } catch (std::exception const& e) {
+    LOG_TOPIC("5d2b9", ERR, Logger::AGENCY)
+        << "Failed to persist log entries:" << e.what();
+    return false;
+  }
+
+  LOG_TOPIC("5d2ba", TRACE, Logger::AGENCY)
+      << "persist done for " << entries.size()
+      << " entries, ok:" << res.ok();
+
+  return res.ok();
+}
+
 bool State::persistConf(index_t index, term_t term, uint64_t millis,
                         arangodb::velocypack::Slice const& entry,
                         std::string const& clientId) const {
@@ -167,15 +233,7 @@ bool State::persistConf(index_t index, term_t term, uint64_t millis,
 
   // The conventional log entry-------------------------------------------------
   Builder log;
-  {
-    VPackObjectBuilder b(&log);
-    log.add(StaticStrings::KeyString, Value(stringify(index)));
-    log.add("term", Value(term));
-    log.add("request", entry);
-    log.add("clientId", Value(clientId));
-    log.add("timestamp", Value(timestamp(millis)));
-    log.add("epoch_millis", Value(millis));
-  }
+  buildLogDocument(log, index, term, millis, entry, clientId);
 
   // The new configuration to be persisted.-------------------------------------
   // Actual agent's configuration is changed after successful persistence.
@@ -273,9 +331,14 @@ std::vector<index_t> State::logLeaderMulti(
 
   TRI_ASSERT(!_log.empty());  // log must never be empty
 
+  // all transactions up to the next reconfiguration are persisted together
+  std::vector<PendingLogEntry> batch;
+  auto nextIndex = _log.back().index + 1;
+
   size_t j = 0;
   for (auto const& i : VPackArrayIterator(transactions)) {
     if (!i.isArray()) {
+      logNonBlocking(batch, true);
       THROW_ARANGO_EXCEPTION_MESSAGE(TRI_ERROR_AGENCY_MALFORMED_TRANSACTION,
                                      "Transaction syntax is [{<operations>}, "
                                      "{<preconditions>}, \"clientId\"]");
@@ -288,15 +351,26 @@ std::vector<index_t> State::logLeaderMulti(
       TRI_ASSERT(transaction.isObject());
       TRI_ASSERT(transaction.length() > 0);
       size_t pos = transaction.keyAt(0).copyString().find(RECONFIGURE);
-
-      idx[j] = logNonBlocking(
-          _log.back().index + 1, i[0], term,
+      auto millis =
           duration_cast<milliseconds>(system_clock::now().time_since_epoch())
-              .count(),
-          clientId, true, pos == 0 || pos == 1);
+              .count();
+
+      if (pos == 0 || pos == 1) {
+        logNonBlocking(batch, true);
+        batch.clear();
+        idx[j] = logNonBlocking(nextIndex, i[0], term, millis, clientId, true,
+                                true);
+      } else {
+        batch.emplace_back(PendingLogEntry{nextIndex, term,
+                                           static_cast<uint64_t>(millis), i[0],
+                                           std::move(clientId)});
+        idx[j] = nextIndex;
+      }
+      ++nextIndex;
     }
     ++j;
   }
+  logNonBlocking(batch, true);
 
   return idx;
 }
@@ -350,6 +424,41 @@ index_t State::logNonBlocking(index_t idx, velocypack::Slice slice, term_t term,
   return _log.back().index;
 }
 
+void State::logNonBlocking(std::vector<PendingLogEntry> const& entries,
+                           bool leading) {
+  if (entries.empty()) {
+    return;
+  }
+
+  for (auto const& e : entries) {
+    // same log levels as for single entries, see above
+    if (leading) {
+      LOG_TOPIC("3c9e4", DEBUG, Logger::AGENCYSTORE)
+          << "leader: true, client: " << e.clientId << ", index: " << e.index
+          << ", term: " << e.term << ", data: " << e.entry.toJson();
+    } else {
+      LOG_TOPIC("3c9e2", TRACE, Logger::AGENCYSTORE)
+          << "leader: false, client: " << e.clientId << ", index: " << e.index
+          << ", term: " << e.term << ", data: " << e.entry.toJson();
+    }
+  }
+
+  if (!persist(entries)) {  // log to disk or die
+    LOG_TOPIC("3c9e3", FATAL, Logger::AGENCY)
+        << "RAFT member fails to persist log entries!";
+    FATAL_ERROR_EXIT();
+  }
+
+  for (auto const& e : entries) {
+    auto byteSize = e.entry.byteSize();
+    auto buf = std::make_shared<Buffer<uint8_t>>(byteSize);
+    buf->append(e.entry.begin(), byteSize);
+
+    logEmplaceBackNoLock(
+        log_t(e.index, e.term, std::move(buf), e.clientId, e.millis));
+  }
+}
+
 void State::logEmplaceBackNoLock(log_t&& l) {
   if (!l.clientId.empty()) {
     try {
@@ -448,6 +557,8 @@ index_t State::logFollower(VPackSlice transactions) {
   if (nqs > ndups) {
     TRI_ASSERT(transactions.isArray());
 
+    // all entries up to the next reconfiguration are persisted together
+    std::vector<PendingLogEntry> batch;
     for (size_t i = ndups; i < nqs; ++i) {
       VPackSlice slice = transactions[i];
 
@@ -473,11 +584,19 @@ index_t State::logFollower(VPackSlice transactions) {
       bool reconfiguration = query.keyAt(0).isEqualString(RECONFIGURE);
 
       // first to disk
-      if (logNonBlocking(index, query, term, tstamp, clientId, false,
-                         reconfiguration) == 0) {
-        break;
+      if (reconfiguration) {
+        logNonBlocking(batch, false);
+        batch.clear();
+        if (logNonBlocking(index, query, term, tstamp, clientId, false,
+                           true) == 0) {
+          break;
+        }
+      } else {
+        batch.emplace_back(
+            PendingLogEntry{index, term, tstamp, query, std::move(clientId)});
       }
     }
+    logNonBlocking(batch, false);
   }
   return _log.back().index;  // never empty
 }
@@ -830,6 +949,10 @@ bool State::checkCollection(std::string const& name) {
 
 /// Drop
 void State::dropCollection(std::string const& colName) {
+  if (colName == "compact") {
+    std::lock_guard guard{_snapshotCacheLock};
+    _snapshotCache = CachedSnapshot{};
+  }
   try {
     auto col = _vocbase->lookupCollection(colName);
     if (col == nullptr) {
@@ -962,6 +1085,16 @@ bool State::loadPersisted() {
 /// `index` to 0 if there is no compacted snapshot.
 bool State::loadLastCompactedSnapshot(Store& store, index_t& index,
                                       term_t& term) {
+  {
+    std::lock_guard guard{_snapshotCacheLock};
+    if (_snapshotCache.valid) {
+      store = _snapshotCache.store;
+      index = _snapshotCache.index;
+      term = _snapshotCache.term;
+      return true;
+    }
+  }
+
   std::string const aql("FOR c IN compact SORT c._key DESC LIMIT 1 RETURN c");
 
   TRI_ASSERT(nullptr != _vocbase);
@@ -996,6 +1129,14 @@ bool State::loadLastCompactedSnapshot(Store& store, index_t& index,
       LOG_TOPIC("8ef2a", ERR, Logger::AGENCY) << e.what();
       return false;
     }
+
+    std::lock_guard guard{_snapshotCacheLock};
+    if (!_snapshotCache.valid) {
+      _snapshotCache.store = store;
+      _snapshotCache.index = index;
+      _snapshotCache.term = term;
+      _snapshotCache.valid = true;
+    }
   }
 
   return true;
@@ -1529,6 +1670,16 @@ bool State::persistCompactionSnapshot(index_t cind,
 
     if (res.ok()) {
       _lastCompactionAt = cind;
+
+      std::lock_guard guard{_snapshotCacheLock};
+      // only take over the snapshot if it is the latest one in the compact
+      // collection. if we have not seen the collection's contents yet, the
+      // next call to loadLastCompactedSnapshot will fill the cache.
+      if (_snapshotCache.valid && _snapshotCache.index <= cind) {
+        _snapshotCache.store = snapshot;
+        _snapshotCache.index = cind;
+        _snapshotCache.term = term;
+      }
     }
 
     return res.ok();
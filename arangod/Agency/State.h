@@ -34,6 +34,8 @@
 #include <functional>
 #include <map>
 #include <mutex>
+#include <string>
+#include <vector>
 
 struct TRI_vocbase_t;
 
@@ -242,10 +244,27 @@ class State {
                          std::string const& clientId = std::string(),
                          bool leading = false, bool reconfiguration = false);
 
+  /// @brief Log entry which is yet to be persisted
+  struct PendingLogEntry {
+    index_t index;
+    term_t term;
+    uint64_t millis;
+    velocypack::Slice entry;
+    std::string clientId;
+  };
+
+  /// @brief Log multiple entries, which must not contain reconfigurations,
+  /// with a single write to the log collection. Must be guarded by caller.
+  void logNonBlocking(std::vector<PendingLogEntry> const& entries,
+                      bool leading);
+
   /// @brief Save currentTerm, votedFor, log entries
   bool persist(index_t, term_t, uint64_t, arangodb::velocypack::Slice const&,
                std::string const&) const;
 
+  /// @brief Save multiple log entries in a single transaction
+  bool persist(std::vector<PendingLogEntry> const& entries) const;
+
   /// @brief Save currentTerm, votedFor, log entries for reconfiguration
   bool persistConf(index_t, term_t, uint64_t,
                    arangodb::velocypack::Slice const&,
@@ -307,6 +326,20 @@ class State {
   /// 0 in the deque _log.
   size_t _cur;
 
+  /// @brief in-memory copy of the latest persisted compaction snapshot.
+  /// Store copies share all nodes with the original, so keeping it around
+  /// is cheap, and the next compaction only has to apply the log entries
+  /// appended since then instead of reading and parsing the whole snapshot
+  /// from the compact collection again
+  struct CachedSnapshot {
+    Store store{"snapshot"};
+    index_t index = 0;
+    term_t term = 0;
+    bool valid = false;
+  };
+  std::mutex _snapshotCacheLock;
+  CachedSnapshot _snapshotCache;
+
   /// @brief Operation options
   arangodb::OperationOptions _options;
 
@@ -26,6 +26,7 @@
 #include "Aql/AqlValue.h"
 #include "Aql/AqlValueMaterializer.h"
 #include "Aql/Functions.h"
+#include "Aql/HyperLogLog.h"
 #include "Containers/FlatHashSet.h"
 #include "Basics/VelocyPackHelper.h"
 #include "Transaction/Context.h"
@@ -36,6 +37,8 @@
 #include <velocypack/Iterator.h>
 #include <velocypack/Slice.h>
 
+#include <cmath>
+#include <deque>
 #include <set>
 
 using namespace arangodb;
@@ -159,6 +162,11 @@ struct AggregatorLength final : public Aggregator {
 
   void reduce(AqlValue const&) override { ++count; }
 
+  void remove(AqlValue const&) override {
+    TRI_ASSERT(count > 0);
+    --count;
+  }
+
   AqlValue get() const override {
     uint64_t value = count;
     return AqlValue(AqlValueHintUInt(value));
@@ -669,7 +677,7 @@ struct AggregatorUniqueStep2 final : public AggregatorUnique {
     for (VPackSlice it : VPackArrayIterator(s)) {
       if (seen.contains(it)) {
         // already saw the same value
-        return;
+        continue;
       }
 
       char* pos = allocator.store(it.startAs<char>(), it.byteSize());
@@ -744,7 +752,7 @@ struct AggregatorSortedUniqueStep2 final : public AggregatorSortedUnique {
     for (VPackSlice it : VPackArrayIterator(s)) {
       if (seen.find(it) != seen.end()) {
         // already saw the same value
-        return;
+        continue;
       }
 
       char* pos = allocator.store(it.startAs<char>(), it.byteSize());
@@ -839,9 +847,9 @@ struct AggregatorCountDistinctStep2 final : public AggregatorCountDistinct {
     }
 
     for (VPackSlice it : VPackArrayIterator(s)) {
-      if (seen.find(s) != seen.end()) {
+      if (seen.contains(it)) {
         // already saw the same value
-        return;
+        continue;
       }
 
       char* pos = allocator.store(it.startAs<char>(), it.byteSize());
@@ -850,6 +858,103 @@ struct AggregatorCountDistinctStep2 final : public AggregatorCountDistinct {
   }
 };
 
+/// @brief the coordinator variant of COLLECT ... INTO var = expr. the DB
+/// servers produce one array of values per partial group, which are
+/// concatenated here
+struct AggregatorUnionStep2 final : public Aggregator {
+  explicit AggregatorUnionStep2(velocypack::Options const* opts)
+      : Aggregator(opts) {}
+
+  void reset() override { builder.clear(); }
+
+  void reduce(AqlValue const& cmpValue) override {
+    AqlValueMaterializer materializer(_vpackOptions);
+
+    VPackSlice s = materializer.slice(cmpValue, true);
+
+    if (!s.isArray()) {
+      return;
+    }
+
+    if (builder.isClosed()) {
+      builder.openArray();
+    }
+    for (VPackSlice it : VPackArrayIterator(s)) {
+      builder.add(it);
+    }
+  }
+
+  AqlValue get() const override {
+    // if not yet an array, start one
+    if (builder.isClosed()) {
+      builder.openArray();
+    }
+
+    // always close the Builder
+    builder.close();
+    return AqlValue(builder.slice());
+  }
+
+  mutable arangodb::velocypack::Builder builder;
+};
+
+/// @brief aggregator for APPROX_COUNT_DISTINCT, estimating the number of
+/// distinct values via a HyperLogLog sketch
+struct AggregatorApproxCountDistinct : public Aggregator {
+  explicit AggregatorApproxCountDistinct(velocypack::Options const* opts)
+      : Aggregator(opts) {}
+
+  void reset() override final { sketch.clear(); }
+
+  void reduce(AqlValue const& cmpValue) override {
+    AqlValueMaterializer materializer(_vpackOptions);
+
+    VPackSlice s = materializer.slice(cmpValue, true);
+    sketch.add(s.normalizedHash());
+  }
+
+  AqlValue get() const override {
+    return AqlValue(AqlValueHintUInt(sketch.estimate()));
+  }
+
+  HyperLogLog sketch;
+};
+
+/// @brief the DB server variant of APPROX_COUNT_DISTINCT, producing a
+/// serialized sketch
+struct AggregatorApproxCountDistinctStep1 final
+    : public AggregatorApproxCountDistinct {
+  explicit AggregatorApproxCountDistinctStep1(velocypack::Options const* opts)
+      : AggregatorApproxCountDistinct(opts) {}
+
+  AqlValue get() const override {
+    builder.clear();
+    sketch.toVelocyPack(builder);
+    return AqlValue(builder.slice());
+  }
+
+  mutable arangodb::velocypack::Builder builder;
+};
+
+/// @brief the coordinator variant of APPROX_COUNT_DISTINCT, merging the
+/// sketches from the DB servers
+struct AggregatorApproxCountDistinctStep2 final
+    : public AggregatorApproxCountDistinct {
+  explicit AggregatorApproxCountDistinctStep2(velocypack::Options const* opts)
+      : AggregatorApproxCountDistinct(opts) {}
+
+  void reduce(AqlValue const& cmpValue) override {
+    AqlValueMaterializer materializer(_vpackOptions);
+
+    VPackSlice s = materializer.slice(cmpValue, true);
+    if (!sketch.mergeVelocyPack(s)) {
+      THROW_ARANGO_EXCEPTION_MESSAGE(
+          TRI_ERROR_INTERNAL,
+          "invalid partial result for APPROX_COUNT_DISTINCT");
+    }
+  }
+};
+
 struct BitFunctionAnd {
   uint64_t compute(uint64_t value1, uint64_t value2) noexcept {
     return value1 & value2;
@@ -935,6 +1040,198 @@ struct AggregatorBitXOr : public AggregatorBitFunction<BitFunctionXOr> {
       : AggregatorBitFunction(opts) {}
 };
 
+/// @brief extracts a finite number from the value. returns false for all
+/// non-numeric values, NaN and infinity
+bool toFiniteNumber(AqlValue const& value, double& number) {
+  if (!value.isNumber()) {
+    return false;
+  }
+  number = value.toDouble();
+  return !std::isnan(number) && number != HUGE_VAL && number != -HUGE_VAL;
+}
+
+/// @brief compensated (Neumaier) summation. when values are added and later
+/// removed again, a plain sum can lose all precision, e.g. when adding 1e20
+/// and 1 and removing 1e20 again. the compensation term keeps track of the
+/// low-order bits that were lost in the additions
+struct CompensatedSum {
+  void add(double value) noexcept {
+    double t = sum + value;
+    if (std::abs(sum) >= std::abs(value)) {
+      compensation += (sum - t) + value;
+    } else {
+      compensation += (value - t) + sum;
+    }
+    sum = t;
+  }
+
+  double get() const noexcept { return sum + compensation; }
+
+  double sum = 0.0;
+  double compensation = 0.0;
+};
+
+/// @brief SUM for sliding windows, supporting the removal of values
+struct SlidingAggregatorSum final : public Aggregator {
+  explicit SlidingAggregatorSum(velocypack::Options const* opts)
+      : Aggregator(opts) {}
+
+  void reset() override {
+    sum = CompensatedSum{};
+    invoked = 0;
+    invalid = 0;
+  }
+
+  void reduce(AqlValue const& cmpValue) override { update(cmpValue, 1); }
+
+  void remove(AqlValue const& cmpValue) override { update(cmpValue, -1); }
+
+  AqlValue get() const override {
+    double v = sum.get();
+    if (invalid > 0 || invoked == 0 || std::isnan(v) || v == HUGE_VAL ||
+        v == -HUGE_VAL) {
+      return AqlValue(AqlValueHintNull());
+    }
+    return AqlValue(AqlValueHintDouble(v));
+  }
+
+ private:
+  void update(AqlValue const& cmpValue, int64_t direction) {
+    invoked += direction;
+    if (cmpValue.isNull(true)) {
+      // ignore `null` values here
+      return;
+    }
+    double number;
+    if (toFiniteNumber(cmpValue, number)) {
+      sum.add(direction * number);
+    } else {
+      invalid += direction;
+    }
+  }
+
+  CompensatedSum sum;
+  // number of values in the window
+  int64_t invoked = 0;
+  // number of values in the window that make the result invalid
+  int64_t invalid = 0;
+};
+
+/// @brief AVERAGE for sliding windows, supporting the removal of values
+struct SlidingAggregatorAverage final : public Aggregator {
+  explicit SlidingAggregatorAverage(velocypack::Options const* opts)
+      : Aggregator(opts) {}
+
+  void reset() override {
+    sum = CompensatedSum{};
+    count = 0;
+    invalid = 0;
+  }
+
+  void reduce(AqlValue const& cmpValue) override { update(cmpValue, 1); }
+
+  void remove(AqlValue const& cmpValue) override { update(cmpValue, -1); }
+
+  AqlValue get() const override {
+    double v = sum.get();
+    if (invalid > 0 || count == 0 || std::isnan(v) || v == HUGE_VAL ||
+        v == -HUGE_VAL) {
+      return AqlValue(AqlValueHintNull());
+    }
+    TRI_ASSERT(count > 0);
+    v /= count;
+    return AqlValue(AqlValueHintDouble(v));
+  }
+
+ private:
+  void update(AqlValue const& cmpValue, int64_t direction) {
+    if (cmpValue.isNull(true)) {
+      // ignore `null` values here
+      return;
+    }
+    double number;
+    if (toFiniteNumber(cmpValue, number)) {
+      sum.add(direction * number);
+      count += direction;
+    } else {
+      invalid += direction;
+    }
+  }
+
+  CompensatedSum sum;
+  // number of numeric values in the window
+  int64_t count = 0;
+  // number of values in the window that make the result invalid
+  int64_t invalid = 0;
+};
+
+/// @brief MIN and MAX for sliding windows, supporting the removal of values.
+/// keeps a monotonic queue of the values that can still become the result
+/// once all values added before them have been removed. this relies on
+/// values being removed in the same order in which they were added
+template<bool isMin>
+struct SlidingAggregatorMinMax final : public Aggregator {
+  explicit SlidingAggregatorMinMax(velocypack::Options const* opts)
+      : Aggregator(opts) {}
+
+  ~SlidingAggregatorMinMax() { reset(); }
+
+  void reset() override {
+    for (auto& it : candidates) {
+      it.second.destroy();
+    }
+    candidates.clear();
+    added = 0;
+    removed = 0;
+  }
+
+  void reduce(AqlValue const& cmpValue) override {
+    uint64_t position = added++;
+    if (isMin && cmpValue.isNull(true)) {
+      // the value `null` itself will not be used in MIN() to compare lower
+      // than e.g. value `false`
+      return;
+    }
+    // remove all candidates that can never become the result again, because
+    // the new value is better and will stay in the window longer. equal
+    // values are kept, so that the earliest of them is returned, as in the
+    // regular MIN/MAX aggregators
+    while (!candidates.empty() && isWorse(candidates.back().second, cmpValue)) {
+      candidates.back().second.destroy();
+      candidates.pop_back();
+    }
+    candidates.emplace_back(position, cmpValue.clone());
+  }
+
+  void remove(AqlValue const&) override {
+    TRI_ASSERT(removed < added);
+    uint64_t position = removed++;
+    if (!candidates.empty() && candidates.front().first == position) {
+      candidates.front().second.destroy();
+      candidates.pop_front();
+    }
+  }
+
+  AqlValue get() const override {
+    if (candidates.empty()) {
+      return AqlValue(AqlValueHintNull());
+    }
+    return candidates.front().second.clone();
+  }
+
+ private:
+  bool isWorse(AqlValue const& candidate, AqlValue const& value) const {
+    int cmp = AqlValue::Compare(_vpackOptions, candidate, value, true);
+    return isMin ? cmp > 0 : cmp < 0;
+  }
+
+  // candidates for the result, with their position in the input
+  std::deque<std::pair<uint64_t, AqlValue>> candidates;
+  // number of values added and removed so far
+  uint64_t added = 0;
+  uint64_t removed = 0;
+};
+
 /// @brief all available aggregators with their meta data
 std::unordered_map<std::string_view, AggregatorInfo> const aggregators = {
     {"LENGTH",
@@ -1024,6 +1321,19 @@ std::unordered_map<std::string_view, AggregatorInfo> const aggregators = {
     {"COUNT_DISTINCT_STEP2",
      {std::make_shared<GenericFactory<AggregatorCountDistinctStep2>>(),
       doesRequireInput, internalOnly, "", "COUNT_DISTINCT_STEP2"}},
+    {"UNION_STEP2",
+     {std::make_shared<GenericFactory<AggregatorUnionStep2>>(),
+      doesRequireInput, internalOnly, "", "UNION_STEP2"}},
+    {"APPROX_COUNT_DISTINCT",
+     {std::make_shared<GenericFactory<AggregatorApproxCountDistinct>>(),
+      doesRequireInput, official, "APPROX_COUNT_DISTINCT_STEP1",
+      "APPROX_COUNT_DISTINCT_STEP2"}},
+    {"APPROX_COUNT_DISTINCT_STEP1",
+     {std::make_shared<GenericFactory<AggregatorApproxCountDistinctStep1>>(),
+      doesRequireInput, internalOnly, "", "APPROX_COUNT_DISTINCT_STEP1"}},
+    {"APPROX_COUNT_DISTINCT_STEP2",
+     {std::make_shared<GenericFactory<AggregatorApproxCountDistinctStep2>>(),
+      doesRequireInput, internalOnly, "", "APPROX_COUNT_DISTINCT_STEP2"}},
     {"BIT_AND",
      {std::make_shared<GenericFactory<AggregatorBitAnd>>(), doesRequireInput,
       official, "BIT_AND", "BIT_AND"}},
@@ -1044,8 +1354,28 @@ std::unordered_map<std::string_view, std::string_view> const aliases = {
     {"COUNT_UNIQUE", "COUNT_DISTINCT"}    // COUNT_UNIQUE = COUNT_DISTINCT
 };
 
+/// @brief aggregators that support the removal of values, for use in
+/// sliding windows
+std::unordered_map<std::string_view,
+                   std::shared_ptr<Aggregator::Factory const>> const
+    slidingAggregators = {
+        {"LENGTH", std::make_shared<GenericFactory<AggregatorLength>>()},
+        {"MIN",
+         std::make_shared<GenericFactory<SlidingAggregatorMinMax<true>>>()},
+        {"MAX",
+         std::make_shared<GenericFactory<SlidingAggregatorMinMax<false>>>()},
+        {"SUM", std::make_shared<GenericFactory<SlidingAggregatorSum>>()},
+        {"AVERAGE",
+         std::make_shared<GenericFactory<SlidingAggregatorAverage>>()},
+};
+
 }  // namespace
 
+void Aggregator::remove(AqlValue const&) {
+  THROW_ARANGO_EXCEPTION_MESSAGE(
+      TRI_ERROR_INTERNAL, "aggregator does not support removing values");
+}
+
 std::unique_ptr<Aggregator> Aggregator::fromTypeString(
     velocypack::Options const* opts, std::string_view type) {
   // will always return a valid factory or throw an exception
@@ -1054,6 +1384,16 @@ std::unique_ptr<Aggregator> Aggregator::fromTypeString(
   return factory(opts);
 }
 
+std::unique_ptr<Aggregator> Aggregator::slidingFromTypeString(
+    velocypack::Options const* opts, std::string_view type) {
+  auto it = ::slidingAggregators.find(translateAlias(type));
+
+  if (it != ::slidingAggregators.end()) {
+    return (*it->second)(opts);
+  }
+  return nullptr;
+}
+
 std::unique_ptr<Aggregator> Aggregator::fromVPack(
     velocypack::Options const* opts, arangodb::velocypack::Slice slice,
     std::string_view nameAttribute) {
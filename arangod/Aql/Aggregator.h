@@ -55,6 +55,11 @@ struct Aggregator {
   virtual ~Aggregator() = default;
   virtual void reset() = 0;
   virtual void reduce(AqlValue const&) = 0;
+  /// @brief removes a value that was previously added via reduce(). only
+  /// supported by the aggregators created via slidingFromTypeString(), all
+  /// others throw. values must be removed in the order in which they were
+  /// added
+  virtual void remove(AqlValue const&);
   virtual AqlValue get() const = 0;
   AqlValue stealValue() {
     AqlValue r = this->get();
@@ -66,6 +71,12 @@ struct Aggregator {
   static std::unique_ptr<Aggregator> fromTypeString(velocypack::Options const*,
                                                     std::string_view type);
 
+  /// @brief creates an aggregator that supports removing values via remove(),
+  /// for sliding windows. returns nullptr if there is no such variant for the
+  /// aggregator type
+  static std::unique_ptr<Aggregator> slidingFromTypeString(
+      velocypack::Options const*, std::string_view type);
+
   /// @brief creates an aggregator from a velocypack slice
   static std::unique_ptr<Aggregator> fromVPack(velocypack::Options const*,
                                                arangodb::velocypack::Slice,
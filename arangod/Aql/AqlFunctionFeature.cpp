@@ -167,8 +167,8 @@ void AqlFunctionFeature::addStringFunctions() {
   add({"CONCAT", ".|+", flags, &functions::Concat});
   add({"CONCAT_SEPARATOR", ".,.|+", flags, &functions::ConcatSeparator});
   add({"CHAR_LENGTH", ".", flags, &functions::CharLength});
-  add({"LOWER", ".", flags, &functions::Lower});
-  add({"UPPER", ".", flags, &functions::Upper});
+  add({"LOWER", ".", flags, &functions::Lower, &functions::LowerBatch});
+  add({"UPPER", ".", flags, &functions::Upper, &functions::UpperBatch});
   add({"SUBSTRING", ".,.|.", flags, &functions::Substring});
   add({"SUBSTRING_BYTES", ".,.|.,.,.", flags, &functions::SubstringBytes});
   add({"CONTAINS", ".,.|.", flags, &functions::Contains});
@@ -245,7 +245,7 @@ void AqlFunctionFeature::addNumericFunctions() {
   add({"FLOOR", ".", flags, &functions::Floor});
   add({"CEIL", ".", flags, &functions::Ceil});
   add({"ROUND", ".", flags, &functions::Round});
-  add({"ABS", ".", flags, &functions::Abs});
+  add({"ABS", ".", flags, &functions::Abs, &functions::AbsBatch});
   add({"SQRT", ".", flags, &functions::Sqrt});
   add({"POW", ".,.", flags, &functions::Pow});
   add({"LOG", ".", flags, &functions::Log});
@@ -324,6 +324,8 @@ void AqlFunctionFeature::addListFunctions() {
   add({"COUNT_DISTINCT", ".", flags, &functions::CountDistinct});
   // COUNT_UNIQUE is an alias for COUNT_DISTINCT
   addAlias("COUNT_UNIQUE", "COUNT_DISTINCT");
+  add({"APPROX_COUNT_DISTINCT", ".", flags,
+       &functions::ApproxCountDistinct});
   add({"PRODUCT", ".", flags, &functions::Product});
   add({"UNIQUE", ".", flags, &functions::Unique});
   add({"SORTED_UNIQUE", ".", flags, &functions::SortedUnique});
@@ -461,7 +463,8 @@ void AqlFunctionFeature::addDateFunctions() {
   add({"DATE_DIFF", ".,.,.|.", flags, &functions::DateDiff});
   add({"DATE_COMPARE", ".,.,.|.", flags, &functions::DateCompare});
   add({"DATE_FORMAT", ".,.", flags, &functions::DateFormat});
-  add({"DATE_TRUNC", ".,.", flags, &functions::DateTrunc});
+  add({"DATE_TRUNC", ".,.", flags, &functions::DateTrunc,
+       &functions::DateTruncBatch});
   add({"DATE_UTCTOLOCAL", ".,.|.", flags, &functions::DateUtcToLocal});
   add({"DATE_LOCALTOUTC", ".,.|.", flags, &functions::DateLocalToUtc});
   add({"DATE_TIMEZONE", "", flags, &functions::DateTimeZone});
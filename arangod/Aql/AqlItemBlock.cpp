@@ -1078,14 +1078,16 @@ void AqlItemBlock::referenceValuesFromRow(size_t currentRow,
   copySubqueryDepth(currentRow, fromRow);
 }
 
-void AqlItemBlock::steal(AqlValue const& value) {
+bool AqlItemBlock::steal(AqlValue const& value) {
   if (value.requiresDestruction()) {
     auto it = _valueCount.find(value.data());
-    if (it != _valueCount.end()) {
-      decreaseMemoryUsage((*it).second.memoryUsage);
-      _valueCount.erase(it);
+    if (it == _valueCount.end()) {
+      return false;
     }
+    decreaseMemoryUsage((*it).second.memoryUsage);
+    _valueCount.erase(it);
   }
+  return true;
 }
 
 AqlValue AqlItemBlock::stealAndEraseValue(size_t index, RegisterId varNr) {
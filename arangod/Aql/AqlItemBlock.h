@@ -198,7 +198,9 @@ class AqlItemBlock {
   /// the same value again. Note that once you do this for a single AqlValue
   /// you should delete the AqlItemBlock soon, because the stolen AqlValues
   /// might be deleted at any time!
-  void steal(AqlValue const& value);
+  /// returns false if the block was not responsible for the value, e.g.
+  /// because it has already been stolen before
+  bool steal(AqlValue const& value);
 
   AqlValue stealAndEraseValue(size_t index, RegisterId varNr);
 
@@ -38,6 +38,7 @@
 #include "Aql/Quantifier.h"
 #include "Aql/QueryContext.h"
 #include "Aql/AqlFunctionsInternalCache.h"
+#include "Aql/UserFunctionExpressionCache.h"
 #include "Basics/Arithmetic.h"
 #include "Basics/Exceptions.h"
 #include "Basics/tri-strings.h"
@@ -61,6 +62,8 @@
 #include <velocypack/Iterator.h>
 #include <velocypack/Slice.h>
 
+#include <algorithm>
+
 using namespace arangodb;
 using namespace arangodb::aql;
 
@@ -1794,6 +1797,57 @@ AstNode const* Ast::createNodeOptions(AstNode const* options) const {
   return &_specialNodes.NopNode;
 }
 
+/// @brief inline a call to an expression user function, by replacing all
+/// parameters in the function body with the call arguments
+AstNode* Ast::createNodeUserFunctionExpression(
+    UserFunctionExpression const& function, AstNode const* arguments) {
+  TRI_ASSERT(arguments != nullptr);
+  TRI_ASSERT(arguments->type == NODE_TYPE_ARRAY);
+
+  size_t const n = arguments->numMembers();
+  if (n != function.parameters.size()) {
+    THROW_ARANGO_EXCEPTION_PARAMS(
+        TRI_ERROR_QUERY_FUNCTION_ARGUMENT_NUMBER_MISMATCH,
+        function.name.c_str(), static_cast<int>(function.parameters.size()),
+        static_cast<int>(function.parameters.size()));
+  }
+
+  // number of times each argument was inserted into the body so far
+  std::vector<size_t> uses(n, 0);
+
+  AstNode* body = createNode(function.body.slice());
+  return traverseAndModify(body, [&](AstNode* node) -> AstNode* {
+    if (node->type != NODE_TYPE_PARAMETER) {
+      return node;
+    }
+    auto it = std::find(function.parameters.begin(),
+                        function.parameters.end(), node->getStringView());
+    if (it == function.parameters.end()) {
+      // the function body was validated when it was registered
+      THROW_ARANGO_EXCEPTION_MESSAGE(
+          TRI_ERROR_INTERNAL,
+          absl::StrCat("unknown parameter '@", node->getStringView(),
+                       "' in user function '", function.name, "()'"));
+    }
+    size_t const i = std::distance(function.parameters.begin(), it);
+    AstNode* argument = arguments->getMemberUnchecked(i);
+    if (uses[i]++ == 0) {
+      return argument;
+    }
+    // the argument is used more than once, so it will be evaluated more
+    // than once. this changes the results of non-deterministic arguments
+    if (!argument->isDeterministic()) {
+      THROW_ARANGO_EXCEPTION_MESSAGE(
+          TRI_ERROR_QUERY_PARSE,
+          absl::StrCat("argument ", i + 1, " of user function '",
+                       function.name,
+                       "()' must be deterministic, because it is used more "
+                       "than once in the function body"));
+    }
+    return clone(argument);
+  });
+}
+
 /// @brief create an AST function call node for aggregate functions
 AstNode* Ast::createNodeAggregateFunctionCall(std::string_view functionName,
                                               AstNode const* arguments) {
@@ -1891,6 +1945,14 @@ AstNode* Ast::createNodeFunctionCall(std::string_view functionName,
     }
   } else {
     // user-defined function (UDF)
+    if (auto function = UserFunctionExpressionCache::instance().lookup(
+            _query.vocbase(), normalized);
+        function != nullptr) {
+      // the function body is an AQL expression, which is inlined here. so
+      // it does not need V8 at all
+      return createNodeUserFunctionExpression(*function, arguments);
+    }
+
     if (_query.vocbase().server().hasFeature<V8DealerFeature>() &&
         !_query.vocbase()
              .server()
@@ -1950,11 +2012,52 @@ AstNode* Ast::createNodeNaryOperator(AstNodeType type, AstNode const* child) {
 }
 
 /// @brief injects bind parameters into the AST
-void Ast::injectBindParameters(BindParameters& parameters,
-                               CollectionNameResolver const& resolver) {
+void Ast::injectBindParameters(
+    BindParameters& parameters, CollectionNameResolver const& resolver,
+    containers::FlatHashSet<std::string> const* valueParameters) {
   if (_containsBindParameters || _containsTraversal) {
+    // nodes that contain bind parameters which are resolved at runtime.
+    // these nodes must not be considered constant or simple anymore
+    containers::FlatHashSet<AstNode const*> runtimeNodes;
+
     // inject bind parameters into query AST
     auto func = [&](AstNode* node) -> AstNode* {
+      if (!runtimeNodes.empty() && node->type != NODE_TYPE_PARAMETER) {
+        size_t const n = node->numMembers();
+        for (size_t i = 0; i < n; ++i) {
+          if (runtimeNodes.contains(node->getMemberUnchecked(i))) {
+            // children are visited before their parents, so a parent's
+            // flags are reset after all of its members have been processed
+            node->removeFlag(DETERMINED_CONSTANT);
+            node->removeFlag(VALUE_CONSTANT);
+            node->removeFlag(DETERMINED_SIMPLE);
+            node->removeFlag(VALUE_SIMPLE);
+            runtimeNodes.emplace(node);
+            break;
+          }
+        }
+      }
+
+      if (node->type == NODE_TYPE_PARAMETER && valueParameters != nullptr &&
+          valueParameters->contains(node->getStringView())) {
+        // bind parameter that is resolved at runtime. leave it in the AST,
+        // but make sure it is never treated as a constant value
+        std::string const param = node->getString();
+        auto [value, cachedNode] = parameters.get(param);
+        if (value.isNone()) {
+          ::throwFormattedError(_query, TRI_ERROR_QUERY_BIND_PARAMETER_MISSING,
+                                param);
+        }
+        node->removeFlag(VALUE_CONSTANT);
+        node->setFlag(DETERMINED_CONSTANT);
+        if (cachedNode == nullptr) {
+          // mark the bind parameter as being used
+          parameters.registerNode(param, node);
+        }
+        runtimeNodes.emplace(node);
+        return node;
+      }
+
       if (node->type == NODE_TYPE_PARAMETER ||
           node->type == NODE_TYPE_PARAMETER_DATASOURCE) {
         // found a bind parameter in the query string
@@ -2390,6 +2493,11 @@ void Ast::validateAndOptimize(transaction::Methods& trx,
       if (parallelism > 1) {
         setContainsParallelNode();
       }
+    } else if (node->type == NODE_TYPE_ENUMERATE_PATHS) {
+      size_t parallelism = extractParallelism(node->getMember(5));
+      if (parallelism > 1) {
+        setContainsParallelNode();
+      }
     } else if (node->type == NODE_TYPE_FCALL) {
       auto func = static_cast<Function*>(node->getData());
       TRI_ASSERT(func != nullptr);
@@ -3743,6 +3851,25 @@ AstNode* Ast::optimizeFunctionCall(
         return createNodeFunctionCall("COLLECTION_COUNT", countArgs, true);
       }
     }
+  } else if (func->name == "FIRST") {
+    // shortcut FIRST(x[* FILTER ...]) to FIRST(x[* FILTER ... LIMIT 1]), so
+    // that the expansion can stop after the first matching item
+    auto args = node->getMember(0);
+    if (args->numMembers() == 1) {
+      auto arg = args->getMember(0);
+      if (arg->type == NODE_TYPE_EXPANSION &&
+          !arg->hasFlag(FLAG_BOOLEAN_EXPANSION) &&
+          arg->getMember(3)->type == NODE_TYPE_NOP) {
+        auto expansion = createNodeExpansion(
+            arg->getIntValue(true), arg->getMember(0), arg->getMember(1),
+            arg->getMember(2),
+            createNodeArrayLimit(nullptr, createNodeValueInt(1)),
+            arg->getMember(4));
+        auto firstArgs = createNodeArray();
+        firstArgs->addMember(expansion);
+        return createNodeFunctionCall("FIRST", firstArgs, true);
+      }
+    }
   } else if (func->name == "IS_NULL") {
     auto args = node->getMember(0);
     if (args->numMembers() == 1) {
@@ -63,6 +63,7 @@ namespace aql {
 class BindParameters;
 class QueryContext;
 class AqlFunctionsInternalCache;
+struct UserFunctionExpression;
 struct Variable;
 
 /// @brief type for Ast flags
@@ -422,6 +423,11 @@ class Ast {
                                   AstNode const* arguments,
                                   bool allowInternalFunctions);
 
+  /// @brief inline a call to an expression user function, by replacing all
+  /// parameters in the function body with the call arguments
+  AstNode* createNodeUserFunctionExpression(
+      UserFunctionExpression const& function, AstNode const* arguments);
+
   /// @brief create an AST function call node for aggregate functions
   AstNode* createNodeAggregateFunctionCall(std::string_view functionName,
                                            AstNode const* arguments);
@@ -438,9 +444,13 @@ class Ast {
   /// @brief create an AST n-ary operator
   AstNode* createNodeNaryOperator(AstNodeType, AstNode const*);
 
-  /// @brief injects bind parameters into the AST
-  void injectBindParameters(BindParameters& parameters,
-                            CollectionNameResolver const& resolver);
+  /// @brief injects bind parameters into the AST.
+  /// if valueParameters is set, the bind parameters contained in it are not
+  /// replaced with their values, but are left as (non-constant) parameter
+  /// nodes that are resolved at runtime. this is used for plan caching.
+  void injectBindParameters(
+      BindParameters& parameters, CollectionNameResolver const& resolver,
+      containers::FlatHashSet<std::string> const* valueParameters = nullptr);
 
   /// @brief replace variables
   ///        the unlock parameter will unlock the variable node before it
@@ -414,8 +414,8 @@ int compareAstNodes(AstNode const* lhs, AstNode const* rhs, bool compareUtf8) {
 }
 
 /// @brief create the node
-AstNode::AstNode(AstNodeType type)
-    : type(type), flags(0), _computedValue(nullptr), members{} {
+AstNode::AstNode(AstNodeType type, std::pmr::memory_resource* resource)
+    : type(type), flags(0), _computedValue(nullptr), members(resource) {
   // properly zero-initialize all members
   value.value._int = 0;
   value.length = 0;
@@ -433,8 +433,9 @@ AstNode::AstNode(AstNodeValue const& value)
       members{} {}
 
 /// @brief create the node from VPack
-AstNode::AstNode(Ast* ast, arangodb::velocypack::Slice slice)
-    : AstNode(getNodeTypeFromVPack(slice)) {
+AstNode::AstNode(Ast* ast, arangodb::velocypack::Slice slice,
+                 std::pmr::memory_resource* resource)
+    : AstNode(getNodeTypeFromVPack(slice), resource) {
   TRI_ASSERT(flags == 0);
   TRI_ASSERT(_computedValue == nullptr);
 
@@ -606,6 +607,13 @@ AstNode::AstNode(Ast* ast, arangodb::velocypack::Slice slice)
       break;
   }
 
+  if (type == NODE_TYPE_PARAMETER) {
+    // bind parameters only survive in serialized plans if they are
+    // supposed to be resolved at runtime (plans from the plan cache).
+    // they must not be treated as constants then.
+    setFlag(DETERMINED_CONSTANT);
+  }
+
   if (VPackSlice raw = slice.get("raw"); !raw.isNone()) {
     // hack: if there is a "raw" attribute, and we have either an array or
     // an object, it means that a special, more efficient/compact way of
@@ -1507,7 +1515,7 @@ bool AstNode::isSimple() const {
 
   if (type == NODE_TYPE_REFERENCE || type == NODE_TYPE_VALUE ||
       type == NODE_TYPE_VARIABLE || type == NODE_TYPE_NOP ||
-      type == NODE_TYPE_QUANTIFIER) {
+      type == NODE_TYPE_QUANTIFIER || type == NODE_TYPE_PARAMETER) {
     setFlag(DETERMINED_SIMPLE, VALUE_SIMPLE);
     return true;
   }
@@ -28,6 +28,7 @@
 #include <cstdint>
 #include <functional>
 #include <memory>
+#include <memory_resource>
 #include <string>
 #include <string_view>
 #include <vector>
@@ -235,14 +236,18 @@ struct AstNode {
   /// a binary sort to do lookups
   static constexpr size_t kSortNumberThreshold = 8;
 
-  /// @brief create the node
-  explicit AstNode(AstNodeType);
+  /// @brief create the node. the node's member array is allocated from
+  /// the given memory resource
+  explicit AstNode(AstNodeType, std::pmr::memory_resource* resource =
+                                    std::pmr::get_default_resource());
 
   /// @brief create a node, with defining a value
   explicit AstNode(AstNodeValue const& value);
 
   /// @brief create the node from VPack
-  explicit AstNode(Ast*, arangodb::velocypack::Slice slice);
+  explicit AstNode(Ast*, arangodb::velocypack::Slice slice,
+                   std::pmr::memory_resource* resource =
+                       std::pmr::get_default_resource());
 
   /// @brief destroy the node
   ~AstNode();
@@ -592,8 +597,9 @@ struct AstNode {
   /// @brief precomputed VPack value (used when executing expressions)
   uint8_t mutable* _computedValue;
 
-  /// @brief the node's sub nodes
-  std::vector<AstNode*> members{};
+  /// @brief the node's sub nodes. for nodes created via the Ast, the
+  /// memory is owned by the query's arena
+  std::pmr::vector<AstNode*> members;
 };
 
 template<bool resolveAttributeAccess = true>
@@ -40,52 +40,43 @@ char const* emptyString = "";
 
 AstResources::AstResources(ResourceMonitor& resourceMonitor)
     : _resourceMonitor(resourceMonitor),
+      _arena(_resourceMonitor),
       _stringsLength(0),
-      _shortStringStorage(_resourceMonitor, 1024),
-      _childNodes(0) {}
+      _shortStringStorage(_resourceMonitor, 1024) {}
 
 AstResources::~AstResources() {
   clear();
-  size_t memoryUsage = (_strings.capacity() * memoryUsageForStringBlock()) +
-                       (_childNodes * memoryUsageForChildNode());
+  size_t memoryUsage = _strings.capacity() * memoryUsageForStringBlock();
   _resourceMonitor.decreaseMemoryUsage(memoryUsage);
 }
 
 void AstResources::reserveChildNodes(AstNode* node, size_t n) {
-  // the following increaseMemoryUsage call can throw. if it does, then
-  // we don't have to roll back any state
-  _resourceMonitor.increaseMemoryUsage(n * memoryUsageForChildNode());
-  // now that we successfully reserved memory in the query, we can safely
-  // bump up the number of reserved childNodes.
-  _childNodes += n;
-
   TRI_ASSERT(node != nullptr);
-  // now reserve the actual space in the AstNode. this can still fail
-  // with OOM, but even if it does, there is no need to roll back the
-  // two modifications above. the number of child nodes and the tracked
-  // memory will be cleared in this class' dtor nicely.
+  // the member array of the node is allocated from the arena, which
+  // takes care of the memory usage tracking. this can throw if the
+  // memory limit of the query is exceeded.
   node->reserve(n);
 }
 
 // frees all data
 void AstResources::clear() noexcept {
-  size_t memoryUsage = (_nodes.numUsed() * sizeof(AstNode)) + _stringsLength +
-                       (_childNodes * memoryUsageForChildNode());
+  size_t memoryUsage = (_nodes.numUsed() * sizeof(AstNode)) + _stringsLength;
+  // the nodes must be destroyed before the arena that holds their members
   _nodes.clear();
+  _arena.release();
   clearStrings();
   _shortStringStorage.clear();
-  _childNodes = 0;
   _resourceMonitor.decreaseMemoryUsage(memoryUsage);
 }
 
 // frees most data (keeps a bit of memory around to avoid later re-allocations)
 void AstResources::clearMost() noexcept {
-  size_t memoryUsage = (_nodes.numUsed() * sizeof(AstNode)) + _stringsLength +
-                       (_childNodes * memoryUsageForChildNode());
+  size_t memoryUsage = (_nodes.numUsed() * sizeof(AstNode)) + _stringsLength;
+  // the nodes must be destroyed before the arena that holds their members
   _nodes.clearMost();
+  _arena.releaseMost();
   clearStrings();
   _shortStringStorage.clearMost();
-  _childNodes = 0;
   _resourceMonitor.decreaseMemoryUsage(memoryUsage);
 }
 
@@ -120,7 +111,7 @@ AstNode* AstResources::registerNode(AstNodeType type) {
   // may throw
   ResourceUsageScope scope(_resourceMonitor, sizeof(AstNode));
 
-  AstNode* node = _nodes.allocate(type);
+  AstNode* node = _nodes.allocate(type, &_arena);
 
   // now we are responsible for tracking the memory usage
   scope.steal();
@@ -132,7 +123,7 @@ AstNode* AstResources::registerNode(Ast* ast, velocypack::Slice slice) {
   // may throw
   ResourceUsageScope scope(_resourceMonitor, sizeof(AstNode));
 
-  AstNode* node = _nodes.allocate(ast, slice);
+  AstNode* node = _nodes.allocate(ast, slice, &_arena);
 
   // now we are responsible for tracking the memory usage
   scope.steal();
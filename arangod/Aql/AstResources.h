@@ -28,6 +28,7 @@
 #include <vector>
 
 #include "Aql/AstNode.h"
+#include "Aql/QueryArena.h"
 #include "Aql/ShortStringStorage.h"
 #include "Basics/Common.h"
 #include "Basics/FixedSizeAllocator.h"
@@ -52,9 +53,13 @@ class AstResources {
   explicit AstResources(ResourceMonitor&);
   ~AstResources();
 
-  // track number of child nodes of AstNodes. note: can throw!
+  // reserve space for child nodes of AstNodes. the memory is taken from
+  // the arena and tracked there. note: can throw!
   void reserveChildNodes(AstNode* node, size_t n);
 
+  // arena used for the member arrays of AstNodes
+  QueryArena& arena() noexcept { return _arena; }
+
   // frees all data
   void clear() noexcept;
 
@@ -87,9 +92,6 @@ class AstResources {
   // return the memory usage for a block of strings
   constexpr static size_t memoryUsageForStringBlock() { return sizeof(char*); }
 
-  // return the memory usage for an AstNode child node pointer
-  constexpr static size_t memoryUsageForChildNode() { return sizeof(AstNode*); }
-
   // return the minimum capacity for long strings container
   constexpr static size_t kMinCapacityForLongStrings = 8;
 
@@ -108,6 +110,10 @@ class AstResources {
   // resource monitor used for tracking allocations/deallocations
   ResourceMonitor& _resourceMonitor;
 
+  // arena for the member arrays of all nodes. must be declared before
+  // _nodes, so that it outlives the nodes
+  QueryArena _arena;
+
   // all nodes created in the AST - will be used for freeing them later
   FixedSizeAllocator<AstNode> _nodes;
 
@@ -120,9 +126,6 @@ class AstResources {
   // short string storage. uses less memory allocations for short
   /// strings
   ShortStringStorage _shortStringStorage;
-
-  // number of child node pointers (for which memory was allocated)
-  size_t _childNodes;
 };
 
 }  // namespace aql
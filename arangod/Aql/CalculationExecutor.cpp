@@ -27,16 +27,22 @@
 #include "Aql/AqlCall.h"
 #include "Aql/AqlCallStack.h"
 #include "Aql/AqlItemBlockInputRange.h"
+#include "Aql/Ast.h"
 #include "Aql/ExecutorExpressionContext.h"
 #include "Aql/Expression.h"
+#include "Aql/Function.h"
 #include "Aql/OutputAqlItemRow.h"
 #include "Aql/Query.h"
 #include "Aql/SingleRowFetcher.h"
+#include "Aql/Variable.h"
 #include "Basics/Exceptions.h"
 #include "Basics/ScopeGuard.h"
+#include "Basics/VelocyPackHelper.h"
 #include "Cluster/ServerState.h"
 #include "V8/v8-globals.h"
 
+#include <algorithm>
+
 using namespace arangodb;
 using namespace arangodb::aql;
 
@@ -56,7 +62,15 @@ CalculationExecutor<calculationType>::CalculationExecutor(
       _fetcher(fetcher),
       _currentRow(InputAqlItemRow{CreateInvalidInputRowHint{}}),
       _rowState(ExecutionState::HASMORE),
-      _hasEnteredContext(false) {}
+      _hasEnteredContext(false) {
+  if constexpr (calculationType == CalculationType::Condition) {
+    prepareNumericComparison();
+    _numericProgram = NumericExpressionProgram::compile(
+        _infos.getExpression().node(), _infos.getQuery(),
+        _infos.getVarToRegs());
+    prepareBatchedFunctionCall();
+  }
+}
 
 template<CalculationType calculationType>
 CalculationExecutor<calculationType>::~CalculationExecutor() = default;
@@ -86,6 +100,17 @@ CalculationExecutor<calculationType>::produceRows(
   TRI_IF_FAILURE("CalculationExecutor::produceRows") {
     THROW_ARANGO_EXCEPTION(TRI_ERROR_DEBUG);
   }
+  if constexpr (calculationType == CalculationType::Condition) {
+    if (_batchedFunctionCall.has_value()) {
+      while (inputRange.hasDataRow()) {
+        // This executor is passthrough. it has enough place to write.
+        TRI_ASSERT(!output.isFull());
+        evaluateBatchedFunctionCall(inputRange, output);
+      }
+      return {inputRange.upstreamState(), NoStats{}, output.getClientCall()};
+    }
+  }
+
   ExecutorState state = ExecutorState::HASMORE;
   InputAqlItemRow input{CreateInvalidInputRowHint{}};
 
@@ -167,9 +192,278 @@ void CalculationExecutor<CalculationType::Reference>::doEvaluation(
                                    _infos.getOutputRegisterId());
 }
 
+template<CalculationType calculationType>
+void CalculationExecutor<calculationType>::prepareNumericComparison() {
+  AstNode const* node = _infos.getExpression().node();
+  if (node == nullptr || (node->type != NODE_TYPE_OPERATOR_BINARY_EQ &&
+                          node->type != NODE_TYPE_OPERATOR_BINARY_NE &&
+                          node->type != NODE_TYPE_OPERATOR_BINARY_LT &&
+                          node->type != NODE_TYPE_OPERATOR_BINARY_LE &&
+                          node->type != NODE_TYPE_OPERATOR_BINARY_GT &&
+                          node->type != NODE_TYPE_OPERATOR_BINARY_GE)) {
+    return;
+  }
+
+  auto const& varToRegs = _infos.getVarToRegs();
+  if (varToRegs.size() != 1) {
+    return;
+  }
+
+  // returns the numeric value of a constant operand, or of a bind parameter
+  // that is resolved at runtime. returns a none slice for all other operands
+  VPackBuilder constant;
+  auto numericValue = [&](AstNode const* operand) -> VPackSlice {
+    if (operand->type == NODE_TYPE_VALUE && operand->isNumericValue()) {
+      constant.clear();
+      operand->toVelocyPackValue(constant);
+      return constant.slice();
+    }
+    if (operand->type == NODE_TYPE_PARAMETER) {
+      VPackSlice value =
+          _infos.getQuery().bindParameterValue(operand->getStringView());
+      if (value.isNumber()) {
+        constant.clear();
+        constant.add(value);
+        return constant.slice();
+      }
+    }
+    return VPackSlice::noneSlice();
+  };
+
+  AstNode const* lhs = node->getMemberUnchecked(0);
+  AstNode const* rhs = node->getMemberUnchecked(1);
+  AstNodeType comparisonType = node->type;
+  if (numericValue(rhs).isNone()) {
+    if (numericValue(lhs).isNone()) {
+      return;
+    }
+    // constant on the left-hand side. reverse the comparison
+    std::swap(lhs, rhs);
+    comparisonType = Ast::ReverseOperator(comparisonType);
+  }
+
+  // collect the attribute path, e.g. ["a", "b"] for `doc.a.b`
+  std::vector<std::string> path;
+  while (lhs->type == NODE_TYPE_ATTRIBUTE_ACCESS) {
+    path.emplace_back(lhs->getString());
+    lhs = lhs->getMemberUnchecked(0);
+  }
+  if (lhs->type != NODE_TYPE_REFERENCE ||
+      static_cast<Variable const*>(lhs->getData())->id !=
+          varToRegs[0].first) {
+    return;
+  }
+  std::reverse(path.begin(), path.end());
+
+  NumericComparison comparison;
+  comparison.inputRegister = varToRegs[0].second;
+  comparison.path = std::move(path);
+  comparison.comparisonType = comparisonType;
+  comparison.constant = std::move(constant);
+  TRI_ASSERT(comparison.constant.slice().isNumber());
+  _numericComparison = std::move(comparison);
+}
+
+template<CalculationType calculationType>
+bool CalculationExecutor<calculationType>::evaluateNumericComparison(
+    InputAqlItemRow& input, OutputAqlItemRow& output) {
+  TRI_ASSERT(_numericComparison.has_value());
+  NumericComparison const& comparison = *_numericComparison;
+
+  TRI_IF_FAILURE("CalculationBlock::executeExpression") {
+    THROW_ARANGO_EXCEPTION(TRI_ERROR_DEBUG);
+  }
+
+  AqlValue const& value = input.getValue(comparison.inputRegister);
+  VPackSlice slice;
+  if (comparison.path.empty()) {
+    if (!value.isNumber()) {
+      return false;
+    }
+    slice = value.slice();
+  } else {
+    if (!value.isObject()) {
+      return false;
+    }
+    slice = value.slice().resolveExternals();
+    for (auto const& attribute : comparison.path) {
+      if (!slice.isObject()) {
+        return false;
+      }
+      slice = slice.get(attribute).resolveExternals();
+    }
+  }
+
+  if (!slice.isNumber()) {
+    // null, strings, arrays etc. are handled by the generic evaluation
+    return false;
+  }
+
+  // numbers are compared with the same semantics as in
+  // VelocyPackHelper::compare
+  int cmp = basics::VelocyPackHelper::compareNumberValues(
+      slice.type(), slice, comparison.constant.slice());
+
+  bool result;
+  switch (comparison.comparisonType) {
+    case NODE_TYPE_OPERATOR_BINARY_EQ:
+      result = (cmp == 0);
+      break;
+    case NODE_TYPE_OPERATOR_BINARY_NE:
+      result = (cmp != 0);
+      break;
+    case NODE_TYPE_OPERATOR_BINARY_LT:
+      result = (cmp < 0);
+      break;
+    case NODE_TYPE_OPERATOR_BINARY_LE:
+      result = (cmp <= 0);
+      break;
+    case NODE_TYPE_OPERATOR_BINARY_GT:
+      result = (cmp > 0);
+      break;
+    case NODE_TYPE_OPERATOR_BINARY_GE:
+      result = (cmp >= 0);
+      break;
+    default:
+      TRI_ASSERT(false);
+      return false;
+  }
+
+  AqlValue a{AqlValueHintBool(result)};
+  AqlValueGuard guard(a, /*destroy*/ false);
+  output.moveValueInto(_infos.getOutputRegisterId(), input, guard);
+  return true;
+}
+
+template<CalculationType calculationType>
+void CalculationExecutor<calculationType>::prepareBatchedFunctionCall() {
+  Expression& expression = _infos.getExpression();
+  AstNode const* node = expression.node();
+  if (node == nullptr || node->type != NODE_TYPE_FCALL) {
+    return;
+  }
+  auto const* func = static_cast<Function const*>(node->getData());
+  TRI_ASSERT(func != nullptr);
+  if (func->batchImplementation == nullptr) {
+    return;
+  }
+
+  AstNode* args = expression.nodeForModification()->getMemberUnchecked(0);
+  TRI_ASSERT(args->type == NODE_TYPE_ARRAY);
+  size_t const n = args->numMembers();
+  if (n == 0) {
+    return;
+  }
+
+  BatchedFunctionCall call;
+  call.function = func;
+  call.node = node;
+  call.parameters.reserve(n);
+  // placeholder for the first argument
+  call.parameters.emplace_back(AqlValueHintNull());
+  for (size_t i = 1; i < n; ++i) {
+    AstNode const* arg = args->getMemberUnchecked(i);
+    if (!arg->isConstant()) {
+      return;
+    }
+    // the value is owned by the AST node
+    call.parameters.emplace_back(AqlValueHintSliceNoCopy(arg->computeValue()));
+  }
+
+  AstNode* first = args->getMemberUnchecked(0);
+  if (first->type == NODE_TYPE_COLLECTION || first->willUseV8()) {
+    return;
+  }
+  call.argument = std::make_unique<Expression>(expression.ast(), first);
+  _batchedFunctionCall = std::move(call);
+}
+
+template<CalculationType calculationType>
+void CalculationExecutor<calculationType>::evaluateBatchedFunctionCall(
+    AqlItemBlockInputRange& inputRange, OutputAqlItemRow& output) {
+  TRI_ASSERT(_batchedFunctionCall.has_value());
+  BatchedFunctionCall& call = *_batchedFunctionCall;
+
+  auto cleanup = scopeGuard([this]() noexcept {
+    for (size_t i = 0; i < _batchValues.size(); ++i) {
+      if (_batchMustDestroy[i]) {
+        _batchValues[i].destroy();
+      }
+    }
+    for (auto& result : _batchResults) {
+      result.destroy();
+    }
+    _batchRows.clear();
+    _batchValues.clear();
+    _batchMustDestroy.clear();
+    _batchResults.clear();
+  });
+
+  size_t const maxRows = output.numRowsLeft();
+  _batchRows.reserve(maxRows);
+  _batchValues.reserve(maxRows);
+  _batchMustDestroy.reserve(maxRows);
+
+  // evaluate the first function argument for all rows
+  std::optional<ExecutorExpressionContext> ctx;
+  while (inputRange.hasDataRow() && _batchRows.size() < maxRows) {
+    _batchRows.emplace_back(
+        inputRange.nextDataRow(AqlItemBlockInputRange::HasDataRow{}).second);
+    TRI_ASSERT(_batchRows.back().isInitialized());
+    if (ctx.has_value()) {
+      ctx->adjustInputRow(_batchRows.back());
+    } else {
+      ctx.emplace(_trx, _infos.getQuery(), _aqlFunctionsInternalCache,
+                  _batchRows.back(), _infos.getVarToRegs());
+    }
+
+    bool mustDestroy;
+    AqlValue a = call.argument->execute(&*ctx, mustDestroy);
+    _batchValues.emplace_back(a);
+    _batchMustDestroy.emplace_back(mustDestroy ? 1 : 0);
+  }
+  TRI_ASSERT(!_batchRows.empty());
+
+  TRI_IF_FAILURE("CalculationBlock::executeExpression") {
+    THROW_ARANGO_EXCEPTION(TRI_ERROR_DEBUG);
+  }
+
+  // and call the function once for all rows
+  _batchResults.resize(_batchRows.size());
+  call.function->batchImplementation(&*ctx, *call.node, _batchValues,
+                                     call.parameters, _batchResults);
+
+  for (size_t i = 0; i < _batchRows.size(); ++i) {
+    AqlValueGuard guard(_batchResults[i], /*destroy*/ true);
+    output.moveValueInto(_infos.getOutputRegisterId(), _batchRows[i], guard);
+    // the output is now responsible for the value
+    _batchResults[i].erase();
+    output.advanceRow();
+  }
+}
+
 template<>
 void CalculationExecutor<CalculationType::Condition>::doEvaluation(
     InputAqlItemRow& input, OutputAqlItemRow& output) {
+  if (_numericComparison.has_value() &&
+      evaluateNumericComparison(input, output)) {
+    return;
+  }
+
+  if (_numericProgram.has_value()) {
+    TRI_IF_FAILURE("CalculationBlock::executeExpression") {
+      THROW_ARANGO_EXCEPTION(TRI_ERROR_DEBUG);
+    }
+    if (auto result = _numericProgram->evaluate(input); result.has_value()) {
+      // this will convert NaN, +inf & -inf to null, in the same way as the
+      // generic evaluation
+      AqlValue a{AqlValueHintDouble(*result)};
+      AqlValueGuard guard(a, /*destroy*/ false);
+      output.moveValueInto(_infos.getOutputRegisterId(), input, guard);
+      return;
+    }
+  }
+
   // execute the expression
   ExecutorExpressionContext ctx(_trx, _infos.getQuery(),
                                 _aqlFunctionsInternalCache, input,
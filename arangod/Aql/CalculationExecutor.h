@@ -23,14 +23,22 @@
 
 #pragma once
 
+#include "Aql/AqlValue.h"
 #include "Aql/ExecutionState.h"
 #include "Aql/InputAqlItemRow.h"
 #include "Aql/AqlFunctionsInternalCache.h"
+#include "Aql/AstNode.h"
+#include "Aql/NumericExpressionProgram.h"
 #include "Aql/RegisterInfos.h"
 #include "Aql/Stats.h"
 #include "Aql/types.h"
 #include "Transaction/Methods.h"
 
+#include <velocypack/Builder.h>
+
+#include <memory>
+#include <optional>
+#include <string>
 #include <unordered_set>
 #include <vector>
 
@@ -44,6 +52,7 @@ namespace aql {
 struct AqlCall;
 class AqlItemBlockInputRange;
 class Expression;
+struct Function;
 class OutputAqlItemRow;
 class QueryContext;
 template<BlockPassthrough>
@@ -123,6 +132,49 @@ class CalculationExecutor {
 
   [[nodiscard]] bool shouldExitContextBetweenBlocks() const noexcept;
 
+  // comparison of an input register value (or one of its nested attributes)
+  // with a numeric constant, e.g. `doc.value > 10`. such comparisons are
+  // evaluated directly on the input values, bypassing the generic expression
+  // evaluation. only used for CalculationType::Condition
+  struct NumericComparison {
+    RegisterId inputRegister;
+    // attribute path to look up in the register value. empty if the register
+    // value itself is compared
+    std::vector<std::string> path;
+    AstNodeType comparisonType;
+    // the numeric constant to compare with
+    velocypack::Builder constant;
+  };
+
+  // set up _numericComparison if the calculation's expression qualifies
+  void prepareNumericComparison();
+
+  // evaluate the numeric comparison for a single row. returns false if the
+  // input value is not a number, so that the generic evaluation must be used
+  bool evaluateNumericComparison(InputAqlItemRow& input,
+                                 OutputAqlItemRow& output);
+
+  // call of a function with a batched implementation, whose first argument
+  // depends on the input row and whose other arguments are constant, e.g.
+  // `DATE_TRUNC(doc.ts, "day")`. such calls are evaluated for all rows of
+  // the current input block at once. only used for CalculationType::Condition
+  struct BatchedFunctionCall {
+    Function const* function;
+    AstNode const* node;
+    // expression for the first function argument
+    std::unique_ptr<Expression> argument;
+    // all function arguments. the value at position 0 is a placeholder
+    std::vector<AqlValue> parameters;
+  };
+
+  // set up _batchedFunctionCall if the calculation's expression qualifies
+  void prepareBatchedFunctionCall();
+
+  // evaluate the batched function call for as many input rows as fit into
+  // the output
+  void evaluateBatchedFunctionCall(AqlItemBlockInputRange& inputRange,
+                                   OutputAqlItemRow& output);
+
  private:
   transaction::Methods _trx;
   aql::AqlFunctionsInternalCache _aqlFunctionsInternalCache;
@@ -137,6 +189,20 @@ class CalculationExecutor {
   // Necessary for owned contexts, which will not be exited when we call
   // exitContext; but only for assertions in maintainer mode.
   bool _hasEnteredContext;
+
+  std::optional<NumericComparison> _numericComparison;
+
+  // compiled form of a purely arithmetic expression, evaluated without
+  // walking the AST. only used for CalculationType::Condition
+  std::optional<NumericExpressionProgram> _numericProgram;
+
+  std::optional<BatchedFunctionCall> _batchedFunctionCall;
+
+  // buffers for evaluating _batchedFunctionCall, reused between batches
+  std::vector<InputAqlItemRow> _batchRows;
+  std::vector<AqlValue> _batchValues;
+  std::vector<uint8_t> _batchMustDestroy;
+  std::vector<AqlValue> _batchResults;
 };
 
 }  // namespace aql
@@ -23,8 +23,11 @@
 
 #include "ClusterQuery.h"
 
+#include "Aql/AqlCallStack.h"
+#include "Aql/AqlExecuteResult.h"
 #include "Aql/Ast.h"
 #include "Aql/AqlTransaction.h"
+#include "Aql/ExecutionBlock.h"
 #include "Aql/ExecutionEngine.h"
 #include "Aql/Timing.h"
 #include "Aql/QueryCache.h"
@@ -171,6 +174,13 @@ void ClusterQuery::prepareClusterQuery(
     _plans.push_back(std::move(plan));
   };
 
+  // snippets that can be executed right away, so that their first batch
+  // can be returned along with the setup response
+  std::vector<ExecutionEngine*> prefetchSnippets;
+  bool const prefetch = _trx->state()->isDBServer() &&
+                        _trx->state()->isReadOnlyTransaction() &&
+                        querySlice.get("prefetch").isTrue();
+
   answerBuilder.add("snippets", VPackValue(VPackValueType::Object));
   for (auto pair : VPackObjectIterator(snippets, /*sequential*/ true)) {
     instantiateSnippet(pair.value);
@@ -179,6 +189,10 @@ void ClusterQuery::prepareClusterQuery(
     TRI_ASSERT(!_trx->state()->isDBServer() ||
                _snippets.back()->engineId() != 0);
 
+    if (prefetch && canExecuteDuringSetup(*_plans.back(), *_snippets.back())) {
+      prefetchSnippets.push_back(_snippets.back().get());
+    }
+
     answerBuilder.add(pair.key);
     answerBuilder.add(VPackValue(std::to_string(_snippets.back()->engineId())));
   }
@@ -212,6 +226,49 @@ void ClusterQuery::prepareClusterQuery(
     _queryProfile->registerInQueryList();
   }
   enterState(QueryExecutionState::ValueType::EXECUTION);
+
+  if (!prefetchSnippets.empty()) {
+    // execute the snippets with the default call, the same way as the
+    // RestAqlHandler would do it for an execute call. the coordinator will
+    // serve the calls of its RemoteExecutors from these results first
+    AqlCallStack const defaultStack{AqlCallList{AqlCall{}}};
+    answerBuilder.add("prefetch", VPackValue(VPackValueType::Object));
+    for (auto* engine : prefetchSnippets) {
+      auto [state, skipped, block] = engine->execute(defaultStack);
+      // snippets which might need to wait were excluded before
+      TRI_ASSERT(state != ExecutionState::WAITING);
+      answerBuilder.add(VPackValue(std::to_string(engine->engineId())));
+      AqlExecuteResult{state, skipped, std::move(block)}.toVelocyPack(
+          answerBuilder, &vpackOptions());
+    }
+    answerBuilder.close();  // prefetch
+  }
+}
+
+bool ClusterQuery::canExecuteDuringSetup(ExecutionPlan const& plan,
+                                         ExecutionEngine const& engine) const {
+  auto const* root = engine.root()->getPlanNode();
+  if (root->getType() == ExecutionNode::SCATTER ||
+      root->getType() == ExecutionNode::DISTRIBUTE) {
+    // these deliver data to multiple clients
+    return false;
+  }
+  if (root->isInSplicedSubquery()) {
+    // the coordinator will send calls for multiple subquery levels, which
+    // we cannot predict
+    return false;
+  }
+  // all nodes that may need to wait for other servers, so that the
+  // execution could return WAITING
+  for (auto type :
+       {ExecutionNode::REMOTE, ExecutionNode::ASYNC, ExecutionNode::MUTEX,
+        ExecutionNode::TRAVERSAL, ExecutionNode::SHORTEST_PATH,
+        ExecutionNode::ENUMERATE_PATHS, ExecutionNode::DISTRIBUTE_CONSUMER}) {
+    if (plan.contains(type)) {
+      return false;
+    }
+  }
+  return true;
 }
 
 futures::Future<Result> ClusterQuery::finalizeClusterQuery(
@@ -260,6 +317,8 @@ futures::Future<Result> ClusterQuery::finalizeClusterQuery(
     _execStats.setPeakMemoryUsage(_resourceMonitor.peak());
     _execStats.setExecutionTime(elapsedSince(_startTime));
     _execStats.setIntermediateCommits(_trx->state()->numIntermediateCommits());
+    // reported back to the coordinator together with the other stats
+    _execStats.resources.add(_resourceUsage.steal());
     _shutdownState.store(ShutdownState::Done);
 
     unregisterQueryInTransactionState();
@@ -64,6 +64,11 @@ class ClusterQuery : public Query {
   void waitForSatellites();
 #endif
 
+  /// @brief whether a snippet can be executed while the query is set up,
+  /// without the need to wait for other snippets or servers
+  bool canExecuteDuringSetup(ExecutionPlan const& plan,
+                             ExecutionEngine const& engine) const;
+
   /// @brief first one should be the local one
   traverser::GraphEngineList _traversers;
 
@@ -36,6 +36,7 @@
 #include "Aql/SortedCollectExecutor.h"
 #include "Aql/VariableGenerator.h"
 #include "Aql/WalkerWorker.h"
+#include "RestServer/TemporaryStorageFeature.h"
 #include "Transaction/Methods.h"
 
 #include <velocypack/Builder.h>
@@ -393,7 +394,13 @@ std::unique_ptr<ExecutionBlock> CollectNode::createBlock(
       TRI_ASSERT(groupRegisters.size() == 1);
       auto executorInfos = DistinctCollectExecutorInfos(
           groupRegisters.front(), &_plan->getAst()->query().vpackOptions(),
-          _plan->getAst()->query().resourceMonitor());
+          _plan->getAst()->query().resourceMonitor(),
+          engine.getQuery()
+              .vocbase()
+              .server()
+              .getFeature<TemporaryStorageFeature>(),
+          engine.getQuery().queryOptions().spillOverThresholdNumRows,
+          engine.getQuery().queryOptions().spillOverThresholdMemoryUsage);
 
       return std::make_unique<ExecutionBlockImpl<DistinctCollectExecutor>>(
           &engine, this, std::move(registerInfos), std::move(executorInfos));
@@ -802,11 +809,20 @@ bool CollectNode::hasExpressionVariable() const {
   return _expressionVariable != nullptr;
 }
 
+Variable const* CollectNode::expressionVariable() const {
+  return _expressionVariable;
+}
+
 void CollectNode::expressionVariable(Variable const* variable) {
   TRI_ASSERT(!hasExpressionVariable());
   _expressionVariable = variable;
 }
 
+void CollectNode::clearExpressionVariable() {
+  TRI_ASSERT(_expressionVariable != nullptr);
+  _expressionVariable = nullptr;
+}
+
 bool CollectNode::hasKeepVariables() const { return !_keepVariables.empty(); }
 
 std::vector<Variable const*> const& CollectNode::keepVariables() const {
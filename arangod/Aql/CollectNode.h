@@ -151,9 +151,15 @@ class CollectNode : public ExecutionNode {
   /// = expr)
   bool hasExpressionVariable() const;
 
+  /// @brief return the expression variable
+  Variable const* expressionVariable() const;
+
   /// @brief set the expression variable
   void expressionVariable(Variable const* variable);
 
+  /// @brief clear the expression variable
+  void clearExpressionVariable();
+
   /// @brief return whether or not the collect has keep variables
   bool hasKeepVariables() const;
 
@@ -27,6 +27,8 @@
 #include "DistinctCollectExecutor.h"
 
 #include "Aql/AqlValue.h"
+#include "Aql/AqlValueMaterializer.h"
+#include "Aql/DistinctValuesStorageBackend.h"
 #include "Aql/InputAqlItemRow.h"
 #include "Aql/OutputAqlItemRow.h"
 #include "Aql/RegisterInfos.h"
@@ -34,7 +36,9 @@
 #include "Aql/Stats.h"
 #include "Basics/Exceptions.h"
 #include "Basics/ResourceUsage.h"
+#include "Basics/VelocyPackHelper.h"
 #include "Logger/LogMacros.h"
+#include "RestServer/TemporaryStorageFeature.h"
 
 #include <utility>
 
@@ -45,10 +49,15 @@ using namespace arangodb::aql;
 
 DistinctCollectExecutorInfos::DistinctCollectExecutorInfos(
     std::pair<RegisterId, RegisterId> groupRegister,
-    velocypack::Options const* opts, arangodb::ResourceMonitor& resourceMonitor)
+    velocypack::Options const* opts, arangodb::ResourceMonitor& resourceMonitor,
+    TemporaryStorageFeature& tempStorage, size_t spillOverThresholdNumRows,
+    size_t spillOverThresholdMemoryUsage)
     : _groupRegister(std::move(groupRegister)),
       _vpackOptions(opts),
-      _resourceMonitor(resourceMonitor) {}
+      _resourceMonitor(resourceMonitor),
+      _tempStorage(tempStorage),
+      _spillOverThresholdNumRows(spillOverThresholdNumRows),
+      _spillOverThresholdMemoryUsage(spillOverThresholdMemoryUsage) {}
 
 std::pair<RegisterId, RegisterId> const&
 DistinctCollectExecutorInfos::getGroupRegister() const {
@@ -64,10 +73,29 @@ arangodb::ResourceMonitor& DistinctCollectExecutorInfos::getResourceMonitor()
   return _resourceMonitor;
 }
 
+TemporaryStorageFeature&
+DistinctCollectExecutorInfos::getTemporaryStorageFeature() const noexcept {
+  return _tempStorage;
+}
+
+size_t DistinctCollectExecutorInfos::spillOverThresholdNumRows()
+    const noexcept {
+  return _spillOverThresholdNumRows;
+}
+
+size_t DistinctCollectExecutorInfos::spillOverThresholdMemoryUsage()
+    const noexcept {
+  return _spillOverThresholdMemoryUsage;
+}
+
 DistinctCollectExecutor::DistinctCollectExecutor(Fetcher&, Infos& infos)
     : _infos(infos),
       _seen(1024, AqlValueGroupHash(1),
-            AqlValueGroupEqual(_infos.vpackOptions())) {}
+            AqlValueGroupEqual(_infos.vpackOptions())),
+      _memoryUsage(0),
+      _canSpill(_infos.getTemporaryStorageFeature().canBeUsed()),
+      _spilledValuesSealed(false),
+      _lastSpilledRow(CreateInvalidInputRowHint{}) {}
 
 DistinctCollectExecutor::~DistinctCollectExecutor() { destroyValues(); }
 
@@ -76,6 +104,10 @@ void DistinctCollectExecutor::initializeCursor() { destroyValues(); }
 [[nodiscard]] auto DistinctCollectExecutor::expectedNumberOfRowsNew(
     AqlItemBlockInputRange const& input, AqlCall const& call) const noexcept
     -> size_t {
+  if (_spilledValues != nullptr) {
+    // we do not know how many distinct values are still on disk
+    return call.getLimit();
+  }
   if (input.finalState() == MainQueryState::DONE) {
     // Worst case assumption:
     // For every input row we have a new group.
@@ -87,14 +119,18 @@ void DistinctCollectExecutor::initializeCursor() { destroyValues(); }
 }
 
 void DistinctCollectExecutor::destroyValues() {
-  size_t memoryUsage = 0;
   // destroy all AqlValues captured
   for (auto& value : _seen) {
-    memoryUsage += memoryUsageForGroup(value);
     const_cast<AqlValue*>(&value)->destroy();
   }
   _seen.clear();
-  _infos.getResourceMonitor().decreaseMemoryUsage(memoryUsage);
+  _infos.getResourceMonitor().decreaseMemoryUsage(_memoryUsage);
+  _memoryUsage = 0;
+
+  _spilledValues.reset();
+  _spilledValuesSealed = false;
+  _lastSpilledRow = InputAqlItemRow{CreateInvalidInputRowHint{}};
+  _lastSpilledValue.clear();
 }
 
 const DistinctCollectExecutor::Infos& DistinctCollectExecutor::infos()
@@ -111,6 +147,7 @@ auto DistinctCollectExecutor::produceRows(AqlItemBlockInputRange& inputRange,
 
   InputAqlItemRow input{CreateInvalidInputRowHint{}};
   ExecutorState state = ExecutorState::HASMORE;
+  Stats stats;
 
   INTERNAL_LOG_DC << output.getClientCall();
 
@@ -133,23 +170,50 @@ auto DistinctCollectExecutor::produceRows(AqlItemBlockInputRange& inputRange,
     AqlValue groupValue = input.getValue(_infos.getGroupRegister().second);
 
     // now check if we already know this group
-    if (!_seen.contains(groupValue)) {
-      size_t memoryUsage = memoryUsageForGroup(groupValue);
-      arangodb::ResourceUsageScope guard(_infos.getResourceMonitor(),
-                                         memoryUsage);
+    if (_seen.contains(groupValue)) {
+      continue;
+    }
 
-      output.cloneValueInto(_infos.getGroupRegister().first, input, groupValue);
-      output.advanceRow();
+    if (mustSpill()) {
+      // the value will be produced after upstream is exhausted
+      spillValue(input, groupValue);
+      continue;
+    }
+
+    size_t memoryUsage = memoryUsageForGroup(groupValue);
+    arangodb::ResourceUsageScope guard(_infos.getResourceMonitor(),
+                                       memoryUsage);
+
+    output.cloneValueInto(_infos.getGroupRegister().first, input, groupValue);
+    output.advanceRow();
+
+    _seen.emplace(groupValue.clone());
+
+    // now we are responsible for memory tracking
+    guard.steal();
+    _memoryUsage += memoryUsage;
+  }
 
-      _seen.emplace(groupValue.clone());
+  if (_spilledValues != nullptr &&
+      inputRange.upstreamState() == ExecutorState::DONE) {
+    sealSpilledValues(stats);
 
-      // now we are responsible for memory tracking
-      guard.steal();
+    while (!output.isFull() && nextSpilledValue()) {
+      AqlValue value(_spilledValues->current());
+      AqlValueGuard guard(value, true);
+      output.moveValueInto(_infos.getGroupRegister().first, _lastSpilledRow,
+                           guard);
+      output.advanceRow();
+      consumeSpilledValue();
+    }
+
+    if (nextSpilledValue()) {
+      return {ExecutorState::HASMORE, stats, {}};
     }
   }
 
   INTERNAL_LOG_DC << "returning state " << state;
-  return {inputRange.upstreamState(), {}, {}};
+  return {inputRange.upstreamState(), stats, {}};
 }
 
 auto DistinctCollectExecutor::skipRowsRange(AqlItemBlockInputRange& inputRange,
@@ -163,6 +227,7 @@ auto DistinctCollectExecutor::skipRowsRange(AqlItemBlockInputRange& inputRange,
   ExecutorState state = ExecutorState::HASMORE;
 
   size_t skipped = 0;
+  Stats stats;
 
   INTERNAL_LOG_DC << call;
 
@@ -171,7 +236,7 @@ auto DistinctCollectExecutor::skipRowsRange(AqlItemBlockInputRange& inputRange,
                     << call.needSkipMore();
 
     if (!call.needSkipMore()) {
-      return {ExecutorState::HASMORE, {}, skipped, {}};
+      return {ExecutorState::HASMORE, stats, skipped, {}};
     }
 
     std::tie(state, input) =
@@ -184,22 +249,100 @@ auto DistinctCollectExecutor::skipRowsRange(AqlItemBlockInputRange& inputRange,
     AqlValue groupValue = input.getValue(_infos.getGroupRegister().second);
 
     // now check if we already know this group
-    if (!_seen.contains(groupValue)) {
+    if (_seen.contains(groupValue)) {
+      continue;
+    }
+
+    if (mustSpill()) {
+      // the value will be skipped after upstream is exhausted
+      spillValue(input, groupValue);
+      continue;
+    }
+
+    skipped += 1;
+    call.didSkip(1);
+
+    size_t memoryUsage = memoryUsageForGroup(groupValue);
+    arangodb::ResourceUsageScope guard(_infos.getResourceMonitor(),
+                                       memoryUsage);
+
+    _seen.emplace(groupValue.clone());
+
+    // now we are responsible for memory tracking
+    guard.steal();
+    _memoryUsage += memoryUsage;
+  }
+
+  if (_spilledValues != nullptr &&
+      inputRange.upstreamState() == ExecutorState::DONE) {
+    sealSpilledValues(stats);
+
+    while (call.needSkipMore() && nextSpilledValue()) {
       skipped += 1;
       call.didSkip(1);
+      consumeSpilledValue();
+    }
+
+    if (nextSpilledValue()) {
+      return {ExecutorState::HASMORE, stats, skipped, {}};
+    }
+  }
+
+  return {inputRange.upstreamState(), stats, skipped, {}};
+}
 
-      size_t memoryUsage = memoryUsageForGroup(groupValue);
-      arangodb::ResourceUsageScope guard(_infos.getResourceMonitor(),
-                                         memoryUsage);
+bool DistinctCollectExecutor::mustSpill() const noexcept {
+  return _canSpill &&
+         (_seen.size() >= _infos.spillOverThresholdNumRows() ||
+          _memoryUsage >= _infos.spillOverThresholdMemoryUsage());
+}
 
-      _seen.emplace(groupValue.clone());
+void DistinctCollectExecutor::spillValue(InputAqlItemRow const& input,
+                                         AqlValue const& value) {
+  TRI_ASSERT(!_spilledValuesSealed);
+  if (_spilledValues == nullptr) {
+    _spilledValues =
+        _infos.getTemporaryStorageFeature().getDistinctValuesStorage();
+  }
 
-      // now we are responsible for memory tracking
-      guard.steal();
+  AqlValueMaterializer materializer(_infos.vpackOptions());
+  _spilledValues->addValue(materializer.slice(value, true));
+  // all rows of the current input have the same values in the
+  // registers we need to keep, so any input row will do
+  _lastSpilledRow = input;
+}
+
+void DistinctCollectExecutor::sealSpilledValues(Stats& stats) {
+  TRI_ASSERT(_spilledValues != nullptr);
+  if (!_spilledValuesSealed) {
+    _spilledValues->seal();
+    _spilledValuesSealed = true;
+    // report the switch to the temporary storage exactly once
+    stats.incrSpills();
+  }
+}
+
+bool DistinctCollectExecutor::nextSpilledValue() {
+  TRI_ASSERT(_spilledValuesSealed);
+  // spilled values are returned in sorted order, so duplicates are
+  // adjacent
+  while (_spilledValues->hasMore()) {
+    if (_lastSpilledValue.isEmpty() ||
+        basics::VelocyPackHelper::compare(_lastSpilledValue.slice(),
+                                          _spilledValues->current(), false,
+                                          _infos.vpackOptions()) != 0) {
+      return true;
     }
+    _spilledValues->next();
   }
+  return false;
+}
 
-  return {inputRange.upstreamState(), {}, skipped, {}};
+void DistinctCollectExecutor::consumeSpilledValue() {
+  TRI_ASSERT(_spilledValues->hasMore());
+  _lastSpilledValue.clear();
+  _lastSpilledValue.add(_spilledValues->current());
+  _spilledValues->next();
 }
 
 size_t DistinctCollectExecutor::memoryUsageForGroup(
@@ -31,25 +31,29 @@
 #include "Aql/AqlValue.h"
 #include "Aql/AqlValueGroup.h"
 #include "Aql/ExecutionState.h"
+#include "Aql/InputAqlItemRow.h"
 #include "Aql/RegisterInfos.h"
 #include "Aql/types.h"
 
 #include "Containers/FlatHashSet.h"
 
+#include <velocypack/Builder.h>
+
 #include <memory>
 #include <unordered_set>
 
 namespace arangodb {
 struct ResourceMonitor;
+class TemporaryStorageFeature;
 
 namespace transaction {
 class Methods;
 }
 namespace aql {
 
-class InputAqlItemRow;
+class DistinctValuesStorageBackend;
 class OutputAqlItemRow;
-class NoStats;
+class SpillStats;
 class RegisterInfos;
 template<BlockPassthrough>
 class SingleRowFetcher;
@@ -58,7 +62,10 @@ class DistinctCollectExecutorInfos {
  public:
   DistinctCollectExecutorInfos(std::pair<RegisterId, RegisterId> groupRegister,
                                velocypack::Options const* opts,
-                               arangodb::ResourceMonitor& resourceMonitor);
+                               arangodb::ResourceMonitor& resourceMonitor,
+                               TemporaryStorageFeature& tempStorage,
+                               size_t spillOverThresholdNumRows,
+                               size_t spillOverThresholdMemoryUsage);
 
   DistinctCollectExecutorInfos() = delete;
   DistinctCollectExecutorInfos(DistinctCollectExecutorInfos&&) = default;
@@ -70,6 +77,10 @@ class DistinctCollectExecutorInfos {
       const;
   velocypack::Options const* vpackOptions() const;
   arangodb::ResourceMonitor& getResourceMonitor() const;
+  [[nodiscard]] TemporaryStorageFeature& getTemporaryStorageFeature()
+      const noexcept;
+  [[nodiscard]] size_t spillOverThresholdNumRows() const noexcept;
+  [[nodiscard]] size_t spillOverThresholdMemoryUsage() const noexcept;
 
  private:
   /// @brief pairs, consisting of out register and in register
@@ -79,6 +90,16 @@ class DistinctCollectExecutorInfos {
   velocypack::Options const* _vpackOptions;
 
   arangodb::ResourceMonitor& _resourceMonitor;
+
+  TemporaryStorageFeature& _tempStorage;
+
+  /// @brief number of distinct values kept in memory after which new
+  /// distinct values are spilled to disk
+  size_t _spillOverThresholdNumRows;
+
+  /// @brief memory usage of distinct values kept in memory after which new
+  /// distinct values are spilled to disk
+  size_t _spillOverThresholdMemoryUsage;
 };
 
 /**
@@ -95,7 +116,7 @@ class DistinctCollectExecutor {
   };
   using Fetcher = SingleRowFetcher<Properties::allowsBlockPassthrough>;
   using Infos = DistinctCollectExecutorInfos;
-  using Stats = NoStats;
+  using Stats = SpillStats;
 
   DistinctCollectExecutor() = delete;
   DistinctCollectExecutor(DistinctCollectExecutor&&) = default;
@@ -128,10 +149,43 @@ class DistinctCollectExecutor {
   void destroyValues();
   size_t memoryUsageForGroup(AqlValue const& value) const;
 
+  /// @brief whether or not new distinct values must go to disk
+  bool mustSpill() const noexcept;
+  /// @brief write a value that is not contained in _seen to disk
+  void spillValue(InputAqlItemRow const& input, AqlValue const& value);
+  /// @brief seal the spilled values, so that they can be read back
+  void sealSpilledValues(Stats& stats);
+  /// @brief position the spilled values on the next value that has not
+  /// been returned yet. returns false if there are no more such values
+  bool nextSpilledValue();
+  /// @brief mark the current spilled value as produced and advance
+  void consumeSpilledValue();
+
  private:
   Infos const& _infos;
   containers::FlatHashSet<AqlValue, AqlValueGroupHash, AqlValueGroupEqual>
       _seen;
+
+  /// @brief memory usage of all values in _seen
+  size_t _memoryUsage;
+
+  /// @brief whether or not we are allowed to spill values to disk
+  bool const _canSpill;
+
+  /// @brief whether or not the spilled values have been sealed
+  bool _spilledValuesSealed;
+
+  /// @brief distinct values that were spilled to disk. these values
+  /// are not contained in _seen, but may contain duplicates
+  std::unique_ptr<DistinctValuesStorageBackend> _spilledValues;
+
+  /// @brief last input row for which a value was spilled. used as the
+  /// source row for all other registers when producing spilled values
+  InputAqlItemRow _lastSpilledRow;
+
+  /// @brief last spilled value that was produced or skipped, used to
+  /// filter out duplicates
+  velocypack::Builder _lastSpilledValue;
 };
 
 }  // namespace aql
@@ -0,0 +1,60 @@
+////////////////////////////////////////////////////////////////////////////////
+/// DISCLAIMER
+///
+/// Copyright 2014-2023 ArangoDB GmbH, Cologne, Germany
+/// Copyright 2004-2014 triAGENS GmbH, Cologne, Germany
+///
+/// Licensed under the Apache License, Version 2.0 (the "License");
+/// you may not use this file except in compliance with the License.
+/// You may obtain a copy of the License at
+///
+///     http://www.apache.org/licenses/LICENSE-2.0
+///
+/// Unless required by applicable law or agreed to in writing, software
+/// distributed under the License is distributed on an "AS IS" BASIS,
+/// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+/// See the License for the specific language governing permissions and
+/// limitations under the License.
+///
+/// Copyright holder is ArangoDB GmbH, Cologne, Germany
+///
+/// @author Jan Steemann
+////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+namespace arangodb::velocypack {
+class Slice;
+}
+
+namespace arangodb::aql {
+
+// storage backend for DISTINCT values that did not fit into memory.
+// values can be added in arbitrary order and with duplicates. after
+// seal() has been called, the values are returned in sorted order, so
+// that duplicates are adjacent and can be filtered out by the caller.
+class DistinctValuesStorageBackend {
+ public:
+  virtual ~DistinctValuesStorageBackend() = default;
+
+  // add a value to the storage backend. must not be called after seal()
+  virtual void addValue(velocypack::Slice value) = 0;
+
+  // seal the storage backend. after that, no more values
+  // must be added
+  virtual void seal() = 0;
+
+  // whether or not there are more values that the storage
+  // backend can produce. requires seal() to have been
+  // called!
+  virtual bool hasMore() const = 0;
+
+  // return the current value. requires hasMore(). the returned
+  // slice is only valid until the next call to next()
+  virtual velocypack::Slice current() const = 0;
+
+  // advance to the next value. requires hasMore()
+  virtual void next() = 0;
+};
+
+}  // namespace arangodb::aql
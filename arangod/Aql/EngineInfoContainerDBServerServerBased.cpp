@@ -158,6 +158,15 @@ std::vector<bool> EngineInfoContainerDBServerServerBased::buildEngineInfo(
   infoBuilder.add("isModificationQuery",
                   VPackValue(_query.isModificationQuery()));
   infoBuilder.add("isAsyncQuery", VPackValue(_query.isAsyncQuery()));
+  // ask the DB server to execute eligible snippets right away and to send
+  // back their first batch along with the setup response. this saves the
+  // round trip for the first execute call of short-running queries. we only
+  // do this for read-only queries, so that the fast path locking can never
+  // fail with a lock timeout and be retried after a snippet has run
+  if (!_query.isModificationQuery() && !_query.isAsyncQuery() &&
+      _query.trxForOptimization().state()->isReadOnlyTransaction()) {
+    infoBuilder.add("prefetch", VPackValue(true));
+  }
 
   infoBuilder.add(StaticStrings::AttrCoordinatorRebootId,
                   VPackValue(ServerState::instance()->getRebootId().value()));
@@ -648,6 +657,16 @@ Result EngineInfoContainerDBServerServerBased::parseResponse(
     thisServer.emplace_back(resEntry.value.copyString());
   }
 
+  // Remember the first batches of snippets that were executed during
+  // setup. The RemoteExecutors for these snippets will pick them up
+  VPackSlice prefetched = result.get("prefetch");
+  if (prefetched.isObject()) {
+    for (auto const& entry : VPackObjectIterator(prefetched)) {
+      _query.addSetupResult("server:" + server, entry.key.stringView(),
+                            entry.value);
+    }
+  }
+
   // Link traverser engines to their nodes
   VPackSlice travEngines = result.get("traverserEngines");
   if (!travEngines.isNone()) {
@@ -299,7 +299,10 @@ EnumerateCollectionExecutor::produceRows(AqlItemBlockInputRange& inputRange,
         // count optimization
         TRI_ASSERT(!_documentProducingFunctionContext.hasFilter());
         uint64_t counter = 0;
-        _cursor->skipAll(counter);
+        // counting can be split across multiple threads if the cursor
+        // supports it
+        _cursor->skipAllParallel(
+            counter, _infos.getQuery().queryOptions().parallelism);
 
         InputAqlItemRow const& input =
             _documentProducingFunctionContext.getInputRow();
@@ -30,8 +30,12 @@
 #include "Graph/Providers/ClusterProvider.h"
 #include "Graph/Providers/SingleServerProvider.h"
 #include "Graph/Queues/FifoQueue.h"
+#include "Graph/ShortestPathOptions.h"
 #include "Graph/Steps/SingleServerProviderStep.h"
+#include "Scheduler/Scheduler.h"
+#include "Scheduler/SchedulerFeature.h"
 #include "Transaction/Helpers.h"
+#include "Utils/ExecContext.h"
 
 #include "Graph/algorithm-aliases.h"
 
@@ -58,9 +62,10 @@ template<class FinderType>
 EnumeratePathsExecutorInfos<FinderType>::EnumeratePathsExecutorInfos(
     RegisterId outputRegister, QueryContext& query,
     std::unique_ptr<FinderType>&& finder, InputVertex&& source,
-    InputVertex&& target)
+    InputVertex&& target, std::vector<Worker>&& workers)
     : _query(query),
       _finder(std::move(finder)),
+      _workers(std::move(workers)),
       _source(std::move(source)),
       _target(std::move(target)),
       _outputRegister(outputRegister) {}
@@ -71,6 +76,12 @@ FinderType& EnumeratePathsExecutorInfos<FinderType>::finder() const {
   return *_finder.get();
 }
 
+template<class FinderType>
+auto EnumeratePathsExecutorInfos<FinderType>::workers() const noexcept
+    -> std::vector<Worker> const& {
+  return _workers;
+}
+
 template<class FinderType>
 QueryContext& EnumeratePathsExecutorInfos<FinderType>::query() noexcept {
   return _query;
@@ -135,6 +146,94 @@ auto EnumeratePathsExecutorInfos<FinderType>::getTargetVertex() const noexcept
   return _target;
 }
 
+template<class FinderType>
+EnumeratePathsExecutor<FinderType>::Slot::Slot(
+    FinderType& finder, ResourceMonitor& resourceMonitor)
+    : finder(finder), memoryUsage(resourceMonitor) {}
+
+template<class FinderType>
+bool EnumeratePathsExecutor<FinderType>::Slot::tryClaim() noexcept {
+  auto expected = State::Pending;
+  return _state.load(std::memory_order_relaxed) == expected &&
+         _state.compare_exchange_strong(expected, State::InProgress,
+                                        std::memory_order_relaxed);
+}
+
+template<class FinderType>
+void EnumeratePathsExecutor<FinderType>::Slot::reset() noexcept {
+  clearBufferedPaths();
+  error = nullptr;
+  _state.store(State::Pending);
+}
+
+template<class FinderType>
+void EnumeratePathsExecutor<FinderType>::Slot::execute() noexcept {
+  TRI_ASSERT(_state.load() == State::InProgress);
+  TRI_ASSERT(!hasBufferedPaths());
+  try {
+    paths.openArray();
+    size_t produced = 0;
+    while (produced < kPathsPerTask && finder.getNextPath(paths)) {
+      ++produced;
+    }
+    paths.close();
+    memoryUsage.increase(paths.size());
+  } catch (...) {
+    clearBufferedPaths();
+    error = std::current_exception();
+  }
+
+  // (1) - this release-store synchronizes with the acquire-load (2, 3)
+  _state.store(State::Finished, std::memory_order_release);
+
+  // need to temporarily lock the mutex to enforce serialization with the
+  // waiting thread
+  _lock.lock();
+  _lock.unlock();
+
+  _bell.notify_one();
+}
+
+template<class FinderType>
+void EnumeratePathsExecutor<FinderType>::Slot::waitFor() noexcept {
+  // (2) - this acquire-load synchronizes with the release-store (1)
+  if (_state.load(std::memory_order_acquire) == State::Finished) {
+    return;
+  }
+  std::unique_lock<std::mutex> guard(_lock);
+  _bell.wait(guard, [this]() {
+    // (3) - this acquire-load synchronizes with the release-store (1)
+    return _state.load(std::memory_order_acquire) == State::Finished;
+  });
+}
+
+template<class FinderType>
+auto EnumeratePathsExecutor<FinderType>::Slot::numBufferedPaths() const
+    -> size_t {
+  if (paths.isEmpty()) {
+    return 0;
+  }
+  return paths.slice().length();
+}
+
+template<class FinderType>
+auto EnumeratePathsExecutor<FinderType>::Slot::hasBufferedPaths() const
+    -> bool {
+  return position < numBufferedPaths();
+}
+
+template<class FinderType>
+auto EnumeratePathsExecutor<FinderType>::Slot::isExhausted() const -> bool {
+  return !hasBufferedPaths() && finder.isDone();
+}
+
+template<class FinderType>
+void EnumeratePathsExecutor<FinderType>::Slot::clearBufferedPaths() noexcept {
+  paths.clear();
+  position = 0;
+  memoryUsage.revert();
+}
+
 template<class FinderType>
 EnumeratePathsExecutor<FinderType>::EnumeratePathsExecutor(Fetcher& fetcher,
                                                            Infos& infos)
@@ -144,7 +243,9 @@ EnumeratePathsExecutor<FinderType>::EnumeratePathsExecutor(Fetcher& fetcher,
       _rowState(ExecutionState::HASMORE),
       _finder{infos.finder()},
       _sourceBuilder{},
-      _targetBuilder{} {
+      _targetBuilder{},
+      _numActiveSlots(0),
+      _currentSlot(0) {
   if (!_infos.useRegisterForSourceInput()) {
     _sourceBuilder.add(VPackValue(_infos.getSourceInputValue()));
   }
@@ -155,6 +256,37 @@ EnumeratePathsExecutor<FinderType>::EnumeratePathsExecutor(Fetcher& fetcher,
   // get any old junk here, because infos are not recreated in between
   // initializeCursor calls.
   _finder.clear();
+
+  if (!_infos.workers().empty()) {
+    auto& resourceMonitor = _infos.query().resourceMonitor();
+    _slots.reserve(_infos.workers().size() + 1);
+    _slots.emplace_back(std::make_shared<Slot>(_finder, resourceMonitor));
+    for (auto const& worker : _infos.workers()) {
+      TRI_ASSERT(worker.finder != nullptr);
+      worker.finder->clear();
+      _slots.emplace_back(
+          std::make_shared<Slot>(*worker.finder, resourceMonitor));
+    }
+    for (auto& slot : _slots) {
+      if (!_infos.useRegisterForSourceInput()) {
+        slot->sourceBuilder.add(VPackValue(_infos.getSourceInputValue()));
+      }
+      if (!_infos.useRegisterForTargetInput()) {
+        slot->targetBuilder.add(VPackValue(_infos.getTargetInputValue()));
+      }
+    }
+  }
+}
+
+template<class FinderType>
+EnumeratePathsExecutor<FinderType>::~EnumeratePathsExecutor() {
+  // tasks that are still queued on the scheduler can keep the slots alive
+  // for longer than the query, so release everything that refers to the
+  // query right now
+  for (auto& slot : _slots) {
+    slot->clearBufferedPaths();
+    slot->inputRow = InputAqlItemRow{CreateInvalidInputRowHint{}};
+  }
 }
 
 // Shutdown query
@@ -162,6 +294,9 @@ template<class FinderType>
 auto EnumeratePathsExecutor<FinderType>::shutdown(int errorCode)
     -> std::pair<ExecutionState, Result> {
   _finder.destroyEngines();
+  for (auto const& worker : _infos.workers()) {
+    worker.finder->destroyEngines();
+  }
   return {ExecutionState::DONE, TRI_ERROR_NO_ERROR};
 }
 
@@ -169,6 +304,35 @@ template<class FinderType>
 auto EnumeratePathsExecutor<FinderType>::produceRows(
     AqlItemBlockInputRange& input, OutputAqlItemRow& output)
     -> std::tuple<ExecutorState, Stats, AqlCall> {
+  if (!_slots.empty()) {
+    while (!output.isFull()) {
+      if (!advanceSlot()) {
+        if (!fetchSlots(input)) {
+          TRI_ASSERT(!input.hasDataRow());
+          return {input.upstreamState(), stats(), AqlCall{}};
+        }
+        continue;
+      }
+
+      Slot& slot = *_slots[_currentSlot];
+      if (!slot.hasBufferedPaths()) {
+        executeSlots();
+        continue;
+      }
+
+      AqlValue path{slot.paths.slice().at(slot.position)};
+      AqlValueGuard guard{path, true};
+      ++slot.position;
+      output.moveValueInto(_infos.getOutputRegister(), slot.inputRow, guard);
+      output.advanceRow();
+    }
+
+    if (advanceSlot()) {
+      return {ExecutorState::HASMORE, stats(), AqlCall{}};
+    }
+    return {input.upstreamState(), stats(), AqlCall{}};
+  }
+
   while (!output.isFull()) {
     if (_finder.isDone()) {
       if (!fetchPaths(input)) {
@@ -193,6 +357,35 @@ auto EnumeratePathsExecutor<FinderType>::skipRowsRange(
     -> std::tuple<ExecutorState, Stats, size_t, AqlCall> {
   auto skipped = size_t{0};
 
+  if (!_slots.empty()) {
+    while (call.shouldSkip()) {
+      if (!advanceSlot()) {
+        if (!fetchSlots(input)) {
+          TRI_ASSERT(!input.hasDataRow());
+          return {input.upstreamState(), stats(), skipped, AqlCall{}};
+        }
+        continue;
+      }
+
+      Slot& slot = *_slots[_currentSlot];
+      if (slot.hasBufferedPaths()) {
+        ++slot.position;
+        skipped++;
+        call.didSkip(1);
+      } else if (slot.finder.skipPath()) {
+        // skipping does not need to build the paths, so we can do it
+        // without the help of other threads
+        skipped++;
+        call.didSkip(1);
+      }
+    }
+
+    if (advanceSlot()) {
+      return {ExecutorState::HASMORE, stats(), skipped, AqlCall{}};
+    }
+    return {input.upstreamState(), stats(), skipped, AqlCall{}};
+  }
+
   while (call.shouldSkip()) {
     // _finder.isDone() == true means that there is currently no path available
     // from the _finder, we can try calling fetchPaths to make one available,
@@ -241,6 +434,112 @@ auto EnumeratePathsExecutor<FinderType>::fetchPaths(
   return false;
 }
 
+template<class FinderType>
+auto EnumeratePathsExecutor<FinderType>::fetchSlots(
+    AqlItemBlockInputRange& input) -> bool {
+  TRI_ASSERT(!_slots.empty());
+  for (size_t i = 0; i < _numActiveSlots; ++i) {
+    _slots[i]->clearBufferedPaths();
+    _slots[i]->inputRow = InputAqlItemRow{CreateInvalidInputRowHint{}};
+  }
+  _numActiveSlots = 0;
+  _currentSlot = 0;
+
+  while (_numActiveSlots < _slots.size() && input.hasDataRow()) {
+    Slot& slot = *_slots[_numActiveSlots];
+    auto source = VPackSlice{};
+    auto target = VPackSlice{};
+    std::tie(std::ignore, slot.inputRow) = input.nextDataRow();
+    TRI_ASSERT(slot.inputRow.isInitialized());
+
+    // Check start and end for validity
+    if (getVertexId(_infos.getSourceVertex(), slot.inputRow,
+                    slot.sourceBuilder, source) &&
+        getVertexId(_infos.getTargetVertex(), slot.inputRow,
+                    slot.targetBuilder, target)) {
+      slot.finder.clear();
+      slot.finder.reset(arangodb::velocypack::HashedStringRef(source),
+                        arangodb::velocypack::HashedStringRef(target));
+      ++_numActiveSlots;
+    }
+  }
+
+  if (_numActiveSlots == 0) {
+    return false;
+  }
+  executeSlots();
+  return true;
+}
+
+template<class FinderType>
+auto EnumeratePathsExecutor<FinderType>::executeSlots() -> void {
+  std::vector<std::shared_ptr<Slot>> pending;
+  for (size_t i = _currentSlot; i < _numActiveSlots; ++i) {
+    auto& slot = _slots[i];
+    if (!slot->hasBufferedPaths() && !slot->finder.isDone()) {
+      slot->reset();
+      pending.emplace_back(slot);
+    }
+  }
+  if (pending.empty()) {
+    return;
+  }
+
+  // the first slot is always executed by this thread, so there is no need
+  // to queue it. without a scheduler, all slots are executed by this thread
+  Scheduler* scheduler = SchedulerFeature::SCHEDULER;
+  ExecContext const* execContext = &ExecContext::current();
+  for (size_t i = 1; i < pending.size() && scheduler != nullptr; ++i) {
+    // we can safely ignore the result here, because we will try to
+    // claim the slot ourselves anyway.
+    scheduler->queue(
+        RequestLane::INTERNAL_LOW, [slot = pending[i], execContext]() {
+          if (!slot->tryClaim()) {
+            return;
+          }
+          // slot is a copy of the Slot shared_ptr, and we will only access
+          // the finder if we successfully claimed the slot. the executor
+          // waits for all claimed slots to finish, so it does not matter if
+          // this task lingers around in the scheduler queue after the
+          // executor has been destroyed.
+          ExecContextScope scope(execContext);
+          slot->execute();
+        });
+  }
+
+  // execute all slots that have not been picked up by other threads yet.
+  // this guarantees progress even if all scheduler threads are busy
+  for (auto& slot : pending) {
+    if (slot->tryClaim()) {
+      slot->execute();
+    }
+  }
+
+  std::exception_ptr error;
+  for (auto& slot : pending) {
+    slot->waitFor();
+    if (slot->error != nullptr && error == nullptr) {
+      error = slot->error;
+    }
+  }
+  if (error != nullptr) {
+    std::rethrow_exception(error);
+  }
+}
+
+template<class FinderType>
+auto EnumeratePathsExecutor<FinderType>::advanceSlot() -> bool {
+  while (_currentSlot < _numActiveSlots) {
+    Slot& slot = *_slots[_currentSlot];
+    if (!slot.isExhausted()) {
+      return true;
+    }
+    slot.clearBufferedPaths();
+    ++_currentSlot;
+  }
+  return false;
+}
+
 template<class FinderType>
 auto EnumeratePathsExecutor<FinderType>::doOutputPath(OutputAqlItemRow& output)
     -> void {
@@ -320,7 +619,11 @@ auto EnumeratePathsExecutor<FinderType>::getVertexId(InputVertex const& vertex,
 
 template<class FinderType>
 [[nodiscard]] auto EnumeratePathsExecutor<FinderType>::stats() -> Stats {
-  return _finder.stealStats();
+  auto stats = _finder.stealStats();
+  for (auto const& worker : _infos.workers()) {
+    stats += worker.finder->stealStats();
+  }
+  return stats;
 }
 
 /* SingleServerProvider Section */
@@ -29,14 +29,26 @@
 #include "Aql/GraphNode.h"
 #include "Aql/InputAqlItemRow.h"
 #include "Aql/RegisterInfos.h"
+#include "Basics/ResourceUsage.h"
 #include "Transaction/Methods.h"
 
 #include <velocypack/Builder.h>
 
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <vector>
+
 namespace arangodb {
 
 class Result;
 
+namespace graph {
+struct ShortestPathOptions;
+}
+
 namespace velocypack {
 class Slice;
 }
@@ -54,9 +66,19 @@ class EnumeratePathsExecutorInfos {
   using InputVertex = GraphNode::InputVertex;
 
  public:
+  /// @brief an additional path finder, used to enumerate the paths of
+  /// multiple input rows concurrently. the finder's providers refer to the
+  /// (cloned) options, so that every finder has its own transaction and
+  /// expression context
+  struct Worker {
+    std::unique_ptr<graph::ShortestPathOptions> options;
+    std::unique_ptr<FinderType> finder;
+  };
+
   EnumeratePathsExecutorInfos(RegisterId outputRegister, QueryContext& query,
                               std::unique_ptr<FinderType>&& finder,
-                              InputVertex&& source, InputVertex&& target);
+                              InputVertex&& source, InputVertex&& target,
+                              std::vector<Worker>&& workers = {});
 
   EnumeratePathsExecutorInfos() = delete;
 
@@ -66,6 +88,10 @@ class EnumeratePathsExecutorInfos {
 
   [[nodiscard]] auto finder() const -> FinderType&;
 
+  /// @brief additional finders for concurrent path enumeration. empty if
+  /// the paths are enumerated by a single thread
+  [[nodiscard]] auto workers() const noexcept -> std::vector<Worker> const&;
+
   aql::QueryContext& query() noexcept;
 
   /**
@@ -106,6 +132,9 @@ class EnumeratePathsExecutorInfos {
   /// @brief the shortest path finder.
   std::unique_ptr<FinderType> _finder;
 
+  /// @brief additional path finders, used by other threads
+  std::vector<Worker> _workers;
+
   /// @brief Information about the source vertex
   InputVertex _source;
 
@@ -137,7 +166,7 @@ class EnumeratePathsExecutor {
   EnumeratePathsExecutor(EnumeratePathsExecutor&&) = default;
 
   EnumeratePathsExecutor(Fetcher& fetcher, Infos&);
-  ~EnumeratePathsExecutor() = default;
+  ~EnumeratePathsExecutor();
 
   /**
    * @brief Shutdown will be called once for every query
@@ -159,6 +188,50 @@ class EnumeratePathsExecutor {
       -> std::tuple<ExecutorState, Stats, size_t, AqlCall>;
 
  private:
+  /// @brief maximum number of paths a worker enumerates for an input row
+  /// in one go. the paths are buffered until they are consumed, so this
+  /// bounds the memory usage in case only a few paths are needed
+  static constexpr size_t kPathsPerTask = 1000;
+
+  /// @brief the path enumeration for one input row in parallel mode. every
+  /// slot is driven by its own finder. the enumeration is claimable, so
+  /// that the executor can run it itself if no scheduler thread has picked
+  /// it up yet
+  struct Slot {
+    enum class State { Pending, InProgress, Finished };
+
+    Slot(FinderType& finder, ResourceMonitor& resourceMonitor);
+
+    void reset() noexcept;
+    bool tryClaim() noexcept;
+    void execute() noexcept;
+    void waitFor() noexcept;
+
+    [[nodiscard]] auto numBufferedPaths() const -> size_t;
+    [[nodiscard]] auto hasBufferedPaths() const -> bool;
+    [[nodiscard]] auto isExhausted() const -> bool;
+    void clearBufferedPaths() noexcept;
+
+    FinderType& finder;
+    InputAqlItemRow inputRow{CreateInvalidInputRowHint{}};
+    /// @brief temporary memory management for source and target ids. must
+    /// be kept alive while the finder is in use
+    arangodb::velocypack::Builder sourceBuilder;
+    arangodb::velocypack::Builder targetBuilder;
+    /// @brief paths produced by the last execution, as an array
+    arangodb::velocypack::Builder paths;
+    /// @brief number of paths from the array that were already consumed
+    size_t position = 0;
+    /// @brief exception raised by the last execution, if any
+    std::exception_ptr error;
+    ResourceUsageScope memoryUsage;
+
+   private:
+    std::atomic<State> _state{State::Finished};
+    std::mutex _lock;
+    std::condition_variable _bell;
+  };
+
   /**
    * @brief Fetch input row(s) and compute path
    *
@@ -167,6 +240,27 @@ class EnumeratePathsExecutor {
   [[nodiscard]] auto fetchPaths(AqlItemBlockInputRange& input) -> bool;
   auto doOutputPath(OutputAqlItemRow& output) -> void;
 
+  /**
+   * @brief Fetch as many valid input rows as there are slots and start the
+   * path enumeration for them
+   *
+   * @return false if there are no more valid input rows.
+   */
+  [[nodiscard]] auto fetchSlots(AqlItemBlockInputRange& input) -> bool;
+
+  /**
+   * @brief Enumerate the next batch of paths for all active slots that have
+   * consumed their buffered paths, using scheduler threads
+   */
+  auto executeSlots() -> void;
+
+  /**
+   * @brief Move on to the next active slot that can still produce paths
+   *
+   * @return false if all active slots are exhausted.
+   */
+  [[nodiscard]] auto advanceSlot() -> bool;
+
   /**
    * @brief get the id of an input vertex
    */
@@ -188,6 +282,15 @@ class EnumeratePathsExecutor {
   arangodb::velocypack::Builder _sourceBuilder;
   /// @brief temporary memory mangement for target id
   arangodb::velocypack::Builder _targetBuilder;
+
+  /// @brief slots for parallel path enumeration, one per finder. empty if
+  /// the paths are enumerated by a single thread. the slots are shared with
+  /// the tasks queued on the scheduler, which may outlive the executor
+  std::vector<std::shared_ptr<Slot>> _slots;
+  /// @brief number of slots in use for the current input rows
+  size_t _numActiveSlots;
+  /// @brief the slot whose paths are produced next
+  size_t _currentSlot;
 };
 }  // namespace aql
 }  // namespace arangodb
@@ -43,12 +43,15 @@
 #include "Graph/ShortestPathOptions.h"
 #include "Indexes/Index.h"
 #include "OptimizerUtils.h"
+#include "RestServer/QueryRegistryFeature.h"
 #include "Utils/CollectionNameResolver.h"
+#include "VocBase/vocbase.h"
 
 #include "Graph/algorithm-aliases.h"
 
 #include <velocypack/Iterator.h>
 
+#include <algorithm>
 #include <memory>
 
 using namespace arangodb;
@@ -338,7 +341,38 @@ std::unique_ptr<ExecutionBlock> EnumeratePathsNode::_makeExecutionBlockImpl(
     arangodb::graph::TwoSidedEnumeratorOptions enumeratorOptions,
     PathValidatorOptions validatorOptions, const RegisterId& outputRegister,
     ExecutionEngine& engine, InputVertex sourceInput, InputVertex targetInput,
-    RegisterInfos registerInfos) const {
+    RegisterInfos registerInfos,
+    std::function<ProviderOptions(ShortestPathOptions&, bool)>
+        makeWorkerProviderOptions) const {
+  // additional finders, so that the paths for multiple input rows can be
+  // enumerated by multiple threads. every finder gets its own copy of the
+  // options, so that it has its own transaction and expression context
+  std::vector<typename EnumeratePathsExecutorInfos<KPath>::Worker> workers;
+  if (makeWorkerProviderOptions != nullptr && opts->parallelism() > 1 &&
+      opts->query().isAsyncQuery()) {
+    auto const& feature =
+        opts->query().vocbase().server().getFeature<QueryRegistryFeature>();
+    size_t parallelism = std::min<size_t>(opts->parallelism(),
+                                          feature.maxParallelism());
+    workers.reserve(parallelism - 1);
+    for (size_t i = 1; i < parallelism; ++i) {
+      auto workerOptions = std::make_unique<ShortestPathOptions>(
+          *opts, /*allowAlreadyBuiltCopy*/ true);
+      auto finder = std::make_unique<KPath>(
+          Provider{opts->query(), makeWorkerProviderOptions(*workerOptions,
+                                                            false),
+                   opts->query().resourceMonitor()},
+          Provider{opts->query(), makeWorkerProviderOptions(*workerOptions,
+                                                            true),
+                   opts->query().resourceMonitor()},
+          arangodb::graph::TwoSidedEnumeratorOptions{enumeratorOptions},
+          PathValidatorOptions{opts->tmpVar(),
+                               workerOptions->getExpressionCtx()},
+          opts->query().resourceMonitor());
+      workers.push_back({std::move(workerOptions), std::move(finder)});
+    }
+  }
+
   auto kPathUnique = std::make_unique<KPath>(
       Provider{opts->query(), std::move(forwardProviderOptions),
                opts->query().resourceMonitor()},
@@ -349,7 +383,7 @@ std::unique_ptr<ExecutionBlock> EnumeratePathsNode::_makeExecutionBlockImpl(
 
   auto executorInfos = EnumeratePathsExecutorInfos(
       outputRegister, engine.getQuery(), std::move(kPathUnique),
-      std::move(sourceInput), std::move(targetInput));
+      std::move(sourceInput), std::move(targetInput), std::move(workers));
 
   return std::make_unique<ExecutionBlockImpl<EnumeratePathsExecutor<KPath>>>(
       &engine, this, std::move(registerInfos), std::move(executorInfos));
@@ -390,30 +424,54 @@ std::unique_ptr<ExecutionBlock> EnumeratePathsNode::createBlock(
 
   if (!ServerState::instance()->isCoordinator()) {
     // Create IndexAccessor for BaseProviderOptions (TODO: Location need to
-    // be changed in the future) create BaseProviderOptions
-
-    std::pair<std::vector<IndexAccessor>,
-              std::unordered_map<uint64_t, std::vector<IndexAccessor>>>
-        usedIndexes{};
-    usedIndexes.first = buildUsedIndexes();
-
-    std::pair<std::vector<IndexAccessor>,
-              std::unordered_map<uint64_t, std::vector<IndexAccessor>>>
-        reversedUsedIndexes{};
-    reversedUsedIndexes.first = buildReverseUsedIndexes();
-
-    // TODO [GraphRefactor]: Clean this up (de-duplicate with
-    // SmartGraphEngine)
-    SingleServerBaseProviderOptions forwardProviderOptions(
-        opts->tmpVar(), std::move(usedIndexes), opts->getExpressionCtx(), {},
-        opts->collectionToShard(), opts->getVertexProjections(),
-        opts->getEdgeProjections(), opts->produceVertices());
-
-    SingleServerBaseProviderOptions backwardProviderOptions(
-        opts->tmpVar(), std::move(reversedUsedIndexes),
-        opts->getExpressionCtx(), {}, opts->collectionToShard(),
-        opts->getVertexProjections(), opts->getEdgeProjections(),
-        opts->produceVertices());
+    // be changed in the future) create BaseProviderOptions.
+    // this is also used to create the provider options for additional
+    // finders in case the paths are enumerated by multiple threads. every
+    // call builds its own index conditions, and the expression context is
+    // taken from the options passed in
+    auto makeProviderOptions =
+        [&](ShortestPathOptions& options,
+            bool backward) -> SingleServerBaseProviderOptions {
+      std::pair<std::vector<IndexAccessor>,
+                std::unordered_map<uint64_t, std::vector<IndexAccessor>>>
+          usedIndexes{};
+      usedIndexes.first =
+          backward ? buildReverseUsedIndexes() : buildUsedIndexes();
+
+      // TODO [GraphRefactor]: Clean this up (de-duplicate with
+      // SmartGraphEngine)
+      SingleServerBaseProviderOptions providerOptions(
+          opts->tmpVar(), std::move(usedIndexes), options.getExpressionCtx(),
+          {}, options.collectionToShard(), options.getVertexProjections(),
+          options.getEdgeProjections(), options.produceVertices());
+
+      if (pathType() == arangodb::graph::PathType::Type::KShortestPaths &&
+          options.useWeight()) {
+        double defaultWeight = options.getDefaultWeight();
+        std::string weightAttribute = options.getWeightAttribute();
+        providerOptions.setWeightEdgeCallback(
+            [weightAttribute = std::move(weightAttribute), defaultWeight](
+                double previousWeight, VPackSlice edge) -> double {
+              auto const weight =
+                  arangodb::basics::VelocyPackHelper::getNumericValue<double>(
+                      edge, weightAttribute, defaultWeight);
+              if (weight < 0.) {
+                THROW_ARANGO_EXCEPTION(TRI_ERROR_GRAPH_NEGATIVE_EDGE_WEIGHT);
+              }
+
+              return previousWeight + weight;
+            });
+        if (auto heuristic = options.heuristic(backward)) {
+          providerOptions.setHeuristic(std::move(*heuristic));
+        }
+      }
+      return providerOptions;
+    };
+
+    SingleServerBaseProviderOptions forwardProviderOptions =
+        makeProviderOptions(*opts, false);
+    SingleServerBaseProviderOptions backwardProviderOptions =
+        makeProviderOptions(*opts, true);
 
     using Provider = SingleServerProvider<SingleServerProviderStep>;
     if (opts->query().queryOptions().getTraversalProfileLevel() ==
@@ -425,7 +483,7 @@ std::unique_ptr<ExecutionBlock> EnumeratePathsNode::createBlock(
               opts, std::move(forwardProviderOptions),
               std::move(backwardProviderOptions), enumeratorOptions,
               validatorOptions, outputRegister, engine, sourceInput,
-              targetInput, registerInfos);
+              targetInput, registerInfos, makeProviderOptions);
         case arangodb::graph::PathType::Type::AllShortestPaths:
           return _makeExecutionBlockImpl<AllShortestPathsEnumerator<Provider>,
                                          Provider,
@@ -433,7 +491,7 @@ std::unique_ptr<ExecutionBlock> EnumeratePathsNode::createBlock(
               opts, std::move(forwardProviderOptions),
               std::move(backwardProviderOptions), enumeratorOptions,
               validatorOptions, outputRegister, engine, sourceInput,
-              targetInput, registerInfos);
+              targetInput, registerInfos, makeProviderOptions);
         case arangodb::graph::PathType::Type::KShortestPaths:
           enumeratorOptions.setMinDepth(0);
           enumeratorOptions.setMaxDepth(std::numeric_limits<size_t>::max());
@@ -446,45 +504,17 @@ std::unique_ptr<ExecutionBlock> EnumeratePathsNode::createBlock(
                 opts, std::move(forwardProviderOptions),
                 std::move(backwardProviderOptions), enumeratorOptions,
                 validatorOptions, outputRegister, engine, sourceInput,
-                targetInput, registerInfos);
+                targetInput, registerInfos, makeProviderOptions);
           } else {
-            // Weighted Variant
-            double defaultWeight = opts->getDefaultWeight();
-            std::string weightAttribute = opts->getWeightAttribute();
-            forwardProviderOptions.setWeightEdgeCallback(
-                [weightAttribute = weightAttribute, defaultWeight](
-                    double previousWeight, VPackSlice edge) -> double {
-                  auto const weight =
-                      arangodb::basics::VelocyPackHelper::getNumericValue<
-                          double>(edge, weightAttribute, defaultWeight);
-                  if (weight < 0.) {
-                    THROW_ARANGO_EXCEPTION(
-                        TRI_ERROR_GRAPH_NEGATIVE_EDGE_WEIGHT);
-                  }
-
-                  return previousWeight + weight;
-                });
-            backwardProviderOptions.setWeightEdgeCallback(
-                [weightAttribute = weightAttribute, defaultWeight](
-                    double previousWeight, VPackSlice edge) -> double {
-                  auto const weight =
-                      arangodb::basics::VelocyPackHelper::getNumericValue<
-                          double>(edge, weightAttribute, defaultWeight);
-                  if (weight < 0.) {
-                    THROW_ARANGO_EXCEPTION(
-                        TRI_ERROR_GRAPH_NEGATIVE_EDGE_WEIGHT);
-                  }
-
-                  return previousWeight + weight;
-                });
-
+            // Weighted Variant. the weight callbacks and the heuristics
+            // are set up by makeProviderOptions
             return _makeExecutionBlockImpl<
                 WeightedKShortestPathsEnumerator<Provider>, Provider,
                 SingleServerBaseProviderOptions>(
                 opts, std::move(forwardProviderOptions),
                 std::move(backwardProviderOptions), enumeratorOptions,
                 validatorOptions, outputRegister, engine, sourceInput,
-                targetInput, registerInfos);
+                targetInput, registerInfos, makeProviderOptions);
           }
 
         default:
@@ -501,7 +531,7 @@ std::unique_ptr<ExecutionBlock> EnumeratePathsNode::createBlock(
               opts, std::move(forwardProviderOptions),
               std::move(backwardProviderOptions), enumeratorOptions,
               validatorOptions, outputRegister, engine, sourceInput,
-              targetInput, registerInfos);
+              targetInput, registerInfos, makeProviderOptions);
         case arangodb::graph::PathType::Type::AllShortestPaths:
           return _makeExecutionBlockImpl<
               TracedAllShortestPathsEnumerator<Provider>,
@@ -509,7 +539,7 @@ std::unique_ptr<ExecutionBlock> EnumeratePathsNode::createBlock(
               opts, std::move(forwardProviderOptions),
               std::move(backwardProviderOptions), enumeratorOptions,
               validatorOptions, outputRegister, engine, sourceInput,
-              targetInput, registerInfos);
+              targetInput, registerInfos, makeProviderOptions);
         case arangodb::graph::PathType::Type::KShortestPaths:
           // TODO: deduplicate with non-traced variant. Too much code
           //  duplication right now.
@@ -524,45 +554,17 @@ std::unique_ptr<ExecutionBlock> EnumeratePathsNode::createBlock(
                 opts, std::move(forwardProviderOptions),
                 std::move(backwardProviderOptions), enumeratorOptions,
                 validatorOptions, outputRegister, engine, sourceInput,
-                targetInput, registerInfos);
+                targetInput, registerInfos, makeProviderOptions);
           } else {
-            // Weighted Variant
-            double defaultWeight = opts->getDefaultWeight();
-            std::string weightAttribute = opts->getWeightAttribute();
-            forwardProviderOptions.setWeightEdgeCallback(
-                [weightAttribute = weightAttribute, defaultWeight](
-                    double previousWeight, VPackSlice edge) -> double {
-                  auto const weight =
-                      arangodb::basics::VelocyPackHelper::getNumericValue<
-                          double>(edge, weightAttribute, defaultWeight);
-                  if (weight < 0.) {
-                    THROW_ARANGO_EXCEPTION(
-                        TRI_ERROR_GRAPH_NEGATIVE_EDGE_WEIGHT);
-                  }
-
-                  return previousWeight + weight;
-                });
-            backwardProviderOptions.setWeightEdgeCallback(
-                [weightAttribute = weightAttribute, defaultWeight](
-                    double previousWeight, VPackSlice edge) -> double {
-                  auto const weight =
-                      arangodb::basics::VelocyPackHelper::getNumericValue<
-                          double>(edge, weightAttribute, defaultWeight);
-                  if (weight < 0.) {
-                    THROW_ARANGO_EXCEPTION(
-                        TRI_ERROR_GRAPH_NEGATIVE_EDGE_WEIGHT);
-                  }
-
-                  return previousWeight + weight;
-                });
-
+            // Weighted Variant. the weight callbacks and the heuristics
+            // are set up by makeProviderOptions
             return _makeExecutionBlockImpl<
                 WeightedKShortestPathsEnumerator<Provider>, Provider,
                 SingleServerBaseProviderOptions>(
                 opts, std::move(forwardProviderOptions),
                 std::move(backwardProviderOptions), enumeratorOptions,
                 validatorOptions, outputRegister, engine, sourceInput,
-                targetInput, registerInfos);
+                targetInput, registerInfos, makeProviderOptions);
           }
         default:
           ADB_PROD_ASSERT(false)
@@ -31,6 +31,8 @@
 #include "Graph/Options/TwoSidedEnumeratorOptions.h"
 #include "Graph/PathManagement/PathValidatorOptions.h"
 
+#include <functional>
+
 namespace arangodb {
 
 namespace velocypack {
@@ -207,7 +209,9 @@ class EnumeratePathsNode : public virtual GraphNode {
       arangodb::graph::PathValidatorOptions validatorOptions,
       const RegisterId& outputRegister, ExecutionEngine& engine,
       InputVertex sourceInput, InputVertex targetInput,
-      RegisterInfos registerInfos) const;
+      RegisterInfos registerInfos,
+      std::function<ProviderOptions(graph::ShortestPathOptions&, bool)>
+          makeWorkerProviderOptions = nullptr) const;
 };
 
 }  // namespace aql
@@ -282,6 +282,13 @@ class ExecutionBlockImpl final : public ExecutionBlock {
   [[nodiscard]] auto allocateOutputBlock(AqlCall&& call)
       -> std::unique_ptr<OutputAqlItemRow>;
 
+  // Upper bound for the number of rows in an output block, derived from
+  // the average size of the rows this block has produced so far
+  [[nodiscard]] auto maxRowsPerOutputBlock() const noexcept -> size_t;
+
+  // Record the size of an output block that is handed out
+  void trackProducedBlock(SharedAqlItemBlockPtr const& block) noexcept;
+
   // Ensure that we have an output block of the desired dimensions
   // Will as a side effect modify _outputItemRow
   void ensureOutputBlock(AqlCall&& call);
@@ -480,6 +487,11 @@ class ExecutionBlockImpl final : public ExecutionBlock {
 
   std::shared_ptr<PrefetchTask> _prefetchTask;
 
+  // whether we currently hold one of the query's async prefetch slots for
+  // our prefetch task. the slot is returned as soon as the task result has
+  // been consumed or the task has been claimed by ourselves
+  bool _holdsAsyncPrefetchSlot{false};
+
   std::unique_ptr<CallstackSplit> _callstackSplit;
 
   Result _firstFailure;
@@ -495,6 +507,11 @@ class ExecutionBlockImpl final : public ExecutionBlock {
   bool _executorReturnedDone = false;
 
   bool _initialized = false;
+
+  // number of rows and bytes in the output blocks produced recently.
+  // used to shrink output blocks for wide rows
+  std::uint64_t _producedRows = 0;
+  std::uint64_t _producedBytes = 0;
 };
 
 }  // namespace arangodb::aql
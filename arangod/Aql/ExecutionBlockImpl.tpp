@@ -49,6 +49,7 @@
 #include "Graph/Steps/SingleServerProviderStep.h"
 #include "Graph/algorithm-aliases.h"
 
+#include <algorithm>
 #include <type_traits>
 
 namespace arangodb {
@@ -321,6 +322,9 @@ ExecutionBlockImpl<Executor>::~ExecutionBlockImpl() {
     // -> we need to wait for that task to finish first!
     _prefetchTask->waitFor();
   }
+  if (_holdsAsyncPrefetchSlot) {
+    _engine->getQuery().releaseAsyncPrefetchSlot();
+  }
 }
 
 template<class Executor>
@@ -438,6 +442,12 @@ void ExecutionBlockImpl<Executor>::collectExecStats(ExecutionStats& stats) {
                             TraversalStats, MaterializeStats>) {
     _execNodeStats.filtered += _blockStats.getFiltered();
   }
+  if constexpr (std::is_same_v<typename Executor::Stats, SpillStats>) {
+    _execNodeStats.spills += _blockStats.getSpills();
+  }
+  if constexpr (std::is_same_v<typename Executor::Stats, TraversalStats>) {
+    addTraversalDepthStats(_execNodeStats.depths, _blockStats.getDepths());
+  }
   ExecutionBlock::collectExecStats(stats);
   stats += _blockStats;  // additional stats;
 }
@@ -612,10 +622,30 @@ auto ExecutionBlockImpl<Executor>::allocateOutputBlock(AqlCall&& call)
       }
     }
 
+    if constexpr (!std::is_same_v<Executor, SubqueryStartExecutor>) {
+      // A hard limit (e.g. from a LIMIT further down the pipeline) caps the
+      // number of rows we can write. We only apply it at the top level of
+      // the query, because inside subqueries a block gets reused for
+      // multiple iterations, each of which has its own limit. The
+      // SubqueryStartExecutor produces additional shadow rows, so its
+      // output is not bounded by the limit.
+      if (call.hasHardLimit() && call.getLimit() > 0 &&
+          _registerInfos.registersToKeep().size() == 1) {
+        blockSize = std::min(blockSize, call.getLimit());
+      }
+    }
+
+    // Do not let blocks for wide rows grow too large
+    blockSize = std::min(blockSize, maxRowsPerOutputBlock());
+
     if (blockSize == 0) {
       // There is no data to be produced
       return createOutputRow(SharedAqlItemBlockPtr{nullptr}, std::move(call));
     }
+    if (_profileLevel >= ProfileLevel::Blocks) {
+      _execNodeStats.blocks += 1;
+      _execNodeStats.blockRows += blockSize;
+    }
     return createOutputRow(
         _engine->itemBlockManager().requestBlock(
             blockSize, _registerInfos.numberOfOutputRegisters()),
@@ -623,6 +653,47 @@ auto ExecutionBlockImpl<Executor>::allocateOutputBlock(AqlCall&& call)
   }
 }
 
+template<class Executor>
+auto ExecutionBlockImpl<Executor>::maxRowsPerOutputBlock() const noexcept
+    -> size_t {
+  // target memory usage for a single output block. blocks with narrow rows
+  // are not affected by this, they are still capped by DefaultBatchSize
+  constexpr std::uint64_t targetBlockBytes = 4 * 1024 * 1024;
+  // never go below this number of rows, so that per-block overhead
+  // does not dominate
+  constexpr size_t minRowsPerBlock = 64;
+
+  if (_producedRows == 0) {
+    return ExecutionBlock::DefaultBatchSize;
+  }
+  std::uint64_t bytesPerRow =
+      _producedBytes / _producedRows +
+      _registerInfos.numberOfOutputRegisters() * sizeof(AqlValue);
+  if (bytesPerRow == 0) {
+    return ExecutionBlock::DefaultBatchSize;
+  }
+  return std::clamp<size_t>(
+      static_cast<size_t>(targetBlockBytes / bytesPerRow),
+      std::min(minRowsPerBlock, ExecutionBlock::DefaultBatchSize),
+      ExecutionBlock::DefaultBatchSize);
+}
+
+template<class Executor>
+void ExecutionBlockImpl<Executor>::trackProducedBlock(
+    SharedAqlItemBlockPtr const& block) noexcept {
+  if (block == nullptr || block->numRows() == 0) {
+    return;
+  }
+  // halve the history regularly, so that the average follows changes
+  // in the row width
+  if (_producedRows >= 16 * ExecutionBlock::DefaultBatchSize) {
+    _producedRows /= 2;
+    _producedBytes /= 2;
+  }
+  _producedRows += block->numRows();
+  _producedBytes += block->getMemoryUsage();
+}
+
 template<class Executor>
 void ExecutionBlockImpl<Executor>::ensureOutputBlock(AqlCall&& call) {
   if (_outputItemRow == nullptr || !_outputItemRow->isInitialized()) {
@@ -903,18 +974,27 @@ auto ExecutionBlockImpl<Executor>::executeFetcher(ExecutionContext& ctx,
       }
     });
 
+    if (_holdsAsyncPrefetchSlot) {
+      // the previous prefetch task has either been consumed or claimed by
+      // ourselves, so it does not count against the query's limit anymore
+      _engine->getQuery().releaseAsyncPrefetchSlot();
+      _holdsAsyncPrefetchSlot = false;
+    }
+
     // TODO - we should also consider the limit here, but unfortunately the
     // softLimit is currently also used for the batchSize
     if (std::get<ExecutionState>(result) == ExecutionState::HASMORE &&
-        _exeNode->isAsyncPrefetchEnabled()) {
+        _exeNode->isAsyncPrefetchEnabled() &&
+        _engine->getQuery().tryAcquireAsyncPrefetchSlot()) {
+      // the number of prefetch tasks per query is bounded, so that a single
+      // query cannot flood the scheduler queue with tasks, which could
+      // significantly delay processing of user REST requests.
+      _holdsAsyncPrefetchSlot = true;
       if (_prefetchTask == nullptr) {
         _prefetchTask = std::make_shared<PrefetchTask>();
       }
       _prefetchTask->reset();
 
-      // TODO - we should avoid flooding the queue with too many tasks as that
-      // can significantly delay processing of user REST requests.
-
       // we can safely ignore the result here, because we will try to
       // claim the task ourselves anyway.
 
@@ -2094,6 +2174,7 @@ ExecutionBlockImpl<Executor>::executeWithoutTrace(
 
   auto outputBlock = _outputItemRow != nullptr ? _outputItemRow->stealBlock()
                                                : SharedAqlItemBlockPtr{nullptr};
+  trackProducedBlock(outputBlock);
   // We are locally done with our output.
   // Next time we need to check the client call again
   _execState = returnToState;
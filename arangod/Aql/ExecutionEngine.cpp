@@ -632,6 +632,7 @@ auto ExecutionEngine::execute(AqlCallStack const& stack)
     _query.debugKillQuery();
   }
 
+  QueryResourceUsageScope usageScope(_query.resourceUsage());
   auto const res = _root->execute(stack);
 
   TRI_IF_FAILURE("ExecutionEngine::directKillAfterAQLQueryExecute") {
@@ -664,6 +665,7 @@ auto ExecutionEngine::executeForClient(AqlCallStack const& stack,
         "unexpected node type "s + root()->getPlanNode()->getTypeString());
   }
 
+  QueryResourceUsageScope usageScope(_query.resourceUsage());
   auto const res = rootBlock->executeForClient(stack, clientId);
 #ifdef ARANGODB_ENABLE_MAINTAINER_MODE
   if (std::get<ExecutionState>(res) == ExecutionState::WAITING) {
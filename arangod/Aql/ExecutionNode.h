@@ -691,6 +691,9 @@ class EnumerateCollectionNode : public ExecutionNode,
   /// @brief enable random iteration of documents in collection
   void setRandom();
 
+  /// @brief whether or not random iteration is enabled
+  bool isRandom() const noexcept { return _random; }
+
   /// @brief user hint regarding which index ot use
   IndexHint const& hint() const;
 
@@ -23,7 +23,51 @@
 
 #pragma once
 
+#include <cstddef>
 #include <cstdint>
+#include <vector>
+
+/// @brief statistics of a traversal for one depth. only collected for
+/// query profiles
+struct TraversalDepthStats {
+  // number of vertices expanded at this depth, i.e. the frontier size
+  uint64_t vertices = 0;
+  // number of index entries read when expanding the vertices
+  uint64_t edgesScanned = 0;
+  // number of edges that led to a new step of the traversal
+  uint64_t edgesAccepted = 0;
+  uint64_t cacheHits = 0;
+  uint64_t cacheMisses = 0;
+  // time spent (in seconds) in the provider, the path validator and the
+  // queue of the traversal
+  double providerTime = 0.0;
+  double validatorTime = 0.0;
+  double queueTime = 0.0;
+
+  TraversalDepthStats& operator+=(TraversalDepthStats const& other) {
+    vertices += other.vertices;
+    edgesScanned += other.edgesScanned;
+    edgesAccepted += other.edgesAccepted;
+    cacheHits += other.cacheHits;
+    cacheMisses += other.cacheMisses;
+    providerTime += other.providerTime;
+    validatorTime += other.validatorTime;
+    queueTime += other.queueTime;
+    return *this;
+  }
+};
+
+/// @brief adds the per-depth statistics of other to target
+inline void addTraversalDepthStats(
+    std::vector<TraversalDepthStats>& target,
+    std::vector<TraversalDepthStats> const& other) {
+  if (target.size() < other.size()) {
+    target.resize(other.size());
+  }
+  for (std::size_t depth = 0; depth < other.size(); ++depth) {
+    target[depth] += other[depth];
+  }
+}
 
 /// @brief statistics per ExecutionNode
 struct ExecutionNodeStats {
@@ -31,13 +75,25 @@ struct ExecutionNodeStats {
   uint64_t items = 0;
   // filtered is only populated by some nodes
   uint64_t filtered = 0;
+  // number of output blocks allocated, and their summed capacity (in rows)
+  uint64_t blocks = 0;
+  uint64_t blockRows = 0;
+  // number of times the node switched to a storage strategy for larger
+  // inputs at runtime, e.g. from in-memory sorting to spilling to disk
+  uint64_t spills = 0;
   double runtime = 0.0;
+  // per-depth statistics, only populated by traversals
+  std::vector<TraversalDepthStats> depths;
 
   ExecutionNodeStats& operator+=(ExecutionNodeStats const& other) {
     calls += other.calls;
     items += other.items;
     filtered += other.filtered;
+    blocks += other.blocks;
+    blockRows += other.blockRows;
+    spills += other.spills;
     runtime += other.runtime;
+    addTraversalDepthStats(depths, other.depths);
     return *this;
   }
 };
@@ -241,6 +241,13 @@ ResultT<size_t> parseMaxProjections(AstNode const* value) {
   return Result{TRI_ERROR_BAD_PARAMETER};
 }
 
+ResultT<uint64_t> parseDegreeLimit(AstNode const* value) {
+  if (value->isIntValue() && value->getIntValue() >= 0) {
+    return static_cast<uint64_t>(value->getIntValue());
+  }
+  return Result{TRI_ERROR_BAD_PARAMETER};
+}
+
 std::unique_ptr<graph::BaseOptions> createTraversalOptions(
     Ast* ast, AstNode const* direction, AstNode const* optionsNode) {
   TRI_ASSERT(direction != nullptr);
@@ -329,6 +336,37 @@ std::unique_ptr<graph::BaseOptions> createTraversalOptions(
           }
         } else if (name == "weightAttribute" && value->isStringValue()) {
           options->weightAttribute = value->getString();
+        } else if (name == "useGraphSnapshot") {
+          // graph snapshots are only used by read-only queries
+          options->useGraphSnapshot =
+              value->isTrue() && !ast->containsModificationNode();
+        } else if (name == "maxEdgesPerVertex" ||
+                   name == "maxVertexDegree") {
+          auto limit = parseDegreeLimit(value);
+          if (limit.fail()) {
+            // will raise a warning, which can optionally abort the query
+            ExecutionPlan::invalidOptionAttribute(query, "invalid", "FOR",
+                                                  name.data(), name.size());
+          } else if (name == "maxEdgesPerVertex") {
+            options->maxEdgesPerVertex = limit.get();
+          } else {
+            options->maxVertexDegree = limit.get();
+          }
+        } else if (name == "sampleEdges") {
+          options->sampleEdges = value->isTrue();
+        } else if (name == "pathFormat") {
+          if (value->isStringValue() &&
+              value->stringEqualsCaseInsensitive("sharedPrefixes")) {
+            options->pathFormat =
+                traverser::TraverserOptions::PathFormat::SHARED_PREFIXES;
+          } else if (value->isStringValue() &&
+                     value->stringEqualsCaseInsensitive("full")) {
+            options->pathFormat = traverser::TraverserOptions::PathFormat::FULL;
+          } else {
+            // will raise a warning, which can optionally abort the query
+            ExecutionPlan::invalidOptionAttribute(query, "invalid", "FOR",
+                                                  name.data(), name.size());
+          }
         } else if (name == "parallelism") {
           if (ast->canApplyParallelism()) {
             // parallelism is only used when there is no usage of V8 in the
@@ -396,6 +434,18 @@ std::unique_ptr<graph::BaseOptions> createShortestPathOptions(
               std::string(value->getStringValue(), value->getStringLength()));
         } else if (name == "defaultWeight" && value->isNumericValue()) {
           options->setDefaultWeight(value->getDoubleValue());
+        } else if (name == "heuristicAttribute" && value->isStringValue()) {
+          options->setHeuristicAttribute(
+              std::string(value->getStringValue(), value->getStringLength()));
+        } else if (name == "heuristicFactor" && value->isNumericValue()) {
+          options->setHeuristicFactor(value->getDoubleValue());
+        } else if (name == "parallelism" &&
+                   type != arangodb::graph::PathType::Type::ShortestPath) {
+          if (ast->canApplyParallelism()) {
+            // parallelism is only used when there is no usage of V8 in the
+            // query and if the query is not a modification query.
+            options->setParallelism(Ast::validatedParallelism(value));
+          }
         } else {
           ExecutionPlan::invalidOptionAttribute(
               ast->query(), "unknown",
@@ -1056,6 +1106,9 @@ ModificationOptions ExecutionPlan::parseModificationOptions(
           options.exclusive = value->isTrue();
         } else if (name == "ignoreErrors") {
           options.ignoreErrors = value->isTrue();
+        } else if (name == "readOwnWrites" &&
+                   std::string_view(operationName) == "UPSERT") {
+          options.readOwnWrites = value->isTrue();
         } else {
           if (addWarnings) {
             invalidOptionAttribute(query, "unknown", operationName, name.data(),
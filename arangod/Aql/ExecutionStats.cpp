@@ -33,6 +33,39 @@
 
 using namespace arangodb::aql;
 
+void QueryResources::toVelocyPack(VPackBuilder& builder) const {
+  builder.add("cpuTime", VPackValue(cpuTime));
+  builder.add("blockCacheHits", VPackValue(blockCacheHits));
+  builder.add("blockCacheMisses", VPackValue(blockCacheMisses));
+  builder.add("bytesRead", VPackValue(bytesRead));
+  builder.add("networkBytesSent", VPackValue(networkBytesSent));
+  builder.add("networkBytesReceived", VPackValue(networkBytesReceived));
+}
+
+void QueryResources::fromVelocyPack(VPackSlice slice) {
+  using arangodb::basics::VelocyPackHelper;
+  cpuTime = VelocyPackHelper::getNumericValue<double>(slice, "cpuTime", 0.0);
+  blockCacheHits =
+      VelocyPackHelper::getNumericValue<uint64_t>(slice, "blockCacheHits", 0);
+  blockCacheMisses =
+      VelocyPackHelper::getNumericValue<uint64_t>(slice, "blockCacheMisses", 0);
+  bytesRead =
+      VelocyPackHelper::getNumericValue<uint64_t>(slice, "bytesRead", 0);
+  networkBytesSent =
+      VelocyPackHelper::getNumericValue<uint64_t>(slice, "networkBytesSent", 0);
+  networkBytesReceived = VelocyPackHelper::getNumericValue<uint64_t>(
+      slice, "networkBytesReceived", 0);
+}
+
+void QueryResources::add(QueryResources const& summand) noexcept {
+  cpuTime += summand.cpuTime;
+  blockCacheHits += summand.blockCacheHits;
+  blockCacheMisses += summand.blockCacheMisses;
+  bytesRead += summand.bytesRead;
+  networkBytesSent += summand.networkBytesSent;
+  networkBytesReceived += summand.networkBytesReceived;
+}
+
 /// @brief convert the statistics to VelocyPack
 void ExecutionStats::toVelocyPack(VPackBuilder& builder,
                                   bool reportFullCount) const {
@@ -56,6 +89,7 @@ void ExecutionStats::toVelocyPack(VPackBuilder& builder,
 
   builder.add("peakMemoryUsage", VPackValue(peakMemoryUsage));
   builder.add("intermediateCommits", VPackValue(intermediateCommits));
+  resources.toVelocyPack(builder);
 
   if (!_nodes.empty()) {
     builder.add("nodes", VPackValue(VPackValueType::Array));
@@ -65,7 +99,26 @@ void ExecutionStats::toVelocyPack(VPackBuilder& builder,
       builder.add("calls", VPackValue(pair.second.calls));
       builder.add("items", VPackValue(pair.second.items));
       builder.add("filtered", VPackValue(pair.second.filtered));
+      builder.add("blocks", VPackValue(pair.second.blocks));
+      builder.add("blockRows", VPackValue(pair.second.blockRows));
+      builder.add("spills", VPackValue(pair.second.spills));
       builder.add("runtime", VPackValue(pair.second.runtime));
+      if (!pair.second.depths.empty()) {
+        builder.add("depths", VPackValue(VPackValueType::Array));
+        for (auto const& depth : pair.second.depths) {
+          builder.openObject();
+          builder.add("vertices", VPackValue(depth.vertices));
+          builder.add("edgesScanned", VPackValue(depth.edgesScanned));
+          builder.add("edgesAccepted", VPackValue(depth.edgesAccepted));
+          builder.add("cacheHits", VPackValue(depth.cacheHits));
+          builder.add("cacheMisses", VPackValue(depth.cacheMisses));
+          builder.add("providerTime", VPackValue(depth.providerTime));
+          builder.add("validatorTime", VPackValue(depth.validatorTime));
+          builder.add("queueTime", VPackValue(depth.queueTime));
+          builder.close();
+        }
+        builder.close();
+      }
       builder.close();
     }
     builder.close();
@@ -91,6 +144,7 @@ void ExecutionStats::add(ExecutionStats const& summand) {
   count += summand.count;
   peakMemoryUsage = std::max(summand.peakMemoryUsage, peakMemoryUsage);
   intermediateCommits += summand.intermediateCommits;
+  resources.add(summand.resources);
   // intentionally no modification of executionTime, as the overall
   // time is calculated in the end
 
@@ -194,6 +248,9 @@ ExecutionStats::ExecutionStats(VPackSlice slice) : ExecutionStats() {
   cacheMisses = basics::VelocyPackHelper::getNumericValue<uint64_t>(
       slice, "cacheMisses", 0);
 
+  // resource usage attributes are optional, too
+  resources.fromVelocyPack(slice);
+
   // note: fullCount is an optional attribute!
   if (VPackSlice s = slice.get("fullCount"); s.isNumber()) {
     fullCount = s.getNumber<uint64_t>();
@@ -212,7 +269,41 @@ ExecutionStats::ExecutionStats(VPackSlice slice) : ExecutionStats() {
       if (VPackSlice s = val.get("filtered"); !s.isNone()) {
         node.filtered = s.getNumber<uint64_t>();
       }
+      // blocks and blockRows are optional, too
+      if (VPackSlice s = val.get("blocks"); s.isNumber()) {
+        node.blocks = s.getNumber<uint64_t>();
+      }
+      if (VPackSlice s = val.get("blockRows"); s.isNumber()) {
+        node.blockRows = s.getNumber<uint64_t>();
+      }
+      if (VPackSlice s = val.get("spills"); s.isNumber()) {
+        node.spills = s.getNumber<uint64_t>();
+      }
       node.runtime = val.get("runtime").getNumber<double>();
+      // per-depth statistics are only present for traversals
+      node.depths.clear();
+      if (VPackSlice s = val.get("depths"); s.isArray()) {
+        using basics::VelocyPackHelper;
+        for (VPackSlice d : VPackArrayIterator(s)) {
+          auto& depth = node.depths.emplace_back();
+          depth.vertices =
+              VelocyPackHelper::getNumericValue<uint64_t>(d, "vertices", 0);
+          depth.edgesScanned = VelocyPackHelper::getNumericValue<uint64_t>(
+              d, "edgesScanned", 0);
+          depth.edgesAccepted = VelocyPackHelper::getNumericValue<uint64_t>(
+              d, "edgesAccepted", 0);
+          depth.cacheHits =
+              VelocyPackHelper::getNumericValue<uint64_t>(d, "cacheHits", 0);
+          depth.cacheMisses =
+              VelocyPackHelper::getNumericValue<uint64_t>(d, "cacheMisses", 0);
+          depth.providerTime =
+              VelocyPackHelper::getNumericValue<double>(d, "providerTime", 0);
+          depth.validatorTime =
+              VelocyPackHelper::getNumericValue<double>(d, "validatorTime", 0);
+          depth.queueTime =
+              VelocyPackHelper::getNumericValue<double>(d, "queueTime", 0);
+        }
+      }
       auto const& alias = _nodeAliases.find(nid);
       if (alias != _nodeAliases.end()) {
         nid = alias->second;
@@ -252,5 +343,6 @@ void ExecutionStats::clear() noexcept {
   executionTime = 0.0;
   peakMemoryUsage = 0;
   intermediateCommits = 0;
+  resources = QueryResources();
   _nodes.clear();
 }
@@ -37,6 +37,32 @@ class Slice;
 }  // namespace velocypack
 namespace aql {
 
+/// @brief resources used by a query. on coordinators, this includes the
+/// resources used by the query's snippets on the DB servers
+struct QueryResources {
+  /// @brief add the attributes to an open object
+  void toVelocyPack(arangodb::velocypack::Builder& builder) const;
+
+  /// @brief read the attributes from an object. missing attributes are
+  /// treated as 0
+  void fromVelocyPack(arangodb::velocypack::Slice slice);
+
+  void add(QueryResources const& summand) noexcept;
+
+  /// @brief CPU time (in seconds) of the threads while executing the query
+  double cpuTime = 0.0;
+  /// @brief number of block cache hits in the storage engine
+  uint64_t blockCacheHits = 0;
+  /// @brief number of block cache misses in the storage engine
+  uint64_t blockCacheMisses = 0;
+  /// @brief number of bytes the storage engine read from files
+  uint64_t bytesRead = 0;
+  /// @brief number of bytes sent to other servers for remote snippets
+  uint64_t networkBytesSent = 0;
+  /// @brief number of bytes received from other servers for remote snippets
+  uint64_t networkBytesReceived = 0;
+};
+
 struct ExecutionStats {
   ExecutionStats() noexcept;
 
@@ -116,6 +142,9 @@ struct ExecutionStats {
   /// @brief number of commits that happened for the query
   uint64_t intermediateCommits = 0;
 
+  /// @brief resources used by the query
+  QueryResources resources;
+
  private:
   /// @brief Node aliases, source => target.
   ///        Every source node in the this aliases list
@@ -61,9 +61,48 @@
 #include <v8.h>
 
 #include <limits>
+#include <optional>
+#include <vector>
 
 using namespace arangodb;
 using namespace arangodb::aql;
+
+namespace {
+// minimum number of members in a constant IN array for which we build a
+// hash-based lookup table
+constexpr size_t kMinConstantInLookupSize = 32;
+
+// whether or not a value is compared in the same way by a binary equality
+// comparison and by AqlValue::Compare. this is the case for numbers and for
+// strings that consist only of printable ASCII characters (the collation
+// may treat some other characters as ignorable)
+bool supportsBinaryEquality(VPackSlice value) {
+  if (value.isNumber()) {
+    return true;
+  }
+  if (!value.isString()) {
+    return false;
+  }
+  for (char c : value.stringView()) {
+    if (c < 0x20 || c > 0x7e) {
+      return false;
+    }
+  }
+  return true;
+}
+}  // namespace
+
+struct Expression::ConstantInLookup {
+  ConstantInLookup(VPackOptions const* options, size_t size)
+      : values(size, basics::VelocyPackHelper::VPackHash(),
+               basics::VelocyPackHelper::VPackEqual(options)) {}
+
+  // the slices point into the computed value of the constant array node
+  containers::FlatHashSet<VPackSlice, basics::VelocyPackHelper::VPackHash,
+                          basics::VelocyPackHelper::VPackEqual>
+      values;
+  size_t memoryUsage = 0;
+};
 using VelocyPackHelper = arangodb::basics::VelocyPackHelper;
 
 /// @brief create the expression
@@ -113,6 +152,13 @@ AqlValue Expression::execute(ExpressionContext* ctx, bool& mustDestroy) {
     }
 
     case SIMPLE: {
+      if (_inLookup != nullptr) {
+        AqlValue result;
+        if (executeConstantInLookup(*ctx, result)) {
+          mustDestroy = false;
+          return result;
+        }
+      }
       return executeSimpleExpression(*ctx, _node, mustDestroy, true);
     }
 
@@ -191,6 +237,12 @@ void Expression::freeInternals() noexcept {
       break;
     }
   }
+
+  if (_inLookup != nullptr) {
+    _resourceMonitor.decreaseMemoryUsage(_inLookup->memoryUsage);
+    _inLookup.reset();
+  }
+  _inLookupPrepared = false;
 }
 
 /// @brief reset internal attributes after variables in the expression were
@@ -419,7 +471,84 @@ void Expression::prepareForExecution() {
 
   } else if (_type == ATTRIBUTE_ACCESS && _accessor == nullptr) {
     initAccessor();
+  } else if (_type == SIMPLE && !_inLookupPrepared) {
+    prepareConstantInLookup();
+  }
+}
+
+/// @brief build a hash-based lookup table for expressions of the form
+/// `value IN [constants]` and `value NOT IN [constants]` with many
+/// constants, e.g. semi-join filters with key lists that were produced
+/// elsewhere and injected into the query. probing the table for a
+/// non-matching value is much cheaper than the binary or linear search
+/// in findInArray()
+void Expression::prepareConstantInLookup() {
+  TRI_ASSERT(_type == SIMPLE);
+  TRI_ASSERT(_inLookup == nullptr);
+  _inLookupPrepared = true;
+
+  if (_node->type != NODE_TYPE_OPERATOR_BINARY_IN &&
+      _node->type != NODE_TYPE_OPERATOR_BINARY_NIN) {
+    return;
+  }
+  // the left-hand side will be evaluated again by the generic evaluation
+  // for values that cannot be looked up, so it must not have side effects
+  AstNode const* lhs = _node->getMemberUnchecked(0);
+  if (!lhs->isDeterministic() || lhs->willUseV8()) {
+    return;
+  }
+  AstNode const* rhs = _node->getMemberUnchecked(1);
+  if (rhs->type != NODE_TYPE_ARRAY || !rhs->isConstant() ||
+      rhs->numMembers() < kMinConstantInLookupSize) {
+    return;
+  }
+
+  VPackSlice values = rhs->computeValue();
+  TRI_ASSERT(values.isArray());
+
+  auto const* options = &_ast->query().vpackOptions();
+  auto lookup = std::make_unique<ConstantInLookup>(options, values.length());
+  for (VPackSlice value : VPackArrayIterator(values)) {
+    if (!supportsBinaryEquality(value)) {
+      // the generic evaluation must be used
+      return;
+    }
+    lookup->values.emplace(value);
+  }
+
+  size_t memoryUsage = lookup->values.capacity() * (sizeof(VPackSlice) + 1);
+  _resourceMonitor.increaseMemoryUsage(memoryUsage);
+  lookup->memoryUsage = memoryUsage;
+  _inLookup = std::move(lookup);
+}
+
+bool Expression::executeConstantInLookup(ExpressionContext& ctx,
+                                         AqlValue& result) {
+  TRI_ASSERT(_inLookup != nullptr);
+  TRI_ASSERT(_node->type == NODE_TYPE_OPERATOR_BINARY_IN ||
+             _node->type == NODE_TYPE_OPERATOR_BINARY_NIN);
+
+  bool mustDestroy;
+  AqlValue left = executeSimpleExpression(ctx, _node->getMemberUnchecked(0),
+                                          mustDestroy, false);
+  AqlValueGuard guard(left, mustDestroy);
+
+  if (!left.isNumber() && !left.isString()) {
+    return false;
+  }
+  VPackSlice slice = left.slice();
+  if (!supportsBinaryEquality(slice)) {
+    // all other values may still compare equal to some of the constants
+    // in AqlValue::Compare, so use the generic evaluation for them
+    return false;
   }
+
+  bool found = _inLookup->values.contains(slice);
+  if (_node->type == NODE_TYPE_OPERATOR_BINARY_NIN) {
+    found = !found;
+  }
+  result = AqlValue(AqlValueHintBool(found));
+  return true;
 }
 
 // brief execute an expression of type SIMPLE, the convention is that
@@ -442,6 +571,8 @@ AqlValue Expression::executeSimpleExpression(ExpressionContext& ctx,
       return executeSimpleExpressionValue(ctx, node, mustDestroy);
     case NODE_TYPE_REFERENCE:
       return executeSimpleExpressionReference(ctx, node, mustDestroy, doCopy);
+    case NODE_TYPE_PARAMETER:
+      return executeSimpleExpressionParameter(ctx, node, mustDestroy);
     case NODE_TYPE_FCALL:
       return executeSimpleExpressionFCall(ctx, node, mustDestroy);
     case NODE_TYPE_FCALL_USER:
@@ -803,6 +934,23 @@ AqlValue Expression::executeSimpleExpressionValue(ExpressionContext& ctx,
   return AqlValue(node->computeValue(builder.get()).begin());
 }
 
+// execute an expression of type SIMPLE with PARAMETER. this is only
+// reached for bind parameters that were deliberately not injected into
+// the plan, so that the plan can be reused with different values
+AqlValue Expression::executeSimpleExpressionParameter(ExpressionContext& ctx,
+                                                      AstNode const* node,
+                                                      bool& mustDestroy) {
+  // bind parameter values are owned by the query and stay valid until
+  // the query is finished, so we don't need to copy them
+  mustDestroy = false;
+  VPackSlice value = ctx.getBindParameterValue(node->getStringView());
+  if (value.isNone()) {
+    THROW_ARANGO_EXCEPTION_PARAMS(TRI_ERROR_QUERY_BIND_PARAMETER_MISSING,
+                                  node->getString().c_str());
+  }
+  return AqlValue(value.begin());
+}
+
 // execute an expression of type SIMPLE with REFERENCE
 AqlValue Expression::executeSimpleExpressionReference(ExpressionContext& ctx,
                                                       AstNode const* node,
@@ -1588,78 +1736,50 @@ AqlValue Expression::executeSimpleExpressionExpansion(ExpressionContext& ctx,
   auto variable = static_cast<Variable*>(iterator->getMember(0)->getData());
   auto levels = node->getIntValue(true);
 
-  AqlValue value;
-
-  if (levels > 1) {
-    // flatten value...
-    bool localMustDestroy;
-    AqlValue a = executeSimpleExpression(ctx, node->getMember(0),
-                                         localMustDestroy, false);
+  auto const& vopts = ctx.trx().vpackOptions();
 
-    AqlValueGuard guard(a, localMustDestroy);
+  bool localMustDestroy;
+  AqlValue value =
+      executeSimpleExpression(ctx, node->getMember(0), localMustDestroy, false);
+  AqlValueGuard guard(value, localMustDestroy);
 
-    if (!a.isArray()) {
-      TRI_ASSERT(!mustDestroy);
-      if (isBoolean) {
-        return AqlValue(AqlValueHintBool(false));
-      }
-      return AqlValue(AqlValueHintEmptyArray());
+  if (!value.isArray()) {
+    TRI_ASSERT(!mustDestroy);
+    if (isBoolean) {
+      return AqlValue(AqlValueHintBool(false));
     }
+    return AqlValue(AqlValueHintEmptyArray());
+  }
 
-    VPackBuffer<uint8_t> buffer;
-    VPackBuilder builder(buffer);
-    builder.openArray();
-
-    // generate a new temporary for the flattened array
-    std::function<void(AqlValue const&, int64_t)> flatten =
-        [&](AqlValue const& v, int64_t level) {
-          if (!v.isArray()) {
-            return;
-          }
-
-          size_t const n = v.length();
-          for (size_t i = 0; i < n; ++i) {
-            bool localMustDestroy;
-            AqlValue item = v.at(i, localMustDestroy, false);
-            AqlValueGuard guard(item, localMustDestroy);
-
-            bool const isArray = item.isArray();
-
-            if (!isArray || level == levels) {
-              builder.add(item.slice());
-            } else if (isArray && level < levels) {
-              flatten(item, level + 1);
-            }
-          }
-        };
-
-    flatten(a, 1);
-    builder.close();
-
-    mustDestroy = true;  // builder = dynamic data
-    value = AqlValue(std::move(buffer));
-  } else {
-    bool localMustDestroy;
-    AqlValue a = executeSimpleExpression(ctx, node->getMember(0),
-                                         localMustDestroy, false);
-
-    AqlValueGuard guard(a, localMustDestroy);
+  // the array members are iterated over directly, without copying them.
+  // ranges are the only array values that have no VPack representation
+  // (and we don't want to create one for them)
+  AqlValueMaterializer materializer(&vopts);
+  VPackSlice source;
+  if (!value.isRange()) {
+    source = materializer.slice(value, false);
+  }
 
-    if (!a.isArray()) {
-      TRI_ASSERT(!mustDestroy);
-      if (isBoolean) {
-        return AqlValue(AqlValueHintBool(false));
-      }
-      return AqlValue(AqlValueHintEmptyArray());
+  // for [**] etc., collect the members of the nested arrays. the collected
+  // slices point into the original value
+  std::vector<VPackSlice> flattened;
+  if (levels > 1) {
+    if (source.isNone()) {
+      // a range does not contain nested arrays
+      source = materializer.slice(value, false);
     }
-
-    mustDestroy = localMustDestroy;  // maybe we need to destroy...
-    guard.steal();                   // guard is not responsible anymore
-    value = a;
+    auto flatten = [&](auto& self, VPackSlice v, int64_t level) -> void {
+      for (VPackSlice item : VPackArrayIterator(v)) {
+        if (item.isArray() && level < levels) {
+          self(self, item, level + 1);
+        } else {
+          flattened.push_back(item);
+        }
+      }
+    };
+    flatten(flatten, source, 1);
   }
 
-  AqlValueGuard guard(value, mustDestroy);
-
   // RETURN
   // the default is to return array member unmodified
   AstNode const* projectionNode = node->getMember(1);
@@ -1671,20 +1791,30 @@ AqlValue Expression::executeSimpleExpressionExpansion(ExpressionContext& ctx,
   }
 
   if (filterNode == nullptr && projectionNode->type == NODE_TYPE_REFERENCE &&
-      value.isArray() && offset == 0 && count == INT64_MAX && !isBoolean) {
+      offset == 0 && count == INT64_MAX && !isBoolean) {
     // no filter and no limit... we can return the array as it is
     auto other = static_cast<Variable const*>(projectionNode->getData());
 
     if (other->id == variable->id) {
+      if (levels > 1) {
+        // return the flattened array
+        VPackBuffer<uint8_t> buffer;
+        VPackBuilder builder(buffer);
+        builder.openArray();
+        for (VPackSlice item : flattened) {
+          builder.add(item);
+        }
+        builder.close();
+        mustDestroy = true;  // builder = dynamic data
+        return AqlValue(std::move(buffer));
+      }
       // simplify `v[*]` to just `v` if it's already an array
-      mustDestroy = true;
+      mustDestroy = localMustDestroy;
       guard.steal();
       return value;
     }
   }
 
-  auto const& vopts = ctx.trx().vpackOptions();
-
   VPackBuffer<uint8_t> buffer;
   VPackBuilder builder(buffer);
 
@@ -1692,7 +1822,7 @@ AqlValue Expression::executeSimpleExpressionExpansion(ExpressionContext& ctx,
     builder.openArray();
   }
 
-  size_t const n = value.length();
+  size_t const n = levels > 1 ? flattened.size() : value.length();
 
   // relevant only in case isBoolean = true
   size_t minRequiredItems = 0;
@@ -1753,20 +1883,23 @@ AqlValue Expression::executeSimpleExpressionExpansion(ExpressionContext& ctx,
     }
   }
 
-  for (size_t i = 0; i < n; ++i) {
-    bool localMustDestroy;
-    AqlValue item = value.at(i, localMustDestroy, false);
-    AqlValueGuard guard(item, localMustDestroy);
+  // result of a boolean expansion, in case it is decided before all items
+  // have been looked at
+  std::optional<bool> booleanResult;
+  size_t numLeft = n;
 
-    AqlValueMaterializer materializer(&vopts);
+  // processes a single array member. returns false if no more members need
+  // to be looked at
+  auto processItem = [&](VPackSlice item) -> bool {
     // register temporary variable in context
-    ctx.setVariable(variable, materializer.slice(item, false));
+    ctx.setVariable(variable, item);
 
     bool takeItem = true;
 
     try {
       if (filterNode != nullptr) {
         // have a filter
+        bool localMustDestroy;
         AqlValue sub =
             executeSimpleExpression(ctx, filterNode, localMustDestroy, false);
 
@@ -1787,6 +1920,7 @@ AqlValue Expression::executeSimpleExpressionExpansion(ExpressionContext& ctx,
         ++takenItems;
 
         if (!isBoolean) {
+          bool localMustDestroy;
           AqlValue sub = executeSimpleExpression(ctx, projectionNode,
                                                  localMustDestroy, false);
           sub.toVelocyPack(&vopts, builder, /*resolveExternals*/ true,
@@ -1803,16 +1937,60 @@ AqlValue Expression::executeSimpleExpressionExpansion(ExpressionContext& ctx,
       throw;
     }
 
-    if (takeItem && count > 0) {
+    --numLeft;
+
+    if (isBoolean) {
+      // stop as soon as the remaining items cannot change the result
+      if (takenItems > maxRequiredItems ||
+          takenItems + numLeft < minRequiredItems) {
+        booleanResult = false;
+        return false;
+      }
+      if (takenItems >= minRequiredItems &&
+          takenItems + numLeft <= maxRequiredItems) {
+        booleanResult = true;
+        return false;
+      }
+    } else if (takeItem && count > 0) {
       // number of items to pick was restricted
       if (--count == 0) {
         // done
+        return false;
+      }
+    }
+    return true;
+  };
+
+  if (levels > 1) {
+    for (VPackSlice item : flattened) {
+      if (!processItem(item)) {
+        break;
+      }
+    }
+  } else if (!source.isNone()) {
+    for (VPackSlice item : VPackArrayIterator(source)) {
+      if (!processItem(item)) {
+        break;
+      }
+    }
+  } else {
+    TRI_ASSERT(value.isRange());
+    for (size_t i = 0; i < n; ++i) {
+      bool localMustDestroy;
+      AqlValue item = value.at(i, localMustDestroy, false);
+      AqlValueGuard guard(item, localMustDestroy);
+
+      AqlValueMaterializer materializer(&vopts);
+      if (!processItem(materializer.slice(item, false))) {
         break;
       }
     }
   }
 
   if (isBoolean) {
+    if (booleanResult.has_value()) {
+      return AqlValue(AqlValueHintBool(booleanResult.value()));
+    }
     return AqlValue(AqlValueHintBool(takenItems >= minRequiredItems &&
                                      takenItems <= maxRequiredItems));
   }
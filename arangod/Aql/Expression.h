@@ -24,6 +24,7 @@
 #pragma once
 
 #include <cstdint>
+#include <memory>
 #include <string>
 #include <unordered_map>
 
@@ -208,6 +209,11 @@ class Expression {
                                                AstNode const*,
                                                bool& mustDestroy);
 
+  // execute an expression of type SIMPLE with PARAMETER
+  static AqlValue executeSimpleExpressionParameter(ExpressionContext& ctx,
+                                                   AstNode const*,
+                                                   bool& mustDestroy);
+
   // execute an expression of type SIMPLE with REFERENCE
   static AqlValue executeSimpleExpressionReference(ExpressionContext& ctx,
                                                    AstNode const*,
@@ -291,6 +297,16 @@ class Expression {
                                                     AstNode const*,
                                                     bool& mustDestroy);
 
+  // hash-based lookup for `value IN [constants]` expressions
+  struct ConstantInLookup;
+
+  // set up _inLookup if the expression qualifies
+  void prepareConstantInLookup();
+
+  // try to evaluate the expression using _inLookup. returns false if the
+  // generic evaluation must be used
+  bool executeConstantInLookup(ExpressionContext& ctx, AqlValue& result);
+
   // the AST
   Ast* _ast;
 
@@ -310,6 +326,11 @@ class Expression {
   ExpressionType _type;
 
   arangodb::ResourceMonitor& _resourceMonitor;
+
+  // lookup table for the right-hand side of an IN/NOT IN root node with a
+  // large constant array. only set for expressions of type SIMPLE
+  std::unique_ptr<ConstantInLookup> _inLookup;
+  bool _inLookupPrepared = false;
 };
 
 }  // namespace aql
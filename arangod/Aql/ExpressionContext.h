@@ -78,6 +78,13 @@ class ExpressionContext {
 
   // unregister a temporary variable from the ExpressionContext.
   virtual void clearVariable(Variable const* variable) noexcept = 0;
+
+  // return the value of a bind parameter that was not injected into the
+  // execution plan but is resolved at runtime. returns a none slice if the
+  // bind parameter is not known. the data behind the slice is owned by
+  // the query and remains valid until the query is finished.
+  virtual velocypack::Slice getBindParameterValue(
+      std::string_view name) const = 0;
 };
 }  // namespace aql
 }  // namespace arangodb
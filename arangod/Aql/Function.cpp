@@ -37,11 +37,13 @@ using namespace arangodb::aql;
 /// @brief create the function
 Function::Function(std::string const& name, char const* arguments,
                    std::underlying_type<Flags>::type flags,
-                   FunctionImplementation implementation)
+                   FunctionImplementation implementation,
+                   FunctionBatchImplementation batchImplementation)
     : name(name),
       arguments(arguments),
       flags(flags),
       implementation(implementation),
+      batchImplementation(batchImplementation),
       conversions() {
   initializeArguments();
 
@@ -86,7 +88,8 @@ Function::Function(std::string const& name,
     : name(name),
       arguments("."),
       flags(makeFlags()),
-      implementation(implementation) {
+      implementation(implementation),
+      batchImplementation(nullptr) {
   initializeArguments();
 }
 #endif
@@ -106,7 +106,8 @@ struct Function {
   /// @brief create the function
   Function(std::string const& name, char const* arguments,
            std::underlying_type<Flags>::type flags,
-           FunctionImplementation implementation);
+           FunctionImplementation implementation,
+           FunctionBatchImplementation batchImplementation = nullptr);
 
 #ifdef ARANGODB_USE_GOOGLE_TESTS
   Function(std::string const& name, FunctionImplementation implementation);
@@ -152,6 +153,10 @@ struct Function {
   /// @brief C++ implementation of the function
   FunctionImplementation const implementation;
 
+  /// @brief optional batched C++ implementation of the function, see
+  /// FunctionBatchImplementation
+  FunctionBatchImplementation const batchImplementation;
+
   /// @brief function argument conversion information
   std::vector<Conversion> conversions;
 
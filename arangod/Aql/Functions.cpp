@@ -31,6 +31,7 @@
 #include "Aql/Expression.h"
 #include "Aql/ExpressionContext.h"
 #include "Aql/Function.h"
+#include "Aql/HyperLogLog.h"
 #include "Aql/Query.h"
 #include "Aql/Range.h"
 #include "Aql/V8Executor.h"
@@ -112,6 +113,9 @@
 
 #include <algorithm>
 #include <list>
+#include <optional>
+#include <span>
+#include <vector>
 
 #ifdef __APPLE__
 #include <regex>
@@ -2543,6 +2547,34 @@ AqlValue functions::Lower(ExpressionContext* ctx, AstNode const&,
   return AqlValue(utf8);
 }
 
+/// @brief batched variant of function LOWER
+void functions::LowerBatch(ExpressionContext* ctx, AstNode const&,
+                           std::span<AqlValue const> values,
+                           VPackFunctionParametersView,
+                           std::span<AqlValue> results) {
+  TRI_ASSERT(values.size() == results.size());
+  std::string utf8;
+  transaction::Methods* trx = &ctx->trx();
+  auto const& vopts = trx->vpackOptions();
+
+  // the same string buffer is reused for all values
+  transaction::StringLeaser buffer(trx);
+  velocypack::StringSink adapter(buffer.get());
+
+  for (size_t i = 0; i < values.size(); ++i) {
+    buffer->clear();
+    ::appendAsString(vopts, adapter, values[i]);
+
+    icu::UnicodeString unicodeStr(buffer->data(),
+                                  static_cast<int32_t>(buffer->length()));
+    unicodeStr.toLower(nullptr);
+    utf8.clear();
+    unicodeStr.toUTF8String(utf8);
+
+    results[i] = AqlValue(utf8);
+  }
+}
+
 /// @brief function UPPER
 AqlValue functions::Upper(ExpressionContext* ctx, AstNode const&,
                           VPackFunctionParametersView parameters) {
@@ -2564,6 +2596,34 @@ AqlValue functions::Upper(ExpressionContext* ctx, AstNode const&,
   return AqlValue(utf8);
 }
 
+/// @brief batched variant of function UPPER
+void functions::UpperBatch(ExpressionContext* ctx, AstNode const&,
+                           std::span<AqlValue const> values,
+                           VPackFunctionParametersView,
+                           std::span<AqlValue> results) {
+  TRI_ASSERT(values.size() == results.size());
+  std::string utf8;
+  transaction::Methods* trx = &ctx->trx();
+  auto const& vopts = trx->vpackOptions();
+
+  // the same string buffer is reused for all values
+  transaction::StringLeaser buffer(trx);
+  velocypack::StringSink adapter(buffer.get());
+
+  for (size_t i = 0; i < values.size(); ++i) {
+    buffer->clear();
+    ::appendAsString(vopts, adapter, values[i]);
+
+    icu::UnicodeString unicodeStr(buffer->data(),
+                                  static_cast<int32_t>(buffer->length()));
+    unicodeStr.toUpper(nullptr);
+    utf8.clear();
+    unicodeStr.toUTF8String(utf8);
+
+    results[i] = AqlValue(utf8);
+  }
+}
+
 /// @brief function SUBSTRING
 AqlValue functions::Substring(ExpressionContext* ctx, AstNode const&,
                               VPackFunctionParametersView parameters) {
@@ -3970,6 +4030,79 @@ AqlValue functions::DateDaysInMonth(ExpressionContext* expressionContext,
       AqlValueHintUInt(static_cast<uint64_t>(unsigned(lastMonthDay.day()))));
 }
 
+namespace {
+
+/// @brief the units supported by DATE_TRUNC
+enum class DateTruncUnit {
+  kYear,
+  kMonth,
+  kDay,
+  kHour,
+  kMinute,
+  kSecond,
+  kMillisecond,
+};
+
+/// @brief parse the unit parameter of DATE_TRUNC. returns std::nullopt for
+/// invalid units
+std::optional<DateTruncUnit> parseDateTruncUnit(AqlValue const& unit) {
+  TRI_ASSERT(unit.isString());
+  std::string duration = unit.slice().copyString();
+  basics::StringUtils::tolowerInPlace(duration);
+
+  if (duration == "y" || duration == "year" || duration == "years") {
+    return DateTruncUnit::kYear;
+  } else if (duration == "m" || duration == "month" || duration == "months") {
+    return DateTruncUnit::kMonth;
+  } else if (duration == "d" || duration == "day" || duration == "days") {
+    return DateTruncUnit::kDay;
+  } else if (duration == "h" || duration == "hour" || duration == "hours") {
+    return DateTruncUnit::kHour;
+  } else if (duration == "i" || duration == "minute" || duration == "minutes") {
+    return DateTruncUnit::kMinute;
+  } else if (duration == "s" || duration == "second" || duration == "seconds") {
+    return DateTruncUnit::kSecond;
+  } else if (duration == "f" || duration == "millisecond" ||
+             duration == "milliseconds") {
+    return DateTruncUnit::kMillisecond;
+  }
+  return std::nullopt;
+}
+
+tp_sys_clock_ms truncateTimePoint(tp_sys_clock_ms tp, DateTruncUnit unit) {
+  date::year_month_day ymd{floor<date::days>(tp)};
+  auto day_time = date::make_time(tp - date::sys_days(ymd));
+  milliseconds ms{0};
+  switch (unit) {
+    case DateTruncUnit::kYear:
+      ymd = date::year{ymd.year()} / date::jan / date::day{1};
+      break;
+    case DateTruncUnit::kMonth:
+      ymd = date::year{ymd.year()} / ymd.month() / date::day{1};
+      break;
+    case DateTruncUnit::kDay:
+      // this would be: ymd = year{ymd.year()}/ymd.month()/ymd.day();
+      // However, we already split ymd to the precision of days,
+      // and ms to cary the timestamp part, so nothing needs to be done here.
+      break;
+    case DateTruncUnit::kHour:
+      ms = day_time.hours();
+      break;
+    case DateTruncUnit::kMinute:
+      ms = day_time.hours() + day_time.minutes();
+      break;
+    case DateTruncUnit::kSecond:
+      ms = day_time.to_duration() - day_time.subseconds();
+      break;
+    case DateTruncUnit::kMillisecond:
+      ms = day_time.to_duration();
+      break;
+  }
+  return tp_sys_clock_ms{date::sys_days(ymd) + ms};
+}
+
+}  // namespace
+
 /// @brief function DATE_TRUNC
 AqlValue functions::DateTrunc(ExpressionContext* expressionContext,
                               AstNode const&,
@@ -3989,36 +4122,50 @@ AqlValue functions::DateTrunc(ExpressionContext* expressionContext,
     return AqlValue(AqlValueHintNull());
   }
 
-  std::string duration = durationType.slice().copyString();
-  basics::StringUtils::tolowerInPlace(duration);
-
-  date::year_month_day ymd{floor<date::days>(tp)};
-  auto day_time = date::make_time(tp - date::sys_days(ymd));
-  milliseconds ms{0};
-  if (duration == "y" || duration == "year" || duration == "years") {
-    ymd = date::year{ymd.year()} / date::jan / date::day{1};
-  } else if (duration == "m" || duration == "month" || duration == "months") {
-    ymd = date::year{ymd.year()} / ymd.month() / date::day{1};
-  } else if (duration == "d" || duration == "day" || duration == "days") {
-    // this would be: ymd = year{ymd.year()}/ymd.month()/ymd.day();
-    // However, we already split ymd to the precision of days,
-    // and ms to cary the timestamp part, so nothing needs to be done here.
-  } else if (duration == "h" || duration == "hour" || duration == "hours") {
-    ms = day_time.hours();
-  } else if (duration == "i" || duration == "minute" || duration == "minutes") {
-    ms = day_time.hours() + day_time.minutes();
-  } else if (duration == "s" || duration == "second" || duration == "seconds") {
-    ms = day_time.to_duration() - day_time.subseconds();
-  } else if (duration == "f" || duration == "millisecond" ||
-             duration == "milliseconds") {
-    ms = day_time.to_duration();
-  } else {
+  auto unit = ::parseDateTruncUnit(durationType);
+  if (!unit.has_value()) {
     registerWarning(expressionContext, AFN, TRI_ERROR_QUERY_INVALID_DATE_VALUE);
     return AqlValue(AqlValueHintNull());
   }
-  tp = tp_sys_clock_ms{date::sys_days(ymd) + ms};
 
-  return ::timeAqlValue(expressionContext, AFN, tp);
+  return ::timeAqlValue(expressionContext, AFN,
+                        ::truncateTimePoint(tp, *unit));
+}
+
+/// @brief batched variant of function DATE_TRUNC. the unit is parsed only
+/// once for all values
+void functions::DateTruncBatch(ExpressionContext* expressionContext,
+                               AstNode const&, std::span<AqlValue const> values,
+                               VPackFunctionParametersView parameters,
+                               std::span<AqlValue> results) {
+  static char const* AFN = "DATE_TRUNC";
+  TRI_ASSERT(values.size() == results.size());
+
+  AqlValue const& durationType = extractFunctionParameterValue(parameters, 1);
+  std::optional<DateTruncUnit> unit;
+  if (durationType.isString()) {
+    unit = ::parseDateTruncUnit(durationType);
+  }
+
+  tp_sys_clock_ms tp;
+  for (size_t i = 0; i < values.size(); ++i) {
+    // the date value is validated first, so that warnings are registered in
+    // the same order as in the non-batched variant
+    if (!::parameterToTimePoint(expressionContext, values.subspan(i, 1), tp,
+                                AFN, 0)) {
+      results[i] = AqlValue(AqlValueHintNull());
+    } else if (!durationType.isString()) {
+      registerInvalidArgumentWarning(expressionContext, AFN);
+      results[i] = AqlValue(AqlValueHintNull());
+    } else if (!unit.has_value()) {
+      registerWarning(expressionContext, AFN,
+                      TRI_ERROR_QUERY_INVALID_DATE_VALUE);
+      results[i] = AqlValue(AqlValueHintNull());
+    } else {
+      results[i] = ::timeAqlValue(expressionContext, AFN,
+                                  ::truncateTimePoint(tp, *unit));
+    }
+  }
 }
 
 /// @brief function DATE_UTCTOLOCAL
@@ -5563,6 +5710,36 @@ AqlValue functions::CountDistinct(ExpressionContext* expressionContext,
   return AqlValue(AqlValueHintUInt(values.size()));
 }
 
+/// @brief function APPROX_COUNT_DISTINCT
+AqlValue functions::ApproxCountDistinct(
+    ExpressionContext* expressionContext, AstNode const&,
+    VPackFunctionParametersView parameters) {
+  // cppcheck-suppress variableScope
+  static char const* AFN = "APPROX_COUNT_DISTINCT";
+
+  transaction::Methods* trx = &expressionContext->trx();
+  auto* vopts = &trx->vpackOptions();
+  AqlValue const& value = extractFunctionParameterValue(parameters, 0);
+
+  if (!value.isArray()) {
+    // not an array
+    registerWarning(expressionContext, AFN, TRI_ERROR_QUERY_ARRAY_EXPECTED);
+    return AqlValue(AqlValueHintNull());
+  }
+
+  AqlValueMaterializer materializer(vopts);
+  VPackSlice slice = materializer.slice(value, false);
+
+  HyperLogLog sketch;
+  for (VPackSlice s : VPackArrayIterator(slice)) {
+    if (!s.isNone()) {
+      sketch.add(s.resolveExternal().normalizedHash());
+    }
+  }
+
+  return AqlValue(AqlValueHintUInt(sketch.estimate()));
+}
+
 /// @brief function UNIQUE
 AqlValue functions::Unique(ExpressionContext* expressionContext, AstNode const&,
                            VPackFunctionParametersView parameters) {
@@ -7231,6 +7408,17 @@ AqlValue functions::Abs(ExpressionContext*, AstNode const&,
   return ::numberValue(std::abs(input), true);
 }
 
+/// @brief batched variant of function ABS
+void functions::AbsBatch(ExpressionContext*, AstNode const&,
+                         std::span<AqlValue const> values,
+                         VPackFunctionParametersView,
+                         std::span<AqlValue> results) {
+  TRI_ASSERT(values.size() == results.size());
+  for (size_t i = 0; i < values.size(); ++i) {
+    results[i] = ::numberValue(std::abs(values[i].toDouble()), true);
+  }
+}
+
 /// @brief function CEIL
 AqlValue functions::Ceil(ExpressionContext*, AstNode const&,
                          VPackFunctionParametersView parameters) {
@@ -9602,27 +9790,59 @@ AqlValue functions::DecayLinear(aql::ExpressionContext* expressionContext,
   return decayFuncImpl(expressionContext, node, parameters, linearDecayFactory);
 }
 
+namespace {
+
+/// @brief decodes the members of a numeric array into `values`. returns
+/// false if the array contains anything but numbers
+bool decodeNumericVector(VPackSlice array, std::vector<double>& values) {
+  TRI_ASSERT(array.isArray());
+  values.clear();
+  VPackValueLength const n = array.length();
+  if (n == 0) {
+    return true;
+  }
+  values.reserve(n);
+  // compact arrays of doubles, as produced for embeddings, store all
+  // members without an index table and with the same byte size. read them
+  // one after the other without going through the generic array iterator
+  if (auto head = array.head(); head >= 0x02 && head <= 0x05) {
+    VPackSlice value = array.at(0);
+    if (value.isDouble()) {
+      uint8_t const* p = value.start();
+      for (VPackValueLength i = 0; i < n; ++i) {
+        value = VPackSlice(p);
+        if (!value.isDouble()) {
+          break;
+        }
+        values.push_back(value.getDouble());
+        p += 1 + sizeof(double);
+      }
+      if (values.size() == n) {
+        return true;
+      }
+      values.clear();
+    }
+  }
+  for (VPackSlice value : VPackArrayIterator(array)) {
+    if (!value.isNumber()) {
+      return false;
+    }
+    values.push_back(value.getNumber<double>());
+  }
+  return true;
+}
+
+}  // namespace
+
 template<typename F>
 AqlValue DistanceImpl(aql::ExpressionContext* expressionContext,
                       AstNode const& node,
                       VPackFunctionParametersView parameters,
                       F&& distanceFunc) {
-  auto calculateDistance = [distanceFunc = std::forward<F>(distanceFunc),
-                            expressionContext,
-                            &node](VPackSlice lhs, VPackSlice rhs) {
-    TRI_ASSERT(lhs.isArray());
-    TRI_ASSERT(rhs.isArray());
-
-    auto lhsIt = VPackArrayIterator(lhs);
-    auto rhsIt = VPackArrayIterator(rhs);
-
-    if (lhsIt.size() != rhsIt.size()) {
-      aql::registerWarning(expressionContext, getFunctionName(node).data(),
-                           TRI_ERROR_QUERY_FUNCTION_ARGUMENT_TYPE_MISMATCH);
-      return AqlValue(AqlValueHintNull());
-    }
-
-    return distanceFunc(lhsIt, rhsIt);
+  auto typeMismatch = [expressionContext, &node]() {
+    aql::registerWarning(expressionContext, getFunctionName(node).data(),
+                         TRI_ERROR_QUERY_FUNCTION_ARGUMENT_TYPE_MISMATCH);
+    return AqlValue(AqlValueHintNull());
   };
 
   // extract arguments
@@ -9653,17 +9873,22 @@ AqlValue DistanceImpl(aql::ExpressionContext* expressionContext,
       array = argLhs.slice();
     }
 
+    // the vector is decoded only once and then compared with every row
+    std::vector<double> arrayValues;
+    std::vector<double> rowValues;
+    bool const arrayIsNumeric = decodeNumericVector(array, arrayValues);
+
     VPackBuilder builder;
     {
       VPackArrayBuilder arrayBuilder(&builder);
       for (VPackSlice currRow : VPackArrayIterator(matrix)) {
-        if (!currRow.isArray()) {
-          aql::registerWarning(expressionContext, getFunctionName(node).data(),
-                               TRI_ERROR_QUERY_FUNCTION_ARGUMENT_TYPE_MISMATCH);
-          return AqlValue(AqlValueHintNull());
+        if (!currRow.isArray() || currRow.length() != array.length() ||
+            !arrayIsNumeric || !decodeNumericVector(currRow, rowValues)) {
+          return typeMismatch();
         }
 
-        AqlValue dist = calculateDistance(currRow, array);
+        AqlValue dist = distanceFunc(std::span<double const>(rowValues),
+                                     std::span<double const>(arrayValues));
         if (!dist.isNumber()) {
           return AqlValue(AqlValueHintNull());
         }
@@ -9676,7 +9901,17 @@ AqlValue DistanceImpl(aql::ExpressionContext* expressionContext,
 
   } else {
     // calculate dist between 2 vectors and return number
-    return calculateDistance(argLhs.slice(), argRhs.slice());
+    if (argLhs.length() != argRhs.length()) {
+      return typeMismatch();
+    }
+    std::vector<double> lhsValues;
+    std::vector<double> rhsValues;
+    if (!decodeNumericVector(argLhs.slice(), lhsValues) ||
+        !decodeNumericVector(argRhs.slice(), rhsValues)) {
+      return typeMismatch();
+    }
+    return distanceFunc(std::span<double const>(lhsValues),
+                        std::span<double const>(rhsValues));
   }
 }
 
@@ -9684,32 +9919,18 @@ AqlValue functions::CosineSimilarity(aql::ExpressionContext* expressionContext,
                                      AstNode const& node,
                                      VPackFunctionParametersView parameters) {
   auto cosineSimilarityFunc = [expressionContext, &node](
-                                  VPackArrayIterator lhsIt,
-                                  VPackArrayIterator rhsIt) {
+                                  std::span<double const> lhs,
+                                  std::span<double const> rhs) {
     double numerator{};
     double lhsSum{};
     double rhsSum{};
 
-    TRI_ASSERT(lhsIt.size() == rhsIt.size());
-
-    while (lhsIt.valid()) {
-      auto lhsSlice = lhsIt.value();
-      auto rhsSlice = rhsIt.value();
-      if (!lhsSlice.isNumber() || !rhsSlice.isNumber()) {
-        registerWarning(expressionContext, getFunctionName(node).data(),
-                        TRI_ERROR_QUERY_FUNCTION_ARGUMENT_TYPE_MISMATCH);
-        return AqlValue(AqlValueHintNull());
-      }
-
-      double lhsVal = lhsSlice.getNumber<double>();
-      double rhsVal = rhsSlice.getNumber<double>();
+    TRI_ASSERT(lhs.size() == rhs.size());
 
-      numerator += lhsVal * rhsVal;
-      lhsSum += lhsVal * lhsVal;
-      rhsSum += rhsVal * rhsVal;
-
-      lhsIt.next();
-      rhsIt.next();
+    for (size_t i = 0; i < lhs.size(); ++i) {
+      numerator += lhs[i] * rhs[i];
+      lhsSum += lhs[i] * lhs[i];
+      rhsSum += rhs[i] * rhs[i];
     }
 
     double denominator = std::sqrt(lhsSum) * std::sqrt(rhsSum);
@@ -9729,25 +9950,13 @@ AqlValue functions::CosineSimilarity(aql::ExpressionContext* expressionContext,
 AqlValue functions::L1Distance(aql::ExpressionContext* expressionContext,
                                AstNode const& node,
                                VPackFunctionParametersView parameters) {
-  auto L1DistFunc = [expressionContext, &node](VPackArrayIterator lhsIt,
-                                               VPackArrayIterator rhsIt) {
+  auto L1DistFunc = [](std::span<double const> lhs,
+                       std::span<double const> rhs) {
     double dist{};
-    TRI_ASSERT(lhsIt.size() == rhsIt.size());
-
-    while (lhsIt.valid()) {
-      auto lhsSlice = lhsIt.value();
-      auto rhsSlice = rhsIt.value();
-      if (!lhsSlice.isNumber() || !rhsSlice.isNumber()) {
-        aql::registerWarning(expressionContext, getFunctionName(node).data(),
-                             TRI_ERROR_QUERY_FUNCTION_ARGUMENT_TYPE_MISMATCH);
-        return AqlValue(AqlValueHintNull());
-      }
+    TRI_ASSERT(lhs.size() == rhs.size());
 
-      dist +=
-          std::abs(lhsSlice.getNumber<double>() - rhsSlice.getNumber<double>());
-
-      lhsIt.next();
-      rhsIt.next();
+    for (size_t i = 0; i < lhs.size(); ++i) {
+      dist += std::abs(lhs[i] - rhs[i]);
     }
 
     return ::numberValue(dist, true);
@@ -9759,27 +9968,15 @@ AqlValue functions::L1Distance(aql::ExpressionContext* expressionContext,
 AqlValue functions::L2Distance(aql::ExpressionContext* expressionContext,
                                AstNode const& node,
                                VPackFunctionParametersView parameters) {
-  auto L2DistFunc = [expressionContext, &node](VPackArrayIterator lhsIt,
-                                               VPackArrayIterator rhsIt) {
+  auto L2DistFunc = [](std::span<double const> lhs,
+                       std::span<double const> rhs) {
     double dist{};
 
-    TRI_ASSERT(lhsIt.size() == rhsIt.size());
-
-    while (lhsIt.valid()) {
-      auto lhsSlice = lhsIt.value();
-      auto rhsSlice = rhsIt.value();
-      if (!lhsSlice.isNumber() || !rhsSlice.isNumber()) {
-        registerWarning(expressionContext, getFunctionName(node).data(),
-                        TRI_ERROR_QUERY_FUNCTION_ARGUMENT_TYPE_MISMATCH);
-        return AqlValue(AqlValueHintNull());
-      }
-
-      double diff = lhsSlice.getNumber<double>() - rhsSlice.getNumber<double>();
-
-      dist += std::pow(diff, 2);
+    TRI_ASSERT(lhs.size() == rhs.size());
 
-      lhsIt.next();
-      rhsIt.next();
+    for (size_t i = 0; i < lhs.size(); ++i) {
+      double diff = lhs[i] - rhs[i];
+      dist += diff * diff;
     }
 
     return ::numberValue(std::sqrt(dist), true);
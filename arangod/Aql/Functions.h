@@ -51,6 +51,17 @@ typedef AqlValue (*FunctionImplementation)(arangodb::aql::ExpressionContext*,
                                            AstNode const&,
                                            VPackFunctionParametersView);
 
+/// @brief batched variant of a function implementation. it computes the
+/// function results for many values of the first function parameter at once,
+/// while all other function parameters have the same value for every call.
+/// `parameters` contains all function parameters, but the value at
+/// position 0 must be ignored and `values` must be used instead. the result
+/// for values[i] must be stored in results[i]
+typedef void (*FunctionBatchImplementation)(
+    arangodb::aql::ExpressionContext*, AstNode const&,
+    std::span<AqlValue const> values, VPackFunctionParametersView parameters,
+    std::span<AqlValue> results);
+
 void registerError(ExpressionContext* expressionContext,
                    std::string_view functionName, ErrorCode code);
 void registerWarning(ExpressionContext* expressionContext,
@@ -119,8 +130,14 @@ AqlValue CharLength(arangodb::aql::ExpressionContext*, AstNode const&,
                     VPackFunctionParametersView);
 AqlValue Lower(arangodb::aql::ExpressionContext*, AstNode const&,
                VPackFunctionParametersView);
+void LowerBatch(arangodb::aql::ExpressionContext*, AstNode const&,
+                std::span<AqlValue const>, VPackFunctionParametersView,
+                std::span<AqlValue>);
 AqlValue Upper(arangodb::aql::ExpressionContext*, AstNode const&,
                VPackFunctionParametersView);
+void UpperBatch(arangodb::aql::ExpressionContext*, AstNode const&,
+                std::span<AqlValue const>, VPackFunctionParametersView,
+                std::span<AqlValue>);
 AqlValue Substring(arangodb::aql::ExpressionContext*, AstNode const&,
                    VPackFunctionParametersView);
 AqlValue SubstringBytes(arangodb::aql::ExpressionContext*, AstNode const&,
@@ -222,6 +239,9 @@ AqlValue DateDaysInMonth(arangodb::aql::ExpressionContext*, AstNode const&,
                          VPackFunctionParametersView);
 AqlValue DateTrunc(arangodb::aql::ExpressionContext*, AstNode const&,
                    VPackFunctionParametersView);
+void DateTruncBatch(arangodb::aql::ExpressionContext*, AstNode const&,
+                    std::span<AqlValue const>, VPackFunctionParametersView,
+                    std::span<AqlValue>);
 AqlValue DateUtcToLocal(arangodb::aql::ExpressionContext*, AstNode const&,
                         VPackFunctionParametersView);
 AqlValue DateLocalToUtc(arangodb::aql::ExpressionContext*, AstNode const&,
@@ -333,6 +353,8 @@ AqlValue CountDistinct(arangodb::aql::ExpressionContext*, AstNode const&,
                        VPackFunctionParametersView);
 AqlValue CheckDocument(arangodb::aql::ExpressionContext*, AstNode const&,
                        VPackFunctionParametersView);
+AqlValue ApproxCountDistinct(arangodb::aql::ExpressionContext*,
+                             AstNode const&, VPackFunctionParametersView);
 AqlValue Unique(arangodb::aql::ExpressionContext*, AstNode const&,
                 VPackFunctionParametersView);
 AqlValue SortedUnique(arangodb::aql::ExpressionContext*, AstNode const&,
@@ -399,6 +421,9 @@ AqlValue Round(arangodb::aql::ExpressionContext*, AstNode const&,
                VPackFunctionParametersView);
 AqlValue Abs(arangodb::aql::ExpressionContext*, AstNode const&,
              VPackFunctionParametersView);
+void AbsBatch(arangodb::aql::ExpressionContext*, AstNode const&,
+              std::span<AqlValue const>, VPackFunctionParametersView,
+              std::span<AqlValue>);
 AqlValue Ceil(arangodb::aql::ExpressionContext*, AstNode const&,
               VPackFunctionParametersView);
 AqlValue Floor(arangodb::aql::ExpressionContext*, AstNode const&,
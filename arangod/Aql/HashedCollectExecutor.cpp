@@ -362,16 +362,17 @@ HashedCollectExecutor::findOrEmplaceGroup(InputAqlItemRow& input) {
     guard.steal();
   } else {
     for (auto const& reg : _infos.getGroupRegisters()) {
-      // With more then 1 register we cannot reliably figure out who
-      // is responsible for which value.
-      // E.g. for 2 registers we have two groups: A , 1 and A , 2
-      // Now A can be from different input blocks, and can be also
-      // be written to different output blocks, or even not handed over
-      // because of a limit. So we simply clone A here on every new group.
+      // With more then 1 register the same value can be part of multiple
+      // groups. E.g. for 2 registers we have two groups: A , 1 and A , 2
+      // Now A can be written to different output blocks, or even not
+      // handed over because of a limit. So only the first group that
+      // uses A takes it over from the input block, and all other groups
+      // get their own copy of A. This also covers the case of the same
+      // value being used in multiple registers of the same group.
       // So this block is responsible for every grouped tuple, until it
       // is handed over to the output block. There is no overlapping
       // of responsibilities of tuples.
-      AqlValue a = input.getValue(reg.second).clone();
+      AqlValue a = input.stealOrCloneValue(reg.second);
       AqlValueGuard guard{a, true};
       _nextGroup.values.emplace_back(a);
       guard.steal();
@@ -0,0 +1,179 @@
+////////////////////////////////////////////////////////////////////////////////
+/// DISCLAIMER
+///
+/// Copyright 2014-2023 ArangoDB GmbH, Cologne, Germany
+/// Copyright 2004-2014 triAGENS GmbH, Cologne, Germany
+///
+/// Licensed under the Apache License, Version 2.0 (the "License");
+/// you may not use this file except in compliance with the License.
+/// You may obtain a copy of the License at
+///
+///     http://www.apache.org/licenses/LICENSE-2.0
+///
+/// Unless required by applicable law or agreed to in writing, software
+/// distributed under the License is distributed on an "AS IS" BASIS,
+/// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+/// See the License for the specific language governing permissions and
+/// limitations under the License.
+///
+/// Copyright holder is ArangoDB GmbH, Cologne, Germany
+///
+/// @author Jan Steemann
+////////////////////////////////////////////////////////////////////////////////
+
+#include "HyperLogLog.h"
+
+#include "Basics/debugging.h"
+
+#include <velocypack/Builder.h>
+#include <velocypack/Iterator.h>
+#include <velocypack/Slice.h>
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <string>
+
+using namespace arangodb;
+using namespace arangodb::aql;
+
+namespace {
+// registers are serialized as printable characters, starting at this offset
+constexpr char registerOffset = '0';
+// maximum possible register value
+constexpr uint8_t maxRegisterValue = 64 - HyperLogLog::precision + 1;
+}  // namespace
+
+void HyperLogLog::add(uint64_t hash) {
+  if (isDense()) {
+    addToRegisters(hash);
+    return;
+  }
+  auto it = std::lower_bound(_sparse.begin(), _sparse.end(), hash);
+  if (it != _sparse.end() && *it == hash) {
+    // already seen
+    return;
+  }
+  if (_sparse.size() >= maxSparseHashes) {
+    convertToDense();
+    addToRegisters(hash);
+    return;
+  }
+  _sparse.insert(it, hash);
+}
+
+void HyperLogLog::merge(HyperLogLog const& other) {
+  if (!other.isDense()) {
+    for (uint64_t hash : other._sparse) {
+      add(hash);
+    }
+    return;
+  }
+  if (!isDense()) {
+    convertToDense();
+  }
+  for (std::size_t i = 0; i < numRegisters; ++i) {
+    _registers[i] = std::max(_registers[i], other._registers[i]);
+  }
+}
+
+uint64_t HyperLogLog::estimate() const noexcept {
+  if (!isDense()) {
+    // exact count
+    return _sparse.size();
+  }
+
+  double const m = static_cast<double>(numRegisters);
+  double sum = 0.0;
+  std::size_t zeros = 0;
+  for (uint8_t value : _registers) {
+    sum += std::ldexp(1.0, -static_cast<int>(value));
+    if (value == 0) {
+      ++zeros;
+    }
+  }
+  double const alpha = 0.7213 / (1.0 + 1.079 / m);
+  double estimate = alpha * m * m / sum;
+  if (estimate <= 2.5 * m && zeros > 0) {
+    // small range correction (linear counting)
+    estimate = m * std::log(m / static_cast<double>(zeros));
+  }
+  return static_cast<uint64_t>(std::llround(estimate));
+}
+
+void HyperLogLog::clear() noexcept {
+  _sparse.clear();
+  _registers.clear();
+  _registers.shrink_to_fit();
+}
+
+void HyperLogLog::toVelocyPack(velocypack::Builder& builder) const {
+  if (!isDense()) {
+    builder.openArray();
+    for (uint64_t hash : _sparse) {
+      builder.add(velocypack::Value(hash));
+    }
+    builder.close();
+    return;
+  }
+  std::string value;
+  value.reserve(numRegisters);
+  for (uint8_t r : _registers) {
+    value.push_back(static_cast<char>(registerOffset + r));
+  }
+  builder.add(velocypack::Value(value));
+}
+
+bool HyperLogLog::mergeVelocyPack(velocypack::Slice slice) {
+  if (slice.isArray()) {
+    for (velocypack::Slice it : velocypack::ArrayIterator(slice)) {
+      if (!it.isNumber<uint64_t>()) {
+        return false;
+      }
+    }
+    for (velocypack::Slice it : velocypack::ArrayIterator(slice)) {
+      add(it.getNumber<uint64_t>());
+    }
+    return true;
+  }
+
+  if (!slice.isString()) {
+    return false;
+  }
+  std::string_view value = slice.stringView();
+  if (value.size() != numRegisters ||
+      !std::all_of(value.begin(), value.end(), [](char c) {
+        return c >= registerOffset && c <= registerOffset + maxRegisterValue;
+      })) {
+    return false;
+  }
+  if (!isDense()) {
+    convertToDense();
+  }
+  for (std::size_t i = 0; i < numRegisters; ++i) {
+    _registers[i] = std::max(
+        _registers[i], static_cast<uint8_t>(value[i] - registerOffset));
+  }
+  return true;
+}
+
+void HyperLogLog::addToRegisters(uint64_t hash) noexcept {
+  TRI_ASSERT(isDense());
+  // the upper bits select the register, the position of the first 1-bit in
+  // the remaining bits is the register value
+  std::size_t index = static_cast<std::size_t>(hash >> (64 - precision));
+  uint64_t rest = (hash << precision) | (uint64_t(1) << (precision - 1));
+  uint8_t value = static_cast<uint8_t>(std::countl_zero(rest) + 1);
+  TRI_ASSERT(value <= maxRegisterValue);
+  _registers[index] = std::max(_registers[index], value);
+}
+
+void HyperLogLog::convertToDense() {
+  TRI_ASSERT(!isDense());
+  _registers.resize(numRegisters, 0);
+  for (uint64_t hash : _sparse) {
+    addToRegisters(hash);
+  }
+  _sparse.clear();
+  _sparse.shrink_to_fit();
+}
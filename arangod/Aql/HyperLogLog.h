@@ -0,0 +1,88 @@
+////////////////////////////////////////////////////////////////////////////////
+/// DISCLAIMER
+///
+/// Copyright 2014-2023 ArangoDB GmbH, Cologne, Germany
+/// Copyright 2004-2014 triAGENS GmbH, Cologne, Germany
+///
+/// Licensed under the Apache License, Version 2.0 (the "License");
+/// you may not use this file except in compliance with the License.
+/// You may obtain a copy of the License at
+///
+///     http://www.apache.org/licenses/LICENSE-2.0
+///
+/// Unless required by applicable law or agreed to in writing, software
+/// distributed under the License is distributed on an "AS IS" BASIS,
+/// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+/// See the License for the specific language governing permissions and
+/// limitations under the License.
+///
+/// Copyright holder is ArangoDB GmbH, Cologne, Germany
+///
+/// @author Jan Steemann
+////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace arangodb {
+namespace velocypack {
+class Builder;
+class Slice;
+}  // namespace velocypack
+
+namespace aql {
+
+/// @brief HyperLogLog sketch for estimating the number of distinct values.
+/// small sets are kept exactly as a sorted list of value hashes ("sparse"
+/// mode), which is converted into the fixed-size register array ("dense"
+/// mode) once it grows beyond maxSparseHashes entries. sketches can be
+/// serialized and merged, so that partial sketches built on DB servers can
+/// be combined on a coordinator.
+/// with 2^12 registers, the standard error of the estimate is about 1.6%.
+class HyperLogLog {
+ public:
+  static constexpr unsigned precision = 12;
+  static constexpr std::size_t numRegisters = std::size_t(1) << precision;
+  /// @brief maximum number of hashes kept in sparse mode. chosen so that the
+  /// sparse representation never uses more memory than the dense one
+  static constexpr std::size_t maxSparseHashes =
+      numRegisters / sizeof(uint64_t);
+
+  /// @brief add the hash of a value
+  void add(uint64_t hash);
+
+  /// @brief merge another sketch into this one
+  void merge(HyperLogLog const& other);
+
+  /// @brief estimated number of distinct values added so far
+  uint64_t estimate() const noexcept;
+
+  /// @brief reset the sketch to its initial, empty state
+  void clear() noexcept;
+
+  /// @brief serialize the sketch. sparse sketches are serialized as an array
+  /// of hashes, dense sketches as a string with one character per register
+  void toVelocyPack(velocypack::Builder& builder) const;
+
+  /// @brief merge a serialized sketch into this one. returns false if the
+  /// slice does not contain a valid serialized sketch
+  bool mergeVelocyPack(velocypack::Slice slice);
+
+  /// @brief whether or not the sketch is in dense mode
+  bool isDense() const noexcept { return !_registers.empty(); }
+
+ private:
+  void addToRegisters(uint64_t hash) noexcept;
+  void convertToDense();
+
+  /// @brief sorted hashes, only used in sparse mode
+  std::vector<uint64_t> _sparse;
+  /// @brief registers, only used in dense mode
+  std::vector<uint8_t> _registers;
+};
+
+}  // namespace aql
+}  // namespace arangodb
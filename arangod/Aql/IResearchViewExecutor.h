@@ -30,6 +30,7 @@
 #include "Aql/AqlFunctionsInternalCache.h"
 #include "Aql/RegisterInfos.h"
 #include "Aql/VarInfoMap.h"
+#include "Containers/FlatHashMap.h"
 #include "Containers/FlatHashSet.h"
 #include "IResearch/ExpressionFilter.h"
 #include "IResearch/IResearchFilterFactory.h"
@@ -47,7 +48,9 @@
 #include <formats/formats.hpp>
 #include <index/heap_iterator.hpp>
 #include <utils/empty.hpp>
+#include <velocypack/Builder.h>
 
+#include <optional>
 #include <utility>
 #include <variant>
 
@@ -72,12 +75,28 @@ template<BlockPassthrough>
 class SingleRowFetcher;
 class QueryContext;
 
+// numeric bounds of the SEARCH condition on the first primary sort field.
+// segments are sorted by the primary sort, so the first and the last
+// document of a segment carry its minimum and maximum sort value, which
+// allows skipping segments that cannot contain any matching document
+struct PrimarySortRange {
+  // empty builders mean that the range is unbounded on this side
+  velocypack::Builder min;
+  velocypack::Builder max;
+  bool minInclusive{true};
+  bool maxInclusive{true};
+  bool ascending{true};
+
+  // returns false only if no document of the segment can match the range
+  bool mayMatch(irs::SubReader const& segment) const;
+};
+
 class IResearchViewExecutorInfos {
  public:
   IResearchViewExecutorInfos(
       iresearch::ViewSnapshotPtr reader, RegisterId outRegister,
-      RegisterId searchDocRegister, std::vector<RegisterId> scoreRegisters,
-      aql::QueryContext& query,
+      RegisterId searchDocRegister, RegisterId facetCountRegister,
+      std::vector<RegisterId> scoreRegisters, aql::QueryContext& query,
 #ifdef USE_ENTERPRISE
       iresearch::IResearchOptimizeTopK const& optimizeTopK,
 #endif
@@ -91,11 +110,16 @@ class IResearchViewExecutorInfos {
           outNonMaterializedViewRegs,
       iresearch::CountApproximate, iresearch::FilterOptimization,
       std::vector<iresearch::HeapSortElement> const& heapSort,
-      size_t heapSortLimit, iresearch::SearchMeta const* meta);
+      size_t heapSortLimit, size_t parallelism,
+      std::optional<PrimarySortRange> primarySortRange,
+      iresearch::SearchMeta const* meta);
 
   auto getDocumentRegister() const noexcept -> RegisterId;
 
   RegisterId searchDocIdRegId() const noexcept { return _searchDocOutReg; }
+  // register for the number of documents per distinct stored value, only
+  // valid if the view node counts facets
+  RegisterId facetCountRegId() const noexcept { return _facetCountOutReg; }
   std::vector<RegisterId> const& getScoreRegisters() const noexcept;
 
   iresearch::IResearchViewNode::ViewValuesRegisters const&
@@ -140,10 +164,17 @@ class IResearchViewExecutorInfos {
 
   size_t scoreRegistersCount() const noexcept { return _scoreRegistersCount; }
 
+  size_t parallelism() const noexcept { return _parallelism; }
+
   auto const* meta() const noexcept { return _meta; }
 
+  std::optional<PrimarySortRange> const& primarySortRange() const noexcept {
+    return _primarySortRange;
+  }
+
  private:
   aql::RegisterId _searchDocOutReg;
+  aql::RegisterId _facetCountOutReg;
   aql::RegisterId _documentOutReg;
   std::vector<RegisterId> _scoreRegisters;
   size_t _scoreRegistersCount;
@@ -164,6 +195,8 @@ class IResearchViewExecutorInfos {
   iresearch::FilterOptimization _filterOptimization;
   std::vector<iresearch::HeapSortElement> const& _heapSort;
   size_t _heapSortLimit;
+  size_t _parallelism;
+  std::optional<PrimarySortRange> _primarySortRange;
   iresearch::SearchMeta const* _meta;
   int const _depth;
   bool _filterConditionIsEmpty;
@@ -418,6 +451,15 @@ class IndexReadBuffer {
     _storedValuesBuffer.emplace_back(value.data(), value.size());
   }
 
+  // appends `count` empty stored values, which can then be filled in any
+  // order via setStoredValue. returns the index of the first new value
+  size_t growStoredValues(size_t count) {
+    auto const offset = _storedValuesBuffer.size();
+    TRI_ASSERT(offset + count <= _storedValuesBuffer.capacity());
+    _storedValuesBuffer.resize(offset + count);
+    return offset;
+  }
+
   using StoredValuesContainer =
       typename std::conditional<copyStored, std::vector<irs::bstring>,
                                 std::vector<irs::bytes_view>>::type;
@@ -649,6 +691,13 @@ class IResearchViewExecutorBase {
 
   void pushStoredValues(irs::document const& doc, size_t storedValuesIndex = 0);
 
+  // same as pushStoredValues, but for a batch of documents with ascending ids
+  // from the same segment. the values are read column by column, so that
+  // every column iterator moves through its blocks in one go instead of
+  // alternating between the columns for every single document
+  void pushStoredValuesColumnwise(std::span<irs::doc_id_t const> docs,
+                                  size_t storedValuesIndex = 0);
+
   bool getStoredValuesReaders(irs::SubReader const& segmentReader,
                               size_t storedValuesIndex = 0);
 
@@ -709,6 +758,16 @@ class IResearchViewExecutor
 
   void reset(bool needFullCount);
 
+  // facets can only be counted if nothing but stored values is produced
+  static constexpr bool kCanCountFacets =
+      Base::usesStoredValues && !Base::isMaterialized &&
+      !Base::isLateMaterialized && !ExecutionTraits::Ordered &&
+      !ExecutionTraits::EmitSearchDoc;
+
+  // counts the matching documents per distinct stored value and buffers one
+  // row per value instead of one row per document
+  bool fillFacetBuffer(size_t atMost);
+
  private:
   // Returns true unless the iterator is exhausted. documentId will always be
   // written. It will always be unset when readPK returns false, but may also be
@@ -721,7 +780,22 @@ class IResearchViewExecutor
   size_t _readerOffset;
   size_t _currentSegmentPos;  // current document iterator position in segment
   size_t _totalPos;           // total position for full snapshot
+  // per segment result of PrimarySortRange::mayMatch, computed lazily.
+  // 0 - not computed yet, 1 - may match, 2 - skip the segment
+  std::vector<uint8_t> _segmentMayMatch;
   LogicalCollection const* _collection{};
+  // documents in the buffer whose stored values still need to be read
+  std::vector<irs::doc_id_t> _storedValuesDocs;
+
+  struct Facet {
+    StorageSnapshot const* snapshot;
+    irs::bstring storedValue;
+    uint64_t count;
+  };
+  // distinct stored values of the current batch with their counts
+  std::vector<Facet> _facets;
+  // maps the serialized value to its index in _facets
+  containers::FlatHashMap<std::string, size_t> _facetIndex;
 
   // case ordered only:
   irs::score const* _scr;
@@ -857,6 +931,11 @@ class IResearchViewHeapSortExecutor
   void reset(bool needFullCount);
   bool fillBuffer(ReadContext& ctx);
   bool fillBufferInternal(size_t skip);
+  auto columnProvider(size_t readerOffset);
+  // evaluates the segments on multiple threads if the view node's
+  // `parallelism` option is set and the sort only consists of scores
+  bool canFillBufferInParallel() const;
+  void fillBufferParallel(size_t atMost);
 
   bool writeRow(ReadContext& ctx, IndexReadBufferEntry bufferEntry);
 
@@ -32,7 +32,10 @@
 #include "Aql/Query.h"
 #include "Aql/SingleRowFetcher.h"
 #include "ApplicationFeatures/ApplicationServer.h"
+#include "Basics/NumberOfCores.h"
+#include "Basics/ResourceUsage.h"
 #include "Basics/StringUtils.h"
+#include "Basics/VelocyPackHelper.h"
 #include "IResearch/IResearchCommon.h"
 #include "IResearch/IResearchDocument.h"
 #include "IResearch/IResearchFilterFactory.h"
@@ -52,6 +55,11 @@
 #include <search/boolean_filter.hpp>
 #include <search/score.hpp>
 #include <search/cost.hpp>
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <mutex>
+#include <thread>
 #include <utility>
 
 // TODO Eliminate access to the plan if possible!
@@ -178,19 +186,25 @@ class BufferHeapSortContext {
   std::span<HeapSortType const> _heapSort;
 };
 
-velocypack::Slice getStoredValue(irs::bytes_view storedValue,
-                                 HeapSortElement const& sort) {
-  TRI_ASSERT(!sort.isScore());
+velocypack::Slice getStoredField(irs::bytes_view storedValue,
+                                 size_t fieldNumber) {
   TRI_ASSERT(!storedValue.empty());
   auto* start = storedValue.data();
   [[maybe_unused]] auto* end = start + storedValue.size();
   velocypack::Slice slice{start};
-  for (size_t i = 0; i != sort.fieldNumber; ++i) {
+  for (size_t i = 0; i != fieldNumber; ++i) {
     start += slice.byteSize();
     TRI_ASSERT(start < end);
     slice = velocypack::Slice{start};
   }
   TRI_ASSERT(!slice.isNone());
+  return slice;
+}
+
+velocypack::Slice getStoredValue(irs::bytes_view storedValue,
+                                 HeapSortElement const& sort) {
+  TRI_ASSERT(!sort.isScore());
+  auto const slice = getStoredField(storedValue, sort.fieldNumber);
   if (sort.postfix.empty()) {
     return slice;
   }
@@ -205,8 +219,8 @@ velocypack::Slice getStoredValue(irs::bytes_view storedValue,
 
 IResearchViewExecutorInfos::IResearchViewExecutorInfos(
     ViewSnapshotPtr reader, RegisterId outRegister,
-    RegisterId searchDocRegister, std::vector<RegisterId> scoreRegisters,
-    arangodb::aql::QueryContext& query,
+    RegisterId searchDocRegister, RegisterId facetCountRegister,
+    std::vector<RegisterId> scoreRegisters, arangodb::aql::QueryContext& query,
 #ifdef USE_ENTERPRISE
     iresearch::IResearchOptimizeTopK const& optimizeTopK,
 #endif
@@ -220,8 +234,10 @@ IResearchViewExecutorInfos::IResearchViewExecutorInfos(
     iresearch::CountApproximate countApproximate,
     iresearch::FilterOptimization filterOptimization,
     std::vector<HeapSortElement> const& heapSort, size_t heapSortLimit,
+    size_t parallelism, std::optional<PrimarySortRange> primarySortRange,
     iresearch::SearchMeta const* meta)
     : _searchDocOutReg{searchDocRegister},
+      _facetCountOutReg{facetCountRegister},
       _documentOutReg{outRegister},
       _scoreRegisters{std::move(scoreRegisters)},
       _scoreRegistersCount{_scoreRegisters.size()},
@@ -242,6 +258,8 @@ IResearchViewExecutorInfos::IResearchViewExecutorInfos(
       _filterOptimization{filterOptimization},
       _heapSort{heapSort},
       _heapSortLimit{heapSortLimit},
+      _parallelism{parallelism},
+      _primarySortRange{std::move(primarySortRange)},
       _meta{meta},
       _depth{depth},
       _filterConditionIsEmpty{isFilterConditionEmpty(&_filterCondition) &&
@@ -321,6 +339,56 @@ auto IResearchViewExecutorInfos::getDocumentRegister() const noexcept
   return _documentOutReg;
 }
 
+bool PrimarySortRange::mayMatch(irs::SubReader const& segment) const {
+  auto const docsCount = segment.docs_count();
+  if (docsCount == 0) {
+    return false;
+  }
+  auto itr = ::sortColumn(segment);
+  if (!itr) {
+    return true;
+  }
+  auto const* value = irs::get<irs::payload>(*itr);
+  if (!value) {
+    return true;
+  }
+  // the first field of the sort value of the given document
+  auto readFirstField = [&](irs::doc_id_t doc, VPackBuilder& out) {
+    if (itr->seek(doc) != doc || value->value.empty()) {
+      return false;
+    }
+    out.add(VPackSlice{value->value.data()});
+    return true;
+  };
+  VPackBuilder first;
+  VPackBuilder last;
+  // documents are sorted by the primary sort, so the first and the last
+  // document hold the extreme values of the segment
+  if (!readFirstField(irs::doc_limits::min(), first) ||
+      !readFirstField(irs::doc_limits::min() + docsCount - 1, last)) {
+    return true;
+  }
+  auto const lo = ascending ? first.slice() : last.slice();
+  auto const hi = ascending ? last.slice() : first.slice();
+  if (!max.isEmpty()) {
+    // arrays sort after all numbers but may contain matching elements, so
+    // the segment can only be skipped if it holds no arrays and objects
+    if (!lo.isArray() && !lo.isObject() && !hi.isArray() && !hi.isObject()) {
+      auto const r = VelocyPackHelper::compare(lo, max.slice(), true);
+      if (r > 0 || (r == 0 && !maxInclusive)) {
+        return false;
+      }
+    }
+  }
+  if (!min.isEmpty()) {
+    auto const r = VelocyPackHelper::compare(hi, min.slice(), true);
+    if (r < 0 || (r == 0 && !minInclusive)) {
+      return false;
+    }
+  }
+  return true;
+}
+
 IResearchViewStats::IResearchViewStats() noexcept : _scannedIndex(0) {}
 void IResearchViewStats::incrScanned() noexcept { _scannedIndex++; }
 void IResearchViewStats::incrScanned(size_t value) noexcept {
@@ -593,6 +661,12 @@ void IndexReadBuffer<ValueType, copySorted>::pushSortedValue(
       HeapSortContext sortContext(_heapSortValues, _heapSort);
       _storedValuesBuffer.resize(_keyBuffer.size() * _storedValuesCount);
       std::make_heap(_rows.begin(), _rows.end(), sortContext);
+      // the heap is full now, so the score of its weakest entry is already a
+      // valid lower bound. publish it right away, so that the iterator can
+      // start skipping non-competitive documents with the next document
+      // instead of only after the first replacement in the heap
+      threshold = _scoreBuffer[_rows.front() * _numScoreRegisters];
+      score.Min(threshold);
     }
   }
 }
@@ -1079,6 +1153,33 @@ void IResearchViewExecutorBase<Impl, ExecutionTraits>::pushStoredValues(
   }
 }
 
+template<typename Impl, typename ExecutionTraits>
+void IResearchViewExecutorBase<Impl, ExecutionTraits>::
+    pushStoredValuesColumnwise(std::span<irs::doc_id_t const> docs,
+                               size_t storedValuesIndex /*= 0*/) {
+  auto const numColumns = _infos.getOutNonMaterializedViewRegs().size();
+  TRI_ASSERT(numColumns != 0);
+  TRI_ASSERT(std::is_sorted(docs.begin(), docs.end()));
+  auto const offset =
+      _indexReadBuffer.growStoredValues(docs.size() * numColumns);
+  auto const nullValue = ref<irs::byte_type>(VPackSlice::nullSlice());
+  for (size_t column = 0; column < numColumns; ++column) {
+    auto const readerIndex = storedValuesIndex * numColumns + column;
+    TRI_ASSERT(readerIndex < _storedValuesReaders.size());
+    auto const& reader = _storedValuesReaders[readerIndex];
+    TRI_ASSERT(reader.itr);
+    TRI_ASSERT(reader.value);
+    auto const& payload = reader.value->value;
+    auto index = offset + column;
+    for (auto const doc : docs) {
+      bool const found = (doc == reader.itr->seek(doc));
+      _indexReadBuffer.setStoredValue(
+          index, found && !payload.empty() ? payload : nullValue);
+      index += numColumns;
+    }
+  }
+}
+
 template<typename Impl, typename ExecutionTraits>
 bool IResearchViewExecutorBase<Impl, ExecutionTraits>::getStoredValuesReaders(
     irs::SubReader const& segmentReader, size_t storedValuesIndex /*= 0*/) {
@@ -1292,6 +1393,204 @@ bool IResearchViewHeapSortExecutor<ExecutionTraits>::fillBuffer(
   return !this->_indexReadBuffer.empty();
 }
 
+template<typename ExecutionTraits>
+auto IResearchViewHeapSortExecutor<ExecutionTraits>::columnProvider(
+    size_t readerOffset) {
+  return [this, readerOffset](ptrdiff_t column) {
+    auto& segmentReader = (*this->_reader)[readerOffset];
+    ColumnIterator it;
+    if (IResearchViewNode::kSortColumnNumber == column) {
+      auto sortReader = ::sortColumn(segmentReader);
+      if (ADB_LIKELY(sortReader)) {
+        ::reset(it, std::move(sortReader));
+      }
+    } else {
+      auto const& columns = this->_infos.storedValues().columns();
+      auto const* storedValuesReader =
+          segmentReader.column(columns[column].name);
+      if (ADB_LIKELY(storedValuesReader)) {
+        ::reset(it, storedValuesReader->iterator(irs::ColumnHint::kNormal));
+      }
+    }
+    return it;
+  };
+}
+
+template<typename ExecutionTraits>
+bool IResearchViewHeapSortExecutor<ExecutionTraits>::canFillBufferInParallel()
+    const {
+  if constexpr (!ExecutionTraits::Ordered) {
+    return false;
+  } else {
+    if (this->_infos.parallelism() < 2 || this->_reader->size() < 2) {
+      return false;
+    }
+    // documents are iterated on other threads. deterministic expressions in
+    // the filter are evaluated once when an iterator is created, which still
+    // happens on the query's thread. non-deterministic ones are evaluated for
+    // every document and therefore rule out parallel iteration
+    if (!this->_infos.filterCondition().isDeterministic()) {
+      return false;
+    }
+    // sorting by stored values needs column reads for every candidate,
+    // which only the index read buffer can do
+    auto const heapSort = this->_infos.heapSort();
+    return std::all_of(heapSort.begin(), heapSort.end(),
+                       [](auto const& cmp) { return cmp.isScore(); });
+  }
+}
+
+template<typename ExecutionTraits>
+void IResearchViewHeapSortExecutor<ExecutionTraits>::fillBufferParallel(
+    size_t atMost) {
+  struct Candidate {
+    irs::doc_id_t doc;
+    containers::SmallVector<irs::score_t, 4> scores;
+  };
+  struct Segment {
+    irs::doc_iterator::ptr itr;
+    irs::document const* doc{};
+    irs::score* score{};
+    // best candidates of the segment, worst candidate first
+    std::vector<Candidate> candidates;
+    size_t matches{0};
+  };
+
+  auto const heapSort = this->_infos.heapSort();
+  TRI_ASSERT(!heapSort.empty());
+  size_t const numScores = this->infos().scorers().size();
+  size_t const count = this->_reader->size();
+  auto const better = [heapSort](Candidate const& lhs, Candidate const& rhs) {
+    for (auto const& cmp : heapSort) {
+      TRI_ASSERT(cmp.isScore());
+      auto const l = lhs.scores[cmp.source];
+      auto const r = rhs.scores[cmp.source];
+      if (l != r) {
+        return cmp.ascending ? l < r : l > r;
+      }
+    }
+    return false;
+  };
+  bool const descScore = !heapSort.front().ascending;
+
+  // every segment keeps up to `atMost` candidates until they are merged
+  ResourceUsageScope guard(this->_infos.getQuery().resourceMonitor());
+  size_t const candidateSize =
+      sizeof(Candidate) + numScores * sizeof(irs::score_t);
+
+  // filters may evaluate expressions while preparing their iterators, so the
+  // iterators are created here, on the query's thread
+  std::vector<Segment> segments(count);
+  for (size_t readerOffset = 0; readerOffset < count; ++readerOffset) {
+    auto& segment = segments[readerOffset];
+    auto& segmentReader = (*this->_reader)[readerOffset];
+    auto const maxCandidates =
+        std::min<size_t>(atMost, segmentReader.docs_count());
+    guard.increase(maxCandidates * candidateSize);
+    segment.candidates.reserve(maxCandidates);
+    auto itr = this->_filter->execute({
+        .segment = segmentReader,
+        .scorers = this->_scorers,
+        .ctx = &this->_filterCtx,
+        .wand = this->_wand,
+    });
+    TRI_ASSERT(itr);
+    segment.doc = irs::get<irs::document>(*itr);
+    TRI_ASSERT(segment.doc);
+    segment.score = irs::get_mutable<irs::score>(itr.get());
+    segment.itr = segmentReader.mask(std::move(itr));
+    TRI_ASSERT(segment.itr);
+  }
+
+  std::atomic<size_t> nextSegment{0};
+  std::exception_ptr error;
+  std::mutex errorMutex;
+  auto work = [&]() noexcept {
+    try {
+      for (size_t i = nextSegment.fetch_add(1); i < count;
+           i = nextSegment.fetch_add(1)) {
+        auto& segment = segments[i];
+        auto& heap = segment.candidates;
+        while (segment.itr->next()) {
+          ++segment.matches;
+          Candidate candidate{.doc = segment.doc->value, .scores = {}};
+          candidate.scores.resize(numScores);
+          if (segment.score != nullptr) {
+            (*segment.score)(candidate.scores.data());
+          }
+          if (heap.size() < atMost) {
+            heap.emplace_back(std::move(candidate));
+            std::push_heap(heap.begin(), heap.end(), better);
+          } else if (better(candidate, heap.front())) {
+            std::pop_heap(heap.begin(), heap.end(), better);
+            heap.back() = std::move(candidate);
+            std::push_heap(heap.begin(), heap.end(), better);
+          } else {
+            continue;
+          }
+          if (descScore && segment.score != nullptr && heap.size() == atMost) {
+            segment.score->Min(heap.front().scores[heapSort.front().source]);
+          }
+        }
+        segment.itr.reset();
+      }
+    } catch (...) {
+      // stop all other workers as soon as possible
+      nextSegment.store(count);
+      std::lock_guard lock{errorMutex};
+      if (!error) {
+        error = std::current_exception();
+      }
+    }
+  };
+
+  size_t const numThreads =
+      std::min({this->_infos.parallelism(), count,
+                static_cast<size_t>(NumberOfCores::getValue())});
+  std::vector<std::thread> threads;
+  try {
+    threads.reserve(numThreads - 1);
+    for (size_t i = 1; i < numThreads; ++i) {
+      threads.emplace_back(work);
+    }
+  } catch (...) {
+    // continue with the threads we were able to start
+  }
+  work();
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  if (error) {
+    std::rethrow_exception(error);
+  }
+
+  // merge the per-segment results, which needs column access for the
+  // stored values and thus happens on the query's thread again
+  irs::score_t threshold = 0.f;
+  auto& noScore = const_cast<irs::score&>(irs::score::kNoScore);
+  for (size_t readerOffset = 0; readerOffset < count; ++readerOffset) {
+    auto& segment = segments[readerOffset];
+    _totalCount += segment.matches;
+    auto& candidates = segment.candidates;
+    // column iterators can only move forward
+    std::sort(candidates.begin(), candidates.end(),
+              [](Candidate const& lhs, Candidate const& rhs) {
+                return lhs.doc < rhs.doc;
+              });
+    auto provider = columnProvider(readerOffset);
+    size_t const segmentScores = segment.score != nullptr ? numScores : 0;
+    for (auto& candidate : candidates) {
+      this->_indexReadBuffer.pushSortedValue(
+          provider, this->_reader->snapshot(readerOffset),
+          typename decltype(this->_indexReadBuffer)::KeyValueType(
+              candidate.doc, readerOffset),
+          std::span{candidate.scores.data(), segmentScores}, noScore,
+          threshold);
+    }
+    candidates = {};
+  }
+}
+
 template<typename ExecutionTraits>
 bool IResearchViewHeapSortExecutor<ExecutionTraits>::fillBufferInternal(
     size_t skip) {
@@ -1315,6 +1614,13 @@ bool IResearchViewHeapSortExecutor<ExecutionTraits>::fillBufferInternal(
     }
   }
 
+  size_t firstReaderOffset = 0;
+  if (canFillBufferInParallel()) {
+    fillBufferParallel(atMost);
+    // all segments have been consumed already
+    firstReaderOffset = count;
+  }
+
   containers::SmallVector<irs::score_t, 4> scores;
   if constexpr (ExecutionTraits::Ordered) {
     scores.resize(this->infos().scorers().size());
@@ -1325,7 +1631,7 @@ bool IResearchViewHeapSortExecutor<ExecutionTraits>::fillBufferInternal(
   irs::score* scr = const_cast<irs::score*>(&irs::score::kNoScore);
   size_t numScores{0};
   irs::score_t threshold = 0.f;
-  for (size_t readerOffset = 0; readerOffset < count;) {
+  for (size_t readerOffset = firstReaderOffset; readerOffset < count;) {
     if (!itr) {
       auto& segmentReader = (*this->_reader)[readerOffset];
       itr = this->_filter->execute({
@@ -1359,24 +1665,7 @@ bool IResearchViewHeapSortExecutor<ExecutionTraits>::fillBufferInternal(
     ++_totalCount;
 
     (*scr)(scores.data());
-    auto provider = [this, readerOffset](ptrdiff_t column) {
-      auto& segmentReader = (*this->_reader)[readerOffset];
-      ColumnIterator it;
-      if (IResearchViewNode::kSortColumnNumber == column) {
-        auto sortReader = ::sortColumn(segmentReader);
-        if (ADB_LIKELY(sortReader)) {
-          ::reset(it, std::move(sortReader));
-        }
-      } else {
-        auto const& columns = this->_infos.storedValues().columns();
-        auto const* storedValuesReader =
-            segmentReader.column(columns[column].name);
-        if (ADB_LIKELY(storedValuesReader)) {
-          ::reset(it, storedValuesReader->iterator(irs::ColumnHint::kNormal));
-        }
-      }
-      return it;
-    };
+    auto provider = columnProvider(readerOffset);
     this->_indexReadBuffer.pushSortedValue(
         provider, this->_reader->snapshot(readerOffset),
         typename decltype(this->_indexReadBuffer)::KeyValueType(doc->value,
@@ -1499,8 +1788,14 @@ bool IResearchViewExecutor<ExecutionTraits>::fillBuffer(
   this->_indexReadBuffer.preAllocateStoredValuesBuffer(
       atMost, this->_infos.getScoreRegisters().size(),
       this->_infos.getOutNonMaterializedViewRegs().size());
+  if constexpr (kCanCountFacets) {
+    if (this->_infos.facetCountRegId().isValid()) {
+      return fillFacetBuffer(atMost);
+    }
+  }
   size_t const count = this->_reader->size();
   bool gotData{false};
+  _storedValuesDocs.clear();
   auto reset = [&] {
     ++_readerOffset;
     _currentSegmentPos = 0;
@@ -1582,7 +1877,8 @@ bool IResearchViewExecutor<ExecutionTraits>::fillBuffer(
 
     if constexpr (Base::usesStoredValues) {
       TRI_ASSERT(_doc);
-      this->pushStoredValues(*_doc);
+      // stored values are read for all buffered documents at once below
+      _storedValuesDocs.push_back(_doc->value);
     }
     // doc and scores are both pushed, sizes must now be coherent
     this->_indexReadBuffer.assertSizeCoherence();
@@ -1599,9 +1895,71 @@ bool IResearchViewExecutor<ExecutionTraits>::fillBuffer(
       break;
     }
   }
+  if constexpr (Base::usesStoredValues) {
+    // all buffered documents are from the same segment, so the stored values
+    // readers are still positioned on it
+    if (!_storedValuesDocs.empty()) {
+      this->pushStoredValuesColumnwise(_storedValuesDocs);
+      _storedValuesDocs.clear();
+    }
+  }
   return gotData;
 }
 
+template<typename ExecutionTraits>
+bool IResearchViewExecutor<ExecutionTraits>::fillFacetBuffer(size_t atMost) {
+  auto const& columnsFieldsRegs = this->_infos.getOutNonMaterializedViewRegs();
+  TRI_ASSERT(columnsFieldsRegs.size() == 1);
+  TRI_ASSERT(columnsFieldsRegs.begin()->second.size() == 1);
+  auto const fieldNumber = columnsFieldsRegs.begin()->second.begin()->first;
+  auto const nullValue = ref<irs::byte_type>(VPackSlice::nullSlice());
+  size_t const count = this->_reader->size();
+  _facets.clear();
+  _facetIndex.clear();
+  // the counts are partial: the same value may show up again in later
+  // batches, which is fine as the following COLLECT sums up the counts
+  while (_readerOffset < count && _facets.size() < atMost) {
+    if (!_itr && !resetIterator()) {
+      ++_readerOffset;
+      _currentSegmentPos = 0;
+      continue;
+    }
+    auto const& snapshot = this->_reader->snapshot(_readerOffset);
+    auto const& reader = this->_storedValuesReaders[0];
+    TRI_ASSERT(reader.itr);
+    TRI_ASSERT(reader.value);
+    auto const& payload = reader.value->value;
+    LocalDocumentId documentId;
+    while (_facets.size() < atMost) {
+      if (!readPK(documentId)) {
+        ++_readerOffset;
+        _currentSegmentPos = 0;
+        _itr.reset();
+        _doc = nullptr;
+        break;
+      }
+      bool const found = (_doc->value == reader.itr->seek(_doc->value));
+      irs::bytes_view const storedValue =
+          found && !payload.empty() ? payload : nullValue;
+      auto const field = getStoredField(storedValue, fieldNumber);
+      std::string_view const key{field.startAs<char>(), field.byteSize()};
+      auto it = _facetIndex.find(key);
+      if (it == _facetIndex.end()) {
+        it = _facetIndex.emplace(key, _facets.size()).first;
+        _facets.push_back(Facet{&snapshot, irs::bstring{storedValue}, 0});
+      }
+      ++_facets[it->second].count;
+    }
+  }
+  // the stored values buffer references the values kept in _facets, so
+  // _facets must not be modified until the buffer is consumed
+  for (auto const& facet : _facets) {
+    this->_indexReadBuffer.pushValue(*facet.snapshot, LocalDocumentId{});
+    this->_indexReadBuffer.pushStoredValue(facet.storedValue);
+  }
+  return !_facets.empty();
+}
+
 template<typename ExecutionTraits>
 bool IResearchViewExecutor<ExecutionTraits>::resetIterator() {
   TRI_ASSERT(this->_filter);
@@ -1609,6 +1967,20 @@ bool IResearchViewExecutor<ExecutionTraits>::resetIterator() {
 
   auto& segmentReader = (*this->_reader)[_readerOffset];
 
+  if (auto const& range = this->infos().primarySortRange(); range) {
+    // the bounds are constant, so the check is done once per segment
+    if (_segmentMayMatch.empty()) {
+      _segmentMayMatch.resize(this->_reader->size(), 0);
+    }
+    auto& mayMatch = _segmentMayMatch[_readerOffset];
+    if (mayMatch == 0) {
+      mayMatch = range->mayMatch(segmentReader) ? 1 : 2;
+    }
+    if (mayMatch == 2) {
+      return false;
+    }
+  }
+
   if constexpr (Base::isMaterialized) {
     auto it = ::pkColumn(segmentReader);
 
@@ -1746,7 +2118,19 @@ template<typename ExecutionTraits>
 bool IResearchViewExecutor<ExecutionTraits>::writeRow(
     IResearchViewExecutor::ReadContext& ctx, IndexReadBufferEntry bufferEntry) {
   auto const& val = this->_indexReadBuffer.getValue(bufferEntry);
-  return Base::writeRow(ctx, bufferEntry, val, _collection);
+  if (!Base::writeRow(ctx, bufferEntry, val, _collection)) {
+    return false;
+  }
+  if constexpr (kCanCountFacets) {
+    auto const reg = this->_infos.facetCountRegId();
+    if (reg.isValid()) {
+      TRI_ASSERT(bufferEntry.getKeyIdx() < _facets.size());
+      auto const value =
+          AqlValueHintUInt{_facets[bufferEntry.getKeyIdx()].count};
+      ctx.outputRow.moveValueInto(reg, ctx.inputRow, value);
+    }
+  }
+  return true;
 }
 
 template<typename ExecutionTraits>
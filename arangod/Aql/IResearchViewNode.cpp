@@ -42,6 +42,7 @@
 #include "Aql/types.h"
 #include "Basics/NumberUtils.h"
 #include "Basics/StringUtils.h"
+#include "Basics/VelocyPackHelper.h"
 #include "Cluster/ClusterFeature.h"
 #include "Cluster/ClusterInfo.h"
 #include "Containers/FlatHashSet.h"
@@ -183,6 +184,10 @@ void toVelocyPack(velocypack::Builder& builder,
     builder.add("filterOptimization",
                 VPackValue(static_cast<int64_t>(options.filterOptimization)));
   }
+
+  if (options.parallelism != 1) {
+    builder.add("parallelism", VPackValue(options.parallelism));
+  }
 }
 
 bool fromVelocyPack(velocypack::Slice optionsSlice,
@@ -274,6 +279,16 @@ bool fromVelocyPack(velocypack::Slice optionsSlice,
           filterOptimizationSlice.getNumber<int>());
     }
   }
+  {  // parallelism
+    auto const parallelismSlice = optionsSlice.get("parallelism");
+    if (!parallelismSlice.isNone()) {  // 'parallelism' is optional
+      if (!parallelismSlice.isNumber<size_t>() ||
+          parallelismSlice.getNumber<size_t>() == 0) {
+        return false;
+      }
+      options.parallelism = parallelismSlice.getNumber<size_t>();
+    }
+  }
   return true;
 }
 
@@ -424,6 +439,18 @@ constexpr auto kHandlers = frozen::make_map<std::string_view, OptionHandler>(
         options.filterOptimization =
             static_cast<iresearch::FilterOptimization>(value.getIntValue());
         return true;
+      }},
+     {"parallelism",
+      [](aql::QueryContext& /*query*/, LogicalView const& /*view*/,
+         aql::AstNode const& value, IResearchViewNode::Options& options,
+         std::string& error) {
+        if (!value.isValueType(aql::VALUE_TYPE_INT) ||
+            value.getIntValue() < 1) {
+          error = "positive int value expected for option 'parallelism'";
+          return false;
+        }
+        options.parallelism = static_cast<size_t>(value.getIntValue());
+        return true;
       }}});
 
 bool parseOptions(aql::QueryContext& query, LogicalView const& view,
@@ -756,6 +783,93 @@ IResearchSortBase const& primarySort(
   return viewImpl.primarySort();
 }
 
+// collect the numeric bounds for the first primary sort field from the
+// top-level conjunction of the SEARCH condition. all other parts of the
+// condition are ignored, as they can only narrow down the result further
+std::optional<aql::PrimarySortRange> primarySortRange(
+    aql::AstNode const& filterCondition, aql::Variable const& outVariable,
+    IResearchSortBase const& sort) {
+  if (sort.empty()) {
+    return std::nullopt;
+  }
+  auto const* root = &filterCondition;
+  if (root->type == aql::NODE_TYPE_OPERATOR_NARY_OR) {
+    if (root->numMembers() != 1) {
+      return std::nullopt;
+    }
+    root = root->getMemberUnchecked(0);
+  }
+  size_t const numMembers =
+      root->type == aql::NODE_TYPE_OPERATOR_NARY_AND ? root->numMembers() : 1;
+
+  aql::PrimarySortRange range;
+  range.ascending = sort.direction(0);
+  auto setBound = [](velocypack::Builder& bound, bool& boundInclusive,
+                     aql::AstNode const& value, bool inclusive,
+                     bool isLower) {
+    velocypack::Builder candidate;
+    value.toVelocyPackValue(candidate);
+    if (!bound.isEmpty()) {
+      // keep the tighter of both bounds
+      auto const r = basics::VelocyPackHelper::compare(
+          candidate.slice(), bound.slice(), true);
+      if ((isLower ? r < 0 : r > 0) || (r == 0 && inclusive)) {
+        return;
+      }
+    }
+    bound = std::move(candidate);
+    boundInclusive = inclusive;
+  };
+
+  bool found = false;
+  for (size_t i = 0; i < numMembers; ++i) {
+    auto const* member = root->type == aql::NODE_TYPE_OPERATOR_NARY_AND
+                             ? root->getMemberUnchecked(i)
+                             : root;
+    auto type = member->type;
+    if (type != aql::NODE_TYPE_OPERATOR_BINARY_EQ &&
+        type != aql::NODE_TYPE_OPERATOR_BINARY_LT &&
+        type != aql::NODE_TYPE_OPERATOR_BINARY_LE &&
+        type != aql::NODE_TYPE_OPERATOR_BINARY_GT &&
+        type != aql::NODE_TYPE_OPERATOR_BINARY_GE) {
+      continue;
+    }
+    auto const* attribute = member->getMemberUnchecked(0);
+    auto const* value = member->getMemberUnchecked(1);
+    if (!value->isNumericValue()) {
+      // `5 < doc.a` is the same as `doc.a > 5`
+      std::swap(attribute, value);
+      type = aql::Ast::ReverseOperator(type);
+    }
+    std::pair<aql::Variable const*, std::vector<basics::AttributeName>>
+        access;
+    if (!value->isNumericValue() ||
+        !attribute->isAttributeAccessForVariable(access, false) ||
+        access.first != &outVariable ||
+        !basics::AttributeName::isIdentical(access.second, sort.field(0),
+                                            false)) {
+      continue;
+    }
+    found = true;
+    if (type == aql::NODE_TYPE_OPERATOR_BINARY_EQ ||
+        type == aql::NODE_TYPE_OPERATOR_BINARY_GT ||
+        type == aql::NODE_TYPE_OPERATOR_BINARY_GE) {
+      setBound(range.min, range.minInclusive, *value,
+               type != aql::NODE_TYPE_OPERATOR_BINARY_GT, true);
+    }
+    if (type == aql::NODE_TYPE_OPERATOR_BINARY_EQ ||
+        type == aql::NODE_TYPE_OPERATOR_BINARY_LT ||
+        type == aql::NODE_TYPE_OPERATOR_BINARY_LE) {
+      setBound(range.max, range.maxInclusive, *value,
+               type != aql::NODE_TYPE_OPERATOR_BINARY_LT, false);
+    }
+  }
+  if (!found) {
+    return std::nullopt;
+  }
+  return range;
+}
+
 IResearchViewStoredValues const& storedValues(
     std::shared_ptr<SearchMeta const> const& meta,
     std::shared_ptr<LogicalView const> const& view) {
@@ -779,6 +893,7 @@ char const* kNodeViewIdParam = "viewId";
 char const* kNodeOutVariableParam = "outVariable";
 char const* kNodeOutSearchDocParam = "outSearchDocId";
 char const* kNodeOutNmDocParam = "outNmDocId";
+char const* kNodeOutFacetCountParam = "outFacetCount";
 char const* kNodeConditionParam = "condition";
 char const* kNodeScorersParam = "scorers";
 char const* kNodeShardsParam = "shards";
@@ -1154,6 +1269,8 @@ IResearchViewNode::IResearchViewNode(aql::ExecutionPlan& plan,
                                                kNodeOutVariableParam)},
       _outNonMaterializedDocId{aql::Variable::varFromVPack(
           plan.getAst(), base, kNodeOutNmDocParam, true)},
+      _outFacetCount{aql::Variable::varFromVPack(
+          plan.getAst(), base, kNodeOutFacetCountParam, true)},
       // in case if filter is not specified
       // set it to surrogate 'RETURN ALL' node
       _filterCondition{&kAll},
@@ -1526,6 +1643,11 @@ void IResearchViewNode::doToVelocyPack(VPackBuilder& nodes,
     _outNonMaterializedDocId->toVelocyPack(nodes);
   }
 
+  if (_outFacetCount != nullptr) {
+    nodes.add(VPackValue(kNodeOutFacetCountParam));
+    _outFacetCount->toVelocyPack(nodes);
+  }
+
   if (_noMaterialization) {
     nodes.add(kNodeViewNoMaterialization, VPackValue(_noMaterialization));
   }
@@ -1666,6 +1788,7 @@ aql::ExecutionNode* IResearchViewNode::clone(aql::ExecutionPlan* plan,
   auto* outVariable = _outVariable;
   auto* outSearchDocId = _outSearchDocId;
   auto* outNonMaterializedDocId = _outNonMaterializedDocId;
+  auto* outFacetCount = _outFacetCount;
   auto outNonMaterializedViewVars = _outNonMaterializedViewVars;
 
   if (withProperties) {
@@ -1678,6 +1801,9 @@ aql::ExecutionNode* IResearchViewNode::clone(aql::ExecutionPlan* plan,
     if (outNonMaterializedDocId != nullptr) {
       outNonMaterializedDocId = vars->createVariable(outNonMaterializedDocId);
     }
+    if (outFacetCount != nullptr) {
+      outFacetCount = vars->createVariable(outFacetCount);
+    }
     for (auto& columnFieldsVars : outNonMaterializedViewVars) {
       for (auto& fieldVar : columnFieldsVars.second) {
         fieldVar.var = vars->createVariable(fieldVar.var);
@@ -1700,6 +1826,9 @@ aql::ExecutionNode* IResearchViewNode::clone(aql::ExecutionPlan* plan,
   if (outNonMaterializedDocId != nullptr) {
     node->setLateMaterialized(*outNonMaterializedDocId);
   }
+  if (outFacetCount != nullptr) {
+    node->setFacetCountVar(*outFacetCount);
+  }
   node->_noMaterialization = _noMaterialization;
   node->_outNonMaterializedViewVars = std::move(outNonMaterializedViewVars);
   node->_heapSort = _heapSort;
@@ -1812,6 +1941,9 @@ std::vector<aql::Variable const*> IResearchViewNode::getVariablesSetHere()
   if (searchDocIdVar()) {
     ++reserve;
   }
+  if (facetCountVar()) {
+    ++reserve;
+  }
   vars.reserve(reserve);
 
   std::transform(_scorers.cbegin(), _scorers.cend(), std::back_inserter(vars),
@@ -1831,6 +1963,9 @@ std::vector<aql::Variable const*> IResearchViewNode::getVariablesSetHere()
   if (searchDocIdVar()) {
     vars.emplace_back(_outSearchDocId);
   }
+  if (facetCountVar()) {
+    vars.emplace_back(_outFacetCount);
+  }
   return vars;
 }
 
@@ -1962,7 +2097,7 @@ std::unique_ptr<aql::ExecutionBlock> IResearchViewNode::createBlock(
     // registers. There may be unused registers reserved for later blocks.
     aql::RegIdSet writableOutputRegisters;
     writableOutputRegisters.reserve(numDocumentRegs + numScoreRegisters +
-                                    numViewVarsRegisters);
+                                    numViewVarsRegisters + 1);
 
     aql::RegisterId searchDocRegId{aql::RegisterId::makeInvalid()};
     if (_outSearchDocId != nullptr) {
@@ -1970,6 +2105,14 @@ std::unique_ptr<aql::ExecutionBlock> IResearchViewNode::createBlock(
       writableOutputRegisters.emplace(searchDocRegId);
     }
 
+    aql::RegisterId facetCountRegId{aql::RegisterId::makeInvalid()};
+    if (_outFacetCount != nullptr) {
+      TRI_ASSERT(isNoMaterialization());
+      TRI_ASSERT(numViewVarsRegisters == 1);
+      facetCountRegId = variableToRegisterId(_outFacetCount);
+      writableOutputRegisters.emplace(facetCountRegId);
+    }
+
     auto const outRegister = std::invoke([&]() -> aql::RegisterId {
       if (isLateMaterialized()) {
         aql::RegisterId documentRegId =
@@ -2011,7 +2154,7 @@ std::unique_ptr<aql::ExecutionBlock> IResearchViewNode::createBlock(
     }
     TRI_ASSERT(writableOutputRegisters.size() ==
                static_cast<std::size_t>(numDocumentRegs) + numScoreRegisters +
-                   numViewVarsRegisters);
+                   numViewVarsRegisters + facetCountRegId.isValid());
     aql::RegisterInfos registerInfos = createRegisterInfos(
         calcInputRegs(), std::move(writableOutputRegisters));
     TRI_ASSERT(_view || _meta);
@@ -2019,6 +2162,7 @@ std::unique_ptr<aql::ExecutionBlock> IResearchViewNode::createBlock(
         std::move(reader),
         outRegister,
         searchDocRegId,
+        facetCountRegId,
         std::move(scoreRegisters),
         engine.getQuery(),
 #ifdef USE_ENTERPRISE
@@ -2038,6 +2182,9 @@ std::unique_ptr<aql::ExecutionBlock> IResearchViewNode::createBlock(
         filterOptimization(),
         _heapSort,
         _heapSortLimit,
+        _options.parallelism,
+        primarySortRange(filterCondition(), outVariable(),
+                         primarySort(_meta, _view)),
         _meta.get()};
     return std::make_tuple(materializeType, std::move(executorInfos),
                            std::move(registerInfos));
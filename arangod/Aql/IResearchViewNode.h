@@ -110,6 +110,9 @@ class IResearchViewNode final : public aql::ExecutionNode,
     // iresearch filters optimization level
     FilterOptimization filterOptimization{FilterOptimization::MAX};
 
+    // Maximum number of threads used to evaluate segments concurrently.
+    size_t parallelism{1};
+
     // Use the list of sources to restrict a query.
     bool restrictSources{false};
 
@@ -265,6 +268,16 @@ class IResearchViewNode final : public aql::ExecutionNode,
     _outSearchDocId = &var;
   }
 
+  // Output variable for the number of documents per distinct stored value,
+  // set if the node counts facets instead of producing a row per document.
+  aql::Variable const* facetCountVar() const noexcept {
+    return _outFacetCount;
+  }
+
+  void setFacetCountVar(aql::Variable const& var) noexcept {
+    _outFacetCount = &var;
+  }
+
   bool isLateMaterialized() const noexcept {
     return _outNonMaterializedDocId != nullptr;
   }
@@ -383,6 +396,10 @@ class IResearchViewNode final : public aql::ExecutionNode,
   // Output variables to non-materialized document view sort references.
   ViewValuesVars _outNonMaterializedViewVars;
 
+  // Output variable to write the number of documents with the same stored
+  // value to. Only used together with a single view variable.
+  aql::Variable const* _outFacetCount{nullptr};
+
   OptimizationState _optState;
 
   // Filter node to be processed by the view.
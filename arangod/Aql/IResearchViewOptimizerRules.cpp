@@ -28,6 +28,7 @@
 #include "Aql/AqlFunctionFeature.h"
 #include "Aql/CalculationNodeVarFinder.h"
 #include "Aql/ClusterNodes.h"
+#include "Aql/CollectNode.h"
 #include "Aql/Condition.h"
 #include "Aql/ExecutionNode.h"
 #include "Aql/ExecutionPlan.h"
@@ -722,6 +723,62 @@ bool noDocumentMaterialization(
   return modified;
 }
 
+// turns `COLLECT value = <stored value> WITH COUNT INTO n` following a view
+// node, which produces nothing but that single stored value, into a COLLECT
+// that sums up per-value counts computed by the view node itself. the view
+// node then emits one row per distinct value instead of one per document
+bool countFacetsInView(ExecutionPlan& plan,
+                       std::span<ExecutionNode* const> viewNodes) {
+  auto modified = false;
+  for (auto* node : viewNodes) {
+    TRI_ASSERT(node &&
+               ExecutionNode::ENUMERATE_IRESEARCH_VIEW == node->getType());
+    auto& viewNode = *ExecutionNode::castTo<IResearchViewNode*>(node);
+    if (!viewNode.isNoMaterialization() || viewNode.isLateMaterialized() ||
+        viewNode.isHeapSort() || !viewNode.scorers().empty() ||
+        viewNode.sort().first != nullptr ||
+        viewNode.searchDocIdVar() != nullptr ||
+        viewNode.facetCountVar() != nullptr) {
+      continue;
+    }
+    auto const viewVars = viewNode.getVariablesSetHere();
+    if (viewVars.size() != 1) {
+      continue;
+    }
+    auto* parent = viewNode.getFirstParent();
+    if (parent != nullptr && parent->getType() == ExecutionNode::SORT) {
+      // sorted COLLECT, the sort becomes cheaper too
+      auto const& elements =
+          ExecutionNode::castTo<SortNode const*>(parent)->elements();
+      if (elements.size() != 1 || elements[0].var != viewVars[0] ||
+          !elements[0].attributePath.empty()) {
+        continue;
+      }
+      parent = parent->getFirstParent();
+    }
+    if (parent == nullptr || parent->getType() != ExecutionNode::COLLECT) {
+      continue;
+    }
+    auto& collectNode = *ExecutionNode::castTo<CollectNode*>(parent);
+    if (collectNode.hasOutVariable() || collectNode.hasExpressionVariable() ||
+        collectNode.groupVariables().size() != 1 ||
+        collectNode.groupVariables()[0].inVar != viewVars[0] ||
+        collectNode.aggregateVariables().size() != 1) {
+      continue;
+    }
+    auto& aggregate = collectNode.aggregateVariables()[0];
+    if (aggregate.type != "LENGTH" || aggregate.inVar != nullptr) {
+      continue;
+    }
+    auto* countVar = plan.getAst()->variables()->createTemporaryVariable();
+    viewNode.setFacetCountVar(*countVar);
+    aggregate.type = "SUM";
+    aggregate.inVar = countVar;
+    modified = true;
+  }
+  return modified;
+}
+
 enum class SearchFuncType { kInvalid, kScorer, kOffsetInfo };
 
 std::pair<Variable const*, SearchFuncType> resolveSearchFunc(
@@ -1183,6 +1240,7 @@ void handleViewsRule(Optimizer* opt, std::unique_ptr<ExecutionPlan> plan,
   if (!toUnlink.empty()) {
     plan->unlinkNodes(toUnlink);
   }
+  modified |= countFacetsInView(*plan, viewNodes);
 
   // ensure all replaced scorers are covered by corresponding view nodes
   for (auto& [func, _] : searchFuncs) {
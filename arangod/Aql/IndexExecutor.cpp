@@ -158,7 +158,8 @@ IndexIterator::CoveringCallback getCallback(
       output.moveValueInto(registerId, input, guard);
     }
 
-    // hash/skiplist/persistent
+    // hash/skiplist/persistent/edge. the edge index provides the indexed
+    // attribute at position 0 and the opposite attribute at position 1
     if (covering.isArray()) {
       for (auto const& indReg : outNonMaterializedIndRegs.second) {
         TRI_ASSERT(indReg.first < covering.length());
@@ -171,7 +172,7 @@ IndexIterator::CoveringCallback getCallback(
         TRI_ASSERT(!output.isFull());
         output.moveValueInto(indReg.second, input, guard);
       }
-    } else {  // primary/edge
+    } else {  // primary
       auto indReg = outNonMaterializedIndRegs.second.cbegin();
       TRI_ASSERT(indReg != outNonMaterializedIndRegs.second.cend());
       if (ADB_UNLIKELY(indReg == outNonMaterializedIndRegs.second.cend())) {
@@ -589,11 +590,12 @@ bool IndexExecutor::CursorReader::isCovering() const {
   return _type == Type::Covering || _type == Type::CoveringFilterOnly;
 }
 
-void IndexExecutor::CursorReader::reset() {
+void IndexExecutor::CursorReader::reset(bool conditionChanged) {
   TRI_ASSERT(_cursor != nullptr);
 
-  if (_condition == nullptr || !_infos.hasNonConstParts()) {
-    // Const case
+  if (_condition == nullptr || !_infos.hasNonConstParts() ||
+      !conditionChanged) {
+    // Const case, or same lookup values as for the previous input row
     _cursor->reset();
     return;
   }
@@ -631,7 +633,8 @@ IndexExecutor::IndexExecutor(Fetcher& fetcher, Infos& infos)
       _infos(infos),
       _ast(_infos.query()),
       _currentIndex(_infos.getIndexes().size()),
-      _skipped(0) {
+      _skipped(0),
+      _expressionValuesChanged(true) {
   TRI_ASSERT(!_infos.getIndexes().empty());
   // Creation of a cursor will trigger search.
   // As we want to create them lazily we only
@@ -709,14 +712,16 @@ void IndexExecutor::executeExpressions(InputAqlItemRow const& input) {
     _expressionContext->adjustInputRow(input);
   }
 
-  _ast.clearMost();
+  auto const& nonConstExpressions = _infos.getNonConstExpressions();
+  bool const hadPreviousValues = !_lastExpressionValues.empty();
+  _lastExpressionValues.resize(nonConstExpressions.size());
 
+  // evaluate all expressions first, and check if any of them produced a
+  // different value than for the previous input row
+  bool changed = !hadPreviousValues || _cursors.empty();
   for (size_t posInExpressions = 0;
-       posInExpressions < _infos.getNonConstExpressions().size();
-       ++posInExpressions) {
-    NonConstExpression* toReplace =
-        _infos.getNonConstExpressions()[posInExpressions].get();
-    auto exp = toReplace->expression.get();
+       posInExpressions < nonConstExpressions.size(); ++posInExpressions) {
+    auto exp = nonConstExpressions[posInExpressions]->expression.get();
 
     bool mustDestroy;
     AqlValue a = exp->execute(_expressionContext.get(), mustDestroy);
@@ -724,7 +729,30 @@ void IndexExecutor::executeExpressions(InputAqlItemRow const& input) {
 
     AqlValueMaterializer materializer(&_trx.vpackOptions());
     VPackSlice slice = materializer.slice(a, false);
-    AstNode* evaluatedNode = _ast.nodeFromVPack(slice, true);
+
+    auto& last = _lastExpressionValues[posInExpressions];
+    if (changed || last.isEmpty() || !last.slice().binaryEquals(slice)) {
+      changed = true;
+      last.clear();
+      last.add(slice);
+    }
+  }
+
+  _expressionValuesChanged = changed;
+  if (!changed) {
+    // the condition still contains the values for the previous input row,
+    // which are identical. the cursors only need to be rewound
+    return;
+  }
+
+  _ast.clearMost();
+
+  for (size_t posInExpressions = 0;
+       posInExpressions < nonConstExpressions.size(); ++posInExpressions) {
+    NonConstExpression* toReplace = nonConstExpressions[posInExpressions].get();
+
+    AstNode* evaluatedNode = _ast.nodeFromVPack(
+        _lastExpressionValues[posInExpressions].slice(), true);
 
     AstNode* tmp = condition;
     for (size_t x = 0; x < toReplace->indexPath.size(); x++) {
@@ -780,7 +808,7 @@ bool IndexExecutor::advanceCursor() {
                             needsUniquenessCheck());
     } else {
       // Next index exists, need a reset.
-      getCursor().reset();
+      getCursor().reset(_expressionValuesChanged);
     }
     // We have a cursor now.
     TRI_ASSERT(_currentIndex < _cursors.size());
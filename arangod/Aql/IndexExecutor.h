@@ -217,7 +217,10 @@ class IndexExecutor {
                    DocumentProducingFunctionContext const&
                        documentProducingFunctionContext);
     size_t skipIndex(size_t toSkip);
-    void reset();
+    // reset the cursor for the next input row. if the condition has not
+    // changed since the last call, the cursor is only rewound, which avoids
+    // rebuilding the index lookup
+    void reset(bool conditionChanged);
 
     bool hasMore() const;
 
@@ -345,6 +348,16 @@ class IndexExecutor {
   ///        Needs to be 0 after we return a result.
   size_t _skipped;
 
+  /// @brief values of the non-const expressions for the previous input row.
+  /// if the values for the current input row are identical, the index
+  /// condition does not need to be rebuilt. this is common in join-like
+  /// queries in which many outer rows refer to the same inner key
+  std::vector<velocypack::Builder> _lastExpressionValues;
+
+  /// @brief whether or not the non-const expressions produced different
+  /// values than for the previous input row
+  bool _expressionValuesChanged;
+
   /// statistics for cursors. is shared by reference with CursorReader instances
   CursorStats _cursorStats;
 };
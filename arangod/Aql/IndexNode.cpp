@@ -101,6 +101,9 @@ IndexNode::IndexNode(ExecutionPlan* plan,
   _options.limit = basics::VelocyPackHelper::getNumericValue(base, "limit", 0);
   _options.lookahead = basics::VelocyPackHelper::getNumericValue(
       base, StaticStrings::IndexLookahead, IndexIteratorOptions{}.lookahead);
+  _options.distinctPrefixFields =
+      basics::VelocyPackHelper::getNumericValue<size_t>(
+          base, "distinctPrefixFields", 0);
 
   if (_options.sorted && base.isObject() && base.get("reverse").isBool()) {
     // legacy
@@ -241,6 +244,10 @@ void IndexNode::doToVelocyPack(VPackBuilder& builder, unsigned flags) const {
               VPackValue(_options.waitForSync));
   builder.add("limit", VPackValue(_options.limit));
   builder.add(StaticStrings::IndexLookahead, VPackValue(_options.lookahead));
+  if (_options.distinctPrefixFields > 0) {
+    builder.add("distinctPrefixFields",
+                VPackValue(_options.distinctPrefixFields));
+  }
 
   if (isLateMaterialized()) {
     builder.add(VPackValue("outNmDocId"));
@@ -510,6 +517,10 @@ IndexIteratorOptions IndexNode::options() const { return _options; }
 
 void IndexNode::setAscending(bool value) { _options.ascending = value; }
 
+void IndexNode::setDistinctPrefixFields(size_t value) {
+  _options.distinctPrefixFields = value;
+}
+
 bool IndexNode::needsGatherNodeSort() const { return _needsGatherNodeSort; }
 
 void IndexNode::needsGatherNodeSort(bool value) {
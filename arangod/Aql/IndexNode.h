@@ -85,6 +85,10 @@ class IndexNode : public ExecutionNode,
   /// @brief set reverse mode
   void setAscending(bool value);
 
+  /// @brief let the index skip over entries that have the same values for
+  /// the first n index attributes as an already produced entry
+  void setDistinctPrefixFields(size_t value);
+
   /// @brief whether or not the index node needs a post sort of the results
   /// of multiple shards in the cluster (via a GatherNode).
   /// not all queries that use an index will need to produce a sorted result
@@ -172,6 +172,19 @@ AqlValue InputAqlItemRow::stealValue(RegisterId registerId) {
   return a;
 }
 
+AqlValue InputAqlItemRow::stealOrCloneValue(RegisterId registerId) {
+  TRI_ASSERT(isInitialized());
+  TRI_ASSERT(registerId.isConstRegister() || registerId < getNumRegisters());
+  AqlValue const& a = block().getValueReference(_baseIndex, registerId);
+  if (!a.isEmpty() && a.requiresDestruction() &&
+      (registerId.isConstRegister() || !block().steal(a))) {
+    // we cannot steal the value of a const register, and someone else is
+    // already responsible for values that have been stolen before
+    return a.clone();
+  }
+  return a;
+}
+
 RegisterCount InputAqlItemRow::getNumRegisters() const noexcept {
   return block().numRegisters();
 }
@@ -87,6 +87,18 @@ class InputAqlItemRow {
    */
   AqlValue stealValue(RegisterId registerId);
 
+  /**
+   * @brief Take over the value of the given Variable Nr if the block is still
+   *        responsible for it, and copy it otherwise, e.g. if the same value
+   *        has been stolen before via another row or register.
+   *
+   * @param registerId The register ID of the variable to read.
+   *
+   * @return The AqlValue stored in that variable. The caller is responsible
+   *         for it.
+   */
+  AqlValue stealOrCloneValue(RegisterId registerId);
+
   RegisterCount getNumRegisters() const noexcept;
 
   // This the old operator==. It tests if both rows refer to the _same_ block
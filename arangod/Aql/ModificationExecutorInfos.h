@@ -94,6 +94,9 @@ struct ModificationExecutorInfos {
   // bool _returnInheritedResults;
   IsReplace _isReplace;                            // needed for upsert
   IgnoreDocumentNotFound _ignoreDocumentNotFound;  // needed for update replace
+  // whether the lookups of an UPSERT need to see the writes of the previous
+  // input rows (needed for upsert)
+  bool _readOwnWrites = true;
 
   // insert (singleinput) - upsert (inDoc) - update replace (inDoc)
   RegisterId _input1RegisterId;
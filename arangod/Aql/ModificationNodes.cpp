@@ -549,6 +549,7 @@ std::unique_ptr<ExecutionBlock> UpsertNode::createBlock(
       IgnoreErrors(_options.ignoreErrors), DoCount(countStats()),
       IsReplace(_isReplace) /*(needed by upsert)*/,
       IgnoreDocumentNotFound(_options.ignoreDocumentNotFound));
+  executorInfos._readOwnWrites = _options.readOwnWrites;
   return std::make_unique<SingleRowUpsertExecutionBlock>(
       &engine, this, std::move(registerInfos), std::move(executorInfos));
 }
@@ -44,7 +44,8 @@ struct ModificationOptions : OperationOptions {
         ignoreErrors(false),
         ignoreDocumentNotFound(false),
         consultAqlWriteFilter(false),
-        exclusive(false) {}
+        exclusive(false),
+        readOwnWrites(true) {}
 
   void toVelocyPack(velocypack::Builder&) const;
 
@@ -52,6 +53,9 @@ struct ModificationOptions : OperationOptions {
   bool ignoreDocumentNotFound;
   bool consultAqlWriteFilter;
   bool exclusive;
+  // whether the lookup part of an UPSERT must see the writes of the
+  // previous input rows. if disabled, UPSERTs are executed in batches
+  bool readOwnWrites;
 };
 
 }  // namespace aql
@@ -0,0 +1,274 @@
+////////////////////////////////////////////////////////////////////////////////
+/// DISCLAIMER
+///
+/// Copyright 2014-2023 ArangoDB GmbH, Cologne, Germany
+/// Copyright 2004-2014 triAGENS GmbH, Cologne, Germany
+///
+/// Licensed under the Apache License, Version 2.0 (the "License");
+/// you may not use this file except in compliance with the License.
+/// You may obtain a copy of the License at
+///
+///     http://www.apache.org/licenses/LICENSE-2.0
+///
+/// Unless required by applicable law or agreed to in writing, software
+/// distributed under the License is distributed on an "AS IS" BASIS,
+/// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+/// See the License for the specific language governing permissions and
+/// limitations under the License.
+///
+/// Copyright holder is ArangoDB GmbH, Cologne, Germany
+///
+/// @author Jan Steemann
+////////////////////////////////////////////////////////////////////////////////
+
+#include "NumericExpressionProgram.h"
+
+#include "Aql/AqlValue.h"
+#include "Aql/AstNode.h"
+#include "Aql/InputAqlItemRow.h"
+#include "Aql/QueryContext.h"
+#include "Aql/Variable.h"
+#include "Basics/debugging.h"
+
+#include <velocypack/Slice.h>
+
+#include <algorithm>
+#include <cmath>
+
+using namespace arangodb;
+using namespace arangodb::aql;
+
+namespace {
+// maximum nesting depth of expressions we are going to compile. deeper
+// expressions are rare and not worth the effort
+constexpr std::size_t maxStackDepth = 64;
+}  // namespace
+
+NumericExpressionProgram::NumericExpressionProgram() {
+  // the empty path, used for loading register values directly
+  _paths.emplace_back();
+}
+
+std::optional<NumericExpressionProgram> NumericExpressionProgram::compile(
+    AstNode const* node, QueryContext& query,
+    std::vector<std::pair<VariableId, RegisterId>> const& varToRegs) {
+  if (node == nullptr || (node->type != NODE_TYPE_OPERATOR_BINARY_PLUS &&
+                          node->type != NODE_TYPE_OPERATOR_BINARY_MINUS &&
+                          node->type != NODE_TYPE_OPERATOR_BINARY_TIMES &&
+                          node->type != NODE_TYPE_OPERATOR_BINARY_DIV &&
+                          node->type != NODE_TYPE_OPERATOR_BINARY_MOD)) {
+    // the root node must be a binary arithmetic operator, because the
+    // generic evaluation of all other nodes does not necessarily produce
+    // a double value
+    return std::nullopt;
+  }
+
+  NumericExpressionProgram program;
+  if (!program.compileNode(node, query, varToRegs, 0)) {
+    return std::nullopt;
+  }
+  TRI_ASSERT(!program._instructions.empty());
+  TRI_ASSERT(!program._stack.empty());
+  return program;
+}
+
+bool NumericExpressionProgram::compileNode(
+    AstNode const* node, QueryContext& query,
+    std::vector<std::pair<VariableId, RegisterId>> const& varToRegs,
+    std::size_t depth) {
+  if (depth >= maxStackDepth) {
+    return false;
+  }
+  // the result of this node will be stored at stack position `depth`
+  _stack.resize(std::max(_stack.size(), depth + 1));
+
+  switch (node->type) {
+    case NODE_TYPE_VALUE: {
+      if (!node->isNumericValue()) {
+        return false;
+      }
+      _instructions.emplace_back(Instruction{OpCode::kConstant,
+                                             RegisterId::makeInvalid(), 0,
+                                             node->getDoubleValue()});
+      return true;
+    }
+
+    case NODE_TYPE_PARAMETER: {
+      // value bind parameters are resolved at runtime, but their values do
+      // not change during the query
+      velocypack::Slice value =
+          query.bindParameterValue(node->getStringView());
+      if (!value.isNumber()) {
+        return false;
+      }
+      _instructions.emplace_back(Instruction{OpCode::kConstant,
+                                             RegisterId::makeInvalid(), 0,
+                                             value.getNumber<double>()});
+      return true;
+    }
+
+    case NODE_TYPE_ATTRIBUTE_ACCESS:
+    case NODE_TYPE_REFERENCE: {
+      // collect the attribute path, e.g. ["a", "b"] for `doc.a.b`
+      std::vector<std::string> path;
+      while (node->type == NODE_TYPE_ATTRIBUTE_ACCESS) {
+        path.emplace_back(node->getString());
+        node = node->getMemberUnchecked(0);
+      }
+      if (node->type != NODE_TYPE_REFERENCE) {
+        return false;
+      }
+      auto const* variable = static_cast<Variable const*>(node->getData());
+      auto it = std::find_if(
+          varToRegs.begin(), varToRegs.end(),
+          [&](auto const& entry) { return entry.first == variable->id; });
+      if (it == varToRegs.end()) {
+        return false;
+      }
+      std::size_t pathIndex = 0;
+      if (!path.empty()) {
+        std::reverse(path.begin(), path.end());
+        pathIndex = _paths.size();
+        _paths.emplace_back(std::move(path));
+      }
+      _instructions.emplace_back(
+          Instruction{OpCode::kLoad, it->second, pathIndex, 0.0});
+      return true;
+    }
+
+    case NODE_TYPE_OPERATOR_UNARY_PLUS:
+    case NODE_TYPE_OPERATOR_UNARY_MINUS: {
+      if (!compileNode(node->getMemberUnchecked(0), query, varToRegs, depth)) {
+        return false;
+      }
+      if (node->type == NODE_TYPE_OPERATOR_UNARY_MINUS) {
+        _instructions.emplace_back(
+            Instruction{OpCode::kNegate, RegisterId::makeInvalid(), 0, 0.0});
+      }
+      return true;
+    }
+
+    case NODE_TYPE_OPERATOR_BINARY_PLUS:
+    case NODE_TYPE_OPERATOR_BINARY_MINUS:
+    case NODE_TYPE_OPERATOR_BINARY_TIMES:
+    case NODE_TYPE_OPERATOR_BINARY_DIV:
+    case NODE_TYPE_OPERATOR_BINARY_MOD: {
+      if (!compileNode(node->getMemberUnchecked(0), query, varToRegs,
+                       depth) ||
+          !compileNode(node->getMemberUnchecked(1), query, varToRegs,
+                       depth + 1)) {
+        return false;
+      }
+      OpCode opCode;
+      switch (node->type) {
+        case NODE_TYPE_OPERATOR_BINARY_PLUS:
+          opCode = OpCode::kAdd;
+          break;
+        case NODE_TYPE_OPERATOR_BINARY_MINUS:
+          opCode = OpCode::kSubtract;
+          break;
+        case NODE_TYPE_OPERATOR_BINARY_TIMES:
+          opCode = OpCode::kMultiply;
+          break;
+        case NODE_TYPE_OPERATOR_BINARY_DIV:
+          opCode = OpCode::kDivide;
+          break;
+        default:
+          opCode = OpCode::kModulo;
+          break;
+      }
+      _instructions.emplace_back(
+          Instruction{opCode, RegisterId::makeInvalid(), 0, 0.0});
+      return true;
+    }
+
+    default:
+      return false;
+  }
+}
+
+std::optional<double> NumericExpressionProgram::evaluate(
+    InputAqlItemRow const& input) {
+  double* stack = _stack.data();
+  // number of values on the stack
+  std::size_t top = 0;
+
+  for (auto const& instruction : _instructions) {
+    switch (instruction.opCode) {
+      case OpCode::kConstant: {
+        TRI_ASSERT(top < _stack.size());
+        stack[top++] = instruction.constant;
+        break;
+      }
+      case OpCode::kLoad: {
+        TRI_ASSERT(top < _stack.size());
+        AqlValue const& value = input.getValue(instruction.reg);
+        velocypack::Slice slice;
+        if (instruction.path == 0) {
+          if (!value.isNumber()) {
+            return std::nullopt;
+          }
+          slice = value.slice();
+        } else {
+          if (!value.isObject()) {
+            return std::nullopt;
+          }
+          slice = value.slice().resolveExternals();
+          for (auto const& attribute : _paths[instruction.path]) {
+            if (!slice.isObject()) {
+              return std::nullopt;
+            }
+            slice = slice.get(attribute).resolveExternals();
+          }
+        }
+        if (!slice.isNumber()) {
+          // null, strings, arrays etc. are cast by the generic evaluation
+          return std::nullopt;
+        }
+        stack[top++] = slice.getNumber<double>();
+        break;
+      }
+      case OpCode::kNegate: {
+        TRI_ASSERT(top >= 1);
+        stack[top - 1] = -stack[top - 1];
+        break;
+      }
+      default: {
+        TRI_ASSERT(top >= 2);
+        double r = stack[--top];
+        double& l = stack[top - 1];
+        switch (instruction.opCode) {
+          case OpCode::kAdd:
+            l += r;
+            break;
+          case OpCode::kSubtract:
+            l -= r;
+            break;
+          case OpCode::kMultiply:
+            l *= r;
+            break;
+          case OpCode::kDivide:
+          case OpCode::kModulo:
+            if (r == 0.0) {
+              // division by zero. the generic evaluation will register a
+              // warning and return null
+              return std::nullopt;
+            }
+            if (instruction.opCode == OpCode::kDivide) {
+              l /= r;
+            } else {
+              l = std::fmod(l, r);
+            }
+            break;
+          default:
+            TRI_ASSERT(false);
+            return std::nullopt;
+        }
+        break;
+      }
+    }
+  }
+
+  TRI_ASSERT(top == 1);
+  return stack[0];
+}
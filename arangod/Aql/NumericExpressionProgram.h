@@ -0,0 +1,105 @@
+////////////////////////////////////////////////////////////////////////////////
+/// DISCLAIMER
+///
+/// Copyright 2014-2023 ArangoDB GmbH, Cologne, Germany
+/// Copyright 2004-2014 triAGENS GmbH, Cologne, Germany
+///
+/// Licensed under the Apache License, Version 2.0 (the "License");
+/// you may not use this file except in compliance with the License.
+/// You may obtain a copy of the License at
+///
+///     http://www.apache.org/licenses/LICENSE-2.0
+///
+/// Unless required by applicable law or agreed to in writing, software
+/// distributed under the License is distributed on an "AS IS" BASIS,
+/// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+/// See the License for the specific language governing permissions and
+/// limitations under the License.
+///
+/// Copyright holder is ArangoDB GmbH, Cologne, Germany
+///
+/// @author Jan Steemann
+////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "Aql/types.h"
+
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace arangodb::aql {
+struct AstNode;
+class InputAqlItemRow;
+class QueryContext;
+
+/// @brief linearized form of a purely arithmetic expression, e.g.
+/// `doc.a * 0.7 + doc.b * 0.3 - @penalty`.
+/// the expression is compiled once into a sequence of stack machine
+/// instructions, which can then be evaluated for every input row without
+/// walking the AST and without creating AqlValue temporaries for the
+/// intermediate results.
+/// only numeric literals, numeric bind parameters, variables (optionally
+/// followed by attribute accesses) and the operators unary +/- and binary
+/// + - * / % are supported. the evaluation gives up for a row if any of the
+/// operands is not a number or if a division by zero happens, so that the
+/// caller can fall back to the generic expression evaluation, which also
+/// takes care of type casts and warnings.
+class NumericExpressionProgram {
+ public:
+  /// @brief try to compile the expression. returns std::nullopt if the
+  /// expression contains anything but the supported node types, or if its
+  /// root node is not a binary arithmetic operator
+  static std::optional<NumericExpressionProgram> compile(
+      AstNode const* node, QueryContext& query,
+      std::vector<std::pair<VariableId, RegisterId>> const& varToRegs);
+
+  /// @brief evaluate the program for the input row. returns std::nullopt if
+  /// the result cannot be computed by the program
+  std::optional<double> evaluate(InputAqlItemRow const& input);
+
+  /// @brief number of instructions in the program
+  std::size_t size() const noexcept { return _instructions.size(); }
+
+ private:
+  enum class OpCode : std::uint8_t {
+    kConstant,
+    kLoad,
+    kNegate,
+    kAdd,
+    kSubtract,
+    kMultiply,
+    kDivide,
+    kModulo,
+  };
+
+  struct Instruction {
+    OpCode opCode;
+    // the register to load from, only used for kLoad
+    RegisterId reg;
+    // index into _paths, only used for kLoad. a value of 0 means that the
+    // register value itself is used
+    std::size_t path;
+    // the constant value, only used for kConstant
+    double constant;
+  };
+
+  NumericExpressionProgram();
+
+  bool compileNode(
+      AstNode const* node, QueryContext& query,
+      std::vector<std::pair<VariableId, RegisterId>> const& varToRegs,
+      std::size_t depth);
+
+  std::vector<Instruction> _instructions;
+  // attribute paths used by kLoad instructions, e.g. ["a", "b"] for `doc.a.b`.
+  // the first entry is always the empty path
+  std::vector<std::vector<std::string>> _paths;
+  // operand stack, sized to the maximum stack depth of the program
+  std::vector<double> _stack;
+};
+
+}  // namespace arangodb::aql
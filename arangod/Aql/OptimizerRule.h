@@ -336,6 +336,10 @@ struct OptimizerRule {
     // operation
     optimizeCountRule,
 
+    // let index scans that only feed the group values of a COLLECT skip
+    // over index entries that cannot produce a new group
+    distinctIndexScanRule,
+
     // parallelizes execution in coordinator-sided GatherNodes
     parallelizeGatherRule,
 
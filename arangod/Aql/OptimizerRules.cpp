@@ -76,6 +76,10 @@
 #include "Utils/CollectionNameResolver.h"
 #include "VocBase/Methods/Collections.h"
 
+#include <algorithm>
+#include <cmath>
+#include <iterator>
+#include <limits>
 #include <tuple>
 
 #include <absl/strings/str_cat.h>
@@ -3768,16 +3772,7 @@ void arangodb::aql::interchangeAdjacentEnumerationsRule(
   // independently. This is why we need to compute all permutation tuples.
 
   if (!starts.empty()) {
-    NextPermutationTuple(permTuple, starts);  // will never return false
-
-    do {
-      // check if we already have enough plans (plus the one plan that we will
-      // add at the end of this function)
-      if (opt->runOnlyRequiredRules(1)) {
-        // have enough plans. stop permutations
-        break;
-      }
-
+    auto addPermutedPlan = [&](std::vector<size_t> const& tuple) {
       // Clone the plan:
       std::unique_ptr<ExecutionPlan> newPlan(plan->clone());
 
@@ -3793,11 +3788,11 @@ void arangodb::aql::interchangeAdjacentEnumerationsRule(
       for (size_t i = 0; i < starts.size(); i++) {
         size_t lowBound = starts[i];
         size_t highBound =
-            (i < starts.size() - 1) ? starts[i + 1] : permTuple.size();
+            (i < starts.size() - 1) ? starts[i + 1] : tuple.size();
         // We need to remove the nodes
         // newNodes[lowBound..highBound-1] in newPlan and replace
         // them by the same ones in a different order, given by
-        // permTuple[lowBound..highBound-1].
+        // tuple[lowBound..highBound-1].
         auto parent = newNodes[lowBound]->getFirstParent();
 
         TRI_ASSERT(parent != nullptr);
@@ -3809,12 +3804,85 @@ void arangodb::aql::interchangeAdjacentEnumerationsRule(
 
         // And insert them in the new order:
         for (size_t j = highBound; j-- != lowBound;) {
-          newPlan->insertDependency(parent, newNodes[permTuple[j]]);
+          newPlan->insertDependency(parent, newNodes[tuple[j]]);
         }
       }
 
       // OK, the new plan is ready, let's report it:
       opt->addPlan(std::move(newPlan), rule, true);
+    };
+
+    // The number of permutations grows factorially with the number of
+    // loops, so for larger queries we will run out of plans long before
+    // all permutations have been tried, and the lexicographic order of the
+    // permutations will only ever move the innermost loops around. So we
+    // first try a greedy order, which puts the loop with the fewest
+    // estimated items outermost, the next smallest one inside of it and so
+    // on. This is the order that minimizes the number of times the inner
+    // loops have to be started, which is what matters most once the inner
+    // loops have been turned into index lookups by later rules.
+    std::vector<size_t> greedyTuple = permTuple;
+    {
+      transaction::Methods& trx = plan->getAst()->query().trxForOptimization();
+      std::vector<size_t> sizes;
+      sizes.reserve(nodesToPermute.size());
+      for (auto const* n : nodesToPermute) {
+        size_t size = std::numeric_limits<size_t>::max();
+        if (n->getType() == EN::ENUMERATE_COLLECTION) {
+          auto const* en =
+              ExecutionNode::castTo<EnumerateCollectionNode const*>(n);
+          if (en->isRandom()) {
+            size = 1;
+          } else if (trx.status() == transaction::Status::RUNNING) {
+            size = en->collection()->count(&trx,
+                                           transaction::CountType::TryCache);
+          }
+        } else {
+          TRI_ASSERT(n->getType() == EN::ENUMERATE_LIST);
+          size = estimateListLength(
+              plan.get(),
+              ExecutionNode::castTo<EnumerateListNode const*>(n)->inVariable());
+        }
+        sizes.emplace_back(size);
+      }
+
+      for (size_t i = 0; i < starts.size(); i++) {
+        size_t lowBound = starts[i];
+        size_t highBound =
+            (i < starts.size() - 1) ? starts[i + 1] : greedyTuple.size();
+        // the node at lowBound is the innermost one, so sort by descending
+        // size. stable sorting keeps the original order for equally sized
+        // loops
+        std::stable_sort(greedyTuple.begin() + lowBound,
+                         greedyTuple.begin() + highBound,
+                         [&](size_t lhs, size_t rhs) {
+                           return sizes[lhs] > sizes[rhs];
+                         });
+      }
+    }
+
+    // the original order is always added at the end of this function
+    bool const addGreedy = (greedyTuple != permTuple);
+    if (addGreedy && !opt->runOnlyRequiredRules(1)) {
+      addPermutedPlan(greedyTuple);
+    }
+
+    NextPermutationTuple(permTuple, starts);  // will never return false
+
+    do {
+      // check if we already have enough plans (plus the one plan that we will
+      // add at the end of this function)
+      if (opt->runOnlyRequiredRules(1)) {
+        // have enough plans. stop permutations
+        break;
+      }
+
+      if (addGreedy && permTuple == greedyTuple) {
+        // already added above
+        continue;
+      }
+
+      addPermutedPlan(permTuple);
     } while (NextPermutationTuple(permTuple, starts));
   }
 
@@ -4725,10 +4793,15 @@ void arangodb::aql::collectInClusterRule(Optimizer* opt,
 
             replaceGatherNodeVariables(plan.get(), gatherNode, replacements);
           } else if (  //! collectNode->groupVariables().empty() &&
-              !collectNode->hasOutVariable()) {
+              !collectNode->hasOutVariable() ||
+              (collectNode->hasExpressionVariable() &&
+               !collectNode->hasKeepVariables())) {
             // clone a COLLECT v1 = expr, v2 = expr ... operation from the
             // coordinator to the DB server(s), and leave an aggregate COLLECT
-            // node on the coordinator for total aggregation
+            // node on the coordinator for total aggregation.
+            // a COLLECT ... INTO var = expr is handled in the same way: the
+            // DB servers build partial groups, and the coordinator
+            // concatenates the partial groups via the UNION_STEP2 aggregator
 
             std::vector<AggregateVarInfo> dbServerAggVars;
             for (auto const& it : collectNode->aggregateVariables()) {
@@ -4761,11 +4834,17 @@ void arangodb::aql::collectInClusterRule(Optimizer* opt,
               outVars.emplace_back(GroupVarInfo{out, it.inVar});
             }
 
+            Variable const* dbOutVariable = nullptr;
+            if (collectNode->hasOutVariable()) {
+              dbOutVariable =
+                  plan->getAst()->variables()->createTemporaryVariable();
+            }
+
             auto dbCollectNode = new CollectNode(
                 plan.get(), plan->nextId(), collectNode->getOptions(), outVars,
-                dbServerAggVars, nullptr, nullptr,
-                std::vector<Variable const*>(), collectNode->variableMap(),
-                false);
+                dbServerAggVars, collectNode->expressionVariable(),
+                dbOutVariable, std::vector<Variable const*>(),
+                collectNode->variableMap(), false);
 
             plan->registerNode(dbCollectNode);
 
@@ -4792,6 +4871,13 @@ void arangodb::aql::collectInClusterRule(Optimizer* opt,
               ++j;
             }
 
+            if (dbOutVariable != nullptr) {
+              collectNode->aggregateVariables().emplace_back(AggregateVarInfo{
+                  collectNode->outVariable(), dbOutVariable, "UNION_STEP2"});
+              collectNode->clearOutVariable();
+              collectNode->clearExpressionVariable();
+            }
+
             removeGatherNodeSort = (dbCollectNode->aggregationMethod() !=
                                     CollectOptions::CollectMethod::SORTED);
 
@@ -7716,6 +7802,75 @@ void arangodb::aql::sortLimitRule(Optimizer* opt,
   opt->addPlan(std::move(plan), rule, mod);
 }
 
+namespace {
+
+/// @brief returns the subquery node whose result is passed into a call of
+/// LENGTH() or COUNT(), or nullptr if the node is something else
+ExecutionNode* subqueryCountedBy(ExecutionPlan const& plan,
+                                 AstNode const* node) {
+  if (node->type != NODE_TYPE_FCALL || node->numMembers() == 0) {
+    return nullptr;
+  }
+  auto func = static_cast<Function const*>(node->getData());
+  if (func->name != "LENGTH" && func->name != "COUNT") {
+    return nullptr;
+  }
+  auto args = node->getMember(0);
+  if (args->numMembers() == 0 ||
+      args->getMember(0)->type != NODE_TYPE_REFERENCE) {
+    return nullptr;
+  }
+  Variable const* v =
+      static_cast<Variable const*>(args->getMember(0)->getData());
+  auto setter = plan.getVarSetBy(v->id);
+  if (setter == nullptr || setter->getType() != EN::SUBQUERY) {
+    return nullptr;
+  }
+  return setter;
+}
+
+/// @brief checks if the node compares the length of a subquery result with
+/// a numeric constant, e.g. `LENGTH(sq) > 0` or `COUNT(sq) == 0`. such
+/// comparisons only depend on whether the subquery produces more results
+/// than the constant, so the subquery can stop after that many results.
+/// returns the subquery node and the number of results needed, or
+/// {nullptr, 0} if the node is not such a comparison
+std::pair<ExecutionNode*, int64_t> subqueryLengthComparison(
+    ExecutionPlan const& plan, AstNode const* node) {
+  if (node->type != NODE_TYPE_OPERATOR_BINARY_EQ &&
+      node->type != NODE_TYPE_OPERATOR_BINARY_NE &&
+      node->type != NODE_TYPE_OPERATOR_BINARY_LT &&
+      node->type != NODE_TYPE_OPERATOR_BINARY_LE &&
+      node->type != NODE_TYPE_OPERATOR_BINARY_GT &&
+      node->type != NODE_TYPE_OPERATOR_BINARY_GE) {
+    return {nullptr, 0};
+  }
+
+  AstNode const* lhs = node->getMemberUnchecked(0);
+  AstNode const* rhs = node->getMemberUnchecked(1);
+  ExecutionNode* setter = subqueryCountedBy(plan, lhs);
+  if (setter == nullptr) {
+    setter = subqueryCountedBy(plan, rhs);
+    std::swap(lhs, rhs);
+  }
+  if (setter == nullptr || rhs->type != NODE_TYPE_VALUE ||
+      !rhs->isNumericValue()) {
+    return {nullptr, 0};
+  }
+
+  double value = rhs->getDoubleValue();
+  if (!(value < 1024.0 * 1024.0)) {
+    // don't bother with huge limits
+    return {nullptr, 0};
+  }
+  // all lengths greater than the constant compare the same way against it,
+  // so we need at most floor(value) + 1 results to get the same outcome
+  int64_t limit = static_cast<int64_t>(std::floor(value)) + 1;
+  return {setter, std::max<int64_t>(1, limit)};
+}
+
+}  // namespace
+
 void arangodb::aql::optimizeSubqueriesRule(Optimizer* opt,
                                            std::unique_ptr<ExecutionPlan> plan,
                                            OptimizerRule const& rule) {
@@ -7742,7 +7897,13 @@ void arangodb::aql::optimizeSubqueriesRule(Optimizer* opt,
       std::pair<ExecutionNode*, int64_t> found{nullptr, 0};
       bool usedForCount = false;
 
-      if (node->type == NODE_TYPE_REFERENCE) {
+      if (auto [counted, limit] = ::subqueryLengthComparison(*plan, node);
+          counted != nullptr) {
+        // LENGTH(x) > 0 and the like => LIMIT n, and only count the results
+        found.first = counted;
+        found.second = limit;
+        usedForCount = true;
+      } else if (node->type == NODE_TYPE_REFERENCE) {
         Variable const* v = static_cast<Variable const*>(node->getData());
         auto setter = plan->getVarSetBy(v->id);
         if (setter != nullptr && setter->getType() == EN::SUBQUERY) {
@@ -7895,7 +8056,10 @@ void arangodb::aql::optimizeSubqueriesRule(Optimizer* opt,
         TRI_ASSERT(root->getType() == EN::RETURN);
         ExecutionNode::castTo<ReturnNode*>(root)->inVariable(outVariable);
         modified = true;
-        continue;
+        if (limitValue <= 0) {
+          // the exact number of results is needed
+          continue;
+        }
       }
 
       if (f->getType() == EN::LIMIT) {
@@ -8388,6 +8552,104 @@ void arangodb::aql::optimizeCountRule(Optimizer* opt,
   opt->addPlan(std::move(plan), rule, modified);
 }
 
+/// @brief let index scans that only feed the group values of a COLLECT
+/// skip over index entries that cannot produce a new group
+void arangodb::aql::distinctIndexScanRule(Optimizer* opt,
+                                          std::unique_ptr<ExecutionPlan> plan,
+                                          OptimizerRule const& rule) {
+  bool modified = false;
+
+  containers::SmallVector<ExecutionNode*, 8> nodes;
+  plan->findNodesOfType(nodes, EN::COLLECT, true);
+
+  for (auto const& n : nodes) {
+    auto collectNode = ExecutionNode::castTo<CollectNode*>(n);
+    if (collectNode->groupVariables().empty() ||
+        !collectNode->aggregateVariables().empty() ||
+        collectNode->hasOutVariable() ||
+        collectNode->hasExpressionVariable()) {
+      // the COLLECT needs to see all of its input rows
+      continue;
+    }
+
+    VarSet groupInVariables;
+    for (auto const& group : collectNode->groupVariables()) {
+      groupInVariables.emplace(group.inVar);
+    }
+
+    // the group values must be calculated directly from the index scan's
+    // documents, and nothing else must happen in between
+    std::vector<std::vector<basics::AttributeName>> attributes;
+    Variable const* documentVariable = nullptr;
+    bool eligible = true;
+    ExecutionNode* current = collectNode->getFirstDependency();
+    while (current != nullptr && current->getType() == EN::CALCULATION) {
+      auto cn = ExecutionNode::castTo<CalculationNode*>(current);
+      std::pair<Variable const*, std::vector<basics::AttributeName>> access;
+      if (groupInVariables.find(cn->outVariable()) == groupInVariables.end() ||
+          !cn->expression()->node()->isAttributeAccessForVariable(access) ||
+          (documentVariable != nullptr && access.first != documentVariable)) {
+        eligible = false;
+        break;
+      }
+      documentVariable = access.first;
+      attributes.emplace_back(std::move(access.second));
+      groupInVariables.erase(cn->outVariable());
+      current = current->getFirstDependency();
+    }
+
+    if (!eligible || !groupInVariables.empty() || current == nullptr ||
+        current->getType() != EN::INDEX) {
+      continue;
+    }
+
+    auto indexNode = ExecutionNode::castTo<IndexNode*>(current);
+    if (indexNode->outVariable() != documentVariable ||
+        indexNode->hasFilter() || indexNode->getIndexes().size() != 1 ||
+        !indexNode->options().ascending) {
+      continue;
+    }
+
+    auto const& index = indexNode->getIndexes()[0];
+    if (index->type() != Index::TRI_IDX_TYPE_PERSISTENT_INDEX &&
+        index->type() != Index::TRI_IDX_TYPE_HASH_INDEX &&
+        index->type() != Index::TRI_IDX_TYPE_SKIPLIST_INDEX) {
+      continue;
+    }
+
+    // all group attributes must be part of the same index prefix. array
+    // indexes can have multiple entries per document and are not supported
+    auto const& fields = index->fields();
+    size_t prefixFields = 0;
+    for (auto const& attribute : attributes) {
+      auto it = std::find_if(fields.begin(), fields.end(), [&](auto const& f) {
+        return basics::AttributeName::isIdentical(f, attribute, false);
+      });
+      if (it == fields.end()) {
+        eligible = false;
+        break;
+      }
+      auto position = static_cast<size_t>(std::distance(fields.begin(), it));
+      prefixFields = std::max(prefixFields, position + 1);
+    }
+
+    for (size_t i = 0; eligible && i < prefixFields; ++i) {
+      eligible = std::none_of(fields[i].begin(), fields[i].end(),
+                              [](auto const& a) { return a.shouldExpand; });
+    }
+
+    if (!eligible || (index->unique() && prefixFields == fields.size())) {
+      // entries of a unique index are distinct anyway
+      continue;
+    }
+
+    indexNode->setDistinctPrefixFields(prefixFields);
+    modified = true;
+  }
+
+  opt->addPlan(std::move(plan), rule, modified);
+}
+
 /// @brief parallelize coordinator GatherNodes
 void arangodb::aql::parallelizeGatherRule(Optimizer* opt,
                                           std::unique_ptr<ExecutionPlan> plan,
@@ -8457,12 +8719,32 @@ void arangodb::aql::asyncPrefetchRule(Optimizer* opt,
 }
 
 void arangodb::aql::enableAsyncPrefetching(ExecutionPlan& plan) {
-  // TODO at the moment we enable prefetching on all nodes - this should be made
-  // configurable
+  // prefetching only pays off if fetching from upstream has to wait for
+  // I/O, i.e. for network requests or for reading documents from the
+  // storage engine. for all other nodes the prefetch task would only
+  // compete with the original thread for CPU time, so we only enable
+  // prefetching on nodes that have an I/O-bound dependency.
   struct AsyncPrefetchEnabler : WalkerWorkerBase<ExecutionNode> {
+    static bool isIOBound(ExecutionNode const* n) noexcept {
+      switch (n->getType()) {
+        case EN::REMOTE:
+        case EN::GATHER:
+        case EN::ENUMERATE_COLLECTION:
+        case EN::INDEX:
+        case EN::MATERIALIZE:
+        case EN::ENUMERATE_IRESEARCH_VIEW:
+          return true;
+        default:
+          return false;
+      }
+    }
+
     bool before(ExecutionNode* n) override {
       TRI_ASSERT(!n->isModificationNode());
-      n->setIsAsyncPrefetchEnabled(true);
+      auto const& deps = n->getDependencies();
+      n->setIsAsyncPrefetchEnabled(
+          std::any_of(deps.begin(), deps.end(),
+                      [](ExecutionNode const* dep) { return isIOBound(dep); }));
       return false;
     }
   };
@@ -335,6 +335,11 @@ void moveFiltersIntoEnumerateRule(Optimizer*, std::unique_ptr<ExecutionPlan>,
 void optimizeCountRule(Optimizer*, std::unique_ptr<ExecutionPlan>,
                        OptimizerRule const&);
 
+/// @brief let index scans that only feed the group values of a COLLECT skip
+/// over index entries that cannot produce a new group
+void distinctIndexScanRule(Optimizer*, std::unique_ptr<ExecutionPlan>,
+                           OptimizerRule const&);
+
 /// @brief parallelize Gather nodes (cluster-only)
 void parallelizeGatherRule(Optimizer*, std::unique_ptr<ExecutionPlan>,
                            OptimizerRule const&);
@@ -255,7 +255,9 @@ This rule adds a `LIMIT` statement to qualifying subqueries to make them return
 less data. It also modifies the result value of subqueries in case only the
 number of subquery results is checked later. This saves copying the document
 data from the subquery to the outer scope and may enable follow-up
-optimizations.)");
+optimizations. If the number of subquery results is only compared against a
+constant, e.g. `LENGTH(subquery) > 0` for an existence check, the subquery
+also stops as soon as it has produced enough results for the comparison.)");
 
   /// "Pass 3": interchange EnumerateCollection nodes in all possible ways
   ///           this is level 500, please never let new plans from higher
@@ -713,6 +715,19 @@ loops, no `LIMIT` statement, and no `FILTER` condition or calculation that
 requires accessing document data. Accessing index data is supported for
 filtering but not for further calculations.)");
 
+  registerRule("distinct-index-scan", distinctIndexScanRule,
+               OptimizerRule::distinctIndexScanRule,
+               OptimizerRule::makeFlags(OptimizerRule::Flags::CanBeDisabled),
+               R"(Let a persistent index scan skip over index entries that
+cannot contribute new values to a subsequent `COLLECT` or `RETURN DISTINCT`.
+
+The requirements are that the `COLLECT` only has group variables (no
+aggregations, no `INTO` and no `WITH COUNT`), and that all group values are
+attributes of the documents produced by the index scan directly before it,
+which must be contained in the same prefix of the index fields. After an index
+entry has been produced, the index seeks directly behind all following entries
+with the same values for the index field prefix.)");
+
   registerRule("parallelize-gather", parallelizeGatherRule,
                OptimizerRule::parallelizeGatherRule,
                OptimizerRule::makeFlags(OptimizerRule::Flags::CanBeDisabled,
@@ -1085,6 +1085,26 @@ bool findProjections(ExecutionNode* n, Variable const* v,
   return true;
 }
 
+/// @brief whether or not the index can be used to look up the edges of a
+/// vertex via the edge attribute (_from or _to). this is true for the edge
+/// index and for vertex-centric indexes, i.e. persistent indexes that have
+/// the edge attribute as their first attribute
+bool isVertexCentricIndex(Index const& index, std::string_view edgeAttribute) {
+  switch (index.type()) {
+    case Index::TRI_IDX_TYPE_EDGE_INDEX:
+      return true;
+    case Index::TRI_IDX_TYPE_PERSISTENT_INDEX:
+    case Index::TRI_IDX_TYPE_HASH_INDEX:
+    case Index::TRI_IDX_TYPE_SKIPLIST_INDEX: {
+      auto const& fields = index.fields();
+      return !fields.empty() && fields[0].size() == 1 &&
+             !fields[0][0].shouldExpand && fields[0][0].name == edgeAttribute;
+    }
+    default:
+      return false;
+  }
+}
+
 /// @brief Gets the best fitting index for one specific condition.
 ///        Difference to IndexHandles: Condition is only one NARY_AND
 ///        and the Condition stays unmodified. Also does not care for sorting
@@ -1094,7 +1114,8 @@ bool getBestIndexHandleForFilterCondition(
     transaction::Methods& trx, aql::Collection const& collection,
     aql::AstNode* node, aql::Variable const* reference,
     size_t itemsInCollection, aql::IndexHint const& hint,
-    std::shared_ptr<Index>& usedIndex, bool onlyEdgeIndexes) {
+    std::shared_ptr<Index>& usedIndex, bool onlyEdgeIndexes,
+    std::string_view edgeAttribute) {
   // We can only start after DNF transformation and only a single AND
   TRI_ASSERT(node->type == aql::AstNodeType::NODE_TYPE_OPERATOR_NARY_AND);
   if (node->numMembers() == 0) {
@@ -1111,6 +1132,13 @@ bool getBestIndexHandleForFilterCondition(
                                 Index::IndexType::TRI_IDX_TYPE_EDGE_INDEX;
                        }),
         indexes.end());
+  } else if (!edgeAttribute.empty()) {
+    indexes.erase(
+        std::remove_if(indexes.begin(), indexes.end(),
+                       [&](auto&& idx) {
+                         return !isVertexCentricIndex(*idx, edgeAttribute);
+                       }),
+        indexes.end());
   }
 
   aql::SortCondition sortCondition;    // always empty here
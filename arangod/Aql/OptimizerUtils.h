@@ -81,14 +81,27 @@ std::pair<bool, bool> getBestIndexHandlesForFilterCondition(
     std::vector<std::shared_ptr<Index>>& usedIndexes, bool& isSorted,
     bool& isAllCoveredByIndex);
 
+/// @brief whether or not the index can be used to look up the edges of a
+/// vertex via the edge attribute (_from or _to), i.e. whether it is the
+/// edge index or a vertex-centric index
+bool isVertexCentricIndex(Index const& index, std::string_view edgeAttribute);
+
 /// @brief Gets the best fitting index for an AQL condition.
 /// note: the contents of  node  may be modified by this function if
 /// an index is picked!!
+/// if  edgeAttribute  is set (_from or _to), the condition is the edge
+/// lookup condition of a graph operation, and only the edge index and
+/// vertex-centric indexes are considered. vertex-centric indexes are
+/// persistent indexes with  edgeAttribute  as their first attribute and
+/// further attributes from the edge filter conditions. other indexes would
+/// need to scan all edges matching the remaining conditions for every
+/// vertex, and are never better than the edge index
 bool getBestIndexHandleForFilterCondition(
     transaction::Methods& trx, aql::Collection const& collection,
     arangodb::aql::AstNode* node, arangodb::aql::Variable const* reference,
     size_t itemsInCollection, aql::IndexHint const& hint,
-    std::shared_ptr<Index>& usedIndex, bool onlyEdgeIndexes = false);
+    std::shared_ptr<Index>& usedIndex, bool onlyEdgeIndexes = false,
+    std::string_view edgeAttribute = {});
 
 /// @brief Gets the best fitting index for an AQL sort condition
 bool getIndexForSortCondition(aql::Collection const& coll,
@@ -0,0 +1,92 @@
+////////////////////////////////////////////////////////////////////////////////
+/// DISCLAIMER
+///
+/// Copyright 2014-2023 ArangoDB GmbH, Cologne, Germany
+/// Copyright 2004-2014 triAGENS GmbH, Cologne, Germany
+///
+/// Licensed under the Apache License, Version 2.0 (the "License");
+/// you may not use this file except in compliance with the License.
+/// You may obtain a copy of the License at
+///
+///     http://www.apache.org/licenses/LICENSE-2.0
+///
+/// Unless required by applicable law or agreed to in writing, software
+/// distributed under the License is distributed on an "AS IS" BASIS,
+/// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+/// See the License for the specific language governing permissions and
+/// limitations under the License.
+///
+/// Copyright holder is ArangoDB GmbH, Cologne, Germany
+///
+/// @author Jan Steemann
+////////////////////////////////////////////////////////////////////////////////
+
+#include "PreparedQueryRegistry.h"
+
+#include "Basics/voc-errors.h"
+#include "VocBase/ticks.h"
+
+using namespace arangodb;
+using namespace arangodb::aql;
+
+PreparedQueryRegistry::PreparedQueryRegistry(std::size_t maxEntries)
+    : _maxEntries(maxEntries) {}
+
+PreparedQueryRegistry::~PreparedQueryRegistry() = default;
+
+ResultT<uint64_t> PreparedQueryRegistry::insert(std::string databaseName,
+                                                std::string user,
+                                                std::string queryString) {
+  auto entry = std::make_shared<Entry const>(Entry{std::move(databaseName),
+                                                   std::move(user),
+                                                   std::move(queryString)});
+  uint64_t id = TRI_NewServerSpecificTick();
+
+  std::lock_guard guard{_mutex};
+  if (_entries.size() >= _maxEntries) {
+    return Result(TRI_ERROR_RESOURCE_LIMIT,
+                  "maximum number of prepared queries reached");
+  }
+  _entries.emplace(id, std::move(entry));
+  return id;
+}
+
+std::shared_ptr<PreparedQueryRegistry::Entry const>
+PreparedQueryRegistry::lookup(uint64_t id, std::string_view databaseName,
+                              std::string_view user) const {
+  std::lock_guard guard{_mutex};
+  if (auto it = _entries.find(id); it != _entries.end() &&
+                                   it->second->databaseName == databaseName &&
+                                   it->second->user == user) {
+    return it->second;
+  }
+  return nullptr;
+}
+
+bool PreparedQueryRegistry::remove(uint64_t id, std::string_view databaseName,
+                                   std::string_view user) {
+  std::lock_guard guard{_mutex};
+  if (auto it = _entries.find(id); it != _entries.end() &&
+                                   it->second->databaseName == databaseName &&
+                                   it->second->user == user) {
+    _entries.erase(it);
+    return true;
+  }
+  return false;
+}
+
+void PreparedQueryRegistry::invalidate(std::string_view databaseName) {
+  std::lock_guard guard{_mutex};
+  for (auto it = _entries.begin(); it != _entries.end();) {
+    if (it->second->databaseName == databaseName) {
+      _entries.erase(it++);
+    } else {
+      ++it;
+    }
+  }
+}
+
+std::size_t PreparedQueryRegistry::size() const {
+  std::lock_guard guard{_mutex};
+  return _entries.size();
+}
@@ -0,0 +1,93 @@
+////////////////////////////////////////////////////////////////////////////////
+/// DISCLAIMER
+///
+/// Copyright 2014-2023 ArangoDB GmbH, Cologne, Germany
+/// Copyright 2004-2014 triAGENS GmbH, Cologne, Germany
+///
+/// Licensed under the Apache License, Version 2.0 (the "License");
+/// you may not use this file except in compliance with the License.
+/// You may obtain a copy of the License at
+///
+///     http://www.apache.org/licenses/LICENSE-2.0
+///
+/// Unless required by applicable law or agreed to in writing, software
+/// distributed under the License is distributed on an "AS IS" BASIS,
+/// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+/// See the License for the specific language governing permissions and
+/// limitations under the License.
+///
+/// Copyright holder is ArangoDB GmbH, Cologne, Germany
+///
+/// @author Jan Steemann
+////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "Basics/ResultT.h"
+#include "Containers/FlatHashMap.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+
+namespace arangodb::aql {
+
+/// @brief registry for prepared AQL queries.
+/// a prepared query is a query string that has been registered once by a
+/// client, and that can then be executed repeatedly by referring to its id,
+/// with different bind parameters. the query string is not sent again for
+/// every execution. prepared queries are executed like any other query, so
+/// on single servers their execution plans are taken from the plan cache,
+/// which also takes care of invalidating plans after DDL operations.
+/// prepared queries are local to the server that created them. their ids
+/// encode the server's short id, so that coordinators can forward requests
+/// to the coordinator that holds the prepared query.
+class PreparedQueryRegistry {
+ public:
+  struct Entry {
+    std::string databaseName;
+    /// @brief user that prepared the query. only this user can execute or
+    /// remove it
+    std::string user;
+    std::string queryString;
+  };
+
+  PreparedQueryRegistry(PreparedQueryRegistry const&) = delete;
+  PreparedQueryRegistry& operator=(PreparedQueryRegistry const&) = delete;
+
+  explicit PreparedQueryRegistry(std::size_t maxEntries);
+  ~PreparedQueryRegistry();
+
+  /// @brief register a prepared query and return its id. fails if the
+  /// maximum number of prepared queries is reached
+  ResultT<uint64_t> insert(std::string databaseName, std::string user,
+                           std::string queryString);
+
+  /// @brief look up a prepared query. returns a nullptr if there is no
+  /// prepared query with this id for the database and user
+  std::shared_ptr<Entry const> lookup(uint64_t id,
+                                      std::string_view databaseName,
+                                      std::string_view user) const;
+
+  /// @brief remove a prepared query. returns false if there is no prepared
+  /// query with this id for the database and user
+  bool remove(uint64_t id, std::string_view databaseName,
+              std::string_view user);
+
+  /// @brief remove all prepared queries of a database
+  void invalidate(std::string_view databaseName);
+
+  std::size_t size() const;
+
+ private:
+  std::size_t const _maxEntries;
+
+  mutable std::mutex _mutex;
+
+  containers::FlatHashMap<uint64_t, std::shared_ptr<Entry const>> _entries;
+};
+
+}  // namespace arangodb::aql
@@ -40,6 +40,7 @@
 #include "Aql/QueryCache.h"
 #include "Aql/QueryExecutionState.h"
 #include "Aql/QueryList.h"
+#include "Aql/QueryPlanCache.h"
 #include "Aql/QueryProfile.h"
 #include "Aql/QueryRegistry.h"
 #include "Aql/Timing.h"
@@ -56,6 +57,7 @@
 #include "Network/NetworkFeature.h"
 #include "Network/Utils.h"
 #include "RestServer/AqlFeature.h"
+#include "RestServer/DatabaseFeature.h"
 #include "RestServer/QueryRegistryFeature.h"
 #include "StorageEngine/TransactionCollection.h"
 #include "StorageEngine/TransactionState.h"
@@ -278,6 +280,10 @@ std::shared_ptr<Query> Query::create(
 /// @brief return the user that started the query
 std::string const& Query::user() const { return _user; }
 
+velocypack::Slice Query::bindParameterValue(std::string_view name) const {
+  return _bindParameters.get(std::string(name)).first;
+}
+
 double Query::getLockTimeout() const noexcept {
   return _queryOptions.transactionOptions.lockTimeout;
 }
@@ -399,11 +405,64 @@ std::unique_ptr<ExecutionPlan> Query::preparePlan() {
       << " this: " << (uintptr_t)this;
 
   TRI_ASSERT(_ast != nullptr);
+
+  // check if we can use the execution plan cache for this query
+  QueryPlanCache* planCache = nullptr;
+  std::optional<QueryPlanCache::Key> planCacheKey;
+  uint64_t ddlVersion = 0;
+  if (_queryOptions.usePlanCache &&
+      ServerState::instance()->isSingleServer() &&
+      vocbase().server().hasFeature<QueryRegistryFeature>()) {
+    planCache = vocbase()
+                    .server()
+                    .getFeature<QueryRegistryFeature>()
+                    .queryPlanCache();
+  }
+
+  if (planCache != nullptr) {
+    // note: the DDL version must be fetched before the plan is created, so
+    // that concurrent DDL operations will invalidate the stored entry
+    ddlVersion = vocbase()
+                     .server()
+                     .getFeature<DatabaseFeature>()
+                     .versionTracker()
+                     ->current();
+    auto bindParameters = _bindParameters.builder();
+    VPackSlice bindSlice = bindParameters != nullptr
+                               ? bindParameters->slice()
+                               : VPackSlice::emptyObjectSlice();
+    planCacheKey.emplace(vocbase().name(), _queryString, bindSlice,
+                         _queryOptions);
+
+    auto entry = planCache->lookup(*planCacheKey, bindSlice, ddlVersion);
+    if (entry != nullptr) {
+      // plan cache hit. we can skip parsing and optimizing the query
+      _cachedPlan = std::move(entry);
+      auto plan = instantiateCachedPlan(*_cachedPlan);
+
+      // return the V8 context if we are in one
+      exitV8Context();
+
+      return plan;
+    }
+  }
+
   Parser parser(*this, *_ast, _queryString);
   parser.parse();
 
+  // determine which bind parameters can be resolved at runtime
+  containers::FlatHashSet<std::string> valueParameters;
+  if (planCache != nullptr &&
+      !QueryPlanCache::collectValueParameters(parser.ast()->root(),
+                                              valueParameters)) {
+    // query is not eligible for plan caching
+    planCache = nullptr;
+  }
+
   // put in bind parameters
-  parser.ast()->injectBindParameters(_bindParameters, this->resolver());
+  parser.ast()->injectBindParameters(
+      _bindParameters, this->resolver(),
+      planCache != nullptr ? &valueParameters : nullptr);
 
   if (parser.ast()->containsUpsertNode()) {
     // UPSERTs and intermediate commits do not play nice together, because the
@@ -414,26 +473,8 @@ std::unique_ptr<ExecutionPlan> Query::preparePlan() {
     _queryOptions.transactionOptions.intermediateCommitCount = UINT64_MAX;
   }
 
-  TRI_ASSERT(_trx == nullptr);
   // needs to be created after the AST collected all collections
-  std::unordered_set<std::string> inaccessibleCollections;
-#ifdef USE_ENTERPRISE
-  if (_queryOptions.transactionOptions.skipInaccessibleCollections) {
-    inaccessibleCollections = _queryOptions.inaccessibleCollections;
-  }
-#endif
-
-  _trx = AqlTransaction::create(_transactionContext, _collections,
-                                _queryOptions.transactionOptions,
-                                std::move(inaccessibleCollections));
-  // create the transaction object, but do not start it yet
-  _trx->addHint(
-      transaction::Hints::Hint::FROM_TOPLEVEL_AQL);  // only used on toplevel
-
-  // We need to preserve the information about dirty reads, since the
-  // transaction who knows might be gone before we have produced the
-  // result:
-  _allowDirtyReads = _trx->state()->options().allowDirtyReads;
+  createTransaction();
 
   // As soon as we start to instantiate the plan we have to clean it
   // up before killing the unique_ptr
@@ -469,12 +510,110 @@ std::unique_ptr<ExecutionPlan> Query::preparePlan() {
 
   TRI_ASSERT(plan != nullptr);
 
+  if (planCache != nullptr && _warnings.empty() &&
+      !plan->contains(ExecutionNode::ENUMERATE_IRESEARCH_VIEW)) {
+    // store the optimized plan in the plan cache
+    auto entry = std::make_shared<QueryPlanCache::Value>();
+    plan->findVarUsage();
+    plan->toVelocyPack(entry->plan, _ast.get(),
+                       ExecutionNode::SERIALIZE_DETAILS);
+
+    // remember the values of all bind parameters that were injected into
+    // the plan as constants
+    entry->structuralParameters.openObject();
+    _bindParameters.visit([&](std::string const& key, VPackSlice value,
+                              AstNode* /*node*/) {
+      if (!valueParameters.contains(key)) {
+        entry->structuralParameters.add(key, value);
+      }
+    });
+    entry->structuralParameters.close();
+
+    entry->ddlVersion = ddlVersion;
+    entry->containsModificationNode = _ast->containsModificationNode();
+    entry->containsParallelNode = _ast->canApplyParallelism();
+    entry->containsUpsertNode = _ast->containsUpsertNode();
+    entry->isResultCacheable = _ast->root()->isCacheable();
+
+    TRI_ASSERT(planCacheKey.has_value());
+    planCache->store(std::move(*planCacheKey), std::move(entry));
+  }
+
   // return the V8 context if we are in one
   exitV8Context();
 
   return plan;
 }
 
+void Query::createTransaction() {
+  TRI_ASSERT(_trx == nullptr);
+  std::unordered_set<std::string> inaccessibleCollections;
+#ifdef USE_ENTERPRISE
+  if (_queryOptions.transactionOptions.skipInaccessibleCollections) {
+    inaccessibleCollections = _queryOptions.inaccessibleCollections;
+  }
+#endif
+
+  _trx = AqlTransaction::create(_transactionContext, _collections,
+                                _queryOptions.transactionOptions,
+                                std::move(inaccessibleCollections));
+  // create the transaction object, but do not start it yet
+  _trx->addHint(
+      transaction::Hints::Hint::FROM_TOPLEVEL_AQL);  // only used on toplevel
+
+  // We need to preserve the information about dirty reads, since the
+  // transaction who knows might be gone before we have produced the
+  // result:
+  _allowDirtyReads = _trx->state()->options().allowDirtyReads;
+}
+
+std::unique_ptr<ExecutionPlan> Query::instantiateCachedPlan(
+    QueryPlanCache::Value const& entry) {
+  VPackSlice planSlice = entry.plan.slice();
+
+  if (entry.containsModificationNode) {
+    _ast->setContainsModificationNode();
+  }
+  if (entry.containsParallelNode) {
+    _ast->setContainsParallelNode();
+  }
+  if (entry.containsUpsertNode) {
+    _ast->setContainsUpsertNode();
+    // see above for why intermediate commits are disabled for UPSERTs
+    _queryOptions.transactionOptions.intermediateCommitSize = UINT64_MAX;
+    _queryOptions.transactionOptions.intermediateCommitCount = UINT64_MAX;
+  }
+
+  enterState(QueryExecutionState::ValueType::LOADING_COLLECTIONS);
+
+  for (VPackSlice collection :
+       VPackArrayIterator(planSlice.get("collections"))) {
+    _collections.add(
+        basics::VelocyPackHelper::checkAndGetStringValue(collection, "name"),
+        AccessMode::fromString(basics::VelocyPackHelper::checkAndGetStringValue(
+                                   collection, "type")
+                                   .c_str()),
+        Collection::Hint::Collection);
+  }
+  _ast->variables()->fromVelocyPack(planSlice.get("variables"));
+
+  createTransaction();
+
+  Result res = _trx->begin();
+
+  if (!res.ok()) {
+    THROW_ARANGO_EXCEPTION(res);
+  }
+  TRI_ASSERT(_trx->status() == transaction::Status::RUNNING);
+
+  enterState(QueryExecutionState::ValueType::PLAN_INSTANTIATION);
+
+  auto plan = ExecutionPlan::instantiateFromVelocyPack(_ast.get(), planSlice);
+  TRI_ASSERT(plan != nullptr);
+
+  return plan;
+}
+
 /// @brief execute an AQL query
 ExecutionState Query::execute(QueryResult& queryResult) {
   LOG_TOPIC("e8ed7", DEBUG, Logger::QUERIES)
@@ -492,7 +631,8 @@ ExecutionState Query::execute(QueryResult& queryResult) {
         if (useQueryCache) {
           // check the query cache for an existing result
           auto cacheEntry = QueryCache::instance()->lookup(
-              &_vocbase, hash(), _queryString, bindParameters());
+              &_vocbase, hash(), _queryString, bindParameters(),
+              _queryOptions.cacheMaxStaleness);
 
           if (cacheEntry != nullptr) {
             if (cacheEntry->currentUserHasPermissions()) {
@@ -536,7 +676,7 @@ ExecutionState Query::execute(QueryResult& queryResult) {
         TRI_ASSERT(_trx != nullptr);
 
         if (useQueryCache && (isModificationQuery() || !_warnings.empty() ||
-                              !_ast->root()->isCacheable())) {
+                              !isResultCacheable())) {
           useQueryCache = false;
         }
 
@@ -619,6 +759,7 @@ ExecutionState Query::execute(QueryResult& queryResult) {
               hash(), _queryString, queryResult.data, bindParameters(),
               std::move(dataSources)  // query DataSources
           );
+          _cacheEntry->_maxStaleness = _queryOptions.cacheMaxStaleness;
         }
 
         queryResult.context = _trx->transactionContext();
@@ -719,7 +860,8 @@ QueryResultV8 Query::executeV8(v8::Isolate* isolate) {
     if (useQueryCache) {
       // check the query cache for an existing result
       auto cacheEntry = QueryCache::instance()->lookup(
-          &_vocbase, hash(), _queryString, bindParameters());
+          &_vocbase, hash(), _queryString, bindParameters(),
+          _queryOptions.cacheMaxStaleness);
 
       if (cacheEntry != nullptr) {
         if (cacheEntry->currentUserHasPermissions()) {
@@ -746,7 +888,7 @@ QueryResultV8 Query::executeV8(v8::Isolate* isolate) {
     logAtStart();
 
     if (useQueryCache && (isModificationQuery() || !_warnings.empty() ||
-                          !_ast->root()->isCacheable())) {
+                          !isResultCacheable())) {
       useQueryCache = false;
     }
 
@@ -868,6 +1010,7 @@ QueryResultV8 Query::executeV8(v8::Isolate* isolate) {
           hash(), _queryString, builder, bindParameters(),
           std::move(dataSources)  // query DataSources
       );
+      _cacheEntry->_maxStaleness = _queryOptions.cacheMaxStaleness;
     }
 
     ss->resetWakeupHandler();
@@ -919,19 +1062,23 @@ QueryResultV8 Query::executeV8(v8::Isolate* isolate) {
 ExecutionState Query::finalize(VPackBuilder& extras) {
   ensureExecutionTime();
 
-  if (_queryProfile != nullptr &&
-      _shutdownState.load(std::memory_order_relaxed) == ShutdownState::None) {
-    // the following call removes the query from the list of currently
-    // running queries. so whoever fetches that list will not see a Query that
-    // is about to shut down/be destroyed
-    _queryProfile->unregisterFromQueryList();
-  }
-
   auto state = cleanupPlanAndEngine(TRI_ERROR_NO_ERROR, /*sync*/ false);
   if (state == ExecutionState::WAITING) {
     return state;
   }
 
+  // all snippets are shut down now, and the DB servers have reported the
+  // resources used by their parts of the query
+  _execStats.resources.add(_resourceUsage.steal());
+
+  if (_queryProfile != nullptr) {
+    // the following call removes the query from the list of currently
+    // running queries. so whoever fetches that list will not see a Query that
+    // is about to be destroyed. this is done only after the cleanup, so that
+    // a slow query log entry contains the resource usage of all snippets
+    _queryProfile->unregisterFromQueryList();
+  }
+
   extras.openObject(/*unindexed*/ true);
   _warnings.toVelocyPack(extras);
 
@@ -1446,6 +1593,14 @@ bool Query::canUseQueryCache() const {
   return false;
 }
 
+bool Query::isResultCacheable() const {
+  if (_cachedPlan != nullptr) {
+    // the AST is empty if the plan was taken from the plan cache
+    return _cachedPlan->isResultCacheable;
+  }
+  return _ast->root()->isCacheable();
+}
+
 ErrorCode Query::resultCode() const noexcept {
   // never return negative value from here
   return _resultCode.value_or(TRI_ERROR_NO_ERROR);
@@ -30,6 +30,7 @@
 #include "Aql/ExecutionStats.h"
 #include "Aql/QueryContext.h"
 #include "Aql/QueryExecutionState.h"
+#include "Aql/QueryPlanCache.h"
 #include "Aql/QueryResult.h"
 #include "Aql/QueryResultV8.h"
 #include "Aql/QueryString.h"
@@ -108,6 +109,10 @@ class Query : public QueryContext, public std::enable_shared_from_this<Query> {
   /// @brief return the user that started the query
   std::string const& user() const final;
 
+  /// @brief return the value of a bind parameter, or a none slice if
+  /// the bind parameter does not exist
+  velocypack::Slice bindParameterValue(std::string_view name) const final;
+
   /// @brief whether or not the query is killed
   bool killed() const final;
 
@@ -261,6 +266,10 @@ class Query : public QueryContext, public std::enable_shared_from_this<Query> {
   /// @brief whether or not the query cache can be used for the query
   bool canUseQueryCache() const;
 
+  /// @brief whether or not the query results can be stored in the query
+  /// results cache. only valid after the query was prepared
+  bool isResultCacheable() const;
+
   /// @brief enter a new state
   void enterState(QueryExecutionState::ValueType);
 
@@ -278,6 +287,13 @@ class Query : public QueryContext, public std::enable_shared_from_this<Query> {
   // a vertex collection yet. This can happen e.g. during anonymous traversal.
   void injectVertexCollectionIntoGraphNodes(ExecutionPlan& plan);
 
+  // create the transaction object for the query, but do not start it yet
+  void createTransaction();
+
+  // create the query's execution plan from an entry in the plan cache
+  std::unique_ptr<ExecutionPlan> instantiateCachedPlan(
+      QueryPlanCache::Value const& entry);
+
   // log the start of a query (trace mode only)
   void logAtStart();
 
@@ -323,6 +339,9 @@ class Query : public QueryContext, public std::enable_shared_from_this<Query> {
   /// plan serialized before instantiation, used for query profiling
   std::unique_ptr<velocypack::UInt8Buffer> _planSliceCopy;
 
+  /// @brief the plan cache entry the execution plan was created from, if any
+  std::shared_ptr<QueryPlanCache::Value const> _cachedPlan;
+
   /// @brief the transaction object, in a distributed query every part of
   /// the query has its own transaction object. The transaction object is
   /// created in the prepare method.
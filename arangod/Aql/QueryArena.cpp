@@ -0,0 +1,109 @@
+////////////////////////////////////////////////////////////////////////////////
+/// DISCLAIMER
+///
+/// Copyright 2014-2023 ArangoDB GmbH, Cologne, Germany
+/// Copyright 2004-2014 triAGENS GmbH, Cologne, Germany
+///
+/// Licensed under the Apache License, Version 2.0 (the "License");
+/// you may not use this file except in compliance with the License.
+/// You may obtain a copy of the License at
+///
+///     http://www.apache.org/licenses/LICENSE-2.0
+///
+/// Unless required by applicable law or agreed to in writing, software
+/// distributed under the License is distributed on an "AS IS" BASIS,
+/// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+/// See the License for the specific language governing permissions and
+/// limitations under the License.
+///
+/// Copyright holder is ArangoDB GmbH, Cologne, Germany
+///
+/// @author Jan Steemann
+////////////////////////////////////////////////////////////////////////////////
+
+#include "QueryArena.h"
+#include "Basics/ResourceUsage.h"
+#include "Basics/debugging.h"
+
+#include <algorithm>
+#include <cstdint>
+
+using namespace arangodb::aql;
+
+QueryArena::QueryArena(arangodb::ResourceMonitor& resourceMonitor) noexcept
+    : _resourceMonitor(resourceMonitor),
+      _memoryUsage(0),
+      _current(nullptr),
+      _end(nullptr) {}
+
+QueryArena::~QueryArena() { release(); }
+
+void QueryArena::release() noexcept {
+  _resourceMonitor.decreaseMemoryUsage(_memoryUsage);
+  _blocks.clear();
+  _memoryUsage = 0;
+  _current = nullptr;
+  _end = nullptr;
+}
+
+void QueryArena::releaseMost() noexcept {
+  if (_blocks.size() <= 1) {
+    if (!_blocks.empty()) {
+      _current = _blocks.front().data.get();
+      _end = _current + _blocks.front().size;
+    }
+    return;
+  }
+
+  size_t const firstSize = _blocks.front().size;
+  _resourceMonitor.decreaseMemoryUsage(_memoryUsage - firstSize);
+  _blocks.resize(1);
+  _memoryUsage = firstSize;
+  _current = _blocks.front().data.get();
+  _end = _current + firstSize;
+}
+
+void* QueryArena::do_allocate(size_t bytes, size_t alignment) {
+  TRI_ASSERT(alignment > 0 && (alignment & (alignment - 1)) == 0);
+
+  auto align = [alignment](char* p) noexcept {
+    return reinterpret_cast<char*>(
+        (reinterpret_cast<uintptr_t>(p) + alignment - 1) &
+        ~(uintptr_t(alignment) - 1));
+  };
+
+  char* position = _current == nullptr ? nullptr : align(_current);
+  if (position == nullptr || bytes > static_cast<size_t>(_end - position)) {
+    allocateBlock(bytes + alignment);
+    position = align(_current);
+  }
+
+  TRI_ASSERT(position + bytes <= _end);
+  _current = position + bytes;
+  return position;
+}
+
+void QueryArena::allocateBlock(size_t minSize) {
+  // blocks grow geometrically, so that short queries only need a single
+  // block and larger queries need only few allocations overall
+  size_t size = _blocks.empty()
+                    ? kMinBlockSize
+                    : std::min(_blocks.back().size * 2, kMaxBlockSize);
+  size = std::max(size, minSize);
+
+  {
+    ResourceUsageScope scope(_resourceMonitor, size);
+
+    // no need to zero-initialize the memory
+    _blocks.emplace_back(
+        Block{std::make_unique_for_overwrite<char[]>(size), size});
+
+    // now we are responsible for memory usage tracking
+    scope.steal();
+  }
+  _memoryUsage += size;
+
+  char* data = _blocks.back().data.get();
+  _current = data;
+  _end = data + size;
+}
@@ -0,0 +1,110 @@
+////////////////////////////////////////////////////////////////////////////////
+/// DISCLAIMER
+///
+/// Copyright 2014-2023 ArangoDB GmbH, Cologne, Germany
+/// Copyright 2004-2014 triAGENS GmbH, Cologne, Germany
+///
+/// Licensed under the Apache License, Version 2.0 (the "License");
+/// you may not use this file except in compliance with the License.
+/// You may obtain a copy of the License at
+///
+///     http://www.apache.org/licenses/LICENSE-2.0
+///
+/// Unless required by applicable law or agreed to in writing, software
+/// distributed under the License is distributed on an "AS IS" BASIS,
+/// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+/// See the License for the specific language governing permissions and
+/// limitations under the License.
+///
+/// Copyright holder is ArangoDB GmbH, Cologne, Germany
+///
+/// @author Jan Steemann
+////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+#include <vector>
+
+namespace arangodb {
+struct ResourceMonitor;
+
+namespace aql {
+
+/// @brief monotonic memory arena for data that lives as long as a query's
+/// AST, e.g. the member arrays of AstNodes.
+/// memory is bump-allocated from blocks of increasing size, and individual
+/// deallocations are ignored. all memory is returned in one go when the
+/// arena is released or destroyed. the memory of all blocks is tracked in
+/// the query's ResourceMonitor.
+/// the arena is not thread-safe. it must only be used by code that also
+/// creates AstNodes, which is not thread-safe either.
+class QueryArena final : public std::pmr::memory_resource {
+ public:
+  QueryArena(QueryArena const&) = delete;
+  QueryArena& operator=(QueryArena const&) = delete;
+
+  explicit QueryArena(ResourceMonitor& resourceMonitor) noexcept;
+
+  ~QueryArena();
+
+  /// @brief frees all blocks
+  void release() noexcept;
+
+  /// @brief frees all blocks but the first one. we keep one block to avoid
+  /// later memory re-allocations.
+  void releaseMost() noexcept;
+
+  /// @brief total size of all blocks allocated by the arena
+  size_t memoryUsage() const noexcept { return _memoryUsage; }
+
+#ifdef ARANGODB_USE_GOOGLE_TESTS
+  size_t usedBlocks() const noexcept { return _blocks.size(); }
+#endif
+
+  /// @brief size of the first block allocated
+  static constexpr size_t kMinBlockSize = 2048;
+  /// @brief maximum size of blocks created for small allocations. larger
+  /// allocations get a block of their own
+  static constexpr size_t kMaxBlockSize = 64 * 1024;
+
+ private:
+  struct Block {
+    std::unique_ptr<char[]> data;
+    size_t size;
+  };
+
+  void* do_allocate(size_t bytes, size_t alignment) override;
+
+  void do_deallocate(void*, size_t, size_t) noexcept override {
+    // memory is only freed when the whole arena is released
+  }
+
+  bool do_is_equal(
+      std::pmr::memory_resource const& other) const noexcept override {
+    return this == &other;
+  }
+
+  // allocate a new block with at least the given number of bytes
+  void allocateBlock(size_t minSize);
+
+  // resource monitor used for tracking allocations/deallocations
+  ResourceMonitor& _resourceMonitor;
+
+  // all blocks allocated so far. the last one is the current block
+  std::vector<Block> _blocks;
+
+  // total size of all blocks
+  size_t _memoryUsage;
+
+  // current position in the current block
+  char* _current;
+
+  // end of current block
+  char* _end;
+};
+
+}  // namespace aql
+}  // namespace arangodb
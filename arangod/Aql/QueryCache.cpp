@@ -38,6 +38,8 @@
 #include <velocypack/Builder.h>
 #include <velocypack/Slice.h>
 
+#include <algorithm>
+
 using namespace arangodb::aql;
 
 namespace {
@@ -67,6 +69,9 @@ static std::atomic<bool> includeSystem(
 /// cached results
 static bool showBindVars =
     true;  // will be set once on startup. cannot be changed at runtime
+
+/// @brief number of oldest entries considered when an entry must be evicted
+constexpr size_t evictionCandidates = 8;
 }  // namespace
 
 /// @brief create a cache entry
@@ -84,6 +89,9 @@ QueryCacheResultEntry::QueryCacheResultEntry(
       _rows(0),
       _hits(0),
       _stamp(0.0),
+      _maxStaleness(0.0),
+      _invalidated(0.0),
+      _cost(0.0),
       _prev(nullptr),
       _next(nullptr) {
   // add result size
@@ -124,6 +132,16 @@ double QueryCacheResultEntry::executionTime() const {
   return -1.0;
 }
 
+double QueryCacheResultEntry::benefit() const noexcept {
+  if (isStale()) {
+    return 0.0;
+  }
+  // entries that are expensive to compute and that are used often are
+  // worth more than large results of cheap queries
+  double hits = static_cast<double>(_hits.load(std::memory_order_relaxed));
+  return (1.0 + hits) * _cost / static_cast<double>(std::max<size_t>(_size, 1));
+}
+
 void QueryCacheResultEntry::toVelocyPack(VPackBuilder& builder) const {
   builder.openObject();
 
@@ -153,6 +171,7 @@ void QueryCacheResultEntry::toVelocyPack(VPackBuilder& builder) const {
   auto timeString = TRI_StringTimeStamp(_stamp, false);
 
   builder.add("started", VPackValue(timeString));
+  builder.add("stale", VPackValue(isStale()));
 
   builder.add("dataSources", VPackValue(VPackValueType::Array));
 
@@ -214,7 +233,7 @@ void QueryCacheDatabaseEntry::queriesToVelocyPack(VPackBuilder& builder) const {
 /// @brief lookup a query result in the database-specific cache
 std::shared_ptr<QueryCacheResultEntry> QueryCacheDatabaseEntry::lookup(
     uint64_t hash, QueryString const& queryString,
-    std::shared_ptr<VPackBuilder> const& bindVars) const {
+    std::shared_ptr<VPackBuilder> const& bindVars, double maxStaleness) const {
   auto it = _entriesByHash.find(hash);
 
   if (it == _entriesByHash.end()) {
@@ -259,6 +278,14 @@ std::shared_ptr<QueryCacheResultEntry> QueryCacheDatabaseEntry::lookup(
     }
   }
 
+  if (entry->isStale() &&
+      (maxStaleness <= 0.0 ||
+       TRI_microtime() - entry->_invalidated > maxStaleness)) {
+    // the entry was invalidated, and the caller does not accept a result
+    // that is this old
+    return nullptr;
+  }
+
   // all equal -> hit!
   entry->increaseHits();
 
@@ -271,6 +298,7 @@ void QueryCacheDatabaseEntry::store(
     std::shared_ptr<QueryCacheResultEntry>&& entry,
     size_t allowedMaxResultsCount, size_t allowedMaxResultsSize) {
   auto* e = entry.get();
+  e->_cost = std::max(0.0, e->executionTime());
 
   // make room in the cache so the new entry will definitely fit
   enforceMaxResults(allowedMaxResultsCount - 1,
@@ -325,27 +353,41 @@ void QueryCacheDatabaseEntry::store(
 /// @brief invalidate all entries for the given data sources in the
 /// database-specific cache
 void QueryCacheDatabaseEntry::invalidate(
-    std::vector<std::string> const& dataSourceGuids) {
+    std::vector<std::string> const& dataSourceGuids, bool keepStaleEntries) {
   for (auto const& it : dataSourceGuids) {
-    invalidate(it);
+    invalidate(it, keepStaleEntries);
   }
 }
 
 /// @brief invalidate all entries for a data source in the database-specific
 /// cache
-void QueryCacheDatabaseEntry::invalidate(std::string const& dataSourceGuid) {
+void QueryCacheDatabaseEntry::invalidate(std::string const& dataSourceGuid,
+                                         bool keepStaleEntries) {
   auto itr = _entriesByDataSourceGuid.find(dataSourceGuid);
 
   if (itr == _entriesByDataSourceGuid.end()) {
     return;
   }
 
+  // entries that are kept as stale entries. they must still be removed
+  // by later DDL invalidations of the data source
+  containers::FlatHashSet<uint64_t> kept;
+  double const now = TRI_microtime();
+
   for (auto& it2 : itr->second.second) {
     auto it3 = _entriesByHash.find(it2);
 
     if (it3 != _entriesByHash.end()) {
-      // remove entry from the linked list
       auto entry = (*it3).second;
+      if (keepStaleEntries && entry->_maxStaleness > 0.0) {
+        if (!entry->isStale()) {
+          entry->_invalidated = now;
+        }
+        kept.emplace(it2);
+        continue;
+      }
+
+      // remove entry from the linked list
       unlink(entry.get());
 
       // erase it from hash table
@@ -353,7 +395,11 @@ void QueryCacheDatabaseEntry::invalidate(std::string const& dataSourceGuid) {
     }
   }
 
-  _entriesByDataSourceGuid.erase(itr);
+  if (kept.empty()) {
+    _entriesByDataSourceGuid.erase(itr);
+  } else {
+    itr->second.second = std::move(kept);
+  }
 }
 
 /// @brief enforce maximum number of results
@@ -361,32 +407,46 @@ void QueryCacheDatabaseEntry::invalidate(std::string const& dataSourceGuid) {
 void QueryCacheDatabaseEntry::enforceMaxResults(size_t numResults,
                                                 size_t sizeResults) {
   while (_numResults > numResults || _sizeResults > sizeResults) {
-    // too many elements. now wipe the first element from the list
-
-    // copy old _head value as unlink() will change it...
-    auto head = _head;
-    removeDatasources(head);
-    unlink(head);
-    auto it = _entriesByHash.find(head->_hash);
+    // too many elements. now wipe one of the oldest elements from the list
+    auto victim = evictionCandidate();
+    removeDatasources(victim);
+    unlink(victim);
+    auto it = _entriesByHash.find(victim->_hash);
     TRI_ASSERT(it != _entriesByHash.end());
     _entriesByHash.erase(it);
   }
 }
 
+QueryCacheResultEntry* QueryCacheDatabaseEntry::evictionCandidate() const {
+  TRI_ASSERT(_head != nullptr);
+  // the list is ordered by insertion time, so the candidates are the
+  // oldest entries. in case of equal benefits, the oldest entry is evicted
+  QueryCacheResultEntry* candidate = _head;
+  double lowest = candidate->benefit();
+  auto* e = _head->_next;
+  for (size_t i = 1; i < ::evictionCandidates && e != nullptr; ++i) {
+    if (double benefit = e->benefit(); benefit < lowest) {
+      candidate = e;
+      lowest = benefit;
+    }
+    e = e->_next;
+  }
+  return candidate;
+}
+
 /// @brief enforce maximum per-entry size
 /// must be called under the shard's lock
 void QueryCacheDatabaseEntry::enforceMaxEntrySize(size_t value) {
   for (auto it = _entriesByHash.begin(); it != _entriesByHash.end();
        /* no hoisting */) {
-    auto const& entry = (*it).second.get();
+    // erase() invalidates the iterator, so advance it first
+    auto current = it++;
+    auto const& entry = (*current).second.get();
 
     if (entry->_size > value) {
       removeDatasources(entry);
       unlink(entry);
-      it = _entriesByHash.erase(it);
-    } else {
-      // keep the entry
-      ++it;
+      _entriesByHash.erase(current);
     }
   }
 }
@@ -397,11 +457,11 @@ void QueryCacheDatabaseEntry::excludeSystem() {
   for (auto itr = _entriesByDataSourceGuid.begin();  // setup
        itr != _entriesByDataSourceGuid.end();        // condition
        /* no hoisting */) {
-    if (!itr->second.first) {
-      // not a system collection
-      ++itr;
-    } else {
-      for (auto const& hash : itr->second.second) {
+    // erase() invalidates the iterator, so advance it first
+    auto current = itr++;
+    if (current->second.first) {
+      // a system collection
+      for (auto const& hash : current->second.second) {
         auto it2 = _entriesByHash.find(hash);
 
         if (it2 != _entriesByHash.end()) {
@@ -411,7 +471,7 @@ void QueryCacheDatabaseEntry::excludeSystem() {
         }
       }
 
-      itr = _entriesByDataSourceGuid.erase(itr);
+      _entriesByDataSourceGuid.erase(current);
     }
   }
 }
@@ -620,7 +680,7 @@ QueryCacheMode QueryCache::modeString(std::string const& mode) {
 /// @brief lookup a query result in the cache
 std::shared_ptr<QueryCacheResultEntry> QueryCache::lookup(
     TRI_vocbase_t* vocbase, uint64_t hash, QueryString const& queryString,
-    std::shared_ptr<VPackBuilder> const& bindVars) const {
+    std::shared_ptr<VPackBuilder> const& bindVars, double maxStaleness) const {
   auto const part = getPart(vocbase);
   READ_LOCKER(readLocker, _entriesLock[part]);
 
@@ -632,7 +692,7 @@ std::shared_ptr<QueryCacheResultEntry> QueryCache::lookup(
     return nullptr;
   }
 
-  return (*it).second->lookup(hash, queryString, bindVars);
+  return (*it).second->lookup(hash, queryString, bindVars, maxStaleness);
 }
 
 /// @brief store a query in the cache
@@ -689,7 +749,8 @@ void QueryCache::store(TRI_vocbase_t* vocbase,
 
 /// @brief invalidate all queries for the given data sources
 void QueryCache::invalidate(TRI_vocbase_t* vocbase,
-                            std::vector<std::string> const& dataSourceGuids) {
+                            std::vector<std::string> const& dataSourceGuids,
+                            bool dataModification) {
   auto const part = getPart(vocbase);
   WRITE_LOCKER(writeLocker, _entriesLock[part]);
 
@@ -701,7 +762,7 @@ void QueryCache::invalidate(TRI_vocbase_t* vocbase,
   }
 
   // invalidate while holding the lock
-  it->second->invalidate(dataSourceGuids);
+  it->second->invalidate(dataSourceGuids, dataModification);
 }
 
 /// @brief invalidate all queries for a particular data source
@@ -718,7 +779,7 @@ void QueryCache::invalidate(TRI_vocbase_t* vocbase,
   }
 
   // invalidate while holding the lock
-  it->second->invalidate(dataSourceGuid);
+  it->second->invalidate(dataSourceGuid, /*keepStaleEntries*/ false);
 }
 
 /// @brief invalidate all queries for a particular database
@@ -32,6 +32,8 @@
 #include "Aql/QueryString.h"
 #include "Basics/Common.h"
 #include "Basics/ReadWriteLock.h"
+#include "Containers/FlatHashMap.h"
+#include "Containers/FlatHashSet.h"
 
 struct TRI_vocbase_t;
 
@@ -82,12 +84,26 @@ struct QueryCacheResultEntry {
   size_t _rows;
   std::atomic<uint64_t> _hits;
   double _stamp;
+  // maximum staleness (in seconds) tolerated by the query that produced the
+  // entry. entries with a staleness tolerance are kept when they are
+  // invalidated by data modifications, and marked as stale instead
+  double _maxStaleness;
+  // point in time at which the entry was invalidated, 0.0 if still valid
+  double _invalidated;
+  // execution time (in seconds) of the query that produced the entry,
+  // i.e. the cost of recomputing the result. set when the entry is stored
+  double _cost;
   QueryCacheResultEntry* _prev;
   QueryCacheResultEntry* _next;
 
   void increaseHits() { _hits.fetch_add(1, std::memory_order_relaxed); }
+  bool isStale() const noexcept { return _invalidated > 0.0; }
   double executionTime() const;
 
+  /// @brief benefit of keeping the entry in the cache, relative to the
+  /// memory it uses. stale entries have no benefit
+  double benefit() const noexcept;
+
   void toVelocyPack(arangodb::velocypack::Builder& builder) const;
 
   /// current user has all permissions
@@ -104,22 +120,27 @@ struct QueryCacheDatabaseEntry {
   /// @brief destroy a database-specific cache
   ~QueryCacheDatabaseEntry();
 
-  /// @brief lookup a query result in the database-specific cache
+  /// @brief lookup a query result in the database-specific cache. stale
+  /// entries are only returned if they were invalidated at most
+  /// `maxStaleness` seconds ago
   std::shared_ptr<QueryCacheResultEntry> lookup(
       uint64_t hash, QueryString const& queryString,
-      std::shared_ptr<arangodb::velocypack::Builder> const& bindVars) const;
+      std::shared_ptr<arangodb::velocypack::Builder> const& bindVars,
+      double maxStaleness) const;
 
   /// @brief store a query result in the database-specific cache
   void store(std::shared_ptr<QueryCacheResultEntry>&& entry,
              size_t allowedMaxResultsCount, size_t allowedMaxResultsSize);
 
   /// @brief invalidate all entries for the given data sources in the
-  /// database-specific cache
-  void invalidate(std::vector<std::string> const& dataSourceGuids);
+  /// database-specific cache. if `keepStaleEntries` is true, entries with a
+  /// staleness tolerance are marked as stale instead of being removed
+  void invalidate(std::vector<std::string> const& dataSourceGuids,
+                  bool keepStaleEntries);
 
   /// @brief invalidate all entries for a data source in the
   /// database-specific cache
-  void invalidate(std::string const& dataSourceGuid);
+  void invalidate(std::string const& dataSourceGuid, bool keepStaleEntries);
 
   void queriesToVelocyPack(arangodb::velocypack::Builder& builder) const;
 
@@ -127,6 +148,10 @@ struct QueryCacheDatabaseEntry {
   /// must be called under the shard's lock
   void enforceMaxResults(size_t numResults, size_t sizeResults);
 
+  /// @brief pick the entry to evict next. among the oldest entries, this
+  /// is the one with the lowest benefit
+  QueryCacheResultEntry* evictionCandidate() const;
+
   /// @brief enforce maximum size of individual entries
   /// must be called under the shard's lock
   void enforceMaxEntrySize(size_t value);
@@ -145,14 +170,15 @@ struct QueryCacheDatabaseEntry {
   void link(QueryCacheResultEntry*);
 
   /// @brief hash table that maps query hashes to query results
-  std::unordered_map<uint64_t, std::shared_ptr<QueryCacheResultEntry>>
+  containers::FlatHashMap<uint64_t, std::shared_ptr<QueryCacheResultEntry>>
       _entriesByHash;
 
   /// @brief hash table that contains all data souce-specific query results
   ///        maps from data sources GUIDs to a set of query results as defined
   ///        in
   /// _entriesByHash
-  std::unordered_map<std::string, std::pair<bool, std::unordered_set<uint64_t>>>
+  containers::FlatHashMap<std::string,
+                          std::pair<bool, containers::FlatHashSet<uint64_t>>>
       _entriesByDataSourceGuid;
 
   /// @brief beginning of linked list of result entries
@@ -206,18 +232,25 @@ class QueryCache {
   /// @brief return the internal type for a mode string
   static QueryCacheMode modeString(std::string const&);
 
-  /// @brief lookup a query result in the cache
+  /// @brief lookup a query result in the cache. entries that were
+  /// invalidated by data modifications at most `maxStaleness` seconds ago
+  /// are returned as well
   std::shared_ptr<QueryCacheResultEntry> lookup(
       TRI_vocbase_t* vocbase, uint64_t hash, QueryString const& queryString,
-      std::shared_ptr<arangodb::velocypack::Builder> const& bindVars) const;
+      std::shared_ptr<arangodb::velocypack::Builder> const& bindVars,
+      double maxStaleness = 0.0) const;
 
   /// @brief store a query cache entry in the cache
   void store(TRI_vocbase_t* vocbase,
              std::shared_ptr<QueryCacheResultEntry> entry);
 
-  /// @brief invalidate all queries for the given data sources
+  /// @brief invalidate all queries for the given data sources.
+  /// `dataModification` must only be set if the data sources were changed by
+  /// document operations, but not by DDL operations. in this case, entries
+  /// with a staleness tolerance are kept and marked as stale
   void invalidate(TRI_vocbase_t* vocbase,
-                  std::vector<std::string> const& dataSourceGuids);
+                  std::vector<std::string> const& dataSourceGuids,
+                  bool dataModification = false);
 
   /// @brief invalidate all queries for a particular data source
   void invalidate(TRI_vocbase_t* vocbase, std::string const& dataSourceGuid);
@@ -277,7 +310,8 @@ class QueryCache {
   mutable arangodb::basics::ReadWriteLock _entriesLock[numberOfParts];
 
   /// @brief cached query entries, organized per database
-  std::unordered_map<TRI_vocbase_t*, std::unique_ptr<QueryCacheDatabaseEntry>>
+  containers::FlatHashMap<TRI_vocbase_t*,
+                          std::unique_ptr<QueryCacheDatabaseEntry>>
       _entries[numberOfParts];
 };
 }  // namespace aql
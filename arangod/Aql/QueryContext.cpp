@@ -41,17 +41,21 @@
 #include "VocBase/ticks.h"
 #include "VocBase/vocbase.h"
 
+#include <velocypack/Builder.h>
+#include <velocypack/Slice.h>
+
 using namespace arangodb;
 using namespace arangodb::aql;
 
 /// @brief creates a query
 QueryContext::QueryContext(TRI_vocbase_t& vocbase, QueryId id)
-    : _resourceMonitor(GlobalResourceMonitor::instance()),
+    : _resourceMonitor(vocbase.resourceMonitor()),
       _queryId(id ? id : TRI_NewServerSpecificTick()),
       _collections(&vocbase),
       _vocbase(vocbase),
       _execState(QueryExecutionState::ValueType::INVALID_STATE),
-      _numRequests(0) {
+      _numRequests(0),
+      _numAsyncPrefetchTasks(0) {
   // aql analyzers should be able to run even during recovery when AqlFeature
   // is not started. And as optimization - these queries do not need
   // queryRegistry
@@ -89,6 +93,11 @@ std::vector<std::string> QueryContext::collectionNames() const {
 /// @brief return the user that started the query
 std::string const& QueryContext::user() const { return StaticStrings::Empty; }
 
+velocypack::Slice QueryContext::bindParameterValue(
+    std::string_view /*name*/) const {
+  return velocypack::Slice::noneSlice();
+}
+
 /// @brief look up a graph either from our cache list or from the _graphs
 ///        collection
 ResultT<graph::Graph const*> QueryContext::lookupGraphByName(
@@ -127,6 +136,55 @@ void QueryContext::addDataSource(  // track DataSource
 
 aql::Ast* QueryContext::ast() { return _ast.get(); }
 
+bool QueryContext::tryAcquireAsyncPrefetchSlot() noexcept {
+  std::size_t const maxTasks = queryOptions().maxAsyncPrefetchTasks;
+  std::size_t current = _numAsyncPrefetchTasks.load(std::memory_order_relaxed);
+  do {
+    if (current >= maxTasks) {
+      return false;
+    }
+  } while (!_numAsyncPrefetchTasks.compare_exchange_weak(
+      current, current + 1, std::memory_order_relaxed));
+  return true;
+}
+
+void QueryContext::releaseAsyncPrefetchSlot() noexcept {
+  [[maybe_unused]] auto previous =
+      _numAsyncPrefetchTasks.fetch_sub(1, std::memory_order_relaxed);
+  TRI_ASSERT(previous > 0);
+}
+
+void QueryContext::addSetupResult(std::string_view server,
+                                  std::string_view snippetId,
+                                  velocypack::Slice result) {
+  TRI_ASSERT(ServerState::instance()->isCoordinator());
+  auto builder = std::make_shared<velocypack::Builder>();
+  builder->add(result);
+
+  std::string key{server};
+  key.push_back('/');
+  key.append(snippetId);
+
+  std::lock_guard guard{_setupResultsMutex};
+  _setupResults.insert_or_assign(std::move(key), std::move(builder));
+}
+
+std::shared_ptr<velocypack::Builder> QueryContext::takeSetupResult(
+    std::string_view server, std::string_view snippetId) {
+  std::string key{server};
+  key.push_back('/');
+  key.append(snippetId);
+
+  std::lock_guard guard{_setupResultsMutex};
+  auto it = _setupResults.find(key);
+  if (it == _setupResults.end()) {
+    return nullptr;
+  }
+  auto result = std::move(it->second);
+  _setupResults.erase(it);
+  return result;
+}
+
 void QueryContext::enterV8Context() {
   THROW_ARANGO_EXCEPTION_MESSAGE(TRI_ERROR_NOT_IMPLEMENTED,
                                  "V8 support not implemented");
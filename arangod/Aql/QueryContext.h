@@ -27,6 +27,7 @@
 #include "Aql/Graphs.h"
 #include "Aql/QueryExecutionState.h"
 #include "Aql/QueryOptions.h"
+#include "Aql/QueryResourceUsage.h"
 #include "Aql/QueryString.h"
 #include "Aql/QueryWarnings.h"
 #include "Aql/types.h"
@@ -38,6 +39,7 @@
 #include <atomic>
 #include <mutex>
 #include <string>
+#include <string_view>
 #include <unordered_map>
 
 struct TRI_vocbase_t;
@@ -52,8 +54,10 @@ class Methods;
 }  // namespace transaction
 
 namespace velocypack {
+class Builder;
 struct Options;
-}
+class Slice;
+}  // namespace velocypack
 
 namespace graph {
 class Graph;
@@ -92,6 +96,10 @@ class QueryContext {
   /// @brief return the user that started the query
   virtual std::string const& user() const;
 
+  /// @brief return the value of a bind parameter by name. returns a none
+  /// slice if the bind parameter is not known
+  virtual velocypack::Slice bindParameterValue(std::string_view name) const;
+
   /// warnings access is thread safe
   QueryWarnings& warnings() { return _warnings; }
 
@@ -117,6 +125,28 @@ class QueryContext {
     _numRequests.fetch_add(i, std::memory_order_relaxed);
   }
 
+  /// @brief resources used by the query on this server
+  QueryResourceUsage& resourceUsage() noexcept { return _resourceUsage; }
+
+  /// @brief try to reserve a slot for an async prefetch task. returns false
+  /// if the query already has the maximum number of prefetch tasks in flight.
+  /// every successfully acquired slot must be returned via
+  /// releaseAsyncPrefetchSlot()
+  bool tryAcquireAsyncPrefetchSlot() noexcept;
+
+  /// @brief return a slot acquired via tryAcquireAsyncPrefetchSlot()
+  void releaseAsyncPrefetchSlot() noexcept;
+
+  /// @brief store the first batch of a DB server snippet, which the DB server
+  /// has sent back along with its setup response. only used on coordinators
+  void addSetupResult(std::string_view server, std::string_view snippetId,
+                      velocypack::Slice result);
+
+  /// @brief remove and return the first batch that was stored for a DB server
+  /// snippet. returns a nullptr if there is none
+  std::shared_ptr<velocypack::Builder> takeSetupResult(
+      std::string_view server, std::string_view snippetId);
+
   virtual QueryOptions const& queryOptions() const = 0;
 
   virtual QueryOptions& queryOptions() noexcept = 0;
@@ -192,6 +222,19 @@ class QueryContext {
   /// @brief number of HTTP requests executed by the query
   std::atomic<unsigned> _numRequests;
 
+  /// @brief resources used by the query on this server, which were not yet
+  /// moved into the query's execution stats
+  QueryResourceUsage _resourceUsage;
+
+  /// @brief number of async prefetch tasks currently in flight for the query
+  std::atomic<std::size_t> _numAsyncPrefetchTasks;
+
+  /// @brief first batches of DB server snippets that were returned with the
+  /// setup responses, indexed by "server/snippetId"
+  std::mutex _setupResultsMutex;
+  std::unordered_map<std::string, std::shared_ptr<velocypack::Builder>>
+      _setupResults;
+
   /// @brief this mutex is used to serialize execution of potentially concurrent
   /// snippets as a result of using parallel gather.
   /// In the future we might want to consider using an rwlock instead so that
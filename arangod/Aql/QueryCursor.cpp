@@ -32,16 +32,22 @@
 #include "Basics/StringUtils.h"
 #include "Logger/LogMacros.h"
 #include "RestServer/QueryRegistryFeature.h"
+#include "Scheduler/Scheduler.h"
+#include "Scheduler/SchedulerFeature.h"
 #include "StorageEngine/TransactionState.h"
 #include "Transaction/Context.h"
 #include "Transaction/Helpers.h"
 #include "Transaction/Methods.h"
+#include "Utils/ExecContext.h"
 #include "VocBase/vocbase.h"
 
 #include <velocypack/Builder.h>
 #include <velocypack/Dumper.h>
 #include <velocypack/Options.h>
 
+#include <tuple>
+#include <utility>
+
 using namespace arangodb;
 using namespace arangodb::aql;
 using namespace arangodb::basics;
@@ -91,18 +97,32 @@ std::pair<ExecutionState, Result> QueryResultCursor::dump(
 Result QueryResultCursor::dumpSync(VPackBuilder& builder) {
   try {
     size_t const n = batchSize();
-    // reserve an arbitrary number of bytes for the result to save
-    // some reallocs
-    // (not accurate, but the actual size is unknown anyway)
-    builder.reserve(std::max<size_t>(1, std::min<size_t>(n, 10000)) * 32);
-    builder.add("result", VPackValue(VPackValueType::Array, true));
-    for (size_t i = 0; i < n; ++i) {
-      if (!hasNext()) {
-        break;
+    if (_iterator.index() == 0 && _iterator.size() <= n) {
+      // fast path: the complete result fits into this batch. this is the
+      // common case for small results, e.g. lookups of single documents
+      // by primary key. we can copy the entire result array in one go,
+      // without re-adding all the array members individually.
+      TRI_ASSERT(_result.data != nullptr);
+      VPackSlice result = _result.data->slice();
+      builder.reserve(result.byteSize() + 64);
+      builder.add("result", result);
+      while (hasNext()) {
+        _iterator.next();
+      }
+    } else {
+      // reserve an arbitrary number of bytes for the result to save
+      // some reallocs
+      // (not accurate, but the actual size is unknown anyway)
+      builder.reserve(std::max<size_t>(1, std::min<size_t>(n, 10000)) * 32);
+      builder.add("result", VPackValue(VPackValueType::Array, true));
+      for (size_t i = 0; i < n; ++i) {
+        if (!hasNext()) {
+          break;
+        }
+        builder.add(next());
       }
-      builder.add(next());
+      builder.close();
     }
-    builder.close();
 
     builder.add("hasMore", VPackValue(hasNext()));
 
@@ -149,7 +169,8 @@ QueryStreamCursor::QueryStreamCursor(std::shared_ptr<arangodb::aql::Query> q,
       _query(std::move(q)),
       _queryResultPos(0),
       _finalization(false),
-      _allowDirtyReads(false) {
+      _allowDirtyReads(false),
+      _prefetchPending(false) {
   _query->prepareQuery();
   _allowDirtyReads = _query->allowDirtyReads();  // is set by prepareQuery!
   TRI_IF_FAILURE("QueryStreamCursor::directKillAfterPrepare") {
@@ -186,10 +207,32 @@ QueryStreamCursor::QueryStreamCursor(std::shared_ptr<arangodb::aql::Query> q,
     _stateChangeCb = nullptr;
   }
 
+  // background prefetching is not supported for queries that run inside
+  // a JavaScript or streaming transaction, because the transaction may be
+  // used by other operations in between two batches. it also requires that
+  // the user context can be recreated for the background task
+  auto const& exec = ExecContext::current();
+  if (_query->queryOptions().prefetchNextBatch && !_ctx->isV8Context() &&
+      !_ctx->isStreaming() && (!exec.isInternal() || exec.isSuperuser())) {
+    if (!exec.isInternal()) {
+      _prefetchExecContext =
+          ExecContext::create(exec.user(), _query->vocbase().name());
+    }
+    _prefetchState = std::make_shared<PrefetchState>();
+    _prefetchState->cursor = this;
+  }
+
   _query->exitV8Context();
 }
 
 QueryStreamCursor::~QueryStreamCursor() {
+  if (_prefetchState != nullptr) {
+    // wait for a running prefetch task to finish, and make sure that
+    // tasks still in the scheduler queue do not touch the cursor anymore
+    std::lock_guard guard{_prefetchState->mutex};
+    _prefetchState->cursor = nullptr;
+  }
+
   if (!_query) {
     return;
   }
@@ -246,7 +289,16 @@ std::pair<ExecutionState, Result> QueryStreamCursor::dump(
     }
   });
 
+  std::unique_lock<std::mutex> prefetchGuard;
+  if (_prefetchState != nullptr) {
+    prefetchGuard = std::unique_lock{_prefetchState->mutex};
+  }
+
   try {
+    if (_prefetchError != nullptr) {
+      std::rethrow_exception(std::exchange(_prefetchError, nullptr));
+    }
+
     ExecutionState state = prepareDump();
     if (state == ExecutionState::WAITING) {
       return {ExecutionState::WAITING, TRI_ERROR_NO_ERROR};
@@ -314,7 +366,16 @@ Result QueryStreamCursor::dumpSync(VPackBuilder& builder) {
     }
   });
 
+  std::unique_lock<std::mutex> prefetchGuard;
+  if (_prefetchState != nullptr) {
+    prefetchGuard = std::unique_lock{_prefetchState->mutex};
+  }
+
   try {
+    if (_prefetchError != nullptr) {
+      std::rethrow_exception(std::exchange(_prefetchError, nullptr));
+    }
+
     aql::ExecutionEngine* engine = _query->rootEngine();
     TRI_ASSERT(engine != nullptr);
 
@@ -375,6 +436,43 @@ void QueryStreamCursor::resetWakeupHandler() {
   }
 }
 
+void QueryStreamCursor::prefetchNextBatch() {
+  Scheduler* scheduler = SchedulerFeature::SCHEDULER;
+  if (_prefetchState == nullptr || isDeleted() || scheduler == nullptr) {
+    return;
+  }
+
+  // the task only holds a reference to the shared state, so it does not
+  // matter if it is still queued when the cursor is deleted. whether there
+  // is anything to prefetch is checked by the task under the mutex
+  scheduler->queue(RequestLane::CLIENT_AQL, [state = _prefetchState]() {
+    std::lock_guard guard{state->mutex};
+    if (state->cursor != nullptr) {
+      state->cursor->runPrefetch();
+    }
+  });
+}
+
+void QueryStreamCursor::runPrefetch() noexcept {
+  if (!_prefetchPending || _query == nullptr || isDeleted() ||
+      _query->killed()) {
+    return;
+  }
+  _prefetchPending = false;
+
+  ExecContextScope scope(_prefetchExecContext != nullptr
+                             ? _prefetchExecContext.get()
+                             : &ExecContext::superuser());
+  try {
+    // fetches more than a batch worth of rows, as a regular dump would.
+    // if the query has to wait for other servers, the remaining rows are
+    // fetched by the next dump call
+    std::ignore = prepareDump();
+  } catch (...) {
+    _prefetchError = std::current_exception();
+  }
+}
+
 ExecutionState QueryStreamCursor::writeResult(VPackBuilder& builder) {
   ResourceMonitor& resourceMonitor = _query->resourceMonitor();
 
@@ -401,13 +499,23 @@ ExecutionState QueryStreamCursor::writeResult(VPackBuilder& builder) {
   // this is the RegisterId our results can be found in
   RegisterId const resultRegister = engine->resultRegister();
 
+  // stop filling the batch once it has reached this size, so that the
+  // memory used by a batch does not depend on the size of the documents.
+  // at least one row is always written
+  size_t const batchMemoryLimit = _query->queryOptions().batchMemoryLimit;
+  auto batchIsFull = [&](size_t rowsWritten) {
+    return rowsWritten >= batchSize() ||
+           (batchMemoryLimit > 0 && rowsWritten > 0 &&
+            buffer.size() >= batchMemoryLimit);
+  };
+
   size_t rowsWritten = 0;
   auto const& vopts = _query->vpackOptions();
-  while (rowsWritten < batchSize() && !_queryResults.empty()) {
+  while (!batchIsFull(rowsWritten) && !_queryResults.empty()) {
     SharedAqlItemBlockPtr& block = _queryResults.front();
     TRI_ASSERT(_queryResultPos < block->numRows());
 
-    while (rowsWritten < batchSize() && _queryResultPos < block->numRows()) {
+    while (!batchIsFull(rowsWritten) && _queryResultPos < block->numRows()) {
       if (!silent && resultRegister.isValid()) {
         AqlValue const& value =
             block->getValueReference(_queryResultPos, resultRegister);
@@ -451,6 +559,8 @@ ExecutionState QueryStreamCursor::writeResult(VPackBuilder& builder) {
 
   builder.add("cached", VPackValue(false));
 
+  _prefetchPending = hasMore;
+
   if (!hasMore) {
     TRI_ASSERT(!_extrasBuffer.empty());
     builder.add("extra", VPackSlice(_extrasBuffer.data()));
@@ -32,8 +32,12 @@
 #include "VocBase/vocbase.h"
 
 #include <deque>
+#include <exception>
+#include <mutex>
 
 namespace arangodb {
+class ExecContext;
+
 namespace aql {
 
 class AqlItemBlock;
@@ -114,6 +118,8 @@ class QueryStreamCursor final : public arangodb::Cursor {
   void setWakeupHandler(std::function<bool()> const& cb) override final;
   void resetWakeupHandler() override final;
 
+  void prefetchNextBatch() override final;
+
   std::shared_ptr<transaction::Context> context() const override final;
 
   // The following method returns, if the transaction the query is using
@@ -136,6 +142,18 @@ class QueryStreamCursor final : public arangodb::Cursor {
 
   void cleanupStateCallback();
 
+  // fetches the rows for the next batch. called by the background task with
+  // the prefetch mutex held
+  void runPrefetch() noexcept;
+
+  // state shared with background prefetch tasks, which may outlive the
+  // cursor in the scheduler queue
+  struct PrefetchState {
+    std::mutex mutex;
+    // nullptr once the cursor is gone. protected by mutex
+    QueryStreamCursor* cursor;
+  };
+
  private:
   velocypack::UInt8Buffer _extrasBuffer;
   std::deque<SharedAqlItemBlockPtr> _queryResults;  /// buffered results
@@ -151,6 +169,18 @@ class QueryStreamCursor final : public arangodb::Cursor {
 
   bool _allowDirtyReads;  // keep this information when the query is already
                           // gone.
+
+  /// only set if the query was started with the prefetchNextBatch option. the
+  /// mutex serializes all query execution between the regular dump calls
+  /// and background prefetching
+  std::shared_ptr<PrefetchState> _prefetchState;
+  /// user context for background prefetching. nullptr means superuser
+  std::unique_ptr<ExecContext> _prefetchExecContext;
+  /// error that happened during background prefetching. it is reported by
+  /// the next dump call
+  std::exception_ptr _prefetchError;
+  /// whether a batch was handed out and the next batch can be prefetched
+  bool _prefetchPending;
 };
 
 }  // namespace aql
@@ -81,3 +81,8 @@ void QueryExpressionContext::setVariable(Variable const* variable,
 void QueryExpressionContext::clearVariable(Variable const* variable) noexcept {
   _variables.erase(variable);
 }
+
+velocypack::Slice QueryExpressionContext::getBindParameterValue(
+    std::string_view name) const {
+  return _query.bindParameterValue(name);
+}
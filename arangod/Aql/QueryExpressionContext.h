@@ -82,6 +82,9 @@ class QueryExpressionContext : public aql::ExpressionContext {
   // unregister a temporary variable from the ExpressionContext.
   void clearVariable(Variable const* variable) noexcept override;
 
+  velocypack::Slice getBindParameterValue(
+      std::string_view name) const override final;
+
  protected:
   // return temporary variable if set, otherwise call lambda for
   // retrieving variable value
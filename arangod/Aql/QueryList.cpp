@@ -55,7 +55,8 @@ QueryEntryCopy::QueryEntryCopy(
     std::string&& queryString,
     std::shared_ptr<arangodb::velocypack::Builder> const& bindParameters,
     std::vector<std::string> dataSources, double started, double runTime,
-    size_t peakMemoryUsage, QueryExecutionState::ValueType state, bool stream,
+    size_t peakMemoryUsage, std::string tag, QueryResources resources,
+    QueryExecutionState::ValueType state, bool stream,
     std::optional<ErrorCode> resultCode)
     : id(id),
       database(database),
@@ -66,6 +67,8 @@ QueryEntryCopy::QueryEntryCopy(
       started(started),
       runTime(runTime),
       peakMemoryUsage(peakMemoryUsage),
+      tag(std::move(tag)),
+      resources(resources),
       state(state),
       resultCode(resultCode),
       stream(stream) {}
@@ -93,6 +96,10 @@ void QueryEntryCopy::toVelocyPack(velocypack::Builder& out) const {
   out.add("started", VPackValue(timeString));
   out.add("runTime", VPackValue(runTime));
   out.add("peakMemoryUsage", VPackValue(peakMemoryUsage));
+  if (!tag.empty()) {
+    out.add("tag", VPackValue(tag));
+  }
+  resources.toVelocyPack(out);
   out.add("state", VPackValue(aql::QueryExecutionState::toString(state)));
   out.add("stream", VPackValue(stream));
   if (resultCode.has_value()) {
@@ -170,6 +177,18 @@ void QueryList::remove(Query& query) {
 
   _queryRegistryFeature.trackQueryEnd(elapsed);
 
+  // resources used by the query. the resources of DB server snippets have
+  // already been added to the execution stats. resources used locally may
+  // have been added there as well
+  QueryResources resources = query.executionStats().resources;
+  resources.add(query.resourceUsage().load());
+
+  std::string const& tag = query.queryOptions().tag;
+  if (!tag.empty()) {
+    _queryRegistryFeature.trackTaggedQuery(
+        tag, elapsed, query.resourceMonitor().peak(), resources);
+  }
+
   if (!trackSlowQueries()) {
     return;
   }
@@ -220,6 +239,13 @@ void QueryList::remove(Query& query) {
           << ", user: " << query.user() << ", id: " << query.id()
           << ", token: QRY" << query.id()
           << ", peak memory usage: " << query.resourceMonitor().peak()
+          << ", cpu time: " << Logger::FIXED(resources.cpuTime) << " s"
+          << ", block cache hits: " << resources.blockCacheHits
+          << ", block cache misses: " << resources.blockCacheMisses
+          << ", bytes read: " << resources.bytesRead
+          << ", network bytes sent: " << resources.networkBytesSent
+          << ", network bytes received: " << resources.networkBytesReceived
+          << (tag.empty() ? "" : ", tag: ") << tag
           << ", exit code: " << resultCode
           << ", took: " << Logger::FIXED(elapsed) << " s";
 
@@ -232,7 +258,8 @@ void QueryList::remove(Query& query) {
           _trackDataSources ? query.collectionNames()
                             : std::vector<std::string>(),
           now - elapsed, /* start timestamp */
-          elapsed /* run time */, query.resourceMonitor().peak(),
+          elapsed /* run time */, query.resourceMonitor().peak(), tag,
+          resources,
           query.killed() ? QueryExecutionState::ValueType::KILLED
                          : QueryExecutionState::ValueType::FINISHED,
           isStreaming, resultCode);
@@ -340,7 +367,10 @@ std::vector<QueryEntryCopy> QueryList::listCurrent() {
           _trackDataSources ? query.collectionNames()
                             : std::vector<std::string>(),
           now - elapsed /* start timestamp */, elapsed /* run time */,
-          query.resourceMonitor().peak(),
+          query.resourceMonitor().peak(), query.queryOptions().tag,
+          // the execution stats may be modified concurrently, so only the
+          // resources used locally are reported for running queries
+          query.resourceUsage().load(),
           query.killed() ? QueryExecutionState::ValueType::KILLED
                          : query.state(),
           query.queryOptions().stream,
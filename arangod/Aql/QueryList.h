@@ -29,6 +29,7 @@
 #include <optional>
 #include <unordered_map>
 
+#include "Aql/ExecutionStats.h"
 #include "Aql/QueryExecutionState.h"
 #include "Basics/Common.h"
 #include "Basics/ErrorCode.h"
@@ -52,7 +53,8 @@ struct QueryEntryCopy {
       std::string&& queryString,
       std::shared_ptr<arangodb::velocypack::Builder> const& bindParameters,
       std::vector<std::string> dataSources, double started, double runTime,
-      size_t peakMemoryUsage, QueryExecutionState::ValueType state, bool stream,
+      size_t peakMemoryUsage, std::string tag, QueryResources resources,
+      QueryExecutionState::ValueType state, bool stream,
       std::optional<ErrorCode> resultCode);
 
   void toVelocyPack(arangodb::velocypack::Builder& out) const;
@@ -66,6 +68,8 @@ struct QueryEntryCopy {
   double const started;
   double const runTime;
   size_t peakMemoryUsage;
+  std::string tag;
+  QueryResources resources;
   QueryExecutionState::ValueType const state;
   std::optional<ErrorCode> resultCode;
   bool stream;
@@ -31,6 +31,8 @@
 #include <velocypack/Iterator.h>
 #include <velocypack/Slice.h>
 
+#include <algorithm>
+
 using namespace arangodb::aql;
 
 size_t QueryOptions::defaultMemoryLimit = 0U;
@@ -46,6 +48,8 @@ size_t QueryOptions::defaultSpillOverThresholdNumRows = 5000000ULL;
 size_t QueryOptions::defaultSpillOverThresholdMemoryUsage =
     134217728ULL;                                                // 128 MB
 size_t QueryOptions::defaultMaxDNFConditionMembers = 786432ULL;  // 768K
+size_t QueryOptions::defaultBatchMemoryLimit = 16ULL * 1024 * 1024;  // 16MB
+size_t QueryOptions::defaultMaxAsyncPrefetchTasks = 8;
 double QueryOptions::defaultMaxRuntime = 0.0;
 double QueryOptions::defaultTtl;
 bool QueryOptions::defaultFailOnWarning = false;
@@ -60,7 +64,11 @@ QueryOptions::QueryOptions()
       spillOverThresholdMemoryUsage(
           QueryOptions::defaultSpillOverThresholdMemoryUsage),
       maxDNFConditionMembers(QueryOptions::defaultMaxDNFConditionMembers),
+      parallelism(1),
+      batchMemoryLimit(QueryOptions::defaultBatchMemoryLimit),
+      maxAsyncPrefetchTasks(QueryOptions::defaultMaxAsyncPrefetchTasks),
       maxRuntime(0.0),
+      cacheMaxStaleness(0.0),
       satelliteSyncWait(std::chrono::seconds(60)),
       ttl(QueryOptions::defaultTtl),  // get global default ttl
       profile(ProfileLevel::None),
@@ -70,11 +78,13 @@ QueryOptions::QueryOptions()
       explainInternals(true),
       stream(false),
       retriable(false),
+      prefetchNextBatch(false),
       silent(false),
       failOnWarning(
           QueryOptions::defaultFailOnWarning),  // use global "failOnWarning"
                                                 // value
       cache(false),
+      usePlanCache(true),
       fullCount(false),
       count(false),
       skipAudit(false),
@@ -165,11 +175,31 @@ void QueryOptions::fromVelocyPack(VPackSlice slice) {
     maxDNFConditionMembers = value.getNumber<size_t>();
   }
 
+  value = slice.get("parallelism");
+  if (value.isNumber()) {
+    parallelism = std::max<size_t>(1, value.getNumber<size_t>());
+  }
+
+  value = slice.get("batchMemoryLimit");
+  if (value.isNumber()) {
+    batchMemoryLimit = value.getNumber<size_t>();
+  }
+
+  value = slice.get("maxAsyncPrefetchTasks");
+  if (value.isNumber()) {
+    maxAsyncPrefetchTasks = value.getNumber<size_t>();
+  }
+
   value = slice.get("maxRuntime");
   if (value.isNumber()) {
     maxRuntime = value.getNumber<double>();
   }
 
+  value = slice.get("cacheMaxStaleness");
+  if (value.isNumber()) {
+    cacheMaxStaleness = value.getNumber<double>();
+  }
+
   value = slice.get("satelliteSyncWait");
   if (value.isNumber()) {
     satelliteSyncWait =
@@ -213,6 +243,9 @@ void QueryOptions::fromVelocyPack(VPackSlice slice) {
   if (value = slice.get("allowRetry"); value.isBool()) {
     retriable = value.isTrue();
   }
+  if (value = slice.get("prefetchNextBatch"); value.isBool()) {
+    prefetchNextBatch = value.getBool();
+  }
   if (value = slice.get("silent"); value.isBool()) {
     silent = value.getBool();
   }
@@ -222,6 +255,9 @@ void QueryOptions::fromVelocyPack(VPackSlice slice) {
   if (value = slice.get("cache"); value.isBool()) {
     cache = value.getBool();
   }
+  if (value = slice.get("usePlanCache"); value.isBool()) {
+    usePlanCache = value.getBool();
+  }
   if (value = slice.get("fullCount"); value.isBool()) {
     fullCount = value.getBool();
   }
@@ -241,6 +277,18 @@ void QueryOptions::fromVelocyPack(VPackSlice slice) {
     forceOneShardAttributeValue = value.copyString();
   }
 
+  if (value = slice.get("tag"); value.isString()) {
+    tag = value.copyString();
+    if (tag.size() > maxTagLength) {
+      // cut off at a character boundary
+      size_t length = maxTagLength;
+      while (length > 0 && (tag[length] & 0xc0) == 0x80) {
+        --length;
+      }
+      tag.resize(length);
+    }
+  }
+
   VPackSlice optimizer = slice.get("optimizer");
   if (optimizer.isObject()) {
     value = optimizer.get("rules");
@@ -295,7 +343,11 @@ void QueryOptions::toVelocyPack(VPackBuilder& builder,
   builder.add("spillOverThresholdMemoryUsage",
               VPackValue(spillOverThresholdMemoryUsage));
   builder.add("maxDNFConditionMembers", VPackValue(maxDNFConditionMembers));
+  builder.add("parallelism", VPackValue(parallelism));
+  builder.add("batchMemoryLimit", VPackValue(batchMemoryLimit));
+  builder.add("maxAsyncPrefetchTasks", VPackValue(maxAsyncPrefetchTasks));
   builder.add("maxRuntime", VPackValue(maxRuntime));
+  builder.add("cacheMaxStaleness", VPackValue(cacheMaxStaleness));
   builder.add("satelliteSyncWait", VPackValue(satelliteSyncWait.count()));
   builder.add("ttl", VPackValue(ttl));
   builder.add("profile", VPackValue(static_cast<uint32_t>(profile)));
@@ -306,15 +358,20 @@ void QueryOptions::toVelocyPack(VPackBuilder& builder,
   builder.add("explainInternals", VPackValue(explainInternals));
   builder.add("stream", VPackValue(stream));
   builder.add("allowRetry", VPackValue(retriable));
+  builder.add("prefetchNextBatch", VPackValue(prefetchNextBatch));
   builder.add("silent", VPackValue(silent));
   builder.add("failOnWarning", VPackValue(failOnWarning));
   builder.add("cache", VPackValue(cache));
+  builder.add("usePlanCache", VPackValue(usePlanCache));
   builder.add("fullCount", VPackValue(fullCount));
   builder.add("count", VPackValue(count));
   if (!forceOneShardAttributeValue.empty()) {
     builder.add(StaticStrings::ForceOneShardAttributeValue,
                 VPackValue(forceOneShardAttributeValue));
   }
+  if (!tag.empty()) {
+    builder.add("tag", VPackValue(tag));
+  }
 
   // note: skipAudit is intentionally not serialized here.
   // the end user cannot override this setting anyway.
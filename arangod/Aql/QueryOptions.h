@@ -63,8 +63,22 @@ struct QueryOptions {
   size_t spillOverThresholdNumRows;
   size_t spillOverThresholdMemoryUsage;
   size_t maxDNFConditionMembers;
+  // maximum number of threads a single collection scan may use
+  size_t parallelism;
+  // approximate maximum size (in bytes) of a single streaming cursor batch.
+  // batches may contain fewer than batchSize rows if this is exceeded.
+  // 0 means unlimited
+  size_t batchMemoryLimit;
+  // maximum number of async prefetch tasks that a single query may have
+  // queued or running at the same time. only relevant if async prefetching
+  // is enabled for the query. 0 means that no prefetch tasks are spawned
+  size_t maxAsyncPrefetchTasks;
   double maxRuntime;  // query has to execute within the given time or will be
                       // killed
+  // maximum age (in seconds) of a query results cache entry that was already
+  // invalidated by data modifications, so that the query may still be
+  // served from it. 0 means that stale results are never returned
+  double cacheMaxStaleness;
   std::chrono::duration<double> satelliteSyncWait;
 
   double ttl;  // time until query cursor expires - avoids coursors to
@@ -80,6 +94,9 @@ struct QueryOptions {
   bool explainInternals;
   bool stream;
   bool retriable;
+  // streaming cursors only: compute the rows of the next batch in the
+  // background right after a batch was handed out
+  bool prefetchNextBatch;
   // do not return query results
   bool silent;
   // make the query fail if a warning is produced
@@ -87,6 +104,8 @@ struct QueryOptions {
   // whether or not the query result is allowed to be stored in the
   // query results cache
   bool cache;
+  // whether or not the query is allowed to use the execution plan cache
+  bool usePlanCache;
   // whether or not the fullCount should be returned
   bool fullCount;
   bool count;
@@ -98,6 +117,10 @@ struct QueryOptions {
   /// to a single server
   std::string forceOneShardAttributeValue;
 
+  /// @brief user-provided tag for the query. the resources used by tagged
+  /// queries are tracked per tag in the query metrics
+  std::string tag;
+
   /// @brief optimizer rules to turn off/on manually
   std::vector<std::string> optimizerRules;
 
@@ -117,10 +140,15 @@ struct QueryOptions {
   static size_t defaultSpillOverThresholdNumRows;
   static size_t defaultSpillOverThresholdMemoryUsage;
   static size_t defaultMaxDNFConditionMembers;
+  static size_t defaultBatchMemoryLimit;
+  static size_t defaultMaxAsyncPrefetchTasks;
   static double defaultMaxRuntime;
   static double defaultTtl;
   static bool defaultFailOnWarning;
   static bool allowMemoryLimitOverride;
+
+  /// @brief maximum length of a query tag. longer tags are truncated
+  static constexpr std::size_t maxTagLength = 64;
 };
 
 }  // namespace aql
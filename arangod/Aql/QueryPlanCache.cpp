@@ -0,0 +1,369 @@
+////////////////////////////////////////////////////////////////////////////////
+/// DISCLAIMER
+///
+/// Copyright 2014-2023 ArangoDB GmbH, Cologne, Germany
+/// Copyright 2004-2014 triAGENS GmbH, Cologne, Germany
+///
+/// Licensed under the Apache License, Version 2.0 (the "License");
+/// you may not use this file except in compliance with the License.
+/// You may obtain a copy of the License at
+///
+///     http://www.apache.org/licenses/LICENSE-2.0
+///
+/// Unless required by applicable law or agreed to in writing, software
+/// distributed under the License is distributed on an "AS IS" BASIS,
+/// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+/// See the License for the specific language governing permissions and
+/// limitations under the License.
+///
+/// Copyright holder is ArangoDB GmbH, Cologne, Germany
+///
+/// @author Jan Steemann
+////////////////////////////////////////////////////////////////////////////////
+
+#include "QueryPlanCache.h"
+
+#include "Aql/AstNode.h"
+#include "Aql/QueryOptions.h"
+#include "Aql/QueryString.h"
+#include "Basics/ReadLocker.h"
+#include "Basics/VelocyPackHelper.h"
+#include "Basics/WriteLocker.h"
+#include "Basics/fasthash.h"
+
+#include <velocypack/Iterator.h>
+
+#include <algorithm>
+#include <vector>
+
+using namespace arangodb;
+using namespace arangodb::aql;
+
+namespace {
+
+/// @brief simplified type name of a bind parameter value, used for the
+/// plan cache key. we intentionally do not distinguish between the
+/// different velocypack number types here.
+std::string_view shapeTypeName(velocypack::Slice value) noexcept {
+  if (value.isNull()) {
+    return "null";
+  }
+  if (value.isBool()) {
+    return "bool";
+  }
+  if (value.isNumber()) {
+    return "number";
+  }
+  if (value.isString()) {
+    return "string";
+  }
+  if (value.isArray()) {
+    return "array";
+  }
+  if (value.isObject()) {
+    return "object";
+  }
+  return value.typeName();
+}
+
+/// @brief whether or not a bind parameter used as a direct operand of
+/// a node of the given type can be resolved at runtime
+bool isValueOperator(AstNodeType type) noexcept {
+  switch (type) {
+    case NODE_TYPE_OPERATOR_UNARY_PLUS:
+    case NODE_TYPE_OPERATOR_UNARY_MINUS:
+    case NODE_TYPE_OPERATOR_UNARY_NOT:
+    case NODE_TYPE_OPERATOR_BINARY_AND:
+    case NODE_TYPE_OPERATOR_BINARY_OR:
+    case NODE_TYPE_OPERATOR_BINARY_PLUS:
+    case NODE_TYPE_OPERATOR_BINARY_MINUS:
+    case NODE_TYPE_OPERATOR_BINARY_TIMES:
+    case NODE_TYPE_OPERATOR_BINARY_DIV:
+    case NODE_TYPE_OPERATOR_BINARY_MOD:
+    case NODE_TYPE_OPERATOR_BINARY_EQ:
+    case NODE_TYPE_OPERATOR_BINARY_NE:
+    case NODE_TYPE_OPERATOR_BINARY_LT:
+    case NODE_TYPE_OPERATOR_BINARY_LE:
+    case NODE_TYPE_OPERATOR_BINARY_GT:
+    case NODE_TYPE_OPERATOR_BINARY_GE:
+    case NODE_TYPE_OPERATOR_BINARY_IN:
+    case NODE_TYPE_OPERATOR_BINARY_NIN:
+    case NODE_TYPE_OPERATOR_BINARY_ARRAY_EQ:
+    case NODE_TYPE_OPERATOR_BINARY_ARRAY_NE:
+    case NODE_TYPE_OPERATOR_BINARY_ARRAY_LT:
+    case NODE_TYPE_OPERATOR_BINARY_ARRAY_LE:
+    case NODE_TYPE_OPERATOR_BINARY_ARRAY_GT:
+    case NODE_TYPE_OPERATOR_BINARY_ARRAY_GE:
+    case NODE_TYPE_OPERATOR_BINARY_ARRAY_IN:
+    case NODE_TYPE_OPERATOR_BINARY_ARRAY_NIN:
+    case NODE_TYPE_OPERATOR_TERNARY:
+    case NODE_TYPE_OPERATOR_NARY_AND:
+    case NODE_TYPE_OPERATOR_NARY_OR:
+      return true;
+    default:
+      return false;
+  }
+}
+
+struct ParameterUsage {
+  containers::FlatHashSet<std::string> valueParameters;
+  containers::FlatHashSet<std::string> structuralParameters;
+};
+
+/// @brief recursively classify all bind parameters in the AST.
+/// `valueContext` is true if the node is a FILTER condition or is reached
+/// from a FILTER condition by only passing through operator nodes.
+/// returns false if the query cannot use the plan cache
+bool classifyParameters(AstNode const* node, bool valueContext,
+                        ParameterUsage& usage) {
+  if (node == nullptr) {
+    return true;
+  }
+
+  switch (node->type) {
+    case NODE_TYPE_PARAMETER: {
+      auto name = node->getString();
+      if (valueContext) {
+        usage.valueParameters.emplace(std::move(name));
+      } else {
+        usage.structuralParameters.emplace(std::move(name));
+      }
+      return true;
+    }
+    case NODE_TYPE_VIEW:
+      // views can change their links without a DDL operation being tracked,
+      // so we don't cache plans for them
+      return false;
+    case NODE_TYPE_TRAVERSAL:
+    case NODE_TYPE_SHORTEST_PATH:
+    case NODE_TYPE_ENUMERATE_PATHS: {
+      // named graphs are resolved at planning time, and their definitions
+      // can change without a DDL operation being tracked
+      size_t const graphMember = node->type == NODE_TYPE_TRAVERSAL ? 2
+                                 : node->type == NODE_TYPE_SHORTEST_PATH ? 3
+                                                                        : 4;
+      if (node->numMembers() > graphMember) {
+        auto graph = node->getMemberUnchecked(graphMember);
+        if (graph->type == NODE_TYPE_VALUE ||
+            graph->type == NODE_TYPE_PARAMETER) {
+          return false;
+        }
+      }
+      break;
+    }
+    default:
+      break;
+  }
+
+  bool const childContext = node->type == NODE_TYPE_FILTER ||
+                            (valueContext && isValueOperator(node->type));
+
+  size_t const n = node->numMembers();
+  for (size_t i = 0; i < n; ++i) {
+    if (!classifyParameters(node->getMemberUnchecked(i), childContext,
+                            usage)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+}  // namespace
+
+QueryPlanCache::Key::Key(std::string databaseName,
+                         QueryString const& queryString,
+                         velocypack::Slice bindParameters,
+                         QueryOptions const& options)
+    : databaseName(std::move(databaseName)),
+      queryString(queryString.string()) {
+  shape.openObject();
+
+  // bind parameter names and value types. the names are sorted so that
+  // the key does not depend on the order in which the client sent them
+  shape.add("bindVars", VPackValue(VPackValueType::Object));
+  if (bindParameters.isObject()) {
+    std::vector<std::pair<std::string_view, velocypack::Slice>> parameters;
+    for (auto it : VPackObjectIterator(bindParameters, true)) {
+      parameters.emplace_back(it.key.stringView(), it.value);
+    }
+    std::sort(parameters.begin(), parameters.end(),
+              [](auto const& lhs, auto const& rhs) {
+                return lhs.first < rhs.first;
+              });
+    for (auto const& [name, value] : parameters) {
+      shape.add(name, VPackValue(shapeTypeName(value)));
+    }
+  }
+  shape.close();  // bindVars
+
+  // query options that influence the optimizer's choices
+  shape.add("fullCount", VPackValue(options.fullCount));
+  shape.add("maxNumberOfPlans", VPackValue(options.maxNumberOfPlans));
+  shape.add("maxNodesPerCallstack", VPackValue(options.maxNodesPerCallstack));
+  shape.add("maxDNFConditionMembers",
+            VPackValue(options.maxDNFConditionMembers));
+  shape.add("forceOneShardAttributeValue",
+            VPackValue(options.forceOneShardAttributeValue));
+  shape.add("rules", VPackValue(VPackValueType::Array));
+  for (auto const& rule : options.optimizerRules) {
+    shape.add(VPackValue(rule));
+  }
+  shape.close();  // rules
+  shape.add("shardIds", VPackValue(VPackValueType::Array));
+  std::vector<std::string_view> shards(options.restrictToShards.begin(),
+                                       options.restrictToShards.end());
+  std::sort(shards.begin(), shards.end());
+  for (auto const& shard : shards) {
+    shape.add(VPackValue(shard));
+  }
+  shape.close();  // shardIds
+
+  shape.close();
+
+  hash = fasthash64(this->queryString.data(), this->queryString.size(),
+                    0x3123456789abcdef);
+  hash = fasthash64(this->databaseName.data(), this->databaseName.size(),
+                    hash);
+  hash = fasthash64(shape.data(), shape.size(), hash);
+}
+
+bool QueryPlanCache::Key::operator==(Key const& other) const noexcept {
+  return hash == other.hash && databaseName == other.databaseName &&
+         queryString == other.queryString &&
+         shape.slice().binaryEquals(other.shape.slice());
+}
+
+std::size_t QueryPlanCache::Key::memoryUsage() const noexcept {
+  return sizeof(Key) + databaseName.size() + queryString.size() +
+         shape.size();
+}
+
+std::size_t QueryPlanCache::Value::memoryUsage() const noexcept {
+  return sizeof(Value) + plan.size() + structuralParameters.size();
+}
+
+QueryPlanCache::QueryPlanCache(std::size_t maxEntries,
+                               std::size_t maxMemoryUsage)
+    : _maxEntries(maxEntries),
+      _maxMemoryUsage(maxMemoryUsage),
+      _memoryUsage(0),
+      _hits(0),
+      _misses(0) {}
+
+QueryPlanCache::~QueryPlanCache() = default;
+
+std::shared_ptr<QueryPlanCache::Value const> QueryPlanCache::lookup(
+    Key const& key, velocypack::Slice bindParameters, uint64_t ddlVersion) {
+  std::shared_ptr<Value const> value;
+  {
+    READ_LOCKER(guard, _lock);
+    auto it = _entries.find(key);
+    if (it != _entries.end()) {
+      value = it->second;
+    }
+  }
+
+  if (value != nullptr && value->ddlVersion == ddlVersion) {
+    // all structural bind parameters must have the same values as when
+    // the plan was created. the parameter names are guaranteed to be
+    // present because they are part of the key's shape
+    bool matches = true;
+    for (auto it : VPackObjectIterator(value->structuralParameters.slice(),
+                                       /*sequential*/ true)) {
+      velocypack::Slice actual = bindParameters.isObject()
+                                     ? bindParameters.get(it.key.stringView())
+                                     : velocypack::Slice::noneSlice();
+      if (actual.isNone() ||
+          !basics::VelocyPackHelper::equal(it.value, actual, true)) {
+        matches = false;
+        break;
+      }
+    }
+    if (matches) {
+      _hits.fetch_add(1, std::memory_order_relaxed);
+      return value;
+    }
+  }
+
+  _misses.fetch_add(1, std::memory_order_relaxed);
+  return nullptr;
+}
+
+void QueryPlanCache::store(Key&& key, std::shared_ptr<Value const> value) {
+  TRI_ASSERT(value != nullptr);
+  std::size_t const memoryUsage = key.memoryUsage() + value->memoryUsage();
+  if (memoryUsage > _maxMemoryUsage) {
+    // entry alone is larger than the cache
+    return;
+  }
+
+  WRITE_LOCKER(guard, _lock);
+  auto it = _entries.find(key);
+  if (it != _entries.end()) {
+    // replace existing (potentially outdated) entry
+    _memoryUsage -= it->first.memoryUsage() + it->second->memoryUsage();
+    it->second = std::move(value);
+  } else {
+    _entries.emplace(std::move(key), std::move(value));
+  }
+  _memoryUsage += memoryUsage;
+
+  enforceLimits();
+}
+
+void QueryPlanCache::invalidate(std::string_view databaseName) {
+  WRITE_LOCKER(guard, _lock);
+  for (auto it = _entries.begin(); it != _entries.end(); /* no hoisting */) {
+    if (it->first.databaseName == databaseName) {
+      _memoryUsage -= it->first.memoryUsage() + it->second->memoryUsage();
+      _entries.erase(it++);
+    } else {
+      ++it;
+    }
+  }
+}
+
+void QueryPlanCache::invalidateAll() {
+  WRITE_LOCKER(guard, _lock);
+  _entries.clear();
+  _memoryUsage = 0;
+}
+
+QueryPlanCache::Stats QueryPlanCache::stats() const noexcept {
+  Stats result;
+  result.hits = _hits.load(std::memory_order_relaxed);
+  result.misses = _misses.load(std::memory_order_relaxed);
+  {
+    READ_LOCKER(guard, _lock);
+    result.numEntries = _entries.size();
+    result.memoryUsage = _memoryUsage;
+  }
+  return result;
+}
+
+bool QueryPlanCache::collectValueParameters(
+    AstNode const* root, containers::FlatHashSet<std::string>& result) {
+  ParameterUsage usage;
+  if (!classifyParameters(root, /*valueContext*/ false, usage)) {
+    return false;
+  }
+
+  result.clear();
+  for (auto const& name : usage.valueParameters) {
+    // a parameter that is used both as a value and in a structural
+    // position must be injected as a constant everywhere
+    if (!usage.structuralParameters.contains(name)) {
+      result.emplace(name);
+    }
+  }
+  return true;
+}
+
+void QueryPlanCache::enforceLimits() {
+  while (!_entries.empty() &&
+         (_entries.size() > _maxEntries || _memoryUsage > _maxMemoryUsage)) {
+    auto it = _entries.begin();
+    _memoryUsage -= it->first.memoryUsage() + it->second->memoryUsage();
+    _entries.erase(it);
+  }
+}
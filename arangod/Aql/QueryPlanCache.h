@@ -0,0 +1,162 @@
+////////////////////////////////////////////////////////////////////////////////
+/// DISCLAIMER
+///
+/// Copyright 2014-2023 ArangoDB GmbH, Cologne, Germany
+/// Copyright 2004-2014 triAGENS GmbH, Cologne, Germany
+///
+/// Licensed under the Apache License, Version 2.0 (the "License");
+/// you may not use this file except in compliance with the License.
+/// You may obtain a copy of the License at
+///
+///     http://www.apache.org/licenses/LICENSE-2.0
+///
+/// Unless required by applicable law or agreed to in writing, software
+/// distributed under the License is distributed on an "AS IS" BASIS,
+/// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+/// See the License for the specific language governing permissions and
+/// limitations under the License.
+///
+/// Copyright holder is ArangoDB GmbH, Cologne, Germany
+///
+/// @author Jan Steemann
+////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "Basics/ReadWriteLock.h"
+#include "Containers/FlatHashMap.h"
+#include "Containers/FlatHashSet.h"
+
+#include <velocypack/Buffer.h>
+#include <velocypack/Builder.h>
+#include <velocypack/Slice.h>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+
+namespace arangodb::aql {
+struct AstNode;
+struct QueryOptions;
+class QueryString;
+
+/// @brief cache for optimized execution plans.
+/// in contrast to the QueryCache, which caches query results, this cache only
+/// stores the outcome of parsing and optimizing a query, so that repeated
+/// executions of the same parameterized query can skip the parser and the
+/// optimizer and directly instantiate the execution plan from its serialized
+/// form.
+/// Plans are keyed by database name, query string, the shapes (names and
+/// types) of all bind parameters and the query options that affect planning.
+/// Bind parameters that are only used as comparison operands inside FILTER
+/// conditions ("value parameters") are left as parameter nodes in the plan
+/// and are resolved at runtime. The values of all other bind parameters
+/// (collection names, attribute names, etc.) are baked into the plan, so they
+/// are stored with the cache entry and must match for a cache hit.
+/// Entries are invalidated whenever a DDL operation happens (tracked via
+/// the global DDL version number).
+class QueryPlanCache {
+ public:
+  struct Key {
+    Key(std::string databaseName, QueryString const& queryString,
+        velocypack::Slice bindParameters, QueryOptions const& options);
+
+    bool operator==(Key const& other) const noexcept;
+
+    std::string databaseName;
+    std::string queryString;
+    /// @brief velocypack object with bind parameter names and their types,
+    /// plus all query options that affect planning
+    velocypack::Builder shape;
+    std::size_t hash;
+
+    std::size_t memoryUsage() const noexcept;
+  };
+
+  struct KeyHasher {
+    std::size_t operator()(Key const& key) const noexcept { return key.hash; }
+  };
+
+  struct Value {
+    /// @brief serialized, optimized execution plan (incl. collections and
+    /// variables)
+    velocypack::Builder plan;
+    /// @brief values of all bind parameters that were injected into the plan
+    /// as constants. these must be identical for a cache hit
+    velocypack::Builder structuralParameters;
+    /// @brief global DDL version at the time the plan was built
+    uint64_t ddlVersion;
+    bool containsModificationNode;
+    bool containsParallelNode;
+    bool containsUpsertNode;
+    /// @brief whether or not the results of the query can be stored in the
+    /// query results cache
+    bool isResultCacheable;
+
+    std::size_t memoryUsage() const noexcept;
+  };
+
+  struct Stats {
+    uint64_t hits;
+    uint64_t misses;
+    uint64_t numEntries;
+    uint64_t memoryUsage;
+  };
+
+  QueryPlanCache(QueryPlanCache const&) = delete;
+  QueryPlanCache& operator=(QueryPlanCache const&) = delete;
+
+  QueryPlanCache(std::size_t maxEntries, std::size_t maxMemoryUsage);
+  ~QueryPlanCache();
+
+  /// @brief look up a plan. will return a nullptr if there is no plan for
+  /// the key, if the plan was created before the last DDL operation, or if
+  /// the values of structural bind parameters differ
+  std::shared_ptr<Value const> lookup(Key const& key,
+                                      velocypack::Slice bindParameters,
+                                      uint64_t ddlVersion);
+
+  /// @brief store a plan in the cache. will overwrite an existing entry for
+  /// the same key, and will evict arbitrary other entries if the cache is
+  /// full
+  void store(Key&& key, std::shared_ptr<Value const> value);
+
+  /// @brief remove all entries for the given database
+  void invalidate(std::string_view databaseName);
+
+  /// @brief remove all entries
+  void invalidateAll();
+
+  Stats stats() const noexcept;
+
+  /// @brief determine which bind parameters in the AST can be left as
+  /// parameter nodes and be resolved at runtime. these are the parameters
+  /// that are exclusively used as operands of comparison, arithmetic and
+  /// logical operators inside FILTER conditions.
+  /// returns false if the query is not eligible for plan caching at all
+  static bool collectValueParameters(
+      AstNode const* root, containers::FlatHashSet<std::string>& result);
+
+ private:
+  /// @brief evict entries until the cache limits are respected.
+  /// must be called with the write lock held
+  void enforceLimits();
+
+  std::size_t const _maxEntries;
+  std::size_t const _maxMemoryUsage;
+
+  mutable basics::ReadWriteLock _lock;
+
+  containers::FlatHashMap<Key, std::shared_ptr<Value const>, KeyHasher>
+      _entries;
+
+  std::size_t _memoryUsage;
+
+  std::atomic<uint64_t> _hits;
+  std::atomic<uint64_t> _misses;
+};
+
+}  // namespace arangodb::aql
@@ -0,0 +1,116 @@
+////////////////////////////////////////////////////////////////////////////////
+/// DISCLAIMER
+///
+/// Copyright 2014-2023 ArangoDB GmbH, Cologne, Germany
+/// Copyright 2004-2014 triAGENS GmbH, Cologne, Germany
+///
+/// Licensed under the Apache License, Version 2.0 (the "License");
+/// you may not use this file except in compliance with the License.
+/// You may obtain a copy of the License at
+///
+///     http://www.apache.org/licenses/LICENSE-2.0
+///
+/// Unless required by applicable law or agreed to in writing, software
+/// distributed under the License is distributed on an "AS IS" BASIS,
+/// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+/// See the License for the specific language governing permissions and
+/// limitations under the License.
+///
+/// Copyright holder is ArangoDB GmbH, Cologne, Germany
+///
+/// @author Jan Steemann
+////////////////////////////////////////////////////////////////////////////////
+
+#include "QueryResourceUsage.h"
+
+#include <rocksdb/perf_context.h>
+#include <rocksdb/perf_level.h>
+
+#include <time.h>
+
+using namespace arangodb;
+using namespace arangodb::aql;
+
+namespace {
+// whether a QueryResourceUsageScope is active on the current thread
+thread_local bool scopeActive = false;
+
+uint64_t threadCpuTime() noexcept {
+  struct timespec ts;
+  if (clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts) != 0) {
+    return 0;
+  }
+  return static_cast<uint64_t>(ts.tv_sec) * 1000000000ULL +
+         static_cast<uint64_t>(ts.tv_nsec);
+}
+}  // namespace
+
+QueryResources QueryResourceUsage::load() const noexcept {
+  QueryResources result;
+  result.cpuTime =
+      static_cast<double>(_cpuTime.load(std::memory_order_relaxed)) / 1e9;
+  result.blockCacheHits = _blockCacheHits.load(std::memory_order_relaxed);
+  result.blockCacheMisses = _blockCacheMisses.load(std::memory_order_relaxed);
+  result.bytesRead = _bytesRead.load(std::memory_order_relaxed);
+  result.networkBytesSent = _networkBytesSent.load(std::memory_order_relaxed);
+  result.networkBytesReceived =
+      _networkBytesReceived.load(std::memory_order_relaxed);
+  return result;
+}
+
+QueryResources QueryResourceUsage::steal() noexcept {
+  QueryResources result;
+  result.cpuTime = static_cast<double>(_cpuTime.exchange(0)) / 1e9;
+  result.blockCacheHits = _blockCacheHits.exchange(0);
+  result.blockCacheMisses = _blockCacheMisses.exchange(0);
+  result.bytesRead = _bytesRead.exchange(0);
+  result.networkBytesSent = _networkBytesSent.exchange(0);
+  result.networkBytesReceived = _networkBytesReceived.exchange(0);
+  return result;
+}
+
+QueryResourceUsageScope::QueryResourceUsageScope(
+    QueryResourceUsage& usage) noexcept
+    : _usage(nullptr),
+      _cpuTimeStart(0),
+      _blockCacheHitsStart(0),
+      _blockCacheMissesStart(0),
+      _bytesReadStart(0),
+      _previousPerfLevel(0) {
+  if (::scopeActive) {
+    return;
+  }
+  ::scopeActive = true;
+  _usage = &usage;
+
+  // counting is cheap, but timing is not. only enable counting, and
+  // keep a higher level if someone else has set it
+  auto level = rocksdb::GetPerfLevel();
+  _previousPerfLevel = static_cast<int>(level);
+  if (level < rocksdb::PerfLevel::kEnableCount) {
+    rocksdb::SetPerfLevel(rocksdb::PerfLevel::kEnableCount);
+  }
+  auto const* context = rocksdb::get_perf_context();
+  _blockCacheHitsStart = context->block_cache_hit_count;
+  _blockCacheMissesStart = context->block_cache_miss_count;
+  _bytesReadStart = context->block_read_byte;
+  _cpuTimeStart = ::threadCpuTime();
+}
+
+QueryResourceUsageScope::~QueryResourceUsageScope() {
+  if (_usage == nullptr) {
+    return;
+  }
+  auto delta = [](uint64_t start, uint64_t end) noexcept -> uint64_t {
+    // the perf context may have been reset in between
+    return end >= start ? end - start : 0;
+  };
+  auto const* context = rocksdb::get_perf_context();
+  _usage->addCpuTime(delta(_cpuTimeStart, ::threadCpuTime()));
+  _usage->addStorageReads(
+      delta(_blockCacheHitsStart, context->block_cache_hit_count),
+      delta(_blockCacheMissesStart, context->block_cache_miss_count),
+      delta(_bytesReadStart, context->block_read_byte));
+  rocksdb::SetPerfLevel(static_cast<rocksdb::PerfLevel>(_previousPerfLevel));
+  ::scopeActive = false;
+}
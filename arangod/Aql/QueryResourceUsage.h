@@ -0,0 +1,89 @@
+////////////////////////////////////////////////////////////////////////////////
+/// DISCLAIMER
+///
+/// Copyright 2014-2023 ArangoDB GmbH, Cologne, Germany
+/// Copyright 2004-2014 triAGENS GmbH, Cologne, Germany
+///
+/// Licensed under the Apache License, Version 2.0 (the "License");
+/// you may not use this file except in compliance with the License.
+/// You may obtain a copy of the License at
+///
+///     http://www.apache.org/licenses/LICENSE-2.0
+///
+/// Unless required by applicable law or agreed to in writing, software
+/// distributed under the License is distributed on an "AS IS" BASIS,
+/// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+/// See the License for the specific language governing permissions and
+/// limitations under the License.
+///
+/// Copyright holder is ArangoDB GmbH, Cologne, Germany
+///
+/// @author Jan Steemann
+////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "Aql/ExecutionStats.h"
+
+#include <atomic>
+#include <cstdint>
+
+namespace arangodb::aql {
+
+/// @brief resources used by the threads executing the snippets of a query
+/// on the local server. can be updated concurrently
+class QueryResourceUsage {
+ public:
+  void addCpuTime(uint64_t nanoseconds) noexcept {
+    _cpuTime.fetch_add(nanoseconds, std::memory_order_relaxed);
+  }
+
+  void addStorageReads(uint64_t blockCacheHits, uint64_t blockCacheMisses,
+                       uint64_t bytesRead) noexcept {
+    _blockCacheHits.fetch_add(blockCacheHits, std::memory_order_relaxed);
+    _blockCacheMisses.fetch_add(blockCacheMisses, std::memory_order_relaxed);
+    _bytesRead.fetch_add(bytesRead, std::memory_order_relaxed);
+  }
+
+  void addNetworkTransfer(uint64_t sent, uint64_t received) noexcept {
+    _networkBytesSent.fetch_add(sent, std::memory_order_relaxed);
+    _networkBytesReceived.fetch_add(received, std::memory_order_relaxed);
+  }
+
+  /// @brief returns the resources used so far
+  QueryResources load() const noexcept;
+
+  /// @brief returns the resources used so far and resets all counters
+  QueryResources steal() noexcept;
+
+ private:
+  std::atomic<uint64_t> _cpuTime{0};
+  std::atomic<uint64_t> _blockCacheHits{0};
+  std::atomic<uint64_t> _blockCacheMisses{0};
+  std::atomic<uint64_t> _bytesRead{0};
+  std::atomic<uint64_t> _networkBytesSent{0};
+  std::atomic<uint64_t> _networkBytesReceived{0};
+};
+
+/// @brief measures the CPU time and the storage engine reads of the current
+/// thread while the scope is alive, and adds them to the query's resource
+/// usage at the end. nested scopes on the same thread are not counted twice
+class QueryResourceUsageScope {
+ public:
+  explicit QueryResourceUsageScope(QueryResourceUsage& usage) noexcept;
+  ~QueryResourceUsageScope();
+
+  QueryResourceUsageScope(QueryResourceUsageScope const&) = delete;
+  QueryResourceUsageScope& operator=(QueryResourceUsageScope const&) = delete;
+
+ private:
+  // nullptr for nested scopes
+  QueryResourceUsage* _usage;
+  uint64_t _cpuTimeStart;
+  uint64_t _blockCacheHitsStart;
+  uint64_t _blockCacheMissesStart;
+  uint64_t _bytesReadStart;
+  int _previousPerfLevel;
+};
+
+}  // namespace arangodb::aql
@@ -75,12 +75,35 @@ ExecutionBlockImpl<RemoteExecutor>::ExecutionBlockImpl(
       _isResponsibleForInitializeCursor(
           node->isResponsibleForInitializeCursor()),
       _requestInFlight(false),
-      _lastTicket(0) {
+      _lastTicket(0),
+      _hasSetupResult(false),
+      _setupState(ExecutionState::HASMORE),
+      _setupBlock(nullptr),
+      _setupBlockPos(0) {
   TRI_ASSERT(!queryId.empty());
   TRI_ASSERT((arangodb::ServerState::instance()->isCoordinator() &&
               distributeId.empty()) ||
              (!arangodb::ServerState::instance()->isCoordinator() &&
               !distributeId.empty()));
+
+  if (arangodb::ServerState::instance()->isCoordinator()) {
+    // the DB server may have executed the snippet already during setup.
+    // in this case, the snippet has already advanced, and we must serve
+    // the calls from the returned batch first
+    auto setupResult = engine->getQuery().takeSetupResult(server, queryId);
+    if (setupResult != nullptr) {
+      auto result = AqlExecuteResult::fromVelocyPack(
+          setupResult->slice(), engine->itemBlockManager());
+      if (result.fail()) {
+        THROW_ARANGO_EXCEPTION(result.result());
+      }
+      // the batch was produced by a call without an offset
+      TRI_ASSERT(result->skipped().nothingSkipped());
+      _hasSetupResult = true;
+      _setupState = result->state();
+      _setupBlock = result->block();
+    }
+  }
 }
 
 std::pair<ExecutionState, Result> ExecutionBlockImpl<
@@ -246,6 +269,10 @@ auto ExecutionBlockImpl<RemoteExecutor>::executeWithoutTrace(
     return result->asTuple();
   }
 
+  if (_hasSetupResult) {
+    return executeFromSetupResult(stack);
+  }
+
   // We need to send a request here
   auto buffer = serializeExecuteCallBody(stack);
   this->traceExecuteRequest(VPackSlice(buffer.data()), stack);
@@ -261,6 +288,58 @@ auto ExecutionBlockImpl<RemoteExecutor>::executeWithoutTrace(
   return {ExecutionState::WAITING, SkipResult{}, nullptr};
 }
 
+auto ExecutionBlockImpl<RemoteExecutor>::executeFromSetupResult(
+    AqlCallStack const& stack)
+    -> std::tuple<ExecutionState, SkipResult, SharedAqlItemBlockPtr> {
+  TRI_ASSERT(_hasSetupResult);
+  if (ADB_UNLIKELY(stack.subqueryLevel() != 1)) {
+    // the DB server only executes snippets outside of subqueries during setup
+    THROW_ARANGO_EXCEPTION_MESSAGE(
+        TRI_ERROR_INTERNAL,
+        "unexpected subquery call for a snippet executed during setup");
+  }
+  AqlCall const& call = stack.peek();
+
+  size_t available =
+      _setupBlock == nullptr ? 0 : _setupBlock->numRows() - _setupBlockPos;
+  SkipResult skipped{};
+  SharedAqlItemBlockPtr block{nullptr};
+
+  size_t const toSkip = std::min(call.getOffset(), available);
+  _setupBlockPos += toSkip;
+  available -= toSkip;
+  skipped.didSkip(toSkip);
+
+  if (toSkip == call.getOffset()) {
+    if (call.getLimit() > 0) {
+      size_t const toProduce = std::min(call.getLimit(), available);
+      if (toProduce > 0 && toProduce == _setupBlock->numRows()) {
+        // hand out the entire batch without copying
+        block = _setupBlock;
+        _setupBlockPos += toProduce;
+        available -= toProduce;
+      } else if (toProduce > 0) {
+        block = _setupBlock->slice(_setupBlockPos, _setupBlockPos + toProduce);
+        _setupBlockPos += toProduce;
+        available -= toProduce;
+      }
+    } else if (call.needsFullCount()) {
+      // the limit is reached, count the remaining rows
+      _setupBlockPos += available;
+      skipped.didSkip(available);
+      available = 0;
+    }
+  }
+
+  if (available > 0) {
+    return {ExecutionState::HASMORE, skipped, std::move(block)};
+  }
+  // the batch is used up. all further calls will be sent to the DB server
+  _hasSetupResult = false;
+  _setupBlock = nullptr;
+  return {_setupState, skipped, std::move(block)};
+}
+
 auto ExecutionBlockImpl<RemoteExecutor>::deserializeExecuteCallResultBody(
     VPackSlice slice) const -> ResultT<AqlExecuteResult> {
   // Errors should have been caught earlier
@@ -365,6 +444,7 @@ Result ExecutionBlockImpl<RemoteExecutor>::sendAsyncRequest(
   auto req = fuerte::createRequest(type, fuerte::ContentType::VPack);
   req->header.database = _query.vocbase().name();
   req->header.path = urlPart + "/" + _queryId;
+  uint64_t const bytesSent = body.size();
   req->addVPack(std::move(body));
 
   // Later, we probably want to set these sensibly:
@@ -400,6 +480,10 @@ Result ExecutionBlockImpl<RemoteExecutor>::sendAsyncRequest(
         sqs->executeAndWakeup([&] {
           std::lock_guard<std::mutex> guard(_communicationMutex);
           if (_lastTicket == ticket) {
+            if (res != nullptr) {
+              _engine->getQuery().resourceUsage().addNetworkTransfer(
+                  0, res->payloadSize());
+            }
             if (err != fuerte::Error::NoError || res->statusCode() >= 400) {
               _lastError = handleErrorResponse(spec, err, res.get());
             } else {
@@ -413,6 +497,7 @@ Result ExecutionBlockImpl<RemoteExecutor>::sendAsyncRequest(
       });
 
   _engine->getQuery().incHttpRequests(unsigned(1));
+  _engine->getQuery().resourceUsage().addNetworkTransfer(bytesSent, 0);
 
   return {TRI_ERROR_NO_ERROR};
 }
@@ -84,6 +84,11 @@ class ExecutionBlockImpl<RemoteExecutor> : public ExecutionBlock {
   auto executeWithoutTrace(AqlCallStack const& stack)
       -> std::tuple<ExecutionState, SkipResult, SharedAqlItemBlockPtr>;
 
+  /// @brief serve a call from the batch the DB server has sent back with its
+  /// setup response
+  auto executeFromSetupResult(AqlCallStack const& stack)
+      -> std::tuple<ExecutionState, SkipResult, SharedAqlItemBlockPtr>;
+
   [[nodiscard]] auto deserializeExecuteCallResultBody(velocypack::Slice) const
       -> ResultT<AqlExecuteResult>;
   [[nodiscard]] auto serializeExecuteCallBody(
@@ -139,6 +144,18 @@ class ExecutionBlockImpl<RemoteExecutor> : public ExecutionBlock {
   bool _requestInFlight;
 
   unsigned _lastTicket;  /// used to check for canceled requests
+
+  /// @brief whether we are still serving calls from the first batch, which
+  /// the DB server produced during query setup
+  bool _hasSetupResult;
+
+  /// @brief state of the remote snippet after it produced the first batch
+  ExecutionState _setupState;
+
+  /// @brief the rows of the first batch, and the position of the first row
+  /// that was not yet returned
+  SharedAqlItemBlockPtr _setupBlock;
+  size_t _setupBlockPos;
 };
 
 }  // namespace arangodb::aql
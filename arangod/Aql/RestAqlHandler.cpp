@@ -46,6 +46,7 @@
 #include "GeneralServer/RestHandler.h"
 #include "Logger/LogMacros.h"
 #include "Logger/Logger.h"
+#include "Logger/Tracing.h"
 #include "Random/RandomGenerator.h"
 #include "Transaction/Context.h"
 
@@ -728,6 +729,16 @@ RestStatus RestAqlHandler::handleUseQuery(std::string const& operation,
     // shardId is set IFF the root node is scatter or distribute
     TRI_ASSERT(shardId.empty() != (rootNodeType == ExecutionNode::SCATTER ||
                                    rootNodeType == ExecutionNode::DISTRIBUTE));
+    tracing::Span span("aql.snippet.execute", tracing::SpanKind::kInternal);
+    if (span.isRecording()) {
+      span.setAttribute("arangodb.query_id",
+                        static_cast<int64_t>(_engine->getQuery().id()));
+      span.setAttribute("arangodb.engine_id",
+                        static_cast<int64_t>(_engine->engineId()));
+      if (!shardId.empty()) {
+        span.setAttribute("arangodb.shard", shardId);
+      }
+    }
     if (shardId.empty()) {
       std::tie(state, skipped, items) =
           _engine->execute(executeCall.callStack());
@@ -736,6 +747,13 @@ RestStatus RestAqlHandler::handleUseQuery(std::string const& operation,
           _engine->executeForClient(executeCall.callStack(), shardId);
     }
 
+    if (span.isRecording()) {
+      span.setAttribute("arangodb.aql.waiting",
+                        int64_t{state == ExecutionState::WAITING});
+      span.setAttribute("arangodb.aql.rows",
+                        static_cast<int64_t>(items ? items->numRows() : 0));
+    }
+
     if (state == ExecutionState::WAITING) {
       TRI_IF_FAILURE("RestAqlHandler::killWhileWaiting") {
         _queryRegistry->destroyQuery(_engine->engineId(),
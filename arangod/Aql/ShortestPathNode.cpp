@@ -434,6 +434,12 @@ std::unique_ptr<ExecutionBlock> ShortestPathNode::createBlock(
 
     auto usesWeight =
         checkWeight(forwardProviderOptions, backwardProviderOptions);
+    if (auto heuristic = opts->heuristic(false)) {
+      forwardProviderOptions.setHeuristic(std::move(*heuristic));
+    }
+    if (auto heuristic = opts->heuristic(true)) {
+      backwardProviderOptions.setHeuristic(std::move(*heuristic));
+    }
 
     using Provider = SingleServerProvider<SingleServerProviderStep>;
     if (opts->query().queryOptions().getTraversalProfileLevel() ==
@@ -118,17 +118,17 @@ SortExecutor::SortExecutor(Fetcher&, SortExecutorInfos& infos) : _infos(infos) {
 
 SortExecutor::~SortExecutor() = default;
 
-std::tuple<ExecutorState, NoStats, AqlCall> SortExecutor::produceRows(
+std::tuple<ExecutorState, SpillStats, AqlCall> SortExecutor::produceRows(
     AqlItemBlockInputRange& inputRange, OutputAqlItemRow& output) {
   AqlCall upstreamCall{};
+  SpillStats stats;
 
   if (!_inputReady) {
     ExecutorState state = _storageBackend->consumeInputRange(inputRange);
     if (inputRange.upstreamState() == ExecutorState::HASMORE) {
-      return {state, NoStats{}, std::move(upstreamCall)};
+      return {state, stats, std::move(upstreamCall)};
     }
-    _storageBackend->seal();
-    _inputReady = true;
+    sealInput(stats);
   }
 
   while (!output.isFull() && _storageBackend->hasMore()) {
@@ -136,22 +136,23 @@ std::tuple<ExecutorState, NoStats, AqlCall> SortExecutor::produceRows(
   }
 
   if (_storageBackend->hasMore()) {
-    return {ExecutorState::HASMORE, NoStats{}, std::move(upstreamCall)};
+    return {ExecutorState::HASMORE, stats, std::move(upstreamCall)};
   }
-  return {ExecutorState::DONE, NoStats{}, std::move(upstreamCall)};
+  return {ExecutorState::DONE, stats, std::move(upstreamCall)};
 }
 
-std::tuple<ExecutorState, NoStats, size_t, AqlCall> SortExecutor::skipRowsRange(
-    AqlItemBlockInputRange& inputRange, AqlCall& call) {
+std::tuple<ExecutorState, SpillStats, size_t, AqlCall>
+SortExecutor::skipRowsRange(AqlItemBlockInputRange& inputRange,
+                            AqlCall& call) {
   AqlCall upstreamCall{};
+  SpillStats stats;
 
   if (!_inputReady) {
     ExecutorState state = _storageBackend->consumeInputRange(inputRange);
     if (inputRange.upstreamState() == ExecutorState::HASMORE) {
-      return {state, NoStats{}, 0, std::move(upstreamCall)};
+      return {state, stats, 0, std::move(upstreamCall)};
     }
-    _storageBackend->seal();
-    _inputReady = true;
+    sealInput(stats);
   }
 
   while (call.shouldSkip() && _storageBackend->hasMore()) {
@@ -160,9 +161,18 @@ std::tuple<ExecutorState, NoStats, size_t, AqlCall> SortExecutor::skipRowsRange(
   }
 
   if (_storageBackend->hasMore()) {
-    return {ExecutorState::HASMORE, NoStats{}, call.getSkipCount(),
+    return {ExecutorState::HASMORE, stats, call.getSkipCount(),
             std::move(upstreamCall)};
   }
-  return {ExecutorState::DONE, NoStats{}, call.getSkipCount(),
+  return {ExecutorState::DONE, stats, call.getSkipCount(),
           std::move(upstreamCall)};
 }
+
+void SortExecutor::sealInput(SpillStats& stats) {
+  TRI_ASSERT(!_inputReady);
+  _storageBackend->seal();
+  _inputReady = true;
+  // all input has been consumed, so the storage backend will not switch
+  // anymore. report its switches exactly once
+  stats.incrSpills(_storageBackend->numSpillOvers());
+}
@@ -52,7 +52,7 @@ struct AqlCall;
 class AqlItemBlockInputRange;
 class AqlItemBlockManager;
 class RegisterInfos;
-class NoStats;
+class SpillStats;
 class OutputAqlItemRow;
 template<BlockPassthrough>
 class SingleRowFetcher;
@@ -129,7 +129,7 @@ class SortExecutor {
   };
   using Fetcher = SingleRowFetcher<Properties::allowsBlockPassthrough>;
   using Infos = SortExecutorInfos;
-  using Stats = NoStats;
+  using Stats = SpillStats;
 
   SortExecutor(Fetcher&, Infos& infos);
   ~SortExecutor();
@@ -153,6 +153,9 @@ class SortExecutor {
       AqlItemBlockInputRange& inputRange, AqlCall& call);
 
  private:
+  // seal the storage backend after all input has been consumed
+  void sealInput(Stats& stats);
+
   bool _inputReady = false;
   Infos& _infos;
 
@@ -23,6 +23,8 @@
 
 #pragma once
 
+#include <cstddef>
+
 namespace arangodb::aql {
 class AqlItemBlockInputRange;
 enum class ExecutorState;
@@ -54,6 +56,10 @@ class SortedRowsStorageBackend {
   virtual void seal() = 0;
 
   virtual void spillOver(SortedRowsStorageBackend& other) = 0;
+
+  // number of times the backend has spilled over its data into another
+  // backend
+  virtual std::size_t numSpillOvers() const noexcept { return 0; }
 };
 
 }  // namespace arangodb::aql
@@ -34,11 +34,100 @@
 #include "Basics/debugging.h"
 
 #include <algorithm>
+#include <bit>
+#include <cmath>
+#include <optional>
 
 namespace {
 using namespace arangodb;
 using namespace arangodb::aql;
 
+// order-preserving summary of the value of the first sort register of a row.
+// comparing two sort keys is much cheaper than comparing the AqlValues with
+// AqlValue::Compare, which has to dispatch on the VPack types of both values.
+// the sort key is consistent with AqlValue::Compare: if key(a) < key(b), then
+// a < b. if the keys are equal, or if the order cannot be expressed by the
+// key, the values must be compared in full
+struct SortKey {
+  // the type rank, in the same order as AQL compares types. values of other
+  // types always need to be compared in full
+  enum Rank : std::uint8_t {
+    kNull = 0,
+    kBool = 1,
+    kNumber = 2,
+    kString = 3,
+    kArray = 4,
+    kObject = 5,
+    kUnknown = 0xff,
+  };
+
+  static SortKey fromValue(AqlValue const& value) {
+    if (value.isNumber()) {
+      double d = value.toDouble();
+      if (std::isnan(d)) {
+        return {0, kUnknown};
+      }
+      if (d == 0.0) {
+        // -0.0 and 0.0 compare equal
+        d = 0.0;
+      }
+      // map the double to an unsigned integer with the same order
+      auto bits = std::bit_cast<std::uint64_t>(d);
+      if (bits >> 63) {
+        bits = ~bits;
+      } else {
+        bits |= std::uint64_t(1) << 63;
+      }
+      return {bits, kNumber};
+    }
+    if (value.isNull(false)) {
+      return {0, kNull};
+    }
+    if (value.isBoolean()) {
+      return {value.toBoolean() ? 1U : 0U, kBool};
+    }
+    if (value.isString()) {
+      return {0, kString};
+    }
+    if (value.isArray()) {
+      return {0, kArray};
+    }
+    if (value.isObject()) {
+      return {0, kObject};
+    }
+    return {0, kUnknown};
+  }
+
+  // compares the keys. returns std::nullopt if the values need to be compared
+  // in full
+  std::optional<int> compare(SortKey const& other) const noexcept {
+    if (rank == kUnknown || other.rank == kUnknown) {
+      return std::nullopt;
+    }
+    if (rank != other.rank) {
+      return rank < other.rank ? -1 : 1;
+    }
+    if (value != other.value) {
+      return value < other.value ? -1 : 1;
+    }
+    if (rank == kNull || rank == kBool) {
+      // these are fully described by the key
+      return 0;
+    }
+    // e.g. large integers that map to the same double, or strings
+    return std::nullopt;
+  }
+
+  std::uint64_t value;
+  Rank rank;
+};
+
+// row index together with the sort key of the row's first sort register
+struct KeyedRowIndex {
+  SortKey key;
+  SortedRowsStorageBackendMemory::RowIndex index;
+};
+
 // custom AqlValue-aware comparator for sorting
 class OurLessThan {
  public:
@@ -47,11 +136,28 @@ class OurLessThan {
               std::vector<SortRegister> const& sortRegisters) noexcept
       : _vpackOptions(options), _input(input), _sortRegisters(sortRegisters) {}
 
-  bool operator()(SortedRowsStorageBackendMemory::RowIndex const& a,
-                  SortedRowsStorageBackendMemory::RowIndex const& b) const {
+  bool operator()(KeyedRowIndex const& a, KeyedRowIndex const& b) const {
+    TRI_ASSERT(!_sortRegisters.empty());
+    std::optional<int> cmp = a.key.compare(b.key);
+    if (!cmp.has_value()) {
+      // need to compare the values in full
+      return compareFrom(a.index, b.index, 0);
+    }
+    if (*cmp != 0) {
+      return (*cmp < 0) == _sortRegisters[0].asc;
+    }
+    // first sort register is equal, go on with the next ones
+    return compareFrom(a.index, b.index, 1);
+  }
+
+ private:
+  bool compareFrom(SortedRowsStorageBackendMemory::RowIndex const& a,
+                   SortedRowsStorageBackendMemory::RowIndex const& b,
+                   size_t firstRegister) const {
     auto const& left = _input[a.first].get();
     auto const& right = _input[b.first].get();
-    for (auto const& reg : _sortRegisters) {
+    for (size_t i = firstRegister; i < _sortRegisters.size(); ++i) {
+      auto const& reg = _sortRegisters[i];
       AqlValue const& lhs = left->getValueReference(a.second, reg.reg);
       AqlValue const& rhs = right->getValueReference(b.second, reg.reg);
       int const cmp = AqlValue::Compare(_vpackOptions, lhs, rhs, true);
@@ -66,7 +172,6 @@ class OurLessThan {
     return false;
   }
 
- private:
   velocypack::Options const* _vpackOptions;
   std::vector<SharedAqlItemBlockPtr> const& _input;
   std::vector<SortRegister> const& _sortRegisters;
@@ -197,13 +302,35 @@ void SortedRowsStorageBackendMemory::doSorting() {
     THROW_ARANGO_EXCEPTION(TRI_ERROR_DEBUG);
   }
 
+  if (_rowIndexes.size() <= 1) {
+    return;
+  }
+
   // comparison function
   OurLessThan ourLessThan(_infos.vpackOptions(), _inputBlocks,
                           _infos.sortRegisters());
+
+  // compute the sort keys for the first sort register once for every row,
+  // so that most comparisons do not need to look at the AqlValues at all
+  ResourceUsageScope guard(_infos.getResourceMonitor(),
+                           _rowIndexes.size() * sizeof(KeyedRowIndex));
+  std::vector<KeyedRowIndex> keyed;
+  keyed.reserve(_rowIndexes.size());
+  RegisterId reg = _infos.sortRegisters()[0].reg;
+  for (auto const& index : _rowIndexes) {
+    AqlValue const& value =
+        _inputBlocks[index.first]->getValueReference(index.second, reg);
+    keyed.emplace_back(KeyedRowIndex{SortKey::fromValue(value), index});
+  }
+
   if (_infos.stable()) {
-    std::stable_sort(_rowIndexes.begin(), _rowIndexes.end(), ourLessThan);
+    std::stable_sort(keyed.begin(), keyed.end(), ourLessThan);
   } else {
-    std::sort(_rowIndexes.begin(), _rowIndexes.end(), ourLessThan);
+    std::sort(keyed.begin(), keyed.end(), ourLessThan);
+  }
+
+  for (size_t i = 0; i < keyed.size(); ++i) {
+    _rowIndexes[i] = keyed[i].index;
   }
 }
 
@@ -69,6 +69,11 @@ bool SortedRowsStorageBackendStaged::hasReachedCapacityLimit() const noexcept {
   return _backends[_currentBackend]->hasReachedCapacityLimit();
 }
 
+size_t SortedRowsStorageBackendStaged::numSpillOvers() const noexcept {
+  // every switch to the next backend was a spill-over
+  return _currentBackend;
+}
+
 bool SortedRowsStorageBackendStaged::hasMore() const {
   return _backends[_currentBackend]->hasMore();
 }
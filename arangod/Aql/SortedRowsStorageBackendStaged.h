@@ -47,6 +47,7 @@ class SortedRowsStorageBackendStaged final : public SortedRowsStorageBackend {
   void skipOutputRow() noexcept final;
   void seal() final;
   void spillOver(SortedRowsStorageBackend& other) final;
+  size_t numSpillOvers() const noexcept final;
 
  private:
   std::vector<std::unique_ptr<SortedRowsStorageBackend>> _backends;
@@ -31,6 +31,7 @@
 #include "Basics/MemoryTypes/MemoryTypes.h"
 #include "Transaction/Methods.h"
 
+#include <algorithm>
 #include <utility>
 
 using namespace arangodb;
@@ -247,8 +248,8 @@ auto SortingGatherExecutor::initialize(
       _inputRows[dep] = {dep, row, state};
       if (!row && state != ExecutorState::DONE) {
         // This dependency requires input
-        callSet.calls.emplace_back(
-            AqlCallSet::DepCallPair{dep, calculateUpstreamCall(clientCall)});
+        callSet.calls.emplace_back(AqlCallSet::DepCallPair{
+            dep, calculateUpstreamCall(clientCall, /*initialFetch*/ true)});
         if (!_fetchParallel) {
           break;
         }
@@ -508,7 +509,8 @@ auto SortingGatherExecutor::limitReached() const noexcept -> bool {
 }
 
 [[nodiscard]] auto SortingGatherExecutor::calculateUpstreamCall(
-    AqlCall const& clientCall) const noexcept -> AqlCallList {
+    AqlCall const& clientCall, bool initialFetch) const noexcept
+    -> AqlCallList {
   auto upstreamCall = AqlCall{};
   if (constrainedSort()) {
     if (clientCall.hasSoftLimit()) {
@@ -537,6 +539,22 @@ auto SortingGatherExecutor::limitReached() const noexcept -> bool {
       upstreamCall.fullCount = clientCall.fullCount;
       TRI_ASSERT(0 < upstreamCall.hardLimit || upstreamCall.needsFullCount());
     }
+
+    if (initialFetch && _numberDependencies > 1) {
+      // Every dependency delivers its rows in sorted order, so for the
+      // first batch it is enough to ask each of them for (twice) their
+      // fair share of the rows we still have to write. Dependencies whose
+      // rows are all consumed are asked again with the full limit, which
+      // is still bounded by our own limit. This is only a soft limit, so
+      // the dependencies can continue afterwards.
+      size_t share =
+          2 * ((rowsLeftToWrite() + _numberDependencies - 1) /
+               _numberDependencies);
+      share = std::max<size_t>(share, 1);
+      if (share < upstreamCall.getLimit()) {
+        upstreamCall.softLimit = share;
+      }
+    }
   } else {
     // Increase the clientCall limit by it's offset and forward.
     upstreamCall.softLimit = clientCall.softLimit + clientCall.offset;
@@ -193,8 +193,12 @@ class SortingGatherExecutor {
 
   [[nodiscard]] auto limitReached() const noexcept -> bool;
 
-  [[nodiscard]] auto calculateUpstreamCall(
-      AqlCall const& clientCall) const noexcept -> AqlCallList;
+  // initialFetch is set for the very first request to every dependency.
+  // In a constrained sort this only asks for a share of the rows per
+  // dependency, as most dependencies will not contribute to the result
+  [[nodiscard]] auto calculateUpstreamCall(AqlCall const& clientCall,
+                                           bool initialFetch = false) const
+      noexcept -> AqlCallList;
 
  private:
   // Flag if we are past the initialize phase (fetched one block for every
@@ -62,6 +62,29 @@ inline ExecutionStats& operator+=(ExecutionStats& executionStats,
   return executionStats;
 }
 
+// statistics for executors that can switch to a different storage strategy
+// when their input turns out to be larger than expected. the number of
+// switches is only reported in the per-node statistics of query profiles.
+class SpillStats {
+ public:
+  SpillStats() noexcept : _spills(0) {}
+
+  void incrSpills(std::uint64_t value = 1) noexcept { _spills += value; }
+  [[nodiscard]] std::uint64_t getSpills() const noexcept { return _spills; }
+
+  void operator+=(SpillStats const& stats) noexcept {
+    _spills += stats._spills;
+  }
+
+ private:
+  std::uint64_t _spills = 0;
+};
+
+inline ExecutionStats& operator+=(ExecutionStats& executionStats,
+                                  SpillStats const&) noexcept {
+  return executionStats;
+}
+
 class FilterStats {
  public:
   FilterStats() noexcept : _filtered(0) {}
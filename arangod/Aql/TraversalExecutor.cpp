@@ -66,8 +66,9 @@ TraversalExecutorInfos::TraversalExecutorInfos(
     traverser::TraverserOptions::UniquenessLevel vertexUniqueness,
     traverser::TraverserOptions::UniquenessLevel edgeUniqueness,
     traverser::TraverserOptions::Order order, double defaultWeight,
-    std::string weightAttribute, transaction::Methods* trx,
-    arangodb::aql::QueryContext& query,
+    std::string weightAttribute,
+    traverser::TraverserOptions::PathFormat pathFormat,
+    transaction::Methods* trx, arangodb::aql::QueryContext& query,
     arangodb::graph::PathValidatorOptions&& pathValidatorOptions,
     arangodb::graph::OneSidedEnumeratorOptions&& enumeratorOptions,
     ClusterBaseProviderOptions&& clusterBaseProviderOptions, bool isSmart)
@@ -79,6 +80,7 @@ TraversalExecutorInfos::TraversalExecutorInfos(
       _order(order),
       _defaultWeight(defaultWeight),
       _weightAttribute(std::move(weightAttribute)),
+      _pathFormat(pathFormat),
       _trx(trx),
       _query(query) {
   TRI_ASSERT(ServerState::instance()->isCoordinator());
@@ -112,8 +114,9 @@ TraversalExecutorInfos::TraversalExecutorInfos(
     traverser::TraverserOptions::UniquenessLevel vertexUniqueness,
     traverser::TraverserOptions::UniquenessLevel edgeUniqueness,
     traverser::TraverserOptions::Order order, double defaultWeight,
-    std::string weightAttribute, transaction::Methods* trx,
-    arangodb::aql::QueryContext& query,
+    std::string weightAttribute,
+    traverser::TraverserOptions::PathFormat pathFormat,
+    transaction::Methods* trx, arangodb::aql::QueryContext& query,
     arangodb::graph::PathValidatorOptions&& pathValidatorOptions,
     arangodb::graph::OneSidedEnumeratorOptions&& enumeratorOptions,
     graph::SingleServerBaseProviderOptions&& singleServerBaseProviderOptions,
@@ -126,6 +129,7 @@ TraversalExecutorInfos::TraversalExecutorInfos(
       _order(order),
       _defaultWeight(defaultWeight),
       _weightAttribute(std::move(weightAttribute)),
+      _pathFormat(pathFormat),
       _trx(trx),
       _query(query) {
   // _fixedSource XOR _inputRegister
@@ -245,6 +249,10 @@ TraverserOptions::Order TraversalExecutorInfos::getOrder() const {
   return _order;
 }
 
+TraverserOptions::PathFormat TraversalExecutorInfos::getPathFormat() const {
+  return _pathFormat;
+}
+
 transaction::Methods* TraversalExecutorInfos::getTrx() { return _trx; }
 
 arangodb::aql::QueryContext& TraversalExecutorInfos::getQuery() {
@@ -415,7 +423,12 @@ auto TraversalExecutor::doOutput(OutputAqlItemRow& output) -> void {
     // Path variable (p)
     if (_infos.usePathOutput()) {
       tmp->clear();
-      currentPath->toVelocyPack(*tmp.builder());
+      if (_infos.getPathFormat() ==
+          TraverserOptions::PathFormat::SHARED_PREFIXES) {
+        currentPath->toSharedPrefixVelocyPack(*tmp.builder(), _emittedPaths);
+      } else {
+        currentPath->toVelocyPack(*tmp.builder());
+      }
       AqlValue path{tmp->slice()};
       AqlValueGuard guard{path, true};
       output.moveValueInto(_infos.pathRegister(), _inputRow, guard);
@@ -527,6 +540,9 @@ bool TraversalExecutor::initTraverser(AqlItemBlockInputRange& input) {
       _ast.clearMost();
       traversalEnumerator()->prepareIndexExpressions(&_ast);
 
+      // path ids are only unique per start vertex
+      _emittedPaths.clear();
+
       // start actual search
       traversalEnumerator()->reset(toHashedStringRef(
           sourceString));  // TODO [GraphRefactor]: check sourceString memory
@@ -72,8 +72,9 @@ class TraversalExecutorInfos {
       traverser::TraverserOptions::UniquenessLevel vertexUniqueness,
       traverser::TraverserOptions::UniquenessLevel edgeUniqueness,
       traverser::TraverserOptions::Order order, double defaultWeight,
-      std::string weightAttribute, transaction::Methods* trx,
-      arangodb::aql::QueryContext& query,
+      std::string weightAttribute,
+      traverser::TraverserOptions::PathFormat pathFormat,
+      transaction::Methods* trx, arangodb::aql::QueryContext& query,
       arangodb::graph::PathValidatorOptions&& pathValidatorOptions,
       arangodb::graph::OneSidedEnumeratorOptions&& enumeratorOptions,
       graph::ClusterBaseProviderOptions&& clusterBaseProviderOptions,
@@ -92,8 +93,9 @@ class TraversalExecutorInfos {
       traverser::TraverserOptions::UniquenessLevel vertexUniqueness,
       traverser::TraverserOptions::UniquenessLevel edgeUniqueness,
       traverser::TraverserOptions::Order order, double defaultWeight,
-      std::string weightAttribute, transaction::Methods* trx,
-      arangodb::aql::QueryContext& query,
+      std::string weightAttribute,
+      traverser::TraverserOptions::PathFormat pathFormat,
+      transaction::Methods* trx, arangodb::aql::QueryContext& query,
       arangodb::graph::PathValidatorOptions&& pathValidatorOptions,
       arangodb::graph::OneSidedEnumeratorOptions&& enumeratorOptions,
       graph::SingleServerBaseProviderOptions&& singleServerBaseProviderOptions,
@@ -156,6 +158,7 @@ class TraversalExecutorInfos {
   traverser::TraverserOptions::UniquenessLevel getUniqueVertices() const;
   traverser::TraverserOptions::UniquenessLevel getUniqueEdges() const;
   traverser::TraverserOptions::Order getOrder() const;
+  traverser::TraverserOptions::PathFormat getPathFormat() const;
   transaction::Methods* getTrx();
   arangodb::aql::QueryContext& getQuery();
   arangodb::aql::QueryWarnings& getWarnings();
@@ -180,6 +183,7 @@ class TraversalExecutorInfos {
   traverser::TraverserOptions::Order _order;
   double _defaultWeight;
   std::string _weightAttribute;
+  traverser::TraverserOptions::PathFormat _pathFormat;
   transaction::Methods* _trx;
   arangodb::aql::QueryContext& _query;
 };
@@ -229,6 +233,10 @@ class TraversalExecutor {
   Ast _ast;
   InputAqlItemRow _inputRow;
 
+  /// @brief ids of the paths produced for the current start vertex, only
+  /// used with the shared prefixes path format
+  std::vector<bool> _emittedPaths;
+
   /// @brief the refactored finder variant.
   arangodb::graph::TraversalEnumerator* _traversalEnumerator;
 };
@@ -32,6 +32,7 @@
 #include "Aql/ExecutionPlan.h"
 #include "Aql/Expression.h"
 #include "Aql/GraphNode.h"
+#include "Aql/ProfileLevel.h"
 #include "Aql/RegisterPlan.h"
 #include "Aql/SingleRowFetcher.h"
 #include "Aql/SortCondition.h"
@@ -614,7 +615,9 @@ std::vector<IndexAccessor> TraversalNode::buildIndexAccessor(
     auto& trx = plan()->getAst()->query().trxForOptimization();
     bool res = aql::utils::getBestIndexHandleForFilterCondition(
         trx, *_edgeColls[i], indexCondition, options()->tmpVar(),
-        itemsInCollection, aql::IndexHint(), indexToUse, onlyEdgeIndexes);
+        itemsInCollection, aql::IndexHint(), indexToUse, onlyEdgeIndexes,
+        dir == TRI_EDGE_IN ? StaticStrings::ToString
+                           : StaticStrings::FromString);
     if (!res) {
       THROW_ARANGO_EXCEPTION_MESSAGE(TRI_ERROR_INTERNAL,
                                      "expected edge index not found");
@@ -678,8 +681,10 @@ std::unique_ptr<ExecutionBlock> TraversalNode::createBlock(
     bool isSmart) const {
   TraverserOptions* opts = this->options();
 
-  arangodb::graph::OneSidedEnumeratorOptions options{opts->minDepth,
-                                                     opts->maxDepth};
+  // per-depth statistics are reported in the node statistics of profiles
+  arangodb::graph::OneSidedEnumeratorOptions options{
+      opts->minDepth, opts->maxDepth,
+      opts->query().queryOptions().getProfileLevel() >= ProfileLevel::Blocks};
   /*
    * PathValidator Disjoint Helper (TODO [GraphRefactor]: Copy from createBlock)
    * Clean this up as soon we clean up the whole TraversalNode as well.
@@ -737,7 +742,8 @@ std::unique_ptr<ExecutionBlock> TraversalNode::createBlock(
                                                   // SingleServer, Cluster...
         outputRegisterMapping, getStartVertex(), inputRegister,
         plan()->getAst(), opts->uniqueVertices, opts->uniqueEdges, opts->mode,
-        opts->defaultWeight, opts->weightAttribute, opts->trx(), opts->query(),
+        opts->defaultWeight, opts->weightAttribute, opts->pathFormat,
+        opts->trx(), opts->query(),
         std::move(validatorOptions), std::move(options),
         std::move(clusterBaseProviderOptions), isSmart);
 
@@ -751,7 +757,8 @@ std::unique_ptr<ExecutionBlock> TraversalNode::createBlock(
                                                   // SingleServer, Cluster...
         outputRegisterMapping, getStartVertex(), inputRegister,
         plan()->getAst(), opts->uniqueVertices, opts->uniqueEdges, opts->mode,
-        opts->defaultWeight, opts->weightAttribute, opts->trx(), opts->query(),
+        opts->defaultWeight, opts->weightAttribute, opts->pathFormat,
+        opts->trx(), opts->query(),
         std::move(validatorOptions), std::move(options),
         std::move(singleServerBaseProviderOptions), isSmart);
 
@@ -790,14 +797,19 @@ TraversalNode::getSingleServerBaseProviderOptions(
       usedIndexes{};
   usedIndexes.first = buildUsedIndexes();
   usedIndexes.second = buildUsedDepthBasedIndexes();
-  return {opts->tmpVar(),
-          std::move(usedIndexes),
-          opts->getExpressionCtx(),
-          filterConditionVariables,
-          opts->collectionToShard(),
-          opts->getVertexProjections(),
-          opts->getEdgeProjections(),
-          opts->produceVertices()};
+  SingleServerBaseProviderOptions providerOptions{
+      opts->tmpVar(),
+      std::move(usedIndexes),
+      opts->getExpressionCtx(),
+      filterConditionVariables,
+      opts->collectionToShard(),
+      opts->getVertexProjections(),
+      opts->getEdgeProjections(),
+      opts->produceVertices()};
+  providerOptions.setUseGraphSnapshot(opts->useGraphSnapshot);
+  providerOptions.setDegreeLimits(DegreeLimits{
+      opts->maxEdgesPerVertex, opts->sampleEdges, opts->maxVertexDegree});
+  return providerOptions;
 }
 
 /// @brief creates corresponding ExecutionBlock
@@ -25,6 +25,7 @@
 
 #include <cstddef>
 #include <cstdint>
+#include <vector>
 
 #include "ExecutionStats.h"
 
@@ -52,6 +53,7 @@ class TraversalStats {
     _cursorsRearmed = 0;
     _cacheHits = 0;
     _cacheMisses = 0;
+    _depths.clear();
   }
 
   void incrFiltered(std::uint64_t value = 1) noexcept { _filtered += value; }
@@ -95,6 +97,18 @@ class TraversalStats {
     return _cacheMisses;
   }
 
+  // per-depth statistics, only collected for query profiles
+  [[nodiscard]] TraversalDepthStats& depthStats(std::size_t depth) {
+    if (_depths.size() <= depth) {
+      _depths.resize(depth + 1);
+    }
+    return _depths[depth];
+  }
+  [[nodiscard]] std::vector<TraversalDepthStats> const& getDepths()
+      const noexcept {
+    return _depths;
+  }
+
   void operator+=(TraversalStats const& other) {
     _filtered += other._filtered;
     _scannedIndex += other._scannedIndex;
@@ -103,6 +117,7 @@ class TraversalStats {
     _cursorsRearmed += other._cursorsRearmed;
     _cacheHits += other._cacheHits;
     _cacheMisses += other._cacheMisses;
+    addTraversalDepthStats(_depths, other._depths);
   }
 
  private:
@@ -113,6 +128,9 @@ class TraversalStats {
   std::uint64_t _cursorsRearmed = 0;
   std::uint64_t _cacheHits = 0;
   std::uint64_t _cacheMisses = 0;
+  // not part of inspect(), as the per-depth statistics are collected by
+  // the enumerator of the traversal and not by traverser engines
+  std::vector<TraversalDepthStats> _depths;
 };
 
 inline ExecutionStats& operator+=(
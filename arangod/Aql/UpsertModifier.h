@@ -23,6 +23,7 @@
 
 #pragma once
 
+#include "Aql/ExecutionBlock.h"
 #include "Aql/ModificationExecutor.h"
 #include "Aql/ModificationExecutorAccumulator.h"
 #include "Aql/ModificationExecutorInfos.h"
@@ -98,9 +99,11 @@ class UpsertModifier {
 
         // Batch size has to be 1 so that the upsert modifier sees its own
         // writes.
-        // This behaviour could be improved, if we can prove that an UPSERT
-        // does not need to see its own writes
-        _batchSize(1),
+        // If the user has opted out of this via the "readOwnWrites" option,
+        // the lookups for all rows of one batch are executed before any of
+        // the rows is written, and inserts and updates are sent to the
+        // storage layer in batches
+        _batchSize(infos._readOwnWrites ? 1 : ExecutionBlock::DefaultBatchSize),
         _resultState(ModificationExecutorResultState::NoResult) {}
 
   ~UpsertModifier() = default;
@@ -0,0 +1,304 @@
+////////////////////////////////////////////////////////////////////////////////
+/// DISCLAIMER
+///
+/// Copyright 2014-2023 ArangoDB GmbH, Cologne, Germany
+/// Copyright 2004-2014 triAGENS GmbH, Cologne, Germany
+///
+/// Licensed under the Apache License, Version 2.0 (the "License");
+/// you may not use this file except in compliance with the License.
+/// You may obtain a copy of the License at
+///
+///     http://www.apache.org/licenses/LICENSE-2.0
+///
+/// Unless required by applicable law or agreed to in writing, software
+/// distributed under the License is distributed on an "AS IS" BASIS,
+/// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+/// See the License for the specific language governing permissions and
+/// limitations under the License.
+///
+/// Copyright holder is ArangoDB GmbH, Cologne, Germany
+///
+/// @author Jan Steemann
+////////////////////////////////////////////////////////////////////////////////
+
+#include "UserFunctionExpressionCache.h"
+
+#include "Aql/Ast.h"
+#include "Aql/AstNode.h"
+#include "Aql/Function.h"
+#include "Aql/Query.h"
+#include "Aql/QueryResult.h"
+#include "Aql/QueryString.h"
+#include "Basics/Exceptions.h"
+#include "Basics/ScopeGuard.h"
+#include "Basics/StaticStrings.h"
+#include "Basics/StringUtils.h"
+#include "Basics/system-functions.h"
+#include "Cluster/ServerState.h"
+#include "Logger/LogMacros.h"
+#include "RestServer/DatabaseFeature.h"
+#include "Transaction/StandaloneContext.h"
+#include "Utils/ExecContext.h"
+#include "Utils/VersionTracker.h"
+#include "VocBase/vocbase.h"
+
+#include <absl/strings/str_cat.h>
+#include <velocypack/Iterator.h>
+
+#include <algorithm>
+
+using namespace arangodb;
+using namespace arangodb::aql;
+
+namespace {
+// interval (in seconds) after which coordinators reload the expression
+// functions, because changes made via other coordinators are not tracked
+// by the local DDL version
+constexpr double coordinatorReloadInterval = 10.0;
+
+// set while the body of an expression function is compiled. expression
+// functions are not inlined into the bodies of other expression functions,
+// so that the cache never has to be consulted while it is being loaded
+thread_local bool compilingFunctionBody = false;
+
+bool isAllowedInBody(AstNode const* node,
+                     std::vector<std::string> const& parameters,
+                     bool& isDeterministic, std::string& error) {
+  switch (node->type) {
+    case NODE_TYPE_VALUE:
+    case NODE_TYPE_ARRAY:
+    case NODE_TYPE_OBJECT:
+    case NODE_TYPE_OBJECT_ELEMENT:
+    case NODE_TYPE_CALCULATED_OBJECT_ELEMENT:
+    case NODE_TYPE_ATTRIBUTE_ACCESS:
+    case NODE_TYPE_BOUND_ATTRIBUTE_ACCESS:
+    case NODE_TYPE_INDEXED_ACCESS:
+    case NODE_TYPE_RANGE:
+    case NODE_TYPE_QUANTIFIER:
+    case NODE_TYPE_OPERATOR_UNARY_PLUS:
+    case NODE_TYPE_OPERATOR_UNARY_MINUS:
+    case NODE_TYPE_OPERATOR_UNARY_NOT:
+    case NODE_TYPE_OPERATOR_BINARY_AND:
+    case NODE_TYPE_OPERATOR_BINARY_OR:
+    case NODE_TYPE_OPERATOR_BINARY_PLUS:
+    case NODE_TYPE_OPERATOR_BINARY_MINUS:
+    case NODE_TYPE_OPERATOR_BINARY_TIMES:
+    case NODE_TYPE_OPERATOR_BINARY_DIV:
+    case NODE_TYPE_OPERATOR_BINARY_MOD:
+    case NODE_TYPE_OPERATOR_BINARY_EQ:
+    case NODE_TYPE_OPERATOR_BINARY_NE:
+    case NODE_TYPE_OPERATOR_BINARY_LT:
+    case NODE_TYPE_OPERATOR_BINARY_LE:
+    case NODE_TYPE_OPERATOR_BINARY_GT:
+    case NODE_TYPE_OPERATOR_BINARY_GE:
+    case NODE_TYPE_OPERATOR_BINARY_IN:
+    case NODE_TYPE_OPERATOR_BINARY_NIN:
+    case NODE_TYPE_OPERATOR_BINARY_ARRAY_EQ:
+    case NODE_TYPE_OPERATOR_BINARY_ARRAY_NE:
+    case NODE_TYPE_OPERATOR_BINARY_ARRAY_LT:
+    case NODE_TYPE_OPERATOR_BINARY_ARRAY_LE:
+    case NODE_TYPE_OPERATOR_BINARY_ARRAY_GT:
+    case NODE_TYPE_OPERATOR_BINARY_ARRAY_GE:
+    case NODE_TYPE_OPERATOR_BINARY_ARRAY_IN:
+    case NODE_TYPE_OPERATOR_BINARY_ARRAY_NIN:
+    case NODE_TYPE_OPERATOR_NARY_AND:
+    case NODE_TYPE_OPERATOR_NARY_OR:
+    case NODE_TYPE_OPERATOR_TERNARY:
+      return true;
+
+    case NODE_TYPE_PARAMETER: {
+      if (std::find(parameters.begin(), parameters.end(),
+                    node->getStringView()) == parameters.end()) {
+        error = absl::StrCat("undeclared parameter '@", node->getStringView(),
+                             "'");
+        return false;
+      }
+      return true;
+    }
+
+    case NODE_TYPE_FCALL: {
+      auto const* func = static_cast<Function const*>(node->getData());
+      if (!func->hasCxxImplementation() ||
+          func->hasFlag(Function::Flags::CanReadDocuments)) {
+        error = absl::StrCat("function '", func->name,
+                             "()' cannot be used in an expression function");
+        return false;
+      }
+      if (!func->hasFlag(Function::Flags::Deterministic)) {
+        isDeterministic = false;
+      }
+      return true;
+    }
+
+    case NODE_TYPE_FCALL_USER:
+      error = "calling other user-defined functions is not supported";
+      return false;
+
+    default:
+      error = absl::StrCat("'", node->getTypeString(),
+                           "' is not supported in an expression function");
+      return false;
+  }
+}
+
+}  // namespace
+
+UserFunctionExpressionCache& UserFunctionExpressionCache::instance() {
+  static UserFunctionExpressionCache cache;
+  return cache;
+}
+
+std::shared_ptr<UserFunctionExpression const>
+UserFunctionExpressionCache::lookup(TRI_vocbase_t& vocbase,
+                                    std::string_view name) {
+  if (compilingFunctionBody) {
+    return nullptr;
+  }
+
+  uint64_t const ddlVersion = vocbase.server()
+                                  .getFeature<DatabaseFeature>()
+                                  .versionTracker()
+                                  ->current();
+
+  std::shared_ptr<Functions const> functions;
+  {
+    std::lock_guard guard{_mutex};
+    if (auto it = _databases.find(vocbase.name()); it != _databases.end()) {
+      functions = it->second;
+    }
+  }
+
+  if (functions == nullptr || functions->ddlVersion != ddlVersion ||
+      (ServerState::instance()->isCoordinator() &&
+       TRI_microtime() - functions->loadTime >= coordinatorReloadInterval)) {
+    functions = load(vocbase, ddlVersion);
+
+    std::lock_guard guard{_mutex};
+    _databases[vocbase.name()] = functions;
+  }
+
+  if (auto it = functions->byName.find(std::string(name));
+      it != functions->byName.end()) {
+    return it->second;
+  }
+  return nullptr;
+}
+
+Result UserFunctionExpressionCache::compile(
+    TRI_vocbase_t& vocbase, std::string_view expression,
+    std::vector<std::string> const& parameters, velocypack::Builder& body,
+    bool& isDeterministic) {
+  bool const wasCompiling = compilingFunctionBody;
+  compilingFunctionBody = true;
+  auto guard = scopeGuard(
+      [wasCompiling]() noexcept { compilingFunctionBody = wasCompiling; });
+
+  auto query = Query::create(
+      transaction::StandaloneContext::Create(vocbase),
+      QueryString(absl::StrCat("RETURN (", expression, "\n)")), nullptr);
+  QueryResult parsed = query->parse();
+  if (parsed.result.fail()) {
+    return Result(TRI_ERROR_QUERY_FUNCTION_INVALID_CODE,
+                  absl::StrCat("invalid expression: ",
+                               parsed.result.errorMessage()));
+  }
+
+  AstNode const* root = query->ast()->root();
+  if (root->numMembers() != 1 ||
+      root->getMemberUnchecked(0)->type != NODE_TYPE_RETURN) {
+    // e.g. a subquery, which is turned into a LET statement
+    return Result(TRI_ERROR_QUERY_FUNCTION_INVALID_CODE,
+                  "invalid expression: subqueries are not supported in an "
+                  "expression function");
+  }
+  AstNode const* node = root->getMemberUnchecked(0)->getMemberUnchecked(0);
+
+  isDeterministic = true;
+  std::string error;
+  Ast::traverseReadOnly(
+      node,
+      [&](AstNode const* n) {
+        // do not descend any further once an error was found
+        return error.empty() &&
+               isAllowedInBody(n, parameters, isDeterministic, error);
+      },
+      [](AstNode const*) {});
+  if (!error.empty()) {
+    return Result(TRI_ERROR_QUERY_FUNCTION_INVALID_CODE,
+                  absl::StrCat("invalid expression: ", error));
+  }
+
+  body.clear();
+  node->toVelocyPack(body, /*verbose*/ true);
+  return {};
+}
+
+std::shared_ptr<UserFunctionExpressionCache::Functions const>
+UserFunctionExpressionCache::load(TRI_vocbase_t& vocbase,
+                                  uint64_t ddlVersion) {
+  auto functions = std::make_shared<Functions>();
+  functions->ddlVersion = ddlVersion;
+  functions->loadTime = TRI_microtime();
+
+  auto binds = std::make_shared<velocypack::Builder>();
+  binds->openObject();
+  binds->add("@col", VPackValue(StaticStrings::AqlFunctionsCollection));
+  binds->close();
+
+  QueryResult queryResult;
+  {
+    // expression functions can be used by everyone who can run queries in
+    // the database
+    ExecContextSuperuserScope exscope;
+
+    auto query = Query::create(
+        transaction::StandaloneContext::Create(vocbase),
+        QueryString(std::string_view(
+            "FOR f IN @@col FILTER f.expression != null RETURN f")),
+        std::move(binds));
+    queryResult = query->executeSync();
+  }
+
+  if (queryResult.result.is(TRI_ERROR_ARANGO_DATA_SOURCE_NOT_FOUND)) {
+    // no _aqlfunctions collection, so no user functions
+    return functions;
+  }
+  if (queryResult.result.fail()) {
+    THROW_ARANGO_EXCEPTION(queryResult.result);
+  }
+
+  for (VPackSlice it : VPackArrayIterator(queryResult.data->slice())) {
+    it = it.resolveExternal();
+    VPackSlice key = it.get(StaticStrings::KeyString);
+    VPackSlice expression = it.get("expression");
+    if (!key.isString() || !expression.isString()) {
+      continue;
+    }
+
+    auto function = std::make_shared<UserFunctionExpression>();
+    function->name = key.copyString();
+    if (VPackSlice p = it.get("parameters"); p.isArray()) {
+      for (VPackSlice parameter : VPackArrayIterator(p)) {
+        if (parameter.isString()) {
+          function->parameters.emplace_back(parameter.copyString());
+        }
+      }
+    }
+
+    bool isDeterministic;
+    Result res = compile(vocbase, expression.stringView(),
+                         function->parameters, function->body,
+                         isDeterministic);
+    if (res.fail()) {
+      // the function was valid when it was registered, so this can only
+      // happen if built-in functions changed in between
+      LOG_TOPIC("5f3a9", WARN, Logger::AQL)
+          << "ignoring AQL user function '" << function->name
+          << "' in database '" << vocbase.name() << "': " << res.errorMessage();
+      continue;
+    }
+    functions->byName.emplace(function->name, std::move(function));
+  }
+
+  return functions;
+}
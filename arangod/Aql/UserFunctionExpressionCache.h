@@ -0,0 +1,99 @@
+////////////////////////////////////////////////////////////////////////////////
+/// DISCLAIMER
+///
+/// Copyright 2014-2023 ArangoDB GmbH, Cologne, Germany
+/// Copyright 2004-2014 triAGENS GmbH, Cologne, Germany
+///
+/// Licensed under the Apache License, Version 2.0 (the "License");
+/// you may not use this file except in compliance with the License.
+/// You may obtain a copy of the License at
+///
+///     http://www.apache.org/licenses/LICENSE-2.0
+///
+/// Unless required by applicable law or agreed to in writing, software
+/// distributed under the License is distributed on an "AS IS" BASIS,
+/// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+/// See the License for the specific language governing permissions and
+/// limitations under the License.
+///
+/// Copyright holder is ArangoDB GmbH, Cologne, Germany
+///
+/// @author Jan Steemann
+////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "Basics/Result.h"
+
+#include <velocypack/Builder.h>
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+struct TRI_vocbase_t;
+
+namespace arangodb::aql {
+
+/// @brief an AQL user-defined function whose body is an AQL expression
+/// instead of JavaScript code, e.g. `@a * 0.7 + @b`. the parameters of the
+/// function are referred to in the body with the bind parameter syntax.
+/// calls to such functions are inlined into the AST of the calling query
+/// when it is parsed, so they are executed natively, do not require V8 and
+/// do not prevent any optimizations or pushing calculations down to the
+/// DB-Servers.
+struct UserFunctionExpression {
+  /// @brief normalized (upper-case) function name
+  std::string name;
+  /// @brief names of the function parameters, in call order
+  std::vector<std::string> parameters;
+  /// @brief serialized AST of the function body
+  velocypack::Builder body;
+};
+
+/// @brief per-database cache of all expression user functions. the cache
+/// for a database is (re)loaded from the _aqlfunctions collection on first
+/// use after any DDL operation, which includes the registration or removal
+/// of user functions. on coordinators, the cache is also reloaded
+/// periodically to pick up changes made via other coordinators.
+class UserFunctionExpressionCache {
+ public:
+  static UserFunctionExpressionCache& instance();
+
+  /// @brief look up an expression user function by its normalized name.
+  /// returns a nullptr if there is no such expression function, e.g.
+  /// because the function is implemented in JavaScript
+  std::shared_ptr<UserFunctionExpression const> lookup(TRI_vocbase_t& vocbase,
+                                                       std::string_view name);
+
+  /// @brief parse and validate the body of an expression user function.
+  /// the body must only consist of values, parameters, attribute accesses,
+  /// operators and calls to built-in functions that have a C++
+  /// implementation and do not read documents. on success, the serialized
+  /// AST of the body is stored in `body`, and `isDeterministic` is set
+  /// to whether all called functions are deterministic
+  static Result compile(TRI_vocbase_t& vocbase, std::string_view expression,
+                        std::vector<std::string> const& parameters,
+                        velocypack::Builder& body, bool& isDeterministic);
+
+ private:
+  struct Functions {
+    uint64_t ddlVersion;
+    double loadTime;
+    std::unordered_map<std::string,
+                       std::shared_ptr<UserFunctionExpression const>>
+        byName;
+  };
+
+  static std::shared_ptr<Functions const> load(TRI_vocbase_t& vocbase,
+                                               uint64_t ddlVersion);
+
+  std::mutex _mutex;
+  std::unordered_map<std::string, std::shared_ptr<Functions const>> _databases;
+};
+
+}  // namespace arangodb::aql
@@ -119,6 +119,19 @@ void BaseWindowExecutor::applyAggregators(InputAqlItemRow& input) {
   }
 }
 
+void BaseWindowExecutor::removeFromAggregators(InputAqlItemRow& input) {
+  TRI_ASSERT(_aggregators.size() == _infos.getAggregatedRegisters().size());
+  size_t j = 0;
+  for (auto const& r : _infos.getAggregatedRegisters()) {
+    if (r.second.value() == RegisterId::maxRegisterId) {  // e.g. LENGTH / COUNT
+      _aggregators[j]->remove(::EmptyValue);
+    } else {
+      _aggregators[j]->remove(input.getValue(/*inRegister*/ r.second));
+    }
+    ++j;
+  }
+}
+
 void BaseWindowExecutor::resetAggregators() {
   for (auto& agg : _aggregators) {
     agg->reset();
@@ -219,7 +232,26 @@ auto AccuWindowExecutor::skipRowsRange(AqlItemBlockInputRange& inputRange,
 // -------------- WindowExecutor --------------
 
 WindowExecutor::WindowExecutor(Fetcher& fetcher, Infos& infos)
-    : BaseWindowExecutor(infos) {}
+    : BaseWindowExecutor(infos) {
+  if (_infos.rangeRegister() != RegisterPlan::MaxRegisterId) {
+    // range based windows are always recomputed
+    return;
+  }
+  // row based windows can be slid incrementally if all aggregators support
+  // the removal of values
+  AggregatorList aggregators;
+  aggregators.reserve(_infos.getAggregateTypes().size());
+  for (auto const& type : _infos.getAggregateTypes()) {
+    auto aggregator =
+        Aggregator::slidingFromTypeString(_infos.getVPackOptions(), type);
+    if (aggregator == nullptr) {
+      return;
+    }
+    aggregators.emplace_back(std::move(aggregator));
+  }
+  _aggregators = std::move(aggregators);
+  _incremental = true;
+}
 
 WindowExecutor::~WindowExecutor() = default;
 
@@ -258,6 +290,10 @@ void WindowExecutor::trimBounds() {
       _rows.erase(_rows.begin(),
                   _rows.begin() + decltype(_rows)::difference_type(toRemove));
       _currentIdx -= toRemove;
+      // the aggregators never contain any of the removed rows
+      TRI_ASSERT(_windowStart >= toRemove || _windowStart == _windowEnd);
+      _windowStart -= std::min(_windowStart, toRemove);
+      _windowEnd -= std::min(_windowEnd, toRemove);
     }
     TRI_ASSERT(_currentIdx <= numPreceding || _rows.empty());
     return;
@@ -325,6 +361,15 @@ std::tuple<ExecutorState, NoStats, AqlCall> WindowExecutor::produceRows(
   if (_infos.rangeRegister() == RegisterPlan::MaxRegisterId) {
     // row based WINDOW
 
+    if (_incremental) {
+      produceRowBasedIncrementally(state, output);
+      trimBounds();
+      if (_currentIdx < _rows.size()) {
+        state = ExecutorState::HASMORE;
+      }
+      return {state, NoStats{}, AqlCall{}};
+    }
+
     const size_t numPreceding = size_t(_infos.bounds().numPrecedingRows());
     const size_t numFollowing = size_t(_infos.bounds().numFollowingRows());
 
@@ -405,6 +450,50 @@ std::tuple<ExecutorState, NoStats, AqlCall> WindowExecutor::produceRows(
   return {state, NoStats{}, AqlCall{}};
 }
 
+void WindowExecutor::produceRowBasedIncrementally(ExecutorState state,
+                                                  OutputAqlItemRow& output) {
+  size_t const numPreceding = size_t(_infos.bounds().numPrecedingRows());
+  size_t const numFollowing = size_t(_infos.bounds().numFollowingRows());
+
+  auto windowStartFor = [&](size_t idx) -> size_t {
+    return idx > numPreceding ? idx - numPreceding : 0;
+  };
+
+  auto haveRows = [&]() -> bool {
+    return (state == ExecutorState::DONE && _currentIdx < _rows.size()) ||
+           (numPreceding <= _currentIdx &&
+            numFollowing + _currentIdx < _rows.size());
+  };
+
+  while (!output.isFull() && haveRows()) {
+    size_t start = windowStartFor(_currentIdx);
+    size_t end = std::min(_rows.size(), _currentIdx + numFollowing + 1);
+
+    if (_windowStart == _windowEnd) {
+      // nothing aggregated yet, e.g. after skipping rows
+      _windowStart = _windowEnd = start;
+    }
+    TRI_ASSERT(_windowStart <= start);
+    // slide the window: remove the rows that fell out of it ...
+    while (_windowStart < start) {
+      removeFromAggregators(_rows[_windowStart++]);
+    }
+    // ... and add the rows that entered it
+    while (_windowEnd < end) {
+      applyAggregators(_rows[_windowEnd++]);
+    }
+    produceOutputRow(_rows[_currentIdx], output, /*reset*/ false);
+    _currentIdx++;
+
+    // remove the rows that are not part of the next window right away, so
+    // that trimBounds() never throws away rows we still need to remove
+    start = windowStartFor(_currentIdx);
+    while (_windowStart < std::min(start, _windowEnd)) {
+      removeFromAggregators(_rows[_windowStart++]);
+    }
+  }
+}
+
 /**
  * @brief Skip Rows
  *   We need to consume all rows from the inputRange
@@ -421,6 +510,12 @@ WindowExecutor::skipRowsRange(AqlItemBlockInputRange& inputRange,
   std::ignore = consumeInputRange(inputRange);
 
   if (!_rows.empty()) {
+    if (_incremental && call.needSkipMore()) {
+      // the incrementally maintained window is rebuilt when the next row
+      // is produced
+      resetAggregators();
+      _windowStart = _windowEnd = 0;
+    }
     // TODO a bit loopy
     while (call.needSkipMore() && _currentIdx < _windowRows.size()) {
       _currentIdx++;
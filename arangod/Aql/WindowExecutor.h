@@ -110,6 +110,7 @@ class BaseWindowExecutor {
       BaseWindowExecutor::Infos const& infos);
 
   void applyAggregators(InputAqlItemRow& input);
+  void removeFromAggregators(InputAqlItemRow& input);
   void resetAggregators();
   void produceOutputRow(InputAqlItemRow& input, OutputAqlItemRow& output,
                         bool reset);
@@ -230,6 +231,8 @@ class WindowExecutor : public BaseWindowExecutor {
  private:
   ExecutorState consumeInputRange(AqlItemBlockInputRange& input);
   void trimBounds();
+  void produceRowBasedIncrementally(ExecutorState state,
+                                    OutputAqlItemRow& output);
 
  private:
   /// @brief consumed rows that we need to keep track of
@@ -238,6 +241,13 @@ class WindowExecutor : public BaseWindowExecutor {
   std::deque<WindowBounds::Row> _windowRows;
   /// @brief index of row we need to copy to output next
   size_t _currentIdx = 0;
+  /// @brief whether the aggregators support removing values, so that row
+  /// based windows can be updated incrementally when sliding. in this case
+  /// the aggregators contain the values of the rows [_windowStart,
+  /// _windowEnd)
+  bool _incremental = false;
+  size_t _windowStart = 0;
+  size_t _windowEnd = 0;
 };
 
 }  // namespace aql
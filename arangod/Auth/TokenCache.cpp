@@ -111,9 +111,34 @@ auth::TokenCache::Entry auth::TokenCache::checkAuthentication(
   }
 }
 
+uint64_t auth::TokenCache::version() const noexcept {
+  uint64_t version = _invalidations.load(std::memory_order_acquire);
+  if (_userManager != nullptr) {
+    version += _userManager->globalVersion();
+  }
+  return version;
+}
+
+bool auth::TokenCache::canReuse(AuthenticationMethod authType,
+                                auth::TokenCache::Entry const& entry,
+                                uint64_t version) {
+  if (!entry.authenticated() || entry.expired() || version != this->version()) {
+    return false;
+  }
+  if (_userManager != nullptr &&
+      _userManager->refreshUser(entry.username()) &&
+      authType == AuthenticationMethod::BASIC) {
+    // LDAP rights have been refreshed. the credentials need to be checked
+    // again, same as for entries in the basic cache
+    return false;
+  }
+  return true;
+}
+
 void auth::TokenCache::invalidateBasicCache() {
   WRITE_LOCKER(guard, _basicLock);
   _basicCache.clear();
+  _invalidations.fetch_add(1, std::memory_order_release);
 }
 
 // private
@@ -408,4 +433,6 @@ bool auth::TokenCache::validateJwtHMAC256Signature(
 void auth::TokenCache::generateSuperToken() {
   std::string sid = ServerState::instance()->getId();
   _jwtSuperToken = fuerte::jwt::generateInternalToken(jwtSecret(), sid);
+  // the JWT secrets have changed, so previous results are not valid anymore
+  _invalidations.fetch_add(1, std::memory_order_release);
 }
@@ -92,6 +92,17 @@ class TokenCache {
                                         ServerState::Mode mode,
                                         std::string const& secret);
 
+  /// @brief version of the authentication data. changes whenever users or
+  /// JWT secrets change, so that callers which keep authentication results
+  /// on their own can detect that these may be outdated
+  uint64_t version() const noexcept;
+
+  /// @brief whether an authenticated result of checkAuthentication() can be
+  /// reused for the same credentials. `version` is the value of version()
+  /// from before the result was computed
+  bool canReuse(rest::AuthenticationMethod authType, Entry const& entry,
+                uint64_t version);
+
   /// Clear the cache of username / password auth
   void invalidateBasicCache();
 
@@ -135,6 +146,10 @@ class TokenCache {
   std::unordered_map<std::string, TokenCache::Entry> _basicCache;
   std::atomic<uint64_t> _basicCacheVersion{0};
 
+  /// @brief increased whenever the basic cache is invalidated or the JWT
+  /// secrets change. part of version()
+  std::atomic<uint64_t> _invalidations{0};
+
   mutable arangodb::basics::ReadWriteLock _jwtSecretLock;
 
 #ifdef USE_ENTERPRISE
@@ -26,11 +26,16 @@
 
 #include "Cache/BucketState.h"
 #include "Basics/Common.h"
+#include "Basics/LockContention.h"
 #include "Basics/cpu-relax.h"
 #include "Basics/debugging.h"
 
 namespace arangodb::cache {
 
+namespace {
+basics::LockContentionSite bucketLockSite("cache::Bucket");
+}  // namespace
+
 BucketState::BucketState() noexcept : _state(0) {}
 
 BucketState::BucketState(BucketState const& other) noexcept
@@ -49,6 +54,7 @@ bool BucketState::isLocked() const noexcept {
 }
 
 bool BucketState::lock(std::uint64_t maxTries) noexcept {
+  basics::LockWaitTimer timer(bucketLockSite, std::defer_lock);
   uint64_t attempts = 0;
   do {
     // expect unlocked, but need to preserve migrating status
@@ -66,6 +72,7 @@ bool BucketState::lock(std::uint64_t maxTries) noexcept {
         return true;
       }
     }
+    timer.start();
     basics::cpu_relax();
     // TODO: exponential back-off for failure?
   } while (++attempts < maxTries);
@@ -75,7 +82,10 @@ bool BucketState::lock(std::uint64_t maxTries) noexcept {
 
 void BucketState::unlock() noexcept {
   TRI_ASSERT(isLocked());
-  _state.fetch_and(static_cast<FlagType>(~static_cast<FlagType>(Flag::locked)),
+  // clears the lock flag and increments the version counter in one go.
+  // the counter is allowed to wrap around
+  _state.fetch_add(static_cast<FlagType>(kVersionIncrement -
+                                         static_cast<FlagType>(Flag::locked)),
                    std::memory_order_release);
 }
 
@@ -92,6 +102,18 @@ void BucketState::toggleFlag(BucketState::Flag flag) noexcept {
 
 void BucketState::clear() noexcept {
   TRI_ASSERT(isLocked());
-  _state = static_cast<FlagType>(Flag::locked);
+  _state = static_cast<FlagType>((_state.load() & ~kFlagsMask) |
+                                 static_cast<FlagType>(Flag::locked));
+}
+
+BucketState::FlagType BucketState::beginOptimisticRead() const noexcept {
+  return _state.load(std::memory_order_acquire);
+}
+
+bool BucketState::validateOptimisticRead(FlagType state) const noexcept {
+  // make sure the reads of the protected data are not reordered after the
+  // following load
+  std::atomic_thread_fence(std::memory_order_acquire);
+  return _state.load(std::memory_order_relaxed) == state;
 }
 }  // namespace arangodb::cache
@@ -37,10 +37,15 @@ namespace arangodb::cache {
 /// Underlying store is simply a std::atomic<uint16_t>, and each bit corresponds
 /// to a flag that can be set. The lowest bit is special and is designated as
 /// the locking flag. Any access (read or modify) to the state must occur when
-/// the state is already locked; the two exceptions are to check whether the
-/// state is locked and, of course, to lock it. Any flags besides the lock flag
-/// are treated uniformly, and can be checked or toggled. Each flag is defined
-/// via an enum and must correspond to exactly one set bit.
+/// the state is already locked; the exceptions are to check whether the
+/// state is locked, to lock it, and optimistic reads. Any flags besides the
+/// lock flag are treated uniformly, and can be checked or toggled. Each flag
+/// is defined via an enum and must correspond to exactly one set bit.
+///
+/// The bits above the flags hold a version counter, which is incremented on
+/// every unlock. This allows readers to read the data protected by the state
+/// without locking it (seqlock-style): a read is consistent if the state was
+/// unlocked and did not change while reading.
 ////////////////////////////////////////////////////////////////////////////////
 struct BucketState {
   //////////////////////////////////////////////////////////////////////////////
@@ -60,6 +65,10 @@ struct BucketState {
 
   using FlagType = std::underlying_type<Flag>::type;
 
+  // bits used by the flags. all other bits are used for the version counter
+  static constexpr FlagType kFlagsMask = 0x0007;
+  static constexpr FlagType kVersionIncrement = kFlagsMask + 1;
+
   //////////////////////////////////////////////////////////////////////////////
   /// @brief Initializes state with no flags set and unlocked
   //////////////////////////////////////////////////////////////////////////////
@@ -112,13 +121,36 @@ struct BucketState {
   //////////////////////////////////////////////////////////////////////////////
   bool isSet(BucketState::Flag flag) const noexcept;
 
+  //////////////////////////////////////////////////////////////////////////////
+  /// @brief Checks whether the given flag is set in a state value returned by
+  /// beginOptimisticRead().
+  //////////////////////////////////////////////////////////////////////////////
+  static bool isSet(FlagType state, BucketState::Flag flag) noexcept {
+    return (state & static_cast<FlagType>(flag)) != 0;
+  }
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// @brief Begins an optimistic read without locking. The returned value must
+  /// be handed to validateOptimisticRead() once all data has been read. If
+  /// the returned value has the locked flag set, the read must be abandoned.
+  //////////////////////////////////////////////////////////////////////////////
+  FlagType beginOptimisticRead() const noexcept;
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// @brief Checks whether the state was not locked or modified since
+  /// beginOptimisticRead() returned the given value. Only in this case the
+  /// data read in between is consistent.
+  //////////////////////////////////////////////////////////////////////////////
+  bool validateOptimisticRead(FlagType state) const noexcept;
+
   //////////////////////////////////////////////////////////////////////////////
   /// @brief Toggles the given flag. Requires state to be locked.
   //////////////////////////////////////////////////////////////////////////////
   void toggleFlag(BucketState::Flag flag) noexcept;
 
   //////////////////////////////////////////////////////////////////////////////
-  /// @brief Unsets all flags besides Flag::locked. Requires state to be locked.
+  /// @brief Unsets all flags besides Flag::locked. Keeps the version counter.
+  /// Requires state to be locked.
   //////////////////////////////////////////////////////////////////////////////
   void clear() noexcept;
 
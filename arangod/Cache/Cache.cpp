@@ -65,7 +65,8 @@ Cache::Cache(
           std::chrono::steady_clock::now().time_since_epoch().count()),
       _resizeRequestTime(
           std::chrono::steady_clock::now().time_since_epoch().count()),
-      _enableWindowedStats(enableWindowedStats) {
+      _enableWindowedStats(enableWindowedStats),
+      _enableAdmissionFilter(manager->enableAdmissionFilter()) {
   TRI_ASSERT(_table != nullptr);
   _table->setTypeSpecifics(_bucketClearer, _slotsPerBucket);
   _table->enable();
@@ -93,6 +94,11 @@ Cache::~Cache() {
     memoryUsage += sizeof(decltype(_evictionStats)::element_type);
   }
 
+  if (_admissionSketchCreated.load(std::memory_order_acquire)) {
+    TRI_ASSERT(_admissionSketch != nullptr);
+    memoryUsage += _admissionSketch->memoryUsage();
+  }
+
   _manager->adjustGlobalAllocation(-static_cast<std::int64_t>(memoryUsage));
 }
 
@@ -404,6 +410,35 @@ bool Cache::reportInsert(bool hadEviction) {
   return shouldMigrate;
 }
 
+void Cache::recordAccess(std::uint32_t hash) noexcept {
+  if (_admissionSketchCreated.load(std::memory_order_acquire)) {
+    _admissionSketch->record(hash);
+  }
+}
+
+bool Cache::admit(std::uint32_t hash, std::uint32_t candidateHash) noexcept {
+  if (!_enableAdmissionFilter) {
+    return true;
+  }
+
+  try {
+    ensureAdmissionSketch();
+  } catch (...) {
+    // without the sketch we cannot decide, so we behave as if the
+    // admission filter was turned off
+    return true;
+  }
+
+  TRI_ASSERT(_admissionSketch != nullptr);
+  // the new value must have been more popular recently than the value it
+  // would replace. this keeps values that are only accessed once, e.g. by
+  // a full scan, from evicting frequently accessed values
+  bool admitted = _admissionSketch->estimate(hash) >
+                  _admissionSketch->estimate(candidateHash);
+  _manager->reportAdmission(admitted);
+  return admitted;
+}
+
 void Cache::ensureFindStats() {
   absl::call_once(_findStatsOnceFlag, [this]() {
     TRI_ASSERT(!_findStatsCreated.load(std::memory_order_relaxed));
@@ -438,6 +473,26 @@ void Cache::ensureEvictionStats() {
   TRI_ASSERT(_evictionStats != nullptr);
 }
 
+void Cache::ensureAdmissionSketch() {
+  absl::call_once(_admissionSketchOnceFlag, [this]() {
+    TRI_ASSERT(!_admissionSketchCreated.load(std::memory_order_relaxed));
+    TRI_ASSERT(_admissionSketch == nullptr);
+
+    // size the sketch according to the current number of slots. the
+    // sketch is not resized when the table grows later
+    std::shared_ptr<Table> table = this->table();
+    std::size_t numSlots =
+        (table == nullptr ? 0 : table->size()) * _slotsPerBucket;
+    _admissionSketch = std::make_unique<FrequencySketch>(
+        std::min<std::size_t>(numSlots, kMaxAdmissionSketchEntries));
+    _manager->adjustGlobalAllocation(_admissionSketch->memoryUsage());
+
+    _admissionSketchCreated.store(true, std::memory_order_release);
+  });
+
+  TRI_ASSERT(_admissionSketch != nullptr);
+}
+
 Metadata& Cache::metadata() { return _metadata; }
 
 std::shared_ptr<Table> Cache::table() const {
@@ -30,6 +30,7 @@
 #include "Cache/Common.h"
 #include "Cache/Finding.h"
 #include "Cache/FrequencyBuffer.h"
+#include "Cache/FrequencySketch.h"
 #include "Cache/Manager.h"
 #include "Cache/ManagerTasks.h"
 #include "Cache/Metadata.h"
@@ -40,6 +41,7 @@
 #include <functional>
 #include <limits>
 #include <memory>
+#include <string_view>
 
 #include <absl/base/call_once.h>
 
@@ -103,6 +105,8 @@ class Cache : public std::enable_shared_from_this<Cache> {
   virtual ::ErrorCode insert(CachedValue* value) = 0;
   virtual ::ErrorCode remove(void const* key, std::uint32_t keySize) = 0;
   virtual ::ErrorCode banish(void const* key, std::uint32_t keySize) = 0;
+  virtual void forEachKey(
+      std::function<bool(std::string_view key)> const& cb) = 0;
 
   // inform the manager about additional (global) memory usage.
   // this is necessary so that the cache does not only count its own memory,
@@ -244,6 +248,15 @@ class Cache : public std::enable_shared_from_this<Cache> {
 
   bool reportInsert(bool hadEviction);
 
+  // record an access to the key with the given hash for the admission
+  // filter. does nothing if the admission filter is not active yet
+  void recordAccess(std::uint32_t hash) noexcept;
+
+  // whether or not a new value with the given key hash is allowed to
+  // evict the existing value with the given key hash. always true if the
+  // admission filter is turned off
+  bool admit(std::uint32_t hash, std::uint32_t candidateHash) noexcept;
+
   // management
   Metadata& metadata();
   std::shared_ptr<Table> table() const;
@@ -294,6 +307,7 @@ class Cache : public std::enable_shared_from_this<Cache> {
 
  private:
   void ensureEvictionStats();
+  void ensureAdmissionSketch();
 
   // manage the actual table - note: MUST be used only with atomic_load and
   // atomic_store!
@@ -333,11 +347,26 @@ class Cache : public std::enable_shared_from_this<Cache> {
   // the actual eviction stats object
   std::unique_ptr<EvictionStats> _evictionStats;
 
+  // this is a control variable that ensures that the _admissionSketch
+  // is created lazily and exactly once per Cache object, when there is
+  // the first eviction.
+  absl::once_flag _admissionSketchOnceFlag;
+  // this variable flips from false to true only once when the
+  // _admissionSketch object is lazily created.
+  std::atomic<bool> _admissionSketchCreated = false;
+  // access frequencies of keys used by the admission filter
+  std::unique_ptr<FrequencySketch> _admissionSketch;
+
   // times to wait until requesting is allowed again
   std::atomic<Manager::time_point::rep> _migrateRequestTime;
   std::atomic<Manager::time_point::rep> _resizeRequestTime;
 
   bool const _enableWindowedStats;
+  bool const _enableAdmissionFilter;
+
+  // upper bound for the number of keys the admission filter's sketch is
+  // sized for (i.e. 1MB of memory)
+  static constexpr std::size_t kMaxAdmissionSketchEntries = 128 * 1024;
 
   static constexpr std::uint64_t kEvictionMask =
       4095;  // check roughly every 4096 insertions
@@ -91,6 +91,8 @@ void CacheManagerFeature::start() {
       << ", min value size for edge compression: "
       << _options.minValueSizeForEdgeCompression << ", acceleration factor: "
       << _options.accelerationFactorForEdgeCompression
+      << ", min value size for persistent index compression: "
+      << _options.minValueSizeForPersistentIndexCompression
       << ", max spare allocation: " << _options.maxSpareAllocation
       << ", enable windowed stats: " << _options.enableWindowedStats;
 
@@ -133,4 +135,9 @@ std::uint32_t CacheManagerFeature::accelerationFactorForEdgeCompression()
   return _options.accelerationFactorForEdgeCompression;
 }
 
+std::size_t CacheManagerFeature::minValueSizeForPersistentIndexCompression()
+    const noexcept {
+  return _options.minValueSizeForPersistentIndexCompression;
+}
+
 }  // namespace arangodb
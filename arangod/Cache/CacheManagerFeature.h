@@ -52,6 +52,7 @@ class CacheManagerFeature final : public ArangodFeature {
 
   std::size_t minValueSizeForEdgeCompression() const noexcept;
   std::uint32_t accelerationFactorForEdgeCompression() const noexcept;
+  std::size_t minValueSizeForPersistentIndexCompression() const noexcept;
 
  private:
   std::unique_ptr<cache::Manager> _manager;
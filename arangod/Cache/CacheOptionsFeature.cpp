@@ -128,6 +128,29 @@ option to a value that is lower than medium-to-large average payload sizes.
 It is normally not that useful to compress values that are smaller than 100 bytes.)")
       .setIntroducedIn(31102);
 
+  options
+      ->addOption(
+          "--cache.min-value-size-for-persistent-index-compression",
+          "The size threshold (in bytes) from which on payloads in the "
+          "persistent index cache transparently get LZ4-compressed.",
+          new SizeTParameter(
+              &_options.minValueSizeForPersistentIndexCompression, 1, 0,
+              1073741824ULL),
+          arangodb::options::makeFlags(
+              arangodb::options::Flags::DefaultNoComponents,
+              arangodb::options::Flags::OnDBServer,
+              arangodb::options::Flags::OnSingle))
+      .setLongDescription(
+          R"(By transparently compressing values in the in-memory cache of
+persistent indexes with `cacheEnabled: true`, more data can be held in memory
+than without compression. This is mostly useful for non-unique indexes with
+many index entries per lookup value. Storing compressed values increases CPU
+usage for the on-the-fly compression and decompression. In case compression is
+undesired, this option can be set to a very high value, which will effectively
+disable it. The LZ4 acceleration factor is controlled by the
+`--cache.acceleration-factor-for-edge-compression` startup option.)")
+      .setIntroducedIn(31200);
+
   options
       ->addOption(
           "--cache.acceleration-factor-for-edge-compression",
@@ -177,6 +200,55 @@ try to free up memory by evicting the oldest entries.)")
               arangodb::options::Flags::OnDBServer,
               arangodb::options::Flags::OnSingle))
       .setIntroducedIn(31200);
+
+  options
+      ->addOption("--cache.admission-filter",
+                  "Whether to use a frequency-based admission filter for "
+                  "the in-memory cache.",
+                  new BooleanParameter(&_options.enableAdmissionFilter),
+                  arangodb::options::makeFlags(
+                      arangodb::options::Flags::Uncommon,
+                      arangodb::options::Flags::DefaultNoComponents,
+                      arangodb::options::Flags::OnDBServer,
+                      arangodb::options::Flags::OnSingle))
+      .setIntroducedIn(31200)
+      .setLongDescription(R"(By default, every value inserted into the
+in-memory cache is admitted, evicting the least recently used entry from its
+bucket if the bucket is full. A single large scan, e.g. a traversal or an
+edge index scan of a batch job, can thus evict the entire working set.
+
+If this option is enabled, each cache tracks the recent access frequency of
+its keys in a small count-min sketch once it starts evicting entries. A new
+entry then only replaces an existing one if it was looked up more frequently
+recently (TinyLFU). This keeps popular entries in the cache during scans, at
+the expense of a slower warm-up for newly popular entries.
+
+The number of admitted and rejected insertions is reported in the
+`rocksdb_cache_admissions` and `rocksdb_cache_admission_rejections`
+metrics.)");
+
+  options
+      ->addOption("--cache.numa-interleave",
+                  "Whether to interleave the memory of the in-memory cache's "
+                  "hash tables across all NUMA nodes.",
+                  new BooleanParameter(&_options.interleaveTableMemory),
+                  arangodb::options::makeFlags(
+                      arangodb::options::Flags::Uncommon,
+                      arangodb::options::Flags::DefaultNoComponents,
+                      arangodb::options::Flags::OnDBServer,
+                      arangodb::options::Flags::OnSingle))
+      .setIntroducedIn(31200)
+      .setLongDescription(R"(Hash tables of the in-memory cache are allocated
+and initialized by the thread that creates or resizes a cache. Their memory
+thus usually ends up on a single NUMA node, and lookups from threads running
+on other nodes all hit remote memory. On machines with multiple NUMA nodes,
+this option spreads the pages of every hash table evenly across all nodes,
+which balances the memory bandwidth and the remote access ratio of cache
+lookups between the nodes.
+
+This is the same as starting the server with `numactl --interleave=all`, but
+only applies to the in-memory cache. The option has no effect on machines
+with a single NUMA node and on operating systems other than Linux.)");
 }
 
 void CacheOptionsFeature::validateOptions(
@@ -40,6 +40,8 @@ struct CacheOptions {
   // lz4-internal acceleration factor for compression.
   // values > 1 could mean slower compression, but faster decompression
   std::uint32_t accelerationFactorForEdgeCompression = 1;
+  // 1GB, so effectively compression is disabled by default.
+  std::size_t minValueSizeForPersistentIndexCompression = 1'073'741'824ULL;
   // cache size will be set dynamically later based on available RAM
   std::uint64_t cacheSize = 0;
   std::uint64_t rebalancingInterval = 2'000'000ULL;  // 2s
@@ -55,6 +57,13 @@ struct CacheOptions {
   // whether or not we want recent hit rates. if this is turned off,
   // we only get global hit rates over the entire lifetime of a cache
   bool enableWindowedStats = true;
+  // whether or not inserts into full buckets are subject to a frequency-based
+  // admission filter (TinyLFU). if turned on, a new entry only replaces an
+  // existing entry if it was accessed more frequently recently
+  bool enableAdmissionFilter = false;
+  // whether or not the memory of hash tables is interleaved across all NUMA
+  // nodes. only has an effect on Linux machines with multiple NUMA nodes
+  bool interleaveTableMemory = false;
 };
 
 struct CacheOptionsProvider {
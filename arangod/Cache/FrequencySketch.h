@@ -0,0 +1,141 @@
+////////////////////////////////////////////////////////////////////////////////
+/// DISCLAIMER
+///
+/// Copyright 2014-2023 ArangoDB GmbH, Cologne, Germany
+/// Copyright 2004-2014 triAGENS GmbH, Cologne, Germany
+///
+/// Licensed under the Apache License, Version 2.0 (the "License");
+/// you may not use this file except in compliance with the License.
+/// You may obtain a copy of the License at
+///
+///     http://www.apache.org/licenses/LICENSE-2.0
+///
+/// Unless required by applicable law or agreed to in writing, software
+/// distributed under the License is distributed on an "AS IS" BASIS,
+/// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+/// See the License for the specific language governing permissions and
+/// limitations under the License.
+///
+/// Copyright holder is ArangoDB GmbH, Cologne, Germany
+///
+/// @author Jan Steemann
+////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <utility>
+
+#include "Basics/debugging.h"
+#include "Basics/fasthash.h"
+
+namespace arangodb::cache {
+
+/// @brief Lockless count-min sketch with 4-bit counters, used to estimate
+/// the recent access frequency of keys by their hashes (TinyLFU).
+///
+/// Every key is mapped to one counter in each of kNumHashes rows. The
+/// estimate for a key is the minimum of its counters. Once the sketch has
+/// seen a number of increments proportional to its size, all counters are
+/// halved, so that the sketch reflects recent rather than all-time
+/// popularity. Concurrent updates are not synchronized and can get lost,
+/// which only makes the estimates slightly less accurate.
+class FrequencySketch {
+ public:
+  static constexpr std::uint32_t kMaxCount = 15;
+
+  /// @brief Initialize for the given number of distinct keys. Uses 16
+  /// counters per key, so that collisions are rare.
+  explicit FrequencySketch(std::size_t expectedEntries)
+      : _numWords(powerOf2(std::max<std::size_t>(expectedEntries, 64))),
+        _mask(_numWords - 1),
+        _sampleSize(10 * std::max<std::size_t>(expectedEntries, 64)),
+        _additions(0),
+        _table(std::make_unique<std::atomic<std::uint64_t>[]>(_numWords)) {
+    for (std::size_t i = 0; i < _numWords; ++i) {
+      _table[i].store(0, std::memory_order_relaxed);
+    }
+  }
+
+  /// @brief Reports the memory usage in bytes.
+  std::size_t memoryUsage() const noexcept {
+    return sizeof(FrequencySketch) + _numWords * sizeof(std::uint64_t);
+  }
+
+  /// @brief Record an access to the key with the given hash.
+  void record(std::uint32_t hash) noexcept {
+    bool incremented = false;
+    for (std::size_t i = 0; i < kNumHashes; ++i) {
+      auto [word, shift] = position(hash, i);
+      std::uint64_t value = _table[word].load(std::memory_order_relaxed);
+      if (((value >> shift) & 0xfULL) < kMaxCount) {
+        _table[word].store(value + (1ULL << shift), std::memory_order_relaxed);
+        incremented = true;
+      }
+    }
+    if (incremented &&
+        _additions.fetch_add(1, std::memory_order_relaxed) + 1 ==
+            _sampleSize) {
+      age();
+    }
+  }
+
+  /// @brief Estimated number of recent accesses to the key with the given
+  /// hash, capped at kMaxCount.
+  std::uint32_t estimate(std::uint32_t hash) const noexcept {
+    std::uint32_t result = kMaxCount;
+    for (std::size_t i = 0; i < kNumHashes; ++i) {
+      auto [word, shift] = position(hash, i);
+      std::uint64_t value = _table[word].load(std::memory_order_relaxed);
+      result = std::min(result, static_cast<std::uint32_t>(
+                                    (value >> shift) & 0xfULL));
+    }
+    return result;
+  }
+
+ private:
+  static constexpr std::size_t kNumHashes = 4;
+  static constexpr std::array<std::uint64_t, kNumHashes> kSeeds = {
+      0xc3a5c85c97cb3127ULL, 0xb492b66fbe98f273ULL, 0x9ae16a3b2f90404fULL,
+      0xcbf29ce484222325ULL};
+
+  static constexpr std::size_t powerOf2(std::size_t value) noexcept {
+    std::size_t result = 1;
+    while (result < value) {
+      result <<= 1;
+    }
+    return result;
+  }
+
+  /// @brief Returns the word index and the bit offset of the counter for
+  /// the given hash in the given row.
+  std::pair<std::size_t, std::uint32_t> position(
+      std::uint32_t hash, std::size_t row) const noexcept {
+    TRI_ASSERT(row < kNumHashes);
+    std::uint64_t h = fasthash64_uint64(hash, kSeeds[row]);
+    return {static_cast<std::size_t>(h) & _mask,
+            static_cast<std::uint32_t>((h >> 60) * 4)};
+  }
+
+  /// @brief Halve all counters.
+  void age() noexcept {
+    for (std::size_t i = 0; i < _numWords; ++i) {
+      std::uint64_t value = _table[i].load(std::memory_order_relaxed);
+      _table[i].store((value >> 1) & 0x7777777777777777ULL,
+                      std::memory_order_relaxed);
+    }
+    _additions.store(_sampleSize / 2, std::memory_order_relaxed);
+  }
+
+  std::size_t const _numWords;
+  std::size_t const _mask;
+  std::uint64_t const _sampleSize;
+  std::atomic<std::uint64_t> _additions;
+  std::unique_ptr<std::atomic<std::uint64_t>[]> _table;
+};
+
+}  // namespace arangodb::cache
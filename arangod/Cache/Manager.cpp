@@ -385,6 +385,20 @@ double Manager::idealUpperFillRatio() const noexcept {
   return _options.idealUpperFillRatio;
 }
 
+bool Manager::enableAdmissionFilter() const noexcept {
+  return _options.enableAdmissionFilter;
+}
+
+bool Manager::interleaveTableMemory() const noexcept {
+  return _options.interleaveTableMemory;
+}
+
+std::pair<std::uint64_t, std::uint64_t> Manager::admissionStats()
+    const noexcept {
+  return {_admissionsAccepted.value(std::memory_order_relaxed),
+          _admissionsRejected.value(std::memory_order_relaxed)};
+}
+
 Transaction* Manager::beginTransaction(bool readOnly) {
   return _transactions.begin(readOnly);
 }
@@ -563,6 +577,14 @@ void Manager::reportMiss() noexcept {
   }
 }
 
+void Manager::reportAdmission(bool admitted) noexcept {
+  if (admitted) {
+    _admissionsAccepted.add(1, std::memory_order_relaxed);
+  } else {
+    _admissionsRejected.add(1, std::memory_order_relaxed);
+  }
+}
+
 bool Manager::isOperational() const noexcept {
   TRI_ASSERT(_lock.isLocked());
   return (!_shutdown && !_shuttingDown);
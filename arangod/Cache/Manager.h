@@ -182,6 +182,15 @@ class Manager {
 
   double idealLowerFillRatio() const noexcept;
   double idealUpperFillRatio() const noexcept;
+  bool enableAdmissionFilter() const noexcept;
+  bool interleaveTableMemory() const noexcept;
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// @brief Return the number of insertions that were admitted and rejected
+  /// by the admission filters of all caches.
+  //////////////////////////////////////////////////////////////////////////////
+  [[nodiscard]] std::pair<std::uint64_t, std::uint64_t> admissionStats()
+      const noexcept;
 
   //////////////////////////////////////////////////////////////////////////////
   /// @brief Open a new transaction.
@@ -233,6 +242,10 @@ class Manager {
   basics::SharedCounter<64> _findHits;
   basics::SharedCounter<64> _findMisses;
 
+  // admission filter decisions of all caches
+  basics::SharedCounter<64> _admissionsAccepted;
+  basics::SharedCounter<64> _admissionsRejected;
+
   // registry to keep track of registered caches
   std::map<std::uint64_t, std::shared_ptr<Cache>> _caches;
   std::uint64_t _nextCacheId;
@@ -295,6 +308,7 @@ class Manager {
   void reportAccess(std::uint64_t id) noexcept;
   void reportHit() noexcept;
   void reportMiss() noexcept;
+  void reportAdmission(bool admitted) noexcept;
 
   // ratio of caches for which a shrinking attempt will be made if we
   // reach the cache's high water mark (memory limit plus safety buffer)
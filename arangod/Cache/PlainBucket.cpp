@@ -21,6 +21,7 @@
 /// @author Dan Larkin-York
 ////////////////////////////////////////////////////////////////////////////////
 
+#include <atomic>
 #include <cstdint>
 
 #include "Cache/PlainBucket.h"
@@ -84,6 +85,32 @@ CachedValue* PlainBucket::find(std::uint32_t hash, void const* key,
   return result;
 }
 
+bool PlainBucket::definitelyMissing(std::uint32_t hash) const noexcept {
+  BucketState::FlagType state = _state.beginOptimisticRead();
+  if (BucketState::isSet(state, BucketState::Flag::locked) ||
+      BucketState::isSet(state, BucketState::Flag::migrated)) {
+    return false;
+  }
+
+  // the members are modified by writers holding the lock, so they are read
+  // atomically here. the values read are only trusted if the state did not
+  // change in the meantime
+  std::size_t slotsUsed =
+      std::atomic_ref(const_cast<std::uint16_t&>(_slotsUsed))
+          .load(std::memory_order_relaxed);
+  if (slotsUsed > kSlotsData) {
+    return false;
+  }
+  for (std::size_t slot = 0; slot < slotsUsed; ++slot) {
+    if (std::atomic_ref(const_cast<std::uint32_t&>(_cachedHashes[slot]))
+            .load(std::memory_order_relaxed) == hash) {
+      return false;
+    }
+  }
+
+  return _state.validateOptimisticRead(state);
+}
+
 // requires there to be an open slot, otherwise will not be inserted
 void PlainBucket::insert(std::uint32_t hash, CachedValue* value) noexcept {
   TRI_ASSERT(isLocked());
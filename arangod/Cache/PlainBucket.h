@@ -99,6 +99,19 @@ struct PlainBucket {
   CachedValue* find(std::uint32_t hash, void const* key, std::size_t keySize,
                     bool moveToFront = true) noexcept;
 
+  //////////////////////////////////////////////////////////////////////////////
+  /// @brief Checks without locking whether the bucket definitely does not
+  /// contain an entry with the given hash.
+  ///
+  /// Reads the hashes optimistically and validates the read via the bucket's
+  /// state version afterwards. Returns false if the bucket is locked or
+  /// migrated, if a writer modified the bucket during the read, or if any
+  /// hash matches. In all these cases, the caller must lock the bucket and
+  /// use find(). The values themselves are never accessed, as they may be
+  /// freed concurrently.
+  //////////////////////////////////////////////////////////////////////////////
+  bool definitelyMissing(std::uint32_t hash) const noexcept;
+
   //////////////////////////////////////////////////////////////////////////////
   /// @brief Inserts a given value. Requires state to be locked.
   ///
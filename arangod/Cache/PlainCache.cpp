@@ -47,13 +47,32 @@ Finding PlainCache<Hasher>::find(void const* key, std::uint32_t keySize) {
   TRI_ASSERT(key != nullptr);
   Finding result;
   Table::BucketHash hash{Hasher::hashKey(key, keySize)};
+  recordAccess(hash.value);
 
-  ::ErrorCode status = TRI_ERROR_NO_ERROR;
-  Table::BucketLocker guard;
-  std::tie(status, guard) = getBucket(hash, Cache::triesFast);
-  if (status != TRI_ERROR_NO_ERROR) {
+  std::shared_ptr<Table> table = this->table();
+  if (ADB_UNLIKELY(isShutdown() || table == nullptr)) {
     recordMiss();
-    result.reportError(status);
+    result.reportError(TRI_ERROR_SHUTTING_DOWN);
+    return result;
+  }
+  _manager->reportAccess(_id);
+
+  // most lookups of keys that are not in the cache can be answered without
+  // locking the bucket, which avoids cacheline contention on hot buckets.
+  // hits still need the lock, because they pin the value and update the
+  // bucket's LRU order
+  if (static_cast<PlainBucket const*>(table->primaryBucketUnlocked(hash))
+          ->definitelyMissing(hash.value)) {
+    recordMiss();
+    result.reportError(TRI_ERROR_ARANGO_DOCUMENT_NOT_FOUND);
+    return result;
+  }
+
+  Table::BucketLocker guard =
+      table->fetchAndLockBucket(hash, Cache::triesFast);
+  if (!guard.isLocked()) {
+    recordMiss();
+    result.reportError(TRI_ERROR_LOCK_TIMEOUT);
   } else {
     PlainBucket& bucket = guard.bucket<PlainBucket>();
     result.set(bucket.find<Hasher>(hash.value, key, keySize));
@@ -94,6 +113,14 @@ template<typename Hasher>
       if (candidate == nullptr) {
         allowed = false;
         status = TRI_ERROR_ARANGO_BUSY;
+      } else if (!admit(hash.value, Hasher::hashKey(candidate->key(),
+                                                   candidate->keySize()))) {
+        // the new value was accessed less frequently than the value it
+        // would evict. the rejection still counts as an eviction, so
+        // that a too small table can grow
+        allowed = false;
+        status = TRI_ERROR_ARANGO_BUSY;
+        maybeMigrate |= reportInsert(true);
       }
     }
 
@@ -226,6 +253,35 @@ PlainCache<Hasher>::~PlainCache() {
   }
 }
 
+template<typename Hasher>
+void PlainCache<Hasher>::forEachKey(
+    std::function<bool(std::string_view key)> const& cb) {
+  std::shared_ptr<cache::Table> table = this->table();
+  if (!table) {
+    return;
+  }
+
+  std::size_t const n = table->size();
+  for (std::size_t i = 0; i < n; ++i) {
+    auto [status, guard] = getBucket(Table::BucketId{i}, Cache::triesFast,
+                                     /*singleOperation*/ false);
+
+    if (status != TRI_ERROR_NO_ERROR) {
+      continue;
+    }
+
+    PlainBucket& bucket = guard.template bucket<PlainBucket>();
+    for (std::size_t slot = 0; slot < bucket._slotsUsed; ++slot) {
+      CachedValue const* value = bucket._cachedData[slot];
+      TRI_ASSERT(value != nullptr);
+      if (!cb({reinterpret_cast<char const*>(value->key()),
+               value->keySize()})) {
+        return;
+      }
+    }
+  }
+}
+
 template<typename Hasher>
 bool PlainCache<Hasher>::freeMemoryWhile(
     std::function<bool(std::uint64_t)> const& cb) {
@@ -22,20 +22,30 @@
 ////////////////////////////////////////////////////////////////////////////////
 
 #include <algorithm>
+#include <bit>
 #include <cstdint>
 #include <limits>
 #include <memory>
 #include <stdexcept>
+#include <string>
 #include <variant>
 
+#ifdef __linux__
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
 #include "Cache/Table.h"
 
 #include "Basics/Exceptions.h"
+#include "Basics/FileUtils.h"
 #include "Basics/SpinLocker.h"
+#include "Basics/StringUtils.h"
 #include "Basics/debugging.h"
 #include "Basics/voc-errors.h"
 #include "Cache/Cache.h"
 #include "Cache/Common.h"
+#include "Cache/Manager.h"
 #include "Cache/PlainBucket.h"
 #include "Cache/TransactionalBucket.h"
 
@@ -43,6 +53,72 @@ namespace arangodb::cache {
 
 using SpinLocker = ::arangodb::basics::SpinLocker;
 
+namespace {
+#ifdef __linux__
+// returns a bitmask of the online NUMA nodes, or 0 if there is only a
+// single NUMA node or the nodes could not be determined
+std::uint64_t numaNodeMask() {
+  static std::uint64_t const mask = []() -> std::uint64_t {
+    std::uint64_t result = 0;
+    try {
+      // the file contains a list of node ranges, e.g. "0-1" or "0,2-3"
+      std::string content =
+          basics::FileUtils::slurp("/sys/devices/system/node/online");
+      for (auto const& range : basics::StringUtils::split(
+               basics::StringUtils::trim(content), ',')) {
+        auto parts = basics::StringUtils::split(range, '-');
+        if (parts.empty()) {
+          continue;
+        }
+        std::uint64_t from = basics::StringUtils::uint64(parts[0]);
+        std::uint64_t to = parts.size() > 1
+                               ? basics::StringUtils::uint64(parts[1])
+                               : from;
+        for (std::uint64_t node = from; node <= to && node < 64; ++node) {
+          result |= static_cast<std::uint64_t>(1) << node;
+        }
+      }
+    } catch (...) {
+      // file not found or not readable
+      return 0;
+    }
+    return std::popcount(result) > 1 ? result : 0;
+  }();
+  return mask;
+}
+#endif
+
+// interleave the pages of the given memory region across all NUMA nodes.
+// this must be called before the memory is touched for the first time,
+// because it only affects pages that are not yet faulted in. best effort
+// only: if it fails, the memory is allocated according to the default
+// policy
+void interleaveMemory([[maybe_unused]] void* data,
+                      [[maybe_unused]] std::size_t size) noexcept {
+#ifdef __linux__
+  std::uint64_t mask = numaNodeMask();
+  if (mask == 0) {
+    return;
+  }
+  // mbind() only works on whole pages
+  auto const pageSize = static_cast<std::uintptr_t>(::sysconf(_SC_PAGESIZE));
+  std::uintptr_t begin =
+      (reinterpret_cast<std::uintptr_t>(data) + pageSize - 1) & ~(pageSize - 1);
+  std::uintptr_t end =
+      (reinterpret_cast<std::uintptr_t>(data) + size) & ~(pageSize - 1);
+  if (begin >= end) {
+    return;
+  }
+  // value of MPOL_INTERLEAVE from <numaif.h>. we call the syscall directly
+  // so that we don't need to depend on libnuma
+  constexpr int kMpolInterleave = 3;
+  // the kernel expects the number of bits in the mask plus one
+  ::syscall(SYS_mbind, begin, end - begin, kMpolInterleave, &mask,
+            sizeof(mask) * 8 + 1, 0);
+#endif
+}
+}  // namespace
+
 Table::GenericBucket::GenericBucket() noexcept : _state{}, _padding{} {}
 
 bool Table::GenericBucket::lock(std::uint64_t maxTries) noexcept {
@@ -187,8 +263,11 @@ Table::Table(std::uint32_t logSize, Manager* manager)
       _size(static_cast<std::uint64_t>(1) << _logSize),
       _shift(32 - _logSize),
       _mask(static_cast<std::uint32_t>((_size - 1) << _shift)),
-      _buffer(std::make_unique<std::uint8_t[]>((_size * kBucketSizeInBytes) +
-                                               kPadding)),
+      // the buffer is intentionally not value-initialized here, so that its
+      // pages can still be interleaved across NUMA nodes below. all buckets
+      // are initialized via placement new
+      _buffer(std::make_unique_for_overwrite<std::uint8_t[]>(
+          (_size * kBucketSizeInBytes) + kPadding)),
       _buckets(reinterpret_cast<GenericBucket*>(
           reinterpret_cast<std::uint64_t>(
               (_buffer.get() + (kBucketSizeInBytes - 1))) &
@@ -197,6 +276,9 @@ Table::Table(std::uint32_t logSize, Manager* manager)
       _bucketClearer(defaultClearer),
       _slotsTotal(_size),
       _slotsUsed(static_cast<std::uint64_t>(0)) {
+  if (_manager != nullptr && _manager->interleaveTableMemory()) {
+    interleaveMemory(_buckets, _size * kBucketSizeInBytes);
+  }
   for (std::size_t i = 0; i < _size; i++) {
     // use placement new in order to properly initialize the bucket
     new (_buckets + i) GenericBucket();
@@ -269,6 +351,10 @@ void* Table::primaryBucket(uint64_t index) noexcept {
   return &_buckets[index];
 }
 
+void const* Table::primaryBucketUnlocked(BucketHash hash) const noexcept {
+  return &_buckets[(hash.value & _mask) >> _shift];
+}
+
 std::unique_ptr<Table::Subtable> Table::auxiliaryBuckets(std::uint32_t index) {
   if (!isEnabled()) {
     return std::unique_ptr<Subtable>();
@@ -189,6 +189,16 @@ class Table : public std::enable_shared_from_this<Table> {
   //////////////////////////////////////////////////////////////////////////////
   void* primaryBucket(std::uint64_t index) noexcept;
 
+  //////////////////////////////////////////////////////////////////////////////
+  /// @brief Returns a pointer to the bucket in the primary table mapped by the
+  /// given hash, without locking the table or the bucket.
+  ///
+  /// Only to be used for optimistic reads, which must be validated via the
+  /// bucket's state. The bucket may be migrated or the table may be disabled
+  /// concurrently.
+  //////////////////////////////////////////////////////////////////////////////
+  void const* primaryBucketUnlocked(BucketHash hash) const noexcept;
+
   //////////////////////////////////////////////////////////////////////////////
   /// @brief Returns a subtable in the auxiliary index which corresponds to the
   /// specified bucket in the primary table.
@@ -112,6 +112,12 @@ struct TransactionalBucket {
   CachedValue* find(std::uint32_t hash, void const* key, std::size_t keySize,
                     bool moveToFront = true) noexcept;
 
+  //////////////////////////////////////////////////////////////////////////////
+  /// @brief Checks without locking whether the bucket definitely does not
+  /// contain an entry with the given hash. See PlainBucket::definitelyMissing.
+  //////////////////////////////////////////////////////////////////////////////
+  bool definitelyMissing(std::uint32_t hash) const noexcept;
+
   //////////////////////////////////////////////////////////////////////////////
   /// @brief Inserts a given value if it is not banished. Requires state to
   /// be locked.
@@ -108,6 +108,16 @@ class TransactionalCache final : public Cache {
   //////////////////////////////////////////////////////////////////////////////
   ::ErrorCode banish(void const* key, std::uint32_t keySize) override;
 
+  //////////////////////////////////////////////////////////////////////////////
+  /// @brief Calls the callback with the keys of the cached entries, until the
+  /// callback returns false. Within a bucket, the keys are visited in LRU
+  /// order, most recently used first.
+  ///
+  /// Buckets that cannot be locked in a timely fashion are skipped, so the
+  /// result may be incomplete.
+  //////////////////////////////////////////////////////////////////////////////
+  void forEachKey(std::function<bool(std::string_view key)> const& cb) override;
+
   /// @brief returns the name of the hasher
   std::string_view hasherName() const noexcept;
 
@@ -507,6 +507,9 @@ DECLARE_HISTOGRAM(arangodb_load_plan_runtime, ClusterInfoScale,
 
 DECLARE_GAUGE(arangodb_internal_cluster_info_memory_usage, std::uint64_t,
               "Total memory used by internal cluster info data structures");
+DECLARE_COUNTER(arangodb_cluster_uniqid_agency_waits_total,
+                "Number of times unique id generation had to wait for the "
+                "agency");
 
 ClusterInfo::ClusterInfo(ArangodServer& server,
                          AgencyCallbackRegistry* agencyCallbackRegistry,
@@ -561,11 +564,15 @@ ClusterInfo::ClusterInfo(ArangodServer& server,
       _lpTimer(_server.getFeature<metrics::MetricsFeature>().add(
           arangodb_load_plan_runtime{})),
       _lcTimer(_server.getFeature<metrics::MetricsFeature>().add(
-          arangodb_load_current_runtime{})) {
+          arangodb_load_current_runtime{})),
+      _uniqidAgencyWaits(_server.getFeature<metrics::MetricsFeature>().add(
+          arangodb_cluster_uniqid_agency_waits_total{})) {
   _uniqid._currentValue = 1ULL;
   _uniqid._upperValue = 0ULL;
   _uniqid._nextBatchStart = 1ULL;
   _uniqid._nextUpperValue = 0ULL;
+  _uniqid._batchSize = MinIdsPerBatch;
+  _uniqid._batchStarted = 0.0;
   _uniqid._backgroundJobIsRunning = false;
   // Actual loading into caches is postponed until necessary
 
@@ -629,7 +636,7 @@ void ClusterInfo::triggerBackgroundGetIds() {
       return;
     }
     _uniqid._backgroundJobIsRunning = true;
-    std::thread([this] {
+    std::thread([this, batchSize = _uniqid._batchSize] {
       auto guardRunning = scopeGuard([this]() noexcept {
         std::lock_guard mutexLocker{_idLock};
         _uniqid._backgroundJobIsRunning = false;
@@ -637,7 +644,7 @@ void ClusterInfo::triggerBackgroundGetIds() {
 
       uint64_t result;
       try {
-        result = _agency.uniqid(MinIdsPerBatch, 0.0);
+        result = _agency.uniqid(batchSize, 0.0);
       } catch (std::exception const&) {
         return;
       }
@@ -648,7 +655,7 @@ void ClusterInfo::triggerBackgroundGetIds() {
         if (1ULL == _uniqid._nextBatchStart) {
           // Invalidate next batch
           _uniqid._nextBatchStart = result;
-          _uniqid._nextUpperValue = result + MinIdsPerBatch - 1;
+          _uniqid._nextUpperValue = result + batchSize - 1;
         }
         // If we get here, somebody else tried succeeded in doing the same,
         // so we just try again.
@@ -660,6 +667,23 @@ void ClusterInfo::triggerBackgroundGetIds() {
   }
 }
 
+// adapt the size of the batches fetched from the agency to the rate at which
+// ids are used, so that the background fetch of the next batch can keep up
+// with bursts of inserts. must be called with _idLock held, when starting to
+// use a new batch
+void ClusterInfo::adjustIdBatchSize() noexcept {
+  double now = TRI_microtime();
+  double duration = now - _uniqid._batchStarted;
+  if (_uniqid._batchStarted > 0.0) {
+    if (duration < IdBatchTargetDuration) {
+      _uniqid._batchSize = std::min(2 * _uniqid._batchSize, MaxIdsPerBatch);
+    } else if (duration > 10 * IdBatchTargetDuration) {
+      _uniqid._batchSize = std::max(_uniqid._batchSize / 2, MinIdsPerBatch);
+    }
+  }
+  _uniqid._batchStarted = now;
+}
+
 /// @brief produces an agency dump and logs it
 void ClusterInfo::logAgencyDump() const {
 #ifdef ARANGODB_ENABLE_MAINTAINER_MODE
@@ -704,6 +728,7 @@ uint64_t ClusterInfo::uniqid(uint64_t count) {
     uint64_t result = _uniqid._nextBatchStart;
     _uniqid._currentValue = _uniqid._nextBatchStart + count;
     _uniqid._upperValue = _uniqid._nextUpperValue;
+    adjustIdBatchSize();
     triggerBackgroundGetIds();
 
     TRI_ASSERT(result != 0);
@@ -711,11 +736,13 @@ uint64_t ClusterInfo::uniqid(uint64_t count) {
   }
 
   // We need to fetch from the agency
+  _uniqidAgencyWaits.count();
+  adjustIdBatchSize();
 
   uint64_t fetch = count;
 
-  if (fetch < MinIdsPerBatch) {
-    fetch = MinIdsPerBatch;
+  if (fetch < _uniqid._batchSize) {
+    fetch = _uniqid._batchSize;
   }
 
   uint64_t result = _agency.uniqid(2 * fetch, 0.0);
@@ -1612,6 +1639,25 @@ void ClusterInfo::loadPlan() {
               newShards.erase(shardId);
               newShardsToPlanServers.erase(shardId);
               newShardToName.erase(shardId);
+              // Shard group lists are kept across rounds, so a dropped
+              // follower shard must be removed from its group explicitly:
+              if (auto leader = newShardToShardGroupLeader.find(shardId);
+                  leader != newShardToShardGroupLeader.end()) {
+                if (auto group = newShardGroups.find(leader->second);
+                    group != newShardGroups.end()) {
+                  // copy on write, the list may still be published
+                  auto list = std::allocate_shared<
+                      ClusterInfo::ManagedVector<pmr::ShardID>>(
+                      ClusterInfoResourceAllocator<
+                          ClusterInfo::ManagedVector<pmr::ShardID>>{
+                          _resourceMonitor},
+                      *group->second);
+                  std::erase_if(*list, [&](auto const& s) {
+                    return std::string_view{s} == shardId;
+                  });
+                  group->second = std::move(list);
+                }
+              }
               // We try to erase the shard ID anyway, no problem if it is
               // not in there, should it be a shard group leader!
               newShardToShardGroupLeader.erase(shardId);
@@ -1624,6 +1670,9 @@ void ClusterInfo::loadPlan() {
       }
     }
 
+    // collections of this database whose shard information is unchanged
+    containers::FlatHashSet<LogicalCollection const*> reusedCollections;
+
     for (auto const& collectionPairSlice :
          velocypack::ObjectIterator(collectionsSlice)) {
       auto collectionSlice = collectionPairSlice.value;
@@ -1677,6 +1726,19 @@ void ClusterInfo::loadPlan() {
       auto& newCollection = cwh.collection;
       TRI_ASSERT(newCollection != nullptr);
 
+      // if the collection object was taken over from the previous round, its
+      // Plan entry is unchanged. all shard information derived from it in the
+      // previous round is then still present in the copied maps and valid, so
+      // we do not need to rebuild it. this keeps the work for a DDL operation
+      // proportional to the number of changed collections
+      bool reused = false;
+      if (existingCollections != _plannedCollections.end()) {
+        auto existing = existingCollections->second->find(collectionId);
+        reused = existing != existingCollections->second->end() &&
+                 existing->second.collection == newCollection &&
+                 newShards.contains(collectionId);
+      }
+
       try {
         auto& collectionName = newCollection->name();
 
@@ -1693,6 +1755,11 @@ void ClusterInfo::loadPlan() {
           databaseCollections->try_emplace(collectionId, cwh);
         }
 
+        if (reused) {
+          reusedCollections.emplace(newCollection.get());
+          continue;
+        }
+
         auto shardIDs = newCollection->shardIds();
         auto shards = std::make_shared<std::vector<ServerID>>();
         shards->reserve(shardIDs->size());
@@ -1750,6 +1817,10 @@ void ClusterInfo::loadPlan() {
         // the name as key:
         continue;
       }
+      if (reusedCollections.contains(colPair.second.collection.get())) {
+        // shard group membership was already registered in a previous round
+        continue;
+      }
       auto const& groupLeader = std::invoke([&]() -> std::string {
         if (colPair.second.collection->replicationVersion() ==
             replication::Version::TWO) {
@@ -1803,9 +1874,22 @@ void ClusterInfo::loadPlan() {
                 list->emplace_back(col->second->at(i));
                 newShardGroups.try_emplace(groupLeaderCol->second->at(i),
                                            std::move(list));
-              } else {
-                // Need to add us to the list:
-                it->second->emplace_back(col->second->at(i));
+              } else if (std::none_of(it->second->begin(),
+                                      it->second->end(), [&](auto const& s) {
+                                        return std::string_view{s} ==
+                                               col->second->at(i);
+                                      })) {
+                // Need to add us to the list. The list may still be shared
+                // with the currently published shard groups, so we must not
+                // modify it in place:
+                auto list = std::allocate_shared<
+                    ClusterInfo::ManagedVector<pmr::ShardID>>(
+                    ClusterInfoResourceAllocator<
+                        ClusterInfo::ManagedVector<pmr::ShardID>>{
+                        _resourceMonitor},
+                    *it->second);
+                list->emplace_back(col->second->at(i));
+                it->second = std::move(list);
               }
             }
           } else {
@@ -5935,6 +6019,28 @@ CollectionID ClusterInfo::getCollectionNameForShard(std::string_view shardId) {
   return StaticStrings::Empty;
 }
 
+std::pair<ShardID, std::vector<ShardID>> ClusterInfo::getShardGroup(
+    std::string_view shardId) {
+  READ_LOCKER(readLocker, _planProt.lock);
+
+  ShardID leader{shardId};
+  if (auto it = _shardToShardGroupLeader.find(shardId);
+      it != _shardToShardGroupLeader.end()) {
+    leader = ShardID{it->second};
+  }
+  std::vector<ShardID> shards;
+  if (auto it = _shardGroups.find(leader);
+      it != _shardGroups.end() && it->second != nullptr) {
+    shards.reserve(it->second->size());
+    for (auto const& shard : *it->second) {
+      shards.emplace_back(shard);
+    }
+  } else {
+    shards.emplace_back(leader);
+  }
+  return {std::move(leader), std::move(shards)};
+}
+
 auto ClusterInfo::getReplicatedLogsParticipants(std::string_view database) const
     -> ResultT<
         std::unordered_map<replication2::LogId, std::vector<std::string>>> {
@@ -921,6 +921,13 @@ class ClusterInfo final {
   /// @brief map shardId to collection name (not ID)
   CollectionID getCollectionNameForShard(std::string_view shardId);
 
+  /// @brief get the shard group leader of a shard (see the explanation of
+  /// _shardToShardGroupLeader) and all shards in its group, including the
+  /// leader. for shards that are not part of a group, this is the shard
+  /// itself
+  std::pair<ShardID, std::vector<ShardID>> getShardGroup(
+      std::string_view shardId);
+
   auto getReplicatedLogLeader(replication2::LogId) const -> ResultT<ServerID>;
 
   auto getReplicatedLogParticipants(replication2::LogId) const
@@ -1037,6 +1044,7 @@ class ClusterInfo final {
   /// @brief triggers a new background thread to obtain the next batch of ids
   //////////////////////////////////////////////////////////////////////////////
   void triggerBackgroundGetIds();
+  void adjustIdBatchSize() noexcept;
 
   /// underlying application server
   ArangodServer& _server;
@@ -1253,6 +1261,11 @@ class ClusterInfo final {
     uint64_t _upperValue;
     uint64_t _nextBatchStart;
     uint64_t _nextUpperValue;
+    // number of ids to fetch for the next batch. adapts to the rate at
+    // which ids are used
+    uint64_t _batchSize;
+    // time when the current batch was started to be used
+    double _batchStarted;
     bool _backgroundJobIsRunning;
   } _uniqid;
 
@@ -1267,6 +1280,15 @@ class ClusterInfo final {
   //////////////////////////////////////////////////////////////////////////////
 
   static constexpr uint64_t MinIdsPerBatch = 1000000;
+  static constexpr uint64_t MaxIdsPerBatch = 64 * MinIdsPerBatch;
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// @brief if a batch of unique ids is used up faster than this (in
+  /// seconds), the size of the following batches is doubled. if it takes
+  /// more than 10 times that long, the size is halved again
+  //////////////////////////////////////////////////////////////////////////////
+
+  static constexpr double IdBatchTargetDuration = 10.0;
 
   //////////////////////////////////////////////////////////////////////////////
   /// @brief check analyzers precondition timeout in seconds
@@ -1303,6 +1325,8 @@ class ClusterInfo final {
   metrics::Histogram<metrics::LogScale<float>>& _lpTimer;
   /// @brief histogram for loadCurrent runtime
   metrics::Histogram<metrics::LogScale<float>>& _lcTimer;
+  /// @brief number of times uniqid() had to wait for the agency
+  metrics::Counter& _uniqidAgencyWaits;
 };
 
 namespace cluster {
@@ -42,6 +42,7 @@
 #include "Futures/Utilities.h"
 #include "Graph/ClusterGraphDatalake.h"
 #include "Graph/ClusterTraverserCache.h"
+#include "InternalRestHandler/InternalRestDocumentBatchHandler.h"
 #include "Metrics/Counter.h"
 #include "Metrics/Types.h"
 #include "Network/ClusterUtils.h"
@@ -233,6 +234,235 @@ void addTransactionHeaderForShard(transaction::Methods const& trx,
   }
 }
 
+/// @brief a request to a single shard of a multi-shard document operation
+/// @brief replicas a read from followers of a shard can be sent to. the
+/// first one is the replica chosen for the transaction, the second one (if
+/// any) is the fastest other in-sync replica, which is used for hedging
+std::vector<ServerID> hedgeReplicas(transaction::Methods& trx,
+                                    ShardID const& shard) {
+  std::vector<ServerID> replicas{trx.state()->whichReplica(shard)};
+#ifdef USE_ENTERPRISE
+  auto& server = trx.vocbase().server();
+  auto& ci = server.getFeature<ClusterFeature>().clusterInfo();
+  std::vector<ServerID> others;
+  for (auto const& s : *ci.getResponsibleServer(shard)) {
+    if (std::string_view{s} != replicas.front()) {
+      others.emplace_back(s);
+    }
+  }
+  if (!others.empty()) {
+    auto& tracker = server.getFeature<NetworkFeature>().latencyTracker();
+    replicas.emplace_back(std::move(others[tracker.chooseFastest(others)]));
+  }
+#endif
+  return replicas;
+}
+
+struct ShardRequest {
+  ShardID shard;
+  VPackBuffer<uint8_t> body;
+  network::Headers headers;
+};
+
+Future<network::Response> sendShardRequest(
+    network::ConnectionPool* pool, fuerte::RestVerb verb, ShardRequest request,
+    network::RequestOptions const& reqOpts) {
+  return network::sendRequestRetry(
+      pool, "shard:" + request.shard, verb,
+      absl::StrCat("/_api/document/", StringUtils::urlEncode(request.shard)),
+      std::move(request.body), reqOpts, std::move(request.headers));
+}
+
+/// @brief build a response for a shard that was contacted as part of a
+/// batch request, which looks as if the shard had been contacted directly
+network::Response makeShardResponse(fuerte::RestVerb verb,
+                                    ShardID const& shard,
+                                    fuerte::StatusCode code,
+                                    VPackSlice headers, VPackSlice body) {
+  auto response = std::make_unique<fuerte::Response>();
+  response->header.responseCode = code;
+  if (headers.isObject()) {
+    for (auto it : VPackObjectIterator(headers)) {
+      if (it.value.isString()) {
+        response->header.addMeta(it.key.copyString(), it.value.copyString());
+      }
+    }
+  }
+  response->header.contentType(fuerte::ContentType::VPack);
+  if (!body.isNone()) {
+    VPackBuffer<uint8_t> payload;
+    payload.append(body.start(), body.byteSize());
+    response->setPayload(std::move(payload), 0);
+  }
+  return network::Response(
+      "shard:" + shard, fuerte::Error::NoError,
+      fuerte::createRequest(
+          verb, absl::StrCat("/_api/document/", StringUtils::urlEncode(shard))),
+      std::move(response));
+}
+
+/// @brief distribute the response of a batch request to the promises of the
+/// individual shards
+void finishBatchRequest(
+    network::ConnectionPool* pool, fuerte::RestVerb verb,
+    network::RequestOptions const& reqOpts,
+    std::vector<ShardRequest>& requests,
+    std::vector<Promise<network::Response>>& promises,
+    Try<network::Response>&& tryRes) noexcept {
+  TRI_ASSERT(requests.size() == promises.size());
+
+  // contact the shard directly. this will also take care of retries
+  auto sendDirectly = [&](std::size_t i) {
+    sendShardRequest(pool, verb, std::move(requests[i]), reqOpts)
+        .thenFinal([promise = std::move(promises[i])](
+                       Try<network::Response>&& res) mutable {
+          promise.setTry(std::move(res));
+        });
+  };
+
+  try {
+    network::Response& res = tryRes.get();  // throws exceptions upwards
+
+    if (res.fail()) {
+      for (std::size_t i = 0; i < requests.size(); ++i) {
+        promises[i].setValue(network::Response(
+            "shard:" + requests[i].shard, res.error,
+            fuerte::createRequest(verb, absl::StrCat("/_api/document/",
+                                                     StringUtils::urlEncode(
+                                                         requests[i].shard))),
+            nullptr));
+      }
+      return;
+    }
+
+    if (res.statusCode() == fuerte::StatusNotFound) {
+      // the leader does not support batch requests, e.g. during a rolling
+      // upgrade. none of the operations have been executed
+      for (std::size_t i = 0; i < requests.size(); ++i) {
+        sendDirectly(i);
+      }
+      return;
+    }
+
+    VPackSlice operations;
+    if (res.statusCode() == fuerte::StatusOK && res.slice().isObject()) {
+      operations = res.slice().get(
+          InternalRestDocumentBatchHandler::kOperations);
+    }
+    if (!operations.isArray() || operations.length() != requests.size()) {
+      // the batch request failed as a whole
+      for (std::size_t i = 0; i < requests.size(); ++i) {
+        promises[i].setValue(makeShardResponse(
+            verb, requests[i].shard, res.statusCode(),
+            VPackSlice::emptyObjectSlice(), res.slice()));
+      }
+      return;
+    }
+
+    for (std::size_t i = 0; i < requests.size(); ++i) {
+      VPackSlice operation = operations.at(i);
+      auto code = operation.get(InternalRestDocumentBatchHandler::kCode)
+                      .getNumber<fuerte::StatusCode>();
+      VPackSlice body =
+          operation.get(InternalRestDocumentBatchHandler::kBody);
+      // the same responses for which sendRequestRetry would retry the
+      // request
+      if (code == fuerte::StatusMisdirectedRequest ||
+          code == fuerte::StatusServiceUnavailable ||
+          (code == fuerte::StatusNotFound && reqOpts.retryNotFound &&
+           network::errorCodeFromBody(body) ==
+               TRI_ERROR_ARANGO_DATA_SOURCE_NOT_FOUND)) {
+        sendDirectly(i);
+        continue;
+      }
+      promises[i].setValue(makeShardResponse(
+          verb, requests[i].shard, code,
+          operation.get(InternalRestDocumentBatchHandler::kHeaders), body));
+    }
+  } catch (...) {
+    for (auto& promise : promises) {
+      if (!promise.isFulfilled()) {
+        promise.setException(std::current_exception());
+      }
+    }
+  }
+}
+
+/// @brief send the requests of a multi-shard document operation. requests
+/// for shards with the same leader are combined into a single request to
+/// that leader, which executes them on its own. the returned futures contain
+/// one response per shard, which look as if each shard had been contacted
+/// directly, so that they can be handled by handleCRUDShardResponsesFast.
+/// the order of the futures is unspecified
+std::vector<Future<network::Response>> sendShardRequests(
+    network::ConnectionPool* pool, ShardMap const& shardIds,
+    fuerte::RestVerb verb, std::vector<ShardRequest>&& requests,
+    network::RequestOptions const& reqOpts) {
+  std::vector<Future<network::Response>> futures;
+  futures.reserve(requests.size());
+
+  // group the requests by the leaders of their shards
+  std::unordered_map<ServerID, std::vector<ShardRequest>> requestsByLeader;
+  for (auto& request : requests) {
+    auto it = shardIds.find(request.shard);
+    if (!reqOpts.overrideDestination.empty() || it == shardIds.end() ||
+        it->second.empty()) {
+      futures.emplace_back(
+          sendShardRequest(pool, verb, std::move(request), reqOpts));
+      continue;
+    }
+    requestsByLeader[it->second[0]].emplace_back(std::move(request));
+  }
+
+  for (auto& [leader, group] : requestsByLeader) {
+    if (group.size() == 1) {
+      futures.emplace_back(
+          sendShardRequest(pool, verb, std::move(group[0]), reqOpts));
+      continue;
+    }
+
+    VPackBuffer<uint8_t> buffer;
+    {
+      VPackBuilder builder(buffer);
+      builder.openObject();
+      builder.add(InternalRestDocumentBatchHandler::kOperations,
+                  VPackValue(VPackValueType::Array));
+      for (auto const& request : group) {
+        builder.openObject();
+        builder.add(InternalRestDocumentBatchHandler::kShard,
+                    VPackValue(request.shard));
+        builder.add(InternalRestDocumentBatchHandler::kHeaders,
+                    VPackValue(VPackValueType::Object));
+        for (auto const& [key, value] : request.headers) {
+          builder.add(key, VPackValue(value));
+        }
+        builder.close();
+        builder.add(InternalRestDocumentBatchHandler::kBody,
+                    VPackSlice(request.body.data()));
+        builder.close();
+      }
+      builder.close();
+      builder.close();
+    }
+
+    std::vector<Promise<network::Response>> promises(group.size());
+    for (auto& promise : promises) {
+      futures.emplace_back(promise.getFuture());
+    }
+    network::sendRequestRetry(
+        pool, "server:" + leader, verb,
+        RestVocbaseBaseHandler::INTERNAL_DOCUMENT_BATCH_PATH,
+        std::move(buffer), reqOpts)
+        .thenFinal([pool, verb, reqOpts, group = std::move(group),
+                    promises = std::move(promises)](
+                       Try<network::Response>&& res) mutable noexcept {
+          finishBatchRequest(pool, verb, reqOpts, group, promises,
+                             std::move(res));
+        });
+  }
+  return futures;
+}
+
 /// @brief iterate over shard responses and compile a result
 /// This will take care of checking the fuerte responses. If the response has
 /// a body, then the callback will be called on the body, with access to the
@@ -1102,6 +1332,7 @@ futures::Future<OperationResult> figuresOnCoordinator(
   reqOpts.database = dbname;
   reqOpts.param("details", details ? "true" : "false");
   reqOpts.timeout = network::Timeout(300.0);
+  reqOpts.coalesceReads = true;
 
   // If we get here, the sharding attributes are not only _key, therefore
   // we have to contact everybody:
@@ -1347,6 +1578,9 @@ Result selectivityEstimatesOnCoordinator(ClusterFeature& feature,
   reqOpts.database = dbname;
   reqOpts.retryNotFound = true;
   reqOpts.skipScheduler = true;
+  // selectivity estimates are often refreshed by many queries at the same
+  // time
+  reqOpts.coalesceReads = true;
 
   if (NameValidator::isSystemName(collname) &&
       !(collinfo->isSmartChild() || collinfo->isSmartEdgeCollection())) {
@@ -1491,8 +1725,6 @@ futures::Future<OperationResult> insertDocumentOnCoordinator(
       return OperationResult(std::move(r), options);
     }
 
-    std::string const baseUrl = "/_api/document/";
-
     network::RequestOptions reqOpts;
     reqOpts.database = trx.vocbase().name();
     reqOpts.timeout = network::Timeout(CL_DEFAULT_LONG_TIMEOUT);
@@ -1533,8 +1765,8 @@ futures::Future<OperationResult> insertDocumentOnCoordinator(
 
     // Now prepare the requests:
     auto* pool = trx.vocbase().server().getFeature<NetworkFeature>().pool();
-    std::vector<Future<network::Response>> futures;
-    futures.reserve(opCtx.shardMap.size());
+    std::vector<ShardRequest> requests;
+    requests.reserve(opCtx.shardMap.size());
     for (auto const& it : opCtx.shardMap) {
       VPackBuffer<uint8_t> reqBuffer;
       VPackBuilder reqBuilder(reqBuffer);
@@ -1571,12 +1803,12 @@ futures::Future<OperationResult> insertDocumentOnCoordinator(
       // misbehave!
       TRI_ASSERT(!trx.state()->options().allowDirtyReads);
       addTransactionHeaderForShard(trx, *shardIds, /*shard*/ it.first, headers);
-      auto future = network::sendRequestRetry(
-          pool, "shard:" + it.first, fuerte::RestVerb::Post,
-          absl::StrCat(baseUrl, StringUtils::urlEncode(it.first)),
-          std::move(reqBuffer), reqOpts, std::move(headers));
-      futures.emplace_back(std::move(future));
+      requests.emplace_back(
+          ShardRequest{it.first, std::move(reqBuffer), std::move(headers)});
     }
+    std::vector<Future<network::Response>> futures =
+        sendShardRequests(pool, *shardIds, fuerte::RestVerb::Post,
+                          std::move(requests), reqOpts);
 
     // track that we have done a local insert into a Foxx queue.
     // this information will be broadcasted to other coordinators
@@ -1698,8 +1930,8 @@ futures::Future<OperationResult> removeDocumentOnCoordinator(
 
       // Now prepare the requests:
       auto* pool = trx.vocbase().server().getFeature<NetworkFeature>().pool();
-      std::vector<Future<network::Response>> futures;
-      futures.reserve(opCtx.shardMap.size());
+      std::vector<ShardRequest> requests;
+      requests.reserve(opCtx.shardMap.size());
 
       for (auto const& it : opCtx.shardMap) {
         VPackBuffer<uint8_t> buffer;
@@ -1722,11 +1954,12 @@ futures::Future<OperationResult> removeDocumentOnCoordinator(
         TRI_ASSERT(!trx.state()->options().allowDirtyReads);
         addTransactionHeaderForShard(trx, *shardIds, /*shard*/ it.first,
                                      headers);
-        futures.emplace_back(network::sendRequestRetry(
-            pool, "shard:" + it.first, fuerte::RestVerb::Delete,
-            absl::StrCat("/_api/document/", StringUtils::urlEncode(it.first)),
-            std::move(buffer), reqOpts, std::move(headers)));
+        requests.emplace_back(
+            ShardRequest{it.first, std::move(buffer), std::move(headers)});
       }
+      std::vector<Future<network::Response>> futures =
+          sendShardRequests(pool, *shardIds, fuerte::RestVerb::Delete,
+                            std::move(requests), reqOpts);
 
       // Now listen to the results:
       if (!useMultiple) {
@@ -1964,9 +2197,16 @@ Future<OperationResult> getDocumentOnCoordinator(
       }
 
       // Now prepare the requests:
-      auto* pool = trx.vocbase().server().getFeature<NetworkFeature>().pool();
+      auto& nf = trx.vocbase().server().getFeature<NetworkFeature>();
+      auto* pool = nf.pool();
+      // reads from followers outside of streaming transactions may be sent
+      // to another replica if the chosen one is slow
+      bool const hedgeReads =
+          allowDirtyReads && !isManaged && nf.hedgeFollowerReads();
       std::vector<Future<network::Response>> futures;
       futures.reserve(opCtx.shardMap.size());
+      // requests which can be combined into one request per leader
+      std::vector<ShardRequest> requests;
 
       for (auto const& it : opCtx.shardMap) {
         network::Headers headers;
@@ -2010,13 +2250,30 @@ Future<OperationResult> getDocumentOnCoordinator(
         if (allowDirtyReads) {
           auto& cf = trx.vocbase().server().getFeature<ClusterFeature>();
           ++cf.potentiallyDirtyDocumentReadsCounter();
-          reqOpts.overrideDestination = trx.state()->whichReplica(it.first);
           headers.try_emplace(StaticStrings::AllowDirtyReads, "true");
+          if (hedgeReads) {
+            futures.emplace_back(network::sendRequestHedged(
+                pool, "shard:" + it.first, hedgeReplicas(trx, it.first),
+                restVerb, std::move(url), std::move(buffer), reqOpts,
+                std::move(headers)));
+            continue;
+          }
+          reqOpts.overrideDestination = trx.state()->whichReplica(it.first);
+        } else if (useMultiple) {
+          requests.emplace_back(
+              ShardRequest{it.first, std::move(buffer), std::move(headers)});
+          continue;
         }
         futures.emplace_back(network::sendRequestRetry(
             pool, "shard:" + it.first, restVerb, std::move(url),
             std::move(buffer), reqOpts, std::move(headers)));
       }
+      if (!requests.empty()) {
+        for (auto& f : sendShardRequests(pool, *shardIds, restVerb,
+                                         std::move(requests), reqOpts)) {
+          futures.emplace_back(std::move(f));
+        }
+      }
 
       // Now compute the result
       if (!useMultiple) {  // single-shard fast track
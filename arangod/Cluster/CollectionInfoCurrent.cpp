@@ -126,6 +126,15 @@ std::vector<ServerID> CollectionInfoCurrent::failoverCandidates(
   return v;
 }
 
+cluster::ShardLoadTracker::Levels CollectionInfoCurrent::load(
+    std::string_view shardID) const {
+  auto it = _vpacks.find(shardID);
+  if (it != _vpacks.end()) {
+    return cluster::ShardLoadTracker::fromVelocyPack(it->second->slice());
+  }
+  return {};
+}
+
 std::string CollectionInfoCurrent::errorMessage(
     std::string_view shardID) const {
   auto it = _vpacks.find(shardID);
@@ -32,6 +32,7 @@
 
 #include "Basics/Common.h"
 #include "Cluster/ClusterTypes.h"
+#include "Cluster/ShardLoadTracker.h"
 #include "Containers/FlatHashMap.h"
 
 namespace arangodb {
@@ -81,6 +82,10 @@ class CollectionInfoCurrent {
   [[nodiscard]] TEST_VIRTUAL std::vector<ServerID> failoverCandidates(
       std::string_view shardID) const;
 
+  /// @brief returns the load levels reported by the leader of a shard
+  [[nodiscard]] cluster::ShardLoadTracker::Levels load(
+      std::string_view shardID) const;
+
   /// @brief returns the errorMessage entry for one shardID
   [[nodiscard]] std::string errorMessage(std::string_view shardID) const;
 
@@ -35,6 +35,7 @@
 #include "Cluster/ClusterInfo.h"
 #include "Cluster/FollowerInfo.h"
 #include "Cluster/ResignShardLeadership.h"
+#include "Cluster/ShardLoadTracker.h"
 #include "Indexes/Index.h"
 #include "Inspection/VPack.h"
 #include "Logger/LogContextKeys.h"
@@ -390,7 +391,7 @@ static void handlePlanShard(
               {LOCAL_LEADER, std::string(localLeader)},
               {OLD_CURRENT_COUNTER, "0"},  // legacy, no longer used
               {PLAN_RAFT_INDEX, std::to_string(planIndex)}},
-          LEADER_PRIORITY, true);
+          LEADERSHIP_CHANGE_PRIORITY, true);
       makeDirty.insert(dbname);
       callNotify = true;
       actions.emplace_back(std::move(description));
@@ -867,11 +868,14 @@ arangodb::Result arangodb::maintenance::diffPlanLocal(
         // Note that if `plan` is not an object, then `getShardMap` will simply
         // return an empty object, which is fine for `handleLocalShard`, so we
         // do not have to check anything else here.
+        // The shard map is built once per database, as it only depends on the
+        // plan. Building it for every local shard would be quadratic in the
+        // number of shards.
+        auto const shardMap = getShardMap(plan);  // plan shards -> servers
+        auto rv = replicationVersion.find(dbname);
+        TRI_ASSERT(rv != replicationVersion.end());
         for (auto const& lcol : VPackObjectIterator(ldbslice)) {
           auto const& colname = lcol.key.copyString();
-          auto const shardMap = getShardMap(plan);  // plan shards -> servers
-          auto rv = replicationVersion.find(dbname);
-          TRI_ASSERT(rv != replicationVersion.end());
 
           handleLocalShard(ldbname, colname, lcol.value, shardMap.slice(),
                            commonShrds, indis, serverId, actions, makeDirty,
@@ -1304,6 +1308,14 @@ static std::tuple<VPackBuilder, bool, bool> assembleLocalCollectionInfo(
         }
       }
 
+      // report how busy the shard is. the levels only change if the load
+      // changes significantly, so this does not cause constant updates of
+      // Current
+      cluster::ShardLoadTracker::toVelocyPack(
+          collection->loadTracker().update(
+              cluster::ShardLoadTracker::clock::now()),
+          ret);
+
       if (replicationVersion != replication::Version::TWO) {
         // Original replication 1 code
         size_t numFollowers;
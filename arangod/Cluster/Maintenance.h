@@ -59,6 +59,11 @@ constexpr int FOLLOWER_PRIORITY = 1;
 constexpr int LEADER_PRIORITY = 2;
 constexpr int HIGHER_PRIORITY = 2;
 constexpr int RESIGN_PRIORITY = 3;
+// Leadership changes must never wait behind other jobs. If there are enough
+// maintenance threads, one of them exclusively executes fast track jobs
+// with at least this priority.
+constexpr int LEADERSHIP_CHANGE_PRIORITY = 3;
+static_assert(RESIGN_PRIORITY >= LEADERSHIP_CHANGE_PRIORITY);
 
 // For non fast track:
 constexpr int INDEX_PRIORITY = 2;
@@ -349,11 +349,17 @@ void MaintenanceFeature::start() {
 
   initializeMetrics();
 
+  // If there are at least three workers which do not execute slow jobs,
+  // one of them is reserved for leadership changes, so that these never
+  // wait behind the creation of collections or other fast track jobs.
+  bool const leadershipWorker =
+      _maintenanceThreadsMax - _maintenanceThreadsSlowMax >= 3;
+
   // start threads
   for (uint32_t loop = 0; loop < _maintenanceThreadsMax; ++loop) {
     // First worker will be available only to fast track
     std::unordered_set<std::string> labels;
-    if (loop == 0) {
+    if (loop == 0 || (loop == 1 && leadershipWorker)) {
       labels.emplace(ActionBase::FAST_TRACK);
     }
     // The first two workers are not allowed to execute SLOW_OP_PRIORITY,
@@ -361,6 +367,9 @@ void MaintenanceFeature::start() {
     int minPrio = loop < _maintenanceThreadsMax - _maintenanceThreadsSlowMax
                       ? maintenance::NORMAL_PRIORITY
                       : maintenance::SLOW_OP_PRIORITY;
+    if (loop == 1 && leadershipWorker) {
+      minPrio = maintenance::LEADERSHIP_CHANGE_PRIORITY;
+    }
 
     auto newWorker = std::make_unique<maintenance::MaintenanceWorker>(
         *this, minPrio, labels);
@@ -32,9 +32,13 @@
 #include "Cluster/ClusterFeature.h"
 #include "Cluster/ClusterInfo.h"
 #include "Cluster/ServerState.h"
+#include "Containers/FlatHashMap.h"
 #include "GeneralServer/AuthenticationFeature.h"
 #include "Replication/ReplicationFeature.h"
 #include "Rest/Version.h"
+#include "Sharding/ShardingInfo.h"
+#include "Utils/ExecContext.h"
+#include "VocBase/LogicalCollection.h"
 
 #include <velocypack/Builder.h>
 
@@ -69,12 +73,15 @@ RestStatus RestClusterHandler::execute() {
     } else if (suffixes[0] == "cluster-info") {
       handleClusterInfo();
       return RestStatus::DONE;
+    } else if (suffixes[0] == "shard-map") {
+      handleShardMap();
+      return RestStatus::DONE;
     }
   }
 
-  generateError(
-      Result(TRI_ERROR_HTTP_NOT_FOUND,
-             "expecting /_api/cluster/[endpoints,agency-dump,agency-cache]"));
+  generateError(Result(TRI_ERROR_HTTP_NOT_FOUND,
+                       "expecting /_api/cluster/[endpoints,agency-dump,"
+                       "agency-cache,cluster-info,shard-map]"));
 
   return RestStatus::DONE;
 }
@@ -160,6 +167,106 @@ void RestClusterHandler::handleClusterInfo() {
   generateResult(rest::ResponseCode::OK, dump.slice());
 }
 
+/// @brief returns the distribution of a collection's shards, so that
+/// clients can send single-document requests directly to the leader of
+/// the responsible shard. the returned version must be sent along with
+/// such requests in the x-arango-shard-map-version header. the DB-Server
+/// refuses requests that are not for a shard it leads, and requests with
+/// a version that is newer than its own view of the Plan. clients should
+/// then fetch the map again or send their requests via a coordinator
+void RestClusterHandler::handleShardMap() {
+  if (!ServerState::instance()->isCoordinator()) {
+    generateError(rest::ResponseCode::NOT_IMPLEMENTED,
+                  TRI_ERROR_NOT_IMPLEMENTED,
+                  "only to be executed on coordinators");
+    return;
+  }
+
+  std::string const& name = _request->value("collection");
+  if (name.empty()) {
+    generateError(rest::ResponseCode::BAD, TRI_ERROR_BAD_PARAMETER,
+                  "expecting 'collection' parameter");
+    return;
+  }
+
+  std::string const& database = _request->databaseName();
+  if (!ExecContext::current().canUseCollection(database, name,
+                                               auth::Level::RO)) {
+    generateError(rest::ResponseCode::FORBIDDEN, TRI_ERROR_FORBIDDEN);
+    return;
+  }
+
+  auto& ci = server().getFeature<ClusterFeature>().clusterInfo();
+  // fetch the version first. the version returned to the client must not be
+  // newer than the data we are going to return
+  uint64_t version = ci.getPlanVersion();
+  auto collection = ci.getCollectionNT(database, name);
+  if (collection == nullptr) {
+    generateError(rest::ResponseCode::NOT_FOUND,
+                  TRI_ERROR_ARANGO_DATA_SOURCE_NOT_FOUND);
+    return;
+  }
+  if (collection->isSmart()) {
+    // smart collections distribute documents by a key prefix that
+    // clients cannot easily compute
+    generateError(rest::ResponseCode::NOT_IMPLEMENTED,
+                  TRI_ERROR_NOT_IMPLEMENTED,
+                  "shard maps are not supported for smart collections");
+    return;
+  }
+
+  auto shards = collection->shardingInfo()->shardListAsShardID();
+  // cache endpoints, many shards share the same leader
+  containers::FlatHashMap<std::string, std::string> endpoints;
+
+  VPackBuilder builder;
+  builder.openObject();
+  builder.add(StaticStrings::Error, VPackValue(false));
+  builder.add(StaticStrings::Code, VPackValue(200));
+  builder.add("version", VPackValue(version));
+  builder.add("collection", VPackValue(collection->name()));
+  builder.add("id", VPackValue(std::to_string(collection->id().id())));
+  builder.add(StaticStrings::ShardingStrategy,
+              VPackValue(collection->shardingInfo()->shardingStrategyName()));
+  builder.add(VPackValue(StaticStrings::ShardKeys));
+  builder.openArray();
+  for (auto const& key : collection->shardKeys()) {
+    builder.add(VPackValue(key));
+  }
+  builder.close();
+  builder.add(StaticStrings::NumberOfShards, VPackValue(shards->size()));
+  // shards in the order used for the hash-based distribution
+  builder.add(VPackValue("shards"));
+  builder.openArray();
+  for (auto const& shard : *shards) {
+    builder.openObject();
+    builder.add("id", VPackValue(shard));
+    auto servers = ci.getResponsibleServer(shard);
+    if (servers != nullptr && !servers->empty()) {
+      std::string leader{servers->front()};
+      auto it = endpoints.find(leader);
+      if (it == endpoints.end()) {
+        std::string endpoint = ci.getServerAdvertisedEndpoint(leader);
+        if (endpoint.empty()) {
+          endpoint = ci.getServerEndpoint(leader);
+        }
+        it = endpoints.emplace(leader, std::move(endpoint)).first;
+      }
+      builder.add("leader", VPackValue(leader));
+      builder.add("endpoint", VPackValue(it->second));
+    } else {
+      // no leader known at the moment. requests for documents in this shard
+      // must be sent to a coordinator
+      builder.add("leader", VPackValue(VPackValueType::Null));
+      builder.add("endpoint", VPackValue(VPackValueType::Null));
+    }
+    builder.close();
+  }
+  builder.close();
+  builder.close();
+  generateResult(rest::ResponseCode::OK, builder.slice());
+}
+
 /// @brief returns information about all coordinator endpoints
 void RestClusterHandler::handleCommandEndpoints() {
   ClusterInfo& ci = server().getFeature<ClusterFeature>().clusterInfo();
@@ -47,5 +47,8 @@ class RestClusterHandler : public arangodb::RestBaseHandler {
 
   /// _api/cluster/cluster-info
   void handleClusterInfo();
+
+  /// _api/cluster/shard-map
+  void handleShardMap();
 };
 }  // namespace arangodb
@@ -0,0 +1,112 @@
+////////////////////////////////////////////////////////////////////////////////
+/// DISCLAIMER
+///
+/// Copyright 2014-2023 ArangoDB GmbH, Cologne, Germany
+/// Copyright 2004-2014 triAGENS GmbH, Cologne, Germany
+///
+/// Licensed under the Apache License, Version 2.0 (the "License");
+/// you may not use this file except in compliance with the License.
+/// You may obtain a copy of the License at
+///
+///     http://www.apache.org/licenses/LICENSE-2.0
+///
+/// Unless required by applicable law or agreed to in writing, software
+/// distributed under the License is distributed on an "AS IS" BASIS,
+/// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+/// See the License for the specific language governing permissions and
+/// limitations under the License.
+///
+/// Copyright holder is ArangoDB GmbH, Cologne, Germany
+///
+/// @author Jan Steemann
+////////////////////////////////////////////////////////////////////////////////
+
+#include "ShardLoadTracker.h"
+
+#include "Basics/VelocyPackHelper.h"
+
+#include <velocypack/Builder.h>
+#include <velocypack/Slice.h>
+
+#include <algorithm>
+#include <cmath>
+#include <string_view>
+
+using namespace arangodb;
+using namespace arangodb::cluster;
+
+namespace {
+constexpr std::string_view kLoad = "load";
+constexpr std::string_view kReads = "reads";
+constexpr std::string_view kWrites = "writes";
+
+// how far the rate has to move past the boundary of the previous level,
+// in units of log2, before a different level is reported
+constexpr double kHysteresis = 0.25;
+}  // namespace
+
+ShardLoadTracker::Levels ShardLoadTracker::update(clock::time_point now) {
+  std::uint64_t reads = _reads.exchange(0, std::memory_order_relaxed);
+  std::uint64_t writes = _writes.exchange(0, std::memory_order_relaxed);
+
+  std::lock_guard guard{_mutex};
+  if (_lastUpdate == clock::time_point{} || now <= _lastUpdate) {
+    // first call. we do not know the period in which the operations
+    // happened, so we can only start measuring from here
+    _lastUpdate = now;
+    return _levels;
+  }
+
+  double elapsed = std::chrono::duration<double>(now - _lastUpdate).count();
+  _lastUpdate = now;
+
+  double alpha =
+      1.0 - std::exp(-elapsed / static_cast<double>(kAveragingPeriod.count()));
+  _readRate += alpha * (static_cast<double>(reads) / elapsed - _readRate);
+  _writeRate += alpha * (static_cast<double>(writes) / elapsed - _writeRate);
+
+  _levels.reads = levelFor(_readRate, _levels.reads);
+  _levels.writes = levelFor(_writeRate, _levels.writes);
+  return _levels;
+}
+
+double ShardLoadTracker::readRate() const {
+  std::lock_guard guard{_mutex};
+  return _readRate;
+}
+
+double ShardLoadTracker::writeRate() const {
+  std::lock_guard guard{_mutex};
+  return _writeRate;
+}
+
+std::uint32_t ShardLoadTracker::levelFor(double rate,
+                                         std::uint32_t previous) noexcept {
+  double exact = std::log2(1.0 + std::max(rate, 0.0));
+  if (std::abs(exact - static_cast<double>(previous)) < 0.5 + kHysteresis) {
+    return previous;
+  }
+  return static_cast<std::uint32_t>(std::lround(exact));
+}
+
+void ShardLoadTracker::toVelocyPack(Levels levels,
+                                    velocypack::Builder& builder) {
+  builder.add(kLoad, velocypack::Value(velocypack::ValueType::Object));
+  builder.add(kReads, velocypack::Value(levels.reads));
+  builder.add(kWrites, velocypack::Value(levels.writes));
+  builder.close();
+}
+
+ShardLoadTracker::Levels ShardLoadTracker::fromVelocyPack(
+    velocypack::Slice shardCurrent) {
+  Levels levels;
+  if (shardCurrent.isObject()) {
+    if (auto load = shardCurrent.get(kLoad); load.isObject()) {
+      levels.reads = basics::VelocyPackHelper::getNumericValue<std::uint32_t>(
+          load, kReads, 0);
+      levels.writes = basics::VelocyPackHelper::getNumericValue<std::uint32_t>(
+          load, kWrites, 0);
+    }
+  }
+  return levels;
+}
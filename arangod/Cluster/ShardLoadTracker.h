@@ -0,0 +1,97 @@
+////////////////////////////////////////////////////////////////////////////////
+/// DISCLAIMER
+///
+/// Copyright 2014-2023 ArangoDB GmbH, Cologne, Germany
+/// Copyright 2004-2014 triAGENS GmbH, Cologne, Germany
+///
+/// Licensed under the Apache License, Version 2.0 (the "License");
+/// you may not use this file except in compliance with the License.
+/// You may obtain a copy of the License at
+///
+///     http://www.apache.org/licenses/LICENSE-2.0
+///
+/// Unless required by applicable law or agreed to in writing, software
+/// distributed under the License is distributed on an "AS IS" BASIS,
+/// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+/// See the License for the specific language governing permissions and
+/// limitations under the License.
+///
+/// Copyright holder is ArangoDB GmbH, Cologne, Germany
+///
+/// @author Jan Steemann
+////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+
+namespace arangodb::velocypack {
+class Builder;
+class Slice;
+}  // namespace arangodb::velocypack
+
+namespace arangodb::cluster {
+
+/// @brief counts the document reads and writes on a shard leader, so that
+/// the maintenance can report how busy each shard is to Current in the
+/// agency. the shard rebalancer uses these values to give hot shards a
+/// higher weight, so that their leaderships are spread over the DB servers.
+/// rates are tracked as exponentially weighted moving averages, and are
+/// reported as coarse levels on a logarithmic scale, so that Current only
+/// needs to be updated when the load of a shard changes significantly.
+class ShardLoadTracker {
+ public:
+  using clock = std::chrono::steady_clock;
+
+  /// @brief time constant of the moving averages
+  static constexpr std::chrono::seconds kAveragingPeriod{60};
+
+  struct Levels {
+    std::uint32_t reads = 0;
+    std::uint32_t writes = 0;
+
+    bool operator==(Levels const&) const noexcept = default;
+  };
+
+  void trackReads(std::uint64_t value) noexcept {
+    _reads.fetch_add(value, std::memory_order_relaxed);
+  }
+  void trackWrites(std::uint64_t value) noexcept {
+    _writes.fetch_add(value, std::memory_order_relaxed);
+  }
+
+  /// @brief folds the operations counted since the previous call into the
+  /// moving averages and returns the current load levels. this is called
+  /// by the maintenance whenever it reports the shard
+  Levels update(clock::time_point now);
+
+  /// @brief current moving averages, in operations per second
+  double readRate() const;
+  double writeRate() const;
+
+  /// @brief converts a rate into a load level. a level of n roughly means
+  /// 2^n operations per second. the previous level is kept as long as the
+  /// rate does not move far away from it, to avoid flapping between two
+  /// adjacent levels
+  static std::uint32_t levelFor(double rate, std::uint32_t previous) noexcept;
+
+  /// @brief adds the levels as attribute "load" to the Current entry of
+  /// the shard, and reads them back from there
+  static void toVelocyPack(Levels levels, velocypack::Builder& builder);
+  static Levels fromVelocyPack(velocypack::Slice shardCurrent);
+
+ private:
+  std::atomic<std::uint64_t> _reads{0};
+  std::atomic<std::uint64_t> _writes{0};
+
+  mutable std::mutex _mutex;
+  clock::time_point _lastUpdate{};
+  double _readRate = 0.0;
+  double _writeRate = 0.0;
+  Levels _levels;
+};
+
+}  // namespace arangodb::cluster
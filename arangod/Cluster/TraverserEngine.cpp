@@ -281,7 +281,7 @@ graph::EdgeCursor* BaseTraverserEngine::getCursor(std::string_view nextVertex,
 }
 
 void BaseTraverserEngine::getEdges(VPackSlice vertex, size_t depth,
-                                   VPackBuilder& builder) {
+                                   VPackBuilder& builder, bool groupByVertex) {
   auto outputVertex = [this](VPackBuilder& builder, VPackSlice vertex,
                              size_t depth) {
     TRI_ASSERT(vertex.isString());
@@ -315,7 +315,13 @@ void BaseTraverserEngine::getEdges(VPackSlice vertex, size_t depth,
   builder.openArray(true);
   if (vertex.isArray()) {
     for (VPackSlice v : VPackArrayIterator(vertex)) {
+      if (groupByVertex) {
+        builder.openArray(true);
+      }
       outputVertex(builder, v, depth);
+      if (groupByVertex) {
+        builder.close();
+      }
     }
   } else if (vertex.isString()) {
     outputVertex(builder, vertex, depth);
@@ -405,7 +411,7 @@ ShortestPathEngine::ShortestPathEngine(TRI_vocbase_t& vocbase,
 ShortestPathEngine::~ShortestPathEngine() = default;
 
 void ShortestPathEngine::getEdges(VPackSlice vertex, bool backward,
-                                  VPackBuilder& builder) {
+                                  VPackBuilder& builder, bool groupByVertex) {
   TRI_ASSERT(vertex.isString() || vertex.isArray());
 
   builder.openObject();
@@ -413,6 +419,16 @@ void ShortestPathEngine::getEdges(VPackSlice vertex, bool backward,
               VPackValue(VPackValueType::Array));
   if (vertex.isArray()) {
     for (VPackSlice v : VPackArrayIterator(vertex)) {
+      if (groupByVertex) {
+        // keep one (possibly empty) array per vertex, so that the caller
+        // can map the edges back to the vertices
+        builder.openArray(true);
+        if (v.isString()) {
+          addEdgeData(builder, backward, v.stringView());
+        }
+        builder.close();
+        continue;
+      }
       if (!v.isString()) {
         continue;
       }
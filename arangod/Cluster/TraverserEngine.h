@@ -111,8 +111,11 @@ class BaseTraverserEngine : public BaseEngine {
 
   ~BaseTraverserEngine();
 
+  // if groupByVertex is set and an array of vertices is given, the edges
+  // of each vertex are returned in a separate array, in the order of the
+  // vertices
   void getEdges(arangodb::velocypack::Slice, size_t,
-                arangodb::velocypack::Builder&);
+                arangodb::velocypack::Builder&, bool groupByVertex = false);
 
   graph::EdgeCursor* getCursor(std::string_view nextVertex,
                                uint64_t currentDepth);
@@ -156,7 +159,7 @@ class ShortestPathEngine : public BaseEngine {
   ~ShortestPathEngine();
 
   void getEdges(arangodb::velocypack::Slice, bool backward,
-                arangodb::velocypack::Builder&);
+                arangodb::velocypack::Builder&, bool groupByVertex = false);
 
   EngineType getType() const override { return SHORTESTPATH; }
 
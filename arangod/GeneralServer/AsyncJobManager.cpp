@@ -24,16 +24,22 @@
 #include "AsyncJobManager.h"
 
 #include "Basics/ReadLocker.h"
+#include "Basics/StaticStrings.h"
 #include "Basics/WriteLocker.h"
 #include "Basics/system-functions.h"
 #include "Basics/voc-errors.h"
 #include "Cluster/ServerState.h"
 #include "GeneralServer/RestHandler.h"
 #include "Logger/Logger.h"
+#include "Metrics/Gauge.h"
+#include "Rest/GeneralRequest.h"
 #include "Rest/GeneralResponse.h"
 #include "RestServer/SoftShutdownFeature.h"
 #include "Utils/ExecContext.h"
 
+#include <velocypack/Buffer.h>
+#include <velocypack/Builder.h>
+
 namespace {
 bool authorized(
     std::pair<std::string, arangodb::rest::AsyncJobResult> const& job) {
@@ -44,6 +50,33 @@ bool authorized(
 
   return (job.first == exec.user());
 }
+
+// replace the contents of a response that is too large to be stored with
+// an error, so that the client will get to know when fetching the result
+void replaceWithError(arangodb::GeneralResponse& response,
+                      arangodb::GeneralRequest const* request) {
+  using namespace arangodb;
+
+  auto code = GeneralResponse::responseCode(TRI_ERROR_RESOURCE_LIMIT);
+  response.reset(code);
+
+  VPackBuffer<uint8_t> buffer;
+  VPackBuilder builder(buffer);
+  builder.add(VPackValue(VPackValueType::Object));
+  builder.add(StaticStrings::Code, VPackValue(static_cast<int>(code)));
+  builder.add(StaticStrings::Error, VPackValue(true));
+  builder.add(StaticStrings::ErrorMessage,
+              VPackValue("async job result exceeds the memory limit for "
+                         "stored job results"));
+  builder.add(StaticStrings::ErrorNum, VPackValue(TRI_ERROR_RESOURCE_LIMIT));
+  builder.close();
+
+  if (request != nullptr) {
+    response.setContentType(request->contentTypeResponse());
+  }
+  response.setPayload(std::move(buffer), VPackOptions::Defaults,
+                      /*resolveExternals*/ false);
+}
 }  // namespace
 
 using namespace arangodb;
@@ -51,20 +84,32 @@ using namespace arangodb::basics;
 using namespace arangodb::rest;
 
 AsyncJobResult::AsyncJobResult()
-    : _jobId(0), _response(nullptr), _stamp(0.0), _status(JOB_UNDEFINED) {}
+    : _jobId(0),
+      _response(nullptr),
+      _memoryUsage(0),
+      _stamp(0.0),
+      _status(JOB_UNDEFINED) {}
 
 AsyncJobResult::AsyncJobResult(IdType jobId, Status status,
                                std::shared_ptr<RestHandler>&& handler)
     : _jobId(jobId),
       _response(nullptr),
+      _memoryUsage(0),
       _stamp(TRI_microtime()),
       _status(status),
       _handler(std::move(handler)) {}
 
 AsyncJobResult::~AsyncJobResult() = default;
 
-AsyncJobManager::AsyncJobManager()
-    : _lock(), _jobs(), _softShutdownOngoing(false) {}
+AsyncJobManager::AsyncJobManager(
+    std::uint64_t maxResultsMemoryUsage,
+    metrics::Gauge<std::uint64_t>* resultsMemoryUsageMetric)
+    : _lock(),
+      _jobs(),
+      _maxResultsMemoryUsage(maxResultsMemoryUsage),
+      _resultsMemoryUsage(0),
+      _resultsMemoryUsageMetric(resultsMemoryUsageMetric),
+      _softShutdownOngoing(false) {}
 
 AsyncJobManager::~AsyncJobManager() {
   // remove all results that haven't been fetched
@@ -98,8 +143,8 @@ GeneralResponse* AsyncJobManager::getJobResult(AsyncJobResult::IdType jobId,
     return nullptr;
   }
 
-  // remove the job from the list
-  _jobs.erase(it);
+  // remove the job from the list. the caller takes over the response
+  eraseJob(it, /*deleteResponse*/ false);
   return response;
 }
 
@@ -116,14 +161,8 @@ bool AsyncJobManager::deleteJobResult(AsyncJobResult::IdType jobId) {
     return false;
   }
 
-  GeneralResponse* response = (*it).second.second._response;
-
-  if (response != nullptr) {
-    delete response;
-  }
-
   // remove the job from the list
-  _jobs.erase(it);
+  eraseJob(it, /*deleteResponse*/ true);
   return true;
 }
 
@@ -138,11 +177,7 @@ void AsyncJobManager::deleteJobs() {
 
   while (it != _jobs.end()) {
     if (::authorized(it->second)) {
-      GeneralResponse* response = (*it).second.second._response;
-      if (response != nullptr) {
-        delete response;
-      }
-      _jobs.erase(it++);
+      it = eraseJob(it, /*deleteResponse*/ true);
     } else {
       ++it;
     }
@@ -156,16 +191,8 @@ void AsyncJobManager::deleteExpiredJobResults(double stamp) {
 
   while (it != _jobs.end()) {
     if (::authorized(it->second)) {
-      AsyncJobResult ajr = (*it).second.second;
-
-      if (ajr._stamp < stamp) {
-        GeneralResponse* response = ajr._response;
-
-        if (response != nullptr) {
-          delete response;
-        }
-
-        _jobs.erase(it++);
+      if ((*it).second.second._stamp < stamp) {
+        it = eraseJob(it, /*deleteResponse*/ true);
       } else {
         ++it;
       }
@@ -205,14 +232,15 @@ Result AsyncJobManager::clearAllJobs() {
   Result rv;
   WRITE_LOCKER(writeLocker, _lock);
 
-  for (auto& it : _jobs) {
-    std::shared_ptr<RestHandler>& handler = it.second.second._handler;
+  auto it = _jobs.begin();
+  while (it != _jobs.end()) {
+    std::shared_ptr<RestHandler>& handler = it->second.second._handler;
 
     if (handler != nullptr) {
       handler->cancel();
     }
+    it = eraseJob(it, /*deleteResponse*/ true);
   }
-  _jobs.clear();
 
   return rv;
 }
@@ -281,6 +309,11 @@ std::pair<uint64_t, uint64_t> AsyncJobManager::getNrPendingAndDone() {
   return std::pair(pending, done);
 }
 
+std::uint64_t AsyncJobManager::resultsMemoryUsage() const {
+  READ_LOCKER(readLocker, _lock);
+  return _resultsMemoryUsage;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// @brief initializes an async job, throws if soft shutdown is already
 /// ongoing.
@@ -319,8 +352,45 @@ void AsyncJobManager::finishAsyncJob(RestHandler* handler) {
       return;  // job is already canceled
     }
 
+    std::uint64_t memoryUsage = 0;
+    if (response != nullptr) {
+      memoryUsage = response->memoryUsage();
+      if (_maxResultsMemoryUsage > 0 &&
+          _resultsMemoryUsage + memoryUsage > _maxResultsMemoryUsage) {
+        // storing this result would exceed the configured limit
+        LOG_TOPIC("5f2e1", DEBUG, Logger::REQUESTS)
+            << "not storing result of async job " << jobId << " with size "
+            << memoryUsage << " because it would exceed the memory limit "
+            << "for async job results";
+        ::replaceWithError(*response, handler->request());
+        memoryUsage = response->memoryUsage();
+      }
+    }
+
     it->second.second._response = response.release();
+    it->second.second._memoryUsage = memoryUsage;
     it->second.second._status = AsyncJobResult::JOB_DONE;
     it->second.second._stamp = TRI_microtime();
+
+    _resultsMemoryUsage += memoryUsage;
+    if (_resultsMemoryUsageMetric != nullptr) {
+      _resultsMemoryUsageMetric->fetch_add(memoryUsage);
+    }
+  }
+}
+
+AsyncJobManager::JobList::iterator AsyncJobManager::eraseJob(
+    JobList::iterator it, bool deleteResponse) {
+  AsyncJobResult& job = it->second.second;
+
+  TRI_ASSERT(_resultsMemoryUsage >= job._memoryUsage);
+  _resultsMemoryUsage -= job._memoryUsage;
+  if (_resultsMemoryUsageMetric != nullptr) {
+    _resultsMemoryUsageMetric->fetch_sub(job._memoryUsage);
+  }
+
+  if (deleteResponse) {
+    delete job._response;
   }
+  return _jobs.erase(it);
 }
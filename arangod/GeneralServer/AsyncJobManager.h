@@ -29,6 +29,7 @@
 #include "Basics/Common.h"
 #include "Basics/ReadWriteLock.h"
 #include "Basics/Result.h"
+#include "Metrics/Fwd.h"
 
 namespace arangodb {
 class GeneralResponse;
@@ -56,6 +57,8 @@ struct AsyncJobResult {
  public:
   IdType _jobId;
   GeneralResponse* _response;
+  // memory used by _response, as accounted for by the AsyncJobManager
+  std::uint64_t _memoryUsage;
   double _stamp;
   Status _status;
   std::shared_ptr<RestHandler> _handler;
@@ -76,7 +79,13 @@ class AsyncJobManager {
       JobList;
 
  public:
-  AsyncJobManager();
+  /// @brief create the job manager. if maxResultsMemoryUsage is not 0, the
+  /// results of finished jobs are only stored as long as their combined
+  /// memory usage stays below this value. the results of jobs that would
+  /// exceed it are replaced with an error
+  explicit AsyncJobManager(
+      std::uint64_t maxResultsMemoryUsage = 0,
+      metrics::Gauge<std::uint64_t>* resultsMemoryUsageMetric = nullptr);
   ~AsyncJobManager();
 
  public:
@@ -100,14 +109,30 @@ class AsyncJobManager {
   void finishAsyncJob(RestHandler*);
   std::pair<uint64_t, uint64_t> getNrPendingAndDone();
 
+  /// @brief memory used by the stored results of finished jobs
+  std::uint64_t resultsMemoryUsage() const;
+
   void initiateSoftShutdown() {
     _softShutdownOngoing.store(true, std::memory_order_relaxed);
   }
 
  private:
-  basics::ReadWriteLock _lock;
+  /// @brief remove a job from the list and update the memory accounting.
+  /// the job's response is deleted if deleteResponse is true. must be
+  /// called with the write lock held
+  JobList::iterator eraseJob(JobList::iterator it, bool deleteResponse);
+
+  mutable basics::ReadWriteLock _lock;
   JobList _jobs;
 
+  /// @brief maximum memory usage of stored results (0 = unlimited)
+  std::uint64_t const _maxResultsMemoryUsage;
+
+  /// @brief current memory usage of stored results. protected by _lock
+  std::uint64_t _resultsMemoryUsage;
+
+  metrics::Gauge<std::uint64_t>* _resultsMemoryUsageMetric;
+
   ////////////////////////////////////////////////////////////////////////////
   /// @brief flag, if a soft shutdown is ongoing, this is used for the soft
   /// shutdown feature in coordinators, it is initially `false` and is set
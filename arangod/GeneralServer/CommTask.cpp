@@ -147,7 +147,8 @@ CommTask::CommTask(GeneralServer& server, ConnectionInfo info)
     : _server(server),
       _connectionInfo(std::move(info)),
       _connectionStatistics(ConnectionStatistics::acquire()),
-      _auth(AuthenticationFeature::instance()) {
+      _auth(AuthenticationFeature::instance()),
+      _lastAuthToken(auth::TokenCache::Entry::Unauthenticated()) {
   TRI_ASSERT(_auth != nullptr);
   _connectionStatistics.SET_START();
 }
@@ -628,6 +629,34 @@ void CommTask::sendSimpleResponse(rest::ResponseCode code,
   }
 }
 
+/// @brief send HTTP 503 with a retry-after header, for requests rejected
+/// by the scheduler's admission control
+void CommTask::sendOverloadResponse(rest::ContentType respType,
+                                    uint64_t messageId) {
+  VPackBuffer<uint8_t> buffer;
+  VPackBuilder builder(buffer);
+  builder.openObject();
+  builder.add(StaticStrings::Error, VPackValue(true));
+  builder.add(StaticStrings::ErrorNum, VPackValue(TRI_ERROR_QUEUE_FULL));
+  builder.add(StaticStrings::ErrorMessage,
+              VPackValue("request lane is overloaded"));
+  builder.add(StaticStrings::Code,
+              VPackValue(static_cast<int>(ResponseCode::SERVICE_UNAVAILABLE)));
+  builder.close();
+
+  try {
+    auto resp = createResponse(ResponseCode::SERVICE_UNAVAILABLE, messageId);
+    resp->setContentType(respType);
+    resp->setHeaderNC(StaticStrings::RetryAfter, "1");
+    resp->setPayload(std::move(buffer), VPackOptions::Defaults);
+    sendResponse(std::move(resp), this->stealStatistics(messageId));
+  } catch (...) {
+    LOG_TOPIC("3c9e1", WARN, Logger::REQUESTS)
+        << "sendOverloadResponse received an exception, closing connection";
+    stop();
+  }
+}
+
 /// @brief send response including error response body
 void CommTask::sendErrorResponse(rest::ResponseCode code,
                                  rest::ContentType respType, uint64_t messageId,
@@ -704,10 +733,19 @@ void CommTask::handleRequestStartup(std::shared_ptr<RestHandler> handler) {
 void CommTask::handleRequestSync(std::shared_ptr<RestHandler> handler) {
   DTRACE_PROBE2(arangod, CommTaskHandleRequestSync, this, handler.get());
 
-  RequestLane lane = handler->determineRequestLane();
-  handler->trackQueueStart();
   // We just injected the request pointer before calling this method
   TRI_ASSERT(handler->request() != nullptr);
+  RequestLane lane = handler->determineRequestLane();
+
+  if (!handler->admitToLane()) {
+    // the request lane is overloaded. reject the request right away
+    // instead of letting it wait in the queue
+    sendOverloadResponse(handler->request()->contentTypeResponse(),
+                         handler->messageId());
+    return;
+  }
+
+  handler->trackQueueStart();
   LOG_TOPIC("ecd0a", DEBUG, Logger::REQUESTS)
       << "Handling request " << (void*)this << " on path "
       << handler->request()->requestPath() << " on lane " << lane;
@@ -1016,8 +1054,21 @@ auth::TokenCache::Entry CommTask::checkAuthHeader(GeneralRequest& req,
     return auth::TokenCache::Entry::Unauthenticated();
   }
 
-  auto authToken =
-      this->_auth->tokenCache().checkAuthentication(authMethod, mode, auth);
+  // clients on keep-alive connections usually send the same credentials
+  // for every request. reuse the result of the previous check then, so
+  // that we do not have to look up the credentials in the token cache
+  auto& tokenCache = this->_auth->tokenCache();
+  if (authStr != _lastAuthHeader ||
+      !tokenCache.canReuse(authMethod, _lastAuthToken, _lastAuthVersion)) {
+    _lastAuthVersion = tokenCache.version();
+    _lastAuthToken = tokenCache.checkAuthentication(authMethod, mode, auth);
+    if (_lastAuthToken.authenticated()) {
+      _lastAuthHeader = authStr;
+    } else {
+      _lastAuthHeader.clear();
+    }
+  }
+  auth::TokenCache::Entry const& authToken = _lastAuthToken;
   req.setAuthenticated(authToken.authenticated());
   req.setTokenExpiry(authToken.expiry());
   req.setUser(authToken.username());  // do copy here, so that we do not
@@ -1053,6 +1104,15 @@ bool CommTask::handleContentEncoding(GeneralRequest& req) {
       }
       req.setPayload(std::move(dst));
       return true;
+    } else if (encoding == StaticStrings::EncodingArangoLz4) {
+      // only used for cluster-internal requests
+      VPackBuffer<uint8_t> dst;
+      if (arangodb::encoding::lz4Uncompress(src, len, dst) !=
+          TRI_ERROR_NO_ERROR) {
+        return false;
+      }
+      req.setPayload(std::move(dst));
+      return true;
     }
     return false;
   };
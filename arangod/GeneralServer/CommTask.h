@@ -130,6 +130,10 @@ class CommTask : public std::enable_shared_from_this<CommTask> {
                          uint64_t messageId, ErrorCode errorNum,
                          std::string_view errorMessage = {});
 
+  /// @brief send HTTP 503 with a retry-after header for a request that was
+  /// rejected by the scheduler's admission control
+  void sendOverloadResponse(rest::ContentType, uint64_t messageId);
+
   /// @brief send simple response including response body
   void sendSimpleResponse(rest::ResponseCode, rest::ContentType,
                           uint64_t messageId, velocypack::Buffer<uint8_t>&&);
@@ -169,6 +173,14 @@ class CommTask : public std::enable_shared_from_this<CommTask> {
   ConnectionStatistics::Item _connectionStatistics;
   std::chrono::milliseconds _keepAliveTimeout;
   AuthenticationFeature* _auth;
+
+ private:
+  /// @brief value of the authorization header of the last request on this
+  /// connection that was authenticated successfully, and the result and
+  /// token cache version of its check. used by checkAuthHeader() only
+  std::string _lastAuthHeader;
+  auth::TokenCache::Entry _lastAuthToken;
+  uint64_t _lastAuthVersion = 0;
 };
 }  // namespace rest
 }  // namespace arangodb
@@ -49,6 +49,7 @@
 #include "GeneralServer/GeneralServer.h"
 #include "GeneralServer/RestHandlerFactory.h"
 #include "GeneralServer/SslServerFeature.h"
+#include "InternalRestHandler/InternalRestDocumentBatchHandler.h"
 #include "InternalRestHandler/InternalRestTraverserHandler.h"
 #include "Metrics/CounterBuilder.h"
 #include "Metrics/HistogramBuilder.h"
@@ -155,12 +156,18 @@ DECLARE_COUNTER(arangodb_vst_connections_total,
                 "Total number of VST connections");
 DECLARE_GAUGE(arangodb_requests_memory_usage, std::uint64_t,
               "Memory consumed by incoming requests");
+DECLARE_GAUGE(arangodb_async_job_results_memory_usage, std::uint64_t,
+              "Memory consumed by stored results of async jobs");
 
 GeneralServerFeature::GeneralServerFeature(Server& server)
     : ArangodFeature{server, *this},
       _currentRequestsSize(server.getFeature<metrics::MetricsFeature>().add(
           arangodb_requests_memory_usage{})),
+      _asyncJobResultsMemoryUsage(
+          server.getFeature<metrics::MetricsFeature>().add(
+              arangodb_async_job_results_memory_usage{})),
       _telemetricsMaxRequestsPerInterval(3),
+      _maxAsyncJobResultsMemoryUsage(0),
 #ifdef ARANGODB_ENABLE_MAINTAINER_MODE
       _startedListening(false),
 #endif
@@ -251,6 +258,28 @@ The purpose of this option is to keep a deployment from being overwhelmed by
 too many telemetrics requests issued by arangosh instances that are used for
 batch processing.)");
 
+  options
+      ->addOption(
+          "--server.async-job-results-memory-limit",
+          "The maximum combined memory usage of stored async job results "
+          "(in bytes, 0 = unlimited).",
+          new UInt64Parameter(&_maxAsyncJobResultsMemoryUsage),
+          arangodb::options::makeFlags(
+              arangodb::options::Flags::Uncommon,
+              arangodb::options::Flags::DefaultNoComponents,
+              arangodb::options::Flags::OnCoordinator,
+              arangodb::options::Flags::OnSingle))
+      .setIntroducedIn(31200)
+      .setLongDescription(R"(The results of requests sent with the
+`x-arango-async: store` header are kept in memory until they are fetched or
+deleted by the client. If this option is set to a value greater than 0, the
+result of a job is not stored if that would make the combined memory usage of
+all stored results exceed the configured value. Fetching the result of such a
+job returns an error instead.
+
+The current memory usage of stored results is reported by the
+`arangodb_async_job_results_memory_usage` metric.)");
+
   options->addOption(
       "--server.io-threads", "The number of threads used to handle I/O.",
       new UInt64Parameter(&_numIoThreads),
@@ -405,7 +434,8 @@ void GeneralServerFeature::prepare() {
     _enableTelemetrics = false;
   }
 
-  _jobManager = std::make_unique<AsyncJobManager>();
+  _jobManager = std::make_unique<AsyncJobManager>(
+      _maxAsyncJobResultsMemoryUsage, &_asyncJobResultsMemoryUsage);
 
   // create an initial, very stripped-down RestHandlerFactory.
   // this initial factory only knows a few selected RestHandlers.
@@ -770,6 +800,10 @@ void GeneralServerFeature::defineRemainingHandlers(
           aql::QueryRegistry*>,
       queryRegistry);
 
+  f.addPrefixHandler(
+      RestVocbaseBaseHandler::INTERNAL_DOCUMENT_BATCH_PATH,
+      RestHandlerCreator<InternalRestDocumentBatchHandler>::createNoData);
+
   // And now some handlers which are registered in both /_api and /_admin
   f.addHandler("/_admin/actions",
                RestHandlerCreator<MaintenanceRestHandler>::createNoData);
@@ -93,6 +93,7 @@ class GeneralServerFeature final : public ArangodFeature {
   }
 
   metrics::Gauge<std::uint64_t>& _currentRequestsSize;
+  metrics::Gauge<std::uint64_t>& _asyncJobResultsMemoryUsage;
 
  private:
   // build HTTP server(s)
@@ -106,6 +107,7 @@ class GeneralServerFeature final : public ArangodFeature {
 
   double _keepAliveTimeout = 300.0;
   uint64_t _telemetricsMaxRequestsPerInterval;
+  uint64_t _maxAsyncJobResultsMemoryUsage;
 #ifdef ARANGODB_ENABLE_MAINTAINER_MODE
   bool _startedListening;
 #endif
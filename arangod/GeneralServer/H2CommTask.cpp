@@ -140,7 +140,7 @@ template<SocketType T>
   } else if (std::string_view(":authority") == field) {
     // simon: ignore, could treat like "Host" header
   } else {  // fall through
-    strm->request->setHeader(std::string(field), std::string(val));
+    strm->request->setHeader(field, val);
   }
 
   return HPE_OK;
@@ -139,8 +139,9 @@ int HttpCommTask<T>::on_header_field(llhttp_t* p, const char* at,
                                      size_t len) try {
   HttpCommTask<T>* me = static_cast<HttpCommTask<T>*>(p->data);
   if (me->_lastHeaderWasValue) {
-    me->_request->setHeader(std::move(me->_lastHeaderField),
-                            std::move(me->_lastHeaderValue));
+    // the header field and value buffers are reused for the next header.
+    // setHeader only copies them if the header needs to be stored
+    me->_request->setHeader(me->_lastHeaderField, me->_lastHeaderValue);
     me->_lastHeaderField.assign(at, len);
   } else {
     me->_lastHeaderField.append(at, len);
@@ -175,8 +176,9 @@ int HttpCommTask<T>::on_header_complete(llhttp_t* p) try {
   HttpCommTask<T>* me = static_cast<HttpCommTask<T>*>(p->data);
   me->_response.reset();
   if (!me->_lastHeaderField.empty()) {
-    me->_request->setHeader(std::move(me->_lastHeaderField),
-                            std::move(me->_lastHeaderValue));
+    me->_request->setHeader(me->_lastHeaderField, me->_lastHeaderValue);
+    me->_lastHeaderField.clear();
+    me->_lastHeaderValue.clear();
   }
 
   bool found;
@@ -27,7 +27,7 @@
 #include <iostream>
 
 namespace {
-std::string LaneName(arangodb::RequestLane lane) {
+std::string_view LaneName(arangodb::RequestLane lane) noexcept {
   switch (lane) {
     case arangodb::RequestLane::CLIENT_FAST:
       return "CLIENT_FAST";
@@ -99,6 +99,20 @@ std::string PriorityName(arangodb::RequestLane lane) {
 }  // namespace
 
 namespace arangodb {
+std::string_view RequestLaneName(RequestLane lane) noexcept {
+  return LaneName(lane);
+}
+
+std::optional<RequestLane> RequestLaneFromName(std::string_view name) {
+  for (std::size_t i = 0; i < kNumRequestLanes; ++i) {
+    auto lane = static_cast<RequestLane>(i);
+    if (LaneName(lane) == name) {
+      return lane;
+    }
+  }
+  return std::nullopt;
+}
+
 std::ostream& operator<<(std::ostream& out, RequestLane const& lane) {
   out << LaneName(lane);
   out << " with priority: ";
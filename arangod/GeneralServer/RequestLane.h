@@ -23,7 +23,10 @@
 
 #pragma once
 
+#include <cstddef>
 #include <iosfwd>
+#include <optional>
+#include <string_view>
 
 namespace arangodb {
 enum class RequestLane {
@@ -188,6 +191,17 @@ constexpr inline RequestPriority PriorityRequestLane(RequestLane lane) {
   return RequestPriority::LOW;
 }
 
+/// @brief number of different request lanes, including UNDEFINED
+constexpr std::size_t kNumRequestLanes =
+    static_cast<std::size_t>(RequestLane::UNDEFINED) + 1;
+
+/// @brief returns the name of a request lane, e.g. "CLIENT_AQL"
+std::string_view RequestLaneName(RequestLane lane) noexcept;
+
+/// @brief look up a request lane by its name, e.g. "CLIENT_AQL". returns
+/// std::nullopt for unknown names
+std::optional<RequestLane> RequestLaneFromName(std::string_view name);
+
 std::ostream& operator<<(std::ostream&, arangodb::RequestLane const& lane);
 
 }  // namespace arangodb
@@ -34,10 +34,12 @@
 #include "Cluster/ClusterFeature.h"
 #include "Cluster/ClusterInfo.h"
 #include "Cluster/ServerState.h"
+#include "CrashHandler/SamplingProfiler.h"
 #include "Futures/Utilities.h"
 #include "GeneralServer/AuthenticationFeature.h"
 #include "Logger/LogMacros.h"
 #include "Logger/LogStructuredParamsAllowList.h"
+#include "Logger/Tracing.h"
 #include "Network/Methods.h"
 #include "Network/NetworkFeature.h"
 #include "Network/Utils.h"
@@ -85,6 +87,10 @@ RestHandler::~RestHandler() {
     TRI_ASSERT(SchedulerFeature::SCHEDULER != nullptr);
     SchedulerFeature::SCHEDULER->trackEndOngoingLowPriorityTask();
   }
+  if (_admittedToLane) {
+    TRI_ASSERT(SchedulerFeature::SCHEDULER != nullptr);
+    SchedulerFeature::SCHEDULER->releaseRequest(determineRequestLane());
+  }
 }
 
 // -----------------------------------------------------------------------------
@@ -126,13 +132,33 @@ RequestLane RestHandler::determineRequestLane() {
   return _lane;
 }
 
+bool RestHandler::admitToLane() noexcept {
+  TRI_ASSERT(!_admittedToLane);
+  TRI_ASSERT(SchedulerFeature::SCHEDULER != nullptr);
+  _admittedToLane =
+      SchedulerFeature::SCHEDULER->admitRequest(determineRequestLane());
+  return _admittedToLane;
+}
+
 void RestHandler::trackQueueStart() noexcept {
   TRI_ASSERT(SchedulerFeature::SCHEDULER != nullptr);
   _statistics.SET_QUEUE_START(
       SchedulerFeature::SCHEDULER->queueStatistics()._queued);
+  if (_admittedToLane) {
+    _queueStart = std::chrono::steady_clock::now();
+  }
 }
 
-void RestHandler::trackQueueEnd() noexcept { _statistics.SET_QUEUE_END(); }
+void RestHandler::trackQueueEnd() noexcept {
+  _statistics.SET_QUEUE_END();
+  if (_admittedToLane) {
+    std::chrono::duration<double> queueTime =
+        std::chrono::steady_clock::now() - _queueStart;
+    TRI_ASSERT(SchedulerFeature::SCHEDULER != nullptr);
+    SchedulerFeature::SCHEDULER->trackRequestQueueTime(determineRequestLane(),
+                                                       queueTime.count());
+  }
+}
 
 void RestHandler::trackTaskStart() noexcept {
   TRI_ASSERT(!_trackedAsOngoingLowPrio);
@@ -159,6 +185,11 @@ void RestHandler::trackTaskEnd() noexcept {
         static_cast<uint64_t>(_statistics.ELAPSED_WHILE_QUEUED() * 1000.0);
     SchedulerFeature::SCHEDULER->setLastLowPriorityDequeueTime(queueTimeMs);
   }
+  if (_admittedToLane) {
+    TRI_ASSERT(SchedulerFeature::SCHEDULER != nullptr);
+    SchedulerFeature::SCHEDULER->releaseRequest(determineRequestLane());
+    _admittedToLane = false;
+  }
 }
 
 RequestStatistics::Item&& RestHandler::stealStatistics() {
@@ -419,6 +450,7 @@ void RestHandler::runHandlerStateMachine() {
 
       case HandlerState::FINALIZE:
         _statistics.SET_REQUEST_END();
+        endTraceSpan();
 
         // shutdownExecute is noexcept
         shutdownExecute(true);  // may not be moved down
@@ -433,6 +465,7 @@ void RestHandler::runHandlerStateMachine() {
 
       case HandlerState::FAILED:
         _statistics.SET_REQUEST_END();
+        endTraceSpan();
         // Callback may stealStatistics!
         _callback(this);
 
@@ -452,6 +485,7 @@ void RestHandler::runHandlerStateMachine() {
 void RestHandler::prepareEngine() {
   // set end immediately so we do not get negative statistics
   _statistics.SET_REQUEST_START_END();
+  startTraceSpan();
 
   if (_canceled) {
     _state = HandlerState::FAILED;
@@ -479,10 +513,61 @@ void RestHandler::prepareEngine() {
   _state = HandlerState::FAILED;
 }
 
+void RestHandler::startTraceSpan() {
+  if (!tracing::Tracer::enabled()) {
+    return;
+  }
+  // continue the trace of the caller, if the request is part of one
+  tracing::SpanContext parent;
+  bool found = false;
+  std::string const& traceParent =
+      _request->header(std::string(tracing::kTraceParentHeader), found);
+  if (found) {
+    parent = tracing::SpanContext::fromTraceParent(traceParent).value_or(
+        tracing::SpanContext{});
+  }
+  _traceSpan = tracing::Span(
+      absl::StrCat(GeneralRequest::translateMethod(_request->requestType()),
+                   " ", name()),
+      tracing::SpanKind::kServer, parent);
+  if (_traceSpan.isRecording()) {
+    _traceSpan.setAttribute("http.target", _request->requestPath());
+    _traceSpan.setAttribute("arangodb.database", _request->databaseName());
+    _traceSpan.setAttribute("arangodb.lane", RequestLaneName(_lane));
+  }
+}
+
+void RestHandler::endTraceSpan() noexcept {
+  if (_traceSpan.isRecording()) {
+    try {
+      if (_response != nullptr) {
+        auto code = static_cast<int64_t>(_response->responseCode());
+        _traceSpan.setAttribute("http.status_code", code);
+        if (code >= 500) {
+          _traceSpan.setError(GeneralResponse::responseString(
+              _response->responseCode()));
+        }
+      }
+    } catch (...) {
+      // attributes are optional
+    }
+  }
+  _traceSpan.end();
+}
+
 void RestHandler::prepareExecute(bool isContinue) {
   _logContextEntry = LogContext::Current::pushValues(_logContextScopeValues);
 }
 
+RestStatus RestHandler::execute() { return waitForFuture(executeAsync()); }
+
+futures::Future<futures::Unit> RestHandler::executeAsync() {
+  // handlers must override either execute() or executeAsync()
+  THROW_ARANGO_EXCEPTION_MESSAGE(
+      TRI_ERROR_NOT_IMPLEMENTED,
+      absl::StrCat("no execute method implemented in ", name()));
+}
+
 void RestHandler::shutdownExecute(bool isFinalized) noexcept {
   LogContext::Current::popEntry(_logContextEntry);
 }
@@ -502,6 +587,12 @@ void RestHandler::executeEngine(bool isContinue) {
   DTRACE_PROBE1(arangod, RestHandlerExecuteEngine, this);
   ExecContext* exec = static_cast<ExecContext*>(_request->requestContext());
   ExecContextScope scope(exec);
+  // attribute CPU samples taken while executing the handler to the request
+  SamplingProfiler::TagScope profilerTags(
+      RequestLaneName(_lane), _request->databaseName(), _request->user());
+  // spans started by the handler, and requests sent by it, become children
+  // of the request's span
+  tracing::ContextScope traceScope(_traceSpan.context());
 
   try {
     RestStatus result = RestStatus::DONE;
@@ -604,6 +695,14 @@ void RestHandler::generateError(rest::ResponseCode code, ErrorCode errorNumber,
 }
 
 void RestHandler::compressResponse() {
+  if (_request->header(StaticStrings::XArangoAcceptEncoding).find(
+          StaticStrings::EncodingArangoLz4) != std::string::npos) {
+    // another server is asking which encodings we can decode for
+    // cluster-internal request bodies
+    _response->setHeaderNC(StaticStrings::XArangoAcceptEncoding,
+                           StaticStrings::EncodingArangoLz4);
+  }
+
   if (!_isAsyncRequest && _response->isCompressionAllowed() &&
       !_response->headers().contains(StaticStrings::ContentEncoding)) {
     // TODO: only enable response compression if response size
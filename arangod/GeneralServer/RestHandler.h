@@ -28,11 +28,13 @@
 #include "Futures/Unit.h"
 #include "GeneralServer/RequestLane.h"
 #include "Logger/LogContext.h"
+#include "Logger/Tracing.h"
 #include "Metrics/GaugeCounterGuard.h"
 #include "Rest/GeneralResponse.h"
 #include "Statistics/RequestStatistics.h"
 
 #include <atomic>
+#include <chrono>
 #include <memory>
 #include <mutex>
 #include <string_view>
@@ -72,6 +74,10 @@ class RestHandler : public std::enable_shared_from_this<RestHandler> {
   uint64_t handlerId() const { return _handlerId; }
   uint64_t messageId() const;
 
+  /// @brief admission control for the handler's request lane. returns false
+  /// if the request should be rejected because its lane is overloaded
+  bool admitToLane() noexcept;
+
   /// @brief called when the handler is queued for execution in the scheduler
   void trackQueueStart() noexcept;
 
@@ -127,7 +133,9 @@ class RestHandler : public std::enable_shared_from_this<RestHandler> {
   RequestLane determineRequestLane();
 
   virtual void prepareExecute(bool isContinue);
-  virtual RestStatus execute() = 0;
+  // runs the handler. the default implementation runs executeAsync() and
+  // suspends the handler until the returned future is fulfilled
+  virtual RestStatus execute();
   virtual RestStatus continueExecute() { return RestStatus::DONE; }
   virtual void shutdownExecute(bool isFinalized) noexcept;
 
@@ -164,6 +172,13 @@ class RestHandler : public std::enable_shared_from_this<RestHandler> {
 
   RestStatus waitForFuture(futures::Future<futures::Unit>&& f);
 
+  // coroutine-based alternative to execute(). handlers overriding this can
+  // co_await futures instead of blocking a scheduler thread on them. note
+  // that the coroutine is resumed on the thread that fulfils the awaited
+  // future, which may be an I/O thread, so only short work should follow
+  // a co_await
+  virtual futures::Future<futures::Unit> executeAsync();
+
   enum class HandlerState : uint8_t {
     PREPARE = 0,
     EXECUTE,
@@ -187,6 +202,8 @@ class RestHandler : public std::enable_shared_from_this<RestHandler> {
   ///        otherwise execute() will be called
   void executeEngine(bool isContinue);
   void compressResponse();
+  void startTraceSpan();
+  void endTraceSpan() noexcept;
 
  protected:
   // This alias allows the RestHandler and derived classes to add values to the
@@ -216,6 +233,12 @@ class RestHandler : public std::enable_shared_from_this<RestHandler> {
   // low priority tasks
   bool _trackedAsOngoingLowPrio;
 
+  // whether or not the handler was admitted by the scheduler's admission
+  // control for its request lane, and must thus be released when done
+  bool _admittedToLane = false;
+  // when the handler was queued. only set if _admittedToLane is true
+  std::chrono::steady_clock::time_point _queueStart;
+
   // whether or not the handler handles a request for the async
   // job api (/_api/job) or the batch API (/_api/batch)
   bool _isAsyncRequest = false;
@@ -225,6 +248,10 @@ class RestHandler : public std::enable_shared_from_this<RestHandler> {
   std::shared_ptr<LogContext::Values> _logContextScopeValues;
   LogContext::EntryPtr _logContextEntry;
 
+  // span covering the handling of the request. only recorded if tracing
+  // is turned on and the request's trace is sampled
+  tracing::Span _traceSpan;
+
  protected:
   metrics::GaugeCounterGuard<std::uint64_t> _currentRequestsSizeTracker;
 
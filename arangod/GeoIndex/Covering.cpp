@@ -28,12 +28,83 @@
 #include <s2/s2region_intersection.h>
 
 #include "Basics/Common.h"
+#include "Containers/FlatHashMap.h"
 #include "Geo/GeoParams.h"
 #include "Geo/Utils.h"
 #include "Logger/Logger.h"
 #include "Logger/LogMacros.h"
 
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+
 namespace arangodb::geo_index {
+namespace {
+
+/// @brief process-wide cache for the scan intervals of filter shapes.
+/// computing the covering of a complex polygon is expensive, and
+/// applications tend to query the same shapes over and over again.
+/// entries are evicted in insertion order once the memory limit is reached.
+class IntervalsCache {
+ public:
+  using Intervals = std::vector<geo::Interval>;
+
+  std::shared_ptr<Intervals const> lookup(std::string const& key) const {
+    std::shared_lock guard(_mutex);
+    if (auto it = _entries.find(key); it != _entries.end()) {
+      return it->second;
+    }
+    return nullptr;
+  }
+
+  void store(std::string key, std::shared_ptr<Intervals const> intervals) {
+    std::size_t const memory = memoryUsage(key, *intervals);
+    if (memory > kMaxMemoryUsage / 16) {
+      // do not let a single huge shape evict everything else
+      return;
+    }
+
+    std::lock_guard guard(_mutex);
+    auto [it, inserted] = _entries.try_emplace(key, std::move(intervals));
+    if (!inserted) {
+      // concurrently stored by another thread
+      return;
+    }
+    _memoryUsage += memory;
+    _insertionOrder.emplace_back(std::move(key));
+
+    while (_memoryUsage > kMaxMemoryUsage) {
+      TRI_ASSERT(!_insertionOrder.empty());
+      auto& oldest = _insertionOrder.front();
+      auto old = _entries.find(oldest);
+      TRI_ASSERT(old != _entries.end());
+      _memoryUsage -= memoryUsage(oldest, *old->second);
+      _entries.erase(old);
+      _insertionOrder.pop_front();
+    }
+  }
+
+ private:
+  static constexpr std::size_t kMaxMemoryUsage = 32 * 1024 * 1024;
+
+  static std::size_t memoryUsage(std::string const& key,
+                                 Intervals const& intervals) noexcept {
+    // the key is stored twice, in the map and in the insertion order
+    return 2 * key.size() + intervals.size() * sizeof(geo::Interval) + 64;
+  }
+
+  mutable std::shared_mutex _mutex;
+  containers::FlatHashMap<std::string, std::shared_ptr<Intervals const>>
+      _entries;
+  std::deque<std::string> _insertionOrder;
+  std::size_t _memoryUsage = 0;
+};
+
+IntervalsCache intervalsCache;
+
+}  // namespace
 
 CoveringUtils::CoveringUtils(geo::QueryParams&& qp) noexcept
     : _params(std::move(qp)),
@@ -61,10 +132,33 @@ std::vector<geo::Interval> CoveringUtils::intervals() {
   TRI_ASSERT(!hasNext());
   TRI_ASSERT(!isDone());
 
+  _allIntervalsCovered = true;
+
+  std::string key;
+  if (!_params.filterShapeKey.empty()) {
+    // the intervals also depend on the covering options and on the kind
+    // of query
+    auto const& cover = _params.cover;
+    key.append(std::to_string(cover.maxNumCoverCells)) += '/';
+    key.append(std::to_string(cover.worstIndexedLevel)) += '/';
+    key.append(std::to_string(cover.bestIndexedLevel)) += '/';
+    key.push_back(_params.pointsOnly ? 'p' : '-');
+    key.push_back(isFilterIntersects() ? 'i' : '-');
+    key.append(_params.filterShapeKey);
+
+    if (auto cached = intervalsCache.lookup(key); cached != nullptr) {
+      return *cached;
+    }
+  }
+
   std::vector<geo::Interval> intervals;
   auto cover = _params.filterShape.covering(_coverer);
   geo::utils::scanIntervals(_params, cover, intervals);
-  _allIntervalsCovered = true;
+  if (!key.empty()) {
+    intervalsCache.store(std::move(key),
+                         std::make_shared<std::vector<geo::Interval> const>(
+                             intervals));
+  }
   return intervals;
 }
 
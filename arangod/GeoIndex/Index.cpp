@@ -257,6 +257,11 @@ void Index::handleNode(aql::AstNode const* node, aql::Variable const* ref,
       if (res.fail()) {
         THROW_ARANGO_EXCEPTION(res);
       }
+      // the same shapes are often used over and over again, e.g. via bind
+      // parameters. remember the input so that their coverings can be cached
+      qp.filterShapeKey.assign(1, legacy ? 'l' : 'g');
+      qp.filterShapeKey.append(bb.slice().startAs<char>(),
+                               bb.slice().byteSize());
 
       aql::Function* func = static_cast<aql::Function*>(node->getData());
       TRI_ASSERT(func != nullptr);
@@ -407,7 +407,7 @@ void BaseOptions::injectLookupInfoInList(std::vector<LookupInfo>& list,
   auto& trx = plan->getAst()->query().trxForOptimization();
   bool res = aql::utils::getBestIndexHandleForFilterCondition(
       trx, *coll, info.indexCondition, _tmpVar, itemsInCollection,
-      aql::IndexHint(), info.idxHandles[0], onlyEdgeIndexes);
+      aql::IndexHint(), info.idxHandles[0], onlyEdgeIndexes, attributeName);
   // Right now we have an enforced edge index which should always fit.
   if (!res) {
     THROW_ARANGO_EXCEPTION_MESSAGE(TRI_ERROR_INTERNAL,
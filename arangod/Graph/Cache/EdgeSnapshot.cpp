@@ -0,0 +1,159 @@
+////////////////////////////////////////////////////////////////////////////////
+/// DISCLAIMER
+///
+/// Copyright 2014-2023 ArangoDB GmbH, Cologne, Germany
+/// Copyright 2004-2014 triAGENS GmbH, Cologne, Germany
+///
+/// Licensed under the Apache License, Version 2.0 (the "License");
+/// you may not use this file except in compliance with the License.
+/// You may obtain a copy of the License at
+///
+///     http://www.apache.org/licenses/LICENSE-2.0
+///
+/// Unless required by applicable law or agreed to in writing, software
+/// distributed under the License is distributed on an "AS IS" BASIS,
+/// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+/// See the License for the specific language governing permissions and
+/// limitations under the License.
+///
+/// Copyright holder is ArangoDB GmbH, Cologne, Germany
+///
+/// @author Jan Steemann
+////////////////////////////////////////////////////////////////////////////////
+
+#include "EdgeSnapshot.h"
+
+#include "Basics/Exceptions.h"
+#include "Basics/debugging.h"
+#include "Indexes/IndexIterator.h"
+#include "Transaction/Helpers.h"
+#include "Transaction/Methods.h"
+#include "VocBase/LogicalCollection.h"
+
+#include <velocypack/Iterator.h>
+
+#include <limits>
+
+using namespace arangodb;
+using namespace arangodb::graph;
+
+EdgeSnapshot::Builder::Builder(TRI_edge_direction_e direction)
+    : _direction(direction) {
+  TRI_ASSERT(_direction == TRI_EDGE_OUT || _direction == TRI_EDGE_IN);
+  _vertexIds.openArray();
+}
+
+void EdgeSnapshot::Builder::add(std::string_view from, std::string_view to,
+                                LocalDocumentId documentId) {
+  if (_direction == TRI_EDGE_IN) {
+    std::swap(from, to);
+  }
+  auto vertex = intern(from);
+  auto other = intern(to);
+  _edges.emplace_back(Edge{vertex, other, documentId});
+}
+
+std::uint32_t EdgeSnapshot::Builder::intern(std::string_view id) {
+  auto it = _vertices.find(id);
+  if (it != _vertices.end()) {
+    return it->second;
+  }
+  if (_vertices.size() >= std::numeric_limits<std::uint32_t>::max()) {
+    THROW_ARANGO_EXCEPTION_MESSAGE(TRI_ERROR_RESOURCE_LIMIT,
+                                   "too many vertices for graph snapshot");
+  }
+  auto vertex = static_cast<std::uint32_t>(_vertices.size());
+  _vertices.emplace(id, vertex);
+  _vertexIds.add(velocypack::Value(id));
+  return vertex;
+}
+
+std::shared_ptr<EdgeSnapshot const> EdgeSnapshot::Builder::finish(
+    RevisionId revision) {
+  _vertexIds.close();
+
+  // counting sort of the edges by their vertex
+  std::size_t numVertices = _vertices.size();
+  std::vector<std::uint64_t> offsets(numVertices + 1, 0);
+  for (auto const& edge : _edges) {
+    ++offsets[edge.vertex + 1];
+  }
+  for (std::size_t i = 0; i < numVertices; ++i) {
+    offsets[i + 1] += offsets[i];
+  }
+
+  std::vector<std::uint32_t> others(_edges.size());
+  std::vector<LocalDocumentId> documentIds(_edges.size());
+  // next free position per vertex
+  std::vector<std::uint64_t> positions(offsets.begin(), offsets.end() - 1);
+  for (auto const& edge : _edges) {
+    auto position = positions[edge.vertex]++;
+    others[position] = edge.other;
+    documentIds[position] = edge.documentId;
+  }
+
+  // the interning data is not needed anymore
+  _vertices = {};
+  _edges = {};
+
+  return std::make_shared<EdgeSnapshot const>(
+      _direction, revision, std::move(_vertexIds), std::move(offsets),
+      std::move(others), std::move(documentIds));
+}
+
+std::shared_ptr<EdgeSnapshot const> EdgeSnapshot::build(
+    transaction::Methods& trx, LogicalCollection& collection,
+    TRI_edge_direction_e direction) {
+  Builder builder(direction);
+  RevisionId revision = collection.revision(&trx);
+
+  auto iterator = collection.getAllIterator(&trx, ReadOwnWrites::no);
+  iterator->allDocuments([&](LocalDocumentId const& token,
+                              velocypack::Slice edge) {
+    auto from = transaction::helpers::extractFromFromDocument(edge);
+    auto to = transaction::helpers::extractToFromDocument(edge);
+    TRI_ASSERT(from.isString() && to.isString());
+    builder.add(from.stringView(), to.stringView(), token);
+    return true;
+  });
+
+  return builder.finish(revision);
+}
+
+EdgeSnapshot::EdgeSnapshot(TRI_edge_direction_e direction,
+                           RevisionId revision, velocypack::Builder vertexIds,
+                           std::vector<std::uint64_t> offsets,
+                           std::vector<std::uint32_t> others,
+                           std::vector<LocalDocumentId> documentIds)
+    : _direction(direction),
+      _revision(revision),
+      _vertexIds(std::move(vertexIds)),
+      _vertexIdsBase(_vertexIds.slice().start()),
+      _offsets(std::move(offsets)),
+      _others(std::move(others)),
+      _documentIds(std::move(documentIds)) {
+  TRI_ASSERT(_others.size() == _documentIds.size());
+
+  velocypack::Slice ids = _vertexIds.slice();
+  TRI_ASSERT(ids.isArray());
+  TRI_ASSERT(_offsets.size() == ids.length() + 1);
+
+  _vertexOffsets.reserve(ids.length());
+  _vertexIndex.reserve(ids.length());
+  for (auto id : velocypack::ArrayIterator(ids)) {
+    TRI_ASSERT(id.isString());
+    auto vertex = static_cast<std::uint32_t>(_vertexOffsets.size());
+    _vertexOffsets.emplace_back(id.start() - _vertexIdsBase);
+    _vertexIndex.emplace(id.stringView(), vertex);
+  }
+}
+
+std::size_t EdgeSnapshot::memoryUsage() const noexcept {
+  return sizeof(EdgeSnapshot) + _vertexIds.size() +
+         _vertexOffsets.capacity() * sizeof(std::uint64_t) +
+         _vertexIndex.capacity() *
+             (sizeof(std::string_view) + sizeof(std::uint32_t)) +
+         _offsets.capacity() * sizeof(std::uint64_t) +
+         _others.capacity() * sizeof(std::uint32_t) +
+         _documentIds.capacity() * sizeof(LocalDocumentId);
+}
@@ -0,0 +1,161 @@
+////////////////////////////////////////////////////////////////////////////////
+/// DISCLAIMER
+///
+/// Copyright 2014-2023 ArangoDB GmbH, Cologne, Germany
+/// Copyright 2004-2014 triAGENS GmbH, Cologne, Germany
+///
+/// Licensed under the Apache License, Version 2.0 (the "License");
+/// you may not use this file except in compliance with the License.
+/// You may obtain a copy of the License at
+///
+///     http://www.apache.org/licenses/LICENSE-2.0
+///
+/// Unless required by applicable law or agreed to in writing, software
+/// distributed under the License is distributed on an "AS IS" BASIS,
+/// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+/// See the License for the specific language governing permissions and
+/// limitations under the License.
+///
+/// Copyright holder is ArangoDB GmbH, Cologne, Germany
+///
+/// @author Jan Steemann
+////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "Containers/FlatHashMap.h"
+#include "VocBase/Identifiers/LocalDocumentId.h"
+#include "VocBase/Identifiers/RevisionId.h"
+#include "VocBase/voc-types.h"
+
+#include <velocypack/Builder.h>
+#include <velocypack/Slice.h>
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace arangodb {
+class LogicalCollection;
+
+namespace transaction {
+class Methods;
+}
+
+namespace graph {
+
+/// @brief immutable in-memory adjacency structure of an edge collection,
+/// for a single direction. the edges are stored in compressed sparse row
+/// (CSR) format: the edges of each vertex are stored contiguously, so that
+/// expanding a vertex is a hash lookup followed by a sequential scan.
+/// all vertex ids are stored exactly once, as velocypack strings, so that
+/// the neighbors of a vertex can be handed out as slices without copying.
+/// a snapshot only contains the edges' _from and _to values and their
+/// document ids. it reflects the state of the collection at revision
+/// `revision()` and is never updated afterwards.
+class EdgeSnapshot {
+ public:
+  /// @brief helper for building a snapshot from a sequence of edges
+  class Builder {
+   public:
+    explicit Builder(TRI_edge_direction_e direction);
+
+    Builder(Builder const&) = delete;
+    Builder& operator=(Builder const&) = delete;
+
+    void add(std::string_view from, std::string_view to,
+             LocalDocumentId documentId);
+
+    std::shared_ptr<EdgeSnapshot const> finish(RevisionId revision);
+
+   private:
+    struct Edge {
+      std::uint32_t vertex;
+      std::uint32_t other;
+      LocalDocumentId documentId;
+    };
+
+    std::uint32_t intern(std::string_view id);
+
+    TRI_edge_direction_e const _direction;
+    // vertex ids, in order of their first appearance
+    velocypack::Builder _vertexIds;
+    containers::FlatHashMap<std::string, std::uint32_t> _vertices;
+    std::vector<Edge> _edges;
+  };
+
+  /// @brief build a snapshot of all edges in the collection, as visible
+  /// to the transaction. the direction determines which edge attribute the
+  /// adjacency lists are keyed by: _from for TRI_EDGE_OUT, _to for
+  /// TRI_EDGE_IN
+  static std::shared_ptr<EdgeSnapshot const> build(
+      transaction::Methods& trx, LogicalCollection& collection,
+      TRI_edge_direction_e direction);
+
+  EdgeSnapshot(TRI_edge_direction_e direction, RevisionId revision,
+               velocypack::Builder vertexIds,
+               std::vector<std::uint64_t> offsets,
+               std::vector<std::uint32_t> others,
+               std::vector<LocalDocumentId> documentIds);
+
+  EdgeSnapshot(EdgeSnapshot const&) = delete;
+  EdgeSnapshot& operator=(EdgeSnapshot const&) = delete;
+
+  TRI_edge_direction_e direction() const noexcept { return _direction; }
+
+  /// @brief the collection revision the snapshot was built from
+  RevisionId revision() const noexcept { return _revision; }
+
+  std::size_t numVertices() const noexcept { return _vertexOffsets.size(); }
+
+  std::size_t numEdges() const noexcept { return _others.size(); }
+
+  /// @brief approximate memory usage of the snapshot
+  std::size_t memoryUsage() const noexcept;
+
+  /// @brief call the callback for all edges of the vertex. the callback
+  /// receives the edge's document id and the id of the vertex on the other
+  /// side of the edge, as a velocypack string that stays valid for the
+  /// lifetime of the snapshot. the iteration stops as soon as the callback
+  /// returns false
+  template<typename F>
+  void forEachEdge(std::string_view vertex, F&& callback) const {
+    auto it = _vertexIndex.find(vertex);
+    if (it == _vertexIndex.end()) {
+      return;
+    }
+    std::uint64_t end = _offsets[it->second + 1];
+    for (std::uint64_t i = _offsets[it->second]; i < end; ++i) {
+      if (!callback(_documentIds[i], vertexId(_others[i]))) {
+        return;
+      }
+    }
+  }
+
+ private:
+  velocypack::Slice vertexId(std::uint32_t vertex) const noexcept {
+    return velocypack::Slice(_vertexIdsBase + _vertexOffsets[vertex]);
+  }
+
+  TRI_edge_direction_e const _direction;
+  RevisionId const _revision;
+  // array of all vertex ids. must not be modified after construction,
+  // because _vertexIndex and _vertexOffsets point into its buffer
+  velocypack::Builder const _vertexIds;
+  std::uint8_t const* _vertexIdsBase;
+  // byte offsets of the vertex ids in _vertexIds, by vertex number
+  std::vector<std::uint64_t> _vertexOffsets;
+  // vertex id => vertex number
+  containers::FlatHashMap<std::string_view, std::uint32_t> _vertexIndex;
+  // the edges of vertex i are stored at positions
+  // [_offsets[i], _offsets[i + 1]) of _others and _documentIds
+  std::vector<std::uint64_t> const _offsets;
+  // vertex numbers of the vertices on the other side of the edges
+  std::vector<std::uint32_t> const _others;
+  std::vector<LocalDocumentId> const _documentIds;
+};
+
+}  // namespace graph
+}  // namespace arangodb
@@ -0,0 +1,132 @@
+////////////////////////////////////////////////////////////////////////////////
+/// DISCLAIMER
+///
+/// Copyright 2014-2023 ArangoDB GmbH, Cologne, Germany
+/// Copyright 2004-2014 triAGENS GmbH, Cologne, Germany
+///
+/// Licensed under the Apache License, Version 2.0 (the "License");
+/// you may not use this file except in compliance with the License.
+/// You may obtain a copy of the License at
+///
+///     http://www.apache.org/licenses/LICENSE-2.0
+///
+/// Unless required by applicable law or agreed to in writing, software
+/// distributed under the License is distributed on an "AS IS" BASIS,
+/// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+/// See the License for the specific language governing permissions and
+/// limitations under the License.
+///
+/// Copyright holder is ArangoDB GmbH, Cologne, Germany
+///
+/// @author Jan Steemann
+////////////////////////////////////////////////////////////////////////////////
+
+#include "GraphSnapshotCache.h"
+
+#include "Basics/ReadLocker.h"
+#include "Basics/WriteLocker.h"
+#include "Graph/Cache/EdgeSnapshot.h"
+#include "VocBase/LogicalCollection.h"
+
+#include <absl/strings/str_cat.h>
+
+using namespace arangodb;
+using namespace arangodb::graph;
+
+namespace {
+GraphSnapshotCache globalInstance;
+}  // namespace
+
+GraphSnapshotCache& GraphSnapshotCache::instance() { return ::globalInstance; }
+
+void GraphSnapshotCache::setMaxMemoryUsage(std::size_t value) noexcept {
+  _maxMemoryUsage.store(value, std::memory_order_relaxed);
+  if (value == 0) {
+    invalidateAll();
+  }
+}
+
+std::size_t GraphSnapshotCache::maxMemoryUsage() const noexcept {
+  return _maxMemoryUsage.load(std::memory_order_relaxed);
+}
+
+std::shared_ptr<EdgeSnapshot const> GraphSnapshotCache::lookupOrBuild(
+    transaction::Methods& trx, LogicalCollection& collection,
+    TRI_edge_direction_e direction) {
+  if (maxMemoryUsage() == 0) {
+    return nullptr;
+  }
+
+  auto key = buildKey(collection.guid(), direction);
+  RevisionId revision = collection.revision(&trx);
+
+  {
+    READ_LOCKER(guard, _lock);
+    auto it = _entries.find(key);
+    if (it != _entries.end() && it->second->revision() == revision) {
+      return it->second;
+    }
+  }
+
+  // build the snapshot without holding the lock. concurrent queries may
+  // build the same snapshot at the same time, in which case the last one
+  // wins
+  auto snapshot = EdgeSnapshot::build(trx, collection, direction);
+  std::size_t memoryUsage = snapshot->memoryUsage();
+
+  WRITE_LOCKER(guard, _lock);
+  std::size_t maxMemoryUsage = this->maxMemoryUsage();
+  if (auto it = _entries.find(key); it != _entries.end()) {
+    // replace the outdated entry
+    _memoryUsage -= it->second->memoryUsage();
+    _entries.erase(it);
+  }
+  // make room for the new entry by dropping other entries
+  while (!_entries.empty() && _memoryUsage + memoryUsage > maxMemoryUsage) {
+    auto it = _entries.begin();
+    _memoryUsage -= it->second->memoryUsage();
+    _entries.erase(it);
+  }
+  if (_memoryUsage + memoryUsage <= maxMemoryUsage) {
+    _entries.emplace(std::move(key), snapshot);
+    _memoryUsage += memoryUsage;
+  }
+  _numEntries.store(_entries.size(), std::memory_order_relaxed);
+  return snapshot;
+}
+
+void GraphSnapshotCache::invalidate(std::vector<std::string> const& guids) {
+  if (_numEntries.load(std::memory_order_relaxed) == 0) {
+    // fast path, called for every committed write
+    return;
+  }
+
+  WRITE_LOCKER(guard, _lock);
+  for (auto const& guid : guids) {
+    for (auto direction : {TRI_EDGE_OUT, TRI_EDGE_IN}) {
+      if (auto it = _entries.find(buildKey(guid, direction));
+          it != _entries.end()) {
+        _memoryUsage -= it->second->memoryUsage();
+        _entries.erase(it);
+      }
+    }
+  }
+  _numEntries.store(_entries.size(), std::memory_order_relaxed);
+}
+
+void GraphSnapshotCache::invalidateAll() {
+  WRITE_LOCKER(guard, _lock);
+  _entries.clear();
+  _memoryUsage = 0;
+  _numEntries.store(0, std::memory_order_relaxed);
+}
+
+GraphSnapshotCache::Stats GraphSnapshotCache::stats() const {
+  READ_LOCKER(guard, _lock);
+  return Stats{_entries.size(), _memoryUsage};
+}
+
+std::string GraphSnapshotCache::buildKey(std::string_view guid,
+                                         TRI_edge_direction_e direction) {
+  return absl::StrCat(guid, "/", direction == TRI_EDGE_OUT ? "out" : "in");
+}
@@ -0,0 +1,103 @@
+////////////////////////////////////////////////////////////////////////////////
+/// DISCLAIMER
+///
+/// Copyright 2014-2023 ArangoDB GmbH, Cologne, Germany
+/// Copyright 2004-2014 triAGENS GmbH, Cologne, Germany
+///
+/// Licensed under the Apache License, Version 2.0 (the "License");
+/// you may not use this file except in compliance with the License.
+/// You may obtain a copy of the License at
+///
+///     http://www.apache.org/licenses/LICENSE-2.0
+///
+/// Unless required by applicable law or agreed to in writing, software
+/// distributed under the License is distributed on an "AS IS" BASIS,
+/// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+/// See the License for the specific language governing permissions and
+/// limitations under the License.
+///
+/// Copyright holder is ArangoDB GmbH, Cologne, Germany
+///
+/// @author Jan Steemann
+////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "Basics/ReadWriteLock.h"
+#include "Containers/FlatHashMap.h"
+#include "VocBase/voc-types.h"
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace arangodb {
+class LogicalCollection;
+
+namespace transaction {
+class Methods;
+}
+
+namespace graph {
+class EdgeSnapshot;
+
+/// @brief process-wide cache of edge collection snapshots, used by
+/// read-only traversals that opted in via the `useGraphSnapshot` option.
+/// snapshots are built on first use and are reused as long as the revision
+/// of the collection, as seen by the reading transaction, is unchanged.
+/// writes to a collection drop its snapshots, so that their memory is freed
+/// early. snapshots are never updated incrementally but rebuilt on demand.
+class GraphSnapshotCache {
+ public:
+  struct Stats {
+    std::size_t numEntries{0};
+    std::size_t memoryUsage{0};
+  };
+
+  GraphSnapshotCache() = default;
+  GraphSnapshotCache(GraphSnapshotCache const&) = delete;
+  GraphSnapshotCache& operator=(GraphSnapshotCache const&) = delete;
+
+  /// @brief return the global instance
+  static GraphSnapshotCache& instance();
+
+  /// @brief maximum total memory usage of all snapshots. a value of 0
+  /// turns off the cache
+  void setMaxMemoryUsage(std::size_t value) noexcept;
+  std::size_t maxMemoryUsage() const noexcept;
+
+  /// @brief return a snapshot of the collection that is consistent with the
+  /// transaction, building it if required. returns a nullptr if the cache is
+  /// turned off. snapshots that are larger than the memory limit are
+  /// returned, but not cached
+  std::shared_ptr<EdgeSnapshot const> lookupOrBuild(
+      transaction::Methods& trx, LogicalCollection& collection,
+      TRI_edge_direction_e direction);
+
+  /// @brief drop the snapshots of the collections with the given guids
+  void invalidate(std::vector<std::string> const& guids);
+
+  /// @brief drop all snapshots
+  void invalidateAll();
+
+  Stats stats() const;
+
+ private:
+  static std::string buildKey(std::string_view guid,
+                              TRI_edge_direction_e direction);
+
+  mutable basics::ReadWriteLock _lock;
+  // key is collection guid + "/" + direction
+  containers::FlatHashMap<std::string, std::shared_ptr<EdgeSnapshot const>>
+      _entries;
+  std::size_t _memoryUsage{0};
+  // number of entries, readable without acquiring the lock
+  std::atomic<std::size_t> _numEntries{0};
+  std::atomic<std::size_t> _maxMemoryUsage{0};
+};
+
+}  // namespace graph
+}  // namespace arangodb
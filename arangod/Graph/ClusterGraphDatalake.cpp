@@ -28,14 +28,24 @@
 #include <velocypack/Builder.h>
 #include <velocypack/Slice.h>
 
+#include <cstring>
 #include <type_traits>
 
+namespace {
+// size of the memory chunks used for copied slices. slices larger than this
+// get a chunk of their own
+constexpr size_t chunkSize = 32 * 1024;
+}  // namespace
+
 namespace arangodb {
 namespace graph {
 
 ClusterGraphDatalake::ClusterGraphDatalake(
     arangodb::ResourceMonitor& resourceMonitor)
-    : _resourceMonitor(resourceMonitor), _totalMemoryUsage(0) {}
+    : _resourceMonitor(resourceMonitor),
+      _totalMemoryUsage(0),
+      _chunkPosition(nullptr),
+      _chunkRemaining(0) {}
 
 ClusterGraphDatalake::~ClusterGraphDatalake() { clear(); }
 
@@ -43,10 +53,16 @@ ClusterGraphDatalake::ClusterGraphDatalake(
     ClusterGraphDatalake&& other) noexcept
     : _resourceMonitor{other._resourceMonitor},
       _totalMemoryUsage{other._totalMemoryUsage},
-      _data{std::move(other._data)} {
+      _data{std::move(other._data)},
+      _chunks{std::move(other._chunks)},
+      _chunkPosition{other._chunkPosition},
+      _chunkRemaining{other._chunkRemaining} {
   // Reset the others data, we have taken it over!
   other._totalMemoryUsage = 0;
   other._data.clear();
+  other._chunks.clear();
+  other._chunkPosition = nullptr;
+  other._chunkRemaining = 0;
 }
 
 arangodb::velocypack::Slice ClusterGraphDatalake::operator[](
@@ -81,5 +97,48 @@ arangodb::velocypack::Slice ClusterGraphDatalake::add(
   return arangodb::velocypack::Slice(_data.back()->data());
 }
 
+arangodb::velocypack::Slice ClusterGraphDatalake::copy(
+    arangodb::velocypack::Slice data) {
+  size_t const size = data.byteSize();
+
+  if (size > _chunkRemaining) {
+    // slices that would take up a large part of a chunk get a chunk of
+    // their own, so that we don't waste the rest of the current chunk
+    bool const ownChunk = size > chunkSize / 4;
+    size_t const memoryUsage = (ownChunk ? size : chunkSize) +
+                               sizeof(typename decltype(_chunks)::value_type);
+
+    arangodb::ResourceUsageScope scope(_resourceMonitor, memoryUsage);
+
+    if (_chunks.empty()) {
+      // save initial reallocations
+      _chunks.reserve(8);
+    }
+    _chunks.emplace_back(
+        std::make_unique<uint8_t[]>(ownChunk ? size : chunkSize));
+
+    // we are now responsible for tracking the memory usage
+    scope.steal();
+    _totalMemoryUsage += memoryUsage;
+
+    uint8_t* target = _chunks.back().get();
+    if (ownChunk) {
+      // the current chunk, if any, remains the one we keep filling
+      memcpy(target, data.start(), size);
+      return arangodb::velocypack::Slice(target);
+    }
+    _chunkPosition = target;
+    _chunkRemaining = chunkSize;
+  }
+
+  TRI_ASSERT(_chunkPosition != nullptr);
+  TRI_ASSERT(size <= _chunkRemaining);
+  uint8_t* target = _chunkPosition;
+  memcpy(target, data.start(), size);
+  _chunkPosition += size;
+  _chunkRemaining -= size;
+  return arangodb::velocypack::Slice(target);
+}
+
 }  // namespace graph
 }  // namespace arangodb
@@ -27,6 +27,7 @@
 
 #include <velocypack/Buffer.h>
 
+#include <cstdint>
 #include <memory>
 #include <vector>
 
@@ -52,19 +53,38 @@ class ClusterGraphDatalake {
 
   void clear() noexcept {
     _data.clear();
+    _chunks.clear();
+    _chunkPosition = nullptr;
+    _chunkRemaining = 0;
     _resourceMonitor.decreaseMemoryUsage(_totalMemoryUsage);
     _totalMemoryUsage = 0;
   }
 
   arangodb::velocypack::Slice operator[](size_t index) const noexcept;
 
+  /// @brief keep the whole buffer alive. slices into the buffer stay valid
+  /// until the datalake is cleared
   arangodb::velocypack::Slice add(
       std::shared_ptr<arangodb::velocypack::Buffer<uint8_t>> data);
 
+  /// @brief copy a single slice into the datalake's own chunked storage and
+  /// return the copy, which stays valid until the datalake is cleared.
+  /// this is preferable to add() if only a small part of a buffer needs to
+  /// be kept, because the rest of the buffer can then be freed right away
+  arangodb::velocypack::Slice copy(arangodb::velocypack::Slice data);
+
  private:
   arangodb::ResourceMonitor& _resourceMonitor;
   size_t _totalMemoryUsage;
   std::vector<std::shared_ptr<arangodb::velocypack::Buffer<uint8_t>>> _data;
+
+  /// @brief memory chunks for copied slices. chunks are never reallocated,
+  /// so that slices pointing into them stay valid
+  std::vector<std::unique_ptr<uint8_t[]>> _chunks;
+  /// @brief first free byte in the current chunk
+  uint8_t* _chunkPosition;
+  /// @brief number of free bytes in the current chunk
+  size_t _chunkRemaining;
 };
 
 }  // namespace graph
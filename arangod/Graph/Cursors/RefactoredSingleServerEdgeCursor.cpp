@@ -31,11 +31,15 @@
 #include "Aql/NonConstExpression.h"
 #include "Aql/Projections.h"
 #include "Basics/StaticStrings.h"
+#include "Graph/Cache/EdgeSnapshot.h"
+#include "Graph/Cache/GraphSnapshotCache.h"
 #include "Graph/EdgeCursor.h"
 #include "Graph/EdgeDocumentToken.h"
 #include "Graph/Steps/SingleServerProviderStep.h"
+#include "Indexes/Index.h"
 #include "Indexes/IndexIterator.h"
 #include "StorageEngine/PhysicalCollection.h"
+#include "StorageEngine/TransactionState.h"
 #include "Transaction/Helpers.h"
 #include "Transaction/Methods.h"
 #include "VocBase/LogicalCollection.h"
@@ -43,6 +47,8 @@
 // TODO: Needed for the IndexAccessor, should be modified
 #include "Graph/Providers/SingleServerProvider.h"
 
+#include <algorithm>
+
 #ifdef USE_ENTERPRISE
 #include "Enterprise/Graph/Steps/SmartGraphStep.h"
 #endif
@@ -98,10 +104,52 @@ uint16_t RefactoredSingleServerEdgeCursor<
   return _coveringIndexPosition;
 }
 
+template<class Step>
+void RefactoredSingleServerEdgeCursor<Step>::LookupInfo::prepareSnapshot(
+    transaction::Methods& trx) {
+  auto const& index = _accessor->indexHandle();
+  if (index->type() != Index::TRI_IDX_TYPE_EDGE_INDEX ||
+      _accessor->getExpression() != nullptr ||
+      _accessor->hasNonConstParts() ||
+      _accessor->getCondition()->numMembers() != 1) {
+    // the snapshot only contains _from and _to, so it can only replace
+    // lookups that do not filter on any other attribute
+    return;
+  }
+  TRI_edge_direction_e dir = _accessor->direction();
+  TRI_ASSERT(dir == TRI_EDGE_IN || dir == TRI_EDGE_OUT);
+  _snapshot = GraphSnapshotCache::instance().lookupOrBuild(
+      trx, index->collection(), dir);
+}
+
+template<class Step>
+EdgeSnapshot const*
+RefactoredSingleServerEdgeCursor<Step>::LookupInfo::snapshot() const noexcept {
+  return _snapshot.get();
+}
+
+template<class Step>
+DataSourceId RefactoredSingleServerEdgeCursor<Step>::LookupInfo::collectionId()
+    const noexcept {
+  return _accessor->indexHandle()->collection().id();
+}
+
+template<class Step>
+VertexType RefactoredSingleServerEdgeCursor<Step>::LookupInfo::snapshotVertex()
+    const noexcept {
+  return _snapshotVertex;
+}
+
 template<class Step>
 void RefactoredSingleServerEdgeCursor<Step>::LookupInfo::rearmVertex(
     VertexType vertex, ResourceMonitor& monitor, transaction::Methods* trx,
     arangodb::aql::Variable const* tmpVar, aql::TraversalStats& stats) {
+  if (_snapshot != nullptr) {
+    // no index lookup required
+    _snapshotVertex = vertex;
+    return;
+  }
+
   auto* node = _accessor->getCondition();
   // We need to rewire the search condition for the new vertex
   TRI_ASSERT(node->numMembers() > 0);
@@ -212,7 +260,7 @@ RefactoredSingleServerEdgeCursor<Step>::RefactoredSingleServerEdgeCursor(
     std::unordered_map<uint64_t, std::vector<IndexAccessor>>&
         depthBasedIndexConditions,
     arangodb::aql::FixedVarExpressionContext& expressionContext,
-    bool requiresFullDocument)
+    bool requiresFullDocument, bool useGraphSnapshot)
     : _tmpVar(tmpVar),
       _monitor(monitor),
       _trx(trx),
@@ -243,6 +291,20 @@ RefactoredSingleServerEdgeCursor<Step>::RefactoredSingleServerEdgeCursor(
     }
     _depthLookupInfo.try_emplace(depth, std::move(tmpLookupVec));
   }
+
+  // graph snapshots can only be used by read-only transactions, which would
+  // otherwise not see their own writes
+  if (useGraphSnapshot && !_requiresFullDocument &&
+      _trx->state()->isReadOnlyTransaction()) {
+    for (auto& info : _lookupInfo) {
+      info.prepareSnapshot(*_trx);
+    }
+    for (auto& [depth, infos] : _depthLookupInfo) {
+      for (auto& info : infos) {
+        info.prepareSnapshot(*_trx);
+      }
+    }
+  }
 }
 
 template<class Step>
@@ -301,10 +363,17 @@ void RefactoredSingleServerEdgeCursor<Step>::rearm(VertexType vertex,
 template<class Step>
 void RefactoredSingleServerEdgeCursor<Step>::readAll(
     SingleServerProvider<Step>& provider, aql::TraversalStats& stats,
-    size_t depth, Callback const& callback) {
+    size_t depth, Callback const& callback, uint64_t limit) {
   TRI_ASSERT(!getLookupInfos(depth).empty());
   transaction::BuilderLeaser tmpBuilder(_trx);
 
+  // number of edges handed to the callback so far
+  uint64_t produced = 0;
+  // fetch at most as many edges from the index as we still need
+  auto batchSize = [&]() -> uint64_t {
+    return std::min<uint64_t>(limit - produced, 1000);
+  };
+
   auto evaluateEdgeExpressionHelper = [&](aql::Expression* expression,
                                           EdgeDocumentToken edgeToken,
                                           VPackSlice edge) {
@@ -317,11 +386,32 @@ void RefactoredSingleServerEdgeCursor<Step>::readAll(
   };
 
   for (auto& lookupInfo : getLookupInfos(depth)) {
+    if (produced >= limit) {
+      break;
+    }
     auto cursorID = lookupInfo.getCursorID();
     // we can only have a cursorID that is within the amount of collections in
     // use.
     TRI_ASSERT(cursorID < _lookupInfo.size());
 
+    if (auto* snapshot = lookupInfo.snapshot(); snapshot != nullptr) {
+      // edges-only expansion from the graph snapshot
+      auto cid = lookupInfo.collectionId();
+      snapshot->forEachEdge(
+          lookupInfo.snapshotVertex().stringView(),
+          [&](LocalDocumentId token, VPackSlice other) {
+            stats.incrScannedIndex(1);
+#ifdef USE_ENTERPRISE
+            if (_trx->skipInaccessible() && CheckInaccessible(_trx, other)) {
+              return true;
+            }
+#endif
+            callback(EdgeDocumentToken(cid, token), other, cursorID);
+            return ++produced < limit;
+          });
+      continue;
+    }
+
     auto& cursor = lookupInfo.cursor();
     LogicalCollection* collection = cursor.collection();
     auto cid = collection->id();
@@ -331,8 +421,8 @@ void RefactoredSingleServerEdgeCursor<Step>::readAll(
     if (!_requiresFullDocument &&
         aql::Projections::isCoveringIndexPosition(coveringPosition)) {
       // use covering index and projections
-      cursor.allCovering([&](LocalDocumentId const& token,
-                             IndexIteratorCoveringData& covering) {
+      auto coveringCallback = [&](LocalDocumentId const& token,
+                                  IndexIteratorCoveringData& covering) {
         stats.incrScannedIndex(1);
 
         TRI_ASSERT(covering.isArray());
@@ -353,47 +443,50 @@ void RefactoredSingleServerEdgeCursor<Step>::readAll(
           return false;
         }
 
+        ++produced;
         callback(std::move(edgeToken), edge, cursorID);
         return true;
-      });
+      };
+      while (produced < limit &&
+             cursor.nextCovering(coveringCallback, batchSize())) {
+        // intentionally empty
+      }
     } else {
       // fetch full documents
-      cursor.all([&](LocalDocumentId const& token) {
-        return collection->getPhysical()
-            ->read(
-                _trx, token,
-                [&](LocalDocumentId const&, VPackSlice edgeDoc) {
-                  stats.incrScannedIndex(1);
+      // the edge documents are read in batches, so that the storage engine
+      // can look them up with a single MultiGet instead of one by one
+      auto documentCallback = [&](LocalDocumentId const& token,
+                                  VPackSlice edgeDoc) {
+        stats.incrScannedIndex(1);
 #ifdef USE_ENTERPRISE
-                  if (_trx->skipInaccessible()) {
-                    // TODO: we only need to check one of these
-                    VPackSlice from =
-                        transaction::helpers::extractFromFromDocument(edgeDoc);
-                    VPackSlice to =
-                        transaction::helpers::extractToFromDocument(edgeDoc);
-                    if (CheckInaccessible(_trx, from) ||
-                        CheckInaccessible(_trx, to)) {
-                      return false;
-                    }
-                  }
+        if (_trx->skipInaccessible()) {
+          // TODO: we only need to check one of these
+          VPackSlice from =
+              transaction::helpers::extractFromFromDocument(edgeDoc);
+          VPackSlice to = transaction::helpers::extractToFromDocument(edgeDoc);
+          if (CheckInaccessible(_trx, from) || CheckInaccessible(_trx, to)) {
+            return false;
+          }
+        }
 #endif
-                  // eval depth-based expression first if available
-                  EdgeDocumentToken edgeToken(cid, token);
-
-                  // evaluate expression if available
-                  if (expression != nullptr &&
-                      !evaluateEdgeExpressionHelper(expression, edgeToken,
-                                                    edgeDoc)) {
-                    stats.incrFiltered();
-                    return false;
-                  }
-
-                  callback(std::move(edgeToken), edgeDoc, cursorID);
-                  return true;
-                },
-                ReadOwnWrites::no)
-            .ok();
-      });
+        // eval depth-based expression first if available
+        EdgeDocumentToken edgeToken(cid, token);
+
+        // evaluate expression if available
+        if (expression != nullptr &&
+            !evaluateEdgeExpressionHelper(expression, edgeToken, edgeDoc)) {
+          stats.incrFiltered();
+          return false;
+        }
+
+        ++produced;
+        callback(std::move(edgeToken), edgeDoc, cursorID);
+        return true;
+      };
+      while (produced < limit &&
+             cursor.nextDocument(documentCallback, batchSize())) {
+        // intentionally empty
+      }
     }
 
     // update cache hits and misses
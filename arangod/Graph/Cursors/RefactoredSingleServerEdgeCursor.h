@@ -30,6 +30,7 @@
 #include "Aql/QueryContext.h"
 #include "Containers/FlatHashMap.h"
 #include "Indexes/IndexIterator.h"
+#include "VocBase/Identifiers/DataSourceId.h"
 
 // Note: only used for NonConstExpressionContainer
 // Could be extracted to it's own file.
@@ -38,6 +39,8 @@
 #include "Graph/Providers/TypeAliases.h"
 #include "Aql/InAndOutRowExpressionContext.h"
 
+#include <limits>
+#include <memory>
 #include <vector>
 
 namespace arangodb {
@@ -59,6 +62,7 @@ class Methods;
 }
 
 namespace graph {
+class EdgeSnapshot;
 struct IndexAccessor;
 
 struct EdgeDocumentToken;
@@ -92,12 +96,27 @@ class RefactoredSingleServerEdgeCursor {
 
     void calculateIndexExpressions(aql::Ast* ast, aql::ExpressionContext& ctx);
 
+    // Read the edges from a graph snapshot instead of the index, if the
+    // lookup is a plain edge index lookup without further conditions
+    void prepareSnapshot(transaction::Methods& trx);
+
+    EdgeSnapshot const* snapshot() const noexcept;
+
+    VertexType snapshotVertex() const noexcept;
+
+    DataSourceId collectionId() const noexcept;
+
    private:
     IndexAccessor* _accessor;
 
     std::unique_ptr<IndexIterator> _cursor;
 
     uint16_t _coveringIndexPosition;
+
+    std::shared_ptr<EdgeSnapshot const> _snapshot;
+
+    // The vertex to look up in _snapshot
+    VertexType _snapshotVertex;
   };
 
   enum Direction { FORWARD, BACKWARD };
@@ -110,7 +129,7 @@ class RefactoredSingleServerEdgeCursor {
       std::unordered_map<uint64_t, std::vector<IndexAccessor>>&
           depthBasedIndexConditions,
       arangodb::aql::FixedVarExpressionContext& expressionContext,
-      bool requiresFullDocument);
+      bool requiresFullDocument, bool useGraphSnapshot = false);
 
   ~RefactoredSingleServerEdgeCursor();
 
@@ -132,9 +151,12 @@ class RefactoredSingleServerEdgeCursor {
   bool _requiresFullDocument;
 
  public:
+  // Read the edges of the vertex the cursor was rearmed for. Stops after
+  // `limit` edges were handed to the callback.
   void readAll(SingleServerProvider<StepType>& provider,
                aql::TraversalStats& stats, size_t depth,
-               Callback const& callback);
+               Callback const& callback,
+               uint64_t limit = std::numeric_limits<uint64_t>::max());
 
   void rearm(VertexType vertex, uint64_t depth, aql::TraversalStats& stats);
 
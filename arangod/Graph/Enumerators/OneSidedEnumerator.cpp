@@ -24,6 +24,7 @@
 
 #include "OneSidedEnumerator.h"
 
+#include "Aql/Timing.h"
 #include "Basics/debugging.h"
 #include "Basics/system-compiler.h"
 #include "Futures/Future.h"
@@ -109,11 +110,25 @@ void OneSidedEnumerator<Configuration>::clearProvider() {
 template<class Configuration>
 auto OneSidedEnumerator<Configuration>::computeNeighbourhoodOfNextVertex()
     -> void {
+  // per-depth statistics are only collected for query profiles
+  bool const collectDepthStats = _options.collectDepthStats();
+  DepthTimes times;
+  double start = collectDepthStats ? aql::currentSteadyClockValue() : 0.0;
+  // adds the time since the previous measurement to the given counter
+  auto measure = [&](double& counter) {
+    if (collectDepthStats) {
+      double now = aql::currentSteadyClockValue();
+      counter += now - start;
+      start = now;
+    }
+  };
+
   // Pull next element from Queue
   // Do 1 step search
   TRI_ASSERT(!_queue.isEmpty());
   if (!_queue.firstIsVertexFetched()) {
     std::vector<Step*> looseEnds = _queue.getStepsWithoutFetchedVertex();
+    measure(times.queue);
     futures::Future<std::vector<Step*>> futureEnds =
         _provider.fetchVertices(looseEnds);
 
@@ -121,12 +136,14 @@ auto OneSidedEnumerator<Configuration>::computeNeighbourhoodOfNextVertex()
     std::vector<Step*> preparedEnds = std::move(futureEnds.get());
     TRI_ASSERT(preparedEnds.size() != 0);
     TRI_ASSERT(_queue.firstIsVertexFetched());
+    measure(times.provider);
   }
 
   TRI_ASSERT(!_queue.isEmpty());
   auto tmp = _queue.pop();
   auto posPrevious = _interior.append(std::move(tmp));
   auto& step = _interior.getStepReference(posPrevious);
+  measure(times.queue);
 
   if constexpr (std::is_same_v<ResultList, std::vector<Step>>) {
     // TODO check if any Step besides SmartGraphStep actually has the
@@ -137,10 +154,15 @@ auto OneSidedEnumerator<Configuration>::computeNeighbourhoodOfNextVertex()
       // Include it in results, to report back that we
       // found this undecided path
       _results.emplace_back(step);
+      if (collectDepthStats) {
+        measure(times.provider);
+        addDepthStats(step.getDepth(), times);
+      }
       return;
     }
   }
   ValidationResult res = _validator.validatePath(step);
+  measure(times.validator);
   LOG_TOPIC("78155", TRACE, Logger::GRAPHS)
       << std::boolalpha
       << "<Traverser> Validated Vertex: " << step.getVertex().getID()
@@ -172,13 +194,54 @@ auto OneSidedEnumerator<Configuration>::computeNeighbourhoodOfNextVertex()
         std::vector<Step*> stepsToFetch{&step};
         _queue.getStepsWithoutFetchedEdges(stepsToFetch);
         TRI_ASSERT(!stepsToFetch.empty());
+        measure(times.queue);
         _provider.fetchEdges(stepsToFetch);
         TRI_ASSERT(step.edgeFetched());
       }
-      _provider.expand(step, posPrevious,
-                       [&](Step n) -> void { _queue.append(n); });
+      if (collectDepthStats) {
+        // the time for appending to the queue is excluded from the time
+        // spent in the provider
+        double queueTime = 0.0;
+        _provider.expand(step, posPrevious, [&](Step n) -> void {
+          double before = aql::currentSteadyClockValue();
+          _queue.append(n);
+          queueTime += aql::currentSteadyClockValue() - before;
+          ++times.accepted;
+        });
+        measure(times.provider);
+        times.provider -= queueTime;
+        times.queue += queueTime;
+      } else {
+        _provider.expand(step, posPrevious,
+                         [&](Step n) -> void { _queue.append(n); });
+      }
     }
   }
+
+  if (collectDepthStats) {
+    measure(times.provider);
+    addDepthStats(step.getDepth(), times);
+  }
+}
+
+template<class Configuration>
+auto OneSidedEnumerator<Configuration>::addDepthStats(size_t depth,
+                                                      DepthTimes const& times)
+    -> void {
+  // everything the provider counted since the last call is attributed to
+  // the depth of the current step. this includes the edges of other steps
+  // that were fetched together with the ones of the current step
+  auto providerStats = _provider.stealStats();
+  auto& depthStats = _stats.depthStats(depth);
+  depthStats.vertices += 1;
+  depthStats.edgesScanned += providerStats.getScannedIndex();
+  depthStats.edgesAccepted += times.accepted;
+  depthStats.cacheHits += providerStats.getCacheHits();
+  depthStats.cacheMisses += providerStats.getCacheMisses();
+  depthStats.providerTime += times.provider;
+  depthStats.validatorTime += times.validator;
+  depthStats.queueTime += times.queue;
+  _stats += providerStats;
 }
 
 /**
@@ -254,7 +317,13 @@ auto OneSidedEnumerator<Configuration>::getNextPath()
       if (!_results.empty()) {
         auto step = std::move(_results.back());
         _results.pop_back();
-        return std::make_unique<ResultPathType>(step, _provider, _interior);
+        // results are produced one at a time, right after their step was
+        // added to the path store. so the last step in the store is the
+        // one of the result
+        TRI_ASSERT(_results.empty());
+        TRI_ASSERT(_interior.size() > 0);
+        return std::make_unique<ResultPathType>(step, _provider, _interior,
+                                                _interior.size() - 1);
       }
     }
   }
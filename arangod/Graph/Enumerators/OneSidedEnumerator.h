@@ -164,6 +164,17 @@ class OneSidedEnumerator final : public TraversalEnumerator {
 
   auto computeNeighbourhoodOfNextVertex() -> void;
 
+  // time spent for one step of the search, only measured if per-depth
+  // statistics are collected
+  struct DepthTimes {
+    double provider = 0.0;
+    double validator = 0.0;
+    double queue = 0.0;
+    // number of new steps added to the queue
+    uint64_t accepted = 0;
+  };
+  auto addDepthStats(size_t depth, DepthTimes const& times) -> void;
+
   // Ensure that we have fetched all vertices in the _results list.
   // Otherwise, we will not be able to generate the resulting path
   auto fetchResults() -> void;
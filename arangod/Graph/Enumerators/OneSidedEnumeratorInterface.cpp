@@ -25,6 +25,7 @@
 #include "OneSidedEnumeratorInterface.h"
 
 #include "Aql/QueryContext.h"
+#include "Basics/Exceptions.h"
 #include "Graph/algorithm-aliases.h"
 #include "Graph/Enumerators/OneSidedEnumerator.h"
 #include "Graph/Providers/ClusterProvider.h"
@@ -38,6 +39,14 @@
 
 using namespace arangodb::graph;
 
+auto PathResultInterface::toSharedPrefixVelocyPack(
+    velocypack::Builder& /*builder*/, std::vector<bool>& /*emittedPaths*/)
+    -> void {
+  THROW_ARANGO_EXCEPTION_MESSAGE(
+      TRI_ERROR_NOT_IMPLEMENTED,
+      "path format 'sharedPrefixes' is not supported for this traversal");
+}
+
 #define INSTANTIATE_ENUMERATOR(BaseEnumeratorType, ProviderType,           \
                                VertexUniqueness, EdgeUniqueness)           \
   return std::make_unique<                                                 \
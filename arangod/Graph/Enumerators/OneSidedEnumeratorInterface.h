@@ -61,6 +61,13 @@ class PathResultInterface {
   virtual auto toVelocyPack(velocypack::Builder& builder) -> void = 0;
   virtual auto lastVertexToVelocyPack(velocypack::Builder& builder) -> void = 0;
   virtual auto lastEdgeToVelocyPack(velocypack::Builder& builder) -> void = 0;
+
+  // Writing the path as an extension of the longest of its prefixes that
+  // was already written. emittedPaths is indexed by path id and keeps track
+  // of the paths written so far for the current start vertex
+  virtual auto toSharedPrefixVelocyPack(velocypack::Builder& builder,
+                                        std::vector<bool>& emittedPaths)
+      -> void;
 };
 
 class TraversalEnumerator {
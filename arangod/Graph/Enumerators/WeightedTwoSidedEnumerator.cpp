@@ -471,6 +471,9 @@ void WeightedTwoSidedEnumerator<QueueType, PathStoreType, ProviderType,
                                                       size_t depth) {
   clear();
 
+  // both sides need to know both ends of the path for the heuristic
+  _left.provider().prepareHeuristic(source, target);
+  _right.provider().prepareHeuristic(source, target);
   _left.reset(source, 0);
   _right.reset(target, 0);
   _resultPath.clear();
@@ -28,8 +28,11 @@ using namespace arangodb;
 using namespace arangodb::graph;
 
 OneSidedEnumeratorOptions::OneSidedEnumeratorOptions(size_t minDepth,
-                                                     size_t maxDepth)
-    : _minDepth(minDepth), _maxDepth(maxDepth) {}
+                                                     size_t maxDepth,
+                                                     bool collectDepthStats)
+    : _minDepth(minDepth),
+      _maxDepth(maxDepth),
+      _collectDepthStats(collectDepthStats) {}
 
 OneSidedEnumeratorOptions::~OneSidedEnumeratorOptions() = default;
 
@@ -39,3 +42,7 @@ size_t OneSidedEnumeratorOptions::getMinDepth() const noexcept {
 size_t OneSidedEnumeratorOptions::getMaxDepth() const noexcept {
   return _maxDepth;
 }
+
+bool OneSidedEnumeratorOptions::collectDepthStats() const noexcept {
+  return _collectDepthStats;
+}
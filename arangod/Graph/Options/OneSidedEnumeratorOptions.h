@@ -30,14 +30,19 @@ namespace arangodb::graph {
 
 struct OneSidedEnumeratorOptions {
  public:
-  OneSidedEnumeratorOptions(size_t minDepth, size_t maxDepth);
+  OneSidedEnumeratorOptions(size_t minDepth, size_t maxDepth,
+                            bool collectDepthStats = false);
   ~OneSidedEnumeratorOptions();
 
   [[nodiscard]] size_t getMinDepth() const noexcept;
   [[nodiscard]] size_t getMaxDepth() const noexcept;
+  // whether statistics and timings are collected per depth. this is only
+  // done for query profiles, as it needs to read the clock for every step
+  [[nodiscard]] bool collectDepthStats() const noexcept;
 
  private:
   size_t const _minDepth;
   size_t const _maxDepth;
+  bool const _collectDepthStats;
 };
 }  // namespace arangodb::graph
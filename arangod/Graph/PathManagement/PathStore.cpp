@@ -51,9 +51,7 @@ namespace graph {
 template<class Step>
 PathStore<Step>::PathStore(arangodb::ResourceMonitor& resourceMonitor)
     : _resourceMonitor(resourceMonitor) {
-  // performance optimization: just reserve a little more as per default
   LOG_TOPIC("47891", TRACE, Logger::GRAPHS) << "<PathStore> Initialization.";
-  _schreier.reserve(32);
 }
 
 template<class Step>
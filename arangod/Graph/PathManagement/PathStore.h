@@ -23,6 +23,7 @@
 
 #pragma once
 
+#include <deque>
 #include <queue>
 #include <unordered_set>
 
@@ -94,8 +95,12 @@ class PathStore {
                         PathResult<ProviderType, Step>& path) const -> void;
 
  private:
-  /// @brief schreier vector to store the visited vertices
-  std::vector<Step> _schreier;
+  /// @brief schreier vector to store the visited vertices.
+  /// this is a deque, so that it grows in small blocks. a vector would
+  /// double its capacity and copy all steps when growing, so that a
+  /// traversal visiting millions of states would temporarily need about
+  /// three times the memory of its steps
+  std::deque<Step> _schreier;
 
   arangodb::ResourceMonitor& _resourceMonitor;
 };
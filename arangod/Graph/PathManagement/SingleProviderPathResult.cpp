@@ -39,6 +39,8 @@
 
 #include <velocypack/Builder.h>
 
+#include <optional>
+
 using namespace arangodb;
 using namespace arangodb::graph;
 
@@ -47,11 +49,13 @@ class SmartGraphStep;
 }  // namespace arangodb::graph::enterprise
 
 template<class ProviderType, class PathStoreType, class Step>
-SingleProviderPathResult<ProviderType, PathStoreType,
-                         Step>::SingleProviderPathResult(Step step,
-                                                         ProviderType& provider,
-                                                         PathStoreType& store)
-    : _step(std::move(step)), _provider(provider), _store(store) {}
+SingleProviderPathResult<ProviderType, PathStoreType, Step>::
+    SingleProviderPathResult(Step step, ProviderType& provider,
+                             PathStoreType& store, size_t position)
+    : _step(std::move(step)),
+      _position(position),
+      _provider(provider),
+      _store(store) {}
 
 template<class ProviderType, class PathStoreType, class Step>
 auto SingleProviderPathResult<ProviderType, PathStoreType, Step>::clear()
@@ -159,6 +163,70 @@ auto SingleProviderPathResult<ProviderType, PathStoreType, Step>::toVelocyPack(
   weightsToVelocyPack(builder);
 }
 
+template<class ProviderType, class PathStoreType, class Step>
+auto SingleProviderPathResult<ProviderType, PathStoreType, Step>::
+    toSharedPrefixVelocyPack(arangodb::velocypack::Builder& builder,
+                             std::vector<bool>& emittedPaths) -> void {
+  TRI_ASSERT(_position < _store.size());
+  // walk up the path until we find a prefix that was already written.
+  // the position of each step's predecessor in the store is the id of the
+  // path ending in the predecessor
+  std::vector<Step const*> suffix;
+  std::optional<size_t> parent;
+  size_t position = _position;
+  _store.visitReversePath(_step, [&](Step const& s) -> bool {
+    if (position != _position && position < emittedPaths.size() &&
+        emittedPaths[position]) {
+      parent = position;
+      return false;
+    }
+    suffix.emplace_back(&s);
+    position = s.getPrevious();
+    return true;
+  });
+  TRI_ASSERT(!suffix.empty());
+
+  if (emittedPaths.size() <= _position) {
+    emittedPaths.resize(_position + 1, false);
+  }
+  emittedPaths[_position] = true;
+
+  VPackObjectBuilder path{&builder};
+  builder.add("id", VPackValue(_position));
+  if (parent.has_value()) {
+    builder.add("parent", VPackValue(*parent));
+  } else {
+    builder.add("parent", VPackSlice::nullSlice());
+  }
+  // the steps were collected from the end of the path
+  {
+    builder.add(VPackValue(StaticStrings::GraphQueryVertices));
+    VPackArrayBuilder vertices{&builder};
+    for (auto it = suffix.rbegin(); it != suffix.rend(); ++it) {
+      _provider.addVertexToBuilder((*it)->getVertex(), builder);
+    }
+  }
+  {
+    // all but the start vertex of the path are reached via an edge, so
+    // there is one edge for every new vertex if the path has a parent
+    builder.add(VPackValue(StaticStrings::GraphQueryEdges));
+    VPackArrayBuilder edges{&builder};
+    for (auto it = suffix.rbegin(); it != suffix.rend(); ++it) {
+      if ((*it)->getEdge().isValid()) {
+        _provider.addEdgeToBuilder((*it)->getEdge(), builder);
+      }
+    }
+  }
+  {
+    builder.add(VPackValue(StaticStrings::GraphQueryWeights));
+    VPackArrayBuilder weights{&builder};
+    for (auto it = suffix.rbegin(); it != suffix.rend(); ++it) {
+      builder.add(VPackValue((*it)->getEdge().isValid() ? (*it)->getWeight()
+                                                        : 0.0));
+    }
+  }
+}
+
 template<class ProviderType, class PathStoreType, class Step>
 auto SingleProviderPathResult<ProviderType, PathStoreType, Step>::
     lastVertexToVelocyPack(arangodb::velocypack::Builder& builder) -> void {
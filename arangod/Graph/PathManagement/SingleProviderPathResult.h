@@ -31,7 +31,9 @@
 #include "Graph/Providers/TypeAliases.h"
 #include "Graph/TraverserOptions.h"
 
+#include <limits>
 #include <numeric>
+#include <vector>
 #include <unordered_map>
 
 namespace arangodb {
@@ -45,8 +47,11 @@ namespace graph {
 template<class ProviderType, class PathStoreType, class Step>
 class SingleProviderPathResult : public PathResultInterface {
  public:
-  SingleProviderPathResult(Step step, ProviderType& provider,
-                           PathStoreType& store);
+  // position is the index of the step in the store, if it is stored there.
+  // it is used as the id of the path by toSharedPrefixVelocyPack
+  SingleProviderPathResult(
+      Step step, ProviderType& provider, PathStoreType& store,
+      size_t position = std::numeric_limits<size_t>::max());
   auto clear() -> void;
 
   // Writing the full path to VelocyPack
@@ -60,6 +65,12 @@ class SingleProviderPathResult : public PathResultInterface {
   auto lastEdgeToVelocyPack(arangodb::velocypack::Builder& builder)
       -> void override;
 
+  // Writing the part of the path after the longest already written prefix
+  // to VelocyPack, together with the id of that prefix
+  auto toSharedPrefixVelocyPack(arangodb::velocypack::Builder& builder,
+                                std::vector<bool>& emittedPaths)
+      -> void override;
+
   auto isEmpty() const -> bool;
   ProviderType* getProvider() { return &_provider; }
   PathStoreType* getStore() { return &_store; }
@@ -80,6 +91,7 @@ class SingleProviderPathResult : public PathResultInterface {
 
  private:
   Step _step;
+  size_t _position;
 
   std::vector<typename Step::Vertex> _vertices;
   std::vector<typename Step::Edge> _edges;
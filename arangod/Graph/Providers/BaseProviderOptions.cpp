@@ -122,7 +122,8 @@ bool SingleServerBaseProviderOptions::hasWeightMethod() const noexcept {
 }
 
 bool SingleServerBaseProviderOptions::produceVertices() const noexcept {
-  return _produceVertices;
+  // the heuristic needs to read the coordinates from the vertex documents
+  return _produceVertices || _heuristic.has_value();
 }
 
 void SingleServerBaseProviderOptions::setWeightEdgeCallback(
@@ -130,6 +131,34 @@ void SingleServerBaseProviderOptions::setWeightEdgeCallback(
   _weightCallback = std::move(callback);
 }
 
+void SingleServerBaseProviderOptions::setHeuristic(
+    GeoDistanceHeuristic heuristic) {
+  _heuristic = std::move(heuristic);
+}
+
+std::optional<GeoDistanceHeuristic> const&
+SingleServerBaseProviderOptions::heuristic() const noexcept {
+  return _heuristic;
+}
+
+void SingleServerBaseProviderOptions::setUseGraphSnapshot(bool value) noexcept {
+  _useGraphSnapshot = value;
+}
+
+bool SingleServerBaseProviderOptions::useGraphSnapshot() const noexcept {
+  return _useGraphSnapshot;
+}
+
+void SingleServerBaseProviderOptions::setDegreeLimits(
+    DegreeLimits limits) noexcept {
+  _degreeLimits = limits;
+}
+
+DegreeLimits const& SingleServerBaseProviderOptions::degreeLimits()
+    const noexcept {
+  return _degreeLimits;
+}
+
 aql::Projections const& SingleServerBaseProviderOptions::getVertexProjections()
     const {
   return _vertexProjections;
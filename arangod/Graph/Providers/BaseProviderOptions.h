@@ -30,6 +30,7 @@
 #include "Basics/MemoryTypes/MemoryTypes.h"
 #include "Cluster/ClusterInfo.h"
 #include "Graph/Cache/RefactoredClusterTraverserCache.h"
+#include "Graph/Providers/GeoDistanceHeuristic.h"
 #include "Transaction/Methods.h"
 #include "Aql/InAndOutRowExpressionContext.h"
 
@@ -80,6 +81,21 @@ struct IndexAccessor {
   TRI_edge_direction_e const _direction;
 };
 
+// Limits for the expansion of vertices with very many edges (supernodes)
+struct DegreeLimits {
+  // Expand at most this many edges per vertex (0 = unlimited)
+  uint64_t maxEdgesPerVertex{0};
+  // Pick the expanded edges uniformly at random instead of taking the first
+  // ones. Only used together with maxEdgesPerVertex
+  bool sampleEdges{false};
+  // Do not expand vertices with more edges than this at all (0 = unlimited)
+  uint64_t maxVertexDegree{0};
+
+  bool isActive() const noexcept {
+    return maxEdgesPerVertex > 0 || maxVertexDegree > 0;
+  }
+};
+
 struct SingleServerBaseProviderOptions {
   using WeightCallback = std::function<double(
       double originalWeight, arangodb::velocypack::Slice edge)>;
@@ -122,6 +138,20 @@ struct SingleServerBaseProviderOptions {
 
   void setWeightEdgeCallback(WeightCallback callback);
 
+  // Set the heuristic that guides a weighted shortest path search
+  void setHeuristic(GeoDistanceHeuristic heuristic);
+
+  std::optional<GeoDistanceHeuristic> const& heuristic() const noexcept;
+
+  // Read edges from in-memory graph snapshots where possible
+  void setUseGraphSnapshot(bool value) noexcept;
+
+  bool useGraphSnapshot() const noexcept;
+
+  void setDegreeLimits(DegreeLimits limits) noexcept;
+
+  DegreeLimits const& degreeLimits() const noexcept;
+
   aql::Projections const& getVertexProjections() const;
 
   aql::Projections const& getEdgeProjections() const;
@@ -148,6 +178,14 @@ struct SingleServerBaseProviderOptions {
   // Optional callback to compute the weight of an edge.
   std::optional<WeightCallback> _weightCallback;
 
+  // Optional A* heuristic, only used together with _weightCallback.
+  std::optional<GeoDistanceHeuristic> _heuristic;
+
+  // Whether edges-only lookups may be served from graph snapshots.
+  bool _useGraphSnapshot{false};
+
+  DegreeLimits _degreeLimits;
+
   // TODO: Currently this will be a copy. As soon as we remove the old
   // non-refactored code, we will do a move instead of a copy operation.
   std::vector<std::pair<aql::Variable const*, aql::RegisterId>>
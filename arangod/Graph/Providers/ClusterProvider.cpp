@@ -36,9 +36,12 @@
 #include "Basics/ScopeGuard.h"
 #include "Basics/StringUtils.h"
 #include "Basics/VelocyPackHelper.h"
+#include "Containers/FlatHashSet.h"
 
 #include "Logger/LogMacros.h"
 
+#include <algorithm>
+#include <map>
 #include <utility>
 #include <vector>
 
@@ -56,6 +59,15 @@ constexpr size_t costPerVertexOrEdgeType =
 std::string const edgeUrl = "/_internal/traverser/edge/";
 std::string const vertexUrl = "/_internal/traverser/vertex/";
 
+// whether the parts of a response that need to be kept should be copied into
+// the datalake, so that the response buffer itself can be freed. this is the
+// case if less than half of the response is needed. otherwise, keeping the
+// buffer alive is cheaper than copying
+bool copyIntoDatalake(size_t bytesToKeep,
+                      arangodb::velocypack::Buffer<uint8_t> const& payload) {
+  return bytesToKeep * 2 < payload.size();
+}
+
 VertexType getEdgeDestination(arangodb::velocypack::Slice edge,
                               VertexType const& origin) {
   if (edge.isString()) {
@@ -206,7 +218,6 @@ void ClusterProvider<StepImpl>::fetchVerticesFromEngines(
     }
 
     auto payload = r.response().stealPayload();
-    bool needToRetainPayload = false;
 
     VPackSlice resSlice(payload->data());
     if (!resSlice.isObject()) {
@@ -219,20 +230,37 @@ void ClusterProvider<StepImpl>::fetchVerticesFromEngines(
           network::resultFromBody(resSlice, TRI_ERROR_INTERNAL));
     }
 
+    size_t bytesToKeep = 0;
+    for (auto pair : VPackObjectIterator(resSlice, /*sequential*/ true)) {
+      if (!_opts.getCache()->isVertexCached(VertexType(pair.key))) {
+        bytesToKeep += pair.key.byteSize() + pair.value.byteSize();
+      }
+    }
+    if (bytesToKeep == 0) {
+      // nothing new in this response
+      continue;
+    }
+    bool const copyVertices = ::copyIntoDatalake(bytesToKeep, *payload);
+
     for (auto pair : VPackObjectIterator(resSlice, /*sequential*/ true)) {
       VertexType vertexKey(pair.key);
 
       if (!_opts.getCache()->isVertexCached(vertexKey)) {
-        // Will be protected by the datalake.
-        // We flag to retain the payload.
-        _opts.getCache()->cacheVertex(vertexKey, pair.value);
+        // Will be protected by the datalake, either because we copy the
+        // vertex into it or because we retain the payload.
+        if (copyVertices) {
+          _opts.getCache()->cacheVertex(
+              _opts.getCache()->persistString(vertexKey),
+              _opts.getCache()->datalake().copy(pair.value));
+        } else {
+          _opts.getCache()->cacheVertex(vertexKey, pair.value);
+        }
         // increase scanned Index for every vertex we cache.
         _stats.incrScannedIndex(1);
-        needToRetainPayload = true;
       }
     }
 
-    if (needToRetainPayload) {
+    if (!copyVertices) {
       // We have stored at least one entry from this payload.
       // Retain it.
       _opts.getCache()->datalake().add(std::move(payload));
@@ -299,10 +327,18 @@ void ClusterProvider<StepImpl>::destroyEngines() {
 }
 
 template<class StepImpl>
-Result ClusterProvider<StepImpl>::fetchEdgesFromEngines(Step* step) {
-  TRI_ASSERT(step != nullptr);
+Result ClusterProvider<StepImpl>::fetchEdgesFromEngines(
+    std::vector<Step*> const& steps) {
+  TRI_ASSERT(!steps.empty());
+  // all steps are expanded with the same depth, because the depth is
+  // relevant for depth-specific index lookups and filters
+  size_t const depth = steps.front()->getDepth();
+  TRI_ASSERT(std::all_of(steps.begin(), steps.end(), [&](Step const* step) {
+    return step->getDepth() == depth;
+  }));
   LOG_TOPIC("fa7dc", TRACE, Logger::GRAPHS)
-      << "<ClusterProvider> Expanding " << step->getVertex().getID();
+      << "<ClusterProvider> Expanding " << steps.size()
+      << " vertices at depth " << depth;
   auto const* engines = _opts.engines();
   transaction::BuilderLeaser leased(trx());
   leased->openObject(true);
@@ -312,7 +348,7 @@ Result ClusterProvider<StepImpl>::fetchEdgesFromEngines(Step* step) {
   // [GraphRefactor] TODO: Differentiate between algorithms -> traversal vs.
   // ksp.
   /* Needed for TRAVERSALS only - Begin */
-  leased->add("depth", VPackValue(step->getDepth()));
+  leased->add("depth", VPackValue(depth));
   if (_opts.expressionContext() != nullptr) {
     leased->add(VPackValue("variables"));
     leased->openArray();
@@ -322,7 +358,16 @@ Result ClusterProvider<StepImpl>::fetchEdgesFromEngines(Step* step) {
   }
   /* Needed for TRAVERSALS only - End */
 
-  leased->add("keys", VPackValue(step->getVertex().getID().toString()));
+  // request the edges of all vertices with a single request per engine.
+  // the engines return the edges of each vertex in a separate array, in
+  // the order of the keys
+  leased->add("groupByVertex", VPackValue(true));
+  leased->add(VPackValue("keys"));
+  leased->openArray();
+  for (auto const* step : steps) {
+    leased->add(VPackValue(step->getVertex().getID().stringView()));
+  }
+  leased->close();
   leased->close();
 
   auto* pool =
@@ -353,7 +398,8 @@ Result ClusterProvider<StepImpl>::fetchEdgesFromEngines(Step* step) {
         reqOpts));
   }
 
-  std::vector<std::pair<EdgeType, VertexType>> connectedEdges;
+  std::vector<std::vector<std::pair<EdgeType, VertexType>>> connectedEdges;
+  connectedEdges.resize(steps.size());
   for (Future<network::Response>& f : futures) {
     network::Response const& r = f.get();
 
@@ -384,51 +430,81 @@ Result ClusterProvider<StepImpl>::fetchEdgesFromEngines(Step* step) {
     _stats.incrCacheMisses(
         Helper::getNumericValue<size_t>(resSlice, "cacheMisses", 0));
 
-    bool allCached = true;
-    VPackSlice edges = resSlice.get("edges");
-    for (VPackSlice e : VPackArrayIterator(edges)) {
-      VPackSlice id = e.get(StaticStrings::IdString);
-      if (!id.isString()) {
-        // invalid id type
-        LOG_TOPIC("eb7cd", ERR, Logger::GRAPHS)
-            << "got invalid edge id type: " << id.typeName();
-        continue;
-      }
-      LOG_TOPIC("f4b3b", TRACE, Logger::GRAPHS)
-          << "<ClusterProvider> Neighbor of " << step->getVertex().getID()
-          << " -> " << id.toJson();
+    VPackSlice edgesPerVertex = resSlice.get("edges");
+    if (!edgesPerVertex.isArray() ||
+        edgesPerVertex.length() != steps.size()) {
+      // Response has invalid format
+      return TRI_ERROR_HTTP_CORRUPTED_JSON;
+    }
 
-      auto [edge, needToCache] = _opts.getCache()->persistEdgeData(e);
-      if (needToCache) {
-        allCached = false;
+    size_t bytesToKeep = 0;
+    for (VPackSlice edges : VPackArrayIterator(edgesPerVertex)) {
+      if (!edges.isArray()) {
+        return TRI_ERROR_HTTP_CORRUPTED_JSON;
+      }
+      for (VPackSlice e : VPackArrayIterator(edges)) {
+        VPackSlice id = e.get(StaticStrings::IdString);
+        if (id.isString() && !_opts.getCache()->isEdgeCached(EdgeType(id))) {
+          bytesToKeep += e.byteSize();
+        }
       }
+    }
+    bool const copyEdges = ::copyIntoDatalake(bytesToKeep, *payload);
 
-      arangodb::velocypack::HashedStringRef edgeIdRef(
-          edge.get(StaticStrings::IdString));
+    bool allCached = true;
+    size_t i = 0;
+    for (VPackSlice edges : VPackArrayIterator(edgesPerVertex)) {
+      auto const& vertex = steps[i]->getVertex().getID();
+      auto& target = connectedEdges[i];
+      ++i;
+      TRI_ASSERT(edges.isArray());
+      for (VPackSlice e : VPackArrayIterator(edges)) {
+        VPackSlice id = e.get(StaticStrings::IdString);
+        if (!id.isString()) {
+          // invalid id type
+          LOG_TOPIC("eb7cd", ERR, Logger::GRAPHS)
+              << "got invalid edge id type: " << id.typeName();
+          continue;
+        }
+        LOG_TOPIC("f4b3b", TRACE, Logger::GRAPHS)
+            << "<ClusterProvider> Neighbor of " << vertex << " -> "
+            << id.toJson();
+
+        if (copyEdges && !_opts.getCache()->isEdgeCached(EdgeType(id))) {
+          // keep only this edge, not the whole response
+          e = _opts.getCache()->datalake().copy(e);
+        }
+        auto [edge, needToCache] = _opts.getCache()->persistEdgeData(e);
+        if (needToCache) {
+          allCached = false;
+        }
 
-      auto edgeToEmplace = std::make_pair(
-          edgeIdRef,
-          VertexType{getEdgeDestination(edge, step->getVertex().getID())});
+        arangodb::velocypack::HashedStringRef edgeIdRef(
+            edge.get(StaticStrings::IdString));
 
-      connectedEdges.emplace_back(edgeToEmplace);
+        target.emplace_back(edgeIdRef,
+                            VertexType{getEdgeDestination(edge, vertex)});
+      }
     }
 
-    if (!allCached) {
+    if (!allCached && !copyEdges) {
       _opts.getCache()->datalake().add(std::move(payload));
     }
   }
   // Note: This disables the ScopeGuard
   futures.clear();
 
-  std::uint64_t memoryPerItem =
-      costPerVertexOrEdgeType +
-      (connectedEdges.size() * (costPerVertexOrEdgeType * 2));
-  ResourceUsageScope guard(*_resourceMonitor, memoryPerItem);
+  for (size_t i = 0; i < steps.size(); ++i) {
+    std::uint64_t memoryPerItem =
+        costPerVertexOrEdgeType +
+        (connectedEdges[i].size() * (costPerVertexOrEdgeType * 2));
+    ResourceUsageScope guard(*_resourceMonitor, memoryPerItem);
 
-  auto [it, inserted] = _vertexConnectedEdges.emplace(
-      step->getVertex().getID(), std::move(connectedEdges));
-  if (inserted) {
-    guard.steal();
+    auto [it, inserted] = _vertexConnectedEdges.emplace(
+        steps[i]->getVertex().getID(), std::move(connectedEdges[i]));
+    if (inserted) {
+      guard.steal();
+    }
   }
 
   return TRI_ERROR_NO_ERROR;
@@ -463,17 +539,29 @@ auto ClusterProvider<StepImpl>::fetchVertices(
 template<class StepImpl>
 auto ClusterProvider<StepImpl>::fetchEdges(
     std::vector<Step*> const& fetchedVertices) -> Result {
+  // vertices whose edges still need to be fetched, grouped by depth. each
+  // group is fetched with a single round trip to every engine
+  std::map<size_t, std::vector<Step*>> toFetch;
+  containers::FlatHashSet<VertexType> requested;
   for (auto const& step : fetchedVertices) {
-    if (!_vertexConnectedEdges.contains(step->getVertex().getID())) {
-      auto res = fetchEdgesFromEngines(step);
-      _stats.incrHttpRequests(_opts.engines()->size());
-
-      if (res.fail()) {
-        THROW_ARANGO_EXCEPTION(res);
-      }
+    auto const& vertex = step->getVertex().getID();
+    if (!_vertexConnectedEdges.contains(vertex) &&
+        requested.emplace(vertex).second) {
+      toFetch[step->getDepth()].emplace_back(step);
     }
     // else: We already fetched this vertex.
+  }
+
+  for (auto const& [depth, steps] : toFetch) {
+    auto res = fetchEdgesFromEngines(steps);
+    _stats.incrHttpRequests(_opts.engines()->size());
+
+    if (res.fail()) {
+      THROW_ARANGO_EXCEPTION(res);
+    }
+  }
 
+  for (auto const& step : fetchedVertices) {
     // mark a looseEnd as fetched as vertex fetch + edges fetch was a success
     step->setEdgesFetched();
   }
@@ -80,6 +80,10 @@ class ClusterProvider {
   ClusterProvider& operator=(ClusterProvider const&) = delete;
 
   void clear();
+  // dummy function, the heuristic is only supported by the
+  // SingleServerProvider
+  auto prepareHeuristic(VertexType const& source, VertexType const& target)
+      -> void {}
 
   auto startVertex(const VertexType& vertex, size_t depth = 0,
                    double weight = 0.0) -> Step;
@@ -115,8 +119,9 @@ class ClusterProvider {
   auto fetchVerticesFromEngines(std::vector<Step*> const& looseEnds,
                                 std::vector<Step*>& result) -> void;
 
-  // fetch edges and store in cache
-  auto fetchEdgesFromEngines(Step* step) -> Result;
+  // fetch the edges of the given vertices and store them in cache. all
+  // steps must have the same depth
+  auto fetchEdgesFromEngines(std::vector<Step*> const& steps) -> Result;
 
   void destroyEngines();
 
@@ -0,0 +1,97 @@
+////////////////////////////////////////////////////////////////////////////////
+/// DISCLAIMER
+///
+/// Copyright 2014-2023 ArangoDB GmbH, Cologne, Germany
+/// Copyright 2004-2014 triAGENS GmbH, Cologne, Germany
+///
+/// Licensed under the Apache License, Version 2.0 (the "License");
+/// you may not use this file except in compliance with the License.
+/// You may obtain a copy of the License at
+///
+///     http://www.apache.org/licenses/LICENSE-2.0
+///
+/// Unless required by applicable law or agreed to in writing, software
+/// distributed under the License is distributed on an "AS IS" BASIS,
+/// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+/// See the License for the specific language governing permissions and
+/// limitations under the License.
+///
+/// Copyright holder is ArangoDB GmbH, Cologne, Germany
+///
+/// @author Jan Steemann
+////////////////////////////////////////////////////////////////////////////////
+
+#include "GeoDistanceHeuristic.h"
+
+#include "Basics/debugging.h"
+#include "Geo/GeoJson.h"
+#include "Geo/GeoParams.h"
+
+#include <velocypack/Slice.h>
+
+using namespace arangodb;
+using namespace arangodb::graph;
+
+GeoDistanceHeuristic::GeoDistanceHeuristic(std::string attribute,
+                                           double factor, bool backward)
+    : _attribute(std::move(attribute)), _factor(factor), _backward(backward) {
+  TRI_ASSERT(!_attribute.empty());
+  TRI_ASSERT(_factor >= 0.0);
+}
+
+std::optional<S2LatLng> GeoDistanceHeuristic::coordinates(
+    velocypack::Slice vertex) const {
+  if (!vertex.isObject()) {
+    return std::nullopt;
+  }
+  velocypack::Slice value = vertex.get(_attribute);
+  if (value.isArray()) {
+    // [longitude, latitude], as in GEO_DISTANCE()
+    if (value.length() < 2 || !value.at(0).isNumber() ||
+        !value.at(1).isNumber()) {
+      return std::nullopt;
+    }
+    auto latLng = S2LatLng::FromDegrees(value.at(1).getNumber<double>(),
+                                        value.at(0).getNumber<double>());
+    if (!latLng.is_valid()) {
+      return std::nullopt;
+    }
+    return latLng;
+  }
+  if (value.isObject() &&
+      geo::json::type(value) == geo::json::Type::POINT) {
+    S2LatLng latLng;
+    if (geo::json::parsePoint(value, latLng).ok()) {
+      return latLng;
+    }
+  }
+  return std::nullopt;
+}
+
+void GeoDistanceHeuristic::setEndpoints(
+    std::optional<S2LatLng> source, std::optional<S2LatLng> target) noexcept {
+  _source = source;
+  _target = target;
+}
+
+bool GeoDistanceHeuristic::isActive() const noexcept {
+  return _source.has_value() && _target.has_value();
+}
+
+double GeoDistanceHeuristic::potential(
+    std::optional<S2LatLng> const& vertex) const noexcept {
+  if (!isActive() || !vertex.has_value()) {
+    return 0.0;
+  }
+  double toTarget = distance(*vertex, *_target);
+  double toSource = distance(*vertex, *_source);
+  double value = (toTarget - toSource) / 2.0;
+  return _backward ? -value : value;
+}
+
+double GeoDistanceHeuristic::distance(S2LatLng const& lhs,
+                                      S2LatLng const& rhs) const noexcept {
+  // same spherical distance as GEO_DISTANCE()
+  return _factor * lhs.GetDistance(rhs).radians() *
+         geo::kEarthRadiusInMeters;
+}
@@ -0,0 +1,88 @@
+////////////////////////////////////////////////////////////////////////////////
+/// DISCLAIMER
+///
+/// Copyright 2014-2023 ArangoDB GmbH, Cologne, Germany
+/// Copyright 2004-2014 triAGENS GmbH, Cologne, Germany
+///
+/// Licensed under the Apache License, Version 2.0 (the "License");
+/// you may not use this file except in compliance with the License.
+/// You may obtain a copy of the License at
+///
+///     http://www.apache.org/licenses/LICENSE-2.0
+///
+/// Unless required by applicable law or agreed to in writing, software
+/// distributed under the License is distributed on an "AS IS" BASIS,
+/// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+/// See the License for the specific language governing permissions and
+/// limitations under the License.
+///
+/// Copyright holder is ArangoDB GmbH, Cologne, Germany
+///
+/// @author Jan Steemann
+////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <s2/s2latlng.h>
+
+#include <optional>
+#include <string>
+
+namespace arangodb {
+namespace velocypack {
+class Slice;
+}
+
+namespace graph {
+
+/// @brief heuristic for weighted shortest path searches on graphs whose
+/// vertices carry geo coordinates, e.g. road networks.
+/// the heuristic estimates the remaining path weight from a vertex to the
+/// target as `factor * distance(vertex, target)`, with the distance in
+/// meters. it is admissible as long as no edge has a smaller weight than
+/// `factor * distance(from, to)`.
+/// the bidirectional search puts the average of the forward and backward
+/// estimate, (h_target(v) - h_source(v)) / 2, on top of the weight of every
+/// step of the forward search, and the negated value on top of every step
+/// of the backward search. this keeps both searches consistent with each
+/// other: the weights of the two steps meeting at a vertex still add up to
+/// the real weight of the path, but vertices in the direction of the other
+/// end of the path are expanded first.
+class GeoDistanceHeuristic {
+ public:
+  GeoDistanceHeuristic(std::string attribute, double factor, bool backward);
+
+  /// @brief extract the coordinates from the heuristic attribute of a
+  /// vertex document. the attribute can either be a [longitude, latitude]
+  /// array or a GeoJSON point. returns std::nullopt if the vertex has no
+  /// valid coordinates
+  std::optional<S2LatLng> coordinates(velocypack::Slice vertex) const;
+
+  /// @brief set the coordinates of the source and target vertices of
+  /// the current search
+  void setEndpoints(std::optional<S2LatLng> source,
+                    std::optional<S2LatLng> target) noexcept;
+
+  /// @brief whether or not the coordinates of both the source and the
+  /// target vertex are known. if not, the potential of every vertex is 0
+  /// and the search degrades to a plain bidirectional Dijkstra
+  bool isActive() const noexcept;
+
+  /// @brief the value to add to the weight of a step that ends in a vertex
+  /// with the given coordinates. vertices without coordinates have a
+  /// potential of 0
+  double potential(std::optional<S2LatLng> const& vertex) const noexcept;
+
+ private:
+  double distance(S2LatLng const& lhs, S2LatLng const& rhs) const noexcept;
+
+  std::string _attribute;
+  // weight per meter of geo distance
+  double _factor;
+  bool _backward;
+  std::optional<S2LatLng> _source;
+  std::optional<S2LatLng> _target;
+};
+
+}  // namespace graph
+}  // namespace arangodb
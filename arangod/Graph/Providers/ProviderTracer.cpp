@@ -114,6 +114,17 @@ auto ProviderTracer<ProviderImpl>::clear() -> void {
   _impl.clear();
 }
 
+template<class ProviderImpl>
+auto ProviderTracer<ProviderImpl>::prepareHeuristic(VertexType source,
+                                                    VertexType target)
+    -> void {
+  double start = TRI_microtime();
+  auto sg = arangodb::scopeGuard([&]() noexcept {
+    _stats["prepareHeuristic"].addTiming(TRI_microtime() - start);
+  });
+  _impl.prepareHeuristic(source, target);
+}
+
 template<class ProviderImpl>
 void ProviderTracer<ProviderImpl>::addVertexToBuilder(
     typename Step::Vertex const& vertex,
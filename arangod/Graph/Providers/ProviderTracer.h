@@ -71,6 +71,7 @@ class ProviderTracer {
               std::function<void(Step)> callback) -> void;
 
   auto clear() -> void;
+  auto prepareHeuristic(VertexType source, VertexType target) -> void;
 
   void addVertexToBuilder(typename Step::Vertex const& vertex,
                           arangodb::velocypack::Builder& builder);
@@ -25,6 +25,7 @@
 #include "SingleServerProvider.h"
 
 #include "Aql/QueryContext.h"
+#include "Basics/ScopeGuard.h"
 #include "Graph/Cursors/RefactoredSingleServerEdgeCursor.h"
 #include "Graph/Steps/SingleServerProviderStep.h"
 #include "Transaction/Helpers.h"
@@ -33,11 +34,13 @@
 #include "Futures/Utilities.h"
 
 #include "Logger/LogMacros.h"
+#include "Random/RandomGenerator.h"
 
 #ifdef USE_ENTERPRISE
 #include "Enterprise/Graph/Steps/SmartGraphStep.h"
 #endif
 
+#include <limits>
 #include <vector>
 
 using namespace arangodb;
@@ -93,7 +96,8 @@ SingleServerProvider<Step>::SingleServerProvider(
       _cache(_trx.get(), &queryContext, resourceMonitor, _stats,
              _opts.collectionToShardMap(), _opts.getVertexProjections(),
              _opts.getEdgeProjections(), _opts.produceVertices()),
-      _stats{} {
+      _stats{},
+      _heuristic(_opts.heuristic()) {
   // TODO CHECK RefactoredTraverserCache (will be discussed in the future, need
   // to do benchmarks if affordable) activateCache(false);
   _cursor = buildCursor(opts.expressionContext());
@@ -129,7 +133,41 @@ auto SingleServerProvider<Step>::startVertex(VertexType vertex, size_t depth,
   // Create default initial step
   // Note: Refactor naming, Strings in our cache here are not allowed to be
   // removed.
-  return Step(_cache.persistString(vertex), depth, weight);
+  auto id = _cache.persistString(vertex);
+  if (_heuristic.has_value() && _heuristic->isActive()) {
+    weight += potential(id);
+  }
+  return Step(id, depth, weight);
+}
+
+template<class Step>
+auto SingleServerProvider<Step>::prepareHeuristic(VertexType source,
+                                                  VertexType target) -> void {
+  if (_heuristic.has_value()) {
+    _heuristic->setEndpoints(lookupCoordinates(source),
+                             lookupCoordinates(target));
+  }
+}
+
+template<class Step>
+auto SingleServerProvider<Step>::lookupCoordinates(VertexType vertex)
+    -> std::optional<S2LatLng> {
+  TRI_ASSERT(_heuristic.has_value());
+  _vertexBuilder.clear();
+  _cache.insertVertexIntoResult(_stats, vertex, _vertexBuilder, false);
+  return _heuristic->coordinates(_vertexBuilder.slice());
+}
+
+template<class Step>
+auto SingleServerProvider<Step>::potential(VertexType vertex) -> double {
+  TRI_ASSERT(_heuristic.has_value());
+  auto it = _potentials.find(vertex);
+  if (it != _potentials.end()) {
+    return it->second;
+  }
+  double value = _heuristic->potential(lookupCoordinates(vertex));
+  _potentials.emplace(vertex, value);
+  return value;
 }
 
 template<class Step>
@@ -153,33 +191,91 @@ auto SingleServerProvider<Step>::expand(
   LOG_TOPIC("c9169", TRACE, Logger::GRAPHS)
       << "<SingleServerProvider> Expanding " << vertex.getID();
   _cursor->rearm(vertex.getID(), step.getDepth(), _stats);
+
+  auto makeNeighbor = [&](EdgeDocumentToken&& eid, VPackSlice edge,
+                          size_t cursorID) -> Step {
+    VertexType id = _cache.persistString(([&]() -> auto {
+      if (edge.isString()) {
+        return VertexType(edge);
+      } else {
+        VertexType other(transaction::helpers::extractFromFromDocument(edge));
+        if (other == vertex.getID()) {  // TODO: Check getId - discuss
+          other = VertexType(transaction::helpers::extractToFromDocument(edge));
+        }
+        return other;
+      }
+    })());
+    // TODO: Adjust log output
+    LOG_TOPIC("c9168", TRACE, Logger::GRAPHS)
+        << "<SingleServerProvider> Neighbor of " << vertex.getID() << " -> "
+        << id;
+
+    double weight = _opts.weightEdge(step.getWeight(), edge);
+    if (_heuristic.has_value() && _heuristic->isActive()) {
+      // replace the potential of the previous vertex with the one of
+      // the neighbor. see GeoDistanceHeuristic for why this is correct
+      weight += potential(id) - potential(vertex.getID());
+    }
+    // TODO [GraphRefactor]: Why is cursorID set, but never used?
+    // Note: There is one implementation that used, it, but there is a high
+    // probability we do not need it anymore after refactoring is complete.
+    return Step{id, std::move(eid), previous, step.getDepth() + 1, weight,
+                cursorID};
+  };
+
+  auto const& limits = _opts.degreeLimits();
+  if (!limits.isActive()) {
+    _cursor->readAll(
+        *this, _stats, step.getDepth(),
+        [&](EdgeDocumentToken&& eid, VPackSlice edge, size_t cursorID) -> void {
+          callback(makeNeighbor(std::move(eid), edge, cursorID));
+        });
+    return;
+  }
+
+  // supernode handling. if there is a maximum degree, read one edge more
+  // than that, so that we know whether the vertex exceeds it. otherwise
+  // stop reading as soon as we have enough edges, unless we have to sample
+  uint64_t readLimit = std::numeric_limits<uint64_t>::max();
+  if (limits.maxVertexDegree > 0) {
+    readLimit = limits.maxVertexDegree + 1;
+  } else if (!limits.sampleEdges) {
+    readLimit = limits.maxEdgesPerVertex;
+  }
+  uint64_t keep = limits.maxEdgesPerVertex > 0
+                      ? limits.maxEdgesPerVertex
+                      : std::numeric_limits<uint64_t>::max();
+  uint64_t seen = 0;
+
+  TRI_ASSERT(_neighbors.empty());
+  auto cleanup = scopeGuard([&]() noexcept { _neighbors.clear(); });
   _cursor->readAll(
       *this, _stats, step.getDepth(),
       [&](EdgeDocumentToken&& eid, VPackSlice edge, size_t cursorID) -> void {
-        VertexType id = _cache.persistString(([&]() -> auto {
-          if (edge.isString()) {
-            return VertexType(edge);
-          } else {
-            VertexType other(
-                transaction::helpers::extractFromFromDocument(edge));
-            if (other == vertex.getID()) {  // TODO: Check getId - discuss
-              other =
-                  VertexType(transaction::helpers::extractToFromDocument(edge));
-            }
-            return other;
+        ++seen;
+        if (_neighbors.size() < keep) {
+          _neighbors.emplace_back(makeNeighbor(std::move(eid), edge, cursorID));
+        } else if (limits.sampleEdges) {
+          // reservoir sampling: the n-th edge replaces one of the kept edges
+          // with a probability of keep / n
+          auto pos = RandomGenerator::interval(seen - 1);
+          if (pos < keep) {
+            _neighbors[pos] = makeNeighbor(std::move(eid), edge, cursorID);
           }
-        })());
-        // TODO: Adjust log output
-        LOG_TOPIC("c9168", TRACE, Logger::GRAPHS)
-            << "<SingleServerProvider> Neighbor of " << vertex.getID() << " -> "
-            << id;
-
-        callback(Step{id, std::move(eid), previous, step.getDepth() + 1,
-                      _opts.weightEdge(step.getWeight(), edge), cursorID});
-        // TODO [GraphRefactor]: Why is cursorID set, but never used?
-        // Note: There is one implementation that used, it, but there is a high
-        // probability we do not need it anymore after refactoring is complete.
-      });
+        }
+      },
+      readLimit);
+
+  if (limits.maxVertexDegree > 0 && seen > limits.maxVertexDegree) {
+    // do not expand supernodes at all
+    LOG_TOPIC("c916a", TRACE, Logger::GRAPHS)
+        << "<SingleServerProvider> Skipping supernode " << vertex.getID();
+    _stats.incrFiltered();
+    return;
+  }
+  for (auto& neighbor : _neighbors) {
+    callback(std::move(neighbor));
+  }
 }
 
 template<class Step>
@@ -194,6 +290,7 @@ template<class Step>
 auto SingleServerProvider<Step>::clear() -> void {
   // Clear the cache - this cache does contain StringRefs
   // We need to make sure that no one holds references to the cache (!)
+  _potentials.clear();
   _cache.clear();
 }
 
@@ -257,7 +354,8 @@ SingleServerProvider<Step>::buildCursor(
   return std::make_unique<RefactoredSingleServerEdgeCursor<Step>>(
       monitor(), trx(), _opts.tmpVar(), _opts.indexInformations().first,
       _opts.indexInformations().second, expressionContext,
-      _opts.hasWeightMethod() /*, requiresFullDocument*/);
+      _opts.hasWeightMethod() /*, requiresFullDocument*/,
+      _opts.useGraphSnapshot());
 }
 
 template<class Step>
@@ -33,6 +33,9 @@
 
 #include "Aql/TraversalStats.h"
 #include "Basics/ResourceUsage.h"
+#include "Containers/FlatHashMap.h"
+
+#include <velocypack/Builder.h>
 
 namespace arangodb {
 struct ResourceMonitor;
@@ -83,6 +86,10 @@ class SingleServerProvider {
   auto expand(Step const& from, size_t previous,
               std::function<void(Step)> const& callback) -> void;  // index
   auto clear() -> void;
+  // look up the coordinates of the source and target vertex for the
+  // heuristic of a weighted shortest path search. must be called before
+  // startVertex()
+  auto prepareHeuristic(VertexType source, VertexType target) -> void;
 
   void insertEdgeIntoResult(EdgeDocumentToken edge,
                             arangodb::velocypack::Builder& builder);
@@ -142,6 +149,11 @@ class SingleServerProvider {
   std::unique_ptr<RefactoredSingleServerEdgeCursor<Step>> buildCursor(
       arangodb::aql::FixedVarExpressionContext& expressionContext);
 
+  auto lookupCoordinates(VertexType vertex) -> std::optional<S2LatLng>;
+  // potential of the given vertex under the heuristic. the vertex must be
+  // persisted in _cache
+  auto potential(VertexType vertex) -> double;
+
  private:
   ResourceMonitor& _monitor;
   // Unique_ptr to have this class movable, and to keep reference of trx()
@@ -155,6 +167,16 @@ class SingleServerProvider {
   RefactoredTraverserCache _cache;
 
   arangodb::aql::TraversalStats _stats;
+
+  // A* heuristic and the potentials of all vertices seen so far. the keys
+  // are owned by _cache, so both are cleared together
+  std::optional<GeoDistanceHeuristic> _heuristic;
+  containers::FlatHashMap<VertexType, double> _potentials;
+  velocypack::Builder _vertexBuilder;
+
+  // neighbors of the vertex currently expanded, only used if the expansion
+  // of vertices is limited. kept as a member to reuse its memory
+  std::vector<Step> _neighbors;
 };
 }  // namespace graph
 }  // namespace arangodb
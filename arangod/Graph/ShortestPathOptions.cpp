@@ -48,6 +48,7 @@ ShortestPathOptions::ShortestPathOptions(aql::QueryContext& query)
       multiThreaded(true) {
   setWeightAttribute("");
   setDefaultWeight(1);
+  setHeuristicFactor(1);
 }
 
 ShortestPathOptions::ShortestPathOptions(aql::QueryContext& query,
@@ -67,6 +68,10 @@ ShortestPathOptions::ShortestPathOptions(aql::QueryContext& query,
       VelocyPackHelper::getStringValue(info, "weightAttribute", ""));
   setDefaultWeight(
       VelocyPackHelper::getNumericValue<double>(info, "defaultWeight", 1));
+  setHeuristicAttribute(
+      VelocyPackHelper::getStringValue(info, "heuristicAttribute", ""));
+  setHeuristicFactor(
+      VelocyPackHelper::getNumericValue<double>(info, "heuristicFactor", 1));
   setProduceVertices(
       VPackHelper::getBooleanValue(info, "produceVertices", true));
 }
@@ -90,6 +95,10 @@ ShortestPathOptions::ShortestPathOptions(aql::QueryContext& query,
       VelocyPackHelper::getStringValue(info, "weightAttribute", ""));
   setDefaultWeight(
       VelocyPackHelper::getNumericValue<double>(info, "defaultWeight", 1));
+  setHeuristicAttribute(
+      VelocyPackHelper::getStringValue(info, "heuristicAttribute", ""));
+  setHeuristicFactor(
+      VelocyPackHelper::getNumericValue<double>(info, "heuristicFactor", 1));
   setProduceVertices(
       VPackHelper::getBooleanValue(info, "produceVertices", true));
 
@@ -115,6 +124,8 @@ void ShortestPathOptions::buildEngineInfo(VPackBuilder& result) const {
   result.add("type", VPackValue("shortestPath"));
   result.add("defaultWeight", VPackValue(getDefaultWeight()));
   result.add("weightAttribute", VPackValue(getWeightAttribute()));
+  result.add("heuristicAttribute", VPackValue(getHeuristicAttribute()));
+  result.add("heuristicFactor", VPackValue(getHeuristicFactor()));
   result.add(VPackValue("reverseLookupInfos"));
   result.openArray();
   for (auto const& it : _reverseLookupInfos) {
@@ -136,6 +147,8 @@ void ShortestPathOptions::toVelocyPack(VPackBuilder& builder) const {
   builder.add("maxDepth", VPackValue(maxDepth));
   builder.add("weightAttribute", VPackValue(getWeightAttribute()));
   builder.add("defaultWeight", VPackValue(getDefaultWeight()));
+  builder.add("heuristicAttribute", VPackValue(getHeuristicAttribute()));
+  builder.add("heuristicFactor", VPackValue(getHeuristicFactor()));
   builder.add("produceVertices", VPackValue(produceVertices()));
   builder.add("type", VPackValue("shortestPath"));
 }
@@ -252,6 +265,36 @@ auto ShortestPathOptions::getWeightAttribute() const& -> std::string {
   return _weightAttribute;
 }
 
+auto ShortestPathOptions::setHeuristicAttribute(std::string attribute)
+    -> void {
+  _heuristicAttribute = std::move(attribute);
+}
+
+auto ShortestPathOptions::getHeuristicAttribute() const&
+    -> std::string const& {
+  return _heuristicAttribute;
+}
+
+auto ShortestPathOptions::setHeuristicFactor(double factor) -> void {
+  if (factor < 0.) {
+    THROW_ARANGO_EXCEPTION_MESSAGE(TRI_ERROR_BAD_PARAMETER,
+                                   "negative heuristic factor not allowed");
+  }
+  _heuristicFactor = factor;
+}
+
+auto ShortestPathOptions::getHeuristicFactor() const -> double {
+  return _heuristicFactor;
+}
+
+auto ShortestPathOptions::heuristic(bool backward) const
+    -> std::optional<GeoDistanceHeuristic> {
+  if (!useWeight() || _heuristicAttribute.empty()) {
+    return std::nullopt;
+  }
+  return GeoDistanceHeuristic(_heuristicAttribute, _heuristicFactor, backward);
+}
+
 ShortestPathOptions::ShortestPathOptions(ShortestPathOptions const& other,
                                          bool const allowAlreadyBuiltCopy)
     : BaseOptions(other, allowAlreadyBuiltCopy),
@@ -263,7 +306,9 @@ ShortestPathOptions::ShortestPathOptions(ShortestPathOptions const& other,
       multiThreaded{other.multiThreaded},
       _reverseLookupInfos{other._reverseLookupInfos},
       _weightAttribute{other._weightAttribute},
-      _defaultWeight{other._defaultWeight} {
+      _defaultWeight{other._defaultWeight},
+      _heuristicAttribute{other._heuristicAttribute},
+      _heuristicFactor{other._heuristicFactor} {
   TRI_ASSERT(other._defaultWeight >= 0.);
 }
 
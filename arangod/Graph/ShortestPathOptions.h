@@ -24,7 +24,9 @@
 #pragma once
 
 #include <memory>
+#include <optional>
 #include "Graph/BaseOptions.h"
+#include "Graph/Providers/GeoDistanceHeuristic.h"
 
 namespace arangodb {
 
@@ -109,11 +111,27 @@ struct ShortestPathOptions : public BaseOptions {
   auto setDefaultWeight(double weight) -> void;
   auto getDefaultWeight() const -> double;
 
+  /// @brief the vertex attribute with the coordinates used for the A*
+  /// heuristic of weighted searches. empty if no heuristic is used
+  auto setHeuristicAttribute(std::string attribute) -> void;
+  auto getHeuristicAttribute() const& -> std::string const&;
+  /// @brief the path weight per meter of geo distance assumed by the
+  /// heuristic. must not be larger than the smallest ratio of edge weight
+  /// and distance between the edge's vertices for the results to be exact
+  auto setHeuristicFactor(double factor) -> void;
+  auto getHeuristicFactor() const -> double;
+
+  /// @brief the heuristic for the forward or backward search, if a weighted
+  /// search with a heuristic attribute is requested
+  auto heuristic(bool backward) const -> std::optional<GeoDistanceHeuristic>;
+
  private:
   /// @brief Lookup info to find all reverse edges.
   std::vector<LookupInfo> _reverseLookupInfos;
   std::string _weightAttribute;
   double _defaultWeight;
+  std::string _heuristicAttribute;
+  double _heuristicFactor;
 };
 
 }  // namespace graph
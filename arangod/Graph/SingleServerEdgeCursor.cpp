@@ -287,31 +287,25 @@ void SingleServerEdgeCursor::readAll(EdgeCursor::Callback const& callback) {
           return true;
         });
       } else {
-        cursor->all([&](LocalDocumentId const& token) {
-          return collection->getPhysical()
-              ->read(
-                  _trx, token,
-                  [&](LocalDocumentId const&, VPackSlice edgeDoc) {
+        // the edge documents are read in batches, so that the storage
+        // engine can look them up with a single MultiGet
+        cursor->allDocuments([&](LocalDocumentId const& token,
+                                 VPackSlice edgeDoc) {
 #ifdef USE_ENTERPRISE
-                    if (_trx->skipInaccessible()) {
-                      // TODO: we only need to check one of these
-                      VPackSlice from =
-                          transaction::helpers::extractFromFromDocument(
-                              edgeDoc);
-                      VPackSlice to =
-                          transaction::helpers::extractToFromDocument(edgeDoc);
-                      if (CheckInaccessible(_trx, from) ||
-                          CheckInaccessible(_trx, to)) {
-                        return false;
-                      }
-                    }
+          if (_trx->skipInaccessible()) {
+            // TODO: we only need to check one of these
+            VPackSlice from =
+                transaction::helpers::extractFromFromDocument(edgeDoc);
+            VPackSlice to =
+                transaction::helpers::extractToFromDocument(edgeDoc);
+            if (CheckInaccessible(_trx, from) || CheckInaccessible(_trx, to)) {
+              return false;
+            }
+          }
 #endif
-                    _opts->cache()->incrDocuments();
-                    callback(EdgeDocumentToken(cid, token), edgeDoc, cursorId);
-                    return true;
-                  },
-                  ReadOwnWrites::no)
-              .ok();
+          _opts->cache()->incrDocuments();
+          callback(EdgeDocumentToken(cid, token), edgeDoc, cursorId);
+          return true;
         });
       }
 
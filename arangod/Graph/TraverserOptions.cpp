@@ -36,6 +36,8 @@
 
 #include <velocypack/Iterator.h>
 
+#include <algorithm>
+
 using namespace arangodb;
 using namespace arangodb::graph;
 using namespace arangodb::traverser;
@@ -124,6 +126,17 @@ TraverserOptions::TraverserOptions(arangodb::aql::QueryContext& query,
     THROW_ARANGO_EXCEPTION_MESSAGE(TRI_ERROR_GRAPH_NEGATIVE_EDGE_WEIGHT,
                                    "negative default weight not allowed");
   }
+  useGraphSnapshot =
+      VPackHelper::getBooleanValue(obj, "useGraphSnapshot", false);
+  maxEdgesPerVertex =
+      VPackHelper::getNumericValue<uint64_t>(obj, "maxEdgesPerVertex", 0);
+  sampleEdges = VPackHelper::getBooleanValue(obj, "sampleEdges", false);
+  maxVertexDegree =
+      VPackHelper::getNumericValue<uint64_t>(obj, "maxVertexDegree", 0);
+  if (VPackHelper::getStringValue(obj, "pathFormat", "") ==
+      "sharedPrefixes") {
+    pathFormat = PathFormat::SHARED_PREFIXES;
+  }
 
   VPackSlice read = obj.get("vertexCollections");
   if (read.isString()) {
@@ -284,6 +297,17 @@ TraverserOptions::TraverserOptions(arangodb::aql::QueryContext& query,
     THROW_ARANGO_EXCEPTION_MESSAGE(TRI_ERROR_GRAPH_NEGATIVE_EDGE_WEIGHT,
                                    "negative default weight not allowed");
   }
+  useGraphSnapshot =
+      VPackHelper::getBooleanValue(info, "useGraphSnapshot", false);
+  maxEdgesPerVertex =
+      VPackHelper::getNumericValue<uint64_t>(info, "maxEdgesPerVertex", 0);
+  sampleEdges = VPackHelper::getBooleanValue(info, "sampleEdges", false);
+  maxVertexDegree =
+      VPackHelper::getNumericValue<uint64_t>(info, "maxVertexDegree", 0);
+  if (VPackHelper::getStringValue(info, "pathFormat", "") ==
+      "sharedPrefixes") {
+    pathFormat = PathFormat::SHARED_PREFIXES;
+  }
 
   read = info.get("vertexCollections");
   if (read.isString()) {
@@ -407,6 +431,11 @@ TraverserOptions::TraverserOptions(TraverserOptions const& other,
       mode(other.mode),
       weightAttribute(other.weightAttribute),
       defaultWeight(other.defaultWeight),
+      useGraphSnapshot(other.useGraphSnapshot),
+      maxEdgesPerVertex(other.maxEdgesPerVertex),
+      sampleEdges(other.sampleEdges),
+      maxVertexDegree(other.maxVertexDegree),
+      pathFormat(other.pathFormat),
       vertexCollections(other.vertexCollections),
       edgeCollections(other.edgeCollections) {
   if (!allowAlreadyBuiltCopy) {
@@ -489,6 +518,14 @@ void TraverserOptions::toVelocyPack(VPackBuilder& builder) const {
 
   builder.add("weightAttribute", VPackValue(weightAttribute));
   builder.add("defaultWeight", VPackValue(defaultWeight));
+  builder.add("useGraphSnapshot", VPackValue(useGraphSnapshot));
+  builder.add("maxEdgesPerVertex", VPackValue(maxEdgesPerVertex));
+  builder.add("sampleEdges", VPackValue(sampleEdges));
+  builder.add("maxVertexDegree", VPackValue(maxVertexDegree));
+  builder.add("pathFormat",
+              VPackValue(pathFormat == PathFormat::SHARED_PREFIXES
+                             ? "sharedPrefixes"
+                             : "full"));
 
   if (!vertexCollections.empty()) {
     VPackArrayBuilder guard(&builder, "vertexCollections");
@@ -590,6 +627,10 @@ void TraverserOptions::buildEngineInfo(VPackBuilder& result) const {
 
   result.add("weightAttribute", VPackValue(weightAttribute));
   result.add("defaultWeight", VPackValue(defaultWeight));
+  result.add("useGraphSnapshot", VPackValue(useGraphSnapshot));
+  result.add("maxEdgesPerVertex", VPackValue(maxEdgesPerVertex));
+  result.add("sampleEdges", VPackValue(sampleEdges));
+  result.add("maxVertexDegree", VPackValue(maxVertexDegree));
 
   if (!_depthLookupInfo.empty()) {
     result.add(VPackValue("depthLookupInfo"));
@@ -776,17 +817,28 @@ double TraverserOptions::estimateCost(size_t& nrItems) const {
   size_t baseCreateItems = 0;
   double baseCost = costForLookupInfoList(_baseLookupInfos, baseCreateItems);
 
+  // vertices with many edges are expanded only partially, if at all
+  auto limitFanOut = [&](size_t items) -> size_t {
+    if (maxEdgesPerVertex > 0) {
+      items = std::min<size_t>(items, maxEdgesPerVertex);
+    }
+    if (maxVertexDegree > 0) {
+      items = std::min<size_t>(items, maxVertexDegree);
+    }
+    return items;
+  };
+
   for (uint64_t depth = 0; depth < maxDepth && depth < 10; ++depth) {
     auto liList = _depthLookupInfo.find(depth);
     if (liList == _depthLookupInfo.end()) {
       // No LookupInfo for this depth use base
       cost += baseCost * count;
-      count *= baseCreateItems;
+      count *= limitFanOut(baseCreateItems);
     } else {
       size_t createItems = 0;
       double depthCost = costForLookupInfoList(liList->second, createItems);
       cost += depthCost * count;
-      count *= createItems;
+      count *= limitFanOut(createItems);
     }
   }
 
@@ -58,6 +58,7 @@ struct TraverserOptions : public graph::BaseOptions {
  public:
   enum UniquenessLevel { NONE, PATH, GLOBAL };
   enum class Order { DFS, BFS, WEIGHTED };
+  enum class PathFormat { FULL, SHARED_PREFIXES };
 
  protected:
   std::unordered_map<uint64_t, std::vector<LookupInfo>> _depthLookupInfo;
@@ -98,6 +99,25 @@ struct TraverserOptions : public graph::BaseOptions {
 
   double defaultWeight;
 
+  /// @brief read edges from in-memory graph snapshots where possible
+  bool useGraphSnapshot = false;
+
+  /// @brief expand at most this many edges per vertex (0 = unlimited)
+  uint64_t maxEdgesPerVertex = 0;
+
+  /// @brief sample the edges expanded per vertex uniformly at random,
+  /// instead of using the first maxEdgesPerVertex ones
+  bool sampleEdges = false;
+
+  /// @brief do not expand vertices with more edges (0 = unlimited)
+  uint64_t maxVertexDegree = 0;
+
+  /// @brief how the path variable is produced. with SHARED_PREFIXES, every
+  /// path only contains what comes after the longest of its prefixes that
+  /// was produced before for the same start vertex, plus the id of that
+  /// prefix
+  PathFormat pathFormat = PathFormat::FULL;
+
   std::vector<std::string> vertexCollections;
 
   std::vector<std::string> edgeCollections;
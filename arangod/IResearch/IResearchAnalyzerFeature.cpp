@@ -54,6 +54,7 @@
 #include "Basics/StringUtils.h"
 #include "Basics/VelocyPackHelper.h"
 #include "Basics/FunctionUtils.h"
+#include "Basics/NumberOfCores.h"
 #include "Basics/application-exit.h"
 #include "Cluster/ClusterFeature.h"
 #include "Cluster/ClusterInfo.h"
@@ -65,6 +66,7 @@
 #include "IResearch/IResearchLink.h"
 #include "IResearch/IResearchKludge.h"
 #include "Logger/LogMacros.h"
+#include "Metrics/Counter.h"
 #include "Network/Methods.h"
 #include "Network/NetworkFeature.h"
 #include "Network/Utils.h"
@@ -97,6 +99,8 @@
 #include <absl/strings/str_cat.h>
 #include <absl/strings/escaping.h>
 
+#include <atomic>
+
 namespace {
 
 using namespace std::literals::string_literals;
@@ -106,6 +110,24 @@ using namespace arangodb::iresearch;
 char constexpr ANALYZER_PREFIX_DELIM = ':';  // name prefix delimiter (2 chars)
 size_t constexpr ANALYZER_PROPERTIES_SIZE_MAX = 1024 * 1024;  // arbitrary value
 size_t constexpr DEFAULT_POOL_SIZE = 8;                       // arbitrary value
+
+std::atomic<metrics::Counter*> analyzerInstancesCreated{nullptr};
+std::atomic<metrics::Counter*> analyzerInstancesReused{nullptr};
+
+// set by AnalyzerPool::Builder::make(...), used to tell constructed and
+// pooled instances apart in AnalyzerPool::get()
+thread_local bool analyzerInstanceConstructed{false};
+
+size_t analyzerPoolSize() noexcept {
+  // keep an idle instance for every thread that may use the analyzer at the
+  // same time. instances returned to a full pool are destroyed, so that with
+  // more concurrent users than pool slots (e.g. indexing threads) every other
+  // get() would construct a new analyzer
+  static size_t const size =
+      std::max(DEFAULT_POOL_SIZE, NumberOfCores::getValue());
+  return size;
+}
+
 static constexpr frozen::map<std::string_view, std::string_view, 13>
     STATIC_ANALYZERS_NAMES{{irs::type<IdentityAnalyzer>::name(),
                             irs::type<IdentityAnalyzer>::name()},
@@ -885,6 +907,7 @@ AnalyzerPool::Builder::ptr AnalyzerPool::Builder::make(std::string_view type,
     return nullptr;
   }
 
+  analyzerInstanceConstructed = true;
   // for API consistency we only support analyzers configurable via jSON
   return irs::analysis::analyzers::get(
       type, irs::type<irs::text_format::vpack>::get(),
@@ -892,7 +915,7 @@ AnalyzerPool::Builder::ptr AnalyzerPool::Builder::make(std::string_view type,
 }
 
 AnalyzerPool::AnalyzerPool(std::string_view const& name)
-    : _cache(DEFAULT_POOL_SIZE), _name(name) {
+    : _cache(analyzerPoolSize()), _name(name) {
 #ifdef ARANGODB_ENABLE_MAINTAINER_MODE
   // validation for name - should  be only normalized or static!
   auto splitted = IResearchAnalyzerFeature::splitAnalyzerName(_name);
@@ -1055,9 +1078,23 @@ void AnalyzerPool::setKey(std::string_view key) {
   _key = std::string_view(_config.c_str() + keyOffset, key.size());
 }
 
+void AnalyzerPool::setMetrics(metrics::Counter* created,
+                              metrics::Counter* reused) noexcept {
+  analyzerInstancesCreated.store(created, std::memory_order_relaxed);
+  analyzerInstancesReused.store(reused, std::memory_order_relaxed);
+}
+
 AnalyzerPool::CacheType::ptr AnalyzerPool::get() const noexcept {
   try {
-    return _cache.emplace(_type, _properties);
+    analyzerInstanceConstructed = false;
+    auto instance = _cache.emplace(_type, _properties);
+    auto* counter = (analyzerInstanceConstructed ? analyzerInstancesCreated
+                                                 : analyzerInstancesReused)
+                        .load(std::memory_order_relaxed);
+    if (counter != nullptr && instance) {
+      counter->count();
+    }
+    return instance;
   } catch (basics::Exception const& e) {
     LOG_TOPIC("c9256", WARN, iresearch::TOPIC)
         << "caught exception while instantiating an arangosearch analizer type "
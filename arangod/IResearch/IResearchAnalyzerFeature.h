@@ -48,6 +48,7 @@
 #include "Containers/FlatHashMap.h"
 #include "IResearch/IResearchAnalyzerValueTypeAttribute.h"
 #include "IResearch/IResearchCommon.h"
+#include "Metrics/Fwd.h"
 #include "RestServer/arangod.h"
 #include "Scheduler/Scheduler.h"
 
@@ -201,6 +202,12 @@ class AnalyzerPool : private irs::util::noncopyable {
   // nullptr == error creating analyzer
   CacheType::ptr get() const noexcept;
 
+  // counters for analyzer instances constructed by get() because no idle
+  // instance was left in the pool, and for instances taken from the pool.
+  // shared by all pools, nullptr == not tracked
+  static void setMetrics(metrics::Counter* created,
+                         metrics::Counter* reused) noexcept;
+
   Features features() const noexcept { return _features; }
   irs::features_t fieldFeatures() const noexcept {
     return {_fieldFeatures.data(), _fieldFeatures.size()};
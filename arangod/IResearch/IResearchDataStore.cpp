@@ -323,7 +323,7 @@ std::string toString(irs::DirectoryReader const& reader, bool isNew, IndexId id,
 }
 
 template<bool WasCreated>
-auto makeAfterCommitCallback(void* key) {
+auto makeAfterCommitCallback(IResearchDataStore* key) {
   return [key](TransactionState& state) {
     auto prev = state.cookie(key, nullptr);  // extract existing cookie
     if (!prev) {
@@ -337,6 +337,7 @@ auto makeAfterCommitCallback(void* key) {
     } else {
       ctx._ctx.Commit();
     }
+    key->resumeCommits();
   };
 }
 
@@ -386,6 +387,13 @@ struct MaintenanceState {
   std::atomic_size_t pendingConsolidations{0};
   std::atomic_size_t noopConsolidationCount{0};
   std::atomic_size_t noopCommitCount{0};
+  // set while commits run with an increased interval, because the index
+  // has not received any changes for a while
+  std::atomic_bool commitBackoff{false};
+  // regular commit interval, used to resume commits after a write
+  std::atomic_uint64_t commitIntervalMsec{0};
+  // duration of the last consolidation
+  std::atomic_uint64_t consolidationTimeMsec{0};
 };
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -408,14 +416,20 @@ struct CommitTask : Task<CommitTask> {
   std::chrono::milliseconds commitIntervalMsec{};
   std::chrono::milliseconds consolidationIntervalMsec{};
   size_t cleanupIntervalStep{};
+  // whether the task was scheduled with the idle commit interval
+  bool backedOff{false};
 };
 
 void CommitTask::finalize(IResearchDataStore& link,
                           IResearchDataStore::CommitResult code) {
   constexpr size_t kMaxNonEmptyCommits = 10;
   constexpr size_t kMaxPendingConsolidations = 3;
+  constexpr size_t kNoopCommitsBeforeBackoff = 10;
+  constexpr size_t kIdleCommitIntervalFactor = 4;
 
   if (code != IResearchDataStore::CommitResult::NO_CHANGES) {
+    backedOff = false;
+    state->commitBackoff.store(false, std::memory_order_release);
     state->pendingCommits.fetch_add(1, std::memory_order_release);
     schedule(commitIntervalMsec);
 
@@ -433,13 +447,31 @@ void CommitTask::finalize(IResearchDataStore& link,
     }
   } else {
     state->nonEmptyCommits.store(0, std::memory_order_release);
-    state->noopCommitCount.fetch_add(1, std::memory_order_release);
+    auto const noopCommits =
+        state->noopCommitCount.fetch_add(1, std::memory_order_acq_rel) + 1;
+    // the index is idle, so commit less often. the next transaction writing
+    // to the index resumes the regular interval, see 'resumeCommits'
+    bool const backOff = noopCommits >= kNoopCommitsBeforeBackoff;
 
     for (auto count = state->pendingCommits.load(std::memory_order_acquire);
          count < 1;) {
       if (state->pendingCommits.compare_exchange_weak(
               count, 1, std::memory_order_acq_rel)) {
-        schedule(commitIntervalMsec);
+        if (backOff && !backedOff) {
+          LOG_TOPIC("c3b7e", TRACE, TOPIC)
+              << "no changes in ArangoSearch index '" << id << "' for "
+              << noopCommits << " commits, increasing commit interval to "
+              << (commitIntervalMsec * kIdleCommitIntervalFactor).count()
+              << "ms";
+          async->trackCommitBackoff();
+        }
+        backedOff = backOff;
+        if (backOff) {
+          state->commitBackoff.store(true, std::memory_order_release);
+          schedule(commitIntervalMsec * kIdleCommitIntervalFactor);
+        } else {
+          schedule(commitIntervalMsec);
+        }
         break;
       }
     }
@@ -484,6 +516,8 @@ void CommitTask::operator()() {
         std::chrono::milliseconds(meta._consolidationIntervalMsec);
     cleanupIntervalStep = meta._cleanupIntervalStep;
   }
+  state->commitIntervalMsec.store(commitIntervalMsec.count(),
+                                  std::memory_order_relaxed);
 
   if (std::chrono::milliseconds::zero() == commitIntervalMsec) {
     reschedule.cancel();
@@ -492,6 +526,13 @@ void CommitTask::operator()() {
     return;
   }
 
+  if (backedOff && !state->commitBackoff.load(std::memory_order_acquire)) {
+    // a write has resumed the regular commit schedule in the meantime,
+    // which runs as a separate task
+    reschedule.cancel();
+    return;
+  }
+
   TRI_IF_FAILURE("IResearchCommitTask::commitUnsafe") {
     THROW_ARANGO_EXCEPTION(TRI_ERROR_DEBUG);
   }
@@ -547,8 +588,22 @@ struct ConsolidationTask : Task<ConsolidationTask> {
   irs::MergeWriter::FlushProgress progress;
   IResearchDataStoreMeta::ConsolidationPolicy consolidationPolicy;
   std::chrono::milliseconds consolidationIntervalMsec{};
+
+  // consolidations which take longer than the configured interval delay the
+  // next consolidation accordingly, so that they do not pile up under load
+  std::chrono::milliseconds delay() const noexcept;
 };
 
+std::chrono::milliseconds ConsolidationTask::delay() const noexcept {
+  auto const lastTime = std::chrono::milliseconds(
+      state->consolidationTimeMsec.load(std::memory_order_relaxed));
+  if (lastTime <= consolidationIntervalMsec) {
+    return consolidationIntervalMsec;
+  }
+  async->trackConsolidationBackoff();
+  return lastTime;
+}
+
 void ConsolidationTask::operator()() {
   char const runId = 0;
   state->pendingConsolidations.fetch_sub(1, std::memory_order_release);
@@ -567,7 +622,7 @@ void ConsolidationTask::operator()() {
            count < 1;) {
         if (state->pendingConsolidations.compare_exchange_weak(
                 count, count + 1, std::memory_order_acq_rel)) {
-          schedule(consolidationIntervalMsec);
+          schedule(delay());
           break;
         }
       }
@@ -609,7 +664,7 @@ void ConsolidationTask::operator()() {
       state->noopConsolidationCount.load(std::memory_order_acquire) <
           kMaxNoopConsolidations) {
     state->pendingConsolidations.fetch_add(1, std::memory_order_release);
-    schedule(consolidationIntervalMsec);
+    schedule(delay());
   }
   TRI_IF_FAILURE("IResearchConsolidationTask::consolidateUnsafe") {
     THROW_ARANGO_EXCEPTION(TRI_ERROR_DEBUG);
@@ -619,6 +674,7 @@ void ConsolidationTask::operator()() {
   bool emptyConsolidation = false;
   auto const [res, timeMs] = linkLock->consolidateUnsafe(
       consolidationPolicy, progress, emptyConsolidation);
+  state->consolidationTimeMsec.store(timeMs, std::memory_order_relaxed);
 
   if (res.ok()) {
     if (emptyConsolidation) {
@@ -722,6 +778,24 @@ void IResearchDataStore::scheduleCommit(std::chrono::milliseconds delay) {
   task.schedule(delay);
 }
 
+void IResearchDataStore::resumeCommits() noexcept {
+  auto& state = *_maintenanceState;
+  if (!state.commitBackoff.load(std::memory_order_relaxed) ||
+      !state.commitBackoff.exchange(false, std::memory_order_acq_rel)) {
+    return;
+  }
+  try {
+    scheduleCommit(std::chrono::milliseconds(
+        state.commitIntervalMsec.load(std::memory_order_relaxed)));
+  } catch (std::exception const& ex) {
+    // the backed off commit task will pick up the changes later
+    state.commitBackoff.store(true, std::memory_order_release);
+    LOG_TOPIC("5f0d8", WARN, TOPIC)
+        << "failed to resume commits for ArangoSearch index '" << index().id()
+        << "': " << ex.what();
+  }
+}
+
 void IResearchDataStore::scheduleConsolidation(
     std::chrono::milliseconds delay) {
   ConsolidationTask task;
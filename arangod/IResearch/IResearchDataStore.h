@@ -291,6 +291,13 @@ class IResearchDataStore {
   //////////////////////////////////////////////////////////////////////////////
   bool failQueriesOnOutOfSync() const noexcept;
 
+  //////////////////////////////////////////////////////////////////////////////
+  /// @brief go back to the regular commit interval if commits have been
+  /// backed off because the data store was idle. called after every
+  /// transaction that wrote to the data store
+  //////////////////////////////////////////////////////////////////////////////
+  void resumeCommits() noexcept;
+
  protected:
   friend struct CommitTask;
   friend struct ConsolidationTask;
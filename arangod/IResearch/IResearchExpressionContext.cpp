@@ -81,6 +81,14 @@ transaction::Methods& ViewExpressionContextBase::trx() const { return *_trx; }
 
 bool ViewExpressionContextBase::killed() const { return _query->killed(); }
 
+velocypack::Slice ViewExpressionContextBase::getBindParameterValue(
+    std::string_view name) const {
+  if (_query == nullptr) {
+    return velocypack::Slice::noneSlice();
+  }
+  return _query->bindParameterValue(name);
+}
+
 void ViewExpressionContext::setVariable(arangodb::aql::Variable const* variable,
                                         arangodb::velocypack::Slice value) {
   _variables.emplace(variable, value);
@@ -83,6 +83,9 @@ struct ViewExpressionContextBase : public arangodb::aql::ExpressionContext {
   transaction::Methods& trx() const override final;
   bool killed() const override final;
 
+  velocypack::Slice getBindParameterValue(
+      std::string_view name) const override final;
+
   aql::AstNode const* _expr{};  // for troubleshooting
 
  protected:
@@ -59,10 +59,12 @@
 #include "ClusterEngine/ClusterEngine.h"
 #include "CrashHandler/CrashHandler.h"
 #include "Containers/SmallVector.h"
+#include "Metrics/CounterBuilder.h"
 #include "Metrics/GaugeBuilder.h"
 #include "Metrics/MetricsFeature.h"
 #include "IResearch/Containers.h"
 #include "IResearch/IResearchCommon.h"
+#include "IResearch/IResearchAnalyzerFeature.h"
 #include "IResearch/IResearchFilterFactory.h"
 #include "IResearch/IResearchLinkCoordinator.h"
 #include "IResearch/IResearchLinkHelper.h"
@@ -101,6 +103,17 @@ namespace {
 
 DECLARE_GAUGE(arangodb_search_num_out_of_sync_links, uint64_t,
               "Number of arangosearch links/indexes currently out of sync");
+DECLARE_COUNTER(arangodb_search_commit_backoffs_total,
+                "Number of times arangosearch commits were backed off for "
+                "idle links/indexes");
+DECLARE_COUNTER(arangodb_search_consolidation_backoffs_total,
+                "Number of times arangosearch consolidations were delayed "
+                "because they took longer than the consolidation interval");
+DECLARE_COUNTER(arangodb_search_analyzer_instances_created_total,
+                "Number of arangosearch analyzer instances constructed "
+                "because no pooled instance was available");
+DECLARE_COUNTER(arangodb_search_analyzer_instances_reused_total,
+                "Number of arangosearch analyzer instances taken from a pool");
 
 #ifdef USE_ENTERPRISE
 
@@ -878,6 +891,16 @@ IResearchFeature::IResearchFeature(Server& server)
       _failQueriesOnOutOfSync(false),
       _outOfSyncLinks(server.getFeature<metrics::MetricsFeature>().add(
           arangodb_search_num_out_of_sync_links{})),
+      _commitBackoffs(server.getFeature<metrics::MetricsFeature>().add(
+          arangodb_search_commit_backoffs_total{})),
+      _consolidationBackoffs(server.getFeature<metrics::MetricsFeature>().add(
+          arangodb_search_consolidation_backoffs_total{})),
+      _analyzerInstancesCreated(
+          server.getFeature<metrics::MetricsFeature>().add(
+              arangodb_search_analyzer_instances_created_total{})),
+      _analyzerInstancesReused(
+          server.getFeature<metrics::MetricsFeature>().add(
+              arangodb_search_analyzer_instances_reused_total{})),
 #ifdef USE_ENTERPRISE
       _columnsCacheMemoryUsed(server.getFeature<metrics::MetricsFeature>().add(
           arangodb_search_columns_cache_size{})),
@@ -1219,11 +1242,14 @@ void IResearchFeature::start() {
     _startState = nullptr;
   }
 
+  AnalyzerPool::setMetrics(&_analyzerInstancesCreated,
+                           &_analyzerInstancesReused);
   _running.store(true);
 }
 
 void IResearchFeature::stop() {
   TRI_ASSERT(isEnabled());
+  AnalyzerPool::setMetrics(nullptr, nullptr);
   _async->stop();
   _running.store(false);
 }
@@ -1315,6 +1341,14 @@ std::pair<size_t, size_t> IResearchFeature::limits(ThreadGroup id) const {
 
 void IResearchFeature::trackOutOfSyncLink() noexcept { ++_outOfSyncLinks; }
 
+void IResearchFeature::trackCommitBackoff() noexcept {
+  _commitBackoffs.count();
+}
+
+void IResearchFeature::trackConsolidationBackoff() noexcept {
+  _consolidationBackoffs.count();
+}
+
 void IResearchFeature::untrackOutOfSyncLink() noexcept {
   uint64_t previous = _outOfSyncLinks.fetch_sub(1);
   TRI_ASSERT(previous > 0);
@@ -133,6 +133,10 @@ class IResearchFeature final : public ArangodFeature {
   void trackOutOfSyncLink() noexcept;
   void untrackOutOfSyncLink() noexcept;
 
+  // count adaptive scheduling decisions of the maintenance tasks
+  void trackCommitBackoff() noexcept;
+  void trackConsolidationBackoff() noexcept;
+
   bool failQueriesOnOutOfSync() const noexcept;
 
 #ifdef USE_ENTERPRISE
@@ -177,6 +181,15 @@ class IResearchFeature final : public ArangodFeature {
   // number of links/indexes currently out of sync
   metrics::Gauge<uint64_t>& _outOfSyncLinks;
 
+  // number of times commits were backed off because an index was idle
+  metrics::Counter& _commitBackoffs;
+  // number of times consolidations were delayed because they took longer
+  // than the consolidation interval
+  metrics::Counter& _consolidationBackoffs;
+  // number of analyzer instances constructed/taken from the analyzer pools
+  metrics::Counter& _analyzerInstancesCreated;
+  metrics::Counter& _analyzerInstancesReused;
+
 #ifdef USE_ENTERPRISE
   irs::IResourceManager& _columnsCacheMemoryUsed;
   bool _columnsCacheOnlyLeader{false};
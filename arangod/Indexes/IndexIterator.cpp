@@ -28,6 +28,8 @@
 
 #include <velocypack/Slice.h>
 
+#include <tuple>
+
 using namespace arangodb;
 
 IndexIterator::IndexIterator(LogicalCollection* collection,
@@ -77,6 +79,18 @@ void IndexIterator::skipAll(uint64_t& skipped) {
   }
 }
 
+void IndexIterator::skipAllParallel(uint64_t& skipped, size_t parallelism) {
+  if (_hasMore && parallelism > 1) {
+    uint64_t skippedLocal = 0;
+    if (skipAllParallelImpl(skippedLocal, parallelism)) {
+      _hasMore = false;
+      skipped += skippedLocal;
+      return;
+    }
+  }
+  skipAll(skipped);
+}
+
 /// @brief default implementation for rearm
 /// specialized index iterators can implement this method with some
 /// sensible behavior
@@ -90,6 +104,18 @@ bool IndexIterator::rearmImpl(arangodb::aql::AstNode const*,
                               std::string{typeName()} + ")");
 }
 
+void IndexIterator::skipAllParallel(uint64_t& skipped, size_t parallelism) {
+  if (_hasMore && parallelism > 1) {
+    uint64_t skippedLocal = 0;
+    if (skipAllParallelImpl(skippedLocal, parallelism)) {
+      _hasMore = false;
+      skipped += skippedLocal;
+      return;
+    }
+  }
+  skipAll(skipped);
+}
+
 /// @brief default implementation for rearm
 /// specialized index iterators can implement this method with some
 /// sensible behavior
@@ -112,13 +138,21 @@ bool IndexIterator::nextImpl(LocalDocumentIdCallback const&,
 
 bool IndexIterator::nextDocumentImpl(DocumentCallback const& cb,
                                      uint64_t limit) {
-  return nextImpl(
-      [this, &cb](LocalDocumentId const& token) {
-        return _collection->getPhysical()
-            ->read(_trx, token, cb, _readOwnWrites)
-            .ok();
+  // collect the document ids first, so that the storage engine can look
+  // up all documents in one batch instead of one by one
+  _documentIds.clear();
+  bool hasMore = nextImpl(
+      [this](LocalDocumentId const& token) {
+        _documentIds.emplace_back(token);
+        return true;
       },
       limit);
+  if (!_documentIds.empty()) {
+    // documents that cannot be found are skipped
+    std::ignore = _collection->getPhysical()->readMany(_trx, _documentIds, cb,
+                                                       _readOwnWrites);
+  }
+  return hasMore;
 }
 
 /// @brief default implementation for nextCovering
@@ -54,6 +54,7 @@
 #include <cstdint>
 #include <functional>
 #include <string_view>
+#include <vector>
 #include <function2/function2.hpp>
 #include <velocypack/Slice.h>
 #include <velocypack/velocypack-common.h>
@@ -307,6 +308,11 @@ class IndexIterator {
   ///        throw on OUT_OF_MEMORY
   void skipAll(uint64_t& skipped);
 
+  /// @brief skip all elements, using up to parallelism many threads if the
+  ///        iterator supports it. falls back to skipAll() otherwise.
+  ///        skipped will be increased by the amount of skipped elements
+  void skipAllParallel(uint64_t& skipped, size_t parallelism);
+
   virtual std::string_view typeName() const noexcept = 0;
 
   /// @brief whether or not the index iterator supports rearming
@@ -340,6 +346,13 @@ class IndexIterator {
 
   virtual void skipImpl(uint64_t count, uint64_t& skipped);
 
+  // skip all elements using up to parallelism many threads. must return
+  // false without modifying any state if the iterator cannot do this
+  virtual bool skipAllParallelImpl(uint64_t& /*skipped*/,
+                                   size_t /*parallelism*/) {
+    return false;
+  }
+
   void incrCacheHits(std::uint64_t value = 1) noexcept { _cacheHits += value; }
   void incrCacheMisses(std::uint64_t value = 1) noexcept {
     _cacheMisses += value;
@@ -368,6 +381,10 @@ class IndexIterator {
 
  private:
   ReadOwnWrites const _readOwnWrites;
+
+  // buffer for the document ids produced by the default implementation of
+  // nextDocumentImpl, so that the documents can be read in one go
+  std::vector<LocalDocumentId> _documentIds;
 };
 
 /// @brief Special iterator if the condition cannot have any result
@@ -417,6 +434,11 @@ struct IndexIteratorOptions {
   bool waitForSync = false;
   /// @brief iterator will be used with late materialization
   bool forLateMaterialization{false};
+  /// @brief if non-zero, the caller only needs one index entry for each
+  /// distinct combination of values of the first distinctPrefixFields index
+  /// attributes. sorted indexes may skip over the other entries, but are not
+  /// required to
+  size_t distinctPrefixFields = 0;
 };
 
 /// index estimate map, defined here because it was convenient
@@ -0,0 +1,273 @@
+////////////////////////////////////////////////////////////////////////////////
+/// DISCLAIMER
+///
+/// Copyright 2014-2023 ArangoDB GmbH, Cologne, Germany
+/// Copyright 2004-2014 triAGENS GmbH, Cologne, Germany
+///
+/// Licensed under the Apache License, Version 2.0 (the "License");
+/// you may not use this file except in compliance with the License.
+/// You may obtain a copy of the License at
+///
+///     http://www.apache.org/licenses/LICENSE-2.0
+///
+/// Unless required by applicable law or agreed to in writing, software
+/// distributed under the License is distributed on an "AS IS" BASIS,
+/// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+/// See the License for the specific language governing permissions and
+/// limitations under the License.
+///
+/// Copyright holder is ArangoDB GmbH, Cologne, Germany
+///
+/// @author Jan Steemann
+////////////////////////////////////////////////////////////////////////////////
+
+#include "InternalRestDocumentBatchHandler.h"
+
+#include "Basics/Exceptions.h"
+#include "Basics/StaticStrings.h"
+#include "Basics/StringUtils.h"
+#include "Basics/error.h"
+#include "Cluster/ServerState.h"
+#include "Futures/Utilities.h"
+#include "GeneralServer/GeneralServerFeature.h"
+#include "GeneralServer/RestHandlerFactory.h"
+#include "Replication2/coro-helper.h"
+#include "Rest/VstRequest.h"
+#include "Rest/VstResponse.h"
+#include "Scheduler/SchedulerFeature.h"
+#include "Utils/ExecContext.h"
+
+#include <absl/strings/str_cat.h>
+#include <velocypack/Builder.h>
+#include <velocypack/Iterator.h>
+
+#include <memory>
+
+using namespace arangodb;
+using namespace arangodb::basics;
+using namespace arangodb::rest;
+
+namespace {
+void setError(rest::ResponseCode code, ErrorCode errorNumber,
+              std::string_view message,
+              rest::ResponseCode& responseCode,
+              velocypack::Buffer<uint8_t>& body) {
+  responseCode = code;
+  body.clear();
+  VPackBuilder builder(body);
+  builder.openObject();
+  builder.add(StaticStrings::Error, VPackValue(true));
+  builder.add(StaticStrings::Code, VPackValue(static_cast<int>(code)));
+  builder.add(StaticStrings::ErrorNum, VPackValue(errorNumber));
+  builder.add(StaticStrings::ErrorMessage, VPackValue(message));
+  builder.close();
+}
+}  // namespace
+
+InternalRestDocumentBatchHandler::InternalRestDocumentBatchHandler(
+    ArangodServer& server, GeneralRequest* request, GeneralResponse* response)
+    : RestVocbaseBaseHandler(server, request, response) {}
+
+futures::Future<futures::Unit>
+InternalRestDocumentBatchHandler::executeAsync() {
+  if (!ServerState::instance()->isDBServer()) {
+    generateForbidden();
+    co_return futures::Unit{};
+  }
+
+  auto const type = _request->requestType();
+  if (type != RequestType::POST && type != RequestType::PUT &&
+      type != RequestType::DELETE_REQ) {
+    generateError(ResponseCode::METHOD_NOT_ALLOWED,
+                  TRI_ERROR_HTTP_METHOD_NOT_ALLOWED);
+    co_return futures::Unit{};
+  }
+
+  bool parseSuccess = false;
+  VPackSlice body = parseVPackBody(parseSuccess);
+  if (!parseSuccess) {
+    co_return futures::Unit{};
+  }
+
+  _operations = body.isObject() ? body.get(kOperations) : VPackSlice();
+  if (!_operations.isArray()) {
+    generateError(ResponseCode::BAD, TRI_ERROR_HTTP_BAD_PARAMETER,
+                  "expecting 'operations' array in body");
+    co_return futures::Unit{};
+  }
+
+  bool sequential = false;
+  for (VPackSlice operation : VPackArrayIterator(_operations)) {
+    if (!operation.isObject() || !operation.get(kShard).isString() ||
+        operation.get(kBody).isNone() ||
+        !(operation.get(kHeaders).isNone() ||
+          operation.get(kHeaders).isObject())) {
+      generateError(ResponseCode::BAD, TRI_ERROR_HTTP_BAD_PARAMETER,
+                    "invalid operation in body");
+      co_return futures::Unit{};
+    }
+    if (VPackSlice headers = operation.get(kHeaders);
+        headers.isObject() && headers.hasKey(StaticStrings::TransactionId)) {
+      // a transaction must not be used by multiple operations at the same
+      // time
+      sequential = true;
+    }
+  }
+
+  _responses.resize(_operations.length());
+
+  if (sequential) {
+    for (std::size_t i = 0; i < _responses.size(); ++i) {
+      co_await executeOperation(i);
+    }
+  } else {
+    std::vector<futures::Future<futures::Unit>> futures;
+    futures.reserve(_responses.size());
+    for (std::size_t i = 0; i < _responses.size(); ++i) {
+      futures.emplace_back(executeOperation(i));
+    }
+    co_await futures::collectAll(std::move(futures));
+  }
+
+  generateBatchResult();
+  co_return futures::Unit{};
+}
+
+futures::Future<futures::Unit>
+InternalRestDocumentBatchHandler::executeOperation(std::size_t index) {
+  SubResponse& subResponse = _responses[index];
+
+  std::shared_ptr<RestHandler> handler;
+  try {
+    VPackSlice operation = _operations.at(index);
+
+    // build a VST request for the operation, so that the operation body
+    // can be used as it is
+    velocypack::Buffer<uint8_t> buffer;
+    {
+      VPackBuilder builder(buffer);
+      // version, type, database, request type, path, parameters, meta
+      builder.openArray();
+      builder.add(VPackValue(1));
+      builder.add(VPackValue(1));
+      builder.add(VPackValue(_request->databaseName()));
+      builder.add(VPackValue(static_cast<int>(_request->requestType())));
+      builder.add(VPackValue(absl::StrCat(
+          DOCUMENT_PATH, "/",
+          StringUtils::urlEncode(operation.get(kShard).stringView()))));
+      builder.openObject();
+      for (auto const& [key, value] : _request->values()) {
+        builder.add(key, VPackValue(value));
+      }
+      builder.close();
+      builder.openObject();
+      if (VPackSlice headers = operation.get(kHeaders); headers.isObject()) {
+        for (auto it : VPackObjectIterator(headers)) {
+          builder.add(it.key.stringView(), it.value);
+        }
+      }
+      builder.close();
+      builder.close();
+    }
+    std::size_t const payloadOffset = buffer.size();
+    VPackSlice operationBody = operation.get(kBody);
+    buffer.append(operationBody.start(), operationBody.byteSize());
+
+    auto request = std::make_unique<VstRequest>(
+        _request->connectionInfo(), std::move(buffer), payloadOffset,
+        /*messageId*/ 1);
+    // the "false" means the context is not responsible for resource
+    // handling
+    request->setRequestContext(_request->requestContext(), false);
+    request->setUser(_request->user());
+    request->setAuthenticated(_request->authenticated());
+
+    auto response =
+        std::make_unique<VstResponse>(ResponseCode::SERVER_ERROR, 1);
+    auto factory = server().getFeature<GeneralServerFeature>().handlerFactory();
+    handler = factory->createHandler(server(), std::move(request),
+                                     std::move(response));
+  } catch (basics::Exception const& ex) {
+    setError(GeneralResponse::responseCode(ex.code()), ex.code(), ex.what(),
+             subResponse.code, subResponse.body);
+    return futures::Unit{};
+  } catch (std::exception const& ex) {
+    setError(ResponseCode::BAD, TRI_ERROR_HTTP_BAD_PARAMETER, ex.what(),
+             subResponse.code, subResponse.body);
+    return futures::Unit{};
+  }
+
+  if (handler == nullptr) {
+    setError(ResponseCode::SERVER_ERROR, TRI_ERROR_INTERNAL,
+             "could not create handler for batch operation",
+             subResponse.code, subResponse.body);
+    return futures::Unit{};
+  }
+  handler->setIsAsyncRequest();
+
+  auto promise = std::make_shared<futures::Promise<futures::Unit>>();
+  auto future = promise->getFuture();
+
+  auto finish = [&subResponse, promise](RestHandler* handler) {
+    if (promise->isFulfilled()) {
+      return;
+    }
+    auto* response = dynamic_cast<VstResponse*>(handler->response());
+    if (response == nullptr) {
+      setError(ResponseCode::SERVER_ERROR, TRI_ERROR_INTERNAL,
+               "could not create a response for batch operation",
+               subResponse.code, subResponse.body);
+    } else {
+      subResponse.code = response->responseCode();
+      subResponse.headers = response->headers();
+      subResponse.body = std::move(response->payload());
+    }
+    promise->setValue(futures::Unit{});
+  };
+
+  bool ok = SchedulerFeature::SCHEDULER->tryBoundedQueue(
+      handler->lane(), [self = shared_from_this(), handler, finish]() {
+        // errors are reported via the response of the operation
+        try {
+          ExecContextScope scope(nullptr);  // workaround because of assertions
+          handler->runHandler(finish);
+        } catch (...) {
+          finish(handler.get());
+        }
+      });
+
+  if (!ok) {
+    // the coordinator will retry the operation on its own
+    setError(ResponseCode::SERVICE_UNAVAILABLE, TRI_ERROR_QUEUE_FULL,
+             TRI_errno_string(TRI_ERROR_QUEUE_FULL), subResponse.code,
+             subResponse.body);
+    return futures::Unit{};
+  }
+
+  return future;
+}
+
+void InternalRestDocumentBatchHandler::generateBatchResult() {
+  VPackBuilder builder;
+  builder.openObject();
+  builder.add(kOperations, VPackValue(VPackValueType::Array));
+  for (auto const& subResponse : _responses) {
+    builder.openObject();
+    builder.add(kCode, VPackValue(static_cast<int>(subResponse.code)));
+    builder.add(kHeaders, VPackValue(VPackValueType::Object));
+    for (auto const& [key, value] : subResponse.headers) {
+      builder.add(key, VPackValue(value));
+    }
+    builder.close();
+    if (subResponse.body.empty()) {
+      builder.add(kBody, VPackSlice::nullSlice());
+    } else {
+      builder.add(kBody, VPackSlice(subResponse.body.data()));
+    }
+    builder.close();
+  }
+  builder.close();
+  builder.close();
+
+  generateResult(ResponseCode::OK, builder.slice());
+}
@@ -0,0 +1,87 @@
+////////////////////////////////////////////////////////////////////////////////
+/// DISCLAIMER
+///
+/// Copyright 2014-2023 ArangoDB GmbH, Cologne, Germany
+/// Copyright 2004-2014 triAGENS GmbH, Cologne, Germany
+///
+/// Licensed under the Apache License, Version 2.0 (the "License");
+/// you may not use this file except in compliance with the License.
+/// You may obtain a copy of the License at
+///
+///     http://www.apache.org/licenses/LICENSE-2.0
+///
+/// Unless required by applicable law or agreed to in writing, software
+/// distributed under the License is distributed on an "AS IS" BASIS,
+/// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+/// See the License for the specific language governing permissions and
+/// limitations under the License.
+///
+/// Copyright holder is ArangoDB GmbH, Cologne, Germany
+///
+/// @author Jan Steemann
+////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "Futures/Future.h"
+#include "RestHandler/RestVocbaseBaseHandler.h"
+
+#include <velocypack/Buffer.h>
+#include <velocypack/Slice.h>
+
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace arangodb {
+
+/// @brief DB-server side of batched multi-shard document operations.
+/// a coordinator that needs to contact several shards with the same leader
+/// sends one request to that leader instead of one request per shard. the
+/// request body contains the per-shard operations, which are executed by
+/// the regular document handler here. the query parameters and the HTTP
+/// verb of the batch request are used for all operations.
+/// the operations are executed in parallel, unless one of them carries a
+/// transaction header. in this case they are executed one after the other,
+/// so that the transaction is not used concurrently, and only the first
+/// operation needs to carry the header for beginning the transaction.
+class InternalRestDocumentBatchHandler : public RestVocbaseBaseHandler {
+ public:
+  // attribute names used in request and response bodies
+  static constexpr std::string_view kOperations = "operations";
+  static constexpr std::string_view kShard = "shard";
+  static constexpr std::string_view kHeaders = "headers";
+  static constexpr std::string_view kBody = "body";
+  static constexpr std::string_view kCode = "code";
+
+  InternalRestDocumentBatchHandler(ArangodServer&, GeneralRequest*,
+                                   GeneralResponse*);
+
+  char const* name() const override final {
+    return "InternalRestDocumentBatchHandler";
+  }
+  RequestLane lane() const override final { return RequestLane::CLIENT_SLOW; }
+
+ protected:
+  futures::Future<futures::Unit> executeAsync() override;
+
+ private:
+  // response of a single operation
+  struct SubResponse {
+    rest::ResponseCode code = rest::ResponseCode::SERVER_ERROR;
+    std::unordered_map<std::string, std::string> headers;
+    velocypack::Buffer<uint8_t> body;
+  };
+
+  // run the operation at the given index. the returned future is fulfilled
+  // once the operation has finished, and never contains an exception
+  futures::Future<futures::Unit> executeOperation(std::size_t index);
+
+  void generateBatchResult();
+
+  velocypack::Slice _operations;
+  std::vector<SubResponse> _responses;
+};
+
+}  // namespace arangodb
@@ -184,6 +184,8 @@ void InternalRestTraverserHandler::queryEngine() {
                     "expecting 'keys' to be a string or an array value.");
       return;
     }
+    // a new-style request for the edges of multiple vertices at once
+    bool groupByVertex = body.get("groupByVertex").isTrue();
 
     switch (engine->getType()) {
       case BaseEngine::EngineType::TRAVERSER: {
@@ -200,7 +202,8 @@ void InternalRestTraverserHandler::queryEngine() {
         VPackSlice variables = body.get("variables");
         eng->injectVariables(variables);
 
-        eng->getEdges(keysSlice, depthSlice.getNumericValue<size_t>(), result);
+        eng->getEdges(keysSlice, depthSlice.getNumericValue<size_t>(), result,
+                      groupByVertex);
         break;
       }
       case BaseEngine::EngineType::SHORTESTPATH: {
@@ -213,7 +216,7 @@ void InternalRestTraverserHandler::queryEngine() {
         // Safe cast ShortestPathEngines are all of type SHORTESTPATH
         auto eng = static_cast<ShortestPathEngine*>(engine);
         TRI_ASSERT(eng != nullptr);
-        eng->getEdges(keysSlice, bwSlice.getBoolean(), result);
+        eng->getEdges(keysSlice, bwSlice.getBoolean(), result, groupByVertex);
         break;
       }
       default:
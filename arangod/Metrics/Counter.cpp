@@ -29,15 +29,16 @@ namespace arangodb::metrics {
 
 Counter::Counter(uint64_t n, std::string_view name, std::string_view help,
                  std::string_view labels)
-    : Metric{name, help, labels}, _c{n}, _b{_c} {}
+    : Metric{name, help, labels} {
+  _shards[0].value.store(n, std::memory_order_relaxed);
+}
 
-Counter::~Counter() { _b.push(); }
+Counter::~Counter() = default;
 
 std::string_view Counter::type() const noexcept { return "counter"; }
 
 void Counter::toPrometheus(std::string& result, std::string_view globals,
                            bool ensureWhitespace) const {
-  _b.push();
   Metric::addMark(result, name(), globals, labels());
   if (ensureWhitespace) {
     result.push_back(' ');
@@ -46,15 +47,27 @@ void Counter::toPrometheus(std::string& result, std::string_view globals,
 }
 
 uint64_t Counter::load() const noexcept {
-  _b.push();
-  return _c.load();
+  uint64_t sum = 0;
+  for (auto const& shard : _shards) {
+    sum += shard.value.load(std::memory_order_relaxed);
+  }
+  return sum;
 }
 
-void Counter::store(uint64_t n) noexcept { _c.exchange(n); }
+void Counter::store(uint64_t n) noexcept {
+  // increments that happen concurrently to this call may or may not be
+  // preserved
+  for (std::size_t i = 1; i < _shards.size(); ++i) {
+    _shards[i].value.store(0, std::memory_order_relaxed);
+  }
+  _shards[0].value.store(n, std::memory_order_relaxed);
+}
 
-void Counter::count(uint64_t n) noexcept { _b += n; }
+void Counter::count(uint64_t n) noexcept {
+  _shards[shardIndex()].value.fetch_add(n, std::memory_order_relaxed);
+}
 
-void Counter::count() noexcept { ++_b; }
+void Counter::count() noexcept { count(1); }
 
 Counter& Counter::operator=(uint64_t n) noexcept {
   store(n);
@@ -72,7 +85,7 @@ Counter& Counter::operator++() noexcept {
 }
 
 std::ostream& Counter::print(std::ostream& output) const {
-  return output << _c;
+  return output << load();
 }
 
 std::ostream& operator<<(std::ostream& output, Counter const& s) {
@@ -23,7 +23,10 @@
 #pragma once
 
 #include "Metrics/Metric.h"
+#include "Metrics/Shards.h"
 
+#include <array>
+#include <atomic>
 #include <cstdint>
 #include <string>
 #include <string_view>
@@ -55,8 +58,11 @@ class Counter final : public Metric {
   std::ostream& print(std::ostream& output) const;
 
  private:
-  mutable CounterType _c;
-  mutable BufferType _b;
+  struct alignas(kCacheLineSize) Shard {
+    std::atomic<uint64_t> value{0};
+  };
+
+  std::array<Shard, kNumShards> _shards;
 };
 
 }  // namespace arangodb::metrics
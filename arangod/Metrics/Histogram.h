@@ -23,8 +23,11 @@
 #pragma once
 
 #include "Metrics/Metric.h"
+#include "Metrics/Shards.h"
 
+#include <array>
 #include <atomic>
+#include <memory>
 #include <ostream>  // TODO(MBkkt) replace to iosfwd, compile error now
 #include <vector>
 
@@ -41,18 +44,18 @@ class Histogram : public Metric {
   Histogram(Scale&& scale, std::string_view name, std::string_view help,
             std::string_view labels)
       : Metric(name, help, labels),
-        _c(HistType(scale.n())),
         _scale(std::move(scale)),
         _n(_scale.n() - 1),
-        _sum(0) {}
+        _linesPerShard(linesPerShard(_scale.n())),
+        _lines(std::make_unique<Line[]>(_linesPerShard * kNumShards)) {}
 
   Histogram(Scale const& scale, std::string_view name, std::string_view help,
             std::string_view labels)
       : Metric(name, help, labels),
-        _c(HistType(scale.n())),
         _scale(scale),
         _n(_scale.n() - 1),
-        _sum(0) {}
+        _linesPerShard(linesPerShard(_scale.n())),
+        _lines(std::make_unique<Line[]>(_linesPerShard * kNumShards)) {}
 
   void track_extremes(ValueType val) noexcept {
 #ifdef ARANGODB_ENABLE_MAINTAINER_MODE
@@ -84,19 +87,25 @@ class Histogram : public Metric {
   void count(ValueType t) noexcept { count(t, 1); }
 
   void count(ValueType t, uint64_t n) noexcept {
+    size_t i;
     if (t < _scale.delims().front()) {
-      _c[0] += n;
+      i = 0;
     } else if (t >= _scale.delims().back()) {
-      _c[_n] += n;
+      i = _n;
     } else {
-      _c[pos(t)] += n;
+      i = pos(t);
     }
+    size_t const shard = shardIndex();
+    bucket(shard, i).fetch_add(n, std::memory_order_relaxed);
+    auto& sum = _sums[shard].value;
     if constexpr (std::is_integral_v<ValueType>) {
-      _sum.fetch_add(static_cast<ValueType>(n) * t);
+      sum.fetch_add(static_cast<ValueType>(n) * t, std::memory_order_relaxed);
     } else {
-      ValueType tmp = _sum.load(std::memory_order_relaxed);
+      // the shard is normally only updated by a single thread, so this
+      // rarely needs more than one attempt
+      ValueType tmp = sum.load(std::memory_order_relaxed);
       do {
-      } while (!_sum.compare_exchange_weak(
+      } while (!sum.compare_exchange_weak(
           tmp, tmp + static_cast<ValueType>(n) * t, std::memory_order_relaxed,
           std::memory_order_relaxed));
     }
@@ -106,8 +115,6 @@ class Histogram : public Metric {
   ValueType low() const { return _scale.low(); }
   ValueType high() const { return _scale.high(); }
 
-  HistType::value_type& operator[](size_t n) { return _c[n]; }
-
   std::vector<uint64_t> load() const {
     std::vector<uint64_t> v(size());
     for (size_t i = 0; i < size(); ++i) {
@@ -116,9 +123,23 @@ class Histogram : public Metric {
     return v;
   }
 
-  uint64_t load(size_t i) const { return _c.load(i); }
+  uint64_t load(size_t i) const {
+    uint64_t value = 0;
+    for (size_t shard = 0; shard < kNumShards; ++shard) {
+      value += bucket(shard, i).load(std::memory_order_relaxed);
+    }
+    return value;
+  }
 
-  size_t size() const { return _c.size(); }
+  size_t size() const { return _n + 1; }
+
+  ValueType sum() const {
+    ValueType value = 0;
+    for (auto const& shard : _sums) {
+      value += shard.value.load(std::memory_order_relaxed);
+    }
+    return value;
+  }
 
   void toPrometheus(std::string& result, std::string_view globals,
                     bool ensureWhitespace) const final {
@@ -131,9 +152,9 @@ class Histogram : public Metric {
       ls += ',';
     }
     ls += labels();
-    uint64_t sum = 0;
+    uint64_t total = 0;
     for (size_t i = 0, end = size(); i != end; ++i) {
-      sum += load(i);
+      total += load(i);
       result.append(name()).append("_bucket{");
       if (!ls.empty()) {
         result.append(ls) += ',';
@@ -142,18 +163,18 @@ class Histogram : public Metric {
       if (ensureWhitespace) {
         result.push_back(' ');
       }
-      result.append(std::to_string(sum)) += '\n';
+      result.append(std::to_string(total)) += '\n';
     }
     (result.append(name()).append("_count") += '{').append(ls) += '}';
     if (ensureWhitespace) {
       result.push_back(' ');
     }
-    result.append(std::to_string(sum)) += '\n';
+    result.append(std::to_string(total)) += '\n';
     (result.append(name()).append("_sum") += '{').append(ls) += '}';
     if (ensureWhitespace) {
       result.push_back(' ');
     }
-    result.append(std::to_string(_sum.load(std::memory_order_relaxed))) += '\n';
+    result.append(std::to_string(sum())) += '\n';
   }
 
   std::ostream& print(std::ostream& o) const {
@@ -165,10 +186,32 @@ class Histogram : public Metric {
   }
 
  private:
-  HistType _c;
+  static constexpr size_t kBucketsPerLine =
+      kCacheLineSize / sizeof(std::atomic<uint64_t>);
+
+  // bucket counters of a shard. every shard starts on its own cache line
+  struct alignas(kCacheLineSize) Line {
+    std::array<std::atomic<uint64_t>, kBucketsPerLine> buckets{};
+  };
+
+  struct alignas(kCacheLineSize) SumShard {
+    std::atomic<ValueType> value{0};
+  };
+
+  static size_t linesPerShard(size_t numBuckets) noexcept {
+    return (numBuckets + kBucketsPerLine - 1) / kBucketsPerLine;
+  }
+
+  std::atomic<uint64_t>& bucket(size_t shard, size_t i) const noexcept {
+    return _lines[shard * _linesPerShard + i / kBucketsPerLine]
+        .buckets[i % kBucketsPerLine];
+  }
+
   Scale const _scale;
   size_t const _n;
-  std::atomic<ValueType> _sum;
+  size_t const _linesPerShard;
+  std::unique_ptr<Line[]> _lines;
+  std::array<SumShard, kNumShards> _sums;
 #ifdef ARANGODB_ENABLE_MAINTAINER_MODE
   std::atomic<ValueType> _lowr{std::numeric_limits<ValueType>::max()};
   std::atomic<ValueType> _highr{std::numeric_limits<ValueType>::min()};
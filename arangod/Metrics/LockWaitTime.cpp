@@ -0,0 +1,100 @@
+////////////////////////////////////////////////////////////////////////////////
+/// DISCLAIMER
+///
+/// Copyright 2014-2023 ArangoDB GmbH, Cologne, Germany
+/// Copyright 2004-2014 triAGENS GmbH, Cologne, Germany
+///
+/// Licensed under the Apache License, Version 2.0 (the "License");
+/// you may not use this file except in compliance with the License.
+/// You may obtain a copy of the License at
+///
+///     http://www.apache.org/licenses/LICENSE-2.0
+///
+/// Unless required by applicable law or agreed to in writing, software
+/// distributed under the License is distributed on an "AS IS" BASIS,
+/// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+/// See the License for the specific language governing permissions and
+/// limitations under the License.
+///
+/// Copyright holder is ArangoDB GmbH, Cologne, Germany
+///
+/// @author Jan Steemann
+////////////////////////////////////////////////////////////////////////////////
+
+#include "Metrics/LockWaitTime.h"
+
+#include "Basics/LockContention.h"
+
+#include <string>
+
+namespace arangodb::metrics {
+
+LockWaitTime::LockWaitTime(basics::LockContentionSite const& site,
+                           std::string_view name, std::string_view help,
+                           std::string_view labels)
+    : Metric{name, help, labels}, _site{site} {}
+
+std::string_view LockWaitTime::type() const noexcept { return "histogram"; }
+
+void LockWaitTime::toPrometheus(std::string& result, std::string_view globals,
+                                bool ensureWhitespace) const {
+  auto const snapshot = _site.snapshot();
+
+  std::string ls;
+  ls.reserve(globals.size() + labels().size() + 1);
+  ls += globals;
+  if (!globals.empty() && !labels().empty()) {
+    ls += ',';
+  }
+  ls += labels();
+
+  uint64_t total = 0;
+  for (std::size_t i = 0; i < basics::LockContentionSite::kNumBuckets; ++i) {
+    total += snapshot.buckets[i];
+    result.append(name()).append("_bucket{");
+    if (!ls.empty()) {
+      result.append(ls) += ',';
+    }
+    result.append("le=\"");
+    if (i + 1 == basics::LockContentionSite::kNumBuckets) {
+      result.append("+Inf");
+    } else {
+      // bucket limits are exported in seconds
+      result.append(std::to_string(
+          basics::LockContentionSite::bucketLimitMicros(i) / 1e6));
+    }
+    result.append("\"}");
+    if (ensureWhitespace) {
+      result.push_back(' ');
+    }
+    result.append(std::to_string(total)) += '\n';
+  }
+  (result.append(name()).append("_count") += '{').append(ls) += '}';
+  if (ensureWhitespace) {
+    result.push_back(' ');
+  }
+  result.append(std::to_string(total)) += '\n';
+  (result.append(name()).append("_sum") += '{').append(ls) += '}';
+  if (ensureWhitespace) {
+    result.push_back(' ');
+  }
+  result.append(std::to_string(snapshot.totalWaitNanos / 1e9)) += '\n';
+}
+
+LockWaitTimeBuilder::LockWaitTimeBuilder(
+    basics::LockContentionSite const& site)
+    : _site{site} {
+  _name = "arangodb_lock_wait_time";
+  _help = "Time spent waiting for contended internal locks";
+  addLabel("site", site.name());
+}
+
+std::string_view LockWaitTimeBuilder::type() const noexcept {
+  return "histogram";
+}
+
+std::shared_ptr<Metric> LockWaitTimeBuilder::build() const {
+  return std::make_shared<LockWaitTime>(_site, _name, _help, _labels);
+}
+
+}  // namespace arangodb::metrics
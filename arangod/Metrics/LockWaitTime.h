@@ -0,0 +1,63 @@
+////////////////////////////////////////////////////////////////////////////////
+/// DISCLAIMER
+///
+/// Copyright 2014-2023 ArangoDB GmbH, Cologne, Germany
+/// Copyright 2004-2014 triAGENS GmbH, Cologne, Germany
+///
+/// Licensed under the Apache License, Version 2.0 (the "License");
+/// you may not use this file except in compliance with the License.
+/// You may obtain a copy of the License at
+///
+///     http://www.apache.org/licenses/LICENSE-2.0
+///
+/// Unless required by applicable law or agreed to in writing, software
+/// distributed under the License is distributed on an "AS IS" BASIS,
+/// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+/// See the License for the specific language governing permissions and
+/// limitations under the License.
+///
+/// Copyright holder is ArangoDB GmbH, Cologne, Germany
+///
+/// @author Jan Steemann
+////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "Metrics/Builder.h"
+#include "Metrics/Metric.h"
+
+namespace arangodb::basics {
+class LockContentionSite;
+}
+
+namespace arangodb::metrics {
+
+/// @brief exposes the lock wait times recorded for a lock contention site
+/// as a Prometheus histogram. the values are read from the site when the
+/// metrics are collected, so the lock wait paths do not touch the metric.
+class LockWaitTime final : public Metric {
+ public:
+  LockWaitTime(basics::LockContentionSite const& site, std::string_view name,
+               std::string_view help, std::string_view labels);
+
+  [[nodiscard]] std::string_view type() const noexcept final;
+  void toPrometheus(std::string& result, std::string_view globals,
+                    bool ensureWhitespace) const final;
+
+ private:
+  basics::LockContentionSite const& _site;
+};
+
+struct LockWaitTimeBuilder : GenericBuilder<LockWaitTimeBuilder> {
+  using MetricT = LockWaitTime;
+
+  explicit LockWaitTimeBuilder(basics::LockContentionSite const& site);
+
+  [[nodiscard]] std::string_view type() const noexcept final;
+  [[nodiscard]] std::shared_ptr<Metric> build() const final;
+
+ private:
+  basics::LockContentionSite const& _site;
+};
+
+}  // namespace arangodb::metrics
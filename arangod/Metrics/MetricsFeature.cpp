@@ -30,12 +30,14 @@
 #include "ApplicationFeatures/ApplicationServer.h"
 #include "ApplicationFeatures/GreetingsFeaturePhase.h"
 #include "Agency/Node.h"
+#include "Basics/LockContention.h"
 #include "Basics/application-exit.h"
 #include "Basics/debugging.h"
 #include "Cluster/ServerState.h"
 #include "Containers/FlatHashSet.h"
 #include "Logger/LoggerFeature.h"
 #include "Metrics/ClusterMetricsFeature.h"
+#include "Metrics/LockWaitTime.h"
 #include "Metrics/Metric.h"
 #include "ProgramOptions/ProgramOptions.h"
 #include "ProgramOptions/Section.h"
@@ -50,7 +52,8 @@ MetricsFeature::MetricsFeature(Server& server)
     : ArangodFeature{server, *this},
       _export{true},
       _exportReadWriteMetrics{false},
-      _ensureWhitespace{true} {
+      _ensureWhitespace{true},
+      _lockContentionProfiling{false} {
   setOptional(false);
   startsAfter<LoggerFeature>();
   startsBefore<application_features::GreetingsFeaturePhase>();
@@ -85,6 +88,24 @@ void MetricsFeature::collectOptions(
       .setLongDescription(R"(Using the whitespace characters in the output may
 be required to make the metrics output compatible with some processing tools,
 although Prometheus itself doesn't need it.)");
+
+  options
+      ->addOption("--server.lock-contention-profiling",
+                  "Whether to record the time spent waiting for contended "
+                  "internal locks.",
+                  new options::BooleanParameter(&_lockContentionProfiling),
+                  arangodb::options::makeDefaultFlags(
+                      arangodb::options::Flags::Uncommon))
+      .setIntroducedIn(31200)
+      .setLongDescription(R"(If enabled, the server measures how long threads
+wait for internal locks that could not be acquired immediately, e.g. the
+locks of collections and of the in-memory caches. The wait times are exposed
+per lock class in the `arangodb_lock_wait_time` histogram metric and via the
+`/_admin/server/lock-contention` API, which can also turn the profiling on
+and off at runtime.
+
+Uncontended lock acquisitions are not measured, but the profiling adds a
+clock read to every blocking wait. It is therefore turned off by default.)");
 }
 
 std::shared_ptr<Metric> MetricsFeature::doAdd(Builder& builder) {
@@ -125,6 +146,15 @@ void MetricsFeature::validateOptions(std::shared_ptr<options::ProgramOptions>) {
   if (_exportReadWriteMetrics) {
     serverStatistics().setupDocumentMetrics();
   }
+  if (_lockContentionProfiling) {
+    basics::LockContentionSite::setEnabled(true);
+    // the histograms are only exported if profiling was turned on at
+    // startup, so that the metrics output does not grow otherwise
+    basics::LockContentionSite::visit(
+        [this](basics::LockContentionSite const& site) {
+          add(LockWaitTimeBuilder{site});
+        });
+  }
 }
 
 void MetricsFeature::toPrometheus(std::string& result, CollectMode mode) const {
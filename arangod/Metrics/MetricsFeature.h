@@ -109,6 +109,7 @@ class MetricsFeature final : public ArangodFeature {
   // ensure that there is whitespace before the reported value, regardless
   // of whether it is preceeded by labels or not.
   bool _ensureWhitespace;
+  bool _lockContentionProfiling;
 };
 
 }  // namespace arangodb::metrics
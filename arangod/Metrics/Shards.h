@@ -0,0 +1,49 @@
+////////////////////////////////////////////////////////////////////////////////
+/// DISCLAIMER
+///
+/// Copyright 2014-2023 ArangoDB GmbH, Cologne, Germany
+/// Copyright 2004-2014 triAGENS GmbH, Cologne, Germany
+///
+/// Licensed under the Apache License, Version 2.0 (the "License");
+/// you may not use this file except in compliance with the License.
+/// You may obtain a copy of the License at
+///
+///     http://www.apache.org/licenses/LICENSE-2.0
+///
+/// Unless required by applicable law or agreed to in writing, software
+/// distributed under the License is distributed on an "AS IS" BASIS,
+/// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+/// See the License for the specific language governing permissions and
+/// limitations under the License.
+///
+/// Copyright holder is ArangoDB GmbH, Cologne, Germany
+///
+/// @author Jan Steemann
+////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+
+namespace arangodb::metrics {
+
+/// @brief the values of counters and histograms are split into this many
+/// shards, each on its own cache line. threads are assigned to shards
+/// round-robin, so that concurrent updates from different threads normally
+/// do not contend on the same cache line. readers sum up all shards.
+/// the number of shards is a tradeoff between contention on machines with
+/// many cores and the memory used by every metric.
+inline constexpr std::size_t kNumShards = 16;
+
+inline constexpr std::size_t kCacheLineSize = 64;
+
+/// @brief returns the shard the calling thread should update
+inline std::size_t shardIndex() noexcept {
+  static std::atomic<std::size_t> next{0};
+  thread_local std::size_t const index =
+      next.fetch_add(1, std::memory_order_relaxed) % kNumShards;
+  return index;
+}
+
+}  // namespace arangodb::metrics
@@ -64,6 +64,16 @@ namespace network {
 
 using namespace arangodb::fuerte::v1;
 
+namespace {
+// maximum number of requests we multiplex over a single HTTP/2 connection.
+// this matches the SETTINGS_MAX_CONCURRENT_STREAMS value that arangod
+// advertises, and also the capacity of fuerte's request queue
+constexpr std::size_t maxHttp2StreamsPerConnection = 32;
+// VST connections are multiplexed, too, but we keep the more conservative
+// limit for them
+constexpr std::size_t maxVstRequestsPerConnection = 4;
+}  // namespace
+
 struct ConnectionPool::Context {
   Context(std::shared_ptr<fuerte::Connection>,
           std::chrono::steady_clock::time_point, std::size_t);
@@ -257,11 +267,17 @@ struct ConnectionPool::Impl {
 
       TRI_ASSERT(_config.protocol != fuerte::ProtocolType::Undefined);
 
+      // the limit is inclusive, i.e. a connection can be leased if it has
+      // at most `limit` users and requests in flight
       std::size_t limit = 0;
       switch (_config.protocol) {
         case fuerte::ProtocolType::Vst:
+          limit = maxVstRequestsPerConnection;
+          break;
         case fuerte::ProtocolType::Http2:
-          limit = 4;
+          // fill up existing connections before opening new ones, to avoid
+          // opening lots of connections (and TLS handshakes) in bursts
+          limit = maxHttp2StreamsPerConnection - 1;
           break;
         default:
           break;  // keep default of 0
@@ -34,6 +34,7 @@
 #include "Cluster/ServerState.h"
 #include "Futures/Utilities.h"
 #include "Logger/LogMacros.h"
+#include "Logger/Tracing.h"
 #include "Network/ConnectionPool.h"
 #include "Network/NetworkFeature.h"
 #include "Network/Utils.h"
@@ -42,13 +43,18 @@
 #include "RestServer/arangod.h"
 #include "VocBase/ticks.h"
 
+#include <absl/strings/str_cat.h>
 #include <fuerte/connection.h>
 #include <fuerte/requests.h>
 #include <fuerte/types.h>
 
 #include <velocypack/Buffer.h>
+#include <velocypack/SharedSlice.h>
 #include <velocypack/Slice.h>
 
+#include <algorithm>
+#include <mutex>
+
 namespace arangodb {
 namespace network {
 using namespace arangodb::fuerte;
@@ -100,6 +106,17 @@ std::unique_ptr<arangodb::fuerte::Response> Response::stealResponse() noexcept {
   return std::unique_ptr<arangodb::fuerte::Response>(_response.release());
 }
 
+// returns a slice of the payload that shares ownership of the response
+velocypack::SharedSlice Response::stealSharedSlice() {
+  velocypack::Slice s = slice();
+  if (s.isNone()) {
+    return velocypack::SharedSlice{};
+  }
+  std::shared_ptr<fuerte::Response> owner = std::move(_response);
+  return velocypack::SharedSlice(
+      std::shared_ptr<uint8_t const>(std::move(owner), s.start()));
+}
+
 // returns a slice of the payload if there was no error
 velocypack::Slice Response::slice() const noexcept {
   if (error == fuerte::Error::NoError && _response) {
@@ -161,15 +178,29 @@ std::string Response::serverId() const {
   return StaticStrings::Empty;
 }
 
+namespace {
+void addPayload(fuerte::Request& req, VPackBufferUInt8&& payload) {
+  req.addVPack(std::move(payload));
+}
+
+void addPayload(fuerte::Request& req, SharedPayload&& payload) {
+  // the parts are only referenced by the request, not copied
+  for (auto& part : payload) {
+    req.addVPack(std::move(part));
+  }
+}
+}  // namespace
+
+template<typename Payload>
 auto prepareRequest(ConnectionPool* pool, RestVerb type, std::string path,
-                    VPackBufferUInt8 payload, RequestOptions const& options,
+                    Payload payload, RequestOptions const& options,
                     Headers headers) {
   TRI_ASSERT(path.find("/_db/") == std::string::npos);
   TRI_ASSERT(path.find('?') == std::string::npos);
   TRI_ASSERT(options.database == normalizeUtf8ToNFC(options.database));
 
-  auto req =
-      fuerte::createRequest(type, path, options.parameters, std::move(payload));
+  auto req = fuerte::createRequest(type, path, options.parameters);
+  addPayload(*req, std::move(payload));
 
   req->header.database = options.database;
   req->header.setMeta(std::move(headers));
@@ -235,6 +266,11 @@ struct Pack {
   RequestLane continuationLane;
   bool skipScheduler;
   bool handleContentEncoding;
+  // server whose latency is tracked for this request, or empty
+  std::string trackedServer;
+  std::chrono::steady_clock::time_point startTime;
+  // span covering the request, if tracing is turned on
+  tracing::Span span;
   Pack(DestinationId&& dest, RequestLane lane, bool skip, bool handle)
       : dest(std::move(dest)),
         continuationLane(lane),
@@ -263,6 +299,25 @@ void actuallySendRequest(std::shared_ptr<Pack>&& p, ConnectionPool* pool,
           return;
         }
 
+        // cppcheck-suppress accessMoved
+        if (!pack->trackedServer.empty()) {
+          auto& server = pool->config().clusterInfo->server();
+          server.getFeature<NetworkFeature>().latencyTracker().requestFinished(
+              pack->trackedServer,
+              std::chrono::steady_clock::now() - pack->startTime,
+              err != fuerte::Error::NoError);
+        }
+
+        if (pack->span.isRecording()) {
+          if (err != fuerte::Error::NoError) {
+            pack->span.setError(fuerte::to_string(err));
+          } else if (res != nullptr) {
+            pack->span.setAttribute(
+                "http.status_code", static_cast<int64_t>(res->statusCode()));
+          }
+        }
+        pack->span.end();
+
         auto* sch = SchedulerFeature::SCHEDULER;
         // cppcheck-suppress accessMoved
         if (pack->skipScheduler || sch == nullptr) {
@@ -285,12 +340,10 @@ void actuallySendRequest(std::shared_ptr<Pack>&& p, ConnectionPool* pool,
       });
 }
 
-}  // namespace
-
-/// @brief send a request to a given destination
-FutureRes sendRequest(ConnectionPool* pool, DestinationId dest, RestVerb type,
-                      std::string path, velocypack::Buffer<uint8_t> payload,
-                      RequestOptions const& options, Headers headers) {
+template<typename Payload>
+FutureRes sendRequestImpl(ConnectionPool* pool, DestinationId dest,
+                          RestVerb type, std::string path, Payload payload,
+                          RequestOptions const& options, Headers headers) {
   LOG_TOPIC("2713a", DEBUG, Logger::COMMUNICATION)
       << "request to '" << dest << "' '" << fuerte::to_string(type) << " "
       << path << "'";
@@ -343,7 +396,28 @@ FutureRes sendRequest(ConnectionPool* pool, DestinationId dest, RestVerb type,
     auto p = std::make_shared<Pack>(std::move(dest), options.continuationLane,
                                     options.skipScheduler,
                                     options.handleContentEncoding);
+    // propagate the trace context of the caller to the destination. this
+    // is also done for unsampled traces, so that the destination does not
+    // make its own sampling decision
+    p->span = tracing::Span(
+        absl::StrCat("network ", fuerte::to_string(type)),
+        tracing::SpanKind::kClient);
+    if (p->span.context().valid()) {
+      req->header.addMeta(std::string(tracing::kTraceParentHeader),
+                          p->span.context().toTraceParent());
+      if (p->span.isRecording()) {
+        p->span.setAttribute("http.target", req->header.path);
+        p->span.setAttribute("arangodb.destination", p->dest);
+      }
+    }
     FutureRes f = p->promise.getFuture();
+    auto& nf =
+        pool->config().clusterInfo->server().getFeature<NetworkFeature>();
+    if (nf.trackServerLatencies() && !spec.serverId.empty()) {
+      p->trackedServer = spec.serverId;
+      p->startTime = std::chrono::steady_clock::now();
+      nf.latencyTracker().requestStarted(p->trackedServer);
+    }
     actuallySendRequest(std::move(p), pool, options, spec.endpoint,
                         std::move(req));
     return f;
@@ -359,15 +433,34 @@ FutureRes sendRequest(ConnectionPool* pool, DestinationId dest, RestVerb type,
       Response{std::string(), Error::ConnectionCanceled, nullptr, nullptr});
 }
 
+}  // namespace
+
+/// @brief send a request to a given destination
+FutureRes sendRequest(ConnectionPool* pool, DestinationId dest, RestVerb type,
+                      std::string path, velocypack::Buffer<uint8_t> payload,
+                      RequestOptions const& options, Headers headers) {
+  return sendRequestImpl(pool, std::move(dest), type, std::move(path),
+                         std::move(payload), options, std::move(headers));
+}
+
+/// @brief send a request with a body consisting of shared parts
+FutureRes sendRequestShared(ConnectionPool* pool, DestinationId dest,
+                            RestVerb type, std::string path,
+                            SharedPayload payload,
+                            RequestOptions const& options, Headers headers) {
+  return sendRequestImpl(pool, std::move(dest), type, std::move(path),
+                         std::move(payload), options, std::move(headers));
+}
+
 /// Stateful handler class with enough information to keep retrying
 /// a request until an overall timeout is hit (or the request succeeds)
 class RequestsState final : public std::enable_shared_from_this<RequestsState>,
                             public RetryableRequest {
  public:
+  template<typename Payload>
   RequestsState(ConnectionPool* pool, DestinationId&& destination,
-                RestVerb type, std::string&& path,
-                velocypack::Buffer<uint8_t>&& payload, Headers&& headers,
-                RequestOptions const& options)
+                RestVerb type, std::string&& path, Payload&& payload,
+                Headers&& headers, RequestOptions const& options)
       : _destination(std::move(destination)),
         _options(options),
         _pool(pool),
@@ -637,12 +730,13 @@ class RequestsState final : public std::enable_shared_from_this<RequestsState>,
   fuerte::Error _tmp_err;
 };
 
-/// @brief send a request to a given destination, retry until timeout is
-/// exceeded
-FutureRes sendRequestRetry(ConnectionPool* pool, DestinationId destination,
-                           arangodb::fuerte::RestVerb type, std::string path,
-                           velocypack::Buffer<uint8_t> payload,
-                           RequestOptions const& options, Headers headers) {
+namespace {
+template<typename Payload>
+FutureRes sendRequestRetryImpl(ConnectionPool* pool, DestinationId destination,
+                               arangodb::fuerte::RestVerb type,
+                               std::string path, Payload payload,
+                               RequestOptions const& options,
+                               Headers headers) {
   try {
     if (!pool || !pool->config().clusterInfo) {
       LOG_TOPIC("59b96", ERR, Logger::COMMUNICATION)
@@ -672,6 +766,164 @@ FutureRes sendRequestRetry(ConnectionPool* pool, DestinationId destination,
   return futures::makeFuture(
       Response{std::string(), Error::ConnectionCanceled, nullptr, nullptr});
 }
+}  // namespace
+
+/// @brief send a request to a given destination, retry until timeout is
+/// exceeded
+FutureRes sendRequestRetry(ConnectionPool* pool, DestinationId destination,
+                           arangodb::fuerte::RestVerb type, std::string path,
+                           velocypack::Buffer<uint8_t> payload,
+                           RequestOptions const& options, Headers headers) {
+  return sendRequestRetryImpl(pool, std::move(destination), type,
+                              std::move(path), std::move(payload), options,
+                              std::move(headers));
+}
+
+/// @brief send a request with a body consisting of shared parts, retry
+/// until timeout is exceeded
+FutureRes sendRequestRetryShared(ConnectionPool* pool,
+                                 DestinationId destination,
+                                 arangodb::fuerte::RestVerb type,
+                                 std::string path, SharedPayload payload,
+                                 RequestOptions const& options,
+                                 Headers headers) {
+  return sendRequestRetryImpl(pool, std::move(destination), type,
+                              std::move(path), std::move(payload), options,
+                              std::move(headers));
+}
+
+namespace {
+/// @brief state of a request that is sent to up to two replicas
+struct HedgedRequest : std::enable_shared_from_this<HedgedRequest> {
+  ConnectionPool* pool;
+  DestinationId destination;
+  std::vector<std::string> replicas;
+  RestVerb type;
+  std::string path;
+  velocypack::Buffer<uint8_t> payload;
+  RequestOptions options;
+  Headers headers;
+
+  std::mutex mutex;
+  PromiseRes promise;
+  Scheduler::WorkHandle timer;
+  // number of replicas the request has been sent to
+  std::size_t sent = 0;
+  // number of requests without a response yet
+  std::size_t pending = 0;
+  bool done = false;
+
+  // must be called without holding the mutex, because the response can
+  // be handled synchronously
+  void send(std::size_t index) {
+    TRI_ASSERT(index < replicas.size());
+    RequestOptions opts = options;
+    opts.overrideDestination = replicas[index];
+    sendRequestRetry(pool, destination, type, path, payload, opts, headers)
+        .thenFinal([self = shared_from_this()](Try<Response>&& t) mutable {
+          self->handleResponse(std::move(t));
+        });
+  }
+
+  // send to the second replica. returns false if this already happened or
+  // if the request is already finished
+  bool hedge() {
+    {
+      std::lock_guard guard{mutex};
+      if (done || sent >= 2) {
+        return false;
+      }
+      sent = 2;
+      ++pending;
+    }
+    send(1);
+    return true;
+  }
+
+  void handleResponse(Try<Response>&& t) {
+    bool usable = t.hasValue() && t.get().error == fuerte::Error::NoError &&
+                  t.get().statusCode() != fuerte::StatusServiceUnavailable;
+    std::unique_lock guard{mutex};
+    TRI_ASSERT(pending > 0);
+    --pending;
+    if (done) {
+      // the other replica was faster
+      return;
+    }
+    if (!usable) {
+      if (sent < 2) {
+        // the first replica failed, do not wait for the timer
+        guard.unlock();
+        hedge();
+        return;
+      }
+      if (pending > 0) {
+        // wait for the other replica
+        return;
+      }
+    }
+    done = true;
+    auto t2 = std::move(timer);
+    guard.unlock();
+    // canceling the timer must happen without holding the mutex
+    t2.reset();
+    promise.setTry(std::move(t));
+  }
+};
+}  // namespace
+
+FutureRes sendRequestHedged(ConnectionPool* pool, DestinationId destination,
+                            std::vector<std::string> replicas,
+                            arangodb::fuerte::RestVerb type, std::string path,
+                            velocypack::Buffer<uint8_t> payload,
+                            RequestOptions const& options, Headers headers) {
+  TRI_ASSERT(!replicas.empty());
+  auto* sch = SchedulerFeature::SCHEDULER;
+  if (replicas.size() < 2 || sch == nullptr || !pool ||
+      !pool->config().clusterInfo) {
+    RequestOptions opts = options;
+    if (!replicas.empty()) {
+      opts.overrideDestination = replicas.front();
+    }
+    return sendRequestRetry(pool, std::move(destination), type,
+                            std::move(path), std::move(payload), opts,
+                            std::move(headers));
+  }
+
+  auto& nf = pool->config().clusterInfo->server().getFeature<NetworkFeature>();
+  auto delay = std::max<std::chrono::steady_clock::duration>(
+      nf.latencyTracker().estimatedP95Latency(replicas.front()),
+      nf.hedgeMinDelay());
+
+  auto state = std::make_shared<HedgedRequest>();
+  state->pool = pool;
+  state->destination = std::move(destination);
+  state->replicas = std::move(replicas);
+  state->type = type;
+  state->path = std::move(path);
+  state->payload = std::move(payload);
+  state->options = options;
+  state->headers = std::move(headers);
+  state->sent = 1;
+  state->pending = 1;
+  FutureRes f = state->promise.getFuture();
+
+  {
+    std::lock_guard guard{state->mutex};
+    state->timer = sch->queueDelayed(
+        "hedged-request", RequestLane::CLUSTER_INTERNAL, delay,
+        [weak = std::weak_ptr(state), &nf](bool canceled) {
+          if (canceled) {
+            return;
+          }
+          if (auto self = weak.lock(); self && self->hedge()) {
+            nf.trackHedgedRequest();
+          }
+        });
+  }
+  state->send(0);
+  return f;
+}
 
 }  // namespace network
 }  // namespace arangodb
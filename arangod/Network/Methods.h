@@ -33,11 +33,13 @@
 #include "Network/types.h"
 
 #include <fuerte/message.h>
+#include <velocypack/SharedSlice.h>
 
 #include <chrono>
 #include <cstdint>
 #include <string>
 #include <memory>
+#include <vector>
 
 namespace arangodb {
 namespace velocypack {
@@ -95,6 +97,12 @@ struct Response {
   // returns a slice of the payload if there was no error
   [[nodiscard]] velocypack::Slice slice() const noexcept;
 
+  /// @brief returns the payload with shared ownership, without copying it.
+  /// the slice points into the receive buffer of the response, which is
+  /// taken over, so response() must not be used afterwards. returns a none
+  /// slice if there was an error
+  [[nodiscard]] velocypack::SharedSlice stealSharedSlice();
+
   template<typename T>
   [[nodiscard]] auto deserialize() -> ResultT<T> {
     if (auto res = combinedResult(); res.fail()) {
@@ -134,6 +142,19 @@ using FutureRes = arangodb::futures::Future<Response>;
 static constexpr Timeout TimeoutDefault = Timeout(120.0);
 
 // Container for optional (often defaulted) parameters
+/// @brief how the body of a request is compressed if it is larger than the
+/// configured compression threshold for the kind of request
+enum class Compression : std::uint8_t {
+  // never compress the body
+  kNone,
+  // lz4, for latency-sensitive requests. lz4 is only used once the receiver
+  // has announced that it can decode it
+  kFast,
+  // deflate, for bulk transfers such as replication. this compresses better
+  // than lz4 and can be decoded by all servers
+  kBulk,
+};
+
 struct RequestOptions {
   std::string database;
   std::string contentType;  // uses vpack by default
@@ -148,6 +169,11 @@ struct RequestOptions {
   // uncompress responses that have the `Content-Encoding: gzip|deflate` header
   // set.
   bool handleContentEncoding = false;
+  // coalesce identical concurrent GET/HEAD requests to the same endpoint
+  // into a single request. only set this for idempotent reads, for which it
+  // does not matter whether the response was produced for another caller
+  bool coalesceReads = false;
+  Compression compression = Compression::kFast;
   RequestLane continuationLane = RequestLane::CONTINUATION;
 
   // Normally this is empty, if it is set to the ID of a server in the
@@ -186,6 +212,40 @@ FutureRes sendRequestRetry(ConnectionPool* pool, DestinationId destination,
                            RequestOptions const& options = {},
                            Headers headers = {});
 
+/// @brief request body consisting of several VelocyPack values, which are
+/// sent one after the other without copying them into a single buffer. the
+/// values are only referenced, so the same values can be sent to multiple
+/// destinations
+using SharedPayload = std::vector<velocypack::SharedSlice>;
+
+/// @brief same as sendRequest, but with a body that is not copied
+FutureRes sendRequestShared(ConnectionPool* pool, DestinationId destination,
+                            arangodb::fuerte::RestVerb type, std::string path,
+                            SharedPayload payload,
+                            RequestOptions const& options = {},
+                            Headers headers = {});
+
+/// @brief same as sendRequestRetry, but with a body that is not copied
+FutureRes sendRequestRetryShared(ConnectionPool* pool,
+                                 DestinationId destination,
+                                 arangodb::fuerte::RestVerb type,
+                                 std::string path, SharedPayload payload,
+                                 RequestOptions const& options = {},
+                                 Headers headers = {});
+
+/// @brief send a read request for a shard to the first of the given
+/// replicas. if that replica has not responded after its estimated 95th
+/// percentile latency (but at least --network.hedge-min-delay), the request
+/// is also sent to the second replica, and the first usable response wins.
+/// if the first replica fails, the second one is tried immediately. must
+/// only be used for requests without side effects
+FutureRes sendRequestHedged(ConnectionPool* pool, DestinationId destination,
+                            std::vector<std::string> replicas,
+                            arangodb::fuerte::RestVerb type, std::string path,
+                            velocypack::Buffer<uint8_t> payload = {},
+                            RequestOptions const& options = {},
+                            Headers headers = {});
+
 using Sender = std::function<FutureRes(
     DestinationId const&, arangodb::fuerte::RestVerb, std::string const&,
     velocypack::Buffer<uint8_t>, RequestOptions const& options, Headers)>;
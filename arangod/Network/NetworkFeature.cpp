@@ -24,16 +24,19 @@
 #include "NetworkFeature.h"
 
 #include <fuerte/connection.h>
+#include <velocypack/Buffer.h>
 
 #include "ApplicationFeatures/ApplicationServer.h"
 #include "Basics/EncodingUtils.h"
 #include "Basics/FunctionUtils.h"
 #include "Basics/ScopeGuard.h"
+#include "Basics/StaticStrings.h"
 #include "Basics/application-exit.h"
 #include "Basics/debugging.h"
 #include "Cluster/ClusterFeature.h"
 #include "Cluster/ClusterInfo.h"
 #include "GeneralServer/GeneralServerFeature.h"
+#include "Logger/LogMacros.h"
 #include "Network/ConnectionPool.h"
 #include "Network/Methods.h"
 #include "ProgramOptions/ProgramOptions.h"
@@ -55,6 +58,49 @@ void queueGarbageCollection(std::mutex& mutex,
       "networkfeature-gc", arangodb::RequestLane::INTERNAL_LOW, offset, gcfunc);
 }
 
+/// @brief build the key under which identical requests are coalesced.
+/// the HLC header is different for every request and is thus ignored
+std::string buildCoalescingKey(std::string const& endpoint,
+                               arangodb::network::RequestOptions const& options,
+                               arangodb::fuerte::Request const& req) {
+  std::string key;
+  auto append = [&key](std::string_view value) {
+    key.append(value);
+    key.push_back('\0');
+  };
+  append(endpoint);
+  append(arangodb::fuerte::to_string(req.header.restVerb));
+  append(req.header.database);
+  append(req.header.path);
+  for (auto const& [k, v] : req.header.parameters) {
+    append(k);
+    append(v);
+  }
+  append(arangodb::fuerte::to_string(req.header.contentType()));
+  append(arangodb::fuerte::to_string(req.header.acceptType()));
+  for (auto const& [k, v] : req.header.meta()) {
+    if (k != arangodb::StaticStrings::HLCHeader) {
+      append(k);
+      append(v);
+    }
+  }
+  append(std::to_string(req.timeout().count()));
+  append(options.handleContentEncoding ? "1" : "0");
+  auto payload = req.payload();
+  key.append(static_cast<char const*>(payload.data()), payload.size());
+  return key;
+}
+
+std::unique_ptr<arangodb::fuerte::Response> copyResponse(
+    arangodb::fuerte::Response const& res) {
+  auto copy = std::make_unique<arangodb::fuerte::Response>(res.header);
+  arangodb::velocypack::Buffer<uint8_t> payload;
+  auto source = res.payload();
+  payload.append(static_cast<uint8_t const*>(source.data()), source.size());
+  copy->setPayload(std::move(payload), 0);
+  return copy;
+}
+
 constexpr double CongestionRatio = 0.5;
 constexpr std::uint64_t MaxAllowedInFlight = 65536;
 constexpr std::uint64_t MinAllowedInFlight = 64;
@@ -96,6 +142,16 @@ DECLARE_COUNTER(arangodb_network_forwarded_requests_total,
                 "Number of requests forwarded to another coordinator");
 DECLARE_COUNTER(arangodb_network_request_timeouts_total,
                 "Number of internal requests that have timed out");
+DECLARE_COUNTER(arangodb_network_coalesced_requests_total,
+                "Number of internal requests answered by an identical request");
+DECLARE_COUNTER(arangodb_network_hedged_requests_total,
+                "Number of reads from followers sent to a second replica");
+DECLARE_COUNTER(arangodb_network_compression_uncompressed_bytes_total,
+                "Size of compressed internal request bodies before "
+                "compression");
+DECLARE_COUNTER(arangodb_network_compression_compressed_bytes_total,
+                "Size of compressed internal request bodies after "
+                "compression");
 DECLARE_HISTOGRAM(
     arangodb_network_request_duration_as_percentage_of_timeout,
     NetworkFeatureScale,
@@ -122,6 +178,11 @@ NetworkFeature::NetworkFeature(Server& server,
       _numIOThreads(config.numIOThreads),
       _verifyHosts(config.verifyHosts),
       _prepared(false),
+      _adaptiveReplicaSelection(false),
+      _hedgeFollowerReads(false),
+      _hedgeMinDelay(5),
+      _compressionThresholdFast(0),
+      _compressionThresholdBulk(0),
       _forwardedRequests(server.getFeature<metrics::MetricsFeature>().add(
           arangodb_network_forwarded_requests_total{})),
       _maxInFlight(::MaxAllowedInFlight),
@@ -129,6 +190,10 @@ NetworkFeature::NetworkFeature(Server& server,
           arangodb_network_requests_in_flight{})),
       _requestTimeouts(server.getFeature<metrics::MetricsFeature>().add(
           arangodb_network_request_timeouts_total{})),
+      _coalescedRequestsTotal(server.getFeature<metrics::MetricsFeature>().add(
+          arangodb_network_coalesced_requests_total{})),
+      _hedgedRequestsTotal(server.getFeature<metrics::MetricsFeature>().add(
+          arangodb_network_hedged_requests_total{})),
       _requestDurations(server.getFeature<metrics::MetricsFeature>().add(
           arangodb_network_request_duration_as_percentage_of_timeout{})),
       _unfinishedSends(server.getFeature<metrics::MetricsFeature>().add(
@@ -187,6 +252,50 @@ void NetworkFeature::collectOptions(
                   new options::UInt64Parameter(&_maxInFlight),
                   options::makeDefaultFlags(options::Flags::Uncommon))
       .setIntroducedIn(30800);
+
+  options
+      ->addOption("--network.adaptive-replica-selection",
+                  "Send reads from followers to the replica with the lowest "
+                  "observed latency and number of requests in flight.",
+                  new BooleanParameter(&_adaptiveReplicaSelection),
+                  options::makeDefaultFlags(options::Flags::Uncommon))
+      .setIntroducedIn(31200);
+
+  options
+      ->addOption("--network.hedge-follower-reads",
+                  "Send single-shard reads from followers to a second "
+                  "replica if the first one has not responded after its "
+                  "estimated 95th percentile latency.",
+                  new BooleanParameter(&_hedgeFollowerReads),
+                  options::makeDefaultFlags(options::Flags::Uncommon))
+      .setIntroducedIn(31200);
+
+  options
+      ->addOption("--network.hedge-min-delay",
+                  "The minimum time to wait before a read from followers is "
+                  "sent to a second replica (in milliseconds).",
+                  new UInt64Parameter(&_hedgeMinDelay),
+                  options::makeDefaultFlags(options::Flags::Uncommon))
+      .setIntroducedIn(31200);
+
+  options
+      ->addOption("--network.compression-threshold-fast",
+                  "Compress bodies of latency-sensitive cluster-internal "
+                  "requests with lz4 if they are at least this large (in "
+                  "bytes, 0 = disabled). lz4 is only used for servers that "
+                  "announced support for it.",
+                  new UInt64Parameter(&_compressionThresholdFast),
+                  options::makeDefaultFlags(options::Flags::Uncommon))
+      .setIntroducedIn(31200);
+
+  options
+      ->addOption("--network.compression-threshold-bulk",
+                  "Compress bodies of bulk cluster-internal requests, e.g. "
+                  "for replication, with deflate if they are at least this "
+                  "large (in bytes, 0 = disabled).",
+                  new UInt64Parameter(&_compressionThresholdBulk),
+                  options::makeDefaultFlags(options::Flags::Uncommon))
+      .setIntroducedIn(31200);
 }
 
 void NetworkFeature::validateOptions(
@@ -343,6 +452,8 @@ bool NetworkFeature::prepared() const noexcept { return _prepared; }
 
 void NetworkFeature::trackForwardedRequest() noexcept { ++_forwardedRequests; }
 
+void NetworkFeature::trackHedgedRequest() noexcept { ++_hedgedRequestsTotal; }
+
 std::size_t NetworkFeature::requestsInFlight() const noexcept {
   return _requestsInFlight.load();
 }
@@ -361,6 +472,23 @@ void NetworkFeature::sendRequest(network::ConnectionPool& pool,
                                  std::unique_ptr<fuerte::Request>&& req,
                                  RequestCallback&& cb) {
   TRI_ASSERT(req != nullptr);
+
+  std::string coalescingKey;
+  if (options.coalesceReads &&
+      (req->header.restVerb == fuerte::RestVerb::Get ||
+       req->header.restVerb == fuerte::RestVerb::Head)) {
+    coalescingKey = buildCoalescingKey(endpoint, options, *req);
+    std::lock_guard guard(_coalescingMutex);
+    auto [it, inserted] = _coalescedRequests.try_emplace(coalescingKey);
+    if (!inserted) {
+      // an identical request is already in flight. piggyback on it
+      it->second.emplace_back(std::move(req), std::move(cb));
+      ++_coalescedRequestsTotal;
+      return;
+    }
+  }
+
+  compressRequest(endpoint, options, *req);
   prepareRequest(pool, req);
   bool isFromPool = false;
   auto now = std::chrono::steady_clock::now();
@@ -385,7 +513,8 @@ void NetworkFeature::sendRequest(network::ConnectionPool& pool,
       std::move(req),
       [this, &pool, isFromPool,
        handleContentEncoding = options.handleContentEncoding,
-       cb = std::move(cb), endpoint = std::move(endpoint)](
+       cb = std::move(cb), endpoint = std::move(endpoint),
+       coalescingKey = std::move(coalescingKey)](
           fuerte::Error err, std::unique_ptr<fuerte::Request> req,
           std::unique_ptr<fuerte::Response> res) {
         if (req->timeQueued().time_since_epoch().count() != 0 &&
@@ -441,7 +570,21 @@ void NetworkFeature::sendRequest(network::ConnectionPool& pool,
           }
         }
         TRI_ASSERT(req != nullptr);
+        if (res != nullptr && _compressionThresholdFast > 0 &&
+            res->header.metaByKey(StaticStrings::XArangoAcceptEncoding)
+                    .find(StaticStrings::EncodingArangoLz4) !=
+                std::string::npos) {
+          peerCompression(endpoint).supportsLz4.store(
+              true, std::memory_order_relaxed);
+        }
         finishRequest(pool, err, req, res);
+        // hand out the response to all coalesced requests, even if decoding
+        // the response below throws
+        auto coalescedGuard = scopeGuard([&]() noexcept {
+          if (!coalescingKey.empty()) {
+            finishCoalescedRequests(coalescingKey, err, res.get(), isFromPool);
+          }
+        });
         if (res != nullptr && handleContentEncoding) {
           // transparently handle decompression
           auto const& encoding =
@@ -466,10 +609,112 @@ void NetworkFeature::sendRequest(network::ConnectionPool& pool,
             res->setPayload(std::move(uncompressed), 0);
           }
         }
+        coalescedGuard.fire();
         cb(err, std::move(req), std::move(res), isFromPool);
       });
 }
 
+NetworkFeature::PeerCompression& NetworkFeature::peerCompression(
+    std::string const& endpoint) {
+  std::lock_guard guard(_compressionMutex);
+  auto it = _peerCompression.find(endpoint);
+  if (it == _peerCompression.end()) {
+    auto& mf = server().getFeature<metrics::MetricsFeature>();
+    auto& uncompressed = mf.add(
+        arangodb_network_compression_uncompressed_bytes_total{}.withLabel(
+            "peer", endpoint));
+    auto& compressed =
+        mf.add(arangodb_network_compression_compressed_bytes_total{}.withLabel(
+            "peer", endpoint));
+    it = _peerCompression
+             .emplace(endpoint, std::make_unique<PeerCompression>(
+                                    uncompressed, compressed))
+             .first;
+  }
+  return *it->second;
+}
+
+void NetworkFeature::compressRequest(std::string const& endpoint,
+                                     network::RequestOptions const& options,
+                                     fuerte::Request& req) {
+  if (options.compression == network::Compression::kNone) {
+    return;
+  }
+  bool const bulk = options.compression == network::Compression::kBulk;
+  uint64_t threshold =
+      bulk ? _compressionThresholdBulk : _compressionThresholdFast;
+  if (threshold == 0 ||
+      req.header.meta().contains(StaticStrings::ContentEncoding)) {
+    // disabled, or the body is already compressed (e.g. when retrying)
+    return;
+  }
+
+  auto& peer = peerCompression(endpoint);
+  if (!bulk && !peer.supportsLz4.load(std::memory_order_relaxed)) {
+    // ask the peer whether it can decode lz4. until it has answered, the
+    // body is sent uncompressed
+    req.header.addMeta(StaticStrings::XArangoAcceptEncoding,
+                       StaticStrings::EncodingArangoLz4);
+    return;
+  }
+
+  std::size_t size = req.payloadSize();
+  if (size < threshold) {
+    return;
+  }
+  auto payload = req.payload();
+  auto const* data = static_cast<uint8_t const*>(payload.data());
+  velocypack::Buffer<uint8_t> compressed;
+  auto r = bulk ? encoding::gzipDeflate(data, size, compressed)
+                : encoding::lz4Compress(data, size, compressed);
+  if (r != TRI_ERROR_NO_ERROR || compressed.size() >= size) {
+    // not compressible, send the original body
+    return;
+  }
+  peer.uncompressedBytes.count(size);
+  peer.compressedBytes.count(compressed.size());
+  req.header.addMeta(StaticStrings::ContentEncoding,
+                     bulk ? StaticStrings::EncodingDeflate
+                          : StaticStrings::EncodingArangoLz4);
+  req.setPayload(std::move(compressed));
+}
+
+void NetworkFeature::finishCoalescedRequests(std::string const& key,
+                                             fuerte::Error err,
+                                             fuerte::Response const* res,
+                                             bool isFromPool) noexcept {
+  decltype(_coalescedRequests)::mapped_type waiting;
+  {
+    std::lock_guard guard(_coalescingMutex);
+    auto it = _coalescedRequests.find(key);
+    if (it == _coalescedRequests.end()) {
+      return;
+    }
+    waiting = std::move(it->second);
+    _coalescedRequests.erase(it);
+  }
+
+  for (auto& [req, cb] : waiting) {
+    std::unique_ptr<fuerte::Response> copy;
+    fuerte::Error error = err;
+    if (res != nullptr) {
+      try {
+        copy = copyResponse(*res);
+      } catch (...) {
+        // out of memory. we must still call the callback
+        error = fuerte::Error::ProtocolError;
+      }
+    }
+    try {
+      cb(error, std::move(req), std::move(copy), isFromPool);
+    } catch (std::exception const& ex) {
+      LOG_TOPIC("6c2e8", WARN, Logger::COMMUNICATION)
+          << "caught exception while finishing coalesced request: "
+          << ex.what();
+    }
+  }
+}
+
 void NetworkFeature::prepareRequest(network::ConnectionPool const& pool,
                                     std::unique_ptr<fuerte::Request>& req) {
   _requestsInFlight += 1;
@@ -25,10 +25,15 @@
 
 #include <atomic>
 #include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 
 #include <fuerte/requests.h>
 
 #include "Network/ConnectionPool.h"
+#include "Network/ServerLatencyTracker.h"
 #include "Metrics/Fwd.h"
 #include "RestServer/arangod.h"
 #include "Scheduler/Scheduler.h"
@@ -88,6 +93,26 @@ class NetworkFeature final : public ArangodFeature {
   void retryRequest(std::shared_ptr<network::RetryableRequest>, RequestLane,
                     std::chrono::steady_clock::duration);
 
+  /// @brief whether latencies of requests to other servers are tracked
+  bool trackServerLatencies() const noexcept {
+    return _adaptiveReplicaSelection || _hedgeFollowerReads;
+  }
+  /// @brief choose replicas for reads from followers based on their latency
+  bool adaptiveReplicaSelection() const noexcept {
+    return _adaptiveReplicaSelection;
+  }
+  /// @brief send reads from followers to a second replica if the first one
+  /// does not respond in time
+  bool hedgeFollowerReads() const noexcept { return _hedgeFollowerReads; }
+  std::chrono::milliseconds hedgeMinDelay() const noexcept {
+    return std::chrono::milliseconds(_hedgeMinDelay);
+  }
+  network::ServerLatencyTracker& latencyTracker() noexcept {
+    return _latencyTracker;
+  }
+  /// @brief increase the counter for hedged requests
+  void trackHedgedRequest() noexcept;
+
  protected:
   void prepareRequest(network::ConnectionPool const& pool,
                       std::unique_ptr<fuerte::Request>& req);
@@ -95,6 +120,32 @@ class NetworkFeature final : public ArangodFeature {
                      std::unique_ptr<fuerte::Request> const& req,
                      std::unique_ptr<fuerte::Response>& res);
 
+ private:
+  /// @brief compression state and statistics for one peer endpoint
+  struct PeerCompression {
+    PeerCompression(metrics::Counter& uncompressed,
+                    metrics::Counter& compressed)
+        : uncompressedBytes(uncompressed), compressedBytes(compressed) {}
+
+    // whether the peer has announced that it can decode lz4 bodies
+    std::atomic<bool> supportsLz4{false};
+    metrics::Counter& uncompressedBytes;
+    metrics::Counter& compressedBytes;
+  };
+  PeerCompression& peerCompression(std::string const& endpoint);
+
+  /// @brief compress the request body according to the request options and
+  /// the compression thresholds
+  void compressRequest(std::string const& endpoint,
+                       network::RequestOptions const& options,
+                       fuerte::Request& req);
+
+  /// @brief hand out copies of the response to all requests that were
+  /// coalesced into the request with the given key
+  void finishCoalescedRequests(std::string const& key, fuerte::Error err,
+                               fuerte::Response const* res,
+                               bool isFromPool) noexcept;
+
  private:
   std::string _protocol;
   uint64_t _maxOpenConnections;
@@ -102,12 +153,19 @@ class NetworkFeature final : public ArangodFeature {
   uint32_t _numIOThreads;
   bool _verifyHosts;
   std::atomic<bool> _prepared;
+  bool _adaptiveReplicaSelection;
+  bool _hedgeFollowerReads;
+  uint64_t _hedgeMinDelay;
+  uint64_t _compressionThresholdFast;
+  uint64_t _compressionThresholdBulk;
 
   std::mutex _workItemMutex;
   Scheduler::WorkHandle _workItem;
   /// @brief where rhythm is life, and life is rhythm :)
   std::function<void(bool)> _gcfunc;
 
+  network::ServerLatencyTracker _latencyTracker;
+
   std::unique_ptr<network::ConnectionPool> _pool;
   std::atomic<network::ConnectionPool*> _poolPtr;
 
@@ -115,6 +173,18 @@ class NetworkFeature final : public ArangodFeature {
                      Scheduler::WorkHandle>
       _retryRequests;
 
+  /// @brief requests waiting for the response of an identical request that
+  /// is currently in flight, keyed by the request's coalescing key
+  std::mutex _coalescingMutex;
+  std::unordered_map<
+      std::string,
+      std::vector<std::pair<std::unique_ptr<fuerte::Request>, RequestCallback>>>
+      _coalescedRequests;
+
+  std::mutex _compressionMutex;
+  std::unordered_map<std::string, std::unique_ptr<PeerCompression>>
+      _peerCompression;
+
   /// @brief number of cluster-internal forwarded requests
   /// (from one coordinator to another, in case load-balancing
   /// is used)
@@ -124,6 +194,8 @@ class NetworkFeature final : public ArangodFeature {
   metrics::Gauge<std::uint64_t>& _requestsInFlight;
 
   metrics::Counter& _requestTimeouts;
+  metrics::Counter& _coalescedRequestsTotal;
+  metrics::Counter& _hedgedRequestsTotal;
   metrics::Histogram<metrics::FixScale<double>>& _requestDurations;
 
   metrics::Counter& _unfinishedSends;
@@ -0,0 +1,119 @@
+////////////////////////////////////////////////////////////////////////////////
+/// DISCLAIMER
+///
+/// Copyright 2014-2023 ArangoDB GmbH, Cologne, Germany
+/// Copyright 2004-2014 triAGENS GmbH, Cologne, Germany
+///
+/// Licensed under the Apache License, Version 2.0 (the "License");
+/// you may not use this file except in compliance with the License.
+/// You may obtain a copy of the License at
+///
+///     http://www.apache.org/licenses/LICENSE-2.0
+///
+/// Unless required by applicable law or agreed to in writing, software
+/// distributed under the License is distributed on an "AS IS" BASIS,
+/// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+/// See the License for the specific language governing permissions and
+/// limitations under the License.
+///
+/// Copyright holder is ArangoDB GmbH, Cologne, Germany
+///
+/// @author Jan Steemann
+////////////////////////////////////////////////////////////////////////////////
+
+#include "ServerLatencyTracker.h"
+
+#include "Basics/debugging.h"
+
+#include <algorithm>
+#include <cmath>
+
+using namespace arangodb;
+using namespace arangodb::network;
+
+namespace {
+// weights of new samples, as recommended by RFC 6298
+constexpr double kLatencyWeight = 0.125;
+constexpr double kDeviationWeight = 0.25;
+}  // namespace
+
+void ServerLatencyTracker::requestStarted(std::string_view serverId) {
+  std::lock_guard guard{_mutex};
+  auto it = _entries.find(serverId);
+  if (it == _entries.end()) {
+    it = _entries.try_emplace(std::string{serverId}).first;
+  }
+  ++it->second.inFlight;
+}
+
+void ServerLatencyTracker::requestFinished(std::string_view serverId,
+                                           clock::duration latency,
+                                           bool failed) {
+  if (failed) {
+    latency = std::max(latency, kFailurePenalty);
+  }
+  double sample = std::chrono::duration<double, std::micro>(latency).count();
+
+  std::lock_guard guard{_mutex};
+  auto it = _entries.find(serverId);
+  if (it == _entries.end()) {
+    it = _entries.try_emplace(std::string{serverId}).first;
+  }
+  Entry& entry = it->second;
+  if (entry.inFlight > 0) {
+    --entry.inFlight;
+  }
+  if (!entry.hasSamples) {
+    entry.latency = sample;
+    entry.deviation = sample / 2.0;
+    entry.hasSamples = true;
+  } else {
+    entry.deviation += kDeviationWeight *
+                       (std::abs(sample - entry.latency) - entry.deviation);
+    entry.latency += kLatencyWeight * (sample - entry.latency);
+  }
+}
+
+double ServerLatencyTracker::score(std::string_view serverId) const {
+  std::lock_guard guard{_mutex};
+  return scoreNolock(serverId);
+}
+
+std::size_t ServerLatencyTracker::chooseFastest(
+    std::vector<std::string> const& candidates) const {
+  TRI_ASSERT(!candidates.empty());
+  std::size_t best = 0;
+  std::lock_guard guard{_mutex};
+  double bestScore = scoreNolock(candidates[0]);
+  for (std::size_t i = 1; i < candidates.size(); ++i) {
+    double s = scoreNolock(candidates[i]);
+    if (s < bestScore) {
+      best = i;
+      bestScore = s;
+    }
+  }
+  return best;
+}
+
+ServerLatencyTracker::clock::duration
+ServerLatencyTracker::estimatedP95Latency(std::string_view serverId) const {
+  std::lock_guard guard{_mutex};
+  auto it = _entries.find(serverId);
+  if (it == _entries.end() || !it->second.hasSamples) {
+    return clock::duration::zero();
+  }
+  double micros = it->second.latency + 2.0 * it->second.deviation;
+  return std::chrono::duration_cast<clock::duration>(
+      std::chrono::duration<double, std::micro>(micros));
+}
+
+double ServerLatencyTracker::scoreNolock(std::string_view serverId) const {
+  auto it = _entries.find(serverId);
+  if (it == _entries.end()) {
+    return 1.0;
+  }
+  // requests that are queued on a server will have to wait for the requests
+  // in front of them, so the expected latency grows with the queue depth
+  double latency = it->second.hasSamples ? it->second.latency : 0.0;
+  return (latency + 1.0) * static_cast<double>(it->second.inFlight + 1);
+}
@@ -0,0 +1,85 @@
+////////////////////////////////////////////////////////////////////////////////
+/// DISCLAIMER
+///
+/// Copyright 2014-2023 ArangoDB GmbH, Cologne, Germany
+/// Copyright 2004-2014 triAGENS GmbH, Cologne, Germany
+///
+/// Licensed under the Apache License, Version 2.0 (the "License");
+/// you may not use this file except in compliance with the License.
+/// You may obtain a copy of the License at
+///
+///     http://www.apache.org/licenses/LICENSE-2.0
+///
+/// Unless required by applicable law or agreed to in writing, software
+/// distributed under the License is distributed on an "AS IS" BASIS,
+/// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+/// See the License for the specific language governing permissions and
+/// limitations under the License.
+///
+/// Copyright holder is ArangoDB GmbH, Cologne, Germany
+///
+/// @author Jan Steemann
+////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "Containers/FlatHashMap.h"
+
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace arangodb::network {
+
+/// @brief keeps track of the response latencies and the number of requests
+/// in flight for every server we are sending requests to. this is used to
+/// send reads from followers to the replica that currently responds fastest,
+/// and to decide when a read is hedged by sending it to another replica.
+/// latencies are tracked as exponentially weighted moving averages of the
+/// round-trip time and of its mean deviation, in the same way as TCP
+/// estimates its retransmission timeout (RFC 6298).
+class ServerLatencyTracker {
+ public:
+  using clock = std::chrono::steady_clock;
+
+  /// @brief latency recorded for requests that failed with a connection
+  /// error, so that unreachable servers are avoided
+  static constexpr clock::duration kFailurePenalty = std::chrono::seconds(1);
+
+  void requestStarted(std::string_view serverId);
+  void requestFinished(std::string_view serverId, clock::duration latency,
+                       bool failed);
+
+  /// @brief score of a server, lower is better. servers we have not sent
+  /// any requests to yet get a low score, so that they are tried
+  double score(std::string_view serverId) const;
+
+  /// @brief returns the index of the candidate with the lowest score.
+  /// candidates must not be empty
+  std::size_t chooseFastest(std::vector<std::string> const& candidates) const;
+
+  /// @brief estimation of the 95th percentile of the server's latency. this
+  /// is the mean plus two mean deviations, which is close to the 95th
+  /// percentile for normally distributed latencies. returns zero if there
+  /// are no samples for the server yet
+  clock::duration estimatedP95Latency(std::string_view serverId) const;
+
+ private:
+  struct Entry {
+    // moving averages, in microseconds
+    double latency = 0.0;
+    double deviation = 0.0;
+    std::uint64_t inFlight = 0;
+    bool hasSamples = false;
+  };
+
+  double scoreNolock(std::string_view serverId) const;
+
+  mutable std::mutex _mutex;
+  containers::FlatHashMap<std::string, Entry> _entries;
+};
+
+}  // namespace arangodb::network
@@ -152,13 +152,13 @@ struct Actor : ActorBase, std::enable_shared_from_this<Actor<Runtime, Config>> {
     pushToQueueAndKick(std::make_unique<InternalMessage>(
         sender,
         std::make_unique<message::MessageOrError<typename Config::Message>>(
-            msg)));
+            std::move(msg))));
   }
   void push(ActorPID sender, message::ActorError&& msg) {
     pushToQueueAndKick(std::make_unique<InternalMessage>(
         sender,
         std::make_unique<message::MessageOrError<typename Config::Message>>(
-            msg)));
+            std::move(msg))));
   }
 
   void kick() {
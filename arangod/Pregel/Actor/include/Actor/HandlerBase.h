@@ -40,7 +40,7 @@ struct HandlerBase {
 
   template<typename ActorMessage>
   auto dispatch(ActorPID receiver, ActorMessage message) -> void {
-    runtime->dispatch(self, receiver, message);
+    runtime->dispatch(self, receiver, std::move(message));
   }
 
   template<typename ActorMessage>
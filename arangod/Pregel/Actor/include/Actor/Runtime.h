@@ -125,11 +125,14 @@ struct Runtime
     }
   }
 
+  // messages to actors on the same server are handed over as they are,
+  // without a serialization roundtrip. the message is taken by value so that
+  // callers can move it all the way into the receiver's inbox
   template<typename ActorMessage>
-  auto dispatch(ActorPID sender, ActorPID receiver, ActorMessage const& message)
+  auto dispatch(ActorPID sender, ActorPID receiver, ActorMessage message)
       -> void {
     if (receiver.server == sender.server) {
-      dispatchLocally(sender, receiver, message);
+      dispatchLocally(sender, receiver, std::move(message));
     } else {
       dispatchExternally(sender, receiver, message);
     }
@@ -139,10 +142,10 @@ struct Runtime
   auto dispatchDelayed(std::chrono::seconds delay, ActorPID sender,
                        ActorPID receiver, ActorMessage const& message) -> void {
     scheduler->delay(delay, [self = this->weak_from_this(), sender, receiver,
-                             message](bool canceled) {
+                             message](bool canceled) mutable {
       auto me = self.lock();
       if (me != nullptr) {
-        me->dispatch(sender, receiver, message);
+        me->dispatch(sender, receiver, std::move(message));
       }
     });
   }
@@ -187,7 +190,7 @@ struct Runtime
  private:
   template<typename ActorMessage>
   auto dispatchLocally(ActorPID sender, ActorPID receiver,
-                       ActorMessage const& message) -> void {
+                       ActorMessage message) -> void {
     auto actor = actors.find(receiver.id);
     auto payload = MessagePayload<ActorMessage>(std::move(message));
     if (actor.has_value()) {
@@ -57,15 +57,28 @@ struct MyComputation : public VertexComputation<uint64_t, uint8_t, uint64_t> {
 };
 
 struct MyGraphFormat final : public VertexGraphFormat<uint64_t, uint8_t> {
-  explicit MyGraphFormat(std::string const& result)
-      : VertexGraphFormat<uint64_t, uint8_t>(result, /*vertexNull*/ 0) {}
+  MyGraphFormat(std::string const& result, std::string const& seed)
+      : VertexGraphFormat<uint64_t, uint8_t>(result, /*vertexNull*/ 0),
+        _seedField(seed) {}
 
   void copyVertexData(arangodb::velocypack::Options const&,
                       std::string const& /*documentId*/,
-                      arangodb::velocypack::Slice /*document*/,
+                      arangodb::velocypack::Slice document,
                       uint64_t& targetPtr, uint64_t vertexId) const override {
+    if (!_seedField.empty()) {
+      // component computed by an earlier run
+      VPackSlice seed = document.get(_seedField);
+      if (seed.isNumber<uint64_t>()) {
+        targetPtr = seed.getNumber<uint64_t>();
+        return;
+      }
+    }
     targetPtr = vertexId;
   }
+
+ private:
+  // empty if the components are not seeded
+  std::string const _seedField;
 };
 
 struct MyCompensation : public VertexCompensation<uint64_t, uint8_t, uint64_t> {
@@ -90,7 +103,8 @@ ConnectedComponents::createComputation(
 
 std::shared_ptr<GraphFormat<uint64_t, uint8_t> const>
 ConnectedComponents::inputFormat() const {
-  return std::make_shared<MyGraphFormat>(_resultField);
+  return std::make_shared<MyGraphFormat>(
+      _resultField, _useSource ? _sourceField : std::string());
 }
 
 VertexCompensation<uint64_t, uint8_t, uint64_t>*
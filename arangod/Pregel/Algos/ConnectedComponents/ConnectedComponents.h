@@ -38,11 +38,17 @@ struct ConnectedComponentsType {
 /// number of supersteps necessary is equal to the length of the maximum
 /// diameter of all components + 1
 /// doesn't necessarily leads to a correct result on unidirected graphs
+/// if `sourceField` is set, the components are seeded with the values of
+/// this attribute, e.g. the result of an earlier run. if the graph has only
+/// grown since then, only the new edges cause further propagation. removed
+/// vertices or edges can split components, which a seeded run does not
+/// detect
 struct ConnectedComponents
     : public SimpleAlgorithm<uint64_t, uint8_t, uint64_t> {
  public:
   explicit ConnectedComponents(VPackSlice userParams)
-      : SimpleAlgorithm(userParams) {}
+      : SimpleAlgorithm(userParams),
+        _useSource(userParams.hasKey("sourceField")) {}
 
   [[nodiscard]] auto name() const -> std::string_view override {
     return "connectedcomponents";
@@ -88,5 +94,8 @@ struct ConnectedComponents
       std::unique_ptr<AggregatorHandler> aggregators,
       arangodb::velocypack::Slice userParams) const
       -> std::unique_ptr<MasterContext> override;
+
+ private:
+  bool const _useSource;
 };
 }  // namespace arangodb::pregel::algos
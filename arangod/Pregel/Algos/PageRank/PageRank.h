@@ -86,5 +86,7 @@ struct PageRank : public SimpleAlgorithm<float, float, float> {
 
  private:
   bool const _useSource;
+  // propagate rank changes only, see DeltaPRComputation
+  bool const _useDelta;
 };
 }  // namespace arangodb::pregel::algos
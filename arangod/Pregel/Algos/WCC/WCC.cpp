@@ -132,10 +132,14 @@ struct WCCComputation
 };
 
 struct WCCGraphFormat final : public GraphFormat<WCCValue, uint64_t> {
-  explicit WCCGraphFormat(std::string const& result)
-      : GraphFormat<WCCValue, uint64_t>(), _resultField(result) {}
+  WCCGraphFormat(std::string const& result, std::string const& seed)
+      : GraphFormat<WCCValue, uint64_t>(),
+        _resultField(result),
+        _seedField(seed) {}
 
   std::string const _resultField;
+  // empty if the components are not seeded
+  std::string const _seedField;
 
   size_t estimatedVertexSize() const override {
     // This is a very rough and guessed estimate.
@@ -149,6 +153,14 @@ struct WCCGraphFormat final : public GraphFormat<WCCValue, uint64_t> {
                       std::string const& documentId,
                       arangodb::velocypack::Slice document, WCCValue& targetPtr,
                       uint64_t vertexId) const override {
+    if (!_seedField.empty()) {
+      // component computed by an earlier run
+      VPackSlice seed = document.get(_seedField);
+      if (seed.isNumber<uint64_t>()) {
+        targetPtr.component = seed.getNumber<uint64_t>();
+        return;
+      }
+    }
     targetPtr.component = vertexId;
   }
 
@@ -173,7 +185,8 @@ WCC::createComputation(std::shared_ptr<WorkerConfig const> config) const {
 
 std::shared_ptr<GraphFormat<WCCValue, uint64_t> const> WCC::inputFormat()
     const {
-  return std::make_shared<::WCCGraphFormat>(_resultField);
+  return std::make_shared<::WCCGraphFormat>(
+      _resultField, _useSource ? _sourceField : std::string());
 }
 
 struct WCCWorkerContext : public WorkerContext {
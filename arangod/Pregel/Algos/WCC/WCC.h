@@ -34,6 +34,8 @@ namespace arangodb::pregel::algos {
 /// vertex id along the edges to all vertices of a connected component. The
 /// number of supersteps necessary is equal to the length of the maximum
 /// diameter of all components + 1
+/// if `sourceField` is set, the components are seeded with the values of
+/// this attribute, see ConnectedComponents
 
 struct WCCType {
   using Vertex = WCCValue;
@@ -44,7 +46,9 @@ struct WCCType {
 struct WCC
     : public SimpleAlgorithm<WCCValue, uint64_t, SenderMessage<uint64_t>> {
  public:
-  explicit WCC(VPackSlice userParams) : SimpleAlgorithm(userParams) {}
+  explicit WCC(VPackSlice userParams)
+      : SimpleAlgorithm(userParams),
+        _useSource(userParams.hasKey("sourceField")) {}
 
   [[nodiscard]] auto name() const -> std::string_view override {
     return "wcc";
@@ -82,5 +86,8 @@ struct WCC
       std::unique_ptr<AggregatorHandler> aggregators,
       arangodb::velocypack::Slice userParams) const
       -> std::unique_ptr<MasterContext> override;
+
+ private:
+  bool const _useSource;
 };
 }  // namespace arangodb::pregel::algos
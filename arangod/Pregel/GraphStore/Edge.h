@@ -25,6 +25,7 @@
 
 #include <cstdint>
 #include <string>
+#include <string_view>
 
 #include "VertexID.h"
 
@@ -39,23 +40,32 @@ struct Edge {
   friend class GraphStore;
 
   Edge() = delete;
-  Edge(VertexID id, E&& data) : _to{id}, _data(std::move(data)) {}
+  // the key is not copied. it must point into memory that outlives the
+  // edge, e.g. the key storage of the quiver the edge belongs to
+  Edge(PregelShard toShard, std::string_view toKey, E&& data)
+      : _toKey(toKey), _toShard(toShard), _data(std::move(data)) {}
   Edge(Edge const&) = delete;
   Edge(Edge&&) = default;
   auto operator=(Edge const& other) -> Edge& = delete;
   auto operator=(Edge&& other) -> Edge& = default;
 
-  [[nodiscard]] std::string_view toKey() const { return _to.key; }
+  [[nodiscard]] std::string_view toKey() const noexcept { return _toKey; }
   E& data() noexcept { return _data; }
-  [[nodiscard]] PregelShard targetShard() const noexcept { return _to.shard; }
+  [[nodiscard]] PregelShard targetShard() const noexcept { return _toShard; }
+  [[nodiscard]] VertexID to() const {
+    return VertexID{_toShard, std::string(_toKey)};
+  }
 
-  VertexID _to;
+  std::string_view _toKey;
+  PregelShard _toShard;
   E _data;
 };
 
 template<typename E, typename Inspector>
 auto inspect(Inspector& f, Edge<E>& e) {
-  return f.object(e).fields(f.field("to", e._to), f.field("data", e._data));
+  return f.object(e).fields(f.field("key", e._toKey),
+                            f.field("shard", e._toShard),
+                            f.field("data", e._data));
 }
 
 }  // namespace arangodb::pregel
@@ -23,8 +23,10 @@
 
 #include "GraphLoader.h"
 
+#include <algorithm>
 #include <memory>
 #include <cstdint>
+#include <optional>
 #include <variant>
 
 #include "ApplicationFeatures/ApplicationServer.h"
@@ -54,6 +56,7 @@
 #include "Transaction/Options.h"
 #include "Transaction/StandaloneContext.h"
 #include "VocBase/LogicalCollection.h"
+#include "VocBase/ticks.h"
 
 #define LOG_PREGEL(logId, level)          \
   LOG_TOPIC(logId, level, Logger::PREGEL) \
@@ -75,9 +78,11 @@ auto GraphLoader<V, E>::requestVertexIds(uint64_t numVertices)
       ADB_PROD_ASSERT(false) << "ClusterFeature not present in server";
     }
   } else {
-    uint64_t base = currentIdBase.load();
-    while (!currentIdBase.compare_exchange_strong(base, base + numVertices)) {
-    };
+    // take the ids from the server tick, so that, like in the cluster,
+    // they are not handed out again during the lifetime of the server.
+    // this allows to seed a run with the vertex ids computed by an earlier
+    // run, e.g. connected components
+    uint64_t base = TRI_NewTickServerRange(numVertices + 1);
     return VertexIdRange{.current = base, .maxId = base + numVertices};
   }
   ADB_PROD_ASSERT(false);
@@ -92,6 +97,13 @@ auto GraphLoader<V, E>::load() -> futures::Future<Magazine<V, E>> {
   auto const myLoadableVertexShards =
       config->graphSerdeConfig().loadableVertexShardsForServer(server);
 
+  edgeShardUsage.clear();
+  for (auto const& loadableVertexShard : myLoadableVertexShards) {
+    for (auto const& edgeShard : loadableVertexShard.edgeShards) {
+      ++edgeShardUsage[edgeShard];
+    }
+  }
+
   auto loadableShardIdx = std::make_shared<std::atomic<size_t>>(0);
   auto futures = std::vector<futures::Future<Magazine<V, E>>>{};
   auto self = this->shared_from_this();
@@ -195,21 +207,34 @@ auto GraphLoader<V, E>::loadVertices(LoadableVertexShard loadableVertexShard)
   std::vector<std::unique_ptr<traverser::EdgeCollectionInfo>>
       edgeCollectionInfos;
   edgeCollectionInfos.reserve(edgeShards.size());
+  // the edges of each edge shard that is scanned as a whole, see
+  // edgeShardUsage
+  std::vector<std::optional<std::vector<ScannedEdge>>> scannedEdges;
+  scannedEdges.reserve(edgeShards.size());
 
   for (ShardID const& edgeShard : edgeShards) {
-    edgeCollectionInfos.emplace_back(
-        std::make_unique<traverser::EdgeCollectionInfo>(resourceMonitor, &trx,
-                                                        edgeShard));
+    if (auto it = edgeShardUsage.find(edgeShard);
+        it != edgeShardUsage.end() && it->second == 1) {
+      edgeCollectionInfos.emplace_back(nullptr);
+      scannedEdges.emplace_back(scanEdges(trx, *result, edgeShard));
+      LOG_PREGEL("5b1d4", DEBUG)
+          << "Scanned " << scannedEdges.back()->size() << " edges of shard '"
+          << edgeShard << "'";
+    } else {
+      edgeCollectionInfos.emplace_back(
+          std::make_unique<traverser::EdgeCollectionInfo>(resourceMonitor,
+                                                          &trx, edgeShard));
+      scannedEdges.emplace_back(std::nullopt);
+    }
   }
 
   std::string documentId;  // temp buffer for _id of vertex
   auto cb = [&](LocalDocumentId const& token, VPackSlice slice) {
     Vertex<V, E> ventry;
     auto keySlice = transaction::helpers::extractKeyFromDocument(slice);
-    auto key = keySlice.copyString();
 
     ventry.setShard(sourceShard);
-    ventry.setKey(key.c_str(), key.size());
+    ventry.setKey(result->storeKey(keySlice.stringView()));
     ventry.setActive(true);
 
     // load vertex data
@@ -228,8 +253,11 @@ auto GraphLoader<V, E>::loadVertices(LoadableVertexShard loadableVertexShard)
 
     // load edges
     for (std::size_t i = 0; i < edgeShards.size(); ++i) {
-      auto& info = *edgeCollectionInfos[i];
-      loadEdges(trx, ventry, documentId, info);
+      if (scannedEdges[i].has_value()) {
+        addScannedEdges(*result, *scannedEdges[i], documentId);
+      } else {
+        loadEdges(trx, *result, documentId, *edgeCollectionInfos[i]);
+      }
     }
     result->emplace(std::move(ventry));
     return true;
@@ -257,9 +285,70 @@ auto GraphLoader<V, E>::loadVertices(LoadableVertexShard loadableVertexShard)
   return result;
 }
 
+template<typename V, typename E>
+auto GraphLoader<V, E>::scanEdges(transaction::Methods& trx,
+                                  Quiver<V, E>& quiver,
+                                  ShardID const& edgeShard)
+    -> std::vector<ScannedEdge> {
+  std::vector<ScannedEdge> edges;
+
+  auto cursor =
+      trx.indexScan(resourceMonitor, edgeShard,
+                    transaction::Methods::CursorType::ALL, ReadOwnWrites::no);
+  bool const copyData = graphFormat->estimatedEdgeSize() > 0;
+  while (cursor->nextDocument(
+      [&](LocalDocumentId const& /*token*/, VPackSlice slice) {
+        slice = slice.resolveExternal();
+        std::string_view fromValue =
+            transaction::helpers::extractFromFromDocument(slice).stringView();
+        std::string_view toValue =
+            transaction::helpers::extractToFromDocument(slice).stringView();
+        auto toVertexID = config->documentIdToPregel(toValue);
+
+        auto& edge = edges.emplace_back(
+            ScannedEdge{.from = std::string(fromValue),
+                        .toShard = toVertexID.shard,
+                        .toKey = quiver.storeKey(toVertexID.key),
+                        .data = {}});
+        if (copyData) {
+          graphFormat->copyEdgeData(
+              *trx.transactionContext()->getVPackOptions(), slice, edge.data);
+        }
+        return true;
+      },
+      batchSize)) {
+    if (config->vocbase()->server().isStopping()) {
+      LOG_PREGEL("e2f7a", WARN) << "Aborting graph loading";
+      break;
+    }
+  }
+
+  // group the edges by their source vertex. the sort is stable, so that the
+  // edges of a vertex keep the order in which they are stored
+  std::stable_sort(edges.begin(), edges.end(),
+                   [](ScannedEdge const& lhs, ScannedEdge const& rhs) {
+                     return lhs.from < rhs.from;
+                   });
+  return edges;
+}
+
+template<typename V, typename E>
+auto GraphLoader<V, E>::addScannedEdges(Quiver<V, E>& quiver,
+                                        std::vector<ScannedEdge>& edges,
+                                        std::string_view documentID) -> void {
+  auto it = std::lower_bound(
+      edges.begin(), edges.end(), documentID,
+      [](ScannedEdge const& edge, std::string_view id) {
+        return std::string_view(edge.from) < id;
+      });
+  for (; it != edges.end() && it->from == documentID; ++it) {
+    quiver.addEdge(Edge<E>(it->toShard, it->toKey, std::move(it->data)));
+  }
+}
+
 template<typename V, typename E>
 void GraphLoader<V, E>::loadEdges(transaction::Methods& trx,
-                                  Vertex<V, E>& vertex,
+                                  Quiver<V, E>& quiver,
                                   std::string_view documentID,
                                   traverser::EdgeCollectionInfo& info) {
   auto cursor = info.getEdges(std::string{documentID});
@@ -274,7 +363,8 @@ void GraphLoader<V, E>::loadEdges(transaction::Methods& trx,
               covering.at(info.coveringPosition()).stringView();
           auto toVertexID = config->documentIdToPregel(toValue);
 
-          vertex.addEdge(Edge<E>(toVertexID, {}));
+          quiver.addEdge(Edge<E>(toVertexID.shard,
+                                 quiver.storeKey(toVertexID.key), {}));
           return true;
         },
         1000)) { /* continue loading */
@@ -287,10 +377,11 @@ void GraphLoader<V, E>::loadEdges(transaction::Methods& trx,
               transaction::helpers::extractToFromDocument(slice).stringView();
           auto toVertexID = config->documentIdToPregel(toValue);
 
-          auto edge = Edge<E>(toVertexID, {});
+          auto edge = Edge<E>(toVertexID.shard,
+                              quiver.storeKey(toVertexID.key), {});
           graphFormat->copyEdgeData(
               *trx.transactionContext()->getVPackOptions(), slice, edge.data());
-          vertex.addEdge(std::move(edge));
+          quiver.addEdge(std::move(edge));
           return true;
         },
         1000)) { /* continue loading */
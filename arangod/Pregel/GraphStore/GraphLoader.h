@@ -25,6 +25,9 @@
 
 #include <memory>
 #include <functional>
+#include <string>
+#include <unordered_map>
+#include <vector>
 
 #include "Basics/GlobalResourceMonitor.h"
 #include "Basics/Guarded.h"
@@ -73,9 +76,28 @@ struct GraphLoader : GraphLoaderBase<V, E> {
         updateCallback(updateCallback) {}
   auto load() -> futures::Future<Magazine<V, E>> override;
 
+  // an edge read by scanEdges, not yet assigned to its source vertex
+  struct ScannedEdge {
+    std::string from;
+    PregelShard toShard;
+    std::string_view toKey;
+    E data;
+  };
+
   auto loadVertices(LoadableVertexShard loadableVertexShard)
       -> std::shared_ptr<Quiver<V, E>>;
-  auto loadEdges(transaction::Methods& trx, Vertex<V, E>& vertex,
+  // reads all edges of the edge shard in storage order and returns them
+  // sorted by their _from value. the target keys are stored in the quiver
+  auto scanEdges(transaction::Methods& trx, Quiver<V, E>& quiver,
+                 ShardID const& edgeShard) -> std::vector<ScannedEdge>;
+  // adds the edges from the result of scanEdges whose source is the vertex
+  // with the given document id to the quiver
+  auto addScannedEdges(Quiver<V, E>& quiver, std::vector<ScannedEdge>& edges,
+                       std::string_view documentID) -> void;
+  // adds the outgoing edges of the vertex with the given document id to
+  // the quiver. the vertex itself must be emplaced into the quiver
+  // afterwards
+  auto loadEdges(transaction::Methods& trx, Quiver<V, E>& quiver,
                  std::string_view documentID,
                  traverser::EdgeCollectionInfo& info) -> void;
 
@@ -85,7 +107,11 @@ struct GraphLoader : GraphLoaderBase<V, E> {
   std::shared_ptr<WorkerConfig const> config;
   LoadingUpdateCallback updateCallback;
 
-  std::atomic<uint64_t> currentIdBase;
+  // number of vertex shards loaded by this server that use an edge shard.
+  // edge shards that are used by a single vertex shard only are scanned
+  // once as a whole, all others are read via the edge index for every
+  // vertex. set up by load() before any shard is loaded
+  std::unordered_map<ShardID, size_t> edgeShardUsage;
 
   uint64_t const batchSize = 10000;
 };
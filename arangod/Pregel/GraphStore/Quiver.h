@@ -23,9 +23,18 @@
 
 #pragma once
 
+#include "Assertions/Assert.h"
 #include "Pregel/GraphStore/Edge.h"
 #include "Pregel/GraphStore/Vertex.h"
 
+#include <algorithm>
+#include <cstring>
+#include <iterator>
+#include <memory>
+#include <span>
+#include <string_view>
+#include <vector>
+
 namespace arangodb::pregel {
 
 /*
@@ -33,14 +42,71 @@ namespace arangodb::pregel {
  * stores vertices together with outgoing edges;
  * the reason for this is mostly for backwards-compatibility with other
  * Pregel code, and might change in future
+ *
+ * The edges of all vertices and all vertex and edge target keys are owned
+ * by the quiver. Edges are stored in large blocks, so that the edges of a
+ * vertex are contiguous in memory and the edges of consecutive vertices
+ * lie next to each other. The vertices only refer to their edges. Blocks
+ * are never resized after they have been allocated, so the references stay
+ * valid as long as the quiver exists.
  */
 template<typename V, typename E>
 struct Quiver {
   using VertexType = Vertex<V, E>;
   using EdgeType = Edge<E>;
 
+  // number of edges that are allocated in one go
+  static constexpr std::size_t kEdgesPerBlock = 16384;
+  // number of bytes that are allocated in one go for keys
+  static constexpr std::size_t kKeyBytesPerBlock = 64 * 1024;
+
+  // adds an outgoing edge to the vertex that is emplaced next.
+  // all edges of a vertex must be added before the vertex is emplaced
+  auto addEdge(EdgeType&& edge) -> void {
+    if (edgeBlocks.empty() ||
+        edgeBlocks.back().size() == edgeBlocks.back().capacity()) {
+      // the current block is full. start a new one and move over the
+      // edges of the current vertex, so that they stay contiguous
+      std::vector<EdgeType> block;
+      block.reserve(std::max(kEdgesPerBlock, 2 * pendingEdges));
+      if (pendingEdges > 0) {
+        auto& full = edgeBlocks.back();
+        auto first = full.end() - pendingEdges;
+        std::move(first, full.end(), std::back_inserter(block));
+        full.erase(first, full.end());
+      }
+      edgeBlocks.emplace_back(std::move(block));
+    }
+    edgeBlocks.back().emplace_back(std::move(edge));
+    ++pendingEdges;
+  }
+
+  // copies the key into the quiver's key storage and returns a view on
+  // the copy, which stays valid as long as the quiver exists
+  auto storeKey(std::string_view key) -> std::string_view {
+    if (key.empty()) {
+      return {};
+    }
+    if (keyBlocks.empty() || keyBlockSize - keyBlockUsed < key.size()) {
+      keyBlockSize = std::max(kKeyBytesPerBlock, key.size());
+      keyBlocks.emplace_back(new char[keyBlockSize]);
+      keyBlockUsed = 0;
+    }
+    char* p = keyBlocks.back().get() + keyBlockUsed;
+    std::memcpy(p, key.data(), key.size());
+    keyBlockUsed += key.size();
+    return {p, key.size()};
+  }
+
   auto emplace(VertexType&& v) -> void {
-    edgeCounter += v._edges.size();
+    TRI_ASSERT(v._edges.empty());
+    if (pendingEdges > 0) {
+      auto& block = edgeBlocks.back();
+      v._edges = std::span<EdgeType>(block.data() + block.size() - pendingEdges,
+                                     pendingEdges);
+    }
+    edgeCounter += pendingEdges;
+    pendingEdges = 0;
     vertices.emplace_back(std::move(v));
   }
   auto numberOfVertices() const -> size_t { return vertices.size(); }
@@ -54,6 +120,15 @@ struct Quiver {
 
   std::vector<VertexType> vertices;
   std::size_t edgeCounter{0};
+
+  std::vector<std::vector<EdgeType>> edgeBlocks;
+  // number of edges at the end of the last block which have been added for
+  // the vertex that is emplaced next
+  std::size_t pendingEdges{0};
+
+  std::vector<std::unique_ptr<char[]>> keyBlocks;
+  std::size_t keyBlockSize{0};
+  std::size_t keyBlockUsed{0};
 };
 
 template<typename V, typename E, typename Inspector>
@@ -25,8 +25,9 @@
 
 #include "Assertions/Assert.h"
 
+#include <span>
 #include <string>
-#include <vector>
+#include <string_view>
 
 #include "Edge.h"
 #include "VertexID.h"
@@ -41,16 +42,9 @@ struct Vertex {
   auto operator=(Vertex const& other) -> Vertex& = delete;
   auto operator=(Vertex&& other) -> Vertex& = default;
 
-  std::vector<Edge<E>>& getEdges() noexcept { return _edges; }
-  std::vector<Edge<E>>& getEdges() const noexcept { return _edges; }
-
-  size_t addEdge(Edge<E>&& edge) noexcept {
-    // must only be called during initial vertex creation
-    // cppcheck-suppress ignoredReturnValue
-    TRI_ASSERT(active());
-    _edges.emplace_back(std::move(edge));
-    return _edges.size();
-  }
+  // the edges are owned by the quiver the vertex is stored in, see
+  // Quiver::addEdge
+  std::span<Edge<E>> getEdges() const noexcept { return _edges; }
 
   // returns the number of associated edges
   [[nodiscard]] size_t getEdgeCount() const noexcept { return _edges.size(); }
@@ -64,19 +58,21 @@ struct Vertex {
 
   // TODO: maybe we should hence use the construtor to set them
   //       at creation time and not any time later
-  void setKey(char const* key, size_t keyLength) noexcept {
-    _key = std::string(key, keyLength);
-  }
+  // the key is not copied. it must point into memory that outlives the
+  // vertex, e.g. the key storage of the quiver, see Quiver::storeKey
+  void setKey(std::string_view key) noexcept { _key = key; }
 
-  [[nodiscard]] std::string_view key() const { return std::string_view(_key); }
+  [[nodiscard]] std::string_view key() const noexcept { return _key; }
   V const& data() const& { return _data; }
   V& data() & { return _data; }
 
-  [[nodiscard]] VertexID pregelId() const { return VertexID{_shard, _key}; }
+  [[nodiscard]] VertexID pregelId() const {
+    return VertexID{_shard, std::string(_key)};
+  }
 
-  std::string _key;
+  std::string_view _key;
   PregelShard _shard;
-  std::vector<Edge<E>> _edges;
+  std::span<Edge<E>> _edges;
   bool _active;
   V _data;
 };
@@ -85,7 +81,6 @@ template<typename V, typename E, typename Inspector>
 auto inspect(Inspector& f, Vertex<V, E>& v) {
   return f.object(v).fields(f.field("key", v._key), f.field("shard", v._shard),
                             f.field("active", v._active),
-                            f.field("edges", v._edges),
                             f.field("data", v._data));
 }
 
@@ -30,14 +30,18 @@
 #include "Pregel/Algos/DMID/DMIDMessage.h"
 #include "Pregel/Algos/EffectiveCloseness/HLLCounter.h"
 
+#include "Basics/FileUtils.h"
 #include "Basics/StaticStrings.h"
 #include "Basics/VelocyPackHelper.h"
 
 #include <velocypack/Iterator.h>
 
 #include <algorithm>
+#include <cstring>
+#include <optional>
 #include <random>
 #include <thread>
+#include <type_traits>
 
 using namespace arangodb;
 using namespace arangodb::pregel;
@@ -50,29 +54,38 @@ InCache<M>::InCache(MessageFormat<M> const* format)
 template<typename M>
 void InCache<M>::parseMessages(worker::message::PregelMessage const& message) {
   // every packet contains one shard
+  std::lock_guard<std::mutex> guard(this->_bucketLocker[message.shard]);
+  this->_containedMessageCount +=
+      _parse(message.shard, message.messages.slice());
+}
+
+template<typename M>
+uint64_t InCache<M>::_parse(PregelShard shard, VPackSlice messages) {
+  if (!messages.isEmptyArray() && messages.at(0).isBinary()) {
+    return _parseFixedWidth(shard, messages);
+  }
+
   VPackValueLength i = 0;
+  uint64_t count = 0;
   std::string_view key;
-  std::lock_guard<std::mutex> guard(this->_bucketLocker[message.shard]);
 
-  for (VPackSlice current : VPackArrayIterator(message.messages.slice())) {
+  for (VPackSlice current : VPackArrayIterator(messages)) {
     if (i % 2 == 0) {  // TODO support multiple recipients
       key = current.stringView();
     } else {
       TRI_ASSERT(!key.empty());
       if (current.isArray()) {
-        VPackValueLength c = 0;
         for (VPackSlice val : VPackArrayIterator(current)) {
           M newValue;
           _format->unwrapValue(val, newValue);
-          _set(message.shard, key, newValue);
-          c++;
+          _set(shard, key, newValue);
+          count++;
         }
-        this->_containedMessageCount += c;
       } else {
         M newValue;
         _format->unwrapValue(current, newValue);
-        _set(message.shard, key, newValue);
-        this->_containedMessageCount++;
+        _set(shard, key, newValue);
+        count++;
       }
     }
     i++;
@@ -83,6 +96,98 @@ void InCache<M>::parseMessages(worker::message::PregelMessage const& message) {
         TRI_ERROR_BAD_PARAMETER,
         "There must always be a multiple of 2 entries in message array");
   }
+  return count;
+}
+
+template<typename M>
+uint64_t InCache<M>::_parseFixedWidth(PregelShard shard, VPackSlice messages) {
+  // a binary value with all message values, followed by the keys of the
+  // receiving vertices, see combinedMessagesToVPack in OutgoingCache.cpp
+  if constexpr (std::is_arithmetic_v<M>) {
+    VPackArrayIterator it(messages);
+    VPackValueLength length;
+    uint8_t const* values = (*it).getBinary(length);
+    uint64_t count = messages.length() - 1;
+    if (length != count * sizeof(M)) {
+      THROW_ARANGO_EXCEPTION_MESSAGE(
+          TRI_ERROR_BAD_PARAMETER,
+          "Number of message values does not match number of keys");
+    }
+    it.next();
+    for (uint64_t i = 0; i < count; ++i, it.next()) {
+      M value;
+      std::memcpy(&value, values + i * sizeof(M), sizeof(M));
+      _set(shard, (*it).stringView(), value);
+    }
+    return count;
+  } else {
+    THROW_ARANGO_EXCEPTION_MESSAGE(
+        TRI_ERROR_BAD_PARAMETER,
+        "Binary messages are only supported for numeric message types");
+  }
+}
+
+template<typename M>
+void InCache<M>::spill(std::string const& filename) {
+  // the file contains an array of alternating shard ids and message
+  // arrays, which use the same format as incoming messages. the messages
+  // for a vertex are always written as an array, so that they can be read
+  // back unambiguously
+  VPackBuilder builder;
+  builder.openArray();
+  std::optional<PregelShard> currentShard;
+  std::string_view currentKey;
+  forEach([&](PregelShard shard, std::string_view const& key, M const& val) {
+    if (currentShard != shard || currentKey != key) {
+      if (currentShard.has_value()) {
+        builder.close();  // messages for vertex
+      }
+      if (currentShard != shard) {
+        if (currentShard.has_value()) {
+          builder.close();  // messages for shard
+        }
+        builder.add(VPackValue(static_cast<uint64_t>(shard.value)));
+        builder.openArray();
+        currentShard = shard;
+      }
+      builder.add(
+          VPackValuePair(key.data(), key.size(), VPackValueType::String));
+      builder.openArray();
+      currentKey = key;
+    }
+    _format->addValue(builder, val);
+  });
+  if (currentShard.has_value()) {
+    builder.close();
+    builder.close();
+  }
+  builder.close();
+
+  basics::FileUtils::spit(filename, builder.slice().startAs<char>(),
+                          builder.slice().byteSize());
+
+  // remove the messages from memory, but keep counting them
+  uint64_t count = _containedMessageCount;
+  clear();
+  _containedMessageCount = count;
+}
+
+template<typename M>
+void InCache<M>::restoreSpilled(std::string const& filename) {
+  std::string content = basics::FileUtils::slurp(filename);
+  VPackSlice data(reinterpret_cast<uint8_t const*>(content.data()));
+  TRI_ASSERT(data.isArray());
+  TRI_ASSERT(data.byteSize() == content.size());
+
+  VPackArrayIterator it(data);
+  while (it.valid()) {
+    PregelShard shard((*it).getNumber<PregelShard::value_type>());
+    it.next();
+    TRI_ASSERT(it.valid());
+    // the messages have been counted already when they were received
+    _parse(shard, *it);
+    it.next();
+  }
 }
 
 template<typename M>
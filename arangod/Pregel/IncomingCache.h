@@ -55,6 +55,10 @@ class InCache {
   /// Initialize format and mutex map.
   /// @param config can be null if you don't want locks
   explicit InCache(MessageFormat<M> const* format);
+  /// stores key and value pairs in the format produced by the outgoing
+  /// caches, returns the number of messages stored
+  uint64_t _parse(PregelShard shard, velocypack::Slice messages);
+  uint64_t _parseFixedWidth(PregelShard shard, velocypack::Slice messages);
   virtual void _set(PregelShard shard, std::string_view const& vertexId,
                     M const& data) = 0;
 
@@ -66,6 +70,14 @@ class InCache {
 
   void parseMessages(worker::message::PregelMessage const& messages);
 
+  /// @brief write all messages into the file and remove them from memory.
+  /// the messages still count as contained messages, so that the file
+  /// must be read back via restoreSpilled before the messages are used.
+  /// DOES NOT LOCK
+  void spill(std::string const& filename);
+  /// @brief read back messages written by spill. DOES NOT LOCK
+  void restoreSpilled(std::string const& filename);
+
   /// @brief Store a single message.
   /// Only ever call when you are sure this is a thread local store
   void storeMessageNoLock(PregelShard shard, std::string_view vertexId,
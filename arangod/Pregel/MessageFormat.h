@@ -37,6 +37,10 @@ struct MessageFormat {
   virtual ~MessageFormat() = default;
   virtual void unwrapValue(VPackSlice body, M& value) const = 0;
   virtual void addValue(VPackBuilder& arrayBuilder, M const& val) const = 0;
+  /// @brief whether messages can be sent in their in-memory representation
+  /// instead of as one VelocyPack value each. only sensible for numeric
+  /// message types
+  virtual bool isFixedWidth() const { return false; }
 };
 
 template<typename T>
@@ -53,6 +57,7 @@ struct IntegerMessageFormat : public MessageFormat<T> {
   void addValue(VPackBuilder& arrayBuilder, T const& val) const override {
     arrayBuilder.add(VPackValue(val));
   }
+  bool isFixedWidth() const override { return true; }
 };
 
 /*
@@ -86,6 +91,7 @@ struct NumberMessageFormat : public MessageFormat<M> {
   void addValue(VPackBuilder& arrayBuilder, M const& val) const override {
     arrayBuilder.add(VPackValue(val));
   }
+  bool isFixedWidth() const override { return true; }
 };
 }  // namespace pregel
 }  // namespace arangodb
@@ -46,10 +46,56 @@
 
 #include <velocypack/Iterator.h>
 
+#include <type_traits>
+#include <vector>
+
 using namespace arangodb;
 using namespace arangodb::pregel;
 using namespace arangodb::pregel::algos;
 
+namespace {
+// combined messages of numeric types are sent in a compact layout: one
+// binary value containing the in-memory representation of all messages,
+// followed by the keys of the receiving vertices in the same order. all
+// other messages are sent as alternating keys and values. see
+// InCache::_parse
+template<typename M>
+auto combinedMessagesToVPack(
+    containers::NodeHashMap<std::string_view, M> const& messagesForVertices,
+    MessageFormat<M> const& format) -> VPackBuilder {
+  VPackBuilder messagesVPack;
+  {
+    VPackArrayBuilder ab(&messagesVPack);
+    bool done = false;
+    if constexpr (std::is_arithmetic_v<M>) {
+      if (format.isFixedWidth()) {
+        std::vector<M> values;
+        values.reserve(messagesForVertices.size());
+        for (auto const& [vertex, message] : messagesForVertices) {
+          values.push_back(message);
+        }
+        messagesVPack.add(VPackValuePair(
+            reinterpret_cast<uint8_t const*>(values.data()),
+            values.size() * sizeof(M), VPackValueType::Binary));
+        for (auto const& [vertex, message] : messagesForVertices) {
+          messagesVPack.add(VPackValuePair(vertex.data(), vertex.size(),
+                                           VPackValueType::String));
+        }
+        done = true;
+      }
+    }
+    if (!done) {
+      for (auto const& [vertex, message] : messagesForVertices) {
+        messagesVPack.add(VPackValuePair(vertex.data(), vertex.size(),
+                                         VPackValueType::String));  // key
+        format.addValue(messagesVPack, message);                    // value
+      }
+    }
+  }
+  return messagesVPack;
+}
+}  // namespace
+
 template<typename M>
 OutCache<M>::OutCache(std::shared_ptr<WorkerConfig const> state,
                       containers::FlatHashSet<PregelShard> localShards,
@@ -190,16 +236,7 @@ template<typename M>
 auto CombiningOutCache<M>::messagesToVPack(
     containers::NodeHashMap<std::string_view, M> const& messagesForVertices)
     -> VPackBuilder {
-  VPackBuilder messagesVPack;
-  {
-    VPackArrayBuilder ab(&messagesVPack);
-    for (auto const& [vertex, message] : messagesForVertices) {
-      messagesVPack.add(VPackValuePair(vertex.data(), vertex.size(),
-                                       VPackValueType::String));  // key
-      this->_format->addValue(messagesVPack, message);            // value
-    }
-  }
-  return messagesVPack;
+  return combinedMessagesToVPack(messagesForVertices, *this->_format);
 }
 
 template<typename M>
@@ -373,16 +410,7 @@ template<typename M>
 auto CombiningOutActorCache<M>::messagesToVPack(
     containers::NodeHashMap<std::string_view, M> const& messagesForVertices)
     -> VPackBuilder {
-  VPackBuilder messagesVPack;
-  {
-    VPackArrayBuilder ab(&messagesVPack);
-    for (auto const& [vertex, message] : messagesForVertices) {
-      messagesVPack.add(VPackValuePair(vertex.data(), vertex.size(),
-                                       VPackValueType::String));  // key
-      this->_format->addValue(messagesVPack, message);            // value
-    }
-  }
-  return messagesVPack;
+  return combinedMessagesToVPack(messagesForVertices, *this->_format);
 }
 
 template<typename M>
@@ -309,6 +309,7 @@ PregelFeature::PregelFeature(Server& server)
       _defaultParallelism(::defaultParallelism()),
       _minParallelism(1),
       _maxParallelism(::availableCores()),
+      _messageSpillThreshold(0),
       _softShutdownOngoing(false),
       _metrics(std::make_shared<PregelMetrics>(
           server.getFeature<arangodb::metrics::MetricsFeature>())),
@@ -398,6 +399,29 @@ applies per DB-Server.
 
 Defaults to the number of available cores.)");
 
+  options
+      ->addOption("--pregel.message-spill-threshold",
+                  "The estimated memory usage (in bytes) of the messages "
+                  "buffered for the next superstep of a Pregel job, after "
+                  "which they are written to disk (0 = never write to disk).",
+                  new UInt64Parameter(&_messageSpillThreshold),
+                  arangodb::options::makeFlags(
+                      arangodb::options::Flags::Dynamic,
+                      arangodb::options::Flags::DefaultNoComponents,
+                      arangodb::options::Flags::OnDBServer,
+                      arangodb::options::Flags::OnSingle))
+      .setIntroducedIn(31200)
+      .setLongDescription(R"(While a worker computes a superstep, it buffers
+the messages for the next superstep in memory. If the estimated memory usage
+of these messages exceeds the configured value, the worker writes them to a
+temporary file in the temporary directory (`--temp.path`). The files are
+read back at the start of the next superstep and deleted afterwards.
+
+This reduces the peak memory usage of Pregel jobs that send a lot of messages,
+at the expense of additional disk I/O. The value is checked after every batch
+of incoming messages, so the actual memory usage can exceed it by the size of
+one batch.)");
+
   options
       ->addObsoleteOption(
           "--pregel.memory-mapped-files",
@@ -585,6 +609,10 @@ size_t PregelFeature::maxParallelism() const noexcept {
   return _maxParallelism;
 }
 
+uint64_t PregelFeature::messageSpillThreshold() const noexcept {
+  return _messageSpillThreshold;
+}
+
 size_t PregelFeature::parallelism(VPackSlice params) const noexcept {
   size_t parallelism = defaultParallelism();
   if (params.isObject()) {
@@ -165,6 +165,7 @@ class PregelFeature final : public ArangodFeature {
   size_t minParallelism() const noexcept;
   size_t maxParallelism() const noexcept;
   size_t parallelism(VPackSlice params) const noexcept;
+  uint64_t messageSpillThreshold() const noexcept;
 
   std::string tempPath() const;
 
@@ -184,6 +185,11 @@ class PregelFeature final : public ArangodFeature {
   // max parallelism usable per Pregel job
   size_t _maxParallelism;
 
+  // estimated memory usage (in bytes) of the messages buffered for the next
+  // superstep, after which a worker writes them to a temporary file.
+  // 0 means messages are never written to disk
+  uint64_t _messageSpillThreshold;
+
   mutable std::mutex _mutex;
 
   Scheduler::WorkHandle _gcHandle;
@@ -87,7 +87,7 @@ class VertexContext {
 
   size_t getEdgeCount() const { return _vertexEntry->getEdgeCount(); }
 
-  std::vector<Edge<E>>& getEdges() const { return _vertexEntry->getEdges(); }
+  std::span<Edge<E>> getEdges() const { return _vertexEntry->getEdges(); }
 
   void voteHalt() { _vertexEntry->setActive(false); }
   void voteActive() { _vertexEntry->setActive(true); }
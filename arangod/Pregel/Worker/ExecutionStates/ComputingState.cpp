@@ -39,6 +39,9 @@
 #include "Pregel/Algos/SLPA/SLPAValue.h"
 #include "Pregel/Algos/ColorPropagation/ColorPropagationValue.h"
 #include "Pregel/Algos/DMID/DMIDMessage.h"
+#include "Basics/error.h"
+#include "Basics/files.h"
+#include "Pregel/PregelFeature.h"
 #include "Scheduler/SchedulerFeature.h"
 #include "Pregel/Worker/VertexProcessor.h"
 
@@ -67,6 +70,14 @@ Computing<V, E, M>::Computing(WorkerState<V, E, M>& worker) : worker{worker} {
             ServerState::instance()->getId()),
         worker.messageFormat.get());
   }
+  auto& feature =
+      worker.config->vocbase()->server().getFeature<PregelFeature>();
+  messageSpillThreshold = feature.messageSpillThreshold();
+}
+
+template<typename V, typename E, typename M>
+Computing<V, E, M>::~Computing() {
+  removeSpilledFiles();
 }
 
 template<typename V, typename E, typename M>
@@ -84,6 +95,7 @@ auto Computing<V, E, M>::receive(actor::ActorPID const& sender,
 
     if (msg.gss == worker.config->globalSuperstep()) {
       writeCache->parseMessages(msg);
+      spillWriteCacheIfNeeded();
 
       return nullptr;
     }
@@ -161,6 +173,7 @@ auto Computing<V, E, M>::receive(actor::ActorPID const& sender,
 
     prepareGlobalSuperStep(std::move(msg));
     auto verticesProcessed = processVertices(dispatcher);
+    spillWriteCacheIfNeeded();
     auto out = finishProcessing(verticesProcessed, dispatcher.dispatchStatus);
 
     dispatcher.dispatchConductor(
@@ -205,6 +218,7 @@ auto Computing<V, E, M>::prepareGlobalSuperStep(
     TRI_ASSERT(readCache->containedMessageCount() == 0);
     // write cache becomes the readable cache
     std::swap(readCache, writeCache);
+    restoreSpilledMessages();
   }
   worker.workerContext->_writeAggregators->resetValues();
   worker.workerContext->_readAggregators->setAggregatedValues(
@@ -345,6 +359,62 @@ auto Computing<V, E, M>::finishProcessing(VerticesProcessed verticesProcessed,
   return gssFinishedEvent;
 }
 
+template<typename V, typename E, typename M>
+auto Computing<V, E, M>::spillWriteCacheIfNeeded() -> void {
+  if (messageSpillThreshold == 0) {
+    return;
+  }
+  TRI_ASSERT(writeCache->containedMessageCount() >= spilledMessageCount);
+  uint64_t inMemory = writeCache->containedMessageCount() - spilledMessageCount;
+  // rough estimate, does not take into account the memory used by the keys
+  // and by the hash tables
+  if (inMemory * sizeof(M) <= messageSpillThreshold) {
+    return;
+  }
+
+  std::string filename;
+  long systemError;
+  std::string errorMessage;
+  auto res = TRI_GetTempName("pregel", filename, false, systemError,
+                             errorMessage);
+  if (res != TRI_ERROR_NO_ERROR) {
+    THROW_ARANGO_EXCEPTION_MESSAGE(
+        res, "could not create file for Pregel messages: " + errorMessage);
+  }
+  LOG_TOPIC("2e7c1", DEBUG, Logger::PREGEL) << fmt::format(
+      "Writing {} messages for gss {} to '{}'", inMemory,
+      worker.config->globalSuperstep() + 1, filename);
+
+  // register the file first, so that it is removed in any case
+  spilledFiles.emplace_back(filename);
+  writeCache->spill(filename);
+  spilledMessageCount = writeCache->containedMessageCount();
+}
+
+template<typename V, typename E, typename M>
+auto Computing<V, E, M>::restoreSpilledMessages() -> void {
+  // the read cache contains the messages that were received after the last
+  // file was written
+  for (auto const& filename : spilledFiles) {
+    readCache->restoreSpilled(filename);
+  }
+  removeSpilledFiles();
+  spilledMessageCount = 0;
+}
+
+template<typename V, typename E, typename M>
+auto Computing<V, E, M>::removeSpilledFiles() -> void {
+  for (auto const& filename : spilledFiles) {
+    auto res = TRI_UnlinkFile(filename.c_str());
+    if (res != TRI_ERROR_NO_ERROR) {
+      LOG_TOPIC("b3a0f", WARN, Logger::PREGEL) << fmt::format(
+          "Unable to remove temporary Pregel file '{}': {}", filename,
+          TRI_errno_string(res));
+    }
+  }
+  spilledFiles.clear();
+}
+
 // template types to create
 template struct arangodb::pregel::worker::Computing<int64_t, int64_t, int64_t>;
 template struct arangodb::pregel::worker::Computing<uint64_t, uint8_t,
@@ -38,7 +38,7 @@ struct WorkerState;
 template<typename V, typename E, typename M>
 struct Computing : ExecutionState {
   explicit Computing(WorkerState<V, E, M>& worker);
-  ~Computing() override = default;
+  ~Computing() override;
 
   [[nodiscard]] auto name() const -> std::string override {
     return "computing";
@@ -52,6 +52,13 @@ struct Computing : ExecutionState {
   auto finishProcessing(VerticesProcessed verticesProcessed,
                         DispatchStatus const& dispatchStatus)
       -> conductor::message::GlobalSuperStepFinished;
+  // writes the messages in the write cache to a temporary file if their
+  // estimated memory usage exceeds the configured threshold
+  auto spillWriteCacheIfNeeded() -> void;
+  // reads back all messages written by spillWriteCacheIfNeeded into the
+  // read cache and removes the files
+  auto restoreSpilledMessages() -> void;
+  auto removeSpilledFiles() -> void;
 
   WorkerState<V, E, M>& worker;
   std::optional<std::chrono::steady_clock::time_point>
@@ -59,5 +66,10 @@ struct Computing : ExecutionState {
   std::unique_ptr<InCache<M>> readCache = nullptr;
   std::unique_ptr<InCache<M>> writeCache = nullptr;
   size_t messageBatchSize = 500;
+  // 0 means that messages are never spilled
+  uint64_t messageSpillThreshold = 0;
+  // number of messages in the write cache that have been spilled
+  uint64_t spilledMessageCount = 0;
+  std::vector<std::string> spilledFiles;
 };
 }  // namespace arangodb::pregel::worker
@@ -276,7 +276,9 @@ arangodb::Result fetchRevisions(
 
   arangodb::network::ConnectionPool* pool = netFeature.pool();
 
-  std::size_t queueSize = 10;
+  auto& replicationFeature =
+      config.vocbase.server().getFeature<arangodb::ReplicationFeature>();
+  std::size_t queueSize = replicationFeature.syncDocumentsParallelism();
   if ((config.leader.majorVersion < 3) ||
       (config.leader.majorVersion == 3 && config.leader.minorVersion < 9) ||
       (config.leader.majorVersion == 3 && config.leader.minorVersion == 9 &&
@@ -343,6 +345,13 @@ arangodb::Result fetchRevisions(
                                    res.errorMessage()));
       }
 
+      // stay within the bandwidth budget shared by all syncers on this
+      // server. the wait delays the next requests we send
+      tWait = TRI_microtime();
+      replicationFeature.syncBandwidthLimiter().consumeAndWait(
+          val.response().payloadSize());
+      stats.waitedForDocs += TRI_microtime() - tWait;
+
       VPackSlice docs = val.slice();
       if (!docs.isArray()) {
         return Result(TRI_ERROR_REPLICATION_INVALID_RESPONSE,
@@ -1155,6 +1164,13 @@ Result DatabaseInitialSyncer::fetchCollectionDump(LogicalCollection* coll,
 
     if (dumpResponse->hasContentLength()) {
       stats.numDumpBytesReceived += dumpResponse->getContentLength();
+      // stay within the bandwidth budget shared by all syncers on this
+      // server, before we request the next chunk
+      vocbase()
+          .server()
+          .getFeature<ReplicationFeature>()
+          .syncBandwidthLimiter()
+          .consumeAndWait(dumpResponse->getContentLength());
     }
 
     bool found;
@@ -1688,6 +1704,49 @@ void DatabaseInitialSyncer::fetchRevisionsChunk(
 
 /// @brief incrementally fetch data from a collection using revisions as the
 /// primary document identifier
+void DatabaseInitialSyncer::fetchRevisionTree(
+    std::shared_ptr<Syncer::JobSynchronizer> sharedStatus,
+    std::string const& collectionName, std::string const& leaderColl,
+    TRI_voc_tick_t maxTick) {
+  using basics::StringUtils::urlEncode;
+
+  if (isAborted()) {
+    sharedStatus->gotResponse(Result(TRI_ERROR_REPLICATION_APPLIER_STOPPED));
+    return;
+  }
+
+  try {
+    std::string url = replutils::ReplicationUrl + "/" +
+                      RestReplicationHandler::Revisions + "/" +
+                      RestReplicationHandler::Tree +
+                      "?collection=" + urlEncode(leaderColl) +
+                      "&onlyPopulated=true" + "&to=" + std::to_string(maxTick) +
+                      "&serverId=" + _state.localServerIdString +
+                      "&batchId=" + std::to_string(_config.batch.id);
+
+    _config.progress.set("fetching collection revision tree for collection '" +
+                         collectionName + "' from " + url);
+
+    auto headers = replutils::createHeaders();
+    std::unique_ptr<httpclient::SimpleHttpResult> response;
+    double t = TRI_microtime();
+    _config.connection.lease([&](httpclient::SimpleHttpClient* client) {
+      response.reset(client->retryRequest(rest::RequestType::GET, url, nullptr,
+                                          0, headers));
+    });
+    t = TRI_microtime() - t;
+
+    // errors are handed over as they are, because the caller needs to tell
+    // a leader without support for the revision-based protocol apart from
+    // other failures
+    sharedStatus->gotResponse(std::move(response), t);
+  } catch (basics::Exception const& ex) {
+    sharedStatus->gotResponse(Result(ex.code(), ex.what()));
+  } catch (std::exception const& ex) {
+    sharedStatus->gotResponse(Result(TRI_ERROR_INTERNAL, ex.what()));
+  }
+}
+
 Result DatabaseInitialSyncer::fetchCollectionSyncByRevisions(
     LogicalCollection* coll, std::string const& leaderColl,
     TRI_voc_tick_t maxTick) {
@@ -1709,25 +1768,45 @@ Result DatabaseInitialSyncer::fetchCollectionSyncByRevisions(
 
   // get leader tree
   {
-    std::string url = baseUrl + "/" + RestReplicationHandler::Tree +
-                      "?collection=" + urlEncode(leaderColl) +
-                      "&onlyPopulated=true" + "&to=" + std::to_string(maxTick) +
-                      "&serverId=" + _state.localServerIdString +
-                      "&batchId=" + std::to_string(_config.batch.id);
-
-    std::string msg = "fetching collection revision tree for collection '" +
-                      coll->name() + "' from " + url;
-    _config.progress.set(msg);
+    std::shared_ptr<Syncer::JobSynchronizer> sharedStatus;
+    if (_prefetchedRevisionTree.has_value() &&
+        _prefetchedRevisionTree->leaderColl == leaderColl) {
+      // the request has already been sent while the previous collection
+      // was synced
+      sharedStatus = std::move(_prefetchedRevisionTree->status);
+      _prefetchedRevisionTree.reset();
+    } else {
+      sharedStatus =
+          std::make_shared<Syncer::JobSynchronizer>(shared_from_this());
+      fetchRevisionTree(sharedStatus, coll->name(), leaderColl, maxTick);
+    }
 
-    auto headers = replutils::createHeaders();
     std::unique_ptr<httpclient::SimpleHttpResult> response;
     double t = TRI_microtime();
-    _config.connection.lease([&](httpclient::SimpleHttpClient* client) {
-      response.reset(client->retryRequest(rest::RequestType::GET, url, nullptr,
-                                          0, headers));
-    });
+    Result fetchRes = sharedStatus->waitForResponse(response);
     stats.waitedForInitial += TRI_microtime() - t;
 
+    if (fetchRes.fail()) {
+      return fetchRes;
+    }
+
+    // order the revision tree of the next collection in the background
+    if (!_nextLeaderColl.empty() && !isAborted()) {
+      auto self = shared_from_this();
+      auto nextStatus = std::make_shared<Syncer::JobSynchronizer>(self);
+      nextStatus->request([this, self, nextStatus,
+                           collectionName = _nextCollectionName,
+                           nextLeaderColl = _nextLeaderColl, maxTick]() {
+        fetchRevisionTree(nextStatus, collectionName, nextLeaderColl,
+                          maxTick);
+      });
+      _prefetchedRevisionTree =
+          PrefetchedRevisionTree{_nextLeaderColl, std::move(nextStatus)};
+    }
+
+    std::string url = baseUrl + "/" + RestReplicationHandler::Tree +
+                      "?collection=" + urlEncode(leaderColl);
+
     if (replutils::hasFailed(response.get())) {
       if (response &&
           response->getHttpReturnCode() ==
@@ -2779,9 +2858,36 @@ Result DatabaseInitialSyncer::iterateCollections(
                        std::to_string(collections.size()) + " collections");
   _config.progress.set(phaseMsg);
 
-  for (auto const& collection : collections) {
-    VPackSlice const parameters = collection.first;
-    VPackSlice const indexes = collection.second;
+  // discard revision tree requests which were not used
+  auto prefetchGuard = scopeGuard([this]() noexcept {
+    _prefetchedRevisionTree.reset();
+    _nextCollectionName.clear();
+    _nextLeaderColl.clear();
+  });
+
+  for (std::size_t i = 0; i < collections.size(); ++i) {
+    VPackSlice const parameters = collections[i].first;
+    VPackSlice const indexes = collections[i].second;
+
+    _nextCollectionName.clear();
+    _nextLeaderColl.clear();
+    if (incremental && phase == PHASE_DUMP && i + 1 < collections.size() &&
+        _config.leader.version() >= 30800) {
+      // the next collection will most likely be synced by revisions if it
+      // exists locally and has documents. in this case we can already
+      // fetch its revision tree while the current collection is synced
+      VPackSlice next = collections[i + 1].first;
+      auto col = resolveCollection(vocbase(), next);
+      if (col != nullptr && col->syncByRevision() && hasDocuments(*col)) {
+        _nextCollectionName = col->name();
+        _nextLeaderColl = basics::VelocyPackHelper::getStringValue(
+            next, "globallyUniqueId", "");
+        if (_nextLeaderColl.empty()) {
+          _nextLeaderColl = basics::StringUtils::itoa(
+              basics::VelocyPackHelper::extractIdValue(next));
+        }
+      }
+    }
 
     Result res = handleCollection(parameters, indexes, incremental, phase);
 
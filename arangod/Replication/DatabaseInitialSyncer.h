@@ -33,6 +33,8 @@
 
 #include <chrono>
 #include <memory>
+#include <optional>
+#include <string>
 
 struct TRI_vocbase_t;
 
@@ -232,6 +234,12 @@ class DatabaseInitialSyncer : public InitialSyncer {
       std::string const& leaderColl, std::string const& requestPayload,
       RevisionId requestResume);
 
+  /// @brief order the revision tree of a collection from the leader
+  void fetchRevisionTree(std::shared_ptr<Syncer::JobSynchronizer> sharedStatus,
+                         std::string const& collectionName,
+                         std::string const& leaderColl,
+                         TRI_voc_tick_t maxTick);
+
   /// @brief incrementally fetch data from a collection using revisions as the
   /// primary document identifier, not supported by all engines/collections
   // TODO worker safety
@@ -284,6 +292,21 @@ class DatabaseInitialSyncer : public InitialSyncer {
   // point in time when we last executed the _checkCancellation callback
   mutable std::chrono::steady_clock::time_point _lastCancellationCheck;
 
+  /// @brief revision tree request for a collection which is synced later.
+  /// while a collection is synced incrementally, the leader's revision tree
+  /// of the next collection is already fetched in the background, so that
+  /// collections without any differences do not each cost a full round trip
+  struct PrefetchedRevisionTree {
+    std::string leaderColl;
+    std::shared_ptr<Syncer::JobSynchronizer> status;
+  };
+  std::optional<PrefetchedRevisionTree> _prefetchedRevisionTree;
+
+  /// @brief name and leader id of the collection that is synced after the
+  /// current one. only set in the dump phase of an incremental sync
+  std::string _nextCollectionName;
+  std::string _nextLeaderColl;
+
   /// @brief whether or not we are a coordinator/dbserver
   bool const _isClusterRole;
   uint64_t _quickKeysNumDocsLimit;
@@ -97,6 +97,12 @@ ReplicationFeature::ReplicationFeature(Server& server)
       _enableActiveFailover(false),
       _syncByRevision(true),
       _autoRepairRevisionTrees(true),
+      _syncDocumentsParallelism(10),
+      _syncMaxBandwidth(0),
+      _syncBandwidthLimiter(0),
+      _tailingCacheTtl(0.0),
+      _tailingCacheSize(64 * 1024 * 1024),
+      _walTailingCache(0, WalTailingCache::clock::duration::zero()),
       _connectionCache{
           server.getFeature<application_features::CommunicationFeaturePhase>(),
           httpclient::ConnectionCache::Options{5}},
@@ -183,6 +189,48 @@ void ReplicationFeature::collectOptions(
                       arangodb::options::Flags::OnDBServer))
       .setIntroducedIn(31006);
 
+  options
+      ->addOption("--replication.sync-documents-parallelism",
+                  "The maximum number of document requests that are in "
+                  "flight at the same time while synchronizing a shard or "
+                  "collection by revision.",
+                  new UInt32Parameter(&_syncDocumentsParallelism, /*base*/ 1,
+                                      /*minValue*/ 1),
+                  arangodb::options::makeDefaultFlags(
+                      arangodb::options::Flags::Uncommon))
+      .setIntroducedIn(31200);
+
+  options
+      ->addOption("--replication.sync-max-bandwidth",
+                  "The maximum network bandwidth (in bytes per second) that "
+                  "all shard and collection synchronizations on this server "
+                  "may use together (0 = unlimited).",
+                  new UInt64Parameter(&_syncMaxBandwidth),
+                  arangodb::options::makeDefaultFlags(
+                      arangodb::options::Flags::Uncommon))
+      .setIntroducedIn(31200);
+
+  options
+      ->addOption("--replication.tailing-cache-ttl",
+                  "The amount of time (in seconds) for which the responses "
+                  "of the WAL tailing API are cached and reused for other "
+                  "tailing clients requesting the same WAL range "
+                  "(0 = no caching).",
+                  new DoubleParameter(&_tailingCacheTtl, /*base*/ 1.0,
+                                      /*minValue*/ 0.0),
+                  arangodb::options::makeDefaultFlags(
+                      arangodb::options::Flags::Uncommon))
+      .setIntroducedIn(31200);
+
+  options
+      ->addOption("--replication.tailing-cache-size",
+                  "The maximum memory usage (in bytes) of the cache for WAL "
+                  "tailing responses.",
+                  new UInt64Parameter(&_tailingCacheSize),
+                  arangodb::options::makeDefaultFlags(
+                      arangodb::options::Flags::Uncommon))
+      .setIntroducedIn(31200);
+
   options
       ->addOption(
           "--replication.active-failover-leader-grace-period",
@@ -212,6 +260,12 @@ void ReplicationFeature::validateOptions(
     _forceConnectTimeout = true;
   }
 
+  _syncBandwidthLimiter.setLimit(_syncMaxBandwidth);
+  _walTailingCache.setLimits(
+      _tailingCacheSize,
+      std::chrono::duration_cast<WalTailingCache::clock::duration>(
+          std::chrono::duration<double>(_tailingCacheTtl)));
+
   if (_requestTimeout < 3.0) {
     _requestTimeout = 3.0;
   }
@@ -25,6 +25,8 @@
 
 #include "Cluster/ServerState.h"
 #include "Metrics/Fwd.h"
+#include "Replication/SyncBandwidthLimiter.h"
+#include "Replication/WalTailingCache.h"
 #include "RestServer/arangod.h"
 #include "SimpleHttpClient/ConnectionCache.h"
 
@@ -121,6 +123,20 @@ class ReplicationFeature final : public ArangodFeature {
   /// actual keys or only doc count
   uint64_t quickKeysLimit() const { return _quickKeysLimit; }
 
+  /// @brief maximum number of document requests a syncer keeps in flight
+  /// while fetching documents for a shard or collection
+  std::uint32_t syncDocumentsParallelism() const noexcept {
+    return _syncDocumentsParallelism;
+  }
+
+  /// @brief bandwidth budget shared by all initial syncers
+  SyncBandwidthLimiter& syncBandwidthLimiter() noexcept {
+    return _syncBandwidthLimiter;
+  }
+
+  /// @brief cache for WAL tailing responses shared by all tailing clients
+  WalTailingCache& walTailingCache() noexcept { return _walTailingCache; }
+
   /// @brief return a reference to the "number of clients" metric
   metrics::Gauge<uint64_t>& clientsMetric() { return _clients; }
 
@@ -156,6 +172,24 @@ class ReplicationFeature final : public ArangodFeature {
   /// shard synchronization attempts
   bool _autoRepairRevisionTrees;
 
+  /// @brief maximum number of document requests in flight per syncer
+  std::uint32_t _syncDocumentsParallelism;
+
+  /// @brief maximum network bandwidth used by all initial syncers together,
+  /// in bytes per second (0 = unlimited)
+  std::uint64_t _syncMaxBandwidth;
+
+  SyncBandwidthLimiter _syncBandwidthLimiter;
+
+  /// @brief time (in seconds) for which WAL tailing responses are cached
+  /// (0 = no caching)
+  double _tailingCacheTtl;
+
+  /// @brief maximum memory usage of the WAL tailing response cache
+  std::uint64_t _tailingCacheSize;
+
+  WalTailingCache _walTailingCache;
+
   /// @brief cache for reusable connections
   httpclient::ConnectionCache _connectionCache;
 
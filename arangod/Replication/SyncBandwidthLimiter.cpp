@@ -0,0 +1,71 @@
+////////////////////////////////////////////////////////////////////////////////
+/// DISCLAIMER
+///
+/// Copyright 2014-2023 ArangoDB GmbH, Cologne, Germany
+/// Copyright 2004-2014 triAGENS GmbH, Cologne, Germany
+///
+/// Licensed under the Apache License, Version 2.0 (the "License");
+/// you may not use this file except in compliance with the License.
+/// You may obtain a copy of the License at
+///
+///     http://www.apache.org/licenses/LICENSE-2.0
+///
+/// Unless required by applicable law or agreed to in writing, software
+/// distributed under the License is distributed on an "AS IS" BASIS,
+/// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+/// See the License for the specific language governing permissions and
+/// limitations under the License.
+///
+/// Copyright holder is ArangoDB GmbH, Cologne, Germany
+///
+/// @author Jan Steemann
+////////////////////////////////////////////////////////////////////////////////
+
+#include "SyncBandwidthLimiter.h"
+
+#include <thread>
+
+using namespace arangodb;
+
+namespace {
+// amount of unused budget that can be saved up, so that a short burst
+// after an idle period is not throttled
+constexpr auto kMaxBurst = std::chrono::seconds(1);
+}  // namespace
+
+SyncBandwidthLimiter::SyncBandwidthLimiter(
+    std::uint64_t bytesPerSecond) noexcept
+    : _bytesPerSecond(bytesPerSecond) {}
+
+void SyncBandwidthLimiter::setLimit(std::uint64_t bytesPerSecond) noexcept {
+  _bytesPerSecond.store(bytesPerSecond, std::memory_order_relaxed);
+}
+
+SyncBandwidthLimiter::clock::duration SyncBandwidthLimiter::consume(
+    std::uint64_t bytes, clock::time_point now) {
+  std::uint64_t bytesPerSecond = limit();
+  if (bytesPerSecond == 0) {
+    return clock::duration::zero();
+  }
+
+  auto cost = std::chrono::duration_cast<clock::duration>(
+      std::chrono::duration<double>(static_cast<double>(bytes) /
+                                    static_cast<double>(bytesPerSecond)));
+
+  std::lock_guard guard{_mutex};
+  if (_budgetAvailableAt < now - kMaxBurst) {
+    _budgetAvailableAt = now - kMaxBurst;
+  }
+  _budgetAvailableAt += cost;
+  if (_budgetAvailableAt <= now) {
+    return clock::duration::zero();
+  }
+  return _budgetAvailableAt - now;
+}
+
+void SyncBandwidthLimiter::consumeAndWait(std::uint64_t bytes) {
+  auto wait = consume(bytes, clock::now());
+  if (wait > clock::duration::zero()) {
+    std::this_thread::sleep_for(wait);
+  }
+}
@@ -0,0 +1,68 @@
+////////////////////////////////////////////////////////////////////////////////
+/// DISCLAIMER
+///
+/// Copyright 2014-2023 ArangoDB GmbH, Cologne, Germany
+/// Copyright 2004-2014 triAGENS GmbH, Cologne, Germany
+///
+/// Licensed under the Apache License, Version 2.0 (the "License");
+/// you may not use this file except in compliance with the License.
+/// You may obtain a copy of the License at
+///
+///     http://www.apache.org/licenses/LICENSE-2.0
+///
+/// Unless required by applicable law or agreed to in writing, software
+/// distributed under the License is distributed on an "AS IS" BASIS,
+/// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+/// See the License for the specific language governing permissions and
+/// limitations under the License.
+///
+/// Copyright holder is ArangoDB GmbH, Cologne, Germany
+///
+/// @author Jan Steemann
+////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+
+namespace arangodb {
+
+/// @brief global budget for the network bandwidth used by the initial
+/// synchronization of shards and collections. all syncers running on this
+/// server share the same budget, so that resyncing many shards at the same
+/// time (e.g. after replacing a DB server) does not saturate the network
+/// and slow down the regular traffic.
+/// this is a token bucket: every syncer accounts the bytes it has received,
+/// and is told how long it has to wait before it can send its next request.
+class SyncBandwidthLimiter {
+ public:
+  using clock = std::chrono::steady_clock;
+
+  /// @brief limit in bytes per second. 0 means unlimited
+  explicit SyncBandwidthLimiter(std::uint64_t bytesPerSecond) noexcept;
+
+  void setLimit(std::uint64_t bytesPerSecond) noexcept;
+  std::uint64_t limit() const noexcept {
+    return _bytesPerSecond.load(std::memory_order_relaxed);
+  }
+
+  /// @brief accounts the transferred bytes and returns the time the caller
+  /// should wait before transferring more data
+  clock::duration consume(std::uint64_t bytes, clock::time_point now);
+
+  /// @brief same, but sleeps for the required time
+  void consumeAndWait(std::uint64_t bytes);
+
+ private:
+  std::atomic<std::uint64_t> _bytesPerSecond;
+
+  std::mutex _mutex;
+  // point in time at which the budget will be back at zero. if it is in
+  // the past, the budget is not exhausted
+  clock::time_point _budgetAvailableAt{};
+};
+
+}  // namespace arangodb
@@ -75,6 +75,10 @@ constexpr std::string_view dataRef("data");
 constexpr std::string_view tickRef("tick");
 constexpr std::string_view dbRef("db");
 
+// maximum number of standalone document operations that are applied in a
+// single transaction
+constexpr std::size_t maxBufferedDocuments = 1000;
+
 bool hasHeader(std::unique_ptr<httpclient::SimpleHttpResult> const& response,
                std::string const& name) {
   return response->hasHeaderField(name);
@@ -606,6 +610,56 @@ Result TailingSyncer::removeSingleDocument(LogicalCollection* coll,
   return trx.commit();
 }
 
+Result TailingSyncer::applyBufferedDocuments(
+    LogicalCollection& coll, std::vector<BufferedDocument> const& documents) {
+  SingleCollectionTransaction trx(
+      transaction::StandaloneContext::Create(coll.vocbase()), coll,
+      AccessMode::Type::EXCLUSIVE);
+
+  Result res = trx.begin();
+  if (res.fail()) {
+    return res;
+  }
+
+  std::string conflictDocumentKey;
+  for (auto const& document : documents) {
+    VPackSlice data = document.marker.slice().get(::dataRef);
+    if (!data.isObject()) {
+      return Result(TRI_ERROR_REPLICATION_INVALID_RESPONSE,
+                    "invalid document format");
+    }
+
+    VPackSlice applySlice = data;
+    if (document.type == REPLICATION_MARKER_REMOVE) {
+      VPackSlice key = data.get(StaticStrings::KeyString);
+      VPackSlice rev = data.get(StaticStrings::RevString);
+      if (!key.isString() || (!rev.isNone() && !rev.isString())) {
+        return Result(TRI_ERROR_REPLICATION_INVALID_RESPONSE,
+                      "invalid document key or revision format");
+      }
+      _documentBuilder.clear();
+      _documentBuilder.openObject(true);
+      _documentBuilder.add(StaticStrings::KeyString, key);
+      if (rev.isString()) {
+        _documentBuilder.add(StaticStrings::RevString, rev);
+      }
+      _documentBuilder.close();
+      applySlice = _documentBuilder.slice();
+    }
+
+    // a conflict in a unique secondary index (TRI_ERROR_ARANGO_TRY_AGAIN)
+    // also makes us give up here. the caller will then apply the operations
+    // one by one, which takes care of removing the conflicting document
+    res = applyCollectionDumpMarker(trx, &coll, document.type, applySlice,
+                                    conflictDocumentKey);
+    if (res.fail()) {
+      return res;
+    }
+  }
+
+  return trx.commit();
+}
+
 /// @brief starts a transaction, based on the VelocyPack provided
 Result TailingSyncer::startTransaction(VPackSlice const& slice) {
   // {"type":2200,"tid":"230920705812199", "database": "123",
@@ -1138,6 +1192,109 @@ Result TailingSyncer::applyLog(SimpleHttpResult* response,
   };
   auto sg = arangodb::scopeGuard([&]() noexcept { reloader(); });
 
+  // update the tick values after a marker has been processed
+  auto updateTicks = [&](TRI_voc_tick_t markerTick, bool skipped) {
+    WRITE_LOCKER_EVENTUAL(writeLocker, _applier->_statusLock);
+
+    if (markerTick > firstRegularTick &&
+        markerTick > _applier->_state._lastProcessedContinuousTick) {
+      TRI_ASSERT(markerTick > 0);
+      _applier->_state._lastProcessedContinuousTick = markerTick;
+    }
+
+    if (_applier->_state._lastProcessedContinuousTick >
+        _applier->_state._lastAppliedContinuousTick) {
+      _applier->_state._lastAppliedContinuousTick =
+          _applier->_state._lastProcessedContinuousTick;
+    }
+
+    if (skipped) {
+      ++_applier->_state._totalSkippedOperations;
+    } else if (_ongoingTransactions.empty()) {
+      _applier->_state._safeResumeTick =
+          _applier->_state._lastProcessedContinuousTick;
+    }
+  };
+
+  // returns the error if we must stop, or an ok result if the error is to
+  // be ignored
+  auto handleApplyError = [&](Result res, std::string_view line) -> Result {
+    auto errorMsg = std::string{res.errorMessage()};
+
+    if (ignoreCount == 0) {
+      if (line.size() > 1024) {
+        errorMsg += ", offending marker: " + std::string(line.substr(0, 1024)) +
+                    "...";
+      } else {
+        errorMsg += ", offending marker: " + std::string(line);
+      }
+
+      res.reset(res.errorNumber(), errorMsg);
+      return res;
+    }
+
+    ignoreCount--;
+    LOG_TOPIC("c887a", WARN, Logger::REPLICATION)
+        << "ignoring replication error for database '" << _state.databaseName
+        << "': " << errorMsg;
+    return Result();
+  };
+
+  // consecutive standalone document operations on the same collection are
+  // buffered and then applied in a single transaction, which is a lot
+  // cheaper than using a separate transaction for each of them
+  std::vector<BufferedDocument> buffered;
+  std::shared_ptr<LogicalCollection> bufferedCollection;
+
+  auto flushBuffered = [&]() -> Result {
+    if (buffered.empty()) {
+      return Result();
+    }
+
+    Result res;
+    try {
+      res = applyBufferedDocuments(*bufferedCollection, buffered);
+    } catch (basics::Exception const& ex) {
+      res.reset(ex.code(), ex.what());
+    } catch (std::exception const& ex) {
+      res.reset(TRI_ERROR_INTERNAL, ex.what());
+    }
+
+    auto documents = std::move(buffered);
+    buffered.clear();
+    bufferedCollection.reset();
+
+    if (res.ok()) {
+      for (auto const& document : documents) {
+        if (document.type == REPLICATION_MARKER_DOCUMENT) {
+          ++applyStats.processedDocuments;
+        } else {
+          ++applyStats.processedRemovals;
+        }
+      }
+      updateTicks(documents.back().tick, false);
+      return res;
+    }
+
+    LOG_TOPIC("8c2e5", DEBUG, Logger::REPLICATION)
+        << "unable to apply " << documents.size()
+        << " document operations in a single transaction, applying them "
+        << "one by one: " << res.errorMessage();
+
+    for (auto const& document : documents) {
+      res = applyLogMarker(document.marker.slice(), applyStats,
+                           firstRegularTick, document.tick, document.type);
+      if (res.fail()) {
+        res = handleApplyError(std::move(res), document.line);
+        if (res.fail()) {
+          return res;
+        }
+      }
+      updateTicks(document.tick, false);
+    }
+    return Result();
+  };
+
   StringBuffer& data = response->getBody();
   char const* p = data.begin();
   char const* end = p + data.length();
@@ -1157,7 +1314,7 @@ Result TailingSyncer::applyLog(SimpleHttpResult* response,
 
     if (lineLength < 2) {
       // we are done
-      return Result();
+      return flushBuffered();
     }
 
     TRI_ASSERT(q <= end);
@@ -1199,59 +1356,67 @@ Result TailingSyncer::applyLog(SimpleHttpResult* response,
     // entry is skipped?
     bool skipped = skipMarker(firstRegularTick, slice, markerTick, markerType);
 
+    // standalone document operations on non-system collections can be
+    // buffered. operations on system collections are applied one by one,
+    // because they need some special treatment
+    std::shared_ptr<LogicalCollection> coll;
+    if (!skipped && (markerType == REPLICATION_MARKER_DOCUMENT ||
+                     markerType == REPLICATION_MARKER_REMOVE)) {
+      std::string_view transactionId =
+          VelocyPackHelper::getStringView(slice, "tid", std::string_view());
+      if (NumberUtils::atoi_zero<TransactionId::BaseType>(
+              transactionId.data(),
+              transactionId.data() + transactionId.size()) == 0) {
+        TRI_vocbase_t* vocbase = resolveVocbase(slice);
+        if (vocbase != nullptr) {
+          coll = resolveCollection(*vocbase, slice);
+        }
+        if (coll != nullptr && coll->system()) {
+          coll.reset();
+        }
+      }
+    }
+
+    if (coll != nullptr) {
+      if (bufferedCollection != nullptr &&
+          (bufferedCollection != coll ||
+           buffered.size() >= ::maxBufferedDocuments)) {
+        if (Result res = flushBuffered(); res.fail()) {
+          return res;
+        }
+      }
+      bufferedCollection = std::move(coll);
+      buffered.emplace_back(
+          BufferedDocument{markerType, markerTick, VPackBuilder(slice),
+                           std::string_view(lineStart, lineLength)});
+      continue;
+    }
+
+    // all other markers must see the effects of the buffered operations
+    if (Result res = flushBuffered(); res.fail()) {
+      return res;
+    }
+
     if (!skipped) {
       Result res = applyLogMarker(slice, applyStats, firstRegularTick,
                                   markerTick, markerType);
 
       if (res.fail()) {
         // apply error
-        auto errorMsg = std::string{res.errorMessage()};
-
-        if (ignoreCount == 0) {
-          if (lineLength > 1024) {
-            errorMsg +=
-                ", offending marker: " + std::string(lineStart, 1024) + "...";
-          } else {
-            errorMsg +=
-                ", offending marker: " + std::string(lineStart, lineLength);
-          }
-
-          res.reset(res.errorNumber(), errorMsg);
+        res = handleApplyError(std::move(res),
+                               std::string_view(lineStart, lineLength));
+        if (res.fail()) {
           return res;
         }
-
-        ignoreCount--;
-        LOG_TOPIC("c887a", WARN, Logger::REPLICATION)
-            << "ignoring replication error for database '"
-            << _state.databaseName << "': " << errorMsg;
       }
     }
 
     // update tick value
-    WRITE_LOCKER_EVENTUAL(writeLocker, _applier->_statusLock);
-
-    if (markerTick > firstRegularTick &&
-        markerTick > _applier->_state._lastProcessedContinuousTick) {
-      TRI_ASSERT(markerTick > 0);
-      _applier->_state._lastProcessedContinuousTick = markerTick;
-    }
-
-    if (_applier->_state._lastProcessedContinuousTick >
-        _applier->_state._lastAppliedContinuousTick) {
-      _applier->_state._lastAppliedContinuousTick =
-          _applier->_state._lastProcessedContinuousTick;
-    }
-
-    if (skipped) {
-      ++_applier->_state._totalSkippedOperations;
-    } else if (_ongoingTransactions.empty()) {
-      _applier->_state._safeResumeTick =
-          _applier->_state._lastProcessedContinuousTick;
-    }
+    updateTicks(markerTick, skipped);
   }
 
   // reached the end
-  return Result();
+  return flushBuffered();
 }
 
 /// @brief run method, performs continuous synchronization
@@ -32,6 +32,9 @@
 
 #include <velocypack/Builder.h>
 
+#include <string_view>
+#include <vector>
+
 struct TRI_vocbase_t;
 
 namespace arangodb {
@@ -177,6 +180,24 @@ class TailingSyncer : public Syncer {
   arangodb::Result removeSingleDocument(arangodb::LogicalCollection* coll,
                                         std::string const& key);
 
+  /// @brief a standalone document operation from the continuous log, which
+  /// is buffered so that it can be applied together with the following
+  /// operations on the same collection
+  struct BufferedDocument {
+    TRI_replication_operation_e type;
+    TRI_voc_tick_t tick;
+    arangodb::velocypack::Builder marker;
+    /// @brief the original marker, used in error messages
+    std::string_view line;
+  };
+
+  /// @brief apply multiple standalone document operations on the same
+  /// collection in a single transaction. if anything goes wrong, the
+  /// transaction is aborted and nothing is applied
+  arangodb::Result applyBufferedDocuments(
+      arangodb::LogicalCollection& coll,
+      std::vector<BufferedDocument> const& documents);
+
   arangodb::Result handleRequiredFromPresentFailure(TRI_voc_tick_t fromTick,
                                                     TRI_voc_tick_t readTick,
                                                     char const* type);
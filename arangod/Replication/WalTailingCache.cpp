@@ -0,0 +1,109 @@
+////////////////////////////////////////////////////////////////////////////////
+/// DISCLAIMER
+///
+/// Copyright 2014-2023 ArangoDB GmbH, Cologne, Germany
+/// Copyright 2004-2014 triAGENS GmbH, Cologne, Germany
+///
+/// Licensed under the Apache License, Version 2.0 (the "License");
+/// you may not use this file except in compliance with the License.
+/// You may obtain a copy of the License at
+///
+///     http://www.apache.org/licenses/LICENSE-2.0
+///
+/// Unless required by applicable law or agreed to in writing, software
+/// distributed under the License is distributed on an "AS IS" BASIS,
+/// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+/// See the License for the specific language governing permissions and
+/// limitations under the License.
+///
+/// Copyright holder is ArangoDB GmbH, Cologne, Germany
+///
+/// @author Jan Steemann
+////////////////////////////////////////////////////////////////////////////////
+
+#include "WalTailingCache.h"
+
+using namespace arangodb;
+
+WalTailingCache::WalTailingCache(std::uint64_t maxMemoryUsage,
+                                 clock::duration ttl) noexcept
+    : _maxMemoryUsage(maxMemoryUsage), _ttl(ttl) {}
+
+void WalTailingCache::setLimits(std::uint64_t maxMemoryUsage,
+                                clock::duration ttl) {
+  std::lock_guard guard{_mutex};
+  _maxMemoryUsage = maxMemoryUsage;
+  _ttl = ttl;
+  if (_ttl <= clock::duration::zero()) {
+    _entries.clear();
+    _order.clear();
+    _memoryUsage = 0;
+  }
+}
+
+bool WalTailingCache::enabled() const noexcept {
+  std::lock_guard guard{_mutex};
+  return _ttl > clock::duration::zero() && _maxMemoryUsage > 0;
+}
+
+std::shared_ptr<WalTailingCache::Entry const> WalTailingCache::lookup(
+    std::string const& key, clock::time_point now) {
+  std::lock_guard guard{_mutex};
+  auto it = _entries.find(key);
+  if (it == _entries.end() || it->second.expires <= now) {
+    return nullptr;
+  }
+  return it->second.entry;
+}
+
+void WalTailingCache::store(std::string const& key,
+                            std::shared_ptr<Entry const> entry,
+                            clock::time_point now) {
+  std::uint64_t size = memoryUsage(key, *entry);
+
+  std::lock_guard guard{_mutex};
+  if (_ttl <= clock::duration::zero() || size > _maxMemoryUsage) {
+    return;
+  }
+
+  auto expires = now + _ttl;
+  if (auto it = _entries.find(key); it != _entries.end()) {
+    _memoryUsage -= it->second.memoryUsage;
+  }
+  _entries.insert_or_assign(key, Slot{std::move(entry), expires, size});
+  _memoryUsage += size;
+  _order.emplace_back(key, expires);
+
+  evict(now);
+}
+
+std::size_t WalTailingCache::numEntries() const {
+  std::lock_guard guard{_mutex};
+  return _entries.size();
+}
+
+std::uint64_t WalTailingCache::memoryUsage() const {
+  std::lock_guard guard{_mutex};
+  return _memoryUsage;
+}
+
+std::uint64_t WalTailingCache::memoryUsage(std::string const& key,
+                                           Entry const& entry) noexcept {
+  return sizeof(Slot) + sizeof(Entry) + 2 * key.size() + entry.body.size();
+}
+
+void WalTailingCache::evict(clock::time_point now) {
+  while (!_order.empty()) {
+    auto const& [key, expires] = _order.front();
+    auto it = _entries.find(key);
+    if (it != _entries.end() && it->second.expires == expires) {
+      // the record refers to the current entry for the key
+      if (expires > now && _memoryUsage <= _maxMemoryUsage) {
+        break;
+      }
+      _memoryUsage -= it->second.memoryUsage;
+      _entries.erase(it);
+    }
+    _order.pop_front();
+  }
+}
@@ -0,0 +1,108 @@
+////////////////////////////////////////////////////////////////////////////////
+/// DISCLAIMER
+///
+/// Copyright 2014-2023 ArangoDB GmbH, Cologne, Germany
+/// Copyright 2004-2014 triAGENS GmbH, Cologne, Germany
+///
+/// Licensed under the Apache License, Version 2.0 (the "License");
+/// you may not use this file except in compliance with the License.
+/// You may obtain a copy of the License at
+///
+///     http://www.apache.org/licenses/LICENSE-2.0
+///
+/// Unless required by applicable law or agreed to in writing, software
+/// distributed under the License is distributed on an "AS IS" BASIS,
+/// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+/// See the License for the specific language governing permissions and
+/// limitations under the License.
+///
+/// Copyright holder is ArangoDB GmbH, Cologne, Germany
+///
+/// @author Jan Steemann
+////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "VocBase/voc-types.h"
+
+#include <chrono>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+namespace arangodb {
+
+/// @brief short-lived cache for the responses of the WAL tailing API.
+/// many consumers that tail the WAL (e.g. change data capture clients) are
+/// usually at roughly the same position in the WAL, and would otherwise
+/// all read, decode and serialize the same WAL range independently. the
+/// cache stores the serialized markers of a tailing response together with
+/// the ticks reported to the client, keyed by all request parameters that
+/// influence the response. entries expire after a short time, so that
+/// consumers see new WAL data with a bounded delay only.
+class WalTailingCache {
+ public:
+  using clock = std::chrono::steady_clock;
+
+  struct Entry {
+    /// @brief the serialized markers, as sent to the client
+    std::string body;
+    /// @brief number of markers in body
+    std::size_t numMarkers = 0;
+    bool fromTickIncluded = false;
+    TRI_voc_tick_t lastIncludedTick = 0;
+    TRI_voc_tick_t lastScannedTick = 0;
+    TRI_voc_tick_t latestTick = 0;
+  };
+
+  /// @brief a ttl of zero disables the cache
+  WalTailingCache(std::uint64_t maxMemoryUsage,
+                  clock::duration ttl) noexcept;
+
+  void setLimits(std::uint64_t maxMemoryUsage, clock::duration ttl);
+
+  bool enabled() const noexcept;
+
+  /// @brief returns the entry for the key, or nullptr if there is no such
+  /// entry or it has expired
+  std::shared_ptr<Entry const> lookup(std::string const& key,
+                                      clock::time_point now);
+
+  /// @brief stores an entry, replacing an existing entry for the same key.
+  /// entries that alone exceed the memory limit are not stored
+  void store(std::string const& key, std::shared_ptr<Entry const> entry,
+             clock::time_point now);
+
+  std::size_t numEntries() const;
+  std::uint64_t memoryUsage() const;
+
+ private:
+  struct Slot {
+    std::shared_ptr<Entry const> entry;
+    clock::time_point expires;
+    std::uint64_t memoryUsage;
+  };
+
+  static std::uint64_t memoryUsage(std::string const& key,
+                                   Entry const& entry) noexcept;
+
+  /// @brief removes expired entries, and the oldest entries while the
+  /// memory limit is exceeded. must be called with the mutex held
+  void evict(clock::time_point now);
+
+  mutable std::mutex _mutex;
+  std::uint64_t _maxMemoryUsage;
+  clock::duration _ttl;
+  std::uint64_t _memoryUsage = 0;
+  std::unordered_map<std::string, Slot> _entries;
+  // keys in insertion order, with the expiry time of the inserted entry.
+  // as all entries have the same ttl, this is also the order of expiry.
+  // replaced or removed entries keep their stale record here until it
+  // reaches the front
+  std::deque<std::pair<std::string, clock::time_point>> _order;
+};
+
+}  // namespace arangodb
@@ -34,10 +34,12 @@
 #include "Replication2/DeferredExecution.h"
 #include "Replication2/ReplicatedLog/Algorithms.h"
 #include "Logger/LogContextKeys.h"
+#include "Logger/Tracing.h"
 #include "Replication2/MetricsHelper.h"
 #include "Replication2/ReplicatedLog/TermIndexMapping.h"
 #include "Replication2/Exceptions/ParticipantResignedException.h"
 #include "Metrics/Counter.h"
+#include "Basics/ScopeGuard.h"
 
 using namespace arangodb::replication2::replicated_log::comp;
 
@@ -45,6 +47,12 @@ auto AppendEntriesManager::appendEntries(AppendEntriesRequest request)
     -> futures::Future<AppendEntriesResult> {
   MeasureTimeGuard timer(*metrics->replicatedLogFollowerAppendEntriesRtUs);
   // TODO more metrics?
+  // the span lives in the coroutine frame, so it covers the time spent
+  // waiting for previous requests as well as persisting the entries
+  tracing::Span span("replication2.append_entries",
+                     tracing::SpanKind::kInternal);
+  span.setAttribute("arangodb.replication2.entries",
+                    static_cast<int64_t>(request.entries.size()));
 
   LoggerContext lctx =
       loggerContext.with<logContextKeyMessageId>(request.messageId)
@@ -52,12 +60,45 @@ auto AppendEntriesManager::appendEntries(AppendEntriesRequest request)
   LOG_CTX("7f407", TRACE, lctx) << "receiving append entries";
 
   auto self = shared_from_this();  // required for coroutine to keep this alive
+  // Resume the next queued request once this one is done. This is declared
+  // before the guard, so it runs after the mutex has been released.
+  auto resumeNext = scopeGuard([&]() noexcept {
+    using Next = std::optional<futures::Promise<futures::Unit>>;
+    auto next = self->guarded.doUnderLock([](GuardedData& data) -> Next {
+      if (data.queuedRequests.empty()) {
+        return std::nullopt;
+      }
+      auto promise = std::move(data.queuedRequests.front());
+      data.queuedRequests.pop_front();
+      return promise;
+    });
+    if (next) {
+      next->setValue();
+    }
+  });
   Guarded<GuardedData>::mutex_guard_type guard = guarded.getLockedGuard();
   if (guard->resigned) {
     throw ParticipantResignedException(
         TRI_ERROR_REPLICATION_REPLICATED_LOG_FOLLOWER_RESIGNED, ADB_HERE);
   }
   auto requestGuard = guard->requestInFlight.acquire();
+  while (not requestGuard &&
+         guard->queuedRequests.size() < kMaxQueuedRequests) {
+    // The leader pipelines its requests. Wait for the previous request to
+    // finish instead of rejecting this one.
+    LOG_CTX("7be0d", TRACE, lctx)
+        << "queueing append entries - request in flight";
+    span.setAttribute("arangodb.replication2.queued", int64_t{1});
+    auto f = guard->queuedRequests.emplace_back().getFuture();
+    guard.unlock();
+    co_await std::move(f);
+    guard = self->guarded.getLockedGuard();
+    if (guard->resigned) {
+      throw ParticipantResignedException(
+          TRI_ERROR_REPLICATION_REPLICATED_LOG_FOLLOWER_RESIGNED, ADB_HERE);
+    }
+    requestGuard = guard->requestInFlight.acquire();
+  }
   if (not requestGuard) {
     LOG_CTX("58043", INFO, lctx)
         << "rejecting append entries - request in flight";
@@ -186,8 +227,14 @@ AppendEntriesManager::AppendEntriesManager(
       guarded(storage, snapshot, compaction, stateHandle, messageIdManager) {}
 
 auto AppendEntriesManager::resign() && noexcept -> void {
-  auto guard = guarded.getLockedGuard();
-  return std::move(guard.get()).resign();
+  auto queuedRequests = guarded.doUnderLock([](GuardedData& data) {
+    std::move(data).resign();
+    return std::move(data.queuedRequests);
+  });
+  // the queued requests notice the resignation when they are resumed
+  for (auto& promise : queuedRequests) {
+    promise.setValue();
+  }
 }
 
 AppendEntriesManager::GuardedData::GuardedData(
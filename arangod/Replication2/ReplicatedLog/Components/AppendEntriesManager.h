@@ -21,8 +21,10 @@
 /// @author Lars Maier
 ////////////////////////////////////////////////////////////////////////////////
 #pragma once
+#include <deque>
 #include <optional>
 #include "Basics/Guarded.h"
+#include "Futures/Promise.h"
 #include "Replication2/ReplicatedLog/Components/ExclusiveBool.h"
 #include "Replication2/ReplicatedLog/Components/IAppendEntriesManager.h"
 #include "Replication2/ReplicatedLog/Components/IMessageIdManager.h"
@@ -56,6 +58,10 @@ struct AppendEntriesManager
 
   auto resign() && noexcept -> void override;
 
+  // maximum number of requests waiting for the request in flight. The leader
+  // pipelines its requests, further requests are rejected.
+  static constexpr std::size_t kMaxQueuedRequests = 16;
+
   struct GuardedData {
     GuardedData(IStorageManager& storage, ISnapshotManager& snapshot,
                 ICompactionManager& compaction,
@@ -69,6 +75,9 @@ struct AppendEntriesManager
 
     bool resigned = false;
     ExclusiveBool requestInFlight;
+    // requests that arrived while another one was in flight, in the order of
+    // their arrival. They are resumed one by one.
+    std::deque<futures::Promise<futures::Unit>> queuedRequests;
 
     IStorageManager& storage;
     ISnapshotManager& snapshot;
@@ -285,11 +285,19 @@ struct ReplicatedLogGlobalSettings {
   static inline constexpr std::size_t minThresholdRocksDBWriteBatchSize{1024 *
                                                                         1024};
   static inline constexpr std::size_t defaultThresholdLogCompaction{1000};
+  static inline constexpr std::size_t defaultMaxAppendEntriesInFlight{4};
+  static inline constexpr std::size_t defaultMaxRetainedLogEntries{1'000'000};
 
   std::size_t _thresholdNetworkBatchSize{defaultThresholdNetworkBatchSize};
   std::size_t _thresholdRocksDBWriteBatchSize{
       defaultThresholdRocksDBWriteBatchSize};
   std::size_t _thresholdLogCompaction{defaultThresholdLogCompaction};
+  // maximum number of append entries requests in flight per follower
+  std::size_t _maxAppendEntriesInFlight{defaultMaxAppendEntriesInFlight};
+  // maximum number of committed log entries the leader keeps for a follower
+  // that lags behind. Followers lagging further will need a snapshot.
+  // 0 means no limit.
+  std::size_t _maxRetainedLogEntries{defaultMaxRetainedLogEntries};
 };
 
 namespace replicated_log {
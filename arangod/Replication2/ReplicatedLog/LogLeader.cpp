@@ -248,8 +248,7 @@ void replicated_log::LogLeader::executeAppendEntriesRequests(
                   << ", current litk = " << lowestIndexToKeep;
               // We can only get here if there is some new information
               // for this follower
-              TRI_ASSERT(follower->nextPrevLogPosition.index() !=
-                             lastAvailableIndex.index ||
+              TRI_ASSERT(follower->lastSentIndex != lastAvailableIndex.index ||
                          commitIndex != follower->lastAckedCommitIndex ||
                          lowestIndexToKeep !=
                              follower->lastAckedLowestIndexToKeep);
@@ -815,18 +814,38 @@ auto replicated_log::LogLeader::GuardedLeaderData::prepareAppendEntries()
 auto replicated_log::LogLeader::GuardedLeaderData::prepareAppendEntry(
     std::shared_ptr<FollowerInfo> follower)
     -> std::optional<PreparedAppendEntryRequest> {
+  auto const lastAvailableIndex =
+      _self._inMemoryLogManager->getSpearheadTermIndexPair();
+
   if (follower->_state != FollowerInfo::State::IDLE) {
-    LOG_CTX("1d7b6", TRACE, follower->logContext)
-        << "request in flight - skipping";
-    return std::nullopt;  // wait for the request to return
+    // Pipeline the new entries if the follower has been answering without
+    // errors. Updates of only the commit index or the lowest index to keep
+    // wait for the requests in flight to return.
+    bool const canPipeline =
+        follower->_state == FollowerInfo::State::REQUEST_IN_FLIGHT &&
+        follower->numErrorsSinceLastAnswer == 0 &&
+        follower->numRequestsInFlight <
+            _self._options->_maxAppendEntriesInFlight &&
+        follower->lastSentIndex < lastAvailableIndex.index;
+    if (!canPipeline) {
+      LOG_CTX("1d7b6", TRACE, follower->logContext)
+          << "request in flight - skipping";
+      return std::nullopt;  // wait for the request to return
+    }
+    LOG_CTX("c3a9e", TRACE, follower->logContext)
+        << "pipelining append entries, requests in flight = "
+        << follower->numRequestsInFlight
+        << ", last sent index = " << follower->lastSentIndex;
+    follower->_state = FollowerInfo::State::PREPARE;
+    return PreparedAppendEntryRequest{_self.shared_from_this(),
+                                      std::move(follower),
+                                      std::chrono::steady_clock::duration{}};
   }
 
   auto [releaseIndex, lowestIndexToKeep] =
       _self._compactionManager->getIndexes();
 
   auto const commitIndex = _self._inMemoryLogManager->getCommitIndex();
-  auto const lastAvailableIndex =
-      _self._inMemoryLogManager->getSpearheadTermIndexPair();
   LOG_CTX("8844a", TRACE, follower->logContext)
       << "last matched index = " << follower->nextPrevLogPosition.index()
       << ", current index = " << lastAvailableIndex
@@ -872,8 +891,10 @@ auto replicated_log::LogLeader::GuardedLeaderData::createAppendEntriesRequest(
     replicated_log::LogLeader::FollowerInfo& follower,
     TermIndexPair const& lastAvailableIndex) const
     -> std::pair<AppendEntriesRequest, TermIndexPair> {
-  auto const prevLogTerm = _self._inMemoryLogManager->getTermOfIndex(
-      follower.nextPrevLogPosition.index());
+  // continue after the requests in flight, if any
+  auto const prevLogIndex = follower.lastSentIndex;
+  auto const prevLogTerm =
+      _self._inMemoryLogManager->getTermOfIndex(prevLogIndex);
 
   auto const [releaseIndex, lowestIndexToKeep] =
       _self._compactionManager->getIndexes();
@@ -892,22 +913,22 @@ auto replicated_log::LogLeader::GuardedLeaderData::createAppendEntriesRequest(
 
   follower._state = FollowerInfo::State::REQUEST_IN_FLIGHT;
   follower._lastRequestStartTP = std::chrono::steady_clock::now();
+  ++follower.numRequestsInFlight;
 
   if (prevLogTerm) {
-    req.prevLogEntry.index = follower.nextPrevLogPosition.index();
+    req.prevLogEntry.index = prevLogIndex;
     req.prevLogEntry.term = *prevLogTerm;
-    TRI_ASSERT(req.prevLogEntry.index == follower.nextPrevLogPosition.index());
   } else {
     req.prevLogEntry.index = LogIndex{0};
     req.prevLogEntry.term = LogTerm{0};
   }
 
-  // Now get a iterator starting at follower.nextPrevLogPosition + 1 but also
-  // including the InMemory part.
+  // Now get a iterator starting at prevLogIndex + 1 but also including the
+  // InMemory part.
 
-  if (spearheadIdx > follower.nextPrevLogPosition.index()) {
-    auto it = _self._inMemoryLogManager->getInternalLogIterator(
-        follower.nextPrevLogPosition.index() + 1);
+  if (spearheadIdx > prevLogIndex) {
+    auto it =
+        _self._inMemoryLogManager->getInternalLogIterator(prevLogIndex + 1);
     auto transientEntries = decltype(req.entries)::transient_type{};
     auto sizeCounter = std::size_t{0};
     while (auto entry = it->next()) {
@@ -930,6 +951,7 @@ auto replicated_log::LogLeader::GuardedLeaderData::createAppendEntriesRequest(
   auto lastIndex = isEmptyAppendEntries
                        ? lastAvailableIndex
                        : req.entries.back().entry().logTermIndexPair();
+  follower.lastSentIndex = lastIndex.index;
 
   LOG_CTX("af3c6", TRACE, follower.logContext)
       << "creating append entries request with " << req.entries.size()
@@ -994,6 +1016,8 @@ auto replicated_log::LogLeader::GuardedLeaderData::handleAppendEntriesResponse(
     std::chrono::steady_clock::duration latency, MessageId messageId)
     -> std::pair<std::vector<std::optional<PreparedAppendEntryRequest>>,
                  ResolvedPromiseSet> {
+  TRI_ASSERT(follower.numRequestsInFlight > 0);
+  --follower.numRequestsInFlight;
   if (currentTerm != _self._currentTerm) {
     LOG_CTX("7ab2e", WARN, follower.logContext)
         << "received append entries response with wrong term: " << currentTerm;
@@ -1004,17 +1028,29 @@ auto replicated_log::LogLeader::GuardedLeaderData::handleAppendEntriesResponse(
 
   follower._lastRequestLatency = latency;
 
-  if (follower.lastSentMessageId == messageId) {
+  if (follower.numRequestsInFlight == 0 &&
+      follower._state == FollowerInfo::State::REQUEST_IN_FLIGHT) {
     LOG_CTX("35a32", TRACE, follower.logContext)
         << "received message " << messageId << " - no other requests in flight";
     // there is no request in flight currently
     follower._state = FollowerInfo::State::IDLE;
   }
+  // Requests are pipelined. A response is only handled if no response to a
+  // later request has been handled yet, and if the pipeline has not been
+  // reset after the request was sent.
+  bool const isLatestResponse = messageId > follower.lastAckedMessageId &&
+                                messageId > follower.lastDiscardedMessageId;
+  // Drop the optimistic state of the pipeline. Responses to the requests
+  // still in flight are ignored.
+  auto const resetPipeline = [&] {
+    follower.lastSentIndex = follower.nextPrevLogPosition.index();
+    follower.lastDiscardedMessageId = follower.lastSentMessageId;
+  };
   if (res.hasValue()) {
     auto& response = res.get();
     TRI_ASSERT(messageId == response.messageId)
         << messageId << " vs. " << response.messageId;
-    if (follower.lastSentMessageId == response.messageId) {
+    if (isLatestResponse) {
       LOG_CTX("35134", TRACE, follower.logContext)
           << "received append entries response, messageId = "
           << response.messageId
@@ -1048,6 +1084,7 @@ auto replicated_log::LogLeader::GuardedLeaderData::handleAppendEntriesResponse(
       follower.lastErrorReason = response.reason;
       if (response.isSuccess()) {
         follower.numErrorsSinceLastAnswer = 0;
+        follower.lastAckedMessageId = response.messageId;
         follower.lastAckedIndex = lastIndex;
         follower.nextPrevLogPosition =
             storage::IteratorPosition::fromLogIndex(lastIndex.index);
@@ -1057,6 +1094,11 @@ auto replicated_log::LogLeader::GuardedLeaderData::handleAppendEntriesResponse(
 
         TRI_ASSERT(follower.syncIndex <= follower.lastAckedIndex.index)
             << follower.syncIndex << " vs. " << follower.lastAckedIndex.index;
+        if (follower.numRequestsInFlight == 0) {
+          follower.lastSentIndex = lastIndex.index;
+        }
+        TRI_ASSERT(follower.lastSentIndex >= lastIndex.index)
+            << follower.lastSentIndex << " vs. " << lastIndex.index;
       } else {
         TRI_ASSERT(response.reason.error !=
                    AppendEntriesErrorReason::ErrorType::kNone);
@@ -1081,6 +1123,7 @@ auto replicated_log::LogLeader::GuardedLeaderData::handleAppendEntriesResponse(
             _self._logMetrics->replicatedLogLeaderAppendEntriesErrorCount
                 ->count();
         }
+        resetPipeline();
       }
     } else {
       LOG_CTX("056a8", DEBUG, follower.logContext)
@@ -1089,7 +1132,12 @@ auto replicated_log::LogLeader::GuardedLeaderData::handleAppendEntriesResponse(
           << ", expected " << messageId << ", latest "
           << follower.lastSentMessageId;
     }
+  } else if (res.hasException() && !isLatestResponse) {
+    LOG_CTX("9d2a1", DEBUG, follower.logContext)
+        << "ignoring exception for outdated append entries request "
+        << messageId << " to follower " << follower._impl->getParticipantId();
   } else if (res.hasException()) {
+    resetPipeline();
     ++follower.numErrorsSinceLastAnswer;
     _self._logMetrics->replicatedLogLeaderAppendEntriesErrorCount->count();
     follower.lastErrorReason = {
@@ -1153,16 +1201,45 @@ auto replicated_log::LogLeader::GuardedLeaderData::collectFollowerStates() const
         .flags = flags->second,
         .syncIndex = follower->syncIndex});
 
-    largestCommonIndex = std::min(largestCommonIndex, follower->syncIndex);
+    if (!exceedsLogRetention(*follower, commitIndex)) {
+      largestCommonIndex = std::min(largestCommonIndex, follower->syncIndex);
+    }
   }
 
   return {largestCommonIndex, std::move(participantStates)};
 }
 
+/*
+ * A follower that falls too far behind must not keep the leader from
+ * compacting its log forever. It will get a new snapshot instead, as soon as
+ * the entries it is missing have been compacted.
+ */
+auto replicated_log::LogLeader::GuardedLeaderData::exceedsLogRetention(
+    FollowerInfo const& follower, LogIndex commitIndex) const noexcept
+    -> bool {
+  auto const maxRetained = _self._options->_maxRetainedLogEntries;
+  return maxRetained > 0 &&
+         follower.syncIndex.value + maxRetained < commitIndex.value;
+}
+
 auto replicated_log::LogLeader::GuardedLeaderData::checkCommitIndex()
     -> ResolvedPromiseSet {
   auto [largestCommonIndex, indexes] = collectFollowerStates();
 
+  auto const commitIndex = _self._inMemoryLogManager->getCommitIndex();
+  for (auto const& [pid, follower] : _follower) {
+    auto const exceeds = exceedsLogRetention(*follower, commitIndex);
+    if (exceeds && !follower->exceedsLogRetention) {
+      LOG_CTX("e51a3", INFO, follower->logContext)
+          << "follower is at sync index " << follower->syncIndex
+          << ", more than " << _self._options->_maxRetainedLogEntries
+          << " entries behind commit index " << commitIndex
+          << ". Its missing log entries are no longer retained.";
+      _self._logMetrics->replicatedLogLeaderRetentionExceededNumber->count();
+    }
+    follower->exceedsLogRetention = exceeds;
+  }
+
   auto [releaseIndex, lowestIndexToKeep] =
       _self._compactionManager->getIndexes();
   if (largestCommonIndex > lowestIndexToKeep) {
@@ -1651,6 +1728,7 @@ replicated_log::LogLeader::FollowerInfo::FollowerInfo(
     : _impl(std::move(impl)),
       nextPrevLogPosition(
           storage::IteratorPosition::fromLogIndex(lastLogIndex)),
+      lastSentIndex(lastLogIndex),
       logContext(
           logContext.with<logContextKeyLogComponent>("follower-info")
               .with<logContextKeyFollowerId>(_impl->getParticipantId())) {}
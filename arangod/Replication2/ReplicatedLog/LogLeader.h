@@ -192,14 +192,27 @@ class LogLeader : public std::enable_shared_from_this<LogLeader>,
     std::shared_ptr<AbstractFollower> _impl;
     TermIndexPair lastAckedIndex = TermIndexPair{LogTerm{0}, LogIndex{0}};
     storage::IteratorPosition nextPrevLogPosition;
+    // index of the last entry sent to the follower. Requests are pipelined,
+    // so the next request continues from here. It is equal to
+    // nextPrevLogPosition if no request is in flight.
+    LogIndex lastSentIndex = LogIndex{0};
     LogIndex lastAckedCommitIndex = LogIndex{0};
     LogIndex lastAckedLowestIndexToKeep = LogIndex{0};
     LogIndex syncIndex = LogIndex{0};
     MessageId lastSentMessageId{0};
+    // message id of the latest successful response that has been handled
+    MessageId lastAckedMessageId{0};
+    // responses to requests up to this message id are ignored, because the
+    // pipeline has been reset after an error
+    MessageId lastDiscardedMessageId{0};
+    std::size_t numRequestsInFlight = 0;
     std::size_t numErrorsSinceLastAnswer = 0;
     AppendEntriesErrorReason lastErrorReason;
     bool snapshotAvailable{true};
     MessageId snapshotAvailableMessageId;
+    // the follower lags behind by more than the maximum number of retained
+    // log entries, thus it does not prevent compaction
+    bool exceedsLogRetention{false};
     LoggerContext const logContext;
     IScheduler::WorkItemHandle lastRequestHandle;
     cluster::CallbackGuard rebootIdCallbackGuard;
@@ -295,6 +308,10 @@ class LogLeader : public std::enable_shared_from_this<LogLeader>,
     [[nodiscard]] auto collectFollowerStates() const
         -> std::pair<LogIndex, std::vector<algorithms::ParticipantState>>;
 
+    [[nodiscard]] auto exceedsLogRetention(FollowerInfo const& follower,
+                                           LogIndex commitIndex) const noexcept
+        -> bool;
+
     [[nodiscard]] auto updateCommitIndexLeader(
         LogIndex newCommitIndex, std::shared_ptr<QuorumData> quorum)
         -> ResolvedPromiseSet;
@@ -24,6 +24,7 @@
 #include "LogPayload.h"
 
 #include "Basics/Exceptions.h"
+#include "Basics/debugging.h"
 
 #include <velocypack/Builder.h>
 
@@ -39,7 +40,13 @@ auto operator==(LogPayload const& left, LogPayload const& right) -> bool {
   }
 }
 
-LogPayload::LogPayload(BufferType buffer) : buffer(std::move(buffer)) {}
+LogPayload::LogPayload(BufferType buffer)
+    : buffer(std::make_shared<BufferType const>(std::move(buffer))) {}
+
+LogPayload::LogPayload(std::shared_ptr<BufferType const> buffer)
+    : buffer(std::move(buffer)) {
+  TRI_ASSERT(this->buffer != nullptr);
+}
 
 auto LogPayload::createFromSlice(velocypack::Slice slice) -> LogPayload {
   BufferType buffer(slice.byteSize());
@@ -55,19 +62,34 @@ auto LogPayload::createFromString(std::string_view string) -> LogPayload {
 
 auto LogPayload::copyBuffer() const -> velocypack::UInt8Buffer {
   velocypack::UInt8Buffer result;
-  result.append(buffer.data(), buffer.size());
+  if (buffer != nullptr) {
+    result.append(buffer->data(), buffer->size());
+  }
   return result;
 }
 
-auto LogPayload::stealBuffer() -> velocypack::UInt8Buffer&& {
-  return std::move(buffer);
+auto LogPayload::stealBuffer() -> velocypack::UInt8Buffer {
+  auto shared = std::move(buffer);
+  if (shared == nullptr) {
+    return {};
+  }
+  if (shared.use_count() == 1) {
+    // nobody else refers to the buffer, so it is safe to move it out
+    return std::move(const_cast<BufferType&>(*shared));
+  }
+  velocypack::UInt8Buffer result;
+  result.append(shared->data(), shared->size());
+  return result;
 }
 
 auto LogPayload::byteSize() const noexcept -> std::size_t {
-  return buffer.size();
+  return buffer != nullptr ? buffer->size() : 0;
 }
 
 auto LogPayload::slice() const noexcept -> velocypack::Slice {
-  return VPackSlice(buffer.data());
+  if (buffer == nullptr) {
+    return velocypack::Slice::noneSlice();
+  }
+  return VPackSlice(buffer->data());
 }
 }  // namespace arangodb::replication2
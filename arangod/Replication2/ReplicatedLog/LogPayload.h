@@ -24,16 +24,21 @@
 #pragma once
 
 #include <cstdint>
+#include <memory>
 #include <string_view>
 #include <velocypack/Buffer.h>
 #include <velocypack/Slice.h>
 
 namespace arangodb::replication2 {
 
+// The payload of a log entry. The buffer is immutable and shared between all
+// copies of the payload, so the in-memory log, the storage, the followers'
+// network requests and the state machine all refer to a single allocation.
 struct LogPayload {
   using BufferType = velocypack::UInt8Buffer;
 
-  explicit LogPayload(BufferType dummy);
+  explicit LogPayload(BufferType buffer);
+  explicit LogPayload(std::shared_ptr<BufferType const> buffer);
 
   // Named constructors, have to make copies.
   [[nodiscard]] static auto createFromSlice(velocypack::Slice slice)
@@ -46,10 +51,16 @@ struct LogPayload {
   [[nodiscard]] auto byteSize() const noexcept -> std::size_t;
   [[nodiscard]] auto slice() const noexcept -> velocypack::Slice;
   [[nodiscard]] auto copyBuffer() const -> velocypack::UInt8Buffer;
-  [[nodiscard]] auto stealBuffer() -> velocypack::UInt8Buffer&&;
+  // Moves the buffer out of the payload if it is not shared with any other
+  // copy, and copies it otherwise. The payload is empty afterwards.
+  [[nodiscard]] auto stealBuffer() -> velocypack::UInt8Buffer;
+  [[nodiscard]] auto sharedBuffer() const noexcept
+      -> std::shared_ptr<BufferType const> const& {
+    return buffer;
+  }
 
  private:
-  BufferType buffer;
+  std::shared_ptr<BufferType const> buffer;
 };
 
 auto operator==(LogPayload const&, LogPayload const&) -> bool;
@@ -64,6 +64,7 @@ auto NetworkAttachedFollower::appendEntries(AppendEntriesRequest request)
                                          logId, "append-entries");
   network::RequestOptions opts;
   opts.database = database;
+  opts.compression = network::Compression::kBulk;
   auto f = network::sendRequest(pool, "server:" + id,
                                 arangodb::fuerte::RestVerb::Post, path,
                                 std::move(buffer), opts);
@@ -102,6 +102,19 @@ void ReplicatedLogFeature::collectOptions(
       "compacting.",
       new SizeTParameter(&_options->_thresholdLogCompaction, /*base*/ 1,
                          /*minValue*/ 0));
+  options->addOption(
+      "--replicated-log.max-append-entries-in-flight",
+      "maximum number of append entries requests sent to a follower "
+      "without waiting for its responses",
+      new SizeTParameter(&_options->_maxAppendEntriesInFlight, /*base*/ 1,
+                         /*minValue*/ 1));
+  options->addOption(
+      "--replicated-log.max-retained-log-entries",
+      "maximum number of committed log entries kept for followers that fall "
+      "behind. Followers that fall further behind will get a new snapshot. "
+      "0 means no limit.",
+      new SizeTParameter(&_options->_maxRetainedLogEntries, /*base*/ 1,
+                         /*minValue*/ 0));
 #endif
 }
 
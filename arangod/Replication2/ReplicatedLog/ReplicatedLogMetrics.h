@@ -63,6 +63,7 @@ struct ReplicatedLogMetrics {
   metrics::Counter* replicatedLogNumberMetaEntries{nullptr};
   // TODO This metric currently isn't populated
   metrics::Counter* replicatedLogNumberCompactedEntries{nullptr};
+  metrics::Counter* replicatedLogLeaderRetentionExceededNumber{nullptr};
 };
 
 template<bool Mock>
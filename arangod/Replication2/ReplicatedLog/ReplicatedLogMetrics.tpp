@@ -93,6 +93,9 @@ ReplicatedLogMetricsIndirect<mock>::ReplicatedLogMetricsIndirect(
   replicatedLogNumberCompactedEntries = createMetric<
       arangodb_replication2_replicated_log_number_compacted_entries_total>(
       metricsFeature);
+  replicatedLogLeaderRetentionExceededNumber = createMetric<
+      arangodb_replication2_replicated_log_leader_retention_exceeded_total>(
+      metricsFeature);
 
   leaderNumInMemoryEntries =
       createMetric<arangodb_replication2_leader_in_memory_entries>(
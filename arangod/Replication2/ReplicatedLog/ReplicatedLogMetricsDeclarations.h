@@ -139,5 +139,9 @@ DECLARE_COUNTER(arangodb_replication2_replicated_log_number_meta_entries_total,
 DECLARE_COUNTER(
     arangodb_replication2_replicated_log_number_compacted_entries_total,
     "Number of compacted log entries");
+DECLARE_COUNTER(
+    arangodb_replication2_replicated_log_leader_retention_exceeded_total,
+    "Number of times a follower fell too far behind for the leader to keep "
+    "the log entries it is missing");
 
 }  // namespace arangodb
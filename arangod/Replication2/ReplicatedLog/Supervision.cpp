@@ -213,6 +213,24 @@ auto getParticipantsAcceptableAsLeaders(
   return acceptableLeaderSet;
 }
 
+auto pickSuccessor(
+    std::vector<ParticipantId> const& acceptableLeaderSet,
+    ParticipantsFlagsMap const& targetParticipants,
+    std::unordered_map<ParticipantId, LogCurrentLocalState> const& localStates)
+    -> ParticipantId {
+  TRI_ASSERT(!acceptableLeaderSet.empty());
+  auto rank = [&](ParticipantId const& participant) {
+    auto spearhead = TermIndexPair{};
+    if (auto iter = localStates.find(participant); iter != localStates.end()) {
+      spearhead = iter->second.spearhead;
+    }
+    return std::make_pair(targetParticipants.contains(participant), spearhead);
+  };
+  return *std::max_element(
+      acceptableLeaderSet.begin(), acceptableLeaderSet.end(),
+      [&](auto const& a, auto const& b) { return rank(a) < rank(b); });
+}
+
 // Check whether Target contains an entry for a leader, which means
 // that the user would like a particular participant to be leader;
 
@@ -586,13 +604,11 @@ auto checkLeaderRemovedFromTargetParticipants(SupervisionContext& ctx,
       }
     }
 
-    // Did not find a participant above, so pick one at random
-    // and force it.
-    auto const numElectible = acceptableLeaderSet.size();
-    if (numElectible > 0) {
-      auto const maxIdx = static_cast<uint16_t>(numElectible - 1);
-      auto const& chosenOne =
-          acceptableLeaderSet.at(RandomGenerator::interval(maxIdx));
+    // Did not find a participant above, so pick the best successor and
+    // force it.
+    if (!acceptableLeaderSet.empty()) {
+      auto const chosenOne = pickSuccessor(
+          acceptableLeaderSet, target.participants, current.localState);
 
       TRI_ASSERT(committedParticipants.contains(chosenOne));
       auto flags = committedParticipants.at(chosenOne);
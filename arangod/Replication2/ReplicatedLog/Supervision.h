@@ -97,6 +97,16 @@ auto getParticipantsAcceptableAsLeaders(
     std::unordered_map<ParticipantId, LogCurrentLocalState> const& localStates)
     -> std::vector<ParticipantId>;
 
+// Picks the participant that takes over leadership from a leader that steps
+// down. Participants that stay in target are preferred, and of those the one
+// with the most recent log, so that the new leader has to catch up as little
+// as possible. acceptableLeaderSet must not be empty.
+auto pickSuccessor(
+    std::vector<ParticipantId> const& acceptableLeaderSet,
+    ParticipantsFlagsMap const& targetParticipants,
+    std::unordered_map<ParticipantId, LogCurrentLocalState> const& localStates)
+    -> ParticipantId;
+
 // Actions capture entries in log, so they have to stay
 // valid until the returned action has been executed (or discarded)
 auto checkReplicatedLog(SupervisionContext& ctx, Log const& log,
@@ -31,9 +31,15 @@
 
 #include <Basics/application-exit.h>
 #include <Basics/Exceptions.h>
+#include <Basics/NumberOfCores.h>
 #include <Futures/Future.h>
 #include <Logger/LogContextKeys.h>
 
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <thread>
+
 using namespace arangodb::replication2::replicated_state::document;
 
 DocumentFollowerState::GuardedData::GuardedData(
@@ -177,6 +183,23 @@ auto DocumentFollowerState::applyEntries(
 
         return basics::catchToResultT([&]() -> std::optional<LogIndex> {
           std::optional<LogIndex> releaseIndex;
+          // Document operations are collected until an operation arrives
+          // that depends on them, e.g. a commit. Then the collected
+          // operations of different transactions are applied concurrently.
+          GuardedData::PendingOperations pending;
+          auto applyPending = [&] {
+            if (pending.empty()) {
+              return;
+            }
+            if (auto res =
+                    data.applyPendingOperations(pending, self->loggerContext);
+                res.fail()) {
+              LOG_CTX("5c1e7", FATAL, self->loggerContext)
+                  << "failed to apply document operations on follower: "
+                  << res;
+              FATAL_ERROR_EXIT();
+            }
+          };
 
           while (auto entry = ptr->next()) {
             if (self->_resigning) {
@@ -187,9 +210,27 @@ auto DocumentFollowerState::applyEntries(
             auto [index, doc] = *entry;
 
             auto currentReleaseIndex = std::visit(
-                [&data,
-                 index = index](auto&& op) -> ResultT<std::optional<LogIndex>> {
-                  return data.applyEntry(op, index);
+                [&data, &pending, &applyPending, index = index](
+                    auto&& op) -> ResultT<std::optional<LogIndex>> {
+                  using T = std::decay_t<decltype(op)>;
+                  if constexpr (ModifiesUserTransaction<T> &&
+                                !std::is_same_v<
+                                    T, ReplicatedOperation::Truncate>) {
+                    auto shouldApply = data.prepareEntry(op, index);
+                    if (shouldApply.fail()) {
+                      return shouldApply.result();
+                    }
+                    if (shouldApply.get()) {
+                      pending.add(op.tid, op);
+                    }
+                    return ResultT<std::optional<LogIndex>>::success(
+                        std::nullopt);
+                  } else {
+                    // everything else may depend on the pending operations,
+                    // e.g. a truncate needs exclusive access to the shard
+                    applyPending();
+                    return data.applyEntry(op, index);
+                  }
                 },
                 doc.getInnerOperation());
 
@@ -203,6 +244,9 @@ auto DocumentFollowerState::applyEntries(
               releaseIndex = std::move(currentReleaseIndex).get();
             }
           }
+          // document operations do not move the release index, but they
+          // must be applied before returning
+          applyPending();
 
           return releaseIndex;
         });
@@ -404,6 +448,18 @@ auto DocumentFollowerState::handleSnapshotTransfer(
           currentShard = snapshotRes->shardId;
         }
 
+        // Request the next batch before inserting the current one, so that
+        // the leader can read and send it while we are populating the shard.
+        // The leader serves the batches of a snapshot one after another, so
+        // there must not be more than one request in flight.
+        std::optional<futures::Future<ResultT<SnapshotBatch>>> nextBatch;
+        if (snapshotRes->hasMore) {
+          LOG_CTX("a732f", DEBUG, self->loggerContext)
+              << "Trying to fetch the next batch of snapshot: "
+              << snapshotRes->snapshotId;
+          nextBatch.emplace(leader->nextSnapshotBatch(snapshotId));
+        }
+
         if (snapshotRes->shardId.has_value()) {
           bool reportingFailure = false;
           auto insertRes = self->_guardedData.doUnderLock([&self, &snapshotRes,
@@ -454,14 +510,10 @@ auto DocumentFollowerState::handleSnapshotTransfer(
           TRI_ASSERT(!snapshotRes->hasMore);
         }
 
-        if (snapshotRes->hasMore) {
-          LOG_CTX("a732f", DEBUG, self->loggerContext)
-              << "Trying to fetch the next batch of snapshot: "
-              << snapshotRes->snapshotId;
-          auto fut = leader->nextSnapshotBatch(snapshotId);
+        if (nextBatch.has_value()) {
           return self->handleSnapshotTransfer(
               snapshotId, std::move(leader), snapshotVersion,
-              std::move(currentShard), std::move(fut));
+              std::move(currentShard), std::move(*nextBatch));
         }
 
         LOG_CTX("742df", DEBUG, self->loggerContext)
@@ -473,9 +525,95 @@ auto DocumentFollowerState::handleSnapshotTransfer(
       });
 }
 
-auto DocumentFollowerState::GuardedData::applyEntry(
-    ModifiesUserTransaction auto const& op, LogIndex index)
-    -> ResultT<std::optional<LogIndex>> {
+void DocumentFollowerState::GuardedData::PendingOperations::add(
+    TransactionId tid, ReplicatedOperation::OperationType op) {
+  auto [it, inserted] = positions.try_emplace(tid, transactions.size());
+  if (inserted) {
+    transactions.emplace_back(
+        tid, std::vector<ReplicatedOperation::OperationType>{});
+  }
+  transactions[it->second].second.emplace_back(std::move(op));
+  ++numOperations;
+}
+
+void DocumentFollowerState::GuardedData::PendingOperations::clear() noexcept {
+  transactions.clear();
+  positions.clear();
+  numOperations = 0;
+}
+
+auto DocumentFollowerState::GuardedData::applyPendingOperations(
+    PendingOperations& pending, LoggerContext const& loggerContext)
+    -> Result {
+  auto& transactions = pending.transactions;
+  // The first operation of a transaction creates it in the transaction
+  // handler, which is not thread-safe. After that, the handler only looks
+  // up the transaction, so the operations of different transactions can
+  // be applied concurrently.
+  for (auto& [tid, operations] : transactions) {
+    TRI_ASSERT(!operations.empty());
+    if (auto res = transactionHandler->applyEntry(operations.front());
+        res.fail()) {
+      return res;
+    }
+  }
+
+  std::size_t const numThreads = std::invoke([&]() -> std::size_t {
+    if (pending.numOperations - transactions.size() <
+        kMinParallelApplyOperations) {
+      return 1;
+    }
+    return std::min({transactions.size(), kMaxApplyParallelism,
+                     static_cast<std::size_t>(NumberOfCores::getValue())});
+  });
+
+  std::atomic<std::size_t> next{0};
+  std::mutex errorMutex;
+  Result error;
+  auto work = [&]() noexcept {
+    while (true) {
+      auto const pos = next.fetch_add(1, std::memory_order_relaxed);
+      if (pos >= transactions.size()) {
+        return;
+      }
+      auto const& operations = transactions[pos].second;
+      for (std::size_t i = 1; i < operations.size(); ++i) {
+        auto res = transactionHandler->applyEntry(operations[i]);
+        if (res.fail()) {
+          std::lock_guard lock{errorMutex};
+          if (error.ok()) {
+            error = std::move(res);
+          }
+          return;
+        }
+      }
+    }
+  };
+
+  std::vector<std::thread> threads;
+  try {
+    threads.reserve(numThreads - 1);
+    for (std::size_t i = 1; i < numThreads; ++i) {
+      threads.emplace_back(work);
+    }
+  } catch (...) {
+    // continue with the threads we were able to start
+  }
+  work();
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  LOG_CTX("4dd7b", DEBUG, loggerContext)
+      << "applied " << pending.numOperations << " document operations of "
+      << transactions.size() << " transactions using " << threads.size() + 1
+      << " threads";
+  pending.clear();
+  return error;
+}
+
+auto DocumentFollowerState::GuardedData::prepareEntry(
+    ModifiesUserTransaction auto const& op, LogIndex index) -> ResultT<bool> {
   if (auto validationRes = transactionHandler->validate(op);
       validationRes.is(TRI_ERROR_ARANGO_DATA_SOURCE_NOT_FOUND)) {
     //  Even though a shard was dropped before acquiring the
@@ -484,12 +622,25 @@ auto DocumentFollowerState::GuardedData::applyEntry(
     LOG_CTX("e1edb", INFO, core->loggerContext)
         << "will not apply transaction " << op.tid << " on shard " << op.shard
         << " because the shard is not available";
-    return ResultT<std::optional<LogIndex>>::success(std::nullopt);
+    return false;
   } else if (validationRes.fail()) {
     return validationRes;
   }
 
   activeTransactions.markAsActive(op.tid, index);
+  return true;
+}
+
+auto DocumentFollowerState::GuardedData::applyEntry(
+    ModifiesUserTransaction auto const& op, LogIndex index)
+    -> ResultT<std::optional<LogIndex>> {
+  auto shouldApply = prepareEntry(op, index);
+  if (shouldApply.fail()) {
+    return shouldApply.result();
+  }
+  if (!shouldApply.get()) {
+    return ResultT<std::optional<LogIndex>>::success(std::nullopt);
+  }
   if (auto res = transactionHandler->applyEntry(op); res.fail()) {
     return res;
   }
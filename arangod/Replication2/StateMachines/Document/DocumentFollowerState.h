@@ -31,6 +31,9 @@
 
 #include "Basics/UnshackledMutex.h"
 
+#include <unordered_map>
+#include <vector>
+
 namespace arangodb::replication2::replicated_state::document {
 
 struct IDocumentStateLeaderInterface;
@@ -90,6 +93,34 @@ struct DocumentFollowerState
 
     [[nodiscard]] bool didResign() const noexcept { return core == nullptr; }
 
+    // Document operations of user transactions which have been validated but
+    // not applied yet, grouped by transaction. Until one of the transactions
+    // is finished, the transactions are independent of each other, so their
+    // operations can be applied concurrently.
+    struct PendingOperations {
+      void add(TransactionId tid, ReplicatedOperation::OperationType op);
+      [[nodiscard]] bool empty() const noexcept { return numOperations == 0; }
+      void clear() noexcept;
+
+      std::vector<std::pair<TransactionId,
+                            std::vector<ReplicatedOperation::OperationType>>>
+          transactions;
+      std::unordered_map<TransactionId, std::size_t> positions;
+      std::size_t numOperations{0};
+    };
+
+    // Minimum number of pending operations to apply them concurrently.
+    static constexpr std::size_t kMinParallelApplyOperations = 64;
+    // Maximum number of threads applying pending operations.
+    static constexpr std::size_t kMaxApplyParallelism = 8;
+
+    // Validates the operation and marks its transaction as active. Returns
+    // false if the operation must not be applied.
+    auto prepareEntry(ModifiesUserTransaction auto const&, LogIndex)
+        -> ResultT<bool>;
+    auto applyPendingOperations(PendingOperations&,
+                                LoggerContext const& loggerContext) -> Result;
+
     auto applyEntry(ModifiesUserTransaction auto const&, LogIndex)
         -> ResultT<std::optional<LogIndex>>;
     auto applyEntry(ReplicatedOperation::IntermediateCommit const&, LogIndex)
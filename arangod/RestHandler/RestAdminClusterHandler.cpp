@@ -46,6 +46,7 @@
 #include "Cluster/ClusterFeature.h"
 #include "Cluster/ClusterHelpers.h"
 #include "Cluster/ClusterInfo.h"
+#include "Cluster/CollectionInfoCurrent.h"
 #include "Cluster/FollowerInfo.h"
 #include "Cluster/ServerState.h"
 #include "GeneralServer/GeneralServer.h"
@@ -2809,6 +2810,10 @@ RestAdminClusterHandler::collectRebalanceInformation(
         collectionRef.weight = 1.0;
         distributeShardsLikeCounter[collectionRef.name].index = index;
 
+        // load of the shards, as reported by their leaders
+        auto current =
+            ci.getCollectionCurrent(db, std::to_string(collection->id().id()));
+
         for (auto const& shard : *collection->shardIds()) {
           auto shardIndex =
               static_cast<decltype(collectionRef.shards)::value_type>(
@@ -2824,6 +2829,13 @@ RestAdminClusterHandler::collectRebalanceInformation(
               static_cast<decltype(shardRef.replicationFactor)>(
                   shard.second.size());
           shardRef.weight = 1.;
+          if (current != nullptr) {
+            // hot shards get a higher weight, so that their leaderships
+            // are spread over the DB servers. the levels are on a
+            // logarithmic scale already
+            auto load = current->load(shard.first);
+            shardRef.weight += load.reads + load.writes;
+          }
           shardRef.size = 1024 * 1024;  // size of data in that shard
           bool first = true;
           for (auto const& server : shard.second) {
@@ -25,8 +25,10 @@
 
 #include "Actions/RestActionHandler.h"
 #include "ApplicationFeatures/ApplicationServer.h"
+#include "Basics/LockContention.h"
 #include "Basics/StaticStrings.h"
 #include "Cluster/ClusterFeature.h"
+#include "CrashHandler/SamplingProfiler.h"
 #include "GeneralServer/AuthenticationFeature.h"
 #include "GeneralServer/GeneralServerFeature.h"
 #include "GeneralServer/SslServerFeature.h"
@@ -61,6 +63,10 @@ RestStatus RestAdminServerHandler::execute() {
     handleDatabaseDefaults();
   } else if (suffixes.size() == 1 && suffixes[0] == "tls") {
     handleTLS();
+  } else if (suffixes.size() == 1 && suffixes[0] == "profile") {
+    handleProfile();
+  } else if (suffixes.size() == 1 && suffixes[0] == "lock-contention") {
+    handleLockContention();
   } else if (suffixes.size() == 1 && suffixes[0] == "jwt") {
     handleJWTSecretsReload();
   } else if (suffixes.size() == 1 && suffixes[0] == "encryption") {
@@ -295,6 +301,137 @@ void RestAdminServerHandler::handleTLS() {
   }
 }
 
+void RestAdminServerHandler::generateProfilerError(Result const& res) {
+  // TRI_ERROR_FAILED means the profiler is already running or not running
+  generateError(res.is(TRI_ERROR_FAILED)
+                    ? rest::ResponseCode::CONFLICT
+                    : GeneralResponse::responseCode(res.errorNumber()),
+                res.errorNumber(), res.errorMessage());
+}
+
+void RestAdminServerHandler::handleProfile() {
+  // profiles reveal internals of the server, so they are only available
+  // to superusers
+  if (ExecContext::isAuthEnabled() && !ExecContext::current().isSuperuser()) {
+    generateError(rest::ResponseCode::FORBIDDEN, TRI_ERROR_FORBIDDEN,
+                  "only superusers may use the sampling profiler");
+    return;
+  }
+
+  auto const requestType = _request->requestType();
+  if (requestType == rest::RequestType::POST) {
+    // start profiling
+    uint64_t frequency = _request->parsedValue<uint64_t>(
+        "frequency", SamplingProfiler::kDefaultFrequency);
+    uint64_t maxSamples = _request->parsedValue<uint64_t>(
+        "maxSamples", SamplingProfiler::kDefaultMaxSamples);
+    Result res = SamplingProfiler::start(frequency, maxSamples);
+    if (res.fail()) {
+      generateProfilerError(res);
+      return;
+    }
+  } else if (requestType == rest::RequestType::DELETE_REQ) {
+    // stop profiling and return the profile
+    std::string profile;
+    Result res = SamplingProfiler::stop(profile);
+    if (res.fail()) {
+      generateProfilerError(res);
+      return;
+    }
+    _response->setResponseCode(rest::ResponseCode::OK);
+    _response->setContentType(std::string("application/octet-stream"));
+    _response->addRawPayload(profile);
+    return;
+  } else if (requestType != rest::RequestType::GET) {
+    generateError(rest::ResponseCode::METHOD_NOT_ALLOWED,
+                  TRI_ERROR_HTTP_METHOD_NOT_ALLOWED);
+    return;
+  }
+
+  auto status = SamplingProfiler::status();
+  VPackBuilder builder;
+  builder.openObject();
+  builder.add("running", VPackValue(status.running));
+  builder.add("frequency", VPackValue(status.frequency));
+  builder.add("samples", VPackValue(status.samples));
+  builder.add("dropped", VPackValue(status.dropped));
+  builder.close();
+  generateOk(rest::ResponseCode::OK, builder.slice());
+}
+
+void RestAdminServerHandler::handleLockContention() {
+  if (ExecContext::isAuthEnabled() && !ExecContext::current().isSuperuser()) {
+    generateError(rest::ResponseCode::FORBIDDEN, TRI_ERROR_FORBIDDEN,
+                  "only superusers may use the lock contention profiler");
+    return;
+  }
+
+  auto const requestType = _request->requestType();
+  if (requestType == rest::RequestType::PUT) {
+    // turn profiling on or off
+    bool parseSuccess = false;
+    VPackSlice slice = this->parseVPackBody(parseSuccess);
+    if (!parseSuccess) {
+      // error message generated in parseVPackBody
+      return;
+    }
+    if (!slice.isObject() || !slice.get("enabled").isBoolean()) {
+      generateError(rest::ResponseCode::BAD, TRI_ERROR_HTTP_BAD_PARAMETER,
+                    "expecting object with boolean attribute 'enabled'");
+      return;
+    }
+    LockContentionSite::setEnabled(slice.get("enabled").getBoolean());
+  } else if (requestType == rest::RequestType::DELETE_REQ) {
+    // reset all recorded wait times
+    LockContentionSite::visit(
+        [](LockContentionSite& site) { site.reset(); });
+  } else if (requestType != rest::RequestType::GET) {
+    generateError(rest::ResponseCode::METHOD_NOT_ALLOWED,
+                  TRI_ERROR_HTTP_METHOD_NOT_ALLOWED);
+    return;
+  }
+
+  // report the sites with the highest total wait time first
+  std::vector<std::pair<std::string_view, LockContentionSite::Snapshot>>
+      sites;
+  LockContentionSite::visit([&](LockContentionSite const& site) {
+    sites.emplace_back(site.name(), site.snapshot());
+  });
+  std::sort(sites.begin(), sites.end(), [](auto const& a, auto const& b) {
+    return a.second.totalWaitNanos > b.second.totalWaitNanos;
+  });
+
+  VPackBuilder builder;
+  builder.openObject();
+  builder.add("enabled", VPackValue(LockContentionSite::enabled()));
+  builder.add("sites", VPackValue(VPackValueType::Array));
+  for (auto const& [name, snapshot] : sites) {
+    builder.openObject();
+    builder.add("name", VPackValue(name));
+    builder.add("count", VPackValue(snapshot.count));
+    builder.add("totalWaitTime", VPackValue(snapshot.totalWaitNanos / 1e9));
+    builder.add("maxWaitTime", VPackValue(snapshot.maxWaitNanos / 1e9));
+    // number of waits per bucket, keyed by the bucket's upper bound in
+    // microseconds
+    builder.add("buckets", VPackValue(VPackValueType::Object));
+    for (std::size_t i = 0; i < LockContentionSite::kNumBuckets; ++i) {
+      if (snapshot.buckets[i] == 0) {
+        continue;
+      }
+      std::string key =
+          i + 1 == LockContentionSite::kNumBuckets
+              ? std::string("inf")
+              : std::to_string(LockContentionSite::bucketLimitMicros(i));
+      builder.add(key, VPackValue(snapshot.buckets[i]));
+    }
+    builder.close();
+    builder.close();
+  }
+  builder.close();
+  builder.close();
+  generateOk(rest::ResponseCode::OK, builder.slice());
+}
+
 #ifndef USE_ENTERPRISE
 void RestAdminServerHandler::handleJWTSecretsReload() {
   generateError(rest::ResponseCode::NOT_FOUND, TRI_ERROR_HTTP_NOT_FOUND);
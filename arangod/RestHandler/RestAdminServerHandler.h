@@ -50,6 +50,9 @@ class RestAdminServerHandler : public RestBaseHandler {
   void handleAvailability();
   void handleDatabaseDefaults();
   void handleTLS();
+  void handleProfile();
+  void generateProfilerError(Result const&);
+  void handleLockContention();
   void writeModeResult(bool);
 
   void handleJWTSecretsReload();
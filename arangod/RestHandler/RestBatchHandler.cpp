@@ -38,14 +38,25 @@
 #include "Scheduler/SchedulerFeature.h"
 #include "Utils/ExecContext.h"
 
+#include <algorithm>
+
 using namespace arangodb;
 using namespace arangodb::basics;
 using namespace arangodb::rest;
 
+namespace {
+// maximum number of parts of a batch request that are executed at the
+// same time when parallel execution is requested
+constexpr size_t maxParallelParts = 16;
+}  // namespace
+
 RestBatchHandler::RestBatchHandler(ArangodServer& server,
                                    GeneralRequest* request,
                                    GeneralResponse* response)
-    : RestVocbaseBaseHandler(server, request, response), _errors(0) {}
+    : RestVocbaseBaseHandler(server, request, response),
+      _errors(0),
+      _nextPart(0),
+      _completedParts(0) {}
 
 RestBatchHandler::~RestBatchHandler() = default;
 
@@ -74,7 +85,9 @@ RestStatus RestBatchHandler::executeVst() {
   return RestStatus::DONE;
 }
 
-void RestBatchHandler::processSubHandlerResult(RestHandler const& handler) {
+bool RestBatchHandler::appendPartResponse(RestHandler const& handler,
+                                          char const* contentId,
+                                          size_t contentIdLength) {
   HttpResponse* httpResponse = dynamic_cast<HttpResponse*>(_response.get());
 
   HttpResponse* partResponse = dynamic_cast<HttpResponse*>(handler.response());
@@ -82,8 +95,7 @@ void RestBatchHandler::processSubHandlerResult(RestHandler const& handler) {
   if (partResponse == nullptr) {
     generateError(rest::ResponseCode::BAD, TRI_ERROR_INTERNAL,
                   "could not create a response for batch part request");
-    wakeupHandler();
-    return;
+    return false;
   }
 
   rest::ResponseCode const code = partResponse->responseCode();
@@ -98,10 +110,9 @@ void RestBatchHandler::processSubHandlerResult(RestHandler const& handler) {
   httpResponse->body().appendText(StaticStrings::BatchContentType);
 
   // append content-id if it is present
-  if (_helper.contentId != nullptr) {
-    httpResponse->body().appendText(
-        "\r\nContent-Id: " +
-        std::string(_helper.contentId, _helper.contentIdLength));
+  if (contentId != nullptr) {
+    httpResponse->body().appendText("\r\nContent-Id: " +
+                                    std::string(contentId, contentIdLength));
   }
 
   httpResponse->body().appendText(std::string_view("\r\n\r\n"));
@@ -115,19 +126,33 @@ void RestBatchHandler::processSubHandlerResult(RestHandler const& handler) {
   // append the part response body
   httpResponse->body().appendText(partResponse->body());
   httpResponse->body().appendText(std::string_view("\r\n"));
+  return true;
+}
+
+void RestBatchHandler::finishResponse() {
+  HttpResponse* httpResponse = dynamic_cast<HttpResponse*>(_response.get());
+
+  // append final boundary + "--"
+  httpResponse->body().appendText(_boundary + "--");
+
+  if (_errors > 0) {
+    httpResponse->setHeaderNC(
+        StaticStrings::Errors,
+        StringUtils::itoa(static_cast<uint64_t>(_errors)));
+  }
+}
+
+void RestBatchHandler::processSubHandlerResult(RestHandler const& handler) {
+  if (!appendPartResponse(handler, _helper.contentId,
+                          _helper.contentIdLength)) {
+    wakeupHandler();
+    return;
+  }
 
   // we've read the last part
   if (!_helper.containsMore) {
     // complete the handler
-
-    // append final boundary + "--"
-    httpResponse->body().appendText(_boundary + "--");
-
-    if (_errors > 0) {
-      httpResponse->setHeaderNC(
-          StaticStrings::Errors,
-          StringUtils::itoa(static_cast<uint64_t>(_errors)));
-    }
+    finishResponse();
     wakeupHandler();
   } else {
     if (!executeNextHandler()) {
@@ -136,7 +161,7 @@ void RestBatchHandler::processSubHandlerResult(RestHandler const& handler) {
   }
 }
 
-bool RestBatchHandler::executeNextHandler() {
+std::shared_ptr<RestHandler> RestBatchHandler::createNextHandler() {
   // get authorization header. we will inject this into the subparts
   std::string const& authorization =
       _request->header(StaticStrings::Authorization);
@@ -148,7 +173,7 @@ bool RestBatchHandler::executeNextHandler() {
                   "invalid multipart message received");
     LOG_TOPIC("3204a", WARN, arangodb::Logger::REPLICATION)
         << "received a corrupted multipart message";
-    return false;
+    return nullptr;
   }
 
   // split part into header & body
@@ -227,30 +252,48 @@ bool RestBatchHandler::executeNextHandler() {
       generateError(rest::ResponseCode::BAD, TRI_ERROR_INTERNAL,
                     "could not create handler for batch part processing");
 
-      return false;
+      return nullptr;
     }
 
     handler->setIsAsyncRequest();
   }
 
+  return handler;
+}
+
+bool RestBatchHandler::scheduleHandler(
+    std::shared_ptr<RestHandler> handler,
+    std::function<void(RestHandler const&)> callback) {
   // assume a bad lane, so the request is definitely executed via the queues
   auto const lane = RequestLane::CLIENT_V8;
 
   // now schedule the real handler
-  bool ok = SchedulerFeature::SCHEDULER->tryBoundedQueue(
-      lane, [this, self = shared_from_this(), handler]() {
+  return SchedulerFeature::SCHEDULER->tryBoundedQueue(
+      lane, [self = shared_from_this(), handler = std::move(handler),
+             callback = std::move(callback)]() {
         // start to work for this handler
         // ignore any errors here, will be handled later by inspecting the
         // response
         try {
           ExecContextScope scope(nullptr);  // workaround because of assertions
-          handler->runHandler([this, self](RestHandler* handler) {
-            processSubHandlerResult(*handler);
+          handler->runHandler([self, callback](RestHandler* handler) {
+            callback(*handler);
           });
         } catch (...) {
-          processSubHandlerResult(*handler);
+          callback(*handler);
         }
       });
+}
+
+bool RestBatchHandler::executeNextHandler() {
+  auto handler = createNextHandler();
+  if (handler == nullptr) {
+    return false;
+  }
+
+  bool ok = scheduleHandler(std::move(handler), [this](RestHandler const& h) {
+    processSubHandlerResult(h);
+  });
 
   if (!ok) {
     generateError(rest::ResponseCode::SERVICE_UNAVAILABLE,
@@ -261,6 +304,107 @@ bool RestBatchHandler::executeNextHandler() {
   return true;
 }
 
+RestStatus RestBatchHandler::executeParallel() {
+  // create the handlers for all parts upfront, so that any error in the
+  // multipart message is reported before anything is executed
+  do {
+    auto handler = createNextHandler();
+    if (handler == nullptr) {
+      return RestStatus::DONE;
+    }
+    _parts.emplace_back(
+        Part{std::move(handler), _helper.contentId, _helper.contentIdLength});
+  } while (_helper.containsMore);
+
+  size_t const initial = std::min(_parts.size(), maxParallelParts);
+  {
+    std::lock_guard guard{_partsMutex};
+    _nextPart = initial;
+  }
+
+  // further parts are scheduled whenever one of these is done
+  for (size_t i = 0; i < initial; ++i) {
+    scheduleParallelPart(i);
+  }
+
+  // scheduling the parts counts as one part itself. this makes sure that
+  // the response is not assembled by another thread while we are still in
+  // here, and that we do not miss a wakeup if all parts are done already
+  bool done = false;
+  {
+    std::lock_guard guard{_partsMutex};
+    done = ++_completedParts == _parts.size() + 1;
+  }
+  if (done) {
+    finishParallel();
+    return RestStatus::DONE;
+  }
+
+  // and wait for completion
+  return RestStatus::WAITING;
+}
+
+void RestBatchHandler::scheduleParallelPart(size_t index) {
+  while (true) {
+    Part& part = _parts[index];
+    bool ok = scheduleHandler(part.handler, [this](RestHandler const&) {
+      processParallelResult();
+    });
+    if (ok) {
+      return;
+    }
+
+    // the scheduler queue is full. report this for the part only, the
+    // other parts are still executed
+    part.handler->response()->setResponseCode(
+        rest::ResponseCode::SERVICE_UNAVAILABLE);
+    auto [done, next] = completePart();
+    if (done) {
+      finishParallel();
+      wakeupHandler();
+    }
+    if (!next.has_value()) {
+      return;
+    }
+    index = *next;
+  }
+}
+
+std::pair<bool, std::optional<size_t>> RestBatchHandler::completePart() {
+  std::lock_guard guard{_partsMutex};
+
+  TRI_ASSERT(_completedParts <= _parts.size());
+  // the scheduling in executeParallel() counts as an extra part
+  bool const done = ++_completedParts == _parts.size() + 1;
+  if (_nextPart < _parts.size()) {
+    TRI_ASSERT(!done);
+    return {done, _nextPart++};
+  }
+  return {done, std::nullopt};
+}
+
+void RestBatchHandler::processParallelResult() {
+  auto [done, next] = completePart();
+  if (next.has_value()) {
+    scheduleParallelPart(*next);
+  } else if (done) {
+    finishParallel();
+    wakeupHandler();
+  }
+}
+
+void RestBatchHandler::finishParallel() {
+  // all parts are done now. assemble their responses in the order of the
+  // parts in the request
+  for (auto const& part : _parts) {
+    if (!appendPartResponse(*part.handler, part.contentId,
+                            part.contentIdLength)) {
+      return;
+    }
+  }
+  finishResponse();
+}
+
 RestStatus RestBatchHandler::executeHttp() {
   TRI_ASSERT(_response->transportType() == Endpoint::TransportType::HTTP);
 
@@ -300,6 +444,11 @@ RestStatus RestBatchHandler::executeHttp() {
   _helper.message = _multipartMessage;
   _helper.searchStart = _multipartMessage.messageStart;
 
+  if (_request->parsedValue("parallel", false)) {
+    // execute the parts concurrently
+    return executeParallel();
+  }
+
   // and wait for completion
   return executeNextHandler() ? RestStatus::WAITING : RestStatus::DONE;
 }
@@ -26,6 +26,13 @@
 #include "Basics/Common.h"
 #include "RestHandler/RestVocbaseBaseHandler.h"
 
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <utility>
+#include <vector>
+
 namespace arangodb {
 
 // container for complete multipart message
@@ -69,6 +76,8 @@ class RestBatchHandler : public RestVocbaseBaseHandler {
 
  private:
   RestStatus executeHttp();
+  // execute all parts of the multipart message concurrently
+  RestStatus executeParallel();
   RestStatus executeVst();
   // extract the boundary from the body of a multipart message
   bool getBoundaryBody(std::string&);
@@ -83,12 +92,49 @@ class RestBatchHandler : public RestVocbaseBaseHandler {
   bool extractPart(SearchHelper&);
 
  private:
+  // create the handler for the next part of the multipart message
+  std::shared_ptr<RestHandler> createNextHandler();
+
+  // schedule a part handler. the callback is invoked when it is done
+  bool scheduleHandler(std::shared_ptr<RestHandler> handler,
+                       std::function<void(RestHandler const&)> callback);
+
+  // append the response of a part handler to the batch response
+  bool appendPartResponse(RestHandler const& handler, char const* contentId,
+                          size_t contentIdLength);
+
+  // append the final boundary and the error count to the batch response
+  void finishResponse();
+
   bool executeNextHandler();
   void processSubHandlerResult(RestHandler const& handler);
 
+  void scheduleParallelPart(size_t index);
+  // mark a part as completed. returns whether all parts are completed now,
+  // and the index of the part to schedule next, if any
+  std::pair<bool, std::optional<size_t>> completePart();
+  void processParallelResult();
+  // assemble the responses of all parts, in the order of the request
+  void finishParallel();
+
+  // a part of the multipart message, used for parallel execution
+  struct Part {
+    std::shared_ptr<RestHandler> handler;
+    // points into the request body
+    char const* contentId;
+    size_t contentIdLength;
+  };
+
   MultipartMessage _multipartMessage;
   SearchHelper _helper;
   size_t _errors;
   std::string _boundary;
+
+  // parts for parallel execution, in the order of the request
+  std::vector<Part> _parts;
+  // protects _nextPart and _completedParts
+  std::mutex _partsMutex;
+  size_t _nextPart;
+  size_t _completedParts;
 };
 }  // namespace arangodb
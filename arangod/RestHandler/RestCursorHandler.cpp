@@ -24,6 +24,7 @@
 #include "RestCursorHandler.h"
 
 #include "ApplicationFeatures/ApplicationServer.h"
+#include "Aql/PreparedQueryRegistry.h"
 #include "Aql/Query.h"
 #include "Aql/QueryRegistry.h"
 #include "Basics/Exceptions.h"
@@ -34,6 +35,7 @@
 #include "Cluster/ClusterFeature.h"
 #include "Cluster/ClusterInfo.h"
 #include "Cluster/ServerState.h"
+#include "RestServer/QueryRegistryFeature.h"
 #include "StorageEngine/TransactionState.h"
 #include "Transaction/Context.h"
 #include "Utils/Cursor.h"
@@ -159,10 +161,30 @@ RestStatus RestCursorHandler::registerQueryOrCursor(VPackSlice const& slice) {
     generateError(rest::ResponseCode::BAD, TRI_ERROR_QUERY_EMPTY);
     return RestStatus::DONE;
   }
-  VPackSlice const querySlice = slice.get("query");
-  if (!querySlice.isString() || querySlice.getStringLength() == 0) {
-    generateError(rest::ResponseCode::BAD, TRI_ERROR_QUERY_EMPTY);
-    return RestStatus::DONE;
+  // prepared queries are referenced by their id instead of the query string
+  std::shared_ptr<aql::PreparedQueryRegistry::Entry const> preparedQuery;
+  std::string_view queryString;
+  if (VPackSlice id = slice.get("preparedQuery"); !id.isNone()) {
+    auto* registry =
+        server().getFeature<QueryRegistryFeature>().preparedQueryRegistry();
+    if (registry != nullptr && id.isString()) {
+      preparedQuery =
+          registry->lookup(basics::StringUtils::uint64(id.stringView()),
+                           _vocbase.name(), _request->user());
+    }
+    if (preparedQuery == nullptr) {
+      generateError(rest::ResponseCode::NOT_FOUND, TRI_ERROR_QUERY_NOT_FOUND,
+                    "prepared query not found");
+      return RestStatus::DONE;
+    }
+    queryString = preparedQuery->queryString;
+  } else {
+    VPackSlice const querySlice = slice.get("query");
+    if (!querySlice.isString() || querySlice.getStringLength() == 0) {
+      generateError(rest::ResponseCode::BAD, TRI_ERROR_QUERY_EMPTY);
+      return RestStatus::DONE;
+    }
+    queryString = querySlice.stringView();
   }
 
   VPackSlice const bindVars = slice.get("bindVars");
@@ -199,7 +221,7 @@ RestStatus RestCursorHandler::registerQueryOrCursor(VPackSlice const& slice) {
   const AccessMode::Type mode = AccessMode::Type::WRITE;
   auto query =
       aql::Query::create(createTransactionContext(mode),
-                         arangodb::aql::QueryString(querySlice.stringView()),
+                         arangodb::aql::QueryString(queryString),
                          std::move(bindVarsBuilder), aql::QueryOptions(opts));
 
   if (stream) {
@@ -385,6 +407,7 @@ ResultT<std::pair<std::string, bool>> RestCursorHandler::forwardingTarget() {
   if (type != rest::RequestType::POST && type != rest::RequestType::PUT &&
       type != rest::RequestType::DELETE_REQ) {
     // request forwarding only exists for
+    // POST /_api/cursor (with a prepared query)
     // POST /_api/cursor/cursor-id
     // PUT /_api/cursor/cursor-id
     // DELETE /_api/cursor/cursor-id
@@ -392,11 +415,30 @@ ResultT<std::pair<std::string, bool>> RestCursorHandler::forwardingTarget() {
   }
 
   std::vector<std::string> const& suffixes = _request->suffixes();
+  uint64_t tick = 0;
   if (suffixes.empty()) {
-    return {std::make_pair(StaticStrings::Empty, false)};
+    if (type != rest::RequestType::POST) {
+      return {std::make_pair(StaticStrings::Empty, false)};
+    }
+    // POST /_api/cursor for a prepared query must be handled by the
+    // coordinator that holds the prepared query
+    try {
+      VPackSlice body = _request->payload(true);
+      if (VPackSlice id = body.isObject() ? body.get("preparedQuery")
+                                          : VPackSlice::noneSlice();
+          id.isString()) {
+        tick = arangodb::basics::StringUtils::uint64(id.stringView());
+      }
+    } catch (...) {
+      // invalid request bodies are reported when the request is executed
+    }
+    if (tick == 0) {
+      return {std::make_pair(StaticStrings::Empty, false)};
+    }
+  } else {
+    tick = arangodb::basics::StringUtils::uint64(suffixes[0]);
   }
 
-  uint64_t tick = arangodb::basics::StringUtils::uint64(suffixes[0]);
   uint32_t sourceServer = TRI_ExtractServerIdFromTick(tick);
 
   if (sourceServer == ServerState::instance()->getShortId()) {
@@ -788,6 +830,9 @@ void RestCursorHandler::lookupCursor(std::string_view id,
 void RestCursorHandler::releaseCursor() {
   if (_cursor) {
     _cursor->resetWakeupHandler();
+    // the response for this batch is about to be sent. overlap sending it
+    // and processing it on the client with computing the next batch
+    _cursor->prefetchNextBatch();
 
     auto cursors = _vocbase.cursorRepository();
     TRI_ASSERT(cursors != nullptr);
@@ -35,6 +35,8 @@
 #include "StorageEngine/TransactionState.h"
 #include "Transaction/Helpers.h"
 #include "Transaction/Hints.h"
+#include "Transaction/InsertBatcher.h"
+#include "Transaction/ManagerFeature.h"
 #include "Transaction/Options.h"
 #include "Transaction/StandaloneContext.h"
 #include "Utils/Events.h"
@@ -101,6 +103,15 @@ RestStatus RestDocumentHandler::execute() {
     }
   }
 #endif
+  if (ServerState::instance()->isDBServer()) {
+    bool found = false;
+    std::string const& shardMapVersion =
+        _request->header(StaticStrings::ShardMapVersion, found);
+    if (found && !checkShardMapRouting(shardMapVersion)) {
+      return RestStatus::DONE;
+    }
+  }
+
   // execute one of the CRUD methods
   switch (type) {
     case rest::RequestType::DELETE_REQ:
@@ -124,6 +135,95 @@ RestStatus RestDocumentHandler::execute() {
   return RestStatus::DONE;
 }
 
+bool RestDocumentHandler::checkShardMapRouting(
+    std::string const& clientVersion) {
+  TRI_ASSERT(ServerState::instance()->isDBServer());
+  auto& ci = server().getFeature<ClusterFeature>().clusterInfo();
+  uint64_t version = ci.getPlanVersion();
+  // always report our own view of the Plan, so that the client can tell
+  // when its shard map is outdated
+  _response->setHeaderNC(StaticStrings::ShardMapVersion,
+                         std::to_string(version));
+
+  std::vector<std::string> const& suffixes = _request->decodedSuffixes();
+  if (suffixes.empty() || suffixes.size() > 2) {
+    generateError(rest::ResponseCode::BAD, TRI_ERROR_BAD_PARAMETER,
+                  "routed requests must address a single document");
+    return false;
+  }
+  auto const& shard = suffixes[0];
+
+  if (StringUtils::uint64(clientVersion) > version) {
+    // the client has seen a newer Plan than we have. our view of the
+    // shard's leadership may be outdated
+    generateError(rest::ResponseCode::MISDIRECTED_REQUEST,
+                  TRI_ERROR_CLUSTER_NOT_LEADER,
+                  "shard map is newer than the local Plan");
+    return false;
+  }
+  if (ci.getShardLeadership(ServerState::instance()->getId(), shard) !=
+      ClusterInfo::ShardLeadership::kLeader) {
+    generateError(rest::ResponseCode::MISDIRECTED_REQUEST,
+                  TRI_ERROR_CLUSTER_NOT_LEADER,
+                  "not the leader for shard '" + shard + "'");
+    return false;
+  }
+
+  auto collection = ci.getCollectionNT(_request->databaseName(),
+                                       ci.getCollectionNameForShard(shard));
+  if (collection == nullptr || collection->isSmart()) {
+    generateError(rest::ResponseCode::MISDIRECTED_REQUEST,
+                  TRI_ERROR_CLUSTER_SHARD_GONE,
+                  "cannot route requests for shard '" + shard + "'");
+    return false;
+  }
+
+  // the document key determines the responsible shard. without it, we
+  // would execute operations that the cluster cannot find again later
+  VPackSlice document = VPackSlice::emptyObjectSlice();
+  std::string_view key;
+  if (suffixes.size() == 2) {
+    key = suffixes[1];
+  } else if (_request->requestType() == rest::RequestType::POST) {
+    bool success = false;
+    document = parseVPackBody(success);
+    if (!success) {
+      return false;
+    }
+    if (!document.isObject() || !document.get(StaticStrings::KeyString)
+                                     .isString()) {
+      generateError(rest::ResponseCode::BAD, TRI_ERROR_BAD_PARAMETER,
+                    "routed inserts must contain a single document with a "
+                    "_key attribute");
+      return false;
+    }
+  }
+  if (key.empty() && document.isEmptyObject()) {
+    generateError(rest::ResponseCode::BAD, TRI_ERROR_BAD_PARAMETER,
+                  "routed requests must address a single document");
+    return false;
+  }
+  if (!collection->usesDefaultShardKeys() && suffixes.size() == 2) {
+    // the shard cannot be determined from the key alone
+    generateError(rest::ResponseCode::MISDIRECTED_REQUEST,
+                  TRI_ERROR_CLUSTER_NOT_ALL_SHARDING_ATTRIBUTES_GIVEN,
+                  "routing by key requires sharding by _key");
+    return false;
+  }
+
+  ShardID responsible;
+  bool usesDefaultShardKeys = false;
+  auto res = collection->getResponsibleShard(document, /*docComplete*/ true,
+                                             responsible, usesDefaultShardKeys,
+                                             key);
+  if (res != TRI_ERROR_NO_ERROR || responsible != shard) {
+    generateError(rest::ResponseCode::BAD, TRI_ERROR_CLUSTER_SHARD_GONE,
+                  "document does not belong to shard '" + shard + "'");
+    return false;
+  }
+  return true;
+}
+
 void RestDocumentHandler::shutdownExecute(bool isFinalized) noexcept {
   if (isFinalized) {
     // reset the transaction so it releases all locks as early as possible
@@ -239,6 +339,34 @@ RestStatus RestDocumentHandler::insertDocument() {
   }
 
   bool const isMultiple = body.isArray();
+
+  bool hasTrxId = false;
+  _request->header(StaticStrings::TransactionId, hasTrxId);
+  if (auto* batcher = server()
+                          .getFeature<transaction::ManagerFeature>()
+                          .insertBatcher();
+      batcher != nullptr && body.isObject() && !hasTrxId &&
+      opOptions.isSynchronousReplicationFrom.empty() && !opOptions.isRestore &&
+      opOptions.validate && !opOptions.returnNew && !opOptions.returnOld &&
+      opOptions.overwriteMode == OperationOptions::OverwriteMode::None &&
+      opOptions.refillIndexCaches == RefillIndexCaches::kDefault) {
+    // plain single-document insert outside of a Stream Transaction. this
+    // can be combined with concurrent inserts into the same collection
+    auto collection = _vocbase.lookupCollection(cname);
+    if (collection != nullptr) {
+      OperationResult opres =
+          batcher->insert(_vocbase, *collection, body, opOptions);
+      if (opres.fail()) {
+        generateTransactionError(cname, opres);
+      } else {
+        generate20x(opres, cname, collection->type(),
+                    &velocypack::Options::Defaults, isMultiple,
+                    opOptions.silent, rest::ResponseCode::CREATED);
+      }
+      return RestStatus::DONE;
+    }
+    // collection not found. let the regular code path produce the error
+  }
   transaction::Options trxOpts;
   trxOpts.delaySnapshot = !isMultiple;  // for now we only enable this for
                                         // single document operations
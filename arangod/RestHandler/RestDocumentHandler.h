@@ -75,6 +75,11 @@ class RestDocumentHandler : public RestVocbaseBaseHandler {
 
   void handleFillIndexCachesValue(OperationOptions& options);
 
+  // validates a request that a client has sent directly to a DB-Server,
+  // based on a shard map it got from a coordinator. returns false and
+  // generates an error response if the request must not be executed here
+  bool checkShardMapRouting(std::string const& clientVersion);
+
   void addTransactionHints(std::string const& collectionName, bool isMultiple,
                            bool isOverwritingInsert);
 
@@ -56,9 +56,11 @@ RestDumpHandler::RestDumpHandler(ArangodServer& server, GeneralRequest* request,
 
 // main function that dispatches the different routes and commands
 RestStatus RestDumpHandler::execute() {
-  if (!ServerState::instance()->isDBServer()) {
-    generateError(Result(TRI_ERROR_HTTP_NOT_IMPLEMENTED,
-                         "api only expected to be called on dbservers"));
+  if (!ServerState::instance()->isDBServer() &&
+      !ServerState::instance()->isSingleServer()) {
+    generateError(Result(
+        TRI_ERROR_HTTP_NOT_IMPLEMENTED,
+        "api only expected to be called on single servers and dbservers"));
     return RestStatus::DONE;
   }
 
@@ -228,6 +230,13 @@ void RestDumpHandler::handleCommandDumpFinished() {
 }
 
 std::string RestDumpHandler::getAuthorizedUser() const {
+  if (ServerState::instance()->isSingleServer()) {
+    // requests are not forwarded on a single server, so the user is the one
+    // that sent the request. never trust the header here, as it is under
+    // control of the client.
+    return _request->user();
+  }
+
   bool headerExtracted;
   auto user = _request->header(StaticStrings::DumpAuthUser, headerExtracted);
   if (!headerExtracted) {
@@ -274,8 +283,12 @@ Result RestDumpHandler::validateRequest() {
         velocypack::deserializeUnsafe(body, opts);
 
         for (auto const& it : opts.shards) {
-          // get collection name
-          auto collectionName = _clusterInfo.getCollectionNameForShard(it);
+          // get collection name. on a single server, the "shards" are the
+          // collections themselves
+          auto collectionName =
+              ServerState::instance()->isSingleServer()
+                  ? it
+                  : _clusterInfo.getCollectionNameForShard(it);
           if (!ExecContext::current().canUseCollection(
                   _request->databaseName(), collectionName, auth::Level::RO)) {
             return {TRI_ERROR_FORBIDDEN,
@@ -28,6 +28,10 @@
 #include "Basics/VelocyPackHelper.h"
 #include "Cluster/ServerState.h"
 #include "Logger/Logger.h"
+#include "RocksDBEngine/RocksDBEngine.h"
+#include "Scheduler/Scheduler.h"
+#include "Scheduler/SchedulerFeature.h"
+#include "StorageEngine/EngineSelectorFeature.h"
 #include "Transaction/Helpers.h"
 #include "Transaction/StandaloneContext.h"
 #include "Utils/CollectionNameResolver.h"
@@ -1003,6 +1007,35 @@ void RestImportHandler::generateDocumentsCreated(
     builder.close();
   }
 
+  // include hints about the server load, so that clients can adjust their
+  // batch sizes and concurrency?
+  if (_request->parsedValue("backPressure", false)) {
+    builder.add("backPressure", VPackValue(VPackValueType::Object));
+    // coordinators do not write any data themselves, so the write stall
+    // state is only known on single servers and DB servers
+    bool writesStalled = false;
+    if (!ServerState::instance()->isCoordinator()) {
+      writesStalled = server()
+                          .getFeature<EngineSelectorFeature>()
+                          .engine<RocksDBEngine>()
+                          .writesStalled();
+    }
+    builder.add("writesStalled", VPackValue(writesStalled));
+
+    uint64_t queued = 0;
+    double queueTime = 0.0;
+    if (SchedulerFeature::SCHEDULER != nullptr) {
+      queued = SchedulerFeature::SCHEDULER->queueStatistics()._queued;
+      queueTime = static_cast<double>(
+                      SchedulerFeature::SCHEDULER
+                          ->getLastLowPriorityDequeueTime()) /
+                  1000.0;
+    }
+    builder.add("queued", VPackValue(queued));
+    builder.add("queueTime", VPackValue(queueTime));
+    builder.close();
+  }
+
   builder.close();
 
   generateResult(rest::ResponseCode::CREATED, builder.slice());
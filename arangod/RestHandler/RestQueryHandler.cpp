@@ -25,6 +25,7 @@
 
 #include "ApplicationFeatures/ApplicationServer.h"
 #include "Aql/OptimizerRulesFeature.h"
+#include "Aql/PreparedQueryRegistry.h"
 #include "Aql/Query.h"
 #include "Aql/QueryList.h"
 #include "Basics/StringUtils.h"
@@ -33,6 +34,7 @@
 #include "Cluster/ClusterInfo.h"
 #include "Cluster/ClusterMethods.h"
 #include "Cluster/ServerState.h"
+#include "RestServer/QueryRegistryFeature.h"
 #include "Transaction/Helpers.h"
 #include "Transaction/StandaloneContext.h"
 #include "VocBase/Methods/Queries.h"
@@ -54,9 +56,14 @@ RestStatus RestQueryHandler::execute() {
 
   // execute one of the CRUD methods
   switch (type) {
-    case rest::RequestType::DELETE_REQ:
-      deleteQuery();
-      break;
+    case rest::RequestType::DELETE_REQ: {
+      auto const& suffixes = _request->suffixes();
+      if (suffixes.size() == 2 && suffixes[0] == "prepare") {
+        removePreparedQuery();
+      } else {
+        deleteQuery();
+      }
+    } break;
     case rest::RequestType::GET: {
       auto const& suffixes = _request->suffixes();
       if (suffixes.size() == 1 && suffixes[0] == "rules") {
@@ -68,9 +75,14 @@ RestStatus RestQueryHandler::execute() {
     case rest::RequestType::PUT:
       replaceProperties();
       break;
-    case rest::RequestType::POST:
-      parseQuery();
-      break;
+    case rest::RequestType::POST: {
+      auto const& suffixes = _request->suffixes();
+      if (suffixes.size() == 1 && suffixes[0] == "prepare") {
+        prepareQuery();
+      } else {
+        parseQuery();
+      }
+    } break;
     default:
       generateNotImplemented("ILLEGAL /_api/query");
       break;
@@ -358,6 +370,98 @@ void RestQueryHandler::parseQuery() {
   generateResult(rest::ResponseCode::OK, result.slice());
 }
 
+void RestQueryHandler::prepareQuery() {
+  auto* registry =
+      server().getFeature<QueryRegistryFeature>().preparedQueryRegistry();
+  if (registry == nullptr) {
+    generateError(rest::ResponseCode::NOT_IMPLEMENTED,
+                  TRI_ERROR_NOT_IMPLEMENTED, "prepared queries are turned off");
+    return;
+  }
+
+  bool parseSuccess = false;
+  VPackSlice body = this->parseVPackBody(parseSuccess);
+  if (!parseSuccess) {
+    // error message generated in parseVPackBody
+    return;
+  }
+
+  if (!body.isObject()) {
+    generateError(rest::ResponseCode::BAD, TRI_ERROR_HTTP_BAD_PARAMETER,
+                  "expecting a JSON object as body");
+    return;
+  }
+
+  std::string queryString =
+      VelocyPackHelper::checkAndGetStringValue(body, "query");
+
+  // parse the query once, so that syntax errors are reported right away
+  // and not only when the prepared query is executed
+  auto query = Query::create(transaction::StandaloneContext::Create(_vocbase),
+                             QueryString(queryString), nullptr);
+  auto parseResult = query->parse();
+
+  if (parseResult.result.fail()) {
+    generateError(parseResult.result);
+    return;
+  }
+
+  auto id = registry->insert(_vocbase.name(), _request->user(),
+                             std::move(queryString));
+  if (id.fail()) {
+    generateError(id.result());
+    return;
+  }
+
+  VPackBuilder result;
+  {
+    VPackObjectBuilder b(&result);
+    result.add(StaticStrings::Error, VPackValue(false));
+    result.add(StaticStrings::Code,
+               VPackValue((int)rest::ResponseCode::CREATED));
+    result.add("id", VPackValue(std::to_string(id.get())));
+
+    result.add("collections", VPackValue(VPackValueType::Array));
+    for (auto const& it : parseResult.collectionNames) {
+      result.add(VPackValue(it));
+    }
+    result.close();  // collections
+
+    result.add("bindVars", VPackValue(VPackValueType::Array));
+    for (auto const& it : parseResult.bindParameters) {
+      result.add(VPackValue(it));
+    }
+    result.close();  // bindVars
+  }
+
+  generateResult(rest::ResponseCode::CREATED, result.slice());
+}
+
+void RestQueryHandler::removePreparedQuery() {
+  auto const& suffixes = _request->suffixes();
+  TRI_ASSERT(suffixes.size() == 2);
+
+  auto* registry =
+      server().getFeature<QueryRegistryFeature>().preparedQueryRegistry();
+  uint64_t id = basics::StringUtils::uint64(suffixes[1]);
+  if (registry == nullptr ||
+      !registry->remove(id, _vocbase.name(), _request->user())) {
+    generateError(rest::ResponseCode::NOT_FOUND, TRI_ERROR_QUERY_NOT_FOUND,
+                  "prepared query not found");
+    return;
+  }
+
+  VPackBuilder result;
+  {
+    VPackObjectBuilder b(&result);
+    result.add(StaticStrings::Error, VPackValue(false));
+    result.add(StaticStrings::Code, VPackValue((int)rest::ResponseCode::OK));
+    result.add("id", VPackValue(suffixes[1]));
+  }
+
+  generateResult(rest::ResponseCode::OK, result.slice());
+}
+
 /// @brief returns the short id of the server which should handle this request
 ResultT<std::pair<std::string, bool>> RestQueryHandler::forwardingTarget() {
   TRI_ASSERT(ServerState::instance()->isCoordinator());
@@ -368,10 +472,11 @@ ResultT<std::pair<std::string, bool>> RestQueryHandler::forwardingTarget() {
   }
 
   if (_request->requestType() == RequestType::DELETE_REQ) {
-    // kill operation
+    // kill operation or removal of a prepared query
     auto const& suffixes = _request->suffixes();
     TRI_ASSERT(suffixes.size() >= 1);
-    auto const& id = suffixes[0];
+    bool prepared = suffixes.size() == 2 && suffixes[0] == "prepare";
+    auto const& id = prepared ? suffixes[1] : suffixes[0];
     if (id != "slow") {
       uint64_t tick = basics::StringUtils::uint64(id);
       uint32_t sourceServer = TRI_ExtractServerIdFromTick(tick);
@@ -69,6 +69,12 @@ class RestQueryHandler : public RestVocbaseBaseHandler {
   /// @brief parses a query
   void parseQuery();
 
+  /// @brief registers a prepared query
+  void prepareQuery();
+
+  /// @brief removes a prepared query
+  void removePreparedQuery();
+
   /// @brief returns the available optimizer rules
   void handleAvailableOptimizerRules();
 };
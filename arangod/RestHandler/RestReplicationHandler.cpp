@@ -1349,12 +1349,66 @@ Result RestReplicationHandler::parseBatch(
   bool const isUsersCollection =
       collectionName == StaticStrings::UsersCollection;
 
-  std::string_view bodyStr = _request->rawPayload();
-  char const* ptr = bodyStr.data();
-  char const* end = ptr + bodyStr.size();
+  // copies a document into documentsToInsert, leaving out the attributes
+  // that must not be restored
+  auto addDocument = [&](VPackSlice doc) {
+    documentsToInsert.openObject();
+
+    TRI_ASSERT(doc.isObject());
+    bool checkKey = true;
+    bool checkRev = generateNewRevisionIds;
+    for (auto it : VPackObjectIterator(doc, true)) {
+      // only check for "_key" attribute here if we still have to.
+      // once we have seen it, it will not show up again in the same
+      // document
+      bool const isKey =
+          checkKey && (it.key.stringView() == StaticStrings::KeyString);
+
+      if (isKey) {
+        // _key attribute
+
+        // prevent checking for _key twice in the same document
+        checkKey = false;
+
+        if (isUsersCollection) {
+          // ignore _key for _users
+          continue;
+        }
+        if (!documentsToRemove.empty()) {
+          // for any document key that we have tracked in documentsToRemove,
+          // we now got a new version to insert, so we need to remove the
+          // key from documentsToRemove. this is expensive, but we only have
+          // to pay for it if there are REPLICATION_MARKER_REMOVE markers
+          // present, which can only happen with MMFiles dumps from <= 3.6
+          documentsToRemove.erase(it.value.copyString());
+        }
 
-  VPackBuilder builder(
-      &basics::VelocyPackHelper::strictRequestValidationOptions);
+        documentsToInsert.add(it.key);
+        documentsToInsert.add(it.value);
+      } else if (checkRev &&
+                 (it.key.stringView() == StaticStrings::RevString)) {
+        // _rev attribute
+
+        // prevent checking for _rev twice in the same document
+        checkRev = false;
+
+        // We simply get rid of the `_rev` attribute here on the
+        // coordinator. We need to create a new value but it has to be
+        // unique in the shard, therefore the shard leader must create the
+        // value. If multiple coordinators would create a timestamp based
+        // _rev value concurrently, we could get a duplicate, which would
+        // lead to a clash on the actual shard leader and can lead to
+        // RocksDB conflicts or even data corruption between primary index
+        // and data in the documents column family.
+      } else {
+        // copy key/value verbatim
+        documentsToInsert.add(it.key);
+        documentsToInsert.add(it.value);
+      }
+    }
+
+    documentsToInsert.close();
+  };
 
   // First parse and collect all markers, we assemble everything in one
   // large builder holding an array
@@ -1362,6 +1416,35 @@ Result RestReplicationHandler::parseBatch(
   documentsToInsert.clear();
   documentsToInsert.openArray();
 
+  if (_request->contentType() == ContentType::VPACK) {
+    // binary dump format (arangodump --binary-format): the body is a
+    // single VelocyPack array with all documents of the batch, which we
+    // can take over without parsing any JSON
+    VPackSlice documents = _request->payload(/*strictValidation*/ true);
+    if (!documents.isArray()) {
+      return Result{TRI_ERROR_HTTP_BAD_PARAMETER,
+                    "received invalid VelocyPack data for collection '" +
+                        collectionName + "': data is no array"};
+    }
+    for (VPackSlice doc : VPackArrayIterator(documents)) {
+      if (!doc.isObject() || !doc.get(StaticStrings::KeyString).isString()) {
+        return Result{TRI_ERROR_HTTP_BAD_PARAMETER,
+                      "received invalid VelocyPack data for collection '" +
+                          collectionName + "': invalid document"};
+      }
+      addDocument(doc);
+    }
+    documentsToInsert.close();
+    return {};
+  }
+
+  std::string_view bodyStr = _request->rawPayload();
+  char const* ptr = bodyStr.data();
+  char const* end = ptr + bodyStr.size();
+
+  VPackBuilder builder(
+      &basics::VelocyPackHelper::strictRequestValidationOptions);
+
   int line = 0;
   while (ptr < end) {
     char const* pos = strchr(ptr, '\n');
@@ -1397,62 +1480,7 @@ Result RestReplicationHandler::parseBatch(
 
       // Put into array of all parsed markers:
       if (type == REPLICATION_MARKER_DOCUMENT) {
-        documentsToInsert.openObject();
-
-        TRI_ASSERT(doc.isObject());
-        bool checkKey = true;
-        bool checkRev = generateNewRevisionIds;
-        for (auto it : VPackObjectIterator(doc, true)) {
-          // only check for "_key" attribute here if we still have to.
-          // once we have seen it, it will not show up again in the same
-          // document
-          bool const isKey =
-              checkKey && (it.key.stringView() == StaticStrings::KeyString);
-
-          if (isKey) {
-            // _key attribute
-
-            // prevent checking for _key twice in the same document
-            checkKey = false;
-
-            if (isUsersCollection) {
-              // ignore _key for _users
-              continue;
-            }
-            if (!documentsToRemove.empty()) {
-              // for any document key that we have tracked in documentsToRemove,
-              // we now got a new version to insert, so we need to remove the
-              // key from documentsToRemove. this is expensive, but we only have
-              // to pay for it if there are REPLICATION_MARKER_REMOVE markers
-              // present, which can only happen with MMFiles dumps from <= 3.6
-              documentsToRemove.erase(it.value.copyString());
-            }
-
-            documentsToInsert.add(it.key);
-            documentsToInsert.add(it.value);
-          } else if (checkRev &&
-                     (it.key.stringView() == StaticStrings::RevString)) {
-            // _rev attribute
-
-            // prevent checking for _rev twice in the same document
-            checkRev = false;
-
-            // We simply get rid of the `_rev` attribute here on the
-            // coordinator. We need to create a new value but it has to be
-            // unique in the shard, therefore the shard leader must create the
-            // value. If multiple coordinators would create a timestamp based
-            // _rev value concurrently, we could get a duplicate, which would
-            // lead to a clash on the actual shard leader and can lead to
-            // RocksDB conflicts or even data corruption between primary index
-            // and data in the documents column family.
-          } else {
-            // copy key/value verbatim
-            documentsToInsert.add(it.key);
-            documentsToInsert.add(it.value);
-          }
-        }
-
-        documentsToInsert.close();
+        addDocument(doc);
       } else if (type == REPLICATION_MARKER_REMOVE) {
         // keep track of which documents to remove.
         // in case we add a document to remove here that is already in
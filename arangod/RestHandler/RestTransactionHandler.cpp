@@ -31,6 +31,7 @@
 #include "Cluster/ClusterFeature.h"
 #include "Cluster/ClusterInfo.h"
 #include "Cluster/ServerState.h"
+#include "Replication2/coro-helper.h"
 #include "StorageEngine/EngineSelectorFeature.h"
 #include "Transaction/Helpers.h"
 #include "Transaction/Manager.h"
@@ -55,7 +56,7 @@ RestTransactionHandler::RestTransactionHandler(ArangodServer& server,
       _v8Context(nullptr),
       _lock() {}
 
-RestStatus RestTransactionHandler::execute() {
+futures::Future<futures::Unit> RestTransactionHandler::executeAsync() {
   switch (_request->requestType()) {
     case rest::RequestType::POST:
       if (_request->suffixes().size() == 1 &&
@@ -69,11 +70,11 @@ RestStatus RestTransactionHandler::execute() {
       break;
 
     case rest::RequestType::PUT:
-      executeCommit();
+      co_await executeCommit();
       break;
 
     case rest::RequestType::DELETE_REQ:
-      executeAbort();
+      co_await executeAbort();
       break;
 
     case rest::RequestType::GET:
@@ -85,7 +86,7 @@ RestStatus RestTransactionHandler::execute() {
                     TRI_ERROR_HTTP_METHOD_NOT_ALLOWED);
       break;
   }
-  return RestStatus::DONE;
+  co_return futures::Unit{};
 }
 
 void RestTransactionHandler::executeGetState() {
@@ -214,35 +215,37 @@ void RestTransactionHandler::executeBegin() {
   }
 }
 
-void RestTransactionHandler::executeCommit() {
+futures::Future<futures::Unit> RestTransactionHandler::executeCommit() {
   if (_request->suffixes().size() != 1) {
     generateError(rest::ResponseCode::BAD, TRI_ERROR_BAD_PARAMETER);
-    return;
+    co_return futures::Unit{};
   }
 
   TransactionId tid{basics::StringUtils::uint64(_request->suffixes()[0])};
   if (tid.empty()) {
     generateError(rest::ResponseCode::BAD, TRI_ERROR_BAD_PARAMETER,
                   "bad transaction ID");
-    return;
+    co_return futures::Unit{};
   }
 
   transaction::Manager* mgr = transaction::ManagerFeature::manager();
   TRI_ASSERT(mgr != nullptr);
 
-  Result res = mgr->commitManagedTrx(tid, _vocbase.name());
+  Result res = co_await futures::asResult(
+      mgr->commitManagedTrxAsync(tid, _vocbase.name()));
   if (res.fail()) {
     generateError(res);
   } else {
     generateTransactionResult(rest::ResponseCode::OK, tid,
                               transaction::Status::COMMITTED);
   }
+  co_return futures::Unit{};
 }
 
-void RestTransactionHandler::executeAbort() {
+futures::Future<futures::Unit> RestTransactionHandler::executeAbort() {
   if (_request->suffixes().size() != 1) {
     generateError(rest::ResponseCode::BAD, TRI_ERROR_BAD_PARAMETER);
-    return;
+    co_return futures::Unit{};
   }
 
   transaction::Manager* mgr = transaction::ManagerFeature::manager();
@@ -265,10 +268,11 @@ void RestTransactionHandler::executeAbort() {
     if (tid.empty()) {
       generateError(rest::ResponseCode::BAD, TRI_ERROR_BAD_PARAMETER,
                     "bad transaction ID");
-      return;
+      co_return futures::Unit{};
     }
 
-    Result res = mgr->abortManagedTrx(tid, _vocbase.name());
+    Result res = co_await futures::asResult(
+        mgr->abortManagedTrxAsync(tid, _vocbase.name()));
 
     if (res.fail()) {
       generateError(res);
@@ -277,6 +281,7 @@ void RestTransactionHandler::executeAbort() {
                                 transaction::Status::ABORTED);
     }
   }
+  co_return futures::Unit{};
 }
 
 void RestTransactionHandler::generateTransactionResult(
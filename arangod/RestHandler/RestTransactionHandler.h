@@ -58,17 +58,17 @@ class RestTransactionHandler : public arangodb::RestVocbaseBaseHandler {
     }
     return RequestLane::CLIENT_V8;
   }
-  RestStatus execute() override;
   void cancel() override final;
 
  protected:
   virtual ResultT<std::pair<std::string, bool>> forwardingTarget() override;
+  futures::Future<futures::Unit> executeAsync() override;
 
  private:
   void executeGetState();
   void executeBegin();
-  void executeCommit();
-  void executeAbort();
+  futures::Future<futures::Unit> executeCommit();
+  futures::Future<futures::Unit> executeAbort();
   void generateTransactionResult(rest::ResponseCode code, TransactionId tid,
                                  transaction::Status status);
 
@@ -215,6 +215,11 @@ std::string const RestVocbaseBaseHandler::VIEW_PATH = "/_api/view";
 std::string const RestVocbaseBaseHandler::INTERNAL_TRAVERSER_PATH =
     "/_internal/traverser";
 
+/// @brief Internal document batch path
+
+std::string const RestVocbaseBaseHandler::INTERNAL_DOCUMENT_BATCH_PATH =
+    "/_internal/document-batch";
+
 RestVocbaseBaseHandler::RestVocbaseBaseHandler(ArangodServer& server,
                                                GeneralRequest* request,
                                                GeneralResponse* response)
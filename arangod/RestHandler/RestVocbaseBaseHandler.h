@@ -126,6 +126,9 @@ class RestVocbaseBaseHandler : public RestBaseHandler {
   /// @brief Internal Traverser path
   static std::string const INTERNAL_TRAVERSER_PATH;
 
+  /// @brief Internal document batch path
+  static std::string const INTERNAL_DOCUMENT_BATCH_PATH;
+
   RestVocbaseBaseHandler(ArangodServer&, GeneralRequest*, GeneralResponse*);
   ~RestVocbaseBaseHandler();
 
@@ -37,6 +37,7 @@
 #include "Replication/ReplicationClients.h"
 #include "Replication/ReplicationFeature.h"
 #include "Replication/Syncer.h"
+#include "Replication/WalTailingCache.h"
 #include "Replication/common-defines.h"
 #include "Replication/utilities.h"
 #include "Rest/HttpResponse.h"
@@ -76,6 +77,26 @@ struct MyTypeHandler final : public VPackCustomTypeHandler {
   CollectionNameResolver resolver;
 };
 
+namespace {
+/// @brief key for the WAL tailing cache. contains all filter values that
+/// influence the tailing response
+std::string tailingCacheKey(WalAccess::Filter const& filter,
+                            size_t chunkSize) {
+  TRI_ASSERT(filter.transactionIds.empty());
+  std::string key;
+  for (uint64_t value :
+       {filter.vocbase, filter.collection.id(), filter.tickStart,
+        filter.tickLastScanned, filter.tickEnd,
+        static_cast<uint64_t>(chunkSize)}) {
+    key.append(std::to_string(value));
+    key.push_back('/');
+  }
+  key.push_back(filter.includeSystem ? '1' : '0');
+  key.push_back(filter.includeFoxxQueues ? '1' : '0');
+  return key;
+}
+}  // namespace
+
 RestWalAccessHandler::RestWalAccessHandler(ArangodServer& server,
                                            GeneralRequest* request,
                                            GeneralResponse* response)
@@ -367,22 +388,58 @@ void RestWalAccessHandler::handleCommandTail(WalAccess const* wal) {
                                      "invalid response type");
     }
     basics::StringBuffer& buffer = httpResponse->body();
-    basics::VPackStringBufferAdapter adapter(buffer.stringBuffer());
-    // note: we need the CustomTypeHandler here
-    VPackDumper dumper(&adapter, &opts);
-    result = wal->tail(
-        filter, chunkSize, [&](TRI_vocbase_t* vocbase, VPackSlice marker) {
-          length++;
 
-          if (vocbase != nullptr) {  // database drop has no vocbase
-            prepOpts(*vocbase);
-          }
+    // responses for the same WAL range can be shared by all clients that
+    // request it. requests for specific transactions (PUT) are not cached
+    auto& cache = rf.walTailingCache();
+    bool const useCache =
+        _request->requestType() == arangodb::rest::RequestType::GET &&
+        cache.enabled();
+    std::string cacheKey;
+    std::shared_ptr<WalTailingCache::Entry const> cached;
+    if (useCache) {
+      cacheKey = ::tailingCacheKey(filter, chunkSize);
+      cached = cache.lookup(cacheKey, WalTailingCache::clock::now());
+    }
 
-          dumper.dump(marker);
-          buffer.appendChar('\n');
-          // LOG_TOPIC("cda47", INFO, Logger::REPLICATION) <<
-          // marker.toJson(&opts);
-        });
+    if (cached != nullptr) {
+      buffer.appendText(cached->body);
+      length = cached->numMarkers;
+      result.reset(TRI_ERROR_NO_ERROR, cached->fromTickIncluded,
+                   cached->lastIncludedTick, cached->lastScannedTick,
+                   cached->latestTick);
+    } else {
+      basics::VPackStringBufferAdapter adapter(buffer.stringBuffer());
+      // note: we need the CustomTypeHandler here
+      VPackDumper dumper(&adapter, &opts);
+      result = wal->tail(
+          filter, chunkSize, [&](TRI_vocbase_t* vocbase, VPackSlice marker) {
+            length++;
+
+            if (vocbase != nullptr) {  // database drop has no vocbase
+              prepOpts(*vocbase);
+            }
+
+            dumper.dump(marker);
+            buffer.appendChar('\n');
+            // LOG_TOPIC("cda47", INFO, Logger::REPLICATION) <<
+            // marker.toJson(&opts);
+          });
+
+      // empty responses are not cached, so that clients which have caught
+      // up see new WAL data immediately
+      if (useCache && result.ok() && length > 0) {
+        auto entry = std::make_shared<WalTailingCache::Entry>();
+        entry->body.assign(buffer.data(), buffer.size());
+        entry->numMarkers = length;
+        entry->fromTickIncluded = result.fromTickIncluded();
+        entry->lastIncludedTick = result.lastIncludedTick();
+        entry->lastScannedTick = result.lastScannedTick();
+        entry->latestTick = result.latestTick();
+        cache.store(cacheKey, std::move(entry),
+                    WalTailingCache::clock::now());
+      }
+    }
   }
 
   if (result.fail()) {
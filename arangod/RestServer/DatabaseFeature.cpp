@@ -25,6 +25,7 @@
 #include "DatabaseFeature.h"
 
 #include "ApplicationFeatures/ApplicationServer.h"
+#include "Aql/PreparedQueryRegistry.h"
 #include "Aql/QueryCache.h"
 #include "Aql/QueryList.h"
 #include "Aql/QueryRegistry.h"
@@ -839,6 +840,11 @@ ErrorCode DatabaseFeature::dropDatabase(std::string_view name) {
     if (queryRegistry != nullptr) {
       queryRegistry->destroy(vocbase->name());
     }
+    auto* preparedQueries =
+        server().getFeature<QueryRegistryFeature>().preparedQueryRegistry();
+    if (preparedQueries != nullptr) {
+      preparedQueries->invalidate(vocbase->name());
+    }
     // TODO Temporary fix, this full method needs to be unified.
     try {
       vocbase->cursorRepository()->garbageCollect(true);
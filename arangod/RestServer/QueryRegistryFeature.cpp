@@ -26,14 +26,18 @@
 #include "QueryRegistryFeature.h"
 
 #include "ApplicationFeatures/ApplicationServer.h"
+#include "Aql/ExecutionStats.h"
+#include "Aql/PreparedQueryRegistry.h"
 #include "Aql/Query.h"
 #include "Aql/QueryCache.h"
+#include "Aql/QueryPlanCache.h"
 #include "Aql/QueryRegistry.h"
 #include "Basics/GlobalResourceMonitor.h"
 #include "Basics/NumberOfCores.h"
 #include "Basics/PhysicalMemory.h"
 #include "Basics/application-exit.h"
 #include "Cluster/ServerState.h"
+#include "Graph/Cache/GraphSnapshotCache.h"
 #include "Logger/LogMacros.h"
 #include "Logger/Logger.h"
 #include "Logger/LoggerStream.h"
@@ -141,6 +145,15 @@ struct QueryTimeScale {
 struct SlowQueryTimeScale {
   static metrics::LogScale<double> scale() { return {2., 1.0, 2000.0, 10}; }
 };
+struct QueryBytesScale {
+  // smallest bucket is 1KiB, largest 64GiB
+  static metrics::LogScale<uint64_t> scale() {
+    return {4, 0, 68719476736ULL, 14};
+  }
+};
+struct QueryCountScale {
+  static metrics::LogScale<uint64_t> scale() { return {4, 0, 16777216, 10}; }
+};
 
 DECLARE_COUNTER(arangodb_aql_all_query_total,
                 "Total number of AQL queries finished");
@@ -162,6 +175,33 @@ DECLARE_COUNTER(arangodb_aql_global_query_memory_limit_reached_total,
                 "Number of global AQL query memory limit violations");
 DECLARE_COUNTER(arangodb_aql_local_query_memory_limit_reached_total,
                 "Number of local AQL query memory limit violations");
+DECLARE_COUNTER(arangodb_aql_database_memory_limit_reached_total,
+                "Number of per-database memory limit violations");
+DECLARE_COUNTER(arangodb_aql_query_plan_cache_hits_total,
+                "Number of AQL execution plan cache hits");
+DECLARE_COUNTER(arangodb_aql_query_plan_cache_misses_total,
+                "Number of AQL execution plan cache misses");
+DECLARE_GAUGE(arangodb_aql_query_plan_cache_memory_usage, uint64_t,
+              "Memory usage of the AQL execution plan cache [bytes]");
+DECLARE_HISTOGRAM(arangodb_aql_tagged_query_time, QueryTimeScale,
+                  "Execution time histogram for tagged AQL queries [s]");
+DECLARE_HISTOGRAM(arangodb_aql_tagged_query_cpu_time, QueryTimeScale,
+                  "CPU time histogram for tagged AQL queries [s]");
+DECLARE_HISTOGRAM(arangodb_aql_tagged_query_peak_memory_usage,
+                  QueryBytesScale,
+                  "Peak memory usage histogram for tagged AQL queries [bytes]");
+DECLARE_HISTOGRAM(
+    arangodb_aql_tagged_query_bytes_read, QueryBytesScale,
+    "Histogram of bytes read by the storage engine for tagged AQL queries");
+DECLARE_HISTOGRAM(arangodb_aql_tagged_query_block_cache_misses,
+                  QueryCountScale,
+                  "Histogram of block cache misses for tagged AQL queries");
+DECLARE_HISTOGRAM(arangodb_aql_tagged_query_network_bytes, QueryBytesScale,
+                  "Histogram of bytes sent to and received from other "
+                  "servers for tagged AQL queries");
+DECLARE_COUNTER(arangodb_aql_tagged_query_untracked_total,
+                "Number of tagged AQL queries not tracked in the per-tag "
+                "metrics because the maximum number of tags was reached");
 
 QueryRegistryFeature::QueryRegistryFeature(Server& server)
     : ArangodFeature{server, *this},
@@ -185,6 +225,7 @@ QueryRegistryFeature::QueryRegistryFeature(Server& server)
       _peakMemoryUsageThreshold(1073741824),  // 1GB
       _queryGlobalMemoryLimit(
           defaultMemoryLimit(PhysicalMemory::getValue(), 0.1, 0.90)),
+      _queryDatabaseMemoryLimit(0),
       _queryMemoryLimit(
           defaultMemoryLimit(PhysicalMemory::getValue(), 0.2, 0.75)),
       _maxDNFConditionMembers(aql::QueryOptions::defaultMaxDNFConditionMembers),
@@ -194,7 +235,12 @@ QueryRegistryFeature::QueryRegistryFeature(Server& server)
       _queryCacheMaxResultsCount(0),
       _queryCacheMaxResultsSize(0),
       _queryCacheMaxEntrySize(0),
+      _queryPlanCacheMaxEntries(0),
+      _queryPlanCacheMaxMemoryUsage(8 * 1024 * 1024),
+      _maxPreparedQueries(4096),
+      _graphSnapshotMaxMemoryUsage(0),
       _maxParallelism(4),
+      _maxTrackedQueryTags(64),
       _slowQueryThreshold(10.0),
       _slowStreamingQueryThreshold(10.0),
       _queryRegistryTTL(0.0),
@@ -218,7 +264,19 @@ QueryRegistryFeature::QueryRegistryFeature(Server& server)
               arangodb_aql_global_query_memory_limit_reached_total{})),
       _localQueryMemoryLimitReached(
           server.getFeature<metrics::MetricsFeature>().add(
-              arangodb_aql_local_query_memory_limit_reached_total{})) {
+              arangodb_aql_local_query_memory_limit_reached_total{})),
+      _databaseMemoryLimitReached(
+          server.getFeature<metrics::MetricsFeature>().add(
+              arangodb_aql_database_memory_limit_reached_total{})),
+      _queryPlanCacheHits(server.getFeature<metrics::MetricsFeature>().add(
+          arangodb_aql_query_plan_cache_hits_total{})),
+      _queryPlanCacheMisses(server.getFeature<metrics::MetricsFeature>().add(
+          arangodb_aql_query_plan_cache_misses_total{})),
+      _queryPlanCacheMemoryUsage(
+          server.getFeature<metrics::MetricsFeature>().add(
+              arangodb_aql_query_plan_cache_memory_usage{})),
+      _untrackedTaggedQueries(server.getFeature<metrics::MetricsFeature>().add(
+          arangodb_aql_tagged_query_untracked_total{})) {
   static_assert(
       Server::isCreatedAfter<QueryRegistryFeature, metrics::MetricsFeature>());
 
@@ -232,6 +290,8 @@ QueryRegistryFeature::QueryRegistryFeature(Server& server)
   _queryCacheIncludeSystem = properties.includeSystem;
 }
 
+QueryRegistryFeature::~QueryRegistryFeature() = default;
+
 void QueryRegistryFeature::collectOptions(
     std::shared_ptr<ProgramOptions> options) {
   options->addSection("query", "AQL queries");
@@ -273,6 +333,27 @@ tracking has a granularity of 32 KiB chunks.
 If both, `--query.global-memory-limit` and `--query.memory-limit`, are set, you
 must set the former at least as high as the latter.)");
 
+  options
+      ->addOption("--query.database-memory-limit",
+                  "The memory threshold for all AQL queries and transactions "
+                  "in a single database combined (in bytes, 0 = no limit).",
+                  new UInt64Parameter(&_queryDatabaseMemoryLimit))
+      .setIntroducedIn(31200)
+      .setLongDescription(R"(You can use this option to limit the combined
+estimated memory usage of all AQL queries and transactions in each database
+(in bytes), so that a single database cannot use up all the memory available
+via `--query.global-memory-limit`. The limit applies to each database
+separately. A value of `0` means that there is no per-database limit.
+
+The memory usage of a database also counts towards the global memory limit.
+If a memory allocation would exceed the limit of its database, the operation
+is aborted with error code 32 ("resource limit exceeded"), in the same way as
+with the global memory limit. The per-database limit has the same granularity
+of 32 KiB chunks as the global memory limit.
+
+The limit is set when a database is opened or created. Changing it requires a
+restart.)");
+
   options
       ->addOption(
           "--query.memory-limit",
@@ -506,6 +587,100 @@ their size does not exceed this setting's value.)");
 if you use the query results cache, as queries on system collections are
 internal to ArangoDB and use space in the query results cache unnecessarily.)");
 
+  options
+      ->addOption("--query.plan-cache-max-entries",
+                  "The maximum number of entries in the AQL execution plan "
+                  "cache (0 = turn off plan cache).",
+                  new UInt64Parameter(&_queryPlanCacheMaxEntries),
+                  arangodb::options::makeFlags(
+                      arangodb::options::Flags::Uncommon,
+                      arangodb::options::Flags::DefaultNoComponents,
+                      arangodb::options::Flags::OnSingle))
+      .setIntroducedIn(31200)
+      .setLongDescription(R"(The execution plan cache stores the optimized
+execution plans of AQL queries, so that repeated executions of the same query
+with different bind parameter values can skip parsing and optimizing the query.
+Bind parameters that are only used as operands in `FILTER` conditions are
+resolved at runtime. The values of all other bind parameters are part of the
+cached plan, so a cached plan is only reused if these values are identical.
+
+All cached plans are invalidated whenever a collection, index, view or
+database is created, modified or dropped.
+
+Queries can opt out of the plan cache by setting their `usePlanCache`
+option to `false`.)");
+
+  options
+      ->addOption("--query.plan-cache-max-memory-usage",
+                  "The maximum total memory usage of the AQL execution plan "
+                  "cache (in bytes).",
+                  new UInt64Parameter(&_queryPlanCacheMaxMemoryUsage),
+                  arangodb::options::makeFlags(
+                      arangodb::options::Flags::Uncommon,
+                      arangodb::options::Flags::DefaultNoComponents,
+                      arangodb::options::Flags::OnSingle))
+      .setIntroducedIn(31200);
+
+  options
+      ->addOption("--query.max-prepared-queries",
+                  "The maximum number of prepared AQL queries per server "
+                  "(0 = turn off prepared queries).",
+                  new UInt64Parameter(&_maxPreparedQueries),
+                  arangodb::options::makeFlags(
+                      arangodb::options::Flags::Uncommon,
+                      arangodb::options::Flags::DefaultNoComponents,
+                      arangodb::options::Flags::OnCoordinator,
+                      arangodb::options::Flags::OnSingle))
+      .setIntroducedIn(31200)
+      .setLongDescription(R"(Queries can be prepared via the
+`POST /_api/query/prepare` API and then be executed repeatedly via
+`POST /_api/cursor`, by passing the returned id in the `preparedQuery`
+attribute instead of the query string. Prepared queries are kept until they
+are removed via `DELETE /_api/query/prepare/<id>`, until their database is
+dropped or until the server is restarted. Once the maximum number of prepared
+queries is reached, preparing further queries fails.)");
+
+  options
+      ->addOption("--query.graph-snapshot-max-memory-usage",
+                  "The maximum total memory usage of in-memory graph "
+                  "snapshots used by traversals (in bytes, 0 = turn off "
+                  "graph snapshots).",
+                  new UInt64Parameter(&_graphSnapshotMaxMemoryUsage),
+                  arangodb::options::makeFlags(
+                      arangodb::options::Flags::Uncommon,
+                      arangodb::options::Flags::DefaultNoComponents,
+                      arangodb::options::Flags::OnSingle))
+      .setIntroducedIn(31200)
+      .setLongDescription(R"(Graph snapshots are compact in-memory copies of
+the `_from` and `_to` values of edge collections. Read-only traversals that
+set their `useGraphSnapshot` option to `true` read their edges from these
+snapshots instead of the edge index, as long as they do not filter on edge
+attributes other than `_from` and `_to` and do not use edge weights.
+
+A snapshot is built on first use and is dropped whenever a transaction
+modifying its edge collection commits. It is rebuilt by the next traversal
+that uses it. Graph snapshots are therefore only beneficial for edge
+collections that are not modified frequently.)");
+
+  options
+      ->addOption("--query.max-tracked-tags",
+                  "The maximum number of distinct query tags for which "
+                  "per-tag query metrics are kept.",
+                  new UInt64Parameter(&_maxTrackedQueryTags),
+                  arangodb::options::makeFlags(
+                      arangodb::options::Flags::Uncommon,
+                      arangodb::options::Flags::DefaultNoComponents,
+                      arangodb::options::Flags::OnCoordinator,
+                      arangodb::options::Flags::OnSingle))
+      .setIntroducedIn(31200)
+      .setLongDescription(R"(Queries can be tagged by setting their `tag`
+option. For tagged queries, the execution time, CPU time, peak memory usage,
+storage engine reads and network transfer are tracked in the
+`arangodb_aql_tagged_query_*` histograms, with the tag as label. Every new
+tag creates a new set of metrics, which is kept until the server is
+restarted. Once the maximum number of tags is reached, queries with further
+tags are only counted in `arangodb_aql_tagged_query_untracked_total`.)");
+
   options
       ->addOption(
           "--query.optimizer-max-plans",
@@ -770,6 +945,25 @@ void QueryRegistryFeature::prepare() {
   // create the query registry
   _queryRegistry = std::make_unique<aql::QueryRegistry>(_queryRegistryTTL);
   QUERY_REGISTRY.store(_queryRegistry.get(), std::memory_order_release);
+
+  if (_queryPlanCacheMaxEntries > 0 &&
+      ServerState::instance()->isSingleServer()) {
+    // the plan cache is only supported on single servers
+    _queryPlanCache = std::make_unique<aql::QueryPlanCache>(
+        _queryPlanCacheMaxEntries, _queryPlanCacheMaxMemoryUsage);
+  }
+
+  if (_maxPreparedQueries > 0 && (ServerState::instance()->isSingleServer() ||
+                                  ServerState::instance()->isCoordinator())) {
+    _preparedQueryRegistry =
+        std::make_unique<aql::PreparedQueryRegistry>(_maxPreparedQueries);
+  }
+
+  if (ServerState::instance()->isSingleServer()) {
+    // graph snapshots are only supported on single servers
+    graph::GraphSnapshotCache::instance().setMaxMemoryUsage(
+        _graphSnapshotMaxMemoryUsage);
+  }
 }
 
 void QueryRegistryFeature::start() {}
@@ -798,6 +992,14 @@ void QueryRegistryFeature::updateMetrics() {
   auto stats = global.stats();
   _globalQueryMemoryLimitReached = stats.globalLimitReached;
   _localQueryMemoryLimitReached = stats.localLimitReached;
+  _databaseMemoryLimitReached = stats.nestedLimitReached;
+
+  if (_queryPlanCache != nullptr) {
+    auto planCacheStats = _queryPlanCache->stats();
+    _queryPlanCacheHits = planCacheStats.hits;
+    _queryPlanCacheMisses = planCacheStats.misses;
+    _queryPlanCacheMemoryUsage = planCacheStats.memoryUsage;
+  }
 }
 
 void QueryRegistryFeature::trackQueryStart() noexcept { ++_runningQueries; }
@@ -815,4 +1017,57 @@ void QueryRegistryFeature::trackSlowQuery(double time) {
   _slowQueryTimes.count(time);
 }
 
+void QueryRegistryFeature::trackTaggedQuery(
+    std::string_view tag, double time, uint64_t peakMemoryUsage,
+    aql::QueryResources const& resources) {
+  // tags are provided by end users, so we must make sure that they do not
+  // break the metrics output
+  std::string label;
+  label.reserve(tag.size());
+  for (char c : tag) {
+    if (c == '"' || c == '\\' || static_cast<unsigned char>(c) < 0x20) {
+      c = '_';
+    }
+    label.push_back(c);
+  }
+
+  TaggedQueryMetrics metrics;
+  {
+    std::lock_guard guard(_taggedQueryMetricsMutex);
+    auto it = _taggedQueryMetrics.find(label);
+    if (it == _taggedQueryMetrics.end()) {
+      if (_taggedQueryMetrics.size() >= _maxTrackedQueryTags) {
+        ++_untrackedTaggedQueries;
+        return;
+      }
+      auto& mf = server().getFeature<metrics::MetricsFeature>();
+      TaggedQueryMetrics m;
+      m.time =
+          &mf.add(arangodb_aql_tagged_query_time{}.withLabel("tag", label));
+      m.cpuTime = &mf.add(
+          arangodb_aql_tagged_query_cpu_time{}.withLabel("tag", label));
+      m.peakMemoryUsage = &mf.add(
+          arangodb_aql_tagged_query_peak_memory_usage{}.withLabel("tag",
+                                                                  label));
+      m.bytesRead = &mf.add(
+          arangodb_aql_tagged_query_bytes_read{}.withLabel("tag", label));
+      m.blockCacheMisses = &mf.add(
+          arangodb_aql_tagged_query_block_cache_misses{}.withLabel("tag",
+                                                                   label));
+      m.networkBytes = &mf.add(
+          arangodb_aql_tagged_query_network_bytes{}.withLabel("tag", label));
+      it = _taggedQueryMetrics.emplace(std::move(label), m).first;
+    }
+    metrics = it->second;
+  }
+
+  metrics.time->count(time);
+  metrics.cpuTime->count(resources.cpuTime);
+  metrics.peakMemoryUsage->count(peakMemoryUsage);
+  metrics.bytesRead->count(resources.bytesRead);
+  metrics.blockCacheMisses->count(resources.blockCacheMisses);
+  metrics.networkBytes->count(resources.networkBytesSent +
+                              resources.networkBytesReceived);
+}
+
 }  // namespace arangodb
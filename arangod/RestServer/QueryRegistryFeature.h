@@ -25,9 +25,19 @@
 
 #include "RestServer/arangod.h"
 #include "Aql/QueryRegistry.h"
+#include "Containers/FlatHashMap.h"
 #include "Metrics/Fwd.h"
 
+#include <mutex>
+#include <string>
+#include <string_view>
+
 namespace arangodb {
+namespace aql {
+class PreparedQueryRegistry;
+class QueryPlanCache;
+struct QueryResources;
+}
 
 class QueryRegistryFeature final : public ArangodFeature {
  public:
@@ -47,6 +57,8 @@ class QueryRegistryFeature final : public ArangodFeature {
   void stop() override final;
   void unprepare() override final;
 
+  ~QueryRegistryFeature();
+
   void updateMetrics();
 
   // tracks a query start
@@ -55,6 +67,11 @@ class QueryRegistryFeature final : public ArangodFeature {
   void trackQueryEnd(double time);
   // tracks a slow query, using execution time
   void trackSlowQuery(double time);
+  // tracks the execution time and resource usage of a query that has a
+  // user-provided tag, in the per-tag query metrics
+  void trackTaggedQuery(std::string_view tag, double time,
+                        uint64_t peakMemoryUsage,
+                        aql::QueryResources const& resources);
 
   bool trackingEnabled() const noexcept { return _trackingEnabled; }
   bool trackSlowQueries() const noexcept { return _trackSlowQueries; }
@@ -85,6 +102,9 @@ class QueryRegistryFeature final : public ArangodFeature {
   uint64_t queryGlobalMemoryLimit() const noexcept {
     return _queryGlobalMemoryLimit;
   }
+  uint64_t queryDatabaseMemoryLimit() const noexcept {
+    return _queryDatabaseMemoryLimit;
+  }
   uint64_t queryMemoryLimit() const noexcept { return _queryMemoryLimit; }
   double queryMaxRuntime() const noexcept { return _queryMaxRuntime; }
   uint64_t maxQueryPlans() const noexcept { return _maxQueryPlans; }
@@ -92,6 +112,16 @@ class QueryRegistryFeature final : public ArangodFeature {
     return _queryRegistry.get();
   }
   uint64_t maxParallelism() const noexcept { return _maxParallelism; }
+  /// @brief the execution plan cache. returns a nullptr if the plan cache
+  /// is turned off
+  aql::QueryPlanCache* queryPlanCache() const noexcept {
+    return _queryPlanCache.get();
+  }
+  /// @brief the registry for prepared queries. returns a nullptr on
+  /// DB servers and agents
+  aql::PreparedQueryRegistry* preparedQueryRegistry() const noexcept {
+    return _preparedQueryRegistry.get();
+  }
 
  private:
   bool _trackingEnabled;
@@ -113,6 +143,7 @@ class QueryRegistryFeature final : public ArangodFeature {
   size_t _maxCollectionsPerQuery;
   uint64_t _peakMemoryUsageThreshold;
   uint64_t _queryGlobalMemoryLimit;
+  uint64_t _queryDatabaseMemoryLimit;
   uint64_t _queryMemoryLimit;
   size_t _maxDNFConditionMembers;
   double _queryMaxRuntime;
@@ -121,7 +152,12 @@ class QueryRegistryFeature final : public ArangodFeature {
   uint64_t _queryCacheMaxResultsCount;
   uint64_t _queryCacheMaxResultsSize;
   uint64_t _queryCacheMaxEntrySize;
+  uint64_t _queryPlanCacheMaxEntries;
+  uint64_t _queryPlanCacheMaxMemoryUsage;
+  uint64_t _maxPreparedQueries;
+  uint64_t _graphSnapshotMaxMemoryUsage;
   uint64_t _maxParallelism;
+  uint64_t _maxTrackedQueryTags;
   double _slowQueryThreshold;
   double _slowStreamingQueryThreshold;
   double _queryRegistryTTL;
@@ -132,6 +168,10 @@ class QueryRegistryFeature final : public ArangodFeature {
 
   std::unique_ptr<aql::QueryRegistry> _queryRegistry;
 
+  std::unique_ptr<aql::QueryPlanCache> _queryPlanCache;
+
+  std::unique_ptr<aql::PreparedQueryRegistry> _preparedQueryRegistry;
+
   metrics::Histogram<metrics::LogScale<double>>& _queryTimes;
   metrics::Histogram<metrics::LogScale<double>>& _slowQueryTimes;
   metrics::Counter& _totalQueryExecutionTime;
@@ -141,6 +181,26 @@ class QueryRegistryFeature final : public ArangodFeature {
   metrics::Gauge<uint64_t>& _globalQueryMemoryLimit;
   metrics::Counter& _globalQueryMemoryLimitReached;
   metrics::Counter& _localQueryMemoryLimitReached;
+  metrics::Counter& _databaseMemoryLimitReached;
+  metrics::Counter& _queryPlanCacheHits;
+  metrics::Counter& _queryPlanCacheMisses;
+  metrics::Gauge<uint64_t>& _queryPlanCacheMemoryUsage;
+  metrics::Counter& _untrackedTaggedQueries;
+
+  struct TaggedQueryMetrics {
+    metrics::Histogram<metrics::LogScale<double>>* time;
+    metrics::Histogram<metrics::LogScale<double>>* cpuTime;
+    metrics::Histogram<metrics::LogScale<uint64_t>>* peakMemoryUsage;
+    metrics::Histogram<metrics::LogScale<uint64_t>>* bytesRead;
+    metrics::Histogram<metrics::LogScale<uint64_t>>* blockCacheMisses;
+    metrics::Histogram<metrics::LogScale<uint64_t>>* networkBytes;
+  };
+
+  // per-tag query metrics, created on first use of a tag. the number of
+  // tags is limited by _maxTrackedQueryTags, as every tag creates a new
+  // set of metrics that is never removed
+  std::mutex _taggedQueryMetricsMutex;
+  containers::FlatHashMap<std::string, TaggedQueryMetrics> _taggedQueryMetrics;
 };
 
 }  // namespace arangodb
@@ -24,6 +24,7 @@
 #pragma once
 
 #include "ApplicationFeatures/ApplicationFeature.h"
+#include "RocksDBEngine/DistinctValuesStorageBackendRocksDB.h"
 #include "RocksDBEngine/SortedRowsStorageBackendRocksDB.h"
 #include "RestServer/arangod.h"
 
@@ -94,6 +95,11 @@ class TemporaryStorageFeature : public ArangodFeature {
         *_backend, std::forward<Args>(args)...);
   }
 
+  std::unique_ptr<aql::DistinctValuesStorageBackend>
+  getDistinctValuesStorage() {
+    return std::make_unique<DistinctValuesStorageBackendRocksDB>(*_backend);
+  }
+
  private:
   void cleanupDirectory();
 
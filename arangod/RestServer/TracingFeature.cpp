@@ -0,0 +1,146 @@
+////////////////////////////////////////////////////////////////////////////////
+/// DISCLAIMER
+///
+/// Copyright 2014-2023 ArangoDB GmbH, Cologne, Germany
+/// Copyright 2004-2014 triAGENS GmbH, Cologne, Germany
+///
+/// Licensed under the Apache License, Version 2.0 (the "License");
+/// you may not use this file except in compliance with the License.
+/// You may obtain a copy of the License at
+///
+///     http://www.apache.org/licenses/LICENSE-2.0
+///
+/// Unless required by applicable law or agreed to in writing, software
+/// distributed under the License is distributed on an "AS IS" BASIS,
+/// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+/// See the License for the specific language governing permissions and
+/// limitations under the License.
+///
+/// Copyright holder is ArangoDB GmbH, Cologne, Germany
+///
+/// @author Jan Steemann
+////////////////////////////////////////////////////////////////////////////////
+
+#include "TracingFeature.h"
+
+#include "ApplicationFeatures/ApplicationServer.h"
+#include "Basics/application-exit.h"
+#include "Cluster/ServerState.h"
+#include "FeaturePhases/BasicFeaturePhaseServer.h"
+#include "Logger/LogMacros.h"
+#include "Logger/Logger.h"
+#include "Logger/LoggerStream.h"
+#include "Logger/Tracing.h"
+#include "ProgramOptions/Parameters.h"
+#include "ProgramOptions/ProgramOptions.h"
+#include "ProgramOptions/Section.h"
+
+using namespace arangodb::options;
+
+namespace arangodb {
+
+TracingFeature::TracingFeature(Server& server)
+    : ArangodFeature{server, *this},
+      _sampleRate(0.001),
+      _maxQueuedSpans(65536) {
+  setOptional(true);
+  startsAfter<application_features::BasicFeaturePhaseServer>();
+}
+
+void TracingFeature::collectOptions(std::shared_ptr<ProgramOptions> options) {
+  options
+      ->addOption("--server.tracing-output-file",
+                  "The file to which the spans of traced requests are "
+                  "exported. Tracing is turned off if empty.",
+                  new StringParameter(&_outputFile),
+                  arangodb::options::makeFlags(
+                      arangodb::options::Flags::Uncommon,
+                      arangodb::options::Flags::DefaultNoComponents,
+                      arangodb::options::Flags::OnAgent,
+                      arangodb::options::Flags::OnCoordinator,
+                      arangodb::options::Flags::OnDBServer,
+                      arangodb::options::Flags::OnSingle))
+      .setIntroducedIn(31200)
+      .setLongDescription(R"(If set, requests are traced across all servers
+they touch. The trace context is propagated between servers in the W3C
+`traceparent` header, so that spans recorded on Coordinators, DB-Servers and
+Agents can be joined by their trace id.
+
+Spans are recorded for the handling of REST requests, for cluster-internal
+requests, for the execution of AQL query snippets, for RocksDB transaction
+commits and for appending entries to replicated logs. The spans of sampled
+traces are exported in batches by a background thread, and appended to the
+output file as one JSON object per line. The field names follow the
+OpenTelemetry span model, so that the file can be shipped to a tracing
+backend by a log collector.
+
+Set the same value on all servers of a deployment, because traces can only
+be followed across servers that have tracing turned on.)");
+
+  options
+      ->addOption("--server.tracing-sample-rate",
+                  "The probability with which a request that is not part "
+                  "of a trace yet starts a new sampled trace.",
+                  new DoubleParameter(&_sampleRate, /*base*/ 1.0,
+                                      /*minValue*/ 0.0, /*maxValue*/ 1.0),
+                  arangodb::options::makeFlags(
+                      arangodb::options::Flags::Uncommon,
+                      arangodb::options::Flags::DefaultNoComponents,
+                      arangodb::options::Flags::OnAgent,
+                      arangodb::options::Flags::OnCoordinator,
+                      arangodb::options::Flags::OnDBServer,
+                      arangodb::options::Flags::OnSingle))
+      .setIntroducedIn(31200)
+      .setLongDescription(R"(The sampling decision is made once per trace,
+by the server that starts the trace. Requests that carry a `traceparent`
+header inherit the sampling decision of the caller.)");
+
+  options
+      ->addOption(
+          "--server.tracing-max-queued-spans",
+          "The maximum number of spans waiting to be exported. Spans are "
+          "dropped if more spans are recorded than can be exported.",
+          new UInt64Parameter(&_maxQueuedSpans, /*base*/ 1,
+                              /*minValue*/ 16),
+          arangodb::options::makeFlags(
+              arangodb::options::Flags::Uncommon,
+              arangodb::options::Flags::DefaultNoComponents,
+              arangodb::options::Flags::OnAgent,
+              arangodb::options::Flags::OnCoordinator,
+              arangodb::options::Flags::OnDBServer,
+              arangodb::options::Flags::OnSingle))
+      .setIntroducedIn(31200);
+}
+
+void TracingFeature::start() {
+  if (_outputFile.empty()) {
+    return;
+  }
+
+  tracing::Tracer::Options options;
+  options.outputFile = _outputFile;
+  options.sampleRate = _sampleRate;
+  options.maxQueuedSpans = _maxQueuedSpans;
+  options.role = ServerState::roleToString(ServerState::instance()->getRole());
+  options.serverId = [] { return ServerState::instance()->getId(); };
+
+  try {
+    tracing::Tracer::start(std::move(options));
+  } catch (std::exception const& ex) {
+    LOG_TOPIC("0b7c2", FATAL, Logger::STARTUP)
+        << "unable to turn on tracing: " << ex.what();
+    FATAL_ERROR_EXIT();
+  }
+
+  LOG_TOPIC("2e9a4", INFO, Logger::REQUESTS)
+      << "tracing requests, exporting spans to '" << _outputFile
+      << "' with a sample rate of " << _sampleRate;
+}
+
+void TracingFeature::stop() {
+  if (!_outputFile.empty()) {
+    tracing::Tracer::stop();
+  }
+}
+
+}  // namespace arangodb
@@ -0,0 +1,51 @@
+////////////////////////////////////////////////////////////////////////////////
+/// DISCLAIMER
+///
+/// Copyright 2014-2023 ArangoDB GmbH, Cologne, Germany
+/// Copyright 2004-2014 triAGENS GmbH, Cologne, Germany
+///
+/// Licensed under the Apache License, Version 2.0 (the "License");
+/// you may not use this file except in compliance with the License.
+/// You may obtain a copy of the License at
+///
+///     http://www.apache.org/licenses/LICENSE-2.0
+///
+/// Unless required by applicable law or agreed to in writing, software
+/// distributed under the License is distributed on an "AS IS" BASIS,
+/// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+/// See the License for the specific language governing permissions and
+/// limitations under the License.
+///
+/// Copyright holder is ArangoDB GmbH, Cologne, Germany
+///
+/// @author Jan Steemann
+////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "RestServer/arangod.h"
+
+#include <cstdint>
+#include <string>
+
+namespace arangodb {
+
+/// @brief turns on distributed tracing of requests, if configured, and
+/// exports the recorded spans. see Logger/Tracing.h for the span model.
+class TracingFeature final : public ArangodFeature {
+ public:
+  static constexpr std::string_view name() noexcept { return "Tracing"; }
+
+  explicit TracingFeature(Server& server);
+
+  void collectOptions(std::shared_ptr<options::ProgramOptions>) override final;
+  void start() override final;
+  void stop() override final;
+
+ private:
+  std::string _outputFile;
+  double _sampleRate;
+  uint64_t _maxQueuedSpans;
+};
+
+}  // namespace arangodb
@@ -34,10 +34,13 @@
 #include "Basics/system-functions.h"
 #include "Cluster/FollowerInfo.h"
 #include "Cluster/ServerState.h"
+#include "Containers/FlatHashMap.h"
 #include "Indexes/Index.h"
 #include "Logger/LogMacros.h"
 #include "Logger/Logger.h"
 #include "Logger/LoggerStream.h"
+#include "Metrics/CounterBuilder.h"
+#include "Metrics/MetricsFeature.h"
 #include "ProgramOptions/Parameters.h"
 #include "ProgramOptions/ProgramOptions.h"
 #include "RestServer/DatabaseFeature.h"
@@ -50,6 +53,7 @@
 
 #include <chrono>
 #include <thread>
+#include <utility>
 
 using namespace arangodb;
 using namespace arangodb::options;
@@ -58,11 +62,23 @@ namespace {
 // the AQL query to remove documents
 std::string const removeQuery(
     "/*ttl cleanup*/ FOR doc IN @@collection OPTIONS { forceIndexHint: true, "
-    "indexHint: @indexHint } FILTER doc.@indexAttribute >= 0 && "
+    "indexHint: @indexHint } FILTER doc.@indexAttribute >= @lowerBound && "
     "doc.@indexAttribute <= @stamp SORT doc.@indexAttribute LIMIT @limit "
     "REMOVE doc IN @@collection OPTIONS { ignoreErrors: true }");
+
+// every that many runs, the TTL thread scans all TTL indexes from the
+// beginning instead of resuming where the previous complete run stopped
+constexpr uint64_t fullScanInterval = 10;
 }  // namespace
 
+DECLARE_COUNTER(arangodb_ttl_runs_total,
+                "Number of runs of the TTL background thread");
+DECLARE_COUNTER(arangodb_ttl_documents_removed_total,
+                "Number of documents removed by the TTL background thread");
+DECLARE_COUNTER(arangodb_ttl_limit_reached_total,
+                "Number of TTL background thread runs that stopped early "
+                "because of the removal limits");
+
 namespace arangodb {
 
 TtlStatistics& TtlStatistics::operator+=(VPackSlice const& other) {
@@ -256,6 +272,11 @@ class TtlThread final : public ServerThread<ArangodServer> {
     LOG_TOPIC("139af", TRACE, Logger::TTL) << "ttl thread work()";
 
     stats.runs++;
+    if (++_runs % fullScanInterval == 0) {
+      // documents can be inserted with an already expired stamp, and
+      // removals can fail because of conflicts. pick these up regularly
+      _resumeStamps.clear();
+    }
 
     double const stamp = TRI_microtime();
     uint64_t limitLeft = properties.maxTotalRemoves;
@@ -314,12 +335,27 @@ class TtlThread final : public ServerThread<ArangodServer> {
           }
 
           double expireAfter = ea.getNumericValue<double>();
+          uint64_t const limit =
+              std::min(properties.maxCollectionRemoves, limitLeft);
+
+          // all documents below the stamp of the last complete run for
+          // this index have been removed already. starting the index scan
+          // there saves skipping over the deleted index entries, which
+          // remain in the storage engine as tombstones until compaction
+          auto const resumeKey =
+              std::make_pair(collection->id().id(), index->id().id());
+          double lowerBound = 0.0;
+          if (auto it = _resumeStamps.find(resumeKey);
+              it != _resumeStamps.end()) {
+            lowerBound = it->second;
+          }
+
           LOG_TOPIC("5cca5", DEBUG, Logger::TTL)
               << "TTL thread going to work for collection '"
               << collection->name()
               << "', expireAfter: " << Logger::FIXED(expireAfter, 0)
-              << ", stamp: " << (stamp - expireAfter) << ", limit: "
-              << std::min(properties.maxCollectionRemoves, limitLeft);
+              << ", stamp: " << (stamp - expireAfter)
+              << ", lower bound: " << lowerBound << ", limit: " << limit;
 
           auto bindVars = std::make_shared<VPackBuilder>();
           bindVars->openObject();
@@ -331,10 +367,9 @@ class TtlThread final : public ServerThread<ArangodServer> {
             bindVars->add(VPackValue(it.name));
           }
           bindVars->close();
+          bindVars->add("lowerBound", VPackValue(lowerBound));
           bindVars->add("stamp", VPackValue(stamp - expireAfter));
-          bindVars->add(
-              "limit",
-              VPackValue(std::min(properties.maxCollectionRemoves, limitLeft)));
+          bindVars->add("limit", VPackValue(limit));
           bindVars->close();
 
           auto query = aql::Query::create(
@@ -343,6 +378,9 @@ class TtlThread final : public ServerThread<ArangodServer> {
           query->collections().add(collection->name(), AccessMode::Type::WRITE,
                                    aql::Collection::Hint::Shard);
           aql::QueryResult queryResult = query->executeSync();
+          // only resume from the stamp if we know that all documents up to
+          // it have been removed
+          _resumeStamps.erase(resumeKey);
 
           if (queryResult.result.fail()) {
             // we can probably live with an error here...
@@ -367,6 +405,10 @@ class TtlThread final : public ServerThread<ArangodServer> {
                 if (v.isNumber()) {
                   uint64_t removed = v.getNumericValue<uint64_t>();
                   stats.documentsRemoved += removed;
+                  if (removed < limit) {
+                    _resumeStamps.insert_or_assign(resumeKey,
+                                                   stamp - expireAfter);
+                  }
                   if (removed > 0) {
                     LOG_TOPIC("2455e", DEBUG, Logger::TTL)
                         << "TTL thread removed " << removed
@@ -413,6 +455,14 @@ class TtlThread final : public ServerThread<ArangodServer> {
   /// @brief a builder object we reuse to save a few memory allocations
   VPackBuilder _builder;
 
+  /// @brief number of runs of the thread
+  uint64_t _runs = 0;
+
+  /// @brief per (collection id, index id), the stamp of the last run which
+  /// removed all expired documents
+  containers::FlatHashMap<std::pair<uint64_t, uint64_t>, double>
+      _resumeStamps;
+
   /// @brief set to true while the TTL thread is actually performing deletions,
   /// false otherwise
   std::atomic<bool> _working;
@@ -421,7 +471,16 @@ class TtlThread final : public ServerThread<ArangodServer> {
 }  // namespace arangodb
 
 TtlFeature::TtlFeature(Server& server)
-    : ArangodFeature{server, *this}, _allowRunning(true), _active(true) {
+    : ArangodFeature{server, *this},
+      _runsMetric(server.getFeature<metrics::MetricsFeature>().add(
+          arangodb_ttl_runs_total{})),
+      _documentsRemovedMetric(
+          server.getFeature<metrics::MetricsFeature>().add(
+              arangodb_ttl_documents_removed_total{})),
+      _limitReachedMetric(server.getFeature<metrics::MetricsFeature>().add(
+          arangodb_ttl_limit_reached_total{})),
+      _allowRunning(true),
+      _active(true) {
   startsAfter<application_features::DatabaseFeaturePhase>();
   startsAfter<application_features::ServerFeaturePhase>();
 }
@@ -623,6 +682,10 @@ void TtlFeature::statsToVelocyPack(VPackBuilder& builder) const {
 }
 
 void TtlFeature::updateStats(TtlStatistics const& stats) {
+  _runsMetric.count(stats.runs);
+  _documentsRemovedMetric.count(stats.documentsRemoved);
+  _limitReachedMetric.count(stats.limitReached);
+
   std::lock_guard locker{_statisticsMutex};
   _statistics += stats;
 }
@@ -33,6 +33,9 @@ class Slice;
 }  // namespace velocypack
 
 class TtlThread;
+namespace metrics {
+class Counter;
+}
 
 struct TtlStatistics {
   // number of times the background thread was running
@@ -124,6 +127,10 @@ class TtlFeature final : public ArangodFeature {
   mutable std::mutex _threadMutex;
   std::unique_ptr<TtlThread> _thread;
 
+  metrics::Counter& _runsMetric;
+  metrics::Counter& _documentsRemovedMetric;
+  metrics::Counter& _limitReachedMetric;
+
   /// @brief internal active flag, used by HeartbeatThread in active failover
   /// setups the value is orthogonal to the user-facing _active flag
   bool _allowRunning;
@@ -113,6 +113,7 @@ class StorageEngineFeature;
 class SystemDatabaseFeature;
 class TempFeature;
 class TemporaryStorageFeature;
+class TracingFeature;
 class TtlFeature;
 class UpgradeFeature;
 class V8DealerFeature;
@@ -253,6 +254,7 @@ using ArangodFeaturesList = TypeList<
     SystemDatabaseFeature,
     TempFeature,
     TemporaryStorageFeature,
+    TracingFeature,
     TtlFeature,
     UpgradeFeature,
     V8DealerFeature,
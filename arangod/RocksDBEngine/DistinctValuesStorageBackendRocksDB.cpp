@@ -0,0 +1,114 @@
+////////////////////////////////////////////////////////////////////////////////
+/// DISCLAIMER
+///
+/// Copyright 2014-2023 ArangoDB GmbH, Cologne, Germany
+/// Copyright 2004-2014 triAGENS GmbH, Cologne, Germany
+///
+/// Licensed under the Apache License, Version 2.0 (the "License");
+/// you may not use this file except in compliance with the License.
+/// You may obtain a copy of the License at
+///
+///     http://www.apache.org/licenses/LICENSE-2.0
+///
+/// Unless required by applicable law or agreed to in writing, software
+/// distributed under the License is distributed on an "AS IS" BASIS,
+/// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+/// See the License for the specific language governing permissions and
+/// limitations under the License.
+///
+/// Copyright holder is ArangoDB GmbH, Cologne, Germany
+///
+/// @author Jan Steemann
+////////////////////////////////////////////////////////////////////////////////
+
+#include "DistinctValuesStorageBackendRocksDB.h"
+
+#include "Basics/Exceptions.h"
+#include "Basics/debugging.h"
+#include "RocksDBEngine/RocksDBFormat.h"
+#include "RocksDBEngine/RocksDBSortedRowsStorageContext.h"
+#include "RocksDBEngine/RocksDBTempStorage.h"
+
+#include <rocksdb/iterator.h>
+
+#include <velocypack/Slice.h>
+
+namespace arangodb {
+
+DistinctValuesStorageBackendRocksDB::DistinctValuesStorageBackendRocksDB(
+    RocksDBTempStorage& storage)
+    : _tempStorage(storage), _rowNumberForInsert(0) {}
+
+DistinctValuesStorageBackendRocksDB::~DistinctValuesStorageBackendRocksDB() {
+  try {
+    cleanup();
+  } catch (...) {
+  }
+}
+
+void DistinctValuesStorageBackendRocksDB::addValue(velocypack::Slice value) {
+  TRI_ASSERT(_iterator == nullptr);
+
+  if (_context == nullptr) {
+    // create context on the fly
+    _context = _tempStorage.getSortedRowsStorageContext();
+  }
+
+  // the key layout is the same as for sorted rows, so that the temp
+  // storage's comparator orders the values ascending:
+  // 8 byte prefix | 8 byte row number | value | '1' (ascending)
+  _keyBuffer.clear();
+  rocksutils::uintToPersistentBigEndian<std::uint64_t>(_keyBuffer,
+                                                       _context->keyPrefix());
+  rocksutils::uintToPersistentBigEndian<std::uint64_t>(_keyBuffer,
+                                                       ++_rowNumberForInsert);
+  _keyBuffer.append(value.startAs<char const>(), value.byteSize());
+  _keyBuffer.push_back('1');
+
+  _key.constructFromBuffer(_keyBuffer);
+
+  auto res = _context->storeRow(_key, value);
+
+  if (res.fail()) {
+    THROW_ARANGO_EXCEPTION(res);
+  }
+}
+
+void DistinctValuesStorageBackendRocksDB::seal() {
+  TRI_ASSERT(_iterator == nullptr);
+
+  if (_context == nullptr) {
+    // nothing was ever stored
+    return;
+  }
+
+  _context->ingestAll();
+
+  _iterator = _context->getIterator();
+}
+
+bool DistinctValuesStorageBackendRocksDB::hasMore() const {
+  return _iterator != nullptr && _iterator->Valid();
+}
+
+velocypack::Slice DistinctValuesStorageBackendRocksDB::current() const {
+  TRI_ASSERT(hasMore());
+  return velocypack::Slice(
+      reinterpret_cast<uint8_t const*>(_iterator->value().data()));
+}
+
+void DistinctValuesStorageBackendRocksDB::next() {
+  TRI_ASSERT(hasMore());
+  _iterator->Next();
+}
+
+void DistinctValuesStorageBackendRocksDB::cleanup() {
+  _iterator.reset();
+  if (_context == nullptr) {
+    return;
+  }
+
+  _context->cleanup();
+}
+
+}  // namespace arangodb
@@ -0,0 +1,72 @@
+////////////////////////////////////////////////////////////////////////////////
+/// DISCLAIMER
+///
+/// Copyright 2014-2023 ArangoDB GmbH, Cologne, Germany
+/// Copyright 2004-2014 triAGENS GmbH, Cologne, Germany
+///
+/// Licensed under the Apache License, Version 2.0 (the "License");
+/// you may not use this file except in compliance with the License.
+/// You may obtain a copy of the License at
+///
+///     http://www.apache.org/licenses/LICENSE-2.0
+///
+/// Unless required by applicable law or agreed to in writing, software
+/// distributed under the License is distributed on an "AS IS" BASIS,
+/// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+/// See the License for the specific language governing permissions and
+/// limitations under the License.
+///
+/// Copyright holder is ArangoDB GmbH, Cologne, Germany
+///
+/// @author Jan Steemann
+////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "Aql/DistinctValuesStorageBackend.h"
+#include "RocksDBEngine/RocksDBKey.h"
+
+#include <cstddef>
+#include <memory>
+#include <string>
+
+namespace rocksdb {
+class Iterator;
+}
+
+namespace arangodb {
+class RocksDBSortedRowsStorageContext;
+class RocksDBTempStorage;
+
+class DistinctValuesStorageBackendRocksDB final
+    : public aql::DistinctValuesStorageBackend {
+ public:
+  explicit DistinctValuesStorageBackendRocksDB(RocksDBTempStorage& storage);
+
+  ~DistinctValuesStorageBackendRocksDB();
+
+  void addValue(velocypack::Slice value) final;
+  void seal() final;
+  bool hasMore() const final;
+  velocypack::Slice current() const final;
+  void next() final;
+
+ private:
+  void cleanup();
+
+  RocksDBTempStorage& _tempStorage;
+
+  std::unique_ptr<RocksDBSortedRowsStorageContext> _context;
+
+  // iterator for reading data
+  std::unique_ptr<rocksdb::Iterator> _iterator;
+
+  // string and key that will be recycled for every key we build
+  std::string _keyBuffer;
+  RocksDBKey _key;
+
+  // next row number that we generate on insert
+  size_t _rowNumberForInsert;
+};
+
+}  // namespace arangodb
@@ -73,6 +73,13 @@ void RocksDBMetricsListener::OnStallConditionsChanged(
   // we also count a stall if we go from stopped to stall since it's a distinct
   // state
 
+  if (info.condition.prev == rocksdb::WriteStallCondition::kNormal) {
+    _stalledFamilies.fetch_add(1, std::memory_order_relaxed);
+  } else if (info.condition.cur == rocksdb::WriteStallCondition::kNormal) {
+    TRI_ASSERT(_stalledFamilies.load() > 0);
+    _stalledFamilies.fetch_sub(1, std::memory_order_relaxed);
+  }
+
   if (info.condition.cur == rocksdb::WriteStallCondition::kDelayed) {
     _writeStalls.count();
     LOG_TOPIC("9123c", DEBUG, Logger::ENGINES)
@@ -29,6 +29,8 @@
 #include "Metrics/Fwd.h"
 #include "RestServer/arangod.h"
 
+#include <atomic>
+#include <cstddef>
 #include <string_view>
 
 namespace rocksdb {
@@ -58,6 +60,12 @@ class RocksDBMetricsListener : public rocksdb::EventListener {
                              rocksdb::CompactionJobInfo const&) override;
   void OnStallConditionsChanged(rocksdb::WriteStallInfo const& info) override;
 
+  /// @brief whether RocksDB currently slows down or stops writes for at
+  /// least one column family
+  bool writesStalled() const noexcept {
+    return _stalledFamilies.load(std::memory_order_relaxed) > 0;
+  }
+
  private:
   void handleFlush(std::string_view phase,
                    rocksdb::FlushJobInfo const& info) const;
@@ -68,6 +76,9 @@ class RocksDBMetricsListener : public rocksdb::EventListener {
  protected:
   metrics::Counter& _writeStalls;
   metrics::Counter& _writeStops;
+  /// @brief number of column families that are currently in a delayed or
+  /// stopped write state
+  std::atomic<std::size_t> _stalledFamilies{0};
 };
 
 }  // namespace arangodb
@@ -47,6 +47,10 @@ class RocksDBReadOnlyMethods final : public RocksDBReadOnlyBaseMethods {
   rocksdb::Status Get(rocksdb::ColumnFamilyHandle*, rocksdb::Slice const& key,
                       rocksdb::PinnableSlice* val, ReadOwnWrites) override;
 
+  void MultiGet(rocksdb::ColumnFamilyHandle*, size_t count,
+                rocksdb::Slice const* keys, rocksdb::PinnableSlice* values,
+                rocksdb::Status* statuses, ReadOwnWrites) override;
+
   std::unique_ptr<rocksdb::Iterator> NewIterator(rocksdb::ColumnFamilyHandle*,
                                                  ReadOptionsCallback) override;
 };
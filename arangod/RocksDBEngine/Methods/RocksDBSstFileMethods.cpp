@@ -35,6 +35,8 @@
 
 #include "Logger/LogMacros.h"
 
+#include <algorithm>
+
 using namespace arangodb;
 
 RocksDBSstFileMethods::RocksDBSstFileMethods(
@@ -103,6 +105,16 @@ rocksdb::Status RocksDBSstFileMethods::writeToFile() {
             [&comparator](auto& v1, auto& v2) {
               return comparator->Compare({v1.first}, {v2.first}) < 0;
             });
+  // .sst files require strictly ascending keys. an index can produce the
+  // same key more than once for a document, e.g. for repeated array values
+  // without deduplication. in a write batch these would simply overwrite
+  // each other, so we keep only one of them
+  _keyValPairs.erase(
+      std::unique(_keyValPairs.begin(), _keyValPairs.end(),
+                  [&comparator](auto& v1, auto& v2) {
+                    return comparator->Compare({v1.first}, {v2.first}) == 0;
+                  }),
+      _keyValPairs.end());
   TRI_pid_t pid = Thread::currentProcessId();
   std::string tmpFileName =
       std::to_string(pid) + '-' +
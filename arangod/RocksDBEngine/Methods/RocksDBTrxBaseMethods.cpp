@@ -26,6 +26,8 @@
 #include "ApplicationFeatures/ApplicationServer.h"
 #include "Containers/SmallVector.h"
 #include "Logger/LogMacros.h"
+#include "Logger/Tracing.h"
+#include "Metrics/Counter.h"
 #include "Random/RandomGenerator.h"
 #include "RocksDBEngine/RocksDBLogValue.h"
 #include "RocksDBEngine/RocksDBSettingsManager.h"
@@ -36,8 +38,11 @@
 #include "StorageEngine/EngineSelectorFeature.h"
 
 #include <absl/cleanup/cleanup.h>
+#include <rocksdb/utilities/transaction.h>
 #include <rocksdb/utilities/write_batch_with_index.h>
 
+#include <algorithm>
+
 using namespace arangodb;
 
 // dummy implementation to track memory allocations during a
@@ -231,6 +236,21 @@ rocksdb::Status RocksDBTrxBaseMethods::Get(rocksdb::ColumnFamilyHandle* cf,
   return _db->Get(ro, cf, key, val);
 }
 
+void RocksDBTrxBaseMethods::MultiGet(rocksdb::ColumnFamilyHandle* cf,
+                                     size_t count, rocksdb::Slice const* keys,
+                                     rocksdb::PinnableSlice* values,
+                                     rocksdb::Status* statuses,
+                                     ReadOwnWrites readOwnWrites) {
+  TRI_ASSERT(cf != nullptr);
+  rocksdb::ReadOptions const& ro = _readOptions;
+  TRI_ASSERT(ro.snapshot != nullptr || _state->options().delaySnapshot);
+  if (readOwnWrites == ReadOwnWrites::yes) {
+    _rocksTransaction->MultiGet(ro, cf, count, keys, values, statuses);
+  } else {
+    _db->MultiGet(ro, cf, count, keys, values, statuses);
+  }
+}
+
 rocksdb::Status RocksDBTrxBaseMethods::GetForUpdate(
     rocksdb::ColumnFamilyHandle* cf, rocksdb::Slice const& key,
     rocksdb::PinnableSlice* val) {
@@ -238,6 +258,17 @@ rocksdb::Status RocksDBTrxBaseMethods::GetForUpdate(
   TRI_ASSERT(_rocksTransaction);
   rocksdb::ReadOptions const& ro = _readOptions;
   TRI_ASSERT(ro.snapshot != nullptr || _state->options().delaySnapshot);
+  if (_optimistic) {
+    // read from our snapshot only. the key is locked when we commit
+    rocksdb::Status s;
+    if (val != nullptr) {
+      s = _rocksTransaction->Get(ro, cf, key, val);
+    }
+    if (s.ok() || s.IsNotFound()) {
+      deferLock(cf, key);
+    }
+    return s;
+  }
   rocksdb::Status s = _rocksTransaction->GetForUpdate(ro, cf, key, val);
   if (s.ok()) {
     _memoryTracker->increaseMemoryUsage(lockOverhead(key.size()));
@@ -252,9 +283,16 @@ rocksdb::Status RocksDBTrxBaseMethods::Put(rocksdb::ColumnFamilyHandle* cf,
   TRI_ASSERT(cf != nullptr);
   TRI_ASSERT(_rocksTransaction);
   std::uint64_t beforeSize = currentWriteBatchSize();
-  rocksdb::Status s =
-      _rocksTransaction->Put(cf, key.string(), val, assume_tracked);
+  rocksdb::Status s;
+  if (_optimistic) {
+    s = _rocksTransaction->PutUntracked(cf, key.string(), val);
+  } else {
+    s = _rocksTransaction->Put(cf, key.string(), val, assume_tracked);
+  }
   if (s.ok()) {
+    if (_optimistic) {
+      deferLock(cf, key.string());
+    }
     // size of WriteBatch got increased. track memory usage of WriteBatch
     // plus potential overhead of locking and indexing
     _memoryTracker->increaseMemoryUsage((currentWriteBatchSize() - beforeSize) +
@@ -286,8 +324,16 @@ rocksdb::Status RocksDBTrxBaseMethods::Delete(rocksdb::ColumnFamilyHandle* cf,
   TRI_ASSERT(cf != nullptr);
   TRI_ASSERT(_rocksTransaction);
   std::uint64_t beforeSize = currentWriteBatchSize();
-  rocksdb::Status s = _rocksTransaction->Delete(cf, key.string());
+  rocksdb::Status s;
+  if (_optimistic) {
+    s = _rocksTransaction->DeleteUntracked(cf, key.string());
+  } else {
+    s = _rocksTransaction->Delete(cf, key.string());
+  }
   if (s.ok()) {
+    if (_optimistic) {
+      deferLock(cf, key.string());
+    }
     // size of WriteBatch got increased. track memory usage of WriteBatch
     // plus potential overhead of locking and indexing
     _memoryTracker->increaseMemoryUsage((currentWriteBatchSize() - beforeSize) +
@@ -302,8 +348,16 @@ rocksdb::Status RocksDBTrxBaseMethods::SingleDelete(
   TRI_ASSERT(cf != nullptr);
   TRI_ASSERT(_rocksTransaction);
   std::uint64_t beforeSize = currentWriteBatchSize();
-  rocksdb::Status s = _rocksTransaction->SingleDelete(cf, key.string());
+  rocksdb::Status s;
+  if (_optimistic) {
+    s = _rocksTransaction->SingleDeleteUntracked(cf, key.string());
+  } else {
+    s = _rocksTransaction->SingleDelete(cf, key.string());
+  }
   if (s.ok()) {
+    if (_optimistic) {
+      deferLock(cf, key.string());
+    }
     // size of WriteBatch got increased. track memory usage of WriteBatch
     // plus potential overhead of locking and indexing
     _memoryTracker->increaseMemoryUsage((currentWriteBatchSize() - beforeSize) +
@@ -327,6 +381,7 @@ void RocksDBTrxBaseMethods::SetSavePoint() {
   TRI_ASSERT(_rocksTransaction);
   _rocksTransaction->SetSavePoint();
   _memoryTracker->setSavePoint();
+  _deferredLockSavePoints.push_back(_deferredLocks.size());
 }
 
 rocksdb::Status RocksDBTrxBaseMethods::RollbackToSavePoint() {
@@ -334,6 +389,9 @@ rocksdb::Status RocksDBTrxBaseMethods::RollbackToSavePoint() {
   rocksdb::Status s = _rocksTransaction->RollbackToSavePoint();
   if (s.ok()) {
     _memoryTracker->rollbackToSavePoint();
+    TRI_ASSERT(!_deferredLockSavePoints.empty());
+    _deferredLocks.resize(_deferredLockSavePoints.back());
+    _deferredLockSavePoints.pop_back();
   }
   return s;
 }
@@ -356,6 +414,11 @@ rocksdb::Status RocksDBTrxBaseMethods::RollbackToWriteBatchSavePoint() {
     // WBWI.
     _rocksTransaction->GetWriteBatch()->GetWriteBatch()->SetSavePoint();
 
+    // the keys written after the SavePoint do not need to be locked anymore.
+    // the SavePoint itself is removed by PopSavePoint
+    TRI_ASSERT(!_deferredLockSavePoints.empty());
+    _deferredLocks.resize(_deferredLockSavePoints.back());
+
     // finally, we pop off the SavePoint from the WBWI, which will remove the
     // latest changes from the WBWI and the WB (our dummy SavePoint), but it
     // will _not_ rebuild the entire WBWI from the WB
@@ -371,6 +434,8 @@ void RocksDBTrxBaseMethods::PopSavePoint() {
   TRI_ASSERT(s.ok());
   if (s.ok()) {
     _memoryTracker->popSavePoint();
+    TRI_ASSERT(!_deferredLockSavePoints.empty());
+    _deferredLockSavePoints.pop_back();
   }
 }
 
@@ -378,6 +443,8 @@ void RocksDBTrxBaseMethods::cleanupTransaction() {
   delete _rocksTransaction;
   _rocksTransaction = nullptr;
   _memoryTracker->reset();
+  _deferredLocks.clear();
+  _deferredLockSavePoints.clear();
 }
 
 void RocksDBTrxBaseMethods::createTransaction() {
@@ -414,6 +481,14 @@ void RocksDBTrxBaseMethods::createTransaction() {
     trxOpts.skip_concurrency_control = true;
   }
 
+  // optimistic transactions need a snapshot from the start, because all
+  // keys are validated against it at commit time
+  _optimistic = _state->options().optimistic &&
+                !_state->options().delaySnapshot &&
+                !_state->isSingleOperation() &&
+                !_state->hasHint(transaction::Hints::Hint::IS_FOLLOWER_TRX) &&
+                !trxOpts.skip_concurrency_control;
+
   TRI_ASSERT(_rocksTransaction == nullptr ||
              _rocksTransaction->GetState() == rocksdb::Transaction::COMMITED ||
              (_rocksTransaction->GetState() == rocksdb::Transaction::STARTED &&
@@ -462,6 +537,23 @@ Result RocksDBTrxBaseMethods::doCommitImpl() {
     return Result(TRI_ERROR_ARANGO_READ_ONLY, "server is in read-only mode");
   }
 
+  if (_optimistic) {
+    ++_state->statistics()._optimisticCommits;
+    // waiting for key locks is traced separately from the commit itself
+    tracing::Span lockSpan("rocksdb.lock_keys", tracing::SpanKind::kInternal);
+    rocksdb::Status s = lockDeferredKeys();
+    if (!s.ok()) {
+      lockSpan.setError(s.ToString());
+    }
+    lockSpan.end();
+    if (!s.ok()) {
+      if (s.IsBusy() || s.IsTimedOut() || s.IsTryAgain()) {
+        ++_state->statistics()._optimisticConflicts;
+      }
+      return rocksutils::convertStatus(s);
+    }
+  }
+
   // we are actually going to attempt a commit
   ++_numCommits;
   uint64_t numOperations = this->numOperations();
@@ -521,10 +613,16 @@ Result RocksDBTrxBaseMethods::doCommitImpl() {
                     _rocksTransaction->GetNumDeletes() +
                     _rocksTransaction->GetNumMerges();
 
+  tracing::Span commitSpan("rocksdb.commit", tracing::SpanKind::kInternal);
+  commitSpan.setAttribute("arangodb.transaction_id",
+                          static_cast<int64_t>(_state->id().id()));
+  commitSpan.setAttribute("arangodb.operations", static_cast<int64_t>(numOps));
   rocksdb::Status s = _rocksTransaction->Commit();
   if (!s.ok()) {  // cleanup performed by scope-guard
+    commitSpan.setError(s.ToString());
     return rocksutils::convertStatus(s);
   }
+  commitSpan.end();
 
   _memoryTracker->reset();
 
@@ -545,7 +643,7 @@ Result RocksDBTrxBaseMethods::doCommitImpl() {
 
   TRI_ASSERT(postCommitSeq <= _db->GetLatestSequenceNumber());
 
-  _state->clearQueryCache();
+  _state->clearQueryCache(/*committed*/ true);
   // This resets the counters in the collection(s), so we also need to reset
   // our counters here for consistency.
   _callback.commit(_lastWrittenOperationTick);
@@ -574,6 +672,44 @@ Result RocksDBTrxBaseMethods::doCommitImpl() {
   return {};
 }
 
+void RocksDBTrxBaseMethods::deferLock(rocksdb::ColumnFamilyHandle* cf,
+                                      rocksdb::Slice const& key) {
+  TRI_ASSERT(_optimistic);
+  _memoryTracker->increaseMemoryUsage(key.size() + lockOverhead(key.size()));
+  _deferredLocks.emplace_back(cf, key.ToString());
+}
+
+rocksdb::Status RocksDBTrxBaseMethods::lockDeferredKeys() {
+  TRI_ASSERT(_optimistic);
+  TRI_ASSERT(_readOptions.snapshot != nullptr);
+  // lock keys in a well-defined order, and every key only once
+  std::sort(_deferredLocks.begin(), _deferredLocks.end(),
+            [](auto const& lhs, auto const& rhs) {
+              if (lhs.first->GetID() != rhs.first->GetID()) {
+                return lhs.first->GetID() < rhs.first->GetID();
+              }
+              return lhs.second < rhs.second;
+            });
+  _deferredLocks.erase(
+      std::unique(_deferredLocks.begin(), _deferredLocks.end()),
+      _deferredLocks.end());
+
+  for (auto const& [cf, key] : _deferredLocks) {
+    // locks the key and fails with a Busy status if the key was written
+    // by another transaction after our snapshot was taken
+    rocksdb::Status s = _rocksTransaction->GetForUpdate(
+        _readOptions, cf, key, static_cast<rocksdb::PinnableSlice*>(nullptr),
+        /*exclusive*/ true, /*do_validate*/ true);
+    if (!s.ok() && !s.IsNotFound()) {
+      return s;
+    }
+  }
+  // all keys are locked now, so there is nothing left to roll back
+  _deferredLocks.clear();
+  std::fill(_deferredLockSavePoints.begin(), _deferredLockSavePoints.end(), 0);
+  return rocksdb::Status::OK();
+}
+
 rocksdb::Status RocksDBTrxBaseMethods::GetFromSnapshot(
     rocksdb::ColumnFamilyHandle* family, rocksdb::Slice const& slice,
     rocksdb::PinnableSlice* pinnable, ReadOwnWrites rw,
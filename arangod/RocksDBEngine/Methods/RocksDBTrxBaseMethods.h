@@ -23,10 +23,14 @@
 
 #pragma once
 
+#include "Containers/SmallVector.h"
 #include "RocksDBEngine/RocksDBTransactionMethods.h"
 
 #include <cstdint>
 #include <memory>
+#include <string>
+#include <utility>
+#include <vector>
 
 namespace arangodb {
 struct RocksDBMethodsMemoryTracker;
@@ -96,6 +100,9 @@ class RocksDBTrxBaseMethods : public RocksDBTransactionMethods {
                                   rocksdb::Snapshot const* snapshot) override;
   rocksdb::Status Get(rocksdb::ColumnFamilyHandle*, rocksdb::Slice const&,
                       rocksdb::PinnableSlice*, ReadOwnWrites) override;
+  void MultiGet(rocksdb::ColumnFamilyHandle*, size_t count,
+                rocksdb::Slice const* keys, rocksdb::PinnableSlice* values,
+                rocksdb::Status* statuses, ReadOwnWrites) override;
   rocksdb::Status GetForUpdate(rocksdb::ColumnFamilyHandle*,
                                rocksdb::Slice const&,
                                rocksdb::PinnableSlice*) final override;
@@ -125,6 +132,14 @@ class RocksDBTrxBaseMethods : public RocksDBTransactionMethods {
   Result doCommit();
   Result doCommitImpl();
 
+  /// @brief remember a key of an optimistic transaction, which will be
+  /// locked and validated when the transaction commits
+  void deferLock(rocksdb::ColumnFamilyHandle* cf, rocksdb::Slice const& key);
+
+  /// @brief lock all keys remembered via deferLock and check that they
+  /// have not been modified by other transactions since our snapshot
+  rocksdb::Status lockDeferredKeys();
+
   /// @brief assumed additional indexing overhead for each entry in a
   /// WriteBatchWithIndex. this is in addition to the actual WriteBuffer entry.
   /// the WriteBatchWithIndex keeps all entries (which are pointers) in a
@@ -188,6 +203,17 @@ class RocksDBTrxBaseMethods : public RocksDBTransactionMethods {
   std::unique_ptr<RocksDBMethodsMemoryTracker> _memoryTracker;
 
   bool _indexingDisabled{false};
+
+  /// @brief whether or not key locks are deferred until commit
+  bool _optimistic{false};
+
+  /// @brief keys to lock at commit time, only used by optimistic
+  /// transactions
+  std::vector<std::pair<rocksdb::ColumnFamilyHandle*, std::string>>
+      _deferredLocks;
+
+  /// @brief number of deferred locks at each savepoint
+  containers::SmallVector<std::size_t, 4> _deferredLockSavePoints;
 };
 
 }  // namespace arangodb
@@ -127,6 +127,26 @@ rocksdb::Status RocksDBTrxMethods::Get(rocksdb::ColumnFamilyHandle* cf,
   return _rocksTransaction->Get(ro, cf, key, val);
 }
 
+void RocksDBTrxMethods::MultiGet(rocksdb::ColumnFamilyHandle* cf, size_t count,
+                                 rocksdb::Slice const* keys,
+                                 rocksdb::PinnableSlice* values,
+                                 rocksdb::Status* statuses,
+                                 ReadOwnWrites readOwnWrites) {
+  TRI_ASSERT(cf != nullptr);
+  TRI_ASSERT(_rocksTransaction);
+  rocksdb::ReadOptions const& ro = _readOptions;
+  if (readOwnWrites == ReadOwnWrites::no) {
+    if (_readWriteBatch) {
+      _readWriteBatch->MultiGetFromBatchAndDB(_db, ro, cf, count, keys, values,
+                                              statuses, false);
+    } else {
+      _db->MultiGet(ro, cf, count, keys, values, statuses);
+    }
+    return;
+  }
+  _rocksTransaction->MultiGet(ro, cf, count, keys, values, statuses);
+}
+
 std::unique_ptr<rocksdb::Iterator> RocksDBTrxMethods::NewIterator(
     rocksdb::ColumnFamilyHandle* cf, ReadOptionsCallback readOptionsCallback) {
   TRI_ASSERT(cf != nullptr);
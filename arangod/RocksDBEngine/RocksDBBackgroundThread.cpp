@@ -226,6 +226,7 @@ void RocksDBBackgroundThread::run() {
       }
 
       if (!isStopping()) {
+        _engine.adjustCompactionRateLimit();
         _engine.processCompactions();
       }
     } catch (std::exception const& ex) {
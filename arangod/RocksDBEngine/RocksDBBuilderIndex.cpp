@@ -35,8 +35,10 @@
 #endif
 #include "Logger/LogMacros.h"
 #include "RestServer/FlushFeature.h"
+#include "RestServer/TemporaryStorageFeature.h"
 #include "RocksDBEngine/Methods/RocksDBBatchedMethods.h"
 #include "RocksDBEngine/Methods/RocksDBBatchedWithIndexMethods.h"
+#include "RocksDBEngine/Methods/RocksDBSstFileMethods.h"
 #include "RocksDBEngine/RocksDBCollection.h"
 #include "RocksDBEngine/RocksDBColumnFamilyManager.h"
 #include "RocksDBEngine/RocksDBCommon.h"
@@ -77,6 +79,22 @@ constexpr size_t getBatchSize(size_t numDocsHint) noexcept {
   }
 }
 
+// here come our 13 reasons why we may want to abort the index creation...
+Result checkIndexCreationAborted(RocksDBIndex& ridx) {
+  if (ridx.collection().vocbase().server().isStopping()) {
+    return {TRI_ERROR_SHUTTING_DOWN};
+  }
+  if (ridx.collection().vocbase().isDropped()) {
+    // database dropped
+    return {TRI_ERROR_ARANGO_DATABASE_NOT_FOUND};
+  }
+  if (ridx.collection().deleted()) {
+    // collection dropped
+    return {TRI_ERROR_ARANGO_DATA_SOURCE_NOT_FOUND};
+  }
+  return {};
+}
+
 }  // namespace
 
 namespace arangodb {
@@ -162,24 +180,12 @@ Result fillIndexSingleThreaded(
       res = partiallyCommitInsertions(batch, rootDB, trxColl, docsProcessed,
                                       ridx, foreground);
 
-      // here come our 13 reasons why we may want to abort the index creation...
-
       // cppcheck-suppress identicalConditionAfterEarlyExit
       if (res.fail()) {
         break;
       }
-      if (ridx.collection().vocbase().server().isStopping()) {
-        res.reset(TRI_ERROR_SHUTTING_DOWN);
-        break;
-      }
-      if (ridx.collection().vocbase().isDropped()) {
-        // database dropped
-        res.reset(TRI_ERROR_ARANGO_DATABASE_NOT_FOUND);
-        break;
-      }
-      if (ridx.collection().deleted()) {
-        // collection dropped
-        res.reset(TRI_ERROR_ARANGO_DATA_SOURCE_NOT_FOUND);
+      res = ::checkIndexCreationAborted(ridx);
+      if (res.fail()) {
         break;
       }
     }
@@ -209,6 +215,122 @@ Result fillIndexSingleThreaded(
   return res;
 }
 
+Result fillIndexWithSstFiles(
+    rocksdb::Options const& dbOptions, std::string const& idxPath,
+    std::atomic<std::uint64_t>& docsProcessed, trx::BuilderTrx& trx,
+    RocksDBIndex& ridx, rocksdb::DB* rootDB,
+    std::unique_ptr<rocksdb::Iterator> it,
+    std::shared_ptr<std::function<arangodb::Result(double)>> progress) {
+  TRI_ASSERT(!ridx.unique());
+  Result res;
+  uint64_t numDocsWritten = 0;
+
+  RocksDBTransactionCollection* trxColl = trx.resolveTrxCollection();
+
+  auto rcoll = static_cast<RocksDBCollection*>(ridx.collection().getPhysical());
+  auto bounds = RocksDBKeyBounds::CollectionDocuments(rcoll->objectId());
+  auto count = rcoll->numberDocuments(&trx);
+  rocksdb::Slice upper(bounds.end());
+
+  // the .sst files are moved into the database directory on ingestion, so
+  // their size does not need to be limited like temporary files
+  StorageUsageTracker usageTracker(/*maxCapacity*/ 0);
+  RocksDBSstFileMethods sstMethods(rootDB, ridx.columnFamily(), dbOptions,
+                                   idxPath, usageTracker);
+
+  // the collection is locked exclusively, so the estimator can be updated
+  // directly
+  auto applyEstimates = [&]() {
+    auto ops = trxColl->stealTrackedIndexOperations();
+    if (!ops.empty() && ridx.estimator() != nullptr) {
+      TRI_ASSERT(ridx.hasSelectivityEstimate() && ops.size() == 1);
+      auto op = ops.begin();
+      TRI_ASSERT(ridx.id() == op->first);
+      ridx.estimator()->insert(op->second.inserts);
+    }
+  };
+
+  OperationOptions options;
+
+  for (it->Seek(bounds.start()); it->Valid(); it->Next()) {
+    TRI_ASSERT(it->key().compare(upper) < 0);
+
+    // the index only writes into the .sst file methods, which buffer the
+    // entries and write them sorted into .sst files of limited size
+    res = ridx.insert(
+        trx, &sstMethods, RocksDBKey::documentId(it->key()),
+        VPackSlice(reinterpret_cast<uint8_t const*>(it->value().data())),
+        options, /*performChecks*/ true);
+    if (res.fail()) {
+      break;
+    }
+    numDocsWritten++;
+
+    if (numDocsWritten % 1024 == 0) {
+      applyEstimates();
+      docsProcessed.fetch_add(1024, std::memory_order_relaxed);
+
+      if (count > 0) {
+        double p =
+            docsProcessed.load(std::memory_order_relaxed) * 100.0 / count;
+        ridx.progress(p);
+        if (progress != nullptr) {
+          (*progress)(p);
+        }
+      }
+
+      res = ::checkIndexCreationAborted(ridx);
+      if (res.fail()) {
+        break;
+      }
+    }
+  }
+
+  if (!it->status().ok() && res.ok()) {
+    res =
+        rocksutils::convertStatus(it->status(), rocksutils::StatusHint::index);
+  }
+
+  std::vector<std::string> fileNames;
+  if (res.ok()) {
+    applyEstimates();
+    docsProcessed.fetch_add(numDocsWritten % 1024, std::memory_order_relaxed);
+
+    res = sstMethods.stealFileNames(fileNames);
+  }
+
+  if (res.ok() && !fileNames.empty()) {
+    rocksdb::IngestExternalFileOptions ingestOptions;
+    ingestOptions.move_files = true;
+    ingestOptions.failed_move_fall_back_to_copy = true;
+    ingestOptions.snapshot_consistency = false;
+
+    rocksdb::Status s = rootDB->IngestExternalFile(ridx.columnFamily(),
+                                                   fileNames, ingestOptions);
+    if (!s.ok()) {
+      res = rocksutils::convertStatus(s, rocksutils::StatusHint::index);
+    }
+    // the files have been moved or copied into the database directory, or
+    // the ingestion failed. in both cases the files in idxPath are obsolete
+    RocksDBSstFileMethods::cleanUpFiles(fileNames);
+    usageTracker.decreaseUsage(sstMethods.stealBytesWrittenToDir());
+  }
+
+  if (res.ok()) {  // required so iresearch commits
+    res = trx.commit();
+
+    if (ridx.estimator() != nullptr) {
+      ridx.estimator()->setAppliedSeq(rootDB->GetLatestSequenceNumber());
+    }
+  }
+
+  // if an error occured drop() will be called
+  LOG_TOPIC("d1f4e", DEBUG, Logger::ENGINES)
+      << "ingested " << fileNames.size() << " .sst files for "
+      << numDocsWritten << " documents " << res.errorMessage();
+  return res;
+}
+
 }  // namespace arangodb
 
 RocksDBBuilderIndex::RocksDBBuilderIndex(std::shared_ptr<RocksDBIndex> wp,
@@ -327,9 +449,16 @@ static Result fillIndex(
                           std::move(progress));
   res = indexFiller.fillIndex();
 #else
-  res = fillIndexSingleThreaded(foreground, batched, dbOptions, batch,
-                                docsProcessed, trx, ridx, snap, rootDB,
-                                std::move(it), std::move(progress));
+  if (foreground && !isUnique) {
+    // no concurrent writes and no uniqueness checks against our own
+    // writes are possible, so the index entries can be bulk-loaded
+    res = fillIndexWithSstFiles(dbOptions, idxPath, docsProcessed, trx, ridx,
+                                rootDB, std::move(it), std::move(progress));
+  } else {
+    res = fillIndexSingleThreaded(foreground, batched, dbOptions, batch,
+                                  docsProcessed, trx, ridx, snap, rootDB,
+                                  std::move(it), std::move(progress));
+  }
 #endif
   return res;
 }
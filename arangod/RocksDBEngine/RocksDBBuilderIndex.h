@@ -69,6 +69,18 @@ Result fillIndexSingleThreaded(
     std::shared_ptr<std::function<arangodb::Result(double)>> progress =
         nullptr);
 
+/// @brief fills a non-unique index while holding an exclusive collection
+/// lock. the index entries are written into sorted .sst files, which are
+/// ingested into the index column family at the end, bypassing the WAL
+/// and the memtables
+Result fillIndexWithSstFiles(
+    rocksdb::Options const& dbOptions, std::string const& idxPath,
+    std::atomic<std::uint64_t>& docsProcessed, trx::BuilderTrx& trx,
+    RocksDBIndex& ridx, rocksdb::DB* rootDB,
+    std::unique_ptr<rocksdb::Iterator> it,
+    std::shared_ptr<std::function<arangodb::Result(double)>> progress =
+        nullptr);
+
 class RocksDBCollection;
 
 /// Dummy index class that contains the logic to build indexes
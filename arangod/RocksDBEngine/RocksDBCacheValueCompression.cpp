@@ -0,0 +1,147 @@
+////////////////////////////////////////////////////////////////////////////////
+/// DISCLAIMER
+///
+/// Copyright 2014-2023 ArangoDB GmbH, Cologne, Germany
+/// Copyright 2004-2014 triAGENS GmbH, Cologne, Germany
+///
+/// Licensed under the Apache License, Version 2.0 (the "License");
+/// you may not use this file except in compliance with the License.
+/// You may obtain a copy of the License at
+///
+///     http://www.apache.org/licenses/LICENSE-2.0
+///
+/// Unless required by applicable law or agreed to in writing, software
+/// distributed under the License is distributed on an "AS IS" BASIS,
+/// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+/// See the License for the specific language governing permissions and
+/// limitations under the License.
+///
+/// Copyright holder is ArangoDB GmbH, Cologne, Germany
+///
+/// @author Jan Steemann
+////////////////////////////////////////////////////////////////////////////////
+
+#include "RocksDBCacheValueCompression.h"
+
+#include "Basics/Endian.h"
+#include "Basics/debugging.h"
+
+#include <velocypack/Builder.h>
+#include <velocypack/Slice.h>
+
+#include <cstring>
+
+#include <lz4.h>
+
+namespace {
+// values > this size will not be stored LZ4-compressed in the in-memory
+// index caches
+constexpr std::size_t maxValueSizeForCompression = 1073741824;  // 1GB
+
+std::size_t resizeCompressionBuffer(std::string& scratch, std::size_t value) {
+  if (scratch.size() < value) {
+    std::size_t increment = value - scratch.size();
+    scratch.resize(value);
+    // return memory usage increase
+    return increment;
+  }
+  return 0;
+}
+}  // namespace
+
+namespace arangodb::rocksutils {
+
+std::tuple<char const*, std::size_t, bool> tryCompressCacheValue(
+    velocypack::Slice slice, std::size_t size,
+    std::size_t minValueSizeForCompression, int accelerationFactor,
+    std::string& scratch,
+    std::function<void(std::size_t)> const& memoryUsageCallback) {
+  char const* data = slice.startAs<char>();
+
+  if (size < minValueSizeForCompression || size > maxValueSizeForCompression) {
+    // value too big or too small. return original value
+    return {data, size, /*didCompress*/ false};
+  }
+
+  // determine maximum size for output buffer
+  int maxLength = LZ4_compressBound(static_cast<int>(size));
+  if (maxLength <= 0) {
+    // error. return original value
+    return {data, size, /*didCompress*/ false};
+  }
+
+  // resize output buffer if necessary
+  std::size_t memoryUsage = resizeCompressionBuffer(
+      scratch,
+      kCompressedCacheValueHeaderLength + static_cast<std::size_t>(maxLength));
+  memoryUsageCallback(memoryUsage);
+
+  std::uint32_t uncompressedSize =
+      basics::hostToBig(static_cast<std::uint32_t>(size));
+  // store compressed value using a velocypack Custom type.
+  // the compressed value is prepended by the following header:
+  // - byte 0: hard-coded to 0xff
+  // - byte 1-4: uncompressed size, encoded as a uint32_t in big endian
+  // order
+
+  // write prefix byte, so the decoder can distinguish between compressed
+  // values and uncompressed values. note that 0xff is a velocypack Custom
+  // type and should thus not appear as the first byte in uncompressed
+  // data.
+  scratch[0] = 0xffU;
+  // copy length of uncompressed data into bytes 1-4.
+  memcpy(scratch.data() + 1, &uncompressedSize, sizeof(uncompressedSize));
+
+  bool didCompress = false;
+
+  // compress data into output buffer, starting at byte 5.
+  int compressedSize = LZ4_compress_fast(
+      data, scratch.data() + kCompressedCacheValueHeaderLength,
+      static_cast<int>(size),
+      static_cast<int>(scratch.size() - kCompressedCacheValueHeaderLength),
+      accelerationFactor);
+  if (compressedSize > 0 &&
+      (static_cast<std::size_t>(compressedSize) +
+       kCompressedCacheValueHeaderLength) < size * 3 / 4) {
+    // only store the compressed version if it saves at least 25%
+    data = scratch.data();
+    size = static_cast<std::size_t>(compressedSize) +
+           kCompressedCacheValueHeaderLength;
+    TRI_ASSERT(isCompressedCacheValue(reinterpret_cast<uint8_t const*>(data)));
+    TRI_ASSERT(size <= scratch.size());
+    didCompress = true;
+  }
+  // return compressed or uncompressed value
+  return {data, size, didCompress};
+}
+
+void decompressCacheValue(std::uint8_t const* data, std::size_t size,
+                          velocypack::Builder& builder) {
+  TRI_ASSERT(isCompressedCacheValue(data));
+  TRI_ASSERT(size >= kCompressedCacheValueHeaderLength);
+  TRI_ASSERT(builder.isEmpty());
+
+  // read size of uncompressed value
+  std::uint32_t uncompressedSize;
+  memcpy(&uncompressedSize, data + 1, sizeof(uncompressedSize));
+  uncompressedSize = basics::bigToHost<std::uint32_t>(uncompressedSize);
+
+  // prepare builder's Buffer to hold the uncompressed data
+  builder.reserve(uncompressedSize);
+  TRI_ASSERT(builder.bufferRef().data() == builder.start());
+
+  // uncompress directly into builder's Buffer.
+  // this should not go wrong if we have a big enough output buffer.
+  [[maybe_unused]] int decompressedSize = LZ4_decompress_safe(
+      reinterpret_cast<char const*>(data) + kCompressedCacheValueHeaderLength,
+      reinterpret_cast<char*>(builder.bufferRef().data()),
+      static_cast<int>(size - kCompressedCacheValueHeaderLength),
+      static_cast<int>(uncompressedSize));
+  TRI_ASSERT(uncompressedSize == static_cast<std::size_t>(decompressedSize));
+
+  // we have uncompressed data directly into the Buffer's memory.
+  // we need to tell the Buffer to advance its end pointer.
+  builder.resetTo(uncompressedSize);
+}
+
+}  // namespace arangodb::rocksutils
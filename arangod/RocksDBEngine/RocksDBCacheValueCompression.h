@@ -0,0 +1,74 @@
+////////////////////////////////////////////////////////////////////////////////
+/// DISCLAIMER
+///
+/// Copyright 2014-2023 ArangoDB GmbH, Cologne, Germany
+/// Copyright 2004-2014 triAGENS GmbH, Cologne, Germany
+///
+/// Licensed under the Apache License, Version 2.0 (the "License");
+/// you may not use this file except in compliance with the License.
+/// You may obtain a copy of the License at
+///
+///     http://www.apache.org/licenses/LICENSE-2.0
+///
+/// Unless required by applicable law or agreed to in writing, software
+/// distributed under the License is distributed on an "AS IS" BASIS,
+/// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+/// See the License for the specific language governing permissions and
+/// limitations under the License.
+///
+/// Copyright holder is ArangoDB GmbH, Cologne, Germany
+///
+/// @author Jan Steemann
+////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <tuple>
+
+namespace arangodb {
+namespace velocypack {
+class Builder;
+class Slice;
+}  // namespace velocypack
+
+namespace rocksutils {
+
+// length of compressed header for LZ4-compressed in-memory cache values.
+// the header format is
+// - byte 0: hard-coded to 0xff:
+// - byte 1-4: uncompressed size, encoded as a uint32_t in big endian order
+inline constexpr std::size_t kCompressedCacheValueHeaderLength = 5;
+
+/// @brief try to LZ4-compress a velocypack value for storing it in an
+/// in-memory index cache. values smaller than minValueSizeForCompression are
+/// returned as is, and so are values for which compression does not save at
+/// least 25%. the compressed value is written into scratch, which is grown
+/// if necessary. memoryUsageCallback is called with the number of bytes
+/// the scratch buffer grew by.
+/// returns the pointer to and size of the value to store, and whether or
+/// not the value was compressed.
+std::tuple<char const*, std::size_t, bool> tryCompressCacheValue(
+    velocypack::Slice slice, std::size_t size,
+    std::size_t minValueSizeForCompression, int accelerationFactor,
+    std::string& scratch,
+    std::function<void(std::size_t)> const& memoryUsageCallback);
+
+/// @brief whether or not a cache value was stored LZ4-compressed
+inline bool isCompressedCacheValue(std::uint8_t const* data) noexcept {
+  // 0xff is a velocypack Custom type and cannot appear as the first byte
+  // of an uncompressed value
+  return data[0] == 0xffU;
+}
+
+/// @brief decompress an LZ4-compressed cache value into the (empty)
+/// builder. size is the size of the compressed value including its header.
+/// after the call, builder.slice() points to the uncompressed value.
+void decompressCacheValue(std::uint8_t const* data, std::size_t size,
+                          velocypack::Builder& builder);
+
+}  // namespace rocksutils
+}  // namespace arangodb
@@ -58,6 +58,7 @@
 #include "RocksDBEngine/RocksDBCommon.h"
 #include "RocksDBEngine/RocksDBComparator.h"
 #include "RocksDBEngine/RocksDBEngine.h"
+#include "RocksDBEngine/RocksDBIndexCacheRefillFeature.h"
 #include "RocksDBEngine/RocksDBIterators.h"
 #include "RocksDBEngine/RocksDBKey.h"
 #include "RocksDBEngine/RocksDBLogValue.h"
@@ -326,6 +327,10 @@ RocksDBCollection::RocksDBCollection(LogicalCollection& collection,
                     !ServerState::instance()->isCoordinator() &&
                     basics::VelocyPackHelper::getBooleanValue(
                         info, StaticStrings::CacheEnabled, false)),
+      _forceCacheRefill(collection.vocbase()
+                            .server()
+                            .getFeature<RocksDBIndexCacheRefillFeature>()
+                            .autoRefill()),
       _statistics(collection.vocbase()
                       .server()
                       .getFeature<metrics::MetricsFeature>()
@@ -681,7 +686,8 @@ Result RocksDBCollection::afterDropIndex(std::shared_ptr<Index> idx) {
   auto cindex = std::static_pointer_cast<RocksDBIndex>(idx);
   Result res = cindex->drop();
 
-  if (res.ok() && meta().numberDocuments() >= 32 * 1024) {
+  if (res.ok() &&
+      meta().numberDocuments() >= RocksDBEngine::kMinDocumentsForCompaction) {
     cindex->compact();  // trigger compaction to reclaim disk space
   }
 
@@ -751,9 +757,15 @@ Result RocksDBCollection::truncate(transaction::Methods& trx,
   auto state = RocksDBTransactionState::toState(&trx);
   TRI_ASSERT(!state->isReadOnlyTransaction());
 
+  RocksDBEngine& engine = _logicalCollection.vocbase()
+                              .server()
+                              .getFeature<EngineSelectorFeature>()
+                              .engine<RocksDBEngine>();
+
   if (state->isOnlyExclusiveTransaction() &&
       state->hasHint(transaction::Hints::Hint::ALLOW_RANGE_DELETE) &&
-      this->canUseRangeDeleteInWal() && _meta.numberDocuments() >= 32 * 1024) {
+      this->canUseRangeDeleteInWal() &&
+      _meta.numberDocuments() >= engine.rangeDeleteThreshold()) {
     // optimized truncate, using DeleteRange operations.
     // this can only be used if the truncate is performed as a standalone
     // operation (i.e. not part of a larger transaction)
@@ -1112,6 +1124,107 @@ Result RocksDBCollection::read(transaction::Methods* trx,
                              readOwnWrites);
 }
 
+// read multiple documents using their local document ids
+Result RocksDBCollection::readMany(transaction::Methods* trx,
+                                   std::span<LocalDocumentId const> tokens,
+                                   IndexIterator::DocumentCallback const& cb,
+                                   ReadOwnWrites readOwnWrites) const {
+  if (tokens.size() <= 1) {
+    // not worth setting up a batched lookup
+    return PhysicalCollection::readMany(trx, tokens, cb, readOwnWrites);
+  }
+
+  ::ReadTimeTracker timeTracker(
+      _statistics._readWriteMetrics,
+      [](TransactionStatistics::ReadWriteMetrics& metrics,
+         float time) noexcept { metrics.rocksdb_read_sec.count(time); });
+
+  TRI_ASSERT(trx->state()->isRunning());
+  TRI_ASSERT(objectId() != 0);
+
+  size_t const n = tokens.size();
+  std::vector<RocksDBKey> keys;
+  keys.reserve(n);
+  for (auto const& documentId : tokens) {
+    if (!documentId.isSet()) {
+      return Result{TRI_ERROR_ARANGO_DOCUMENT_KEY_BAD,
+                    "invalid local document id"};
+    }
+    keys.emplace_back();
+    keys.back().constructDocument(objectId(), documentId);
+  }
+
+  // documents found in the cache are not looked up in RocksDB. we keep
+  // the findings around so the cached values stay valid until we have
+  // invoked the callback for them
+  std::shared_ptr<cache::Cache> cache = useCache();
+  std::vector<cache::Finding> findings;
+  std::vector<rocksdb::Slice> lookupKeys;
+  lookupKeys.reserve(n);
+  if (cache != nullptr) {
+    findings.reserve(n);
+    for (auto const& key : keys) {
+      findings.emplace_back(
+          cache->find(key.string().data(),
+                      static_cast<uint32_t>(key.string().size())));
+      if (!findings.back().found()) {
+        lookupKeys.emplace_back(key.string());
+      }
+    }
+  } else {
+    for (auto const& key : keys) {
+      lookupKeys.emplace_back(key.string());
+    }
+  }
+
+  std::vector<rocksdb::PinnableSlice> values(lookupKeys.size());
+  std::vector<rocksdb::Status> statuses(lookupKeys.size());
+  if (!lookupKeys.empty()) {
+    RocksDBMethods* mthd =
+        RocksDBTransactionState::toMethods(trx, _logicalCollection.id());
+    mthd->MultiGet(RocksDBColumnFamilyManager::get(
+                       RocksDBColumnFamilyManager::Family::Documents),
+                   lookupKeys.size(), lookupKeys.data(), values.data(),
+                   statuses.data(), readOwnWrites);
+  }
+
+  // invoke the callback in the original order of the document ids
+  size_t next = 0;
+  for (size_t i = 0; i < n; ++i) {
+    if (!findings.empty() && findings[i].found()) {
+      cb(tokens[i], VPackSlice(reinterpret_cast<uint8_t const*>(
+                        findings[i].value()->value())));
+      continue;
+    }
+
+    TRI_ASSERT(next < lookupKeys.size());
+    rocksdb::Status const& s = statuses[next];
+    rocksdb::PinnableSlice const& ps = values[next];
+    ++next;
+
+    if (s.IsNotFound()) {
+      continue;
+    }
+    if (!s.ok()) {
+      return rocksutils::convertStatus(s);
+    }
+
+    TRI_ASSERT(ps.size() > 0);
+    cb(tokens[i], VPackSlice(reinterpret_cast<uint8_t const*>(ps.data())));
+
+    if (cache != nullptr) {
+      // write entry back to cache
+      cache::Cache::SimpleInserter<DocumentCacheType>{
+          static_cast<DocumentCacheType&>(*cache), keys[i].string().data(),
+          static_cast<uint32_t>(keys[i].string().size()), ps.data(),
+          static_cast<uint64_t>(ps.size())};
+    }
+  }
+  TRI_ASSERT(next == lookupKeys.size());
+
+  return {};
+}
+
 Result RocksDBCollection::insert(transaction::Methods& trx,
                                  IndexesSnapshot const& indexesSnapshot,
                                  RevisionId newRevisionId,
@@ -1247,6 +1360,45 @@ bool RocksDBCollection::cacheEnabled() const noexcept {
   return _cacheEnabled.load(std::memory_order_relaxed);
 }
 
+std::vector<std::string> RocksDBCollection::cachedKeys(
+    std::size_t maxKeys) const {
+  std::vector<std::string> keys;
+  auto cache = useCache();
+  if (cache == nullptr || maxKeys == 0) {
+    return keys;
+  }
+
+  cache->forEachKey([&](std::string_view key) {
+    keys.emplace_back(key);
+    return keys.size() < maxKeys;
+  });
+  return keys;
+}
+
+void RocksDBCollection::refillCache(transaction::Methods& trx,
+                                    std::vector<std::string> const& keys) {
+  if (keys.empty() || useCache() == nullptr) {
+    return;
+  }
+
+  VPackBuilder builder;
+  for (auto const& key : keys) {
+    rocksdb::Slice slice(key.data(), key.size());
+    if (slice.size() != 2 * sizeof(uint64_t) ||
+        RocksDBKey::objectId(slice) != objectId()) {
+      // key from a cache snapshot of a previous incarnation of the
+      // collection
+      continue;
+    }
+    // the document may have been removed or modified again in the
+    // meantime. in this case the lookup fails, and we simply skip it
+    builder.clear();
+    std::ignore = lookupDocument(trx, RocksDBKey::documentId(slice), builder,
+                                 /*withCache*/ true, /*fillCache*/ true,
+                                 ReadOwnWrites::no);
+  }
+}
+
 bool RocksDBCollection::hasDocuments() {
   RocksDBEngine& engine = _logicalCollection.vocbase()
                               .server()
@@ -1543,6 +1695,7 @@ Result RocksDBCollection::insertDocument(transaction::Methods* trx,
   if (res.ok()) {
     TRI_ASSERT(revisionId == RevisionId::fromSlice(doc));
     state->trackInsert(_logicalCollection.id(), revisionId);
+    trackCacheRefill(*trx, options, key.ref());
   }
 
   return res;
@@ -1849,6 +2002,7 @@ Result RocksDBCollection::modifyDocument(
     TRI_ASSERT(newRevisionId == RevisionId::fromSlice(newDoc));
     state->trackRemove(_logicalCollection.id(), oldRevisionId);
     state->trackInsert(_logicalCollection.id(), newRevisionId);
+    trackCacheRefill(*trx, options, key.ref());
   }
 
   return res;
@@ -2085,6 +2239,23 @@ void RocksDBCollection::invalidateCacheEntry(RocksDBKey const& k) const {
   }
 }
 
+void RocksDBCollection::trackCacheRefill(transaction::Methods& trx,
+                                         OperationOptions const& options,
+                                         RocksDBKey const& key) const {
+  if (useCache() == nullptr) {
+    return;
+  }
+  if ((_forceCacheRefill &&
+       options.refillIndexCaches != RefillIndexCaches::kDontRefill) ||
+      options.refillIndexCaches == RefillIndexCaches::kRefill) {
+    // documents are tracked under the id of the primary index. the primary
+    // index itself does not use the refill mechanism
+    RocksDBTransactionState::toState(&trx)->trackIndexCacheRefill(
+        _logicalCollection.id(), IndexId::primary(),
+        {key.buffer()->data(), key.buffer()->size()});
+  }
+}
+
 /// @brief can use non transactional range delete in write ahead log
 bool RocksDBCollection::canUseRangeDeleteInWal() const {
   if (ServerState::instance()->isSingleServer()) {
@@ -31,6 +31,8 @@
 
 #include <atomic>
 #include <memory>
+#include <string>
+#include <vector>
 
 namespace rocksdb {
 class PinnableSlice;
@@ -122,6 +124,11 @@ class RocksDBCollection final : public RocksDBMetaCollection {
               IndexIterator::DocumentCallback const& cb,
               ReadOwnWrites readOwnWrites) const override;
 
+  Result readMany(transaction::Methods* trx,
+                  std::span<LocalDocumentId const> tokens,
+                  IndexIterator::DocumentCallback const& cb,
+                  ReadOwnWrites readOwnWrites) const override;
+
   Result insert(transaction::Methods& trx,
                 IndexesSnapshot const& indexesSnapshot,
                 RevisionId newRevisionId, velocypack::Slice newDocument,
@@ -152,6 +159,17 @@ class RocksDBCollection final : public RocksDBMetaCollection {
 
   bool cacheEnabled() const noexcept;
 
+  /// @brief (re-)insert the documents with the given keys into the document
+  /// cache. the keys are RocksDB document keys, as tracked by
+  /// trackCacheRefill(). called by the cache refill thread after the
+  /// writing transactions have committed
+  void refillCache(transaction::Methods& trx,
+                   std::vector<std::string> const& keys);
+
+  /// @brief return up to maxKeys keys of documents in the document cache, in
+  /// the format expected by refillCache()
+  std::vector<std::string> cachedKeys(std::size_t maxKeys) const;
+
   bool hasDocuments() override;
 
   /// @brief lookup document in cache and / or rocksdb
@@ -240,6 +258,12 @@ class RocksDBCollection final : public RocksDBMetaCollection {
   /// @brief track key in file
   void invalidateCacheEntry(RocksDBKey const& key) const;
 
+  /// @brief schedule a refill of the document cache entry for the given
+  /// key once the transaction has committed
+  void trackCacheRefill(transaction::Methods& trx,
+                        OperationOptions const& options,
+                        RocksDBKey const& key) const;
+
   /// @brief can use non transactional range delete in write ahead log
   bool canUseRangeDeleteInWal() const;
 
@@ -269,6 +293,10 @@ class RocksDBCollection final : public RocksDBMetaCollection {
 
   std::atomic_bool _cacheEnabled;
 
+  // whether or not the document cache is automatically refilled after
+  // insert/update/replace operations
+  bool const _forceCacheRefill;
+
   TransactionStatistics& _statistics;
 };
 
@@ -27,12 +27,16 @@
 #include "Basics/Exceptions.h"
 #include "Basics/ReadLocker.h"
 #include "Basics/ScopeGuard.h"
+#include "Basics/Thread.h"
 #include "Basics/WriteLocker.h"
 #include "Metrics/Gauge.h"
 #include "RocksDBEngine/RocksDBFormat.h"
 
 #include <snappy.h>
 
+#include <algorithm>
+#include <tuple>
+
 namespace arangodb {
 
 template<class Key>
@@ -183,10 +187,7 @@ void RocksDBCuckooIndexEstimator<Key>::serialize(
       serialized.append(scratch);
     }
 
-    bool havePendingUpdates = !_insertBuffers.empty() ||
-                              !_removalBuffers.empty() ||
-                              !_truncateBuffer.empty();
-    _needToPersist.store(havePendingUpdates, std::memory_order_release);
+    _needToPersist.store(hasBufferedUpdates(), std::memory_order_release);
   }
 
   _appliedSeq.store(appliedSeq, std::memory_order_release);
@@ -249,7 +250,7 @@ template<class Key>
 Result RocksDBCuckooIndexEstimator<Key>::bufferTruncate(
     rocksdb::SequenceNumber seq) {
   Result res = basics::catchVoidToResult([&]() -> void {
-    WRITE_LOCKER(locker, _lock);
+    std::lock_guard guard(_truncateMutex);
     _truncateBuffer.emplace(seq);
     _needToPersist.store(true, std::memory_order_release);
     increaseMemoryUsage(bufferedEntrySize());
@@ -464,18 +465,19 @@ Result RocksDBCuckooIndexEstimator<Key>::bufferUpdates(
     std::vector<Key>&& removals) {
   TRI_ASSERT(!inserts.empty() || !removals.empty());
   Result res = basics::catchVoidToResult([&]() -> void {
-    WRITE_LOCKER(locker, _lock);
+    BufferStripe& stripe = bufferStripe();
+    std::lock_guard guard(stripe.mutex);
 
     if (!inserts.empty()) {
       uint64_t memoryUsage =
           bufferedEntrySize() + bufferedEntryItemSize() * inserts.size();
-      _insertBuffers.emplace(seq, std::move(inserts));
+      stripe.inserts.emplace(seq, std::move(inserts));
       increaseMemoryUsage(memoryUsage);
     }
     if (!removals.empty()) {
       uint64_t memoryUsage =
           bufferedEntrySize() + bufferedEntryItemSize() * removals.size();
-      _removalBuffers.emplace(seq, std::move(removals));
+      stripe.removals.emplace(seq, std::move(removals));
       increaseMemoryUsage(memoryUsage);
     }
 
@@ -491,91 +493,74 @@ rocksdb::SequenceNumber RocksDBCuckooIndexEstimator<Key>::applyUpdates(
     rocksdb::SequenceNumber commitSeq) {
   rocksdb::SequenceNumber appliedSeq = 0;
   Result res = basics::catchVoidToResult([&]() -> void {
-    std::vector<Key> inserts;
-    std::vector<Key> removals;
-
-    // truncate will increase this sequence
+    // all updates up to and including the last truncate marker are obsolete
     rocksdb::SequenceNumber ignoreSeq = 0;
-    while (true) {
-      bool foundTruncate = false;
-      // find out if we have buffers to apply
-      {
-        WRITE_LOCKER(locker, _lock);
-
-        uint64_t memoryUsage = 0;
-        {
-          // check for a truncate marker
-          auto it = _truncateBuffer.begin();  // sorted ASC
-          while (it != _truncateBuffer.end() && *it <= commitSeq) {
-            ignoreSeq = *it;
-            TRI_ASSERT(ignoreSeq != 0);
-            foundTruncate = true;
-            appliedSeq = std::max(appliedSeq, ignoreSeq);
-            memoryUsage += bufferedEntrySize();
-            it = _truncateBuffer.erase(it);
-          }
-        }
-        TRI_ASSERT(ignoreSeq <= commitSeq);
-
-        // check for inserts
-        auto it = _insertBuffers.begin();  // sorted ASC
-        while (it != _insertBuffers.end() && it->first <= commitSeq) {
-          if (it->first <= ignoreSeq) {
-            TRI_ASSERT(it->first <= appliedSeq);
-            memoryUsage += bufferedEntrySize() +
-                           bufferedEntryItemSize() * it->second.size();
-            it = _insertBuffers.erase(it);
-            continue;
-          }
-          inserts = std::move(it->second);
-          TRI_ASSERT(!inserts.empty());
-          appliedSeq = std::max(appliedSeq, it->first);
-          memoryUsage +=
-              bufferedEntrySize() + bufferedEntryItemSize() * inserts.size();
-          _insertBuffers.erase(it);
-          break;
-        }
-
-        // check for removals
-        it = _removalBuffers.begin();  // sorted ASC
-        while (it != _removalBuffers.end() && it->first <= commitSeq) {
-          if (it->first <= ignoreSeq) {
+    bool foundTruncate = false;
+    {
+      std::lock_guard guard(_truncateMutex);
+
+      uint64_t memoryUsage = 0;
+      auto it = _truncateBuffer.begin();  // sorted ASC
+      while (it != _truncateBuffer.end() && *it <= commitSeq) {
+        ignoreSeq = *it;
+        TRI_ASSERT(ignoreSeq != 0);
+        foundTruncate = true;
+        appliedSeq = std::max(appliedSeq, ignoreSeq);
+        memoryUsage += bufferedEntrySize();
+        it = _truncateBuffer.erase(it);
+      }
+      decreaseMemoryUsage(memoryUsage);
+    }
+    TRI_ASSERT(ignoreSeq <= commitSeq);
+
+    // collect the applicable updates from all stripes. the stripe mutexes
+    // are only held while moving the buffered vectors out
+    std::vector<std::tuple<rocksdb::SequenceNumber, bool, std::vector<Key>>>
+        updates;
+    for (auto& stripe : _bufferStripes) {
+      std::lock_guard guard(stripe.mutex);
+
+      uint64_t memoryUsage = 0;
+      auto extract = [&](UpdateBuffers& buffers, bool isInsert) {
+        auto it = buffers.begin();  // sorted ASC
+        while (it != buffers.end() && it->first <= commitSeq) {
+          TRI_ASSERT(!it->second.empty());
+          memoryUsage += bufferedEntrySize() +
+                         bufferedEntryItemSize() * it->second.size();
+          if (it->first > ignoreSeq) {
+            appliedSeq = std::max(appliedSeq, it->first);
+            updates.emplace_back(it->first, isInsert, std::move(it->second));
+          } else {
             TRI_ASSERT(it->first <= appliedSeq);
-            memoryUsage += bufferedEntrySize() +
-                           bufferedEntryItemSize() * it->second.size();
-            it = _removalBuffers.erase(it);
-            continue;
           }
-          removals = std::move(it->second);
-          TRI_ASSERT(!removals.empty());
-          appliedSeq = std::max(appliedSeq, it->first);
-          memoryUsage +=
-              bufferedEntrySize() + bufferedEntryItemSize() * removals.size();
-          _removalBuffers.erase(it);
-          break;
+          it = buffers.erase(it);
         }
+      };
+      extract(stripe.inserts, true);
+      extract(stripe.removals, false);
 
-        decreaseMemoryUsage(memoryUsage);
-        checkInvariants();
-      }
+      decreaseMemoryUsage(memoryUsage);
+    }
+    checkInvariants();
 
-      if (foundTruncate) {
-        clear();  // clear estimates
-      }
+    if (foundTruncate) {
+      clear();  // clear estimates
+    }
 
-      // no inserts or removals left to apply, drop out of loop
-      if (inserts.empty() && removals.empty()) {
-        break;
+    // apply the updates in sequence order, inserts before removals of the
+    // same sequence number
+    std::sort(updates.begin(), updates.end(),
+              [](auto const& lhs, auto const& rhs) {
+                return std::make_tuple(std::get<0>(lhs), !std::get<1>(lhs)) <
+                       std::make_tuple(std::get<0>(rhs), !std::get<1>(rhs));
+              });
+    for (auto const& [seq, isInsert, keys] : updates) {
+      if (isInsert) {
+        insert(keys);
+      } else {
+        remove(keys);
       }
-
-      // apply inserts
-      insert(inserts);
-      inserts.clear();
-
-      // apply removals
-      remove(removals);
-      removals.clear();
-    }  // </while(true)>
+    }
   });
   return appliedSeq;
 }
@@ -731,10 +716,33 @@ void RocksDBCuckooIndexEstimator<Key>::initializeDefault() {
   }
 }
 
+template<class Key>
+typename RocksDBCuckooIndexEstimator<Key>::BufferStripe&
+RocksDBCuckooIndexEstimator<Key>::bufferStripe() noexcept {
+  return _bufferStripes[Thread::currentThreadNumber() % kNumBufferStripes];
+}
+
+template<class Key>
+bool RocksDBCuckooIndexEstimator<Key>::hasBufferedUpdates() {
+  {
+    std::lock_guard guard(_truncateMutex);
+    if (!_truncateBuffer.empty()) {
+      return true;
+    }
+  }
+  for (auto& stripe : _bufferStripes) {
+    std::lock_guard guard(stripe.mutex);
+    if (!stripe.inserts.empty() || !stripe.removals.empty()) {
+      return true;
+    }
+  }
+  return false;
+}
+
 template<class Key>
 void RocksDBCuckooIndexEstimator<Key>::increaseMemoryUsage(
     uint64_t value) noexcept {
-  _memoryUsage += value;
+  _memoryUsage.fetch_add(value, std::memory_order_relaxed);
   if (ADB_LIKELY(_memoryUsageMetric != nullptr)) {
     _memoryUsageMetric->fetch_add(value);
   }
@@ -743,8 +751,9 @@ void RocksDBCuckooIndexEstimator<Key>::increaseMemoryUsage(
 template<class Key>
 void RocksDBCuckooIndexEstimator<Key>::decreaseMemoryUsage(
     uint64_t value) noexcept {
-  TRI_ASSERT(_memoryUsage >= value);
-  _memoryUsage -= value;
+  [[maybe_unused]] uint64_t previous =
+      _memoryUsage.fetch_sub(value, std::memory_order_relaxed);
+  TRI_ASSERT(previous >= value);
   if (ADB_LIKELY(_memoryUsageMetric != nullptr)) {
     _memoryUsageMetric->fetch_sub(value);
   }
@@ -783,21 +792,27 @@ void RocksDBCuckooIndexEstimator<Key>::deriveSizesAndAlloc() {
 template<class Key>
 void RocksDBCuckooIndexEstimator<Key>::drainNoLock() {
   uint64_t memoryUsage = 0;
-  for (auto const& it : _insertBuffers) {
-    memoryUsage +=
-        bufferedEntrySize() + bufferedEntryItemSize() * it.second.size();
-  }
+  for (auto& stripe : _bufferStripes) {
+    std::lock_guard guard(stripe.mutex);
+    for (auto const& it : stripe.inserts) {
+      memoryUsage +=
+          bufferedEntrySize() + bufferedEntryItemSize() * it.second.size();
+    }
 
-  for (auto const& it : _removalBuffers) {
-    memoryUsage +=
-        bufferedEntrySize() + bufferedEntryItemSize() * it.second.size();
-  }
+    for (auto const& it : stripe.removals) {
+      memoryUsage +=
+          bufferedEntrySize() + bufferedEntryItemSize() * it.second.size();
+    }
 
-  memoryUsage += bufferedEntrySize() * _truncateBuffer.size();
+    stripe.inserts.clear();
+    stripe.removals.clear();
+  }
 
-  _insertBuffers.clear();
-  _removalBuffers.clear();
-  _truncateBuffer.clear();
+  {
+    std::lock_guard guard(_truncateMutex);
+    memoryUsage += bufferedEntrySize() * _truncateBuffer.size();
+    _truncateBuffer.clear();
+  }
 
   decreaseMemoryUsage(memoryUsage);
   checkInvariants();
@@ -835,14 +850,16 @@ void RocksDBCuckooIndexEstimator<Key>::checkInvariants() const {
   // debugging.
 #if 0
   uint64_t memoryUsage = 0;
-  for (auto const& it : _insertBuffers) {
-    memoryUsage +=
-        bufferedEntrySize() + bufferedEntryItemSize() * it.second.size();
-  }
+  for (auto const& stripe : _bufferStripes) {
+    for (auto const& it : stripe.inserts) {
+      memoryUsage +=
+          bufferedEntrySize() + bufferedEntryItemSize() * it.second.size();
+    }
 
-  for (auto const& it : _removalBuffers) {
-    memoryUsage +=
-        bufferedEntrySize() + bufferedEntryItemSize() * it.second.size();
+    for (auto const& it : stripe.removals) {
+      memoryUsage +=
+          bufferedEntrySize() + bufferedEntryItemSize() * it.second.size();
+    }
   }
 
   memoryUsage += bufferedEntrySize() * _truncateBuffer.size();
@@ -24,9 +24,12 @@
 
 #pragma once
 
+#include <array>
+#include <atomic>
 #include <cstddef>
 #include <cstdint>
 #include <map>
+#include <mutex>
 #include <set>
 #include <type_traits>
 #include <utility>
@@ -76,6 +79,10 @@ class RocksDBCuckooIndexEstimator {
   static constexpr size_t kCounterSize = sizeof(uint32_t);
   // maximum number of cuckoo rounds on insertion
   static constexpr unsigned kMaxRounds = 16;
+  // number of stripes for buffered updates. every writer thread buffers its
+  // updates in one of the stripes, so that concurrent writers rarely
+  // contend for the same mutex
+  static constexpr std::size_t kNumBufferStripes = 16;
 
  private:
   // Helper class to hold the finger prints.
@@ -519,21 +526,37 @@ class RocksDBCuckooIndexEstimator {
 
   void deriveSizesAndAlloc();
 
+  // buffered inserts or removals, keyed by sequence number
+  using UpdateBuffers =
+      std::multimap<rocksdb::SequenceNumber, std::vector<Key>>;
+
+  // buffered updates of one stripe, protected by the stripe's mutex.
+  // aligned to avoid false sharing between the stripes
+  struct alignas(64) BufferStripe {
+    std::mutex mutex;
+    UpdateBuffers inserts;
+    UpdateBuffers removals;
+  };
+
   // used for calculating memory usage in _bufferedMemoryUsage
   // approximate memory usage for top-level items.
-  // size of one allocation plus the size of an entry in _insertBuffers.
+  // size of one allocation plus the size of an entry in the update buffers.
   static constexpr uint64_t bufferedEntrySize() {
-    return sizeof(void*) +
-           sizeof(typename decltype(_insertBuffers)::value_type);
+    return sizeof(void*) + sizeof(typename UpdateBuffers::value_type);
   }
 
   // approximate memory usage for individual items in a top-level item.
-  // does not take into account unused capacity in _insertBuffers.second.
+  // does not take into account unused capacity in the buffered vectors.
   static constexpr uint64_t bufferedEntryItemSize() {
-    return sizeof(
-        typename decltype(_insertBuffers)::value_type::second_type::value_type);
+    return sizeof(typename UpdateBuffers::mapped_type::value_type);
   }
 
+  // returns the stripe used by the current thread
+  BufferStripe& bufferStripe() noexcept;
+
+  // returns whether there are any buffered updates or truncates
+  bool hasBufferedUpdates();
+
   void increaseMemoryUsage(uint64_t value) noexcept;
   void decreaseMemoryUsage(uint64_t value) noexcept;
 
@@ -575,15 +598,17 @@ class RocksDBCuckooIndexEstimator {
   std::atomic<rocksdb::SequenceNumber> _appliedSeq;
   std::atomic<bool> _needToPersist;
 
-  uint64_t _memoryUsage;
-  std::multimap<rocksdb::SequenceNumber, std::vector<Key>> _insertBuffers;
-  std::multimap<rocksdb::SequenceNumber, std::vector<Key>> _removalBuffers;
+  // updated concurrently by writers buffering into different stripes
+  std::atomic<uint64_t> _memoryUsage;
 
-  // current assumption for memory accounting is that both members use the same
-  // underlying data structures.
-  static_assert(std::is_same_v<typename decltype(_insertBuffers)::value_type,
-                               typename decltype(_removalBuffers)::value_type>);
+  // buffered inserts and removals. they are only protected by the stripe
+  // mutexes and not by _lock, so that buffering updates neither blocks nor
+  // is blocked by readers of the estimates.
+  // lock order: _lock before any stripe mutex
+  std::array<BufferStripe, kNumBufferStripes> _bufferStripes;
 
+  // protects _truncateBuffer
+  std::mutex _truncateMutex;
   std::set<rocksdb::SequenceNumber> _truncateBuffer;
 
   // Instance to compute the first hash function
@@ -397,6 +397,11 @@ std::unique_ptr<rocksdb::Iterator> RocksDBDumpContext::buildIterator(
   ro.snapshot = _snapshot->snapshot();
   ro.prefix_same_as_start = true;
   ro.iterate_upper_bound = &ci.upper;
+  // dumps read each collection sequentially from start to end. let rocksdb
+  // grow the readahead size while we go, and prefetch the following blocks
+  // asynchronously while the current batch is processed
+  ro.adaptive_readahead = true;
+  ro.async_io = true;
 
   rocksdb::ColumnFamilyHandle* cf = RocksDBColumnFamilyManager::get(
       RocksDBColumnFamilyManager::Family::Documents);
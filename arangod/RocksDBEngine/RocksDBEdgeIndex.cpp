@@ -27,7 +27,6 @@
 #include "ApplicationFeatures/ApplicationServer.h"
 #include "Aql/AstNode.h"
 #include "Aql/SortCondition.h"
-#include "Basics/Endian.h"
 #include "Basics/Exceptions.h"
 #include "Basics/GlobalResourceMonitor.h"
 #include "Basics/ResourceUsage.h"
@@ -39,6 +38,7 @@
 #include "Cache/TransactionalCache.h"
 #include "Indexes/SimpleAttributeEqualityMatcher.h"
 #include "Logger/LogMacros.h"
+#include "RocksDBEngine/RocksDBCacheValueCompression.h"
 #include "RocksDBEngine/RocksDBCollection.h"
 #include "RocksDBEngine/RocksDBColumnFamilyManager.h"
 #include "RocksDBEngine/RocksDBCommon.h"
@@ -58,6 +58,7 @@
 #include "Utils/SingleCollectionTransaction.h"
 #include "VocBase/LogicalCollection.h"
 
+#include <absl/strings/str_cat.h>
 #include <rocksdb/db.h>
 #include <rocksdb/slice.h>
 #include <rocksdb/utilities/transaction_db.h>
@@ -70,8 +71,6 @@
 #include <cmath>
 #include <tuple>
 
-#include <lz4.h>
-
 using namespace arangodb;
 using namespace arangodb::basics;
 
@@ -80,84 +79,6 @@ using EdgeIndexCacheType = cache::TransactionalCache<cache::BinaryKeyHasher>;
 
 constexpr bool EdgeIndexFillBlockCache = false;
 
-// values > this size will not be stored LZ4-compressed in the in-memory
-// edge cache
-constexpr size_t maxValueSizeForCompression = 1073741824;  // 1GB
-
-// length of compressed header.
-// the header format is
-// - byte 0: hard-coded to 0xff:
-// - byte 1-4: uncompressed size, encoded as a uint32_t in big endian order
-constexpr size_t compressedHeaderLength = 5;
-
-size_t resizeCompressionBuffer(std::string& scratch, size_t value) {
-  if (scratch.size() < value) {
-    size_t increment = value - scratch.size();
-    scratch.resize(value);
-    // return memory usage increase
-    return increment;
-  }
-  return 0;
-}
-
-std::tuple<char const*, size_t, bool> tryCompress(
-    velocypack::Slice slice, size_t size, size_t minValueSizeForCompression,
-    int accelerationFactor, std::string& scratch,
-    std::function<void(size_t)> const& memoryUsageCallback) {
-  char const* data = slice.startAs<char>();
-
-  if (size < minValueSizeForCompression || size > maxValueSizeForCompression) {
-    // value too big or too small. return original value
-    return {data, size, /*didCompress*/ false};
-  }
-
-  // determine maximum size for output buffer
-  int maxLength = LZ4_compressBound(static_cast<int>(size));
-  if (maxLength <= 0) {
-    // error. return original value
-    return {data, size, /*didCompress*/ false};
-  }
-
-  // resize output buffer if necessary
-  size_t memoryUsage = resizeCompressionBuffer(
-      scratch, compressedHeaderLength + static_cast<size_t>(maxLength));
-  memoryUsageCallback(memoryUsage);
-
-  uint32_t uncompressedSize = basics::hostToBig(static_cast<uint32_t>(size));
-  // store compressed value using a velocypack Custom type.
-  // the compressed value is prepended by the following header:
-  // - byte 0: hard-coded to 0xff
-  // - byte 1-4: uncompressed size, encoded as a uint32_t in big endian
-  // order
-
-  // write prefix byte, so the decoder can distinguish between compressed
-  // values and uncompressed values. note that 0xff is a velocypack Custom
-  // type and should thus not appear as the first byte in uncompressed
-  // data.
-  scratch[0] = 0xffU;
-  // copy length of uncompressed data into bytes 1-4.
-  memcpy(scratch.data() + 1, &uncompressedSize, sizeof(uncompressedSize));
-
-  bool didCompress = false;
-
-  // compress data into output buffer, starting at byte 5.
-  int compressedSize = LZ4_compress_fast(
-      data, scratch.data() + compressedHeaderLength, static_cast<int>(size),
-      static_cast<int>(scratch.size() - compressedHeaderLength),
-      accelerationFactor);
-  if (compressedSize > 0 && (static_cast<size_t>(compressedSize) +
-                             compressedHeaderLength) < size * 3 / 4) {
-    // only store the compressed version if it saves at least 25%
-    data = scratch.data();
-    size = static_cast<size_t>(compressedSize + compressedHeaderLength);
-    TRI_ASSERT(reinterpret_cast<uint8_t const*>(data)[0] == 0xffU);
-    TRI_ASSERT(size <= scratch.size());
-    didCompress = true;
-  }
-  // return compressed or uncompressed value
-  return {data, size, didCompress};
-}
-
 template<std::size_t N>
 class StringFromParts final : public velocypack::IStringFromParts {
  public:
@@ -451,34 +372,13 @@ class RocksDBEdgeIndexLookupIterator final : public IndexIterator {
             needRocksLookup = false;
             // We got sth. in the cache
             uint8_t const* data = finding.value()->value();
-            if (data[0] == 0xffU) {
+            if (rocksutils::isCompressedCacheValue(data)) {
               // Custom type. this means the data is lz4-compressed
-              TRI_ASSERT(finding.value()->size() >= ::compressedHeaderLength);
-              // read size of uncompressed value
-              uint32_t uncompressedSize;
-              memcpy(&uncompressedSize, data + 1, sizeof(uncompressedSize));
-              uncompressedSize = basics::bigToHost<uint32_t>(uncompressedSize);
-
-              // prepare _builder's Buffer to hold the uncompressed data
+              // prepare _builder to hold the uncompressed data
               resetInplaceMemory();
               TRI_ASSERT(_builder.slice().isNone());
-              _builder.reserve(uncompressedSize);
-              TRI_ASSERT(_builder.bufferRef().data() == _builder.start());
-
-              // uncompressed directly into _builder's Buffer.
-              // this should not go wrong if we have a big enough output buffer.
-              int size = LZ4_decompress_safe(
-                  reinterpret_cast<char const*>(data) +
-                      ::compressedHeaderLength,
-                  reinterpret_cast<char*>(_builder.bufferRef().data()),
-                  static_cast<int>(finding.value()->valueSize() -
-                                   ::compressedHeaderLength),
-                  static_cast<int>(uncompressedSize));
-              TRI_ASSERT(uncompressedSize == static_cast<size_t>(size));
-
-              // we have uncompressed data directly into the Buffer's memory.
-              // we need to tell the Buffer to advance its end pointer.
-              _builder.resetTo(uncompressedSize);
+              rocksutils::decompressCacheValue(
+                  data, finding.value()->valueSize(), _builder);
 
               size_t memoryUsage = _builder.size();
               _resourceMonitor.increaseMemoryUsage(memoryUsage);
@@ -635,7 +535,7 @@ class RocksDBEdgeIndexLookupIterator final : public IndexIterator {
 
     size_t const originalSize = slice.byteSize();
 
-    auto [data, size, didCompress] = tryCompress(
+    auto [data, size, didCompress] = rocksutils::tryCompressCacheValue(
         slice, originalSize, minValueSizeForCompression, accelerationFactor,
         _lz4CompressBuffer, [this](size_t memoryUsage) {
           _resourceMonitor.increaseMemoryUsage(memoryUsage);
@@ -906,6 +806,30 @@ void RocksDBEdgeIndex::refillCache(transaction::Methods& trx,
   }
 }
 
+std::vector<std::string> RocksDBEdgeIndex::cachedKeys(
+    std::size_t maxKeys) const {
+  std::vector<std::string> keys;
+  auto cache = useCache();
+  if (cache == nullptr || maxKeys == 0) {
+    return keys;
+  }
+
+  std::string const* cacheKeyCollection = _cacheKeyCollectionName.get();
+  cache->forEachKey([&](std::string_view key) {
+    if (key.starts_with('/')) {
+      // prefix-compressed key. restore the full _from/_to value
+      if (cacheKeyCollection == nullptr) {
+        return true;
+      }
+      keys.emplace_back(absl::StrCat(*cacheKeyCollection, key));
+    } else {
+      keys.emplace_back(key);
+    }
+    return keys.size() < maxKeys;
+  });
+  return keys;
+}
+
 void RocksDBEdgeIndex::handleCacheInvalidation(cache::Cache& cache,
                                                transaction::Methods& trx,
                                                OperationOptions const& options,
@@ -1063,7 +987,7 @@ void RocksDBEdgeIndex::warmupInternal(transaction::Methods* trx,
 
     size_t const originalSize = b.slice().byteSize();
 
-    auto [data, size, didCompress] = tryCompress(
+    auto [data, size, didCompress] = rocksutils::tryCompressCacheValue(
         b.slice(), originalSize, minValueSizeForCompression, accelerationFactor,
         lz4CompressBuffer, [](size_t /*memoryUsage*/) {});
 
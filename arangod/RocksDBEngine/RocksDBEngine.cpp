@@ -123,6 +123,7 @@
 #include <rocksdb/filter_policy.h>
 #include <rocksdb/iterator.h>
 #include <rocksdb/options.h>
+#include <rocksdb/rate_limiter.h>
 #include <rocksdb/slice_transform.h>
 #include <rocksdb/sst_file_reader.h>
 #include <rocksdb/statistics.h>
@@ -136,8 +137,14 @@
 #include <velocypack/Collection.h>
 #include <velocypack/Iterator.h>
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <exception>
 #include <iomanip>
 #include <limits>
+#include <mutex>
+#include <thread>
 #include <utility>
 
 // we will not use the multithreaded index creation that uses rocksdb's sst
@@ -178,6 +185,9 @@ DECLARE_GAUGE(arangodb_index_estimates_memory_usage, uint64_t,
               "Total memory consumed by all index selectivity estimates");
 DECLARE_COUNTER(arangodb_revision_tree_rebuilds_success_total,
                 "Number of successful revision tree rebuilds");
+DECLARE_COUNTER(arangodb_database_open_time_msec_total,
+                "Total time spent opening databases and loading the "
+                "metadata of their collections [ms]");
 DECLARE_COUNTER(arangodb_revision_tree_rebuilds_failure_total,
                 "Number of failed revision tree rebuilds");
 DECLARE_COUNTER(arangodb_revision_tree_hibernations_total,
@@ -276,6 +286,7 @@ RocksDBEngine::RocksDBEngine(Server& server,
       _releasedTick(0),
       _syncInterval(100),
       _syncDelayThreshold(5000),
+      _syncGroupCommitMaxDelay(0),
       _requiredDiskFreePercentage(0.01),
       _requiredDiskFreeBytes(16 * 1024 * 1024),
       _useThrottle(true),
@@ -289,6 +300,8 @@ RocksDBEngine::RocksDBEngine(Server& server,
       _createShaFiles(false),
 #endif
       _useRangeDeleteInWal(true),
+      _rangeDeleteThreshold(0),
+      _hotDirectorySizeLimit(0),
       _lastHealthCheckSuccessful(false),
       _dbExisted(false),
       _runningRebuilds(0),
@@ -333,6 +346,9 @@ RocksDBEngine::RocksDBEngine(Server& server,
       _metricsTreeResurrections(
           server.getFeature<metrics::MetricsFeature>().add(
               arangodb_revision_tree_resurrections_total{})),
+      _metricsDatabaseOpenTime(
+          server.getFeature<metrics::MetricsFeature>().add(
+              arangodb_database_open_time_msec_total{})),
       _metricsEdgeCacheEntriesSizeInitial(
           server.getFeature<metrics::MetricsFeature>().add(
               rocksdb_cache_edge_inserts_uncompressed_entries_size_total{})),
@@ -527,6 +543,33 @@ attribute.)");
           arangodb::options::Flags::OnSingle,
           arangodb::options::Flags::Uncommon));
 
+  options
+      ->addOption("--rocksdb.sync-group-commit-max-delay",
+                  "The maximum time a WAL disk sync for a commit with "
+                  "`waitForSync` is delayed to let concurrent commits join "
+                  "the same sync (in microseconds, 0 = no delay).",
+                  new UInt64Parameter(&_syncGroupCommitMaxDelay),
+                  arangodb::options::makeFlags(
+                      arangodb::options::Flags::DefaultNoComponents,
+                      arangodb::options::Flags::OnDBServer,
+                      arangodb::options::Flags::OnSingle,
+                      arangodb::options::Flags::Uncommon))
+      .setIntroducedIn(31200)
+      .setLongDescription(R"(Commits that require a WAL disk sync are grouped:
+only one of them syncs the WAL at a time, and all commits that arrive while a
+sync is in progress are covered by the next single sync. This happens
+regardless of this option.
+
+If this option is set to a value greater than `0` and commits requiring a sync
+arrive concurrently, the thread executing a sync waits for up to half of the
+observed sync duration, but at most for the configured value, before starting
+the sync, so that more commits can join the group. This trades some commit
+latency for a lower number of disk syncs, which can increase the throughput of
+durable writes on storage with slow syncs.
+
+Grouping requires the background sync thread, i.e. `--rocksdb.sync-interval`
+must not be `0`.)");
+
   options
       ->addOption("--rocksdb.wal-file-timeout",
                   "The timeout after which unused WAL files are deleted "
@@ -654,6 +697,55 @@ on the write rate.)");
                       arangodb::options::Flags::Uncommon))
       .setIntroducedIn(30805);
 
+  options
+      ->addOption("--rocksdb.compaction-rate-limit",
+                  "The maximum write rate for flushes and compactions (in "
+                  "bytes per second, 0 = unlimited).",
+                  new UInt64Parameter(&_compactionRateLimit),
+                  arangodb::options::makeFlags(
+                      arangodb::options::Flags::DefaultNoComponents,
+                      arangodb::options::Flags::OnDBServer,
+                      arangodb::options::Flags::OnSingle,
+                      arangodb::options::Flags::Uncommon))
+      .setIntroducedIn(31200)
+      .setLongDescription(R"(If set to a non-zero value, the write rate of
+RocksDB's background flushes and compactions is limited to this value while
+the server is idle. While the server is busy with foreground operations, the
+lower rate configured via `--rocksdb.compaction-rate-limit-under-load` is
+used instead. This lets compactions catch up with debt created by bulk imports
+when there is spare capacity, without affecting the request latencies during
+busy times.
+
+The limit is lifted if the estimated amount of pending compaction data
+approaches `--rocksdb.pending-compactions-slowdown-trigger`, so that the
+limiting does not cause write stalls.)");
+
+  options
+      ->addOption("--rocksdb.compaction-rate-limit-under-load",
+                  "The write rate for flushes and compactions while the "
+                  "server is busy (in bytes per second, 0 = a quarter of "
+                  "--rocksdb.compaction-rate-limit).",
+                  new UInt64Parameter(&_compactionRateLimitUnderLoad),
+                  arangodb::options::makeFlags(
+                      arangodb::options::Flags::DefaultNoComponents,
+                      arangodb::options::Flags::OnDBServer,
+                      arangodb::options::Flags::OnSingle,
+                      arangodb::options::Flags::Uncommon))
+      .setIntroducedIn(31200);
+
+  options
+      ->addOption("--rocksdb.compaction-rate-limit-dequeue-time",
+                  "The scheduler queue time (in milliseconds) from which "
+                  "onwards the server is considered busy for limiting the "
+                  "compaction write rate.",
+                  new UInt64Parameter(&_compactionRateLimitDequeueTime),
+                  arangodb::options::makeFlags(
+                      arangodb::options::Flags::DefaultNoComponents,
+                      arangodb::options::Flags::OnDBServer,
+                      arangodb::options::Flags::OnSingle,
+                      arangodb::options::Flags::Uncommon))
+      .setIntroducedIn(31200);
+
 #ifdef USE_ENTERPRISE
   options->addOption("--rocksdb.create-sha-files",
                      "Whether to enable the generation of sha256 files for "
@@ -691,8 +783,74 @@ Single server and Active Failover deployments do not use RangeDeletes regardless
 of the value of this option.
 
 Note that it is not guaranteed that all truncate operations use a RangeDelete
-operation. For collections containing a low number of documents, the O(n)
-truncate method may still be used.)");
+operation. For collections containing fewer documents than configured via
+`--rocksdb.range-delete-threshold`, the O(n) truncate method is used.)");
+
+  options
+      ->addOption("--rocksdb.range-delete-threshold",
+                  "The minimum number of documents in a collection for which "
+                  "truncate and drop operations use RangeDelete operations.",
+                  new UInt64Parameter(&_rangeDeleteThreshold),
+                  arangodb::options::makeFlags(
+                      arangodb::options::Flags::DefaultNoComponents,
+                      arangodb::options::Flags::OnDBServer,
+                      arangodb::options::Flags::OnSingle,
+                      arangodb::options::Flags::Uncommon))
+      .setIntroducedIn(31200)
+      .setLongDescription(R"(Truncating a collection or dropping a collection
+or index with fewer documents removes the documents and index entries one by
+one. This produces large write batches and many tombstones, which slow down
+later reads of the same key ranges until they are compacted away.
+RangeDelete operations remove a whole key range with a single marker instead.
+
+The default value of `0` makes all such operations use RangeDeletes.
+Truncate operations can only use RangeDeletes if they are not part of a larger
+transaction, and in the cluster only if `--rocksdb.use-range-delete-in-wal`
+is enabled.)");
+
+  options
+      ->addOption("--rocksdb.cold-directory",
+                  "Optional directory for the .sst files of the lowest "
+                  "LSM tree levels, e.g. on cheaper and slower storage.",
+                  new StringParameter(&_coldDirectory),
+                  arangodb::options::makeFlags(
+                      arangodb::options::Flags::DefaultNoComponents,
+                      arangodb::options::Flags::OnAgent,
+                      arangodb::options::Flags::OnDBServer,
+                      arangodb::options::Flags::OnSingle,
+                      arangodb::options::Flags::Uncommon))
+      .setIntroducedIn(31200)
+      .setLongDescription(R"(If set, RocksDB keeps the .sst files of the
+upper LSM tree levels in the database directory, up to the size configured
+via `--rocksdb.hot-directory-size-limit`. The files of the lower levels,
+which hold most of the data but are accessed less frequently, are written
+to this directory instead. The database directory can then be placed on
+fast local storage, while the bulk of the data resides on a larger and
+cheaper volume.
+
+Files are moved between the directories by regular compactions only, so
+changing the option does not immediately affect existing .sst files. The
+WAL files always remain in the database directory or in the directory
+configured via `--rocksdb.wal-directory`.
+
+The total size and number of .sst files in the cold directory are reported
+in the `rocksdb_cold_sst_files_size` and `rocksdb_cold_sst_files` metrics.
+With `--rocksdb.enable-statistics`, the `rocksdb_last_level_read_bytes`
+and `rocksdb_non_last_level_read_bytes` metrics show how reads are
+distributed over the levels.)");
+
+  options
+      ->addOption("--rocksdb.hot-directory-size-limit",
+                  "The target size of the .sst files in the database "
+                  "directory if `--rocksdb.cold-directory` is set.",
+                  new UInt64Parameter(&_hotDirectorySizeLimit),
+                  arangodb::options::makeFlags(
+                      arangodb::options::Flags::DefaultNoComponents,
+                      arangodb::options::Flags::OnAgent,
+                      arangodb::options::Flags::OnDBServer,
+                      arangodb::options::Flags::OnSingle,
+                      arangodb::options::Flags::Uncommon))
+      .setIntroducedIn(31200);
 
   options
       ->addOption("--rocksdb.debug-logging",
@@ -823,10 +981,27 @@ void RocksDBEngine::validateOptions(
     _throttleScalingFactor = 1;
   }
 
+  if (!_coldDirectory.empty() && _hotDirectorySizeLimit == 0) {
+    LOG_TOPIC("2c7e4", FATAL, arangodb::Logger::CONFIG)
+        << "--rocksdb.cold-directory requires a non-zero value for "
+           "--rocksdb.hot-directory-size-limit";
+    FATAL_ERROR_EXIT();
+  }
+
   if (_throttleSlots < 8) {
     _throttleSlots = 8;
   }
 
+  if (_compactionRateLimit > 0) {
+    if (_compactionRateLimitUnderLoad == 0) {
+      _compactionRateLimitUnderLoad = std::max<uint64_t>(
+          _compactionRateLimit / 4, std::min<uint64_t>(_compactionRateLimit,
+                                                       1024 * 1024));
+    }
+    _compactionRateLimitUnderLoad =
+        std::min(_compactionRateLimitUnderLoad, _compactionRateLimit);
+  }
+
   if (_syncInterval > 0) {
     if (_syncInterval < minSyncInterval) {
       // _syncInterval = 0 means turned off!
@@ -1031,6 +1206,32 @@ void RocksDBEngine::start() {
 
   // we only want to modify DBOptions here, no ColumnFamily options or the like
   _dbOptions = _optionsProvider.getOptions();
+
+  if (!_coldDirectory.empty()) {
+    if (!basics::FileUtils::isDirectory(_coldDirectory)) {
+      std::string systemErrorStr;
+      long errorNo;
+
+      auto res = TRI_CreateRecursiveDirectory(_coldDirectory.c_str(), errorNo,
+                                              systemErrorStr);
+      if (res != TRI_ERROR_NO_ERROR) {
+        LOG_TOPIC("4d0b7", FATAL, arangodb::Logger::ENGINES)
+            << "unable to create RocksDB cold directory '" << _coldDirectory
+            << "': " << systemErrorStr;
+        FATAL_ERROR_EXIT();
+      }
+    }
+    // newer data is placed into the earlier paths. once the target size
+    // of a path is exceeded, lower levels are placed into the next path
+    _dbOptions.db_paths.clear();
+    _dbOptions.db_paths.emplace_back(_path, _hotDirectorySizeLimit);
+    _dbOptions.db_paths.emplace_back(_coldDirectory,
+                                     std::numeric_limits<uint64_t>::max());
+    LOG_TOPIC("f8c31", INFO, arangodb::Logger::ENGINES)
+        << "storing .sst files of the lower levels in '" << _coldDirectory
+        << "', size limit for the database directory: "
+        << basics::StringUtils::formatSize(_hotDirectorySizeLimit);
+  }
   if (_dbOptions.wal_dir.empty()) {
     _dbOptions.wal_dir = basics::FileUtils::buildFilename(_path, "journals");
   }
@@ -1104,10 +1305,18 @@ void RocksDBEngine::start() {
     _dbOptions.listeners.push_back(_throttleListener);
   }
 
+  if (_compactionRateLimit > 0) {
+    // start with the full rate. the background thread will adjust the rate
+    // to the current load
+    _compactionRateLimiter.reset(rocksdb::NewGenericRateLimiter(
+        static_cast<int64_t>(_compactionRateLimit)));
+    _dbOptions.rate_limiter = _compactionRateLimiter;
+  }
+
   _errorListener = std::make_shared<RocksDBBackgroundErrorListener>();
   _dbOptions.listeners.push_back(_errorListener);
-  _dbOptions.listeners.push_back(
-      std::make_shared<RocksDBMetricsListener>(server()));
+  _metricsListener = std::make_shared<RocksDBMetricsListener>(server());
+  _dbOptions.listeners.push_back(_metricsListener);
 
   rocksdb::BlockBasedTableOptions tableOptions =
       _optionsProvider.getTableOptions();
@@ -1233,7 +1442,8 @@ void RocksDBEngine::start() {
   if (_syncInterval > 0) {
     _syncThread = std::make_unique<RocksDBSyncThread>(
         *this, std::chrono::milliseconds(_syncInterval),
-        std::chrono::milliseconds(_syncDelayThreshold));
+        std::chrono::milliseconds(_syncDelayThreshold),
+        std::chrono::microseconds(_syncGroupCommitMaxDelay));
     if (!_syncThread->start()) {
       LOG_TOPIC("63919", FATAL, Logger::ENGINES)
           << "could not start rocksdb sync thread";
@@ -1431,6 +1641,10 @@ bool RocksDBEngine::hasBackgroundError() const {
   return _errorListener != nullptr && _errorListener->called();
 }
 
+bool RocksDBEngine::writesStalled() const noexcept {
+  return _metricsListener != nullptr && _metricsListener->writesStalled();
+}
+
 std::unique_ptr<transaction::Manager> RocksDBEngine::createTransactionManager(
     transaction::ManagerFeature& feature) {
   return std::make_unique<transaction::Manager>(feature);
@@ -1971,6 +2185,46 @@ void RocksDBEngine::compactRange(RocksDBKeyBounds bounds) {
   processCompactions();
 }
 
+void RocksDBEngine::adjustCompactionRateLimit() {
+  if (_compactionRateLimiter == nullptr) {
+    return;
+  }
+
+  uint64_t target = _compactionRateLimit;
+
+  Scheduler* scheduler = arangodb::SchedulerFeature::SCHEDULER;
+  if (scheduler != nullptr && scheduler->getLastLowPriorityDequeueTime() >=
+                                  _compactionRateLimitDequeueTime) {
+    // foreground operations are queuing up. slow down compactions, unless
+    // they are close to causing write stalls
+    target = _compactionRateLimitUnderLoad;
+
+    uint64_t softLimit = _db->GetOptions().soft_pending_compaction_bytes_limit;
+    uint64_t pending = 0;
+    if (softLimit > 0 &&
+        _db->GetAggregatedIntProperty(
+            rocksdb::DB::Properties::kEstimatePendingCompactionBytes,
+            &pending) &&
+        pending >= softLimit / 2) {
+      target = _compactionRateLimit;
+    }
+  }
+
+  auto current =
+      static_cast<uint64_t>(_compactionRateLimiter->GetBytesPerSecond());
+  if (target > current) {
+    // speed up gradually, so that short idle periods do not cause sudden
+    // bursts of compaction writes
+    target = std::min(target, current * 2);
+  }
+  if (target != current) {
+    LOG_TOPIC("5e7c1", DEBUG, Logger::ENGINES)
+        << "adjusting compaction write rate from " << current << " to "
+        << target << " bytes per second";
+    _compactionRateLimiter->SetBytesPerSecond(static_cast<int64_t>(target));
+  }
+}
+
 void RocksDBEngine::processCompactions() {
   Scheduler* scheduler = arangodb::SchedulerFeature::SCHEDULER;
   if (scheduler == nullptr) {
@@ -2078,7 +2332,8 @@ Result RocksDBEngine::dropCollection(TRI_vocbase_t& vocbase,
                                      LogicalCollection& coll) {
   auto* rcoll = static_cast<RocksDBMetaCollection*>(coll.getPhysical());
   bool const prefixSameAsStart = true;
-  bool const useRangeDelete = rcoll->meta().numberDocuments() >= 32 * 1024;
+  uint64_t const numberDocuments = rcoll->meta().numberDocuments();
+  bool const useRangeDelete = numberDocuments >= _rangeDeleteThreshold;
 
   auto resLock = rcoll->lockWrite();  // technically not necessary
   if (resLock != TRI_ERROR_NO_ERROR) {
@@ -2184,7 +2439,7 @@ Result RocksDBEngine::dropCollection(TRI_vocbase_t& vocbase,
   // amount of documents. otherwise don't run compaction, because it will
   // slow things down a lot, especially during tests that create/drop LOTS
   // of collections
-  if (useRangeDelete) {
+  if (numberDocuments >= kMinDocumentsForCompaction) {
     rcoll->compact();
   }
 
@@ -2896,7 +3151,7 @@ Result RocksDBEngine::dropDatabase(TRI_voc_tick_t id) {
 
     auto const cnt = RocksDBMetadata::loadCollectionCount(_db, objectId);
     uint64_t const numberDocuments = cnt._added - cnt._removed;
-    bool const useRangeDelete = numberDocuments >= 32 * 1024;
+    bool const useRangeDelete = numberDocuments >= _rangeDeleteThreshold;
 
     // remove indexes
     VPackSlice indexes = value.slice().get("indexes");
@@ -3039,8 +3294,66 @@ void RocksDBEngine::addSystemDatabase() {
 }
 
 /// @brief open an existing database. internal function
+namespace {
+/// @brief maximum number of threads used for loading the metadata of the
+/// collections of a database
+constexpr std::size_t maxMetadataLoadThreads = 16;
+/// @brief minimum number of collections per thread. there is no point in
+/// starting threads for just a few collections
+constexpr std::size_t minCollectionsPerMetadataLoadThread = 8;
+
+/// @brief runs fn for all items, using up to numThreads threads including
+/// the calling thread. the first exception thrown by fn is rethrown after
+/// all threads have finished
+template<typename T, typename F>
+void parallelForEach(std::vector<T>& items, std::size_t numThreads,
+                     F const& fn) {
+  std::atomic<std::size_t> next{0};
+  std::mutex errorMutex;
+  std::exception_ptr error;
+
+  auto work = [&]() {
+    while (true) {
+      std::size_t i = next.fetch_add(1, std::memory_order_relaxed);
+      if (i >= items.size()) {
+        return;
+      }
+      try {
+        fn(items[i]);
+      } catch (...) {
+        std::lock_guard guard{errorMutex};
+        if (error == nullptr) {
+          error = std::current_exception();
+        }
+        // make the other threads stop early
+        next.store(items.size(), std::memory_order_relaxed);
+        return;
+      }
+    }
+  };
+
+  std::vector<std::thread> threads;
+  try {
+    for (std::size_t i = 1; i < numThreads; ++i) {
+      threads.emplace_back(work);
+    }
+  } catch (...) {
+    // could not start another thread. go on with the ones we have
+  }
+  work();
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  if (error != nullptr) {
+    std::rethrow_exception(error);
+  }
+}
+}  // namespace
+
 std::unique_ptr<TRI_vocbase_t> RocksDBEngine::openExistingDatabase(
     CreateDatabaseInfo&& info, bool wasCleanShutdown, bool isUpgrade) {
+  auto start = std::chrono::steady_clock::now();
   auto vocbase = std::make_unique<TRI_vocbase_t>(std::move(info));
 
   LOG_TOPIC("26c21", TRACE, arangodb::Logger::ENGINES)
@@ -3138,6 +3451,8 @@ std::unique_ptr<TRI_vocbase_t> RocksDBEngine::openExistingDatabase(
         << "processing collections metadata in database '" << vocbase->name()
         << "': " << slice.toJson();
 
+    std::vector<std::shared_ptr<LogicalCollection>> collections;
+    collections.reserve(slice.length());
     for (VPackSlice it : VPackArrayIterator(slice)) {
       // we found a collection that is still active
       LOG_TOPIC("b2ef2", TRACE, arangodb::Logger::ENGINES)
@@ -3149,7 +3464,18 @@ std::unique_ptr<TRI_vocbase_t> RocksDBEngine::openExistingDatabase(
 
       auto collection = vocbase->createCollectionObject(it, /*isAStub*/ false);
       TRI_ASSERT(collection != nullptr);
+      collections.emplace_back(std::move(collection));
+    }
 
+    // loading the metadata (document counts, key generator state, index
+    // selectivity estimates and revision trees) of a collection only
+    // touches the collection itself, so it can be done in parallel for
+    // all collections. this speeds up the startup of servers with many
+    // collections or shards considerably
+    std::size_t numThreads = std::min(
+        {maxMetadataLoadThreads, NumberOfCores::getValue(),
+         collections.size() / minCollectionsPerMetadataLoadThread + 1});
+    parallelForEach(collections, numThreads, [&](auto const& collection) {
       auto phy = static_cast<RocksDBCollection*>(collection->getPhysical());
       TRI_ASSERT(phy != nullptr);
       Result r = phy->meta().deserializeMeta(_db, *collection);
@@ -3159,7 +3485,9 @@ std::unique_ptr<TRI_vocbase_t> RocksDBEngine::openExistingDatabase(
             << "loading metadata of collection '" << vocbase->name() << "/"
             << collection->name() << "': " << r.errorMessage();
       }
+    });
 
+    for (auto& collection : collections) {
       StorageEngine::registerCollection(*vocbase, collection);
       LOG_TOPIC("39404", DEBUG, arangodb::Logger::ENGINES)
           << "added collection '" << vocbase->name() << "/"
@@ -3200,6 +3528,13 @@ std::unique_ptr<TRI_vocbase_t> RocksDBEngine::openExistingDatabase(
     scanViews(iresearch::StaticStrings::ViewSearchAliasType);
   }
 
+  auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(
+      std::chrono::steady_clock::now() - start);
+  _metricsDatabaseOpenTime.count(elapsed.count());
+  LOG_TOPIC("6a0c2", DEBUG, arangodb::Logger::ENGINES)
+      << "opened database '" << vocbase->name() << "' in "
+      << elapsed.count() << " ms";
+
   return vocbase;
 }
 
@@ -3249,6 +3584,14 @@ void RocksDBEngine::scheduleFullIndexRefill(std::string const& database,
   f.scheduleFullIndexRefill(database, collection, iid);
 }
 
+void RocksDBEngine::scheduleBlockCacheWarmup(std::string const& database,
+                                             std::string const& collection) {
+  // simply forward...
+  RocksDBIndexCacheRefillFeature& f =
+      server().getFeature<RocksDBIndexCacheRefillFeature>();
+  f.scheduleBlockCacheWarmup(database, collection);
+}
+
 bool RocksDBEngine::autoRefillIndexCaches() const {
   RocksDBIndexCacheRefillFeature& f =
       server().getFeature<RocksDBIndexCacheRefillFeature>();
@@ -3269,6 +3612,9 @@ void RocksDBEngine::syncIndexCaches() {
 
 DECLARE_GAUGE(rocksdb_cache_active_tables, uint64_t,
               "rocksdb_cache_active_tables");
+DECLARE_GAUGE(rocksdb_cache_admissions, uint64_t, "rocksdb_cache_admissions");
+DECLARE_GAUGE(rocksdb_cache_admission_rejections, uint64_t,
+              "rocksdb_cache_admission_rejections");
 DECLARE_GAUGE(rocksdb_cache_allocated, uint64_t, "rocksdb_cache_allocated");
 DECLARE_GAUGE(rocksdb_cache_peak_allocated, uint64_t,
               "rocksdb_cache_peak_allocated");
@@ -3376,8 +3722,13 @@ DECLARE_GAUGE(rocksdb_total_sst_files_size, uint64_t,
               "rocksdb_total_sst_files_size");
 DECLARE_GAUGE(rocksdb_engine_throttle_bps, uint64_t,
               "rocksdb_engine_throttle_bps");
+DECLARE_GAUGE(rocksdb_engine_compaction_rate_limit_bps, uint64_t,
+              "rocksdb_engine_compaction_rate_limit_bps");
 DECLARE_GAUGE(rocksdb_read_only, uint64_t, "rocksdb_read_only");
 DECLARE_GAUGE(rocksdb_total_sst_files, uint64_t, "rocksdb_total_sst_files");
+DECLARE_GAUGE(rocksdb_cold_sst_files, uint64_t, "rocksdb_cold_sst_files");
+DECLARE_GAUGE(rocksdb_cold_sst_files_size, uint64_t,
+              "rocksdb_cold_sst_files_size");
 
 void RocksDBEngine::getCapabilities(velocypack::Builder& builder) const {
   // get generic capabilities
@@ -3493,6 +3844,20 @@ void RocksDBEngine::getStatistics(VPackBuilder& builder) const {
         rocksdb::DB::Properties::kCompressionRatioAtLevelPrefix, i));
   }
   builder.add("rocksdb.total-sst-files", VPackValue(numSstFilesOnAllLevels));
+  if (!_coldDirectory.empty()) {
+    uint64_t numColdFiles = 0;
+    uint64_t coldFilesSize = 0;
+    std::vector<rocksdb::LiveFileMetaData> files;
+    _db->GetRootDB()->GetLiveFilesMetaData(&files);
+    for (auto const& file : files) {
+      if (file.db_path == _coldDirectory) {
+        ++numColdFiles;
+        coldFilesSize += file.size;
+      }
+    }
+    builder.add("rocksdb.cold-sst-files", VPackValue(numColdFiles));
+    builder.add("rocksdb.cold-sst-files-size", VPackValue(coldFilesSize));
+  }
   // caution:  you must read rocksdb/db/internal_stats.cc carefully to
   //           determine if a property is for whole database or one column
   //           family
@@ -3595,6 +3960,14 @@ void RocksDBEngine::getStatistics(VPackBuilder& builder) const {
     builder.add("cache.unused-memory", VPackValue(stats->spareAllocation));
     builder.add("cache.unused-tables", VPackValue(stats->spareTables));
 
+    // decisions of the caches' admission filters
+    std::pair<std::uint64_t, std::uint64_t> admissions{0, 0};
+    if (manager != nullptr) {
+      admissions = manager->admissionStats();
+    }
+    builder.add("cache.admissions", VPackValue(admissions.first));
+    builder.add("cache.admission-rejections", VPackValue(admissions.second));
+
     // edge cache compression ratio
     double compressionRatio = 0.0;
     auto initial = _metricsEdgeCacheEntriesSizeInitial.load();
@@ -3638,6 +4011,10 @@ void RocksDBEngine::getStatistics(VPackBuilder& builder) const {
     builder.add("rocksdb_engine.throttle.bps",
                 VPackValue(_throttleListener->getThrottle()));
   }
+  if (_compactionRateLimiter) {
+    builder.add("rocksdb_engine.compaction_rate_limit.bps",
+                VPackValue(_compactionRateLimiter->GetBytesPerSecond()));
+  }
 
   {
     // total disk space in database directory
@@ -58,6 +58,7 @@
 namespace rocksdb {
 class EncryptionProvider;
 class Env;
+class RateLimiter;
 class TransactionDB;
 }  // namespace rocksdb
 
@@ -74,6 +75,7 @@ class RocksDBBackgroundThread;
 class RocksDBDumpManager;
 class RocksDBKey;
 class RocksDBLogValue;
+class RocksDBMetricsListener;
 class RocksDBRecoveryHelper;
 class RocksDBReplicationManager;
 class RocksDBSettingsManager;
@@ -281,6 +283,10 @@ class RocksDBEngine final : public StorageEngine {
   void compactRange(RocksDBKeyBounds bounds);
   void processCompactions();
 
+  /// @brief adjust the write rate for flushes and compactions to the current
+  /// foreground load. does nothing if no compaction rate limit is configured
+  void adjustCompactionRateLimit();
+
   auto dropReplicatedState(
       TRI_vocbase_t& vocbase,
       std::unique_ptr<replication2::storage::IStorageEngineMethods>& ptr)
@@ -368,6 +374,16 @@ class RocksDBEngine final : public StorageEngine {
   // whether or not to issue range delete markers in the write-ahead log
   bool useRangeDeleteInWal() const noexcept { return _useRangeDeleteInWal; }
 
+  // minimum number of documents in a collection for which truncate and
+  // drop operations use range deletes instead of single key removals
+  uint64_t rangeDeleteThreshold() const noexcept {
+    return _rangeDeleteThreshold;
+  }
+
+  // minimum number of documents in a dropped or truncated collection for
+  // which the freed key ranges get compacted
+  static constexpr uint64_t kMinDocumentsForCompaction = 32 * 1024;
+
   // management methods for synchronizing with external persistent stores
   TRI_voc_tick_t currentTick() const override;
   TRI_voc_tick_t releasedTick() const override;
@@ -377,6 +393,9 @@ class RocksDBEngine final : public StorageEngine {
                                std::string const& collection,
                                IndexId iid) override;
 
+  void scheduleBlockCacheWarmup(std::string const& database,
+                                std::string const& collection) override;
+
   bool autoRefillIndexCaches() const override;
   bool autoRefillIndexCachesOnFollowers() const override;
 
@@ -469,6 +488,10 @@ class RocksDBEngine final : public StorageEngine {
 
   bool hasBackgroundError() const;
 
+  /// @brief whether RocksDB currently slows down or stops incoming writes
+  /// for at least one column family
+  bool writesStalled() const noexcept;
+
   static Result registerRecoveryHelper(
       std::shared_ptr<RocksDBRecoveryHelper> helper);
   static std::vector<std::shared_ptr<RocksDBRecoveryHelper>> const&
@@ -623,6 +646,9 @@ class RocksDBEngine final : public StorageEngine {
   // will trigger a warning (in milliseconds)
   uint64_t _syncDelayThreshold;
 
+  // maximum delay for WAL syncs of grouped commits (in microseconds)
+  uint64_t _syncGroupCommitMaxDelay;
+
   /// @brief minimum required percentage of free disk space for considering the
   /// server "healthy". this is expressed as a floating point value between 0
   /// and 1! if set to 0.0, the % amount of free disk is ignored in checks.
@@ -655,6 +681,17 @@ class RocksDBEngine final : public StorageEngine {
   // whether or not to issue range delete markers in the write-ahead log
   bool _useRangeDeleteInWal;
 
+  // minimum number of documents for using range deletes
+  uint64_t _rangeDeleteThreshold;
+
+  /// @brief directory for the .sst files of the lowest levels. if empty,
+  /// all .sst files are stored in the database directory
+  std::string _coldDirectory;
+
+  /// @brief target size of the .sst files in the database directory if
+  /// _coldDirectory is set
+  uint64_t _hotDirectorySizeLimit;
+
   /// @brief whether or not the last health check was successful.
   /// this is used to determine when to execute the potentially expensive
   /// checks for free disk space
@@ -672,6 +709,9 @@ class RocksDBEngine final : public StorageEngine {
   /// a non-recoverable error
   std::shared_ptr<RocksDBBackgroundErrorListener> _errorListener;
 
+  /// @brief listener for flushes, compactions and write stalls
+  std::shared_ptr<RocksDBMetricsListener> _metricsListener;
+
   basics::ReadWriteLock _purgeLock;
 
   /// @brief mutex that protects the storage engine health check
@@ -721,6 +761,19 @@ class RocksDBEngine final : public StorageEngine {
   // Lower bound for computed write bandwidth of throttle:
   uint64_t _throttleLowerBoundBps = 10 * 1024 * 1024;
 
+  // maximum write rate for flushes and compactions (in bytes per second).
+  // 0 = unlimited, which also turns off the load-aware adjustment
+  uint64_t _compactionRateLimit = 0;
+  // write rate for flushes and compactions while the server is busy with
+  // foreground operations (in bytes per second)
+  uint64_t _compactionRateLimitUnderLoad = 0;
+  // scheduler queue time (in milliseconds) from which onwards the server is
+  // considered busy
+  uint64_t _compactionRateLimitDequeueTime = 50;
+  // rate limiter for flushes and compactions
+  // (will only be set if _compactionRateLimit is not 0)
+  std::shared_ptr<rocksdb::RateLimiter> _compactionRateLimiter;
+
   // sequence number from which WAL recovery was started. used only
   // for testing
 #ifdef ARANGODB_USE_GOOGLE_TESTS
@@ -750,6 +803,7 @@ class RocksDBEngine final : public StorageEngine {
   metrics::Counter& _metricsTreeRebuildsFailure;
   metrics::Counter& _metricsTreeHibernations;
   metrics::Counter& _metricsTreeResurrections;
+  metrics::Counter& _metricsDatabaseOpenTime;
 
   // total size of uncompressed values for the edge cache
   metrics::Counter& _metricsEdgeCacheEntriesSizeInitial;
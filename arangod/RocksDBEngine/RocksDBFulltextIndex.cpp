@@ -36,6 +36,7 @@
 #include "RocksDBEngine/RocksDBColumnFamilyManager.h"
 #include "RocksDBEngine/RocksDBCommon.h"
 #include "RocksDBEngine/RocksDBEngine.h"
+#include "RocksDBEngine/RocksDBFormat.h"
 #include "RocksDBEngine/RocksDBTransactionMethods.h"
 #include "RocksDBEngine/RocksDBTransactionState.h"
 #include "RocksDBEngine/RocksDBTypes.h"
@@ -47,9 +48,17 @@
 #include <velocypack/Iterator.h>
 
 #include <algorithm>
+#include <iterator>
 
 using namespace arangodb;
 
+namespace {
+// maximum number of Next() calls on a RocksDB iterator to reach the next
+// document of the result set, before we give up and use Seek() instead.
+// if the documents of a word are dense, stepping is cheaper than seeking
+constexpr size_t maxNextSteps = 8;
+}  // namespace
+
 namespace arangodb {
 /// El Cheapo index iterator
 class RocksDBFulltextIndexIterator final : public IndexIterator {
@@ -479,6 +488,15 @@ static RocksDBKeyBounds MakeBounds(uint64_t oid,
 Result RocksDBFulltextIndex::applyQueryToken(
     transaction::Methods* trx, FulltextQueryToken const& token,
     std::set<LocalDocumentId>& resultSet) {
+  if (token.matchType == FulltextQueryToken::COMPLETE &&
+      token.operation != FulltextQueryToken::OR && !resultSet.empty() &&
+      rocksutils::rocksDBEndianness == RocksDBEndianness::Big) {
+    // in big-endian mode, the keys of a word are sorted by document id.
+    // this allows intersecting with the (sorted) result set without reading
+    // all documents of the word, which can be many for common words
+    return applyQueryTokenBySeeking(trx, token, resultSet);
+  }
+
   auto mthds = RocksDBTransactionState::toMethods(trx, _collection.id());
   // why can't I have an assignment operator when I want one
   RocksDBKeyBounds bounds = MakeBounds(objectId(), token);
@@ -523,6 +541,84 @@ Result RocksDBFulltextIndex::applyQueryToken(
   return Result();
 }
 
+Result RocksDBFulltextIndex::applyQueryTokenBySeeking(
+    transaction::Methods* trx, FulltextQueryToken const& token,
+    std::set<LocalDocumentId>& resultSet) {
+  TRI_ASSERT(token.matchType == FulltextQueryToken::COMPLETE);
+  TRI_ASSERT(token.operation == FulltextQueryToken::AND ||
+             token.operation == FulltextQueryToken::EXCLUDE);
+  TRI_ASSERT(!resultSet.empty());
+
+  auto mthds = RocksDBTransactionState::toMethods(trx, _collection.id());
+  RocksDBKeyBounds bounds = MakeBounds(objectId(), token);
+  rocksdb::Slice end = bounds.end();
+  rocksdb::Comparator const* cmp = this->comparator();
+
+  std::unique_ptr<rocksdb::Iterator> iter = mthds->NewIterator(
+      _cf, [&](rocksdb::ReadOptions& ro) { ro.iterate_upper_bound = &end; });
+
+  bool const isAnd = token.operation == FulltextQueryToken::AND;
+  RocksDBKeyLeaser key(trx);
+
+  auto seek = [&](LocalDocumentId documentId) {
+    key->constructFulltextIndexValue(objectId(), std::string_view(token.value),
+                                     documentId);
+    iter->Seek(key->string());
+  };
+  auto valid = [&]() {
+    return iter->Valid() && cmp->Compare(iter->key(), end) < 0;
+  };
+
+  auto it = resultSet.begin();
+  seek(*it);
+
+  while (it != resultSet.end()) {
+    if (!valid()) {
+      rocksdb::Status s = iter->status();
+      if (!s.ok()) {
+        return rocksutils::convertStatus(s);
+      }
+      // no more documents for the word
+      if (isAnd) {
+        resultSet.erase(it, resultSet.end());
+      }
+      break;
+    }
+
+    TRI_ASSERT(objectId() == RocksDBKey::objectId(iter->key()));
+    LocalDocumentId documentId = RocksDBKey::indexDocumentId(iter->key());
+
+    // leap over all documents of the result set which do not contain
+    // the word
+    auto next = resultSet.lower_bound(documentId);
+    it = isAnd ? resultSet.erase(it, next) : next;
+    if (it == resultSet.end()) {
+      break;
+    }
+
+    if (*it == documentId) {
+      // the document contains the word
+      it = isAnd ? std::next(it) : resultSet.erase(it);
+      if (it == resultSet.end()) {
+        break;
+      }
+    }
+
+    // move forward to the next document of the word that can be contained
+    // in the result set
+    TRI_ASSERT(documentId < *it);
+    size_t steps = 0;
+    do {
+      iter->Next();
+    } while (valid() && RocksDBKey::indexDocumentId(iter->key()) < *it &&
+             ++steps < maxNextSteps);
+    if (valid() && RocksDBKey::indexDocumentId(iter->key()) < *it) {
+      seek(*it);
+    }
+  }
+  return Result();
+}
+
 std::unique_ptr<IndexIterator> RocksDBFulltextIndex::iteratorForCondition(
     ResourceMonitor& monitor, transaction::Methods* trx,
     aql::AstNode const* condNode, aql::Variable const* var,
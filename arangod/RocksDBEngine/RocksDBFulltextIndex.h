@@ -128,6 +128,13 @@ class RocksDBFulltextIndex final : public RocksDBIndex {
   arangodb::Result applyQueryToken(transaction::Methods* trx,
                                    FulltextQueryToken const&,
                                    std::set<LocalDocumentId>& resultSet);
+
+  /// @brief apply an AND or EXCLUDE token for a complete word to a non-empty
+  /// result set, by seeking to the documents of the result set instead of
+  /// reading all documents of the word
+  arangodb::Result applyQueryTokenBySeeking(
+      transaction::Methods* trx, FulltextQueryToken const&,
+      std::set<LocalDocumentId>& resultSet);
 };
 
 }  // namespace arangodb
@@ -211,7 +211,8 @@ Result RocksDBIndex::drop() {
   // edge index needs to be dropped with prefixSameAsStart = false
   // otherwise full index scan will not work
   bool const prefixSameAsStart = type() != Index::TRI_IDX_TYPE_EDGE_INDEX;
-  bool const useRangeDelete = coll->meta().numberDocuments() >= 32 * 1024;
+  bool const useRangeDelete =
+      coll->meta().numberDocuments() >= _engine.rangeDeleteThreshold();
 
   Result r = rocksutils::removeLargeRange(_engine.db(), getBounds(),
                                           prefixSameAsStart, useRangeDelete);
@@ -311,6 +312,11 @@ Result RocksDBIndex::update(transaction::Methods& trx, RocksDBMethods* mthd,
 void RocksDBIndex::refillCache(transaction::Methods& trx,
                                std::vector<std::string> const& /*keys*/) {}
 
+std::vector<std::string> RocksDBIndex::cachedKeys(
+    std::size_t /*maxKeys*/) const {
+  return {};
+}
+
 /// @brief return the memory usage of the index
 size_t RocksDBIndex::memory() const {
   rocksdb::TransactionDB* db = _engine.db();
@@ -150,6 +150,10 @@ class RocksDBIndex : public Index {
   virtual void refillCache(transaction::Methods& trx,
                            std::vector<std::string> const& keys);
 
+  // return up to maxKeys keys of the entries in the in-memory cache, in the
+  // format expected by refillCache()
+  virtual std::vector<std::string> cachedKeys(std::size_t maxKeys) const;
+
   rocksdb::ColumnFamilyHandle* columnFamily() const { return _cf; }
 
   rocksdb::Comparator const* comparator() const;
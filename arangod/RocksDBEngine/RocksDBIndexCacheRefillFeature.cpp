@@ -25,6 +25,7 @@
 
 #include "ApplicationFeatures/ApplicationServer.h"
 #include "Basics/Exceptions.h"
+#include "Basics/FileUtils.h"
 #include "Basics/NumberOfCores.h"
 #include "Basics/ScopeGuard.h"
 #include "Basics/application-exit.h"
@@ -38,15 +39,32 @@
 #include "ProgramOptions/ProgramOptions.h"
 #include "RestServer/BootstrapFeature.h"
 #include "RestServer/DatabaseFeature.h"
+#include "RestServer/DatabasePathFeature.h"
+#include "RocksDBEngine/RocksDBCollection.h"
+#include "RocksDBEngine/RocksDBColumnFamilyManager.h"
 #include "RocksDBEngine/RocksDBEngine.h"
+#include "RocksDBEngine/RocksDBIndex.h"
 #include "RocksDBEngine/RocksDBIndexCacheRefillThread.h"
+#include "RocksDBEngine/RocksDBKeyBounds.h"
 #include "Scheduler/Scheduler.h"
 #include "Scheduler/SchedulerFeature.h"
+#include "StorageEngine/EngineSelectorFeature.h"
 #include "Utils/DatabaseGuard.h"
 #include "VocBase/LogicalCollection.h"
 #include "VocBase/Methods/Collections.h"
 #include "VocBase/Methods/Databases.h"
 
+#include <velocypack/Builder.h>
+#include <velocypack/Iterator.h>
+#include <velocypack/Slice.h>
+#include <velocypack/Validator.h>
+
+#include <rocksdb/db.h>
+#include <rocksdb/rate_limiter.h>
+#include <rocksdb/utilities/transaction_db.h>
+
+#include <algorithm>
+
 using namespace arangodb;
 
 namespace {
@@ -71,6 +89,9 @@ RocksDBIndexCacheRefillFeature::RocksDBIndexCacheRefillFeature(Server& server)
       _autoRefill(false),
       _fillOnStartup(false),
       _autoRefillOnFollowers(true),
+      _useCacheSnapshot(false),
+      _warmupBlockCache(false),
+      _warmupBlockCacheMaxRate(64 * 1024 * 1024),
       _totalFullIndexRefills(server.getFeature<metrics::MetricsFeature>().add(
           rocksdb_cache_full_index_refills_total{})),
       _currentlyRunningIndexFillTasks(0) {
@@ -123,6 +144,11 @@ these changes are tracked and a background thread tries to update the index
 caches accordingly if the feature is enabled, by adding new, updating existing,
 or deleting and refilling cache entries.
 
+From v3.12.0 onwards, this also applies to the document cache of collections
+that have the `cacheEnabled` property set. Newly inserted, updated, or replaced
+documents are then put into the document cache after the writing transaction
+has committed.
+
 You can enable the feature for individual `INSERT`, `UPDATE`, `REPLACE`,  and
 `REMOVE` operations in AQL queries, for individual document API requests that
 insert, update, replace, or remove single or multiple documents, as well
@@ -180,9 +206,74 @@ index cache filling, but the longer it takes to complete.)");
       .setLongDescription(R"(Set this to `false` to only (re-)fill in-memory
 index caches on leaders and save memory on followers. 
 Note that the value of this option should be identical for all DBServers.)");
+
+  options
+      ->addOption("--rocksdb.cache-snapshot",
+                  "Whether to save the keys of the in-memory caches on "
+                  "shutdown and to refill the caches with them on startup.",
+                  new options::BooleanParameter(&_useCacheSnapshot),
+                  arangodb::options::makeFlags(
+                      options::Flags::DefaultNoComponents,
+                      options::Flags::OnDBServer, options::Flags::OnSingle))
+      .setIntroducedIn(31200)
+      .setLongDescription(R"(If enabled, the keys of the entries of the
+in-memory edge index, persistent index, and document caches are written to a
+file in the database directory when the server is shut down. On the next
+startup, the file is read and removed, and the caches are refilled with the
+current values for these keys in the background, using the same background
+thread as `--rocksdb.auto-refill-index-caches-on-modify`. Only the keys are
+saved, so refilled values are never outdated.
+
+This shortens the time until the caches are warm again after a restart, e.g.
+in a rolling upgrade. In contrast to
+`--rocksdb.auto-fill-index-caches-on-startup`, only entries that were in the
+caches before the shutdown are loaded, not the full indexes.
+
+The number of saved keys is limited to half of the value of
+`--rocksdb.auto-refill-index-caches-queue-capacity`.)");
+
+  options
+      ->addOption("--rocksdb.warmup-block-cache",
+                  "Whether warming up the indexes of a collection also loads "
+                  "its documents and index entries into the RocksDB block "
+                  "cache.",
+                  new options::BooleanParameter(&_warmupBlockCache),
+                  arangodb::options::makeFlags(
+                      options::Flags::DefaultNoComponents,
+                      options::Flags::OnDBServer, options::Flags::OnSingle))
+      .setIntroducedIn(31200)
+      .setLongDescription(R"(If enabled, loading the indexes of a collection
+into memory (e.g. via `collection.loadIndexesIntoMemory()`) additionally reads
+all documents and the entries of all RocksDB-based indexes of the collection
+once, so that they are loaded into the RocksDB block cache. If
+`--rocksdb.auto-fill-index-caches-on-startup` is enabled, this is also done for
+all collections on server startup. This avoids slow first reads after a
+restart or a failover, when the block cache is still empty.
+
+The documents are read first and the indexes last, so that the index entries
+stay in the block cache if the collection is larger than the block cache.
+ArangoSearch data is not stored in RocksDB and is not affected.
+
+The reads are limited by `--rocksdb.warmup-block-cache-max-rate` and run
+with the same concurrency as the other index fill tasks.)");
+
+  options
+      ->addOption("--rocksdb.warmup-block-cache-max-rate",
+                  "The maximum number of bytes per second that all block "
+                  "cache warmups read together (0 = unlimited).",
+                  new options::UInt64Parameter(&_warmupBlockCacheMaxRate),
+                  arangodb::options::makeFlags(
+                      options::Flags::DefaultNoComponents,
+                      options::Flags::OnDBServer, options::Flags::OnSingle,
+                      options::Flags::Uncommon))
+      .setIntroducedIn(31200);
 }
 
 void RocksDBIndexCacheRefillFeature::beginShutdown() {
+  if (_useCacheSnapshot && _refillThread != nullptr) {
+    // the caches are still populated at this point
+    writeCacheSnapshot();
+  }
   {
     std::unique_lock lock(_indexFillTasksMutex);
     _indexFillTasks.clear();
@@ -207,6 +298,17 @@ void RocksDBIndexCacheRefillFeature::start() {
     FATAL_ERROR_EXIT();
   }
 
+  if (_warmupBlockCache && _warmupBlockCacheMaxRate > 0) {
+    _warmupBlockCacheRateLimiter.reset(rocksdb::NewGenericRateLimiter(
+        static_cast<int64_t>(_warmupBlockCacheMaxRate),
+        /*refill_period_us*/ 100 * 1000, /*fairness*/ 10,
+        rocksdb::RateLimiter::Mode::kReadsOnly));
+  }
+
+  if (_useCacheSnapshot) {
+    loadCacheSnapshot();
+  }
+
   if (_fillOnStartup) {
     buildStartupIndexRefillTasks();
     scheduleIndexRefillTasks();
@@ -251,6 +353,20 @@ void RocksDBIndexCacheRefillFeature::scheduleFullIndexRefill(
   scheduleIndexRefillTasks();
 }
 
+void RocksDBIndexCacheRefillFeature::scheduleBlockCacheWarmup(
+    std::string const& database, std::string const& collection) {
+  if (!_warmupBlockCache) {
+    return;
+  }
+  {
+    std::unique_lock lock(_indexFillTasksMutex);
+    _indexFillTasks.emplace_back(IndexFillTask{
+        database, collection, IndexId::none(), /*blockCache*/ true});
+  }
+
+  scheduleIndexRefillTasks();
+}
+
 // wait until the background thread has applied all operations
 void RocksDBIndexCacheRefillFeature::waitForCatchup() {
   if (_refillThread != nullptr) {
@@ -271,6 +387,15 @@ void RocksDBIndexCacheRefillFeature::buildStartupIndexRefillTasks() {
       methods::Collections::enumerate(
           &guard.database(),
           [&](std::shared_ptr<LogicalCollection> const& collection) {
+            std::unique_lock lock(_indexFillTasksMutex);
+            TRI_ASSERT(_currentlyRunningIndexFillTasks == 0);
+            // tasks are taken from the back. the block cache is warmed up
+            // after the in-memory index caches of the collection are filled
+            if (_warmupBlockCache) {
+              _indexFillTasks.emplace_back(
+                  IndexFillTask{database, collection->name(), IndexId::none(),
+                                /*blockCache*/ true});
+            }
             auto indexes = collection->getIndexes();
             for (auto const& index : indexes) {
               if (!index->canWarmup()) {
@@ -278,8 +403,6 @@ void RocksDBIndexCacheRefillFeature::buildStartupIndexRefillTasks() {
                 continue;
               }
 
-              std::unique_lock lock(_indexFillTasksMutex);
-              TRI_ASSERT(_currentlyRunningIndexFillTasks == 0);
               _indexFillTasks.emplace_back(
                   IndexFillTask{database, collection->name(), index->id()});
             }
@@ -315,7 +438,11 @@ void RocksDBIndexCacheRefillFeature::scheduleIndexRefillTasks() {
           if (!server().isStopping()) {
             Result res;
             try {
-              res = warmupIndex(task.database, task.collection, task.iid);
+              if (task.blockCache) {
+                res = warmupBlockCache(task.database, task.collection);
+              } else {
+                res = warmupIndex(task.database, task.collection, task.iid);
+              }
             } catch (basics::Exception const& ex) {
               res = {ex.code(), ex.what()};
             } catch (std::exception const& ex) {
@@ -329,12 +456,18 @@ void RocksDBIndexCacheRefillFeature::scheduleIndexRefillTasks() {
               if (!res.is(TRI_ERROR_ARANGO_DATA_SOURCE_NOT_FOUND) &&
                   !res.is(TRI_ERROR_ARANGO_DATABASE_NOT_FOUND)) {
                 // an unexpected error
-                LOG_TOPIC("91c13", WARN, Logger::ENGINES)
-                    << "unable to warmup index '" << task.iid.id() << "' in "
-                    << task.database << "/" << task.collection << ": "
-                    << res.errorMessage();
+                if (task.blockCache) {
+                  LOG_TOPIC("5d0f2", WARN, Logger::ENGINES)
+                      << "unable to warmup block cache for " << task.database
+                      << "/" << task.collection << ": " << res.errorMessage();
+                } else {
+                  LOG_TOPIC("91c13", WARN, Logger::ENGINES)
+                      << "unable to warmup index '" << task.iid.id()
+                      << "' in " << task.database << "/" << task.collection
+                      << ": " << res.errorMessage();
+                }
               }
-            } else {
+            } else if (!task.blockCache) {
               ++_totalFullIndexRefills;
             }
           }
@@ -392,3 +525,247 @@ Result RocksDBIndexCacheRefillFeature::warmupIndex(
 
   return {TRI_ERROR_ARANGO_INDEX_NOT_FOUND};
 }
+
+Result RocksDBIndexCacheRefillFeature::warmupBlockCache(
+    std::string const& database, std::string const& collection) {
+  auto& df = server().getFeature<DatabaseFeature>();
+
+  DatabaseGuard guard(df, database);
+
+  auto c =
+      guard.database().useCollection(collection, /*checkPermissions*/ false);
+  if (c == nullptr) {
+    return {TRI_ERROR_ARANGO_DATA_SOURCE_NOT_FOUND};
+  }
+
+  auto releaser = scopeGuard(
+      [&]() noexcept { guard.database().releaseCollection(c.get()); });
+
+  LOG_TOPIC("f2c6a", DEBUG, Logger::ENGINES)
+      << "warming up block cache for " << database << "/" << collection;
+
+  // documents first, so that the index entries, which are usually smaller
+  // and accessed more often, are the most recently used blocks at the end
+  auto* rcoll = toRocksDBCollection(*c);
+  warmupBlockCache(RocksDBColumnFamilyManager::get(
+                       RocksDBColumnFamilyManager::Family::Documents),
+                   RocksDBKeyBounds::CollectionDocuments(rcoll->objectId()));
+
+  for (auto const& index : c->getIndexes()) {
+    if (server().isStopping()) {
+      return {TRI_ERROR_SHUTTING_DOWN};
+    }
+    auto type = index->type();
+    if (type == Index::TRI_IDX_TYPE_IRESEARCH_LINK ||
+        type == Index::TRI_IDX_TYPE_INVERTED_INDEX ||
+        type == Index::TRI_IDX_TYPE_NO_ACCESS_INDEX) {
+      // the data of these is not stored in RocksDB
+      continue;
+    }
+    auto* ridx = static_cast<RocksDBIndex const*>(index.get());
+    warmupBlockCache(ridx->columnFamily(), ridx->getBounds());
+  }
+  return {};
+}
+
+void RocksDBIndexCacheRefillFeature::warmupBlockCache(
+    rocksdb::ColumnFamilyHandle* cf, RocksDBKeyBounds const& bounds) {
+  // granularity for which read bytes are requested from the rate limiter
+  constexpr std::int64_t kChunkSize = 64 * 1024;
+
+  rocksdb::Slice const end = bounds.end();
+  rocksdb::ReadOptions options;
+  options.iterate_upper_bound = &end;
+  options.total_order_seek = true;
+  options.verify_checksums = false;
+  options.fill_cache = true;
+  options.readahead_size = 4 * 1024 * 1024;
+
+  auto& engine =
+      server().getFeature<EngineSelectorFeature>().engine<RocksDBEngine>();
+  std::unique_ptr<rocksdb::Iterator> it(engine.db()->NewIterator(options, cf));
+
+  std::int64_t pending = 0;
+  std::size_t n = 0;
+  for (it->Seek(bounds.start()); it->Valid(); it->Next()) {
+    if (++n % 1024 == 0 && server().isStopping()) {
+      return;
+    }
+    // accessing the value also loads values that are stored separately
+    // from the keys (blob files)
+    pending += static_cast<std::int64_t>(it->key().size() + it->value().size());
+    if (_warmupBlockCacheRateLimiter == nullptr) {
+      continue;
+    }
+    std::int64_t chunk = std::min(
+        kChunkSize, _warmupBlockCacheRateLimiter->GetSingleBurstBytes());
+    while (pending >= chunk) {
+      _warmupBlockCacheRateLimiter->Request(
+          chunk, rocksdb::Env::IO_LOW, /*stats*/ nullptr,
+          rocksdb::RateLimiter::OpType::kRead);
+      pending -= chunk;
+    }
+  }
+}
+
+std::string RocksDBIndexCacheRefillFeature::cacheSnapshotFilename() const {
+  return basics::FileUtils::buildFilename(
+      server().getFeature<DatabasePathFeature>().directory(),
+      "CACHE-SNAPSHOT");
+}
+
+void RocksDBIndexCacheRefillFeature::writeCacheSnapshot() {
+  TRI_ASSERT(!ServerState::instance()->isCoordinator());
+
+  // leave room in the refill queue for regular operations after the restart
+  std::size_t remaining = _maxCapacity / 2;
+  std::size_t total = 0;
+
+  VPackBuilder builder;
+  builder.openArray();
+  for (auto const& database : methods::Databases::list(server(), "")) {
+    if (remaining == 0) {
+      break;
+    }
+    try {
+      DatabaseGuard guard(_databaseFeature, database);
+
+      methods::Collections::enumerate(
+          &guard.database(),
+          [&](std::shared_ptr<LogicalCollection> const& collection) {
+            auto addKeys = [&](IndexId iid,
+                               std::vector<std::string> const& keys) {
+              if (keys.empty()) {
+                return;
+              }
+              TRI_ASSERT(keys.size() <= remaining);
+              VPackBuilder entry;
+              entry.openObject();
+              entry.add("database", VPackValue(database));
+              entry.add("collection", VPackValue(collection->name()));
+              entry.add("index", VPackValue(iid.id()));
+              entry.add("keys", VPackValue(VPackValueType::Array));
+              for (auto const& key : keys) {
+                entry.add(VPackValuePair(key.data(), key.size(),
+                                         VPackValueType::Binary));
+              }
+              entry.close();
+              entry.close();
+              builder.add(entry.slice());
+              remaining -= keys.size();
+              total += keys.size();
+            };
+
+            // document cache entries are tracked under the primary index id
+            addKeys(IndexId::primary(),
+                    toRocksDBCollection(*collection)->cachedKeys(remaining));
+            for (auto const& index : collection->getIndexes()) {
+              if (remaining == 0) {
+                break;
+              }
+              addKeys(index->id(), static_cast<RocksDBIndex const*>(index.get())
+                                       ->cachedKeys(remaining));
+            }
+          });
+    } catch (...) {
+      // must ignore any errors here in case a database or collection
+      // got deleted in the meantime
+    }
+  }
+  builder.close();
+
+  if (total == 0) {
+    return;
+  }
+
+  std::string const filename = cacheSnapshotFilename();
+  try {
+    basics::FileUtils::spit(filename, builder.slice().startAs<char>(),
+                            builder.slice().byteSize(), /*sync*/ true);
+    LOG_TOPIC("c5d0e", INFO, Logger::ENGINES)
+        << "saved " << total << " in-memory cache keys to '" << filename
+        << "'";
+  } catch (std::exception const& ex) {
+    LOG_TOPIC("0c8f4", WARN, Logger::ENGINES)
+        << "unable to save in-memory cache keys to '" << filename
+        << "': " << ex.what();
+  }
+}
+
+void RocksDBIndexCacheRefillFeature::loadCacheSnapshot() {
+  TRI_ASSERT(_refillThread != nullptr);
+
+  std::string const filename = cacheSnapshotFilename();
+  if (!basics::FileUtils::exists(filename)) {
+    return;
+  }
+
+  std::string content;
+  try {
+    content = basics::FileUtils::slurp(filename);
+  } catch (std::exception const& ex) {
+    LOG_TOPIC("8a3e6", WARN, Logger::ENGINES)
+        << "unable to read in-memory cache keys from '" << filename
+        << "': " << ex.what();
+  }
+  // the snapshot is only used once. otherwise a later restart after a crash
+  // would load outdated keys
+  if (basics::FileUtils::remove(filename) != TRI_ERROR_NO_ERROR) {
+    LOG_TOPIC("e1b7d", WARN, Logger::ENGINES)
+        << "unable to remove '" << filename << "'";
+  }
+
+  std::size_t total = 0;
+  try {
+    VPackValidator validator;
+    validator.validate(content.data(), content.size());
+
+    VPackSlice snapshot(reinterpret_cast<uint8_t const*>(content.data()));
+    if (!snapshot.isArray()) {
+      THROW_ARANGO_EXCEPTION_MESSAGE(TRI_ERROR_BAD_PARAMETER,
+                                     "expecting array");
+    }
+
+    for (VPackSlice entry : VPackArrayIterator(snapshot)) {
+      try {
+        DatabaseGuard guard(_databaseFeature,
+                            entry.get("database").copyString());
+        auto collection = guard.database().lookupCollection(
+            entry.get("collection").stringView());
+        if (collection == nullptr) {
+          // collection was dropped in the meantime
+          continue;
+        }
+
+        std::vector<std::string> keys;
+        for (VPackSlice key : VPackArrayIterator(entry.get("keys"))) {
+          VPackValueLength length;
+          auto data = reinterpret_cast<char const*>(key.getBinary(length));
+          keys.emplace_back(data, static_cast<std::size_t>(length));
+        }
+        if (keys.empty()) {
+          continue;
+        }
+        total += keys.size();
+        // the refill thread ignores keys of indexes that do not exist
+        // anymore. refilling is done in the background
+        _refillThread->trackRefill(
+            collection,
+            IndexId{entry.get("index").getNumber<IndexId::BaseType>()},
+            std::move(keys));
+      } catch (...) {
+        // must ignore any errors here in case a database or collection
+        // got deleted in the meantime
+      }
+    }
+  } catch (std::exception const& ex) {
+    LOG_TOPIC("6b91f", WARN, Logger::ENGINES)
+        << "invalid in-memory cache keys in '" << filename
+        << "': " << ex.what();
+    return;
+  }
+
+  LOG_TOPIC("b40c2", INFO, Logger::ENGINES)
+      << "queued " << total << " in-memory cache keys from '" << filename
+      << "' for refilling";
+}
@@ -28,16 +28,23 @@
 #include "RestServer/arangod.h"
 #include "VocBase/Identifiers/IndexId.h"
 
+#include <cstdint>
 #include <memory>
 #include <mutex>
 #include <string_view>
 #include <string>
 #include <vector>
 
+namespace rocksdb {
+class ColumnFamilyHandle;
+class RateLimiter;
+}  // namespace rocksdb
+
 namespace arangodb {
 class DatabaseFeature;
 class LogicalCollection;
 class RocksDBIndexCacheRefillThread;
+class RocksDBKeyBounds;
 
 class RocksDBIndexCacheRefillFeature final : public ArangodFeature {
  public:
@@ -62,6 +69,11 @@ class RocksDBIndexCacheRefillFeature final : public ArangodFeature {
   void scheduleFullIndexRefill(std::string const& database,
                                std::string const& collection, IndexId iid);
 
+  // schedule loading all documents and index entries of the collection into
+  // the RocksDB block cache. does nothing if block cache warmup is disabled
+  void scheduleBlockCacheWarmup(std::string const& database,
+                                std::string const& collection);
+
   // wait until the background thread has applied all operations
   void waitForCatchup();
 
@@ -94,6 +106,27 @@ class RocksDBIndexCacheRefillFeature final : public ArangodFeature {
   Result warmupIndex(std::string const& database, std::string const& collection,
                      IndexId iid);
 
+  // read the documents and index entries of the collection once, so that
+  // they are loaded into the RocksDB block cache
+  Result warmupBlockCache(std::string const& database,
+                          std::string const& collection);
+
+  // read all keys and values in the bounds, honoring the rate limit
+  void warmupBlockCache(rocksdb::ColumnFamilyHandle* cf,
+                        RocksDBKeyBounds const& bounds);
+
+  // name of the file that stores the keys of the in-memory caches between
+  // restarts
+  std::string cacheSnapshotFilename() const;
+
+  // write the keys of all in-memory index and document caches to the
+  // snapshot file
+  void writeCacheSnapshot();
+
+  // read the snapshot file and queue its keys for refilling, then remove
+  // the file
+  void loadCacheSnapshot();
+
   DatabaseFeature& _databaseFeature;
 
   // index refill thread used for auto-refilling after insert/update/replace
@@ -121,6 +154,21 @@ class RocksDBIndexCacheRefillFeature final : public ArangodFeature {
   // refilled on followers
   bool _autoRefillOnFollowers;
 
+  // whether or not the keys of the in-memory caches are saved on shutdown
+  // and reloaded on startup
+  bool _useCacheSnapshot;
+
+  // whether or not warming up the indexes of a collection also loads its
+  // documents and index entries into the RocksDB block cache
+  bool _warmupBlockCache;
+
+  // maximum number of bytes per second read by all block cache warmups
+  // together (0 = unlimited)
+  std::uint64_t _warmupBlockCacheMaxRate;
+
+  // rate limiter for block cache warmups. only set if there is a limit
+  std::unique_ptr<rocksdb::RateLimiter> _warmupBlockCacheRateLimiter;
+
   // total number of full index refills completed
   metrics::Counter& _totalFullIndexRefills;
 
@@ -131,6 +179,9 @@ class RocksDBIndexCacheRefillFeature final : public ArangodFeature {
     std::string database;
     std::string collection;
     IndexId iid;
+    // if set, the task warms up the block cache for the whole collection.
+    // iid is not used then
+    bool blockCache = false;
   };
   std::vector<IndexFillTask> _indexFillTasks;
 
@@ -28,6 +28,7 @@
 #include "Metrics/CounterBuilder.h"
 #include "Metrics/MetricsFeature.h"
 #include "RestServer/DatabaseFeature.h"
+#include "RocksDBEngine/RocksDBCollection.h"
 #include "RocksDBEngine/RocksDBIndex.h"
 #include "Transaction/StandaloneContext.h"
 #include "Utils/DatabaseGuard.h"
@@ -154,6 +155,12 @@ void RocksDBIndexCacheRefillThread::refill(TRI_vocbase_t& vocbase,
 
   // loop over all the indexes in the given collection
   for (auto const& it : data) {
+    if (it.first.isPrimary()) {
+      // the primary index id is used for entries of the document cache
+      toRocksDBCollection(*trx.documentCollection())
+          ->refillCache(trx, it.second);
+      continue;
+    }
     auto idx = trx.documentCollection()->lookupIndex(it.first);
     if (idx == nullptr) {
       // index doesn't exist anymore
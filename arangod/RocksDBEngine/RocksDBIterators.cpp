@@ -24,23 +24,111 @@
 #include "RocksDBIterators.h"
 #include "ApplicationFeatures/ApplicationServer.h"
 #include "Basics/Exceptions.h"
+#include "Basics/NumberOfCores.h"
 #include "Random/RandomGenerator.h"
 #include "RocksDBEngine/RocksDBColumnFamilyManager.h"
 #include "RocksDBEngine/RocksDBCommon.h"
+#include "RocksDBEngine/RocksDBFormat.h"
 #include "RocksDBEngine/RocksDBMetaCollection.h"
 #include "RocksDBEngine/RocksDBTransactionMethods.h"
 #include "RocksDBEngine/RocksDBPrimaryIndex.h"
 #include "RocksDBEngine/RocksDBTransactionState.h"
+#include "Scheduler/Scheduler.h"
+#include "Scheduler/SchedulerFeature.h"
 #include "StorageEngine/EngineSelectorFeature.h"
+#include "StorageEngine/PhysicalCollection.h"
 #include "VocBase/LogicalCollection.h"
 
 #include <velocypack/Iterator.h>
 #include <velocypack/Slice.h>
 
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+
 using namespace arangodb;
 
 namespace {
 constexpr bool AnyIteratorFillBlockCache = false;
+
+// minimum number of documents per thread for which a parallel full
+// collection scan is worth the overhead of setting it up
+constexpr uint64_t minDocumentsPerScanThread = 100000;
+
+// number of key ranges per thread. using more ranges than threads
+// compensates for unevenly distributed document ids
+constexpr size_t rangesPerScanThread = 4;
+
+// shared state of a parallel scan over disjoint key ranges. each thread
+// (the calling thread and the scheduler workers) claims ranges until
+// there are none left. the calling thread waits until all threads that
+// have started working on the state are finished, so that no rocksdb
+// iterator is used after the scan has returned
+struct ParallelScanState {
+  explicit ParallelScanState(size_t numRanges) : numRanges(numRanges) {
+    lowerBounds.reserve(numRanges);
+    upperBounds.reserve(numRanges);
+    iterators.reserve(numRanges);
+  }
+
+  void work() noexcept {
+    {
+      std::lock_guard guard(mutex);
+      ++active;
+    }
+
+    while (true) {
+      size_t range = next.fetch_add(1);
+      if (range >= numRanges) {
+        break;
+      }
+      try {
+        auto& it = *iterators[range];
+        uint64_t found = 0;
+        for (it.Seek(lowerBounds[range]); it.Valid(); it.Next()) {
+          ++found;
+        }
+        // validate that Iterator is in a good shape and hasn't failed
+        rocksutils::checkIteratorStatus(it);
+        count += found;
+      } catch (basics::Exception const& ex) {
+        setError({ex.code(), ex.what()});
+      } catch (std::exception const& ex) {
+        setError({TRI_ERROR_INTERNAL, ex.what()});
+      }
+    }
+
+    std::lock_guard guard(mutex);
+    --active;
+    cv.notify_all();
+  }
+
+  void setError(Result res) {
+    std::lock_guard guard(mutex);
+    if (result.ok()) {
+      result = std::move(res);
+    }
+  }
+
+  void waitForWorkers() {
+    std::unique_lock lock(mutex);
+    cv.wait(lock, [this]() { return active == 0; });
+  }
+
+  size_t const numRanges;
+  std::vector<std::string> lowerBounds;
+  std::vector<rocksdb::Slice> upperBounds;
+  std::vector<std::unique_ptr<rocksdb::Iterator>> iterators;
+  std::atomic<size_t> next{0};
+  std::atomic<uint64_t> count{0};
+
+  std::mutex mutex;
+  std::condition_variable cv;
+  size_t active{0};
+  Result result;
+};
+
 }  // namespace
 
 /// @brief iterator over all documents in the collection
@@ -170,6 +258,111 @@ class RocksDBAllIndexIterator final : public IndexIterator {
     rocksutils::checkIteratorStatus(*_iterator);
   }
 
+  bool skipAllParallelImpl(uint64_t& skipped, size_t parallelism) override {
+    TRI_ASSERT(_trx->state()->isRunning());
+
+    // only supported for a fresh iterator in a read-only transaction. in
+    // write transactions the iterators also observe the transaction's own
+    // changes and must not be used concurrently
+    if (!_mustSeek || !_trx->state()->isReadOnlyTransaction() ||
+        SchedulerFeature::SCHEDULER == nullptr) {
+      return false;
+    }
+
+    parallelism = std::min<size_t>(
+        {parallelism, NumberOfCores::getValue(),
+         static_cast<size_t>(
+             _collection->getPhysical()->numberDocuments(_trx) /
+             minDocumentsPerScanThread)});
+    if (parallelism <= 1) {
+      return false;
+    }
+
+    auto* mthds = RocksDBTransactionState::toMethods(_trx, _collection->id());
+    auto newIterator = [&](rocksdb::Slice const* upperBound) {
+      return mthds->NewIterator(_bounds.columnFamily(), [&](ReadOptions& ro) {
+        TRI_ASSERT(ro.snapshot != nullptr);
+        ro.verify_checksums = false;
+        ro.iterate_upper_bound = upperBound;
+        ro.readOwnWrites = false;
+        ro.adaptive_readahead = true;
+      });
+    };
+
+    // determine the first and the last key of the collection. the key
+    // ranges are computed from the big-endian interpretation of the key
+    // suffix, which follows the byte-wise order of the keys regardless
+    // of the on-disk format of the document ids
+    std::string prefix;
+    uint64_t first = 0;
+    uint64_t last = 0;
+    {
+      auto it = newIterator(&_upperBound);
+      it->Seek(_bounds.start());
+      if (!it->Valid()) {
+        rocksutils::checkIteratorStatus(*it);
+        return false;
+      }
+      TRI_ASSERT(it->key().size() == 2 * sizeof(uint64_t));
+      prefix.assign(it->key().data(), sizeof(uint64_t));
+      first = rocksutils::uintFromPersistentBigEndian<uint64_t>(
+          it->key().data() + sizeof(uint64_t));
+
+      it->SeekForPrev(_bounds.end());
+      if (!it->Valid()) {
+        rocksutils::checkIteratorStatus(*it);
+        return false;
+      }
+      last = rocksutils::uintFromPersistentBigEndian<uint64_t>(
+          it->key().data() + sizeof(uint64_t));
+    }
+
+    size_t numRanges = parallelism * rangesPerScanThread;
+    if (last < first || last - first < numRanges) {
+      return false;
+    }
+    uint64_t const step = (last - first) / numRanges;
+
+    auto state = std::make_shared<ParallelScanState>(numRanges);
+    for (size_t i = 0; i < numRanges; ++i) {
+      std::string key = prefix;
+      rocksutils::uintToPersistentBigEndian<uint64_t>(key, first + i * step);
+      state->lowerBounds.emplace_back(std::move(key));
+    }
+    for (size_t i = 0; i < numRanges; ++i) {
+      // the upper bound of each range is the lower bound of the next one
+      if (i + 1 < numRanges) {
+        state->upperBounds.emplace_back(state->lowerBounds[i + 1]);
+      } else {
+        state->upperBounds.emplace_back(_upperBound);
+      }
+      // iterators must be created from the transaction's thread
+      state->iterators.emplace_back(newIterator(&state->upperBounds[i]));
+    }
+
+    for (size_t i = 1; i < parallelism; ++i) {
+      SchedulerFeature::SCHEDULER->queue(RequestLane::INTERNAL_LOW,
+                                         [state]() { state->work(); });
+    }
+    // the calling thread participates, so the scan makes progress even
+    // if no scheduler thread is available
+    state->work();
+    state->waitForWorkers();
+
+    // workers that start after this point do not find any range to
+    // work on anymore, so we can safely get rid of the iterators now
+    for (auto& it : state->iterators) {
+      it.reset();
+    }
+
+    if (state->result.fail()) {
+      THROW_ARANGO_EXCEPTION(state->result);
+    }
+
+    skipped += state->count.load();
+    return true;
+  }
+
   void resetImpl() final {
     TRI_ASSERT(_trx->state()->isRunning());
     _mustSeek = true;
@@ -210,7 +403,11 @@ class RocksDBAllIndexIterator final : public IndexIterator {
             ro.verify_checksums = false;  // TODO evaluate
             ro.iterate_upper_bound = &_upperBound;
             ro.readOwnWrites = canReadOwnWrites() == ReadOwnWrites::yes;
-            // ro.readahead_size = 4 * 1024 * 1024;
+            // full scans read the documents sequentially, so let rocksdb
+            // grow the readahead size while we go. the blocks still end up
+            // in the block cache, so that concurrent scans of the same
+            // collection can be served from there
+            ro.adaptive_readahead = true;
           });
     }
 
@@ -540,6 +540,14 @@ zkd::byte_string_view RocksDBKey::zkdIndexValue(const rocksdb::Slice& slice) {
   return zkdIndexValue(slice.data(), slice.size());
 }
 
+zkd::byte_string_view RocksDBKey::uniqueZkdIndexValue(
+    rocksdb::Slice const& slice) {
+  TRI_ASSERT(slice.size() > sizeof(uint64_t));
+  return zkd::byte_string_view(
+      reinterpret_cast<const std::byte*>(slice.data()) + sizeof(uint64_t),
+      slice.size() - sizeof(uint64_t));
+}
+
 namespace arangodb {
 
 std::ostream& operator<<(std::ostream& stream, RocksDBKey const& key) {
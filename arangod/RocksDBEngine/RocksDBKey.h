@@ -299,6 +299,14 @@ class RocksDBKey {
   //////////////////////////////////////////////////////////////////////////////
   static zkd::byte_string_view zkdIndexValue(rocksdb::Slice const& slice);
 
+  //////////////////////////////////////////////////////////////////////////////
+  /// @brief Extracts the zkd index value from a unique zkd index key, which
+  /// does not contain a document id
+  ///
+  /// May be called only on unique zkd index values
+  //////////////////////////////////////////////////////////////////////////////
+  static zkd::byte_string_view uniqueZkdIndexValue(rocksdb::Slice const& slice);
+
   //////////////////////////////////////////////////////////////////////////////
   /// @brief Extracts log index from key
   //////////////////////////////////////////////////////////////////////////////
@@ -24,6 +24,7 @@
 #include "RocksDBMetaCollection.h"
 
 #include "ApplicationFeatures/ApplicationServer.h"
+#include "Basics/LockContention.h"
 #include "Basics/ReadLocker.h"
 #include "Basics/RecursiveLocker.h"
 #include "Basics/VelocyPackHelper.h"
@@ -60,6 +61,12 @@ using namespace arangodb;
 
 namespace {
 
+// waits for the collection-level lock, used by exclusive operations (write
+// mode) and by regular write operations (read mode)
+basics::LockContentionSite exclusiveLockSite(
+    "RocksDBMetaCollection::exclusive");
+basics::LockContentionSite sharedLockSite("RocksDBMetaCollection::shared");
+
 rocksdb::SequenceNumber forceWrite(RocksDBEngine& engine) {
   auto* sm = engine.settingsManager();
   if (sm) {
@@ -1677,9 +1684,17 @@ ErrorCode RocksDBMetaCollection::doLock(double timeout, AccessMode::Type mode) {
 
   bool gotLock = false;
   if (mode == AccessMode::Type::WRITE) {
-    gotLock = _exclusiveLock.tryLockWriteFor(timeout_us);
+    gotLock = _exclusiveLock.tryLockWrite();
+    if (!gotLock) {
+      basics::LockWaitTimer timer(exclusiveLockSite);
+      gotLock = _exclusiveLock.tryLockWriteFor(timeout_us);
+    }
   } else {
-    gotLock = _exclusiveLock.tryLockReadFor(timeout_us);
+    gotLock = _exclusiveLock.tryLockRead();
+    if (!gotLock) {
+      basics::LockWaitTimer timer(sharedLockSite);
+      gotLock = _exclusiveLock.tryLockReadFor(timeout_us);
+    }
   }
 
   if (gotLock) {
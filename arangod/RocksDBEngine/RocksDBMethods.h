@@ -51,6 +51,19 @@ class RocksDBMethods {
                               rocksdb::Slice const&, rocksdb::PinnableSlice*,
                               ReadOwnWrites) = 0;
 
+  /// @brief look up multiple keys at once. values and statuses must have
+  /// room for count entries. the default implementation looks up the keys
+  /// one by one
+  virtual void MultiGet(rocksdb::ColumnFamilyHandle* cf, size_t count,
+                        rocksdb::Slice const* keys,
+                        rocksdb::PinnableSlice* values,
+                        rocksdb::Status* statuses,
+                        ReadOwnWrites readOwnWrites) {
+    for (size_t i = 0; i < count; ++i) {
+      statuses[i] = Get(cf, keys[i], &values[i], readOwnWrites);
+    }
+  }
+
   virtual rocksdb::Status GetFromSnapshot(rocksdb::ColumnFamilyHandle*,
                                           rocksdb::Slice const&,
                                           rocksdb::PinnableSlice*,
@@ -44,6 +44,7 @@
 #include "ProgramOptions/ProgramOptions.h"
 #include "RocksDBEngine/RocksDBColumnFamilyManager.h"
 #include "RocksDBEngine/RocksDBPrefixExtractor.h"
+#include "RocksDBEngine/RocksDBVPackIndexFilterPolicy.h"
 
 #include <rocksdb/advanced_options.h>
 #include <rocksdb/cache.h>
@@ -303,6 +304,7 @@ RocksDBOptionFeature::RocksDBOptionFeature(Server& server)
       _enablePipelinedWrite(true),
       _optimizeFiltersForHits(rocksDBDefaults.optimize_filters_for_hits),
       _useDirectReads(rocksDBDefaults.use_direct_reads),
+      _allowMmapReads(rocksDBDefaults.allow_mmap_reads),
       _useDirectIoForFlushAndCompaction(
           rocksDBDefaults.use_direct_io_for_flush_and_compaction),
       _useFSync(rocksDBDefaults.use_fsync),
@@ -319,7 +321,13 @@ RocksDBOptionFeature::RocksDBOptionFeature(Server& server)
       _partitionFilesForPrimaryIndexCf(false),
       _partitionFilesForEdgeIndexCf(false),
       _partitionFilesForVPackIndexCf(false),
-      _maxWriteBufferNumberCf{0, 0, 0, 0, 0, 0, 0} {
+      _persistentIndexBloomFilter(false),
+      _documentsCompressionDictionarySize(0),
+      _maxWriteBufferNumberCf{0, 0, 0, 0, 0, 0, 0},
+      _writeBufferSizeCf{},
+      _bloomBitsPerKeyCf{},
+      _compressionTypeCf{},
+      _compactionStyleCf{} {
   // setting the number of background jobs to
   _maxBackgroundJobs = static_cast<int32_t>(
       std::max(static_cast<size_t>(2), NumberOfCores::getValue()));
@@ -666,6 +674,32 @@ number of cross-page I/O operations.)");
                                    arangodb::options::Flags::Uncommon));
 #endif
 
+  options
+      ->addOption("--rocksdb.allow-mmap-reads",
+                  "Whether to read .sst files via memory-mapping.",
+                  new BooleanParameter(&_allowMmapReads),
+                  arangodb::options::makeFlags(
+                      arangodb::options::Flags::Uncommon,
+                      arangodb::options::Flags::DefaultNoComponents,
+                      arangodb::options::Flags::OnAgent,
+                      arangodb::options::Flags::OnDBServer,
+                      arangodb::options::Flags::OnSingle))
+      .setIntroducedIn(31200)
+      .setLongDescription(R"(If enabled, RocksDB memory-maps its .sst files
+and reads uncompressed blocks directly from the mapped file, i.e. from the
+operating system's page cache, instead of copying them into the block
+cache first.
+
+This can speed up read-mostly workloads on data that is rarely modified,
+e.g. historical collections, in particular in combination with disabling
+compression for the affected column families (e.g. via
+`--rocksdb.compression-type-documents none`) so that reads do not have to
+decompress blocks. Compressed blocks are still decompressed into memory.
+
+The option cannot be combined with `--rocksdb.use-direct-reads` and
+should not be used together with encryption at rest. On 32-bit systems,
+the address space may not suffice to map all .sst files.)");
+
   options->addOption(
       "--rocksdb.use-fsync",
       "Whether to use fsync calls when writing to disk (set to false "
@@ -1396,6 +1430,34 @@ of outgrowing the maximum number of file descriptors the ArangoDB process
 can open. Thus the option should only be enabled on deployments with a
 limited number of collections/shards.)");
 
+  options
+      ->addOption("--rocksdb.documents-compression-dictionary-size",
+                  "The maximum size (in bytes) of the compression dictionary "
+                  "used for the document data in .sst files (0 = no "
+                  "dictionary compression).",
+                  new UInt64Parameter(&_documentsCompressionDictionarySize),
+                  arangodb::options::makeFlags(
+                      arangodb::options::Flags::Uncommon,
+                      arangodb::options::Flags::Experimental,
+                      arangodb::options::Flags::DefaultNoComponents,
+                      arangodb::options::Flags::OnAgent,
+                      arangodb::options::Flags::OnDBServer,
+                      arangodb::options::Flags::OnSingle))
+      .setIntroducedIn(31200)
+      .setLongDescription(R"(Documents are stored as VelocyPack, so every
+document repeats its attribute names. With a compression dictionary, RocksDB
+samples the document data when writing an .sst file and uses the samples
+as a shared dictionary for compressing all data blocks of the file. This
+way repeated attribute names only need to be stored once per file instead
+of once per data block, which reduces the disk space requirements and the
+write amplification for collections with many small documents.
+
+The dictionary is only used for levels that are compressed, see
+`--rocksdb.num-uncompressed-levels`. The best results are achieved with the
+`zstd` compression type, because it trains the dictionary on the samples.
+Typical values are 16 KB to 64 KB. The option only affects newly written
+.sst files.)");
+
   options
       ->addOption("--rocksdb.partition-files-for-primary-index",
                   "If enabled, the primary index data for different "
@@ -1491,6 +1553,34 @@ of outgrowing the maximum number of file descriptors the ArangoDB process
 can open. Thus the option should only be enabled on deployments with a
 limited number of edge collections/shards/indexes.)");
 
+  options
+      ->addOption("--rocksdb.persistent-index-bloom-filter",
+                  "Whether to create bloom filters for the .sst files of "
+                  "the persistent index column family.",
+                  new BooleanParameter(&_persistentIndexBloomFilter),
+                  arangodb::options::makeFlags(
+                      arangodb::options::Flags::Uncommon,
+                      arangodb::options::Flags::DefaultNoComponents,
+                      arangodb::options::Flags::OnAgent,
+                      arangodb::options::Flags::OnDBServer,
+                      arangodb::options::Flags::OnSingle))
+      .setIntroducedIn(31200)
+      .setLongDescription(R"(If enabled, RocksDB creates bloom filters for
+the .sst files of the persistent index column family. Point lookups of
+persistent index entries, in particular the uniqueness checks when
+inserting into unique persistent indexes, can then skip .sst files that
+do not contain the looked-up index values.
+
+The filters are built from a normalized form of the index keys, because
+index values with different binary representations can be equal (e.g.
+`1` and `1.0`). Range lookups and lookups on a subset of the indexed
+attributes do not use the filters.
+
+The filters are created for new .sst files only and use the number of
+bits per key configured via `--rocksdb.bloom-filter-bits-per-key-vpack`,
+or via `--rocksdb.bloom-filter-bits-per-key` if that is not set. The
+option can be turned off again later: existing filters are then ignored.)");
+
   //////////////////////////////////////////////////////////////////////////////
   /// add column family-specific options now
   //////////////////////////////////////////////////////////////////////////////
@@ -1521,8 +1611,66 @@ limited number of edge collections/shards/indexes.)");
                             arangodb::options::Flags::Uncommon))
             .setIntroducedIn(30800);
       };
+  // allows to tune column families with different workloads independently,
+  // e.g. a write-heavy documents column family and read-mostly indexes
+  auto addColumnFamilyOverrides =
+      [this, &options](RocksDBColumnFamilyManager::Family family) {
+        std::string name = RocksDBColumnFamilyManager::name(
+            family, RocksDBColumnFamilyManager::NameMode::External);
+        std::size_t index = static_cast<
+            std::underlying_type<RocksDBColumnFamilyManager::Family>::type>(
+            family);
+
+        options
+            ->addOption("--rocksdb.write-buffer-size-" + name,
+                        "If non-zero, overrides the value of "
+                        "`--rocksdb.write-buffer-size` for the " +
+                            name + " column family",
+                        new UInt64Parameter(&_writeBufferSizeCf[index]),
+                        arangodb::options::makeDefaultFlags(
+                            arangodb::options::Flags::Uncommon))
+            .setIntroducedIn(31200);
+
+        options
+            ->addOption("--rocksdb.bloom-filter-bits-per-key-" + name,
+                        "If non-zero, overrides the value of "
+                        "`--rocksdb.bloom-filter-bits-per-key` for the " +
+                            name + " column family",
+                        new DoubleParameter(&_bloomBitsPerKeyCf[index]),
+                        arangodb::options::makeDefaultFlags(
+                            arangodb::options::Flags::Uncommon))
+            .setIntroducedIn(31200);
+
+        // an empty value means that the global setting is used
+        auto compressionTypes = ::compressionTypes;
+        compressionTypes.emplace("");
+        options
+            ->addOption("--rocksdb.compression-type-" + name,
+                        "If set, overrides the value of "
+                        "`--rocksdb.compression-type` for the " +
+                            name + " column family",
+                        new DiscreteValuesParameter<StringParameter>(
+                            &_compressionTypeCf[index], compressionTypes),
+                        arangodb::options::makeDefaultFlags(
+                            arangodb::options::Flags::Uncommon))
+            .setIntroducedIn(31200);
+
+        auto compactionStyles = ::compactionStyles;
+        compactionStyles.emplace("");
+        options
+            ->addOption("--rocksdb.compaction-style-" + name,
+                        "If set, overrides the value of "
+                        "`--rocksdb.compaction-style` for the " +
+                            name + " column family",
+                        new DiscreteValuesParameter<StringParameter>(
+                            &_compactionStyleCf[index], compactionStyles),
+                        arangodb::options::makeDefaultFlags(
+                            arangodb::options::Flags::Uncommon))
+            .setIntroducedIn(31200);
+      };
   for (auto family : families) {
     addMaxWriteBufferNumberCf(family);
+    addColumnFamilyOverrides(family);
   }
 }
 
@@ -1533,6 +1681,31 @@ void RocksDBOptionFeature::validateOptions(
         << "invalid value for '--rocksdb.write-buffer-size'";
     FATAL_ERROR_EXIT();
   }
+  if (_documentsCompressionDictionarySize > 16 * 1024 * 1024) {
+    LOG_TOPIC("c9d62", FATAL, arangodb::Logger::STARTUP)
+        << "invalid value for '--rocksdb.documents-compression-dictionary-size'"
+        << ", must be at most 16 MB";
+    FATAL_ERROR_EXIT();
+  }
+  for (std::size_t i = 0; i < _writeBufferSizeCf.size(); ++i) {
+    if ((_writeBufferSizeCf[i] > 0 && _writeBufferSizeCf[i] < 1024 * 1024) ||
+        _bloomBitsPerKeyCf[i] < 0.0) {
+      LOG_TOPIC("0a8c1", FATAL, arangodb::Logger::STARTUP)
+          << "invalid value for column family-specific option of column "
+             "family '"
+          << RocksDBColumnFamilyManager::name(
+                 static_cast<RocksDBColumnFamilyManager::Family>(i),
+                 RocksDBColumnFamilyManager::NameMode::External)
+          << "'";
+      FATAL_ERROR_EXIT();
+    }
+  }
+  if (_allowMmapReads && _useDirectReads) {
+    LOG_TOPIC("7f3a2", FATAL, arangodb::Logger::STARTUP)
+        << "'--rocksdb.allow-mmap-reads' cannot be combined with "
+           "'--rocksdb.use-direct-reads'";
+    FATAL_ERROR_EXIT();
+  }
   if (_totalWriteBufferSize > 0 && _totalWriteBufferSize < 64 * 1024 * 1024) {
     LOG_TOPIC("4ab88", FATAL, arangodb::Logger::STARTUP)
         << "invalid value for '--rocksdb.total-write-buffer-size'";
@@ -1772,7 +1945,8 @@ void RocksDBOptionFeature::start() {
       << ", enable_pipelined_write: " << std::boolalpha << _enablePipelinedWrite
       << ", optimize_filters_for_hits: " << std::boolalpha
       << _optimizeFiltersForHits << ", use_direct_reads: " << std::boolalpha
-      << _useDirectReads
+      << _useDirectReads << ", allow_mmap_reads: " << std::boolalpha
+      << _allowMmapReads
       << ", use_direct_io_for_flush_and_compaction: " << std::boolalpha
       << _useDirectIoForFlushAndCompaction << ", use_fsync: " << std::boolalpha
       << _useFSync << ", allow_fallocate: " << std::boolalpha << _allowFAllocate
@@ -1818,6 +1992,7 @@ rocksdb::Options RocksDBOptionFeature::doGetOptions() const {
       static_cast<int>(_maxBytesForLevelMultiplier);
   result.optimize_filters_for_hits = _optimizeFiltersForHits;
   result.use_direct_reads = _useDirectReads;
+  result.allow_mmap_reads = _allowMmapReads;
   result.use_direct_io_for_flush_and_compaction =
       _useDirectIoForFlushAndCompaction;
 
@@ -2070,6 +2245,14 @@ rocksdb::ColumnFamilyOptions RocksDBOptionFeature::getColumnFamilyOptions(
     result.blob_garbage_collection_age_cutoff = _blobGarbageCollectionAgeCutoff;
     result.blob_garbage_collection_force_threshold =
         _blobGarbageCollectionForceThreshold;
+    if (_documentsCompressionDictionarySize > 0) {
+      // share attribute names etc. between all data blocks of an .sst file
+      result.compression_opts.max_dict_bytes =
+          static_cast<uint32_t>(_documentsCompressionDictionarySize);
+      // sample 100 times the dictionary size for zstd dictionary training
+      result.compression_opts.zstd_max_train_bytes =
+          static_cast<uint32_t>(_documentsCompressionDictionarySize * 100);
+    }
 #ifdef ARANGODB_ROCKSDB8
     result.prepopulate_blob_cache =
         _prepopulateBlobCache ? rocksdb::PrepopulateBlobCache::kFlushOnly
@@ -2118,6 +2301,53 @@ rocksdb::ColumnFamilyOptions RocksDBOptionFeature::getColumnFamilyOptions(
     result.max_write_buffer_number =
         static_cast<int>(_maxWriteBufferNumberCf[index]);
   }
+  if (_writeBufferSizeCf[index] > 0) {
+    result.write_buffer_size = static_cast<size_t>(_writeBufferSizeCf[index]);
+  }
+  if (!_compactionStyleCf[index].empty()) {
+    result.compaction_style =
+        ::compactionStyleFromString(_compactionStyleCf[index]);
+  }
+  if (!_compressionTypeCf[index].empty()) {
+    rocksdb::CompressionType compressionType =
+        ::compressionTypeFromString(_compressionTypeCf[index]);
+    // same as for the global setting, the lowest levels stay uncompressed
+    for (std::size_t level = 0; level < result.compression_per_level.size();
+         ++level) {
+      result.compression_per_level[level] =
+          (static_cast<uint64_t>(level) >= _numUncompressedLevels)
+              ? compressionType
+              : rocksdb::kNoCompression;
+    }
+  }
+  // the vpack index column family cannot use the regular bloom filter,
+  // because its comparator may consider keys with different bytes equal
+  bool const isVPackIndex =
+      family == RocksDBColumnFamilyManager::Family::VPackIndex;
+  if (((_bloomBitsPerKeyCf[index] > 0.0 && !isVPackIndex) ||
+       (_persistentIndexBloomFilter && isVPackIndex)) &&
+      result.table_factory != nullptr) {
+    auto const* tableOptions =
+        result.table_factory->GetOptions<rocksdb::BlockBasedTableOptions>();
+    if (tableOptions != nullptr) {
+      double bitsPerKey = _bloomBitsPerKeyCf[index] > 0.0
+                              ? _bloomBitsPerKeyCf[index]
+                              : _bloomBitsPerKey;
+      // keep all other table options of the column family, e.g. the hash
+      // index used by the edge index
+      rocksdb::BlockBasedTableOptions copy(*tableOptions);
+      if (isVPackIndex) {
+        copy.filter_policy =
+            std::make_shared<RocksDBVPackIndexFilterPolicy>(bitsPerKey);
+        copy.whole_key_filtering = true;
+      } else {
+        copy.filter_policy.reset(
+            rocksdb::NewBloomFilterPolicy(bitsPerKey, true));
+      }
+      result.table_factory = std::shared_ptr<rocksdb::TableFactory>(
+          rocksdb::NewBlockBasedTableFactory(copy));
+    }
+  }
   if (!_minWriteBufferNumberToMergeTouched) {
     result.min_write_buffer_number_to_merge =
         static_cast<int>(defaultMinWriteBufferNumberToMerge(
@@ -157,6 +157,7 @@ class RocksDBOptionFeature final : public ArangodFeature,
   bool _enablePipelinedWrite;
   bool _optimizeFiltersForHits;
   bool _useDirectReads;
+  bool _allowMmapReads;
   bool _useDirectIoForFlushAndCompaction;
   bool _useFSync;
   bool _skipCorrupted;
@@ -172,10 +173,26 @@ class RocksDBOptionFeature final : public ArangodFeature,
   bool _partitionFilesForPrimaryIndexCf;
   bool _partitionFilesForEdgeIndexCf;
   bool _partitionFilesForVPackIndexCf;
+  bool _persistentIndexBloomFilter;
+
+  /// size of the compression dictionary for the documents column family.
+  /// 0 means no dictionary compression
+  uint64_t _documentsCompressionDictionarySize;
 
   /// per column family write buffer limits
   std::array<uint64_t, RocksDBColumnFamilyManager::numberOfColumnFamilies>
       _maxWriteBufferNumberCf;
+
+  /// per column family overrides of the global settings. a value of 0 or
+  /// an empty string means that the global setting is used
+  std::array<uint64_t, RocksDBColumnFamilyManager::numberOfColumnFamilies>
+      _writeBufferSizeCf;
+  std::array<double, RocksDBColumnFamilyManager::numberOfColumnFamilies>
+      _bloomBitsPerKeyCf;
+  std::array<std::string, RocksDBColumnFamilyManager::numberOfColumnFamilies>
+      _compressionTypeCf;
+  std::array<std::string, RocksDBColumnFamilyManager::numberOfColumnFamilies>
+      _compactionStyleCf;
 };
 
 }  // namespace arangodb
@@ -34,6 +34,7 @@
 #include "Basics/application-exit.h"
 #include "Basics/exitcodes.h"
 #include "Basics/files.h"
+#include "Containers/FlatHashMap.h"
 #include "Logger/Logger.h"
 #include "Logger/LogMacros.h"
 #include "RestServer/DatabaseFeature.h"
@@ -53,6 +54,7 @@
 #include "StorageEngine/EngineSelectorFeature.h"
 #include "Transaction/Helpers.h"
 #include "VocBase/KeyGenerator.h"
+#include "VocBase/LogicalCollection.h"
 #include "VocBase/ticks.h"
 
 #include <rocksdb/utilities/transaction_db.h>
@@ -168,6 +170,13 @@ class WBReader final : public rocksdb::WriteBatch::Handler {
   // whether we are currently at the start of a batch
   bool _startOfBatch = false;
 
+  // caches for looking up collections and indexes by object id.
+  // collections and indexes are neither created nor dropped while the
+  // WAL is replayed, so the entries never need to be invalidated
+  containers::FlatHashMap<uint64_t, std::shared_ptr<LogicalCollection>>
+      _collections;
+  containers::FlatHashMap<uint64_t, std::shared_ptr<Index>> _indexes;
+
  public:
   /// @param seqs sequence number from which to count operations
   explicit WBReader(ArangodServer& server,
@@ -258,47 +267,51 @@ class WBReader final : public rocksdb::WriteBatch::Handler {
     }
   }
 
-  // find estimator for index
+  // find collection for object id. the result is cached, because
+  // consecutive WAL entries very often belong to the same few collections,
+  // and resolving the object id requires several lock acquisitions
   RocksDBCollection* findCollection(uint64_t objectId) {
-    // now adjust the counter in collections which are already loaded
-    RocksDBEngine::CollectionPair dbColPair =
-        _engine.mapObjectToCollection(objectId);
-    if (dbColPair.second.empty() || dbColPair.first == 0) {
-      // collection with this objectID not known.Skip.
-      return nullptr;
+    auto it = _collections.find(objectId);
+    if (it == _collections.end()) {
+      std::shared_ptr<LogicalCollection> collection;
+      RocksDBEngine::CollectionPair dbColPair =
+          _engine.mapObjectToCollection(objectId);
+      if (!dbColPair.second.empty() && dbColPair.first != 0) {
+        DatabaseFeature& df = _server.getFeature<DatabaseFeature>();
+        auto vocbase = df.useDatabase(dbColPair.first);
+        if (vocbase != nullptr) {
+          collection = vocbase->lookupCollection(dbColPair.second);
+        }
+      }
+      // negative results are cached as well. WAL entries for collections
+      // with unknown object ids are simply skipped
+      it = _collections.emplace(objectId, std::move(collection)).first;
     }
-    DatabaseFeature& df = _server.getFeature<DatabaseFeature>();
-    auto vocbase = df.useDatabase(dbColPair.first);
-    if (vocbase == nullptr) {
+    if (it->second == nullptr) {
       return nullptr;
     }
-    return static_cast<RocksDBCollection*>(
-        vocbase->lookupCollection(dbColPair.second)->getPhysical());
+    return static_cast<RocksDBCollection*>(it->second->getPhysical());
   }
 
+  // find index for object id. the result is cached, see findCollection()
   RocksDBIndex* findIndex(uint64_t objectId) {
-    RocksDBEngine::IndexTriple triple = _engine.mapObjectToIndex(objectId);
-    if (std::get<0>(triple) == 0 && std::get<1>(triple).empty()) {
-      return nullptr;
-    }
-
-    DatabaseFeature& df = _server.getFeature<DatabaseFeature>();
-    auto vb = df.useDatabase(std::get<0>(triple));
-    if (vb == nullptr) {
-      return nullptr;
-    }
-
-    auto coll = vb->lookupCollection(std::get<1>(triple));
-
-    if (coll == nullptr) {
-      return nullptr;
-    }
-
-    std::shared_ptr<Index> index = coll->lookupIndex(std::get<2>(triple));
-    if (index == nullptr) {
-      return nullptr;
+    auto it = _indexes.find(objectId);
+    if (it == _indexes.end()) {
+      std::shared_ptr<Index> index;
+      RocksDBEngine::IndexTriple triple = _engine.mapObjectToIndex(objectId);
+      if (std::get<0>(triple) != 0 || !std::get<1>(triple).empty()) {
+        DatabaseFeature& df = _server.getFeature<DatabaseFeature>();
+        auto vb = df.useDatabase(std::get<0>(triple));
+        if (vb != nullptr) {
+          auto coll = vb->lookupCollection(std::get<1>(triple));
+          if (coll != nullptr) {
+            index = coll->lookupIndex(std::get<2>(triple));
+          }
+        }
+      }
+      it = _indexes.emplace(objectId, std::move(index)).first;
     }
-    return static_cast<RocksDBIndex*>(index.get());
+    return static_cast<RocksDBIndex*>(it->second.get());
   }
 
   void updateMaxTick(uint32_t column_family_id, const rocksdb::Slice& key,
@@ -1148,6 +1148,7 @@ RocksDBReplicationContext::CollectionIterator::CollectionIterator(
   _readOptions.verify_checksums = false;
   _readOptions.fill_cache = false;
   _readOptions.prefix_same_as_start = true;
+  _readOptions.adaptive_readahead = true;
 
   _cTypeHandler =
       transaction::Context::createCustomTypeHandler(vocbase, _resolver);
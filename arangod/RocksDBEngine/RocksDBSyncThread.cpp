@@ -32,17 +32,26 @@
 #include <rocksdb/status.h>
 #include <rocksdb/utilities/transaction_db.h>
 
+#include <algorithm>
+#include <thread>
+
 using namespace arangodb;
 
-RocksDBSyncThread::RocksDBSyncThread(RocksDBEngine& engine,
-                                     std::chrono::milliseconds interval,
-                                     std::chrono::milliseconds delayThreshold)
+RocksDBSyncThread::RocksDBSyncThread(
+    RocksDBEngine& engine, std::chrono::milliseconds interval,
+    std::chrono::milliseconds delayThreshold,
+    std::chrono::microseconds groupCommitMaxDelay)
     : Thread(engine.server(), "RocksDBSync"),
       _engine(engine),
       _interval(interval),
       _lastSyncTime(std::chrono::steady_clock::now()),
       _lastSequenceNumber(0),
-      _delayThreshold(delayThreshold) {}
+      _delayThreshold(delayThreshold),
+      _groupCommitMaxDelay(groupCommitMaxDelay),
+      _groupSyncInProgress(false),
+      _numGroupWaiters(0),
+      _avgSyncDuration(0.0),
+      _avgGroupSize(1.0) {}
 
 RocksDBSyncThread::~RocksDBSyncThread() { shutdown(); }
 
@@ -53,17 +62,49 @@ Result RocksDBSyncThread::syncWal() {
 
   auto db = _engine.db()->GetBaseDB();
 
-  // set time of last syncing under the lock
+  // everything up to this sequence number must be synced when we return
+  auto const requiredSequenceNumber = db->GetLatestSequenceNumber();
+
+  std::unique_lock guard{_condition.mutex};
+  while (true) {
+    if (_lastSequenceNumber >= requiredSequenceNumber) {
+      // already covered by the sync of another caller or of the
+      // background thread
+      return {};
+    }
+    if (!_groupSyncInProgress) {
+      // we are the leader of the next group
+      break;
+    }
+    // wait for the current leader. its sync may or may not cover our
+    // writes, depending on whether they happened before it started
+    ++_numGroupWaiters;
+    _condition.cv.wait(guard);
+    --_numGroupWaiters;
+  }
+
+  _groupSyncInProgress = true;
+  auto const delay = groupCommitDelay();
+  guard.unlock();
+
+  if (delay.count() > 0) {
+    // give concurrent commits the chance to join our group
+    std::this_thread::sleep_for(delay);
+  }
+
   auto const now = std::chrono::steady_clock::now();
   auto const lastSequenceNumber = db->GetLatestSequenceNumber();
 
   // actual syncing is done without holding the lock
   auto result = sync(db);
 
+  auto const duration = std::chrono::duration_cast<std::chrono::microseconds>(
+      std::chrono::steady_clock::now() - now);
+
   bool sequenceNumberUpdate = false;
+  guard.lock();
+  _groupSyncInProgress = false;
   if (result.ok()) {
-    std::lock_guard guard{_condition.mutex};
-
     if (now > _lastSyncTime) {
       // update last sync time...
       _lastSyncTime = now;
@@ -74,7 +115,17 @@ Result RocksDBSyncThread::syncWal() {
       _lastSequenceNumber = lastSequenceNumber;
       sequenceNumberUpdate = true;
     }
+
+    // the waiters are a good approximation for the number of concurrent
+    // commits requiring a sync
+    _avgSyncDuration =
+        0.8 * _avgSyncDuration + 0.2 * static_cast<double>(duration.count());
+    _avgGroupSize = 0.8 * _avgGroupSize +
+                    0.2 * static_cast<double>(1 + _numGroupWaiters);
   }
+  guard.unlock();
+  // wake up the waiters. on failure, one of them becomes the next leader
+  _condition.cv.notify_all();
 
   if (sequenceNumberUpdate) {
     notifySyncListeners(lastSequenceNumber);
@@ -83,6 +134,20 @@ Result RocksDBSyncThread::syncWal() {
   return result;
 }
 
+std::chrono::microseconds RocksDBSyncThread::groupCommitDelay()
+    const noexcept {
+  if (_groupCommitMaxDelay.count() == 0 || _avgGroupSize < 1.5) {
+    // no delay configured, or commits that require a sync do not arrive
+    // concurrently. delaying would only add latency then
+    return std::chrono::microseconds(0);
+  }
+  // waiting for a fraction of a sync lets more commits join the group,
+  // while bounding the additional latency
+  return std::min(std::chrono::microseconds(
+                      static_cast<int64_t>(_avgSyncDuration / 2.0)),
+                  _groupCommitMaxDelay);
+}
+
 Result RocksDBSyncThread::sync(rocksdb::DB* db) {
   LOG_TOPIC("a3978", TRACE, Logger::ENGINES) << "syncing RocksDB WAL";
 
@@ -173,16 +238,20 @@ void RocksDBSyncThread::run() {
       bool sequenceNumberUpdate = false;
       if (res.ok()) {
         // success case
-        std::lock_guard guard{_condition.mutex};
-
-        if (lastSequenceNumber > _lastSequenceNumber) {
-          // bump last sequence number we have synced
-          _lastSequenceNumber = lastSequenceNumber;
-          sequenceNumberUpdate = true;
-        }
-        if (lastSyncTime > _lastSyncTime) {
-          _lastSyncTime = lastSyncTime;
+        {
+          std::lock_guard guard{_condition.mutex};
+
+          if (lastSequenceNumber > _lastSequenceNumber) {
+            // bump last sequence number we have synced
+            _lastSequenceNumber = lastSequenceNumber;
+            sequenceNumberUpdate = true;
+          }
+          if (lastSyncTime > _lastSyncTime) {
+            _lastSyncTime = lastSyncTime;
+          }
         }
+        // callers of syncWal() may be waiting for this sync
+        _condition.cv.notify_all();
       } else {
         // could not sync... in this case, don't advance our last
         // sync time and last synced sequence number
@@ -44,13 +44,18 @@ class RocksDBEngine;
 class RocksDBSyncThread final : public Thread {
  public:
   RocksDBSyncThread(RocksDBEngine& engine, std::chrono::milliseconds interval,
-                    std::chrono::milliseconds delayThreshold);
+                    std::chrono::milliseconds delayThreshold,
+                    std::chrono::microseconds groupCommitMaxDelay =
+                        std::chrono::microseconds(0));
 
   ~RocksDBSyncThread();
 
   void beginShutdown() override;
 
-  /// @brief updates last sync time and calls the synchronization
+  /// @brief makes sure that everything written to the WAL so far is
+  /// synced. concurrent callers are grouped: only one of them (the leader)
+  /// syncs at a time, and all callers that arrive while a sync is in
+  /// progress are covered by the next single sync.
   /// this is the preferred method to call when trying to avoid redundant
   /// syncs by foreground work and the background sync thread
   Result syncWal();
@@ -89,9 +94,30 @@ class RocksDBSyncThread final : public Thread {
   /// sync thread
   std::chrono::milliseconds const _delayThreshold;
 
-  /// @brief protects _lastSyncTime and _lastSequenceNumber
+  /// @brief maximum time a group commit leader waits for more commits to
+  /// join its group before syncing
+  std::chrono::microseconds const _groupCommitMaxDelay;
+
+  /// @brief protects _lastSyncTime, _lastSequenceNumber and the group commit
+  /// state below
   arangodb::basics::ConditionVariable _condition;
 
+  /// @brief whether a group commit leader is currently syncing
+  bool _groupSyncInProgress;
+
+  /// @brief number of callers of syncWal() waiting for the current leader
+  std::size_t _numGroupWaiters;
+
+  /// @brief moving averages of the observed sync duration (in microseconds)
+  /// and of the number of callers covered by a sync, used to adapt the
+  /// group commit delay
+  double _avgSyncDuration;
+  double _avgGroupSize;
+
+  /// @brief the delay for the next group commit leader. called under the
+  /// mutex
+  std::chrono::microseconds groupCommitDelay() const noexcept;
+
   /// @brief listeners to be notified when _lastSequenceNumber is updated after
   /// a sync.
   std::shared_mutex _syncListenersMutex;
@@ -59,7 +59,11 @@ RocksDBTransactionCollection::RocksDBTransactionCollection(
       _exclusiveWrites(trx->vocbase()
                            .server()
                            .getFeature<arangodb::RocksDBOptionFeature>()
-                           .exclusiveWrites()) {}
+                           .exclusiveWrites()),
+      _maxCacheRefills(trx->vocbase()
+                           .server()
+                           .getFeature<RocksDBIndexCacheRefillFeature>()
+                           .maxCapacity()) {}
 
 RocksDBTransactionCollection::~RocksDBTransactionCollection() {
   try {
@@ -302,7 +306,20 @@ void RocksDBTransactionCollection::trackIndexRemove(IndexId iid,
 
 void RocksDBTransactionCollection::trackIndexCacheRefill(IndexId iid,
                                                          std::string_view key) {
-  _trackedCacheRefills[iid].emplace_back(key.data(), key.size());
+  if (_droppedCacheRefills.contains(iid)) {
+    return;
+  }
+  auto& keys = _trackedCacheRefills[iid];
+  if (keys.size() + 1 >= _maxCacheRefills) {
+    // the refill thread drops all keys of an index if it receives more
+    // keys than its capacity. refilling is best-effort anyway, so stop
+    // tracking keys for this index now rather than holding them in memory
+    // until the end of a large transaction
+    _trackedCacheRefills.erase(iid);
+    _droppedCacheRefills.emplace(iid);
+    return;
+  }
+  keys.emplace_back(key.data(), key.size());
 }
 
 void RocksDBTransactionCollection::handleIndexCacheRefills() {
@@ -314,10 +331,11 @@ void RocksDBTransactionCollection::handleIndexCacheRefills() {
                        .server()
                        .getFeature<RocksDBIndexCacheRefillFeature>();
 
-  for (auto const& it : _trackedCacheRefills) {
+  for (auto& it : _trackedCacheRefills) {
     refiller.trackRefill(_collection, it.first, std::move(it.second));
   }
   _trackedCacheRefills.clear();
+  _droppedCacheRefills.clear();
 }
 
 /// @brief lock a collection
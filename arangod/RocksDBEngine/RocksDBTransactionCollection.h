@@ -25,6 +25,7 @@
 
 #include "Basics/Common.h"
 #include "Containers/FlatHashMap.h"
+#include "Containers/FlatHashSet.h"
 #include "StorageEngine/TransactionCollection.h"
 #include "VocBase/AccessMode.h"
 #include "VocBase/Identifiers/IndexId.h"
@@ -172,6 +173,13 @@ class RocksDBTransactionCollection : public TransactionCollection {
   containers::FlatHashMap<IndexId, std::vector<std::string>>
       _trackedCacheRefills;
 
+  /// @brief indexes for which we gave up tracking cache refills, because
+  /// the refill thread would not accept that many keys at once anyway
+  containers::FlatHashSet<IndexId> _droppedCacheRefills;
+
+  /// @brief maximum number of keys the refill thread accepts at once
+  std::size_t const _maxCacheRefills;
+
   bool _usageLocked;
   bool _exclusiveWrites;
 };
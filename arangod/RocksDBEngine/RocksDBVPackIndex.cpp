@@ -40,6 +40,7 @@
 #include "Containers/FlatHashSet.h"
 #include "Indexes/SortedIndexAttributeMatcher.h"
 #include "Logger/LogMacros.h"
+#include "RocksDBEngine/RocksDBCacheValueCompression.h"
 #include "RocksDBEngine/RocksDBCollection.h"
 #include "RocksDBEngine/RocksDBColumnFamilyManager.h"
 #include "RocksDBEngine/RocksDBCommon.h"
@@ -539,7 +540,7 @@ class RocksDBVPackIndexIterator final : public IndexIterator {
       transaction::Methods* trx, RocksDBVPackIndex const* index,
       RocksDBKeyBounds&& bounds, std::shared_ptr<cache::Cache> cache,
       IndexIteratorOptions const& opts, ReadOwnWrites readOwnWrites,
-      RocksDBVPackIndexSearchValueFormat format)
+      RocksDBVPackIndexSearchValueFormat format, bool chainLookups)
       : IndexIterator(collection, trx, readOwnWrites),
         _index(index),
         _cmp(static_cast<RocksDBVPackComparator const*>(index->comparator())),
@@ -550,12 +551,16 @@ class RocksDBVPackIndexIterator final : public IndexIterator {
         _cacheKeyBuilderSize(0),
         _resultBuilder(&_builderOptions),
         _resultIterator(VPackArrayIterator(VPackArrayIterator::Empty{})),
+        _minValueSizeForCompression(std::numeric_limits<size_t>::max()),
+        _compressionAccelerationFactor(1),
         _indexIteratorOptions(opts),
         _bounds(std::move(bounds)),
         _rangeBound(reverse ? _bounds.start() : _bounds.end()),
+        _iterateBounds(RocksDBKeyBounds::Empty()),
         _memoryUsage(0),
         _format(format),
-        _mustSeek(true) {
+        _mustSeek(true),
+        _chainLookups(chainLookups) {
     TRI_ASSERT(index->columnFamily() ==
                RocksDBColumnFamilyManager::get(
                    RocksDBColumnFamilyManager::Family::VPackIndex));
@@ -563,6 +568,20 @@ class RocksDBVPackIndexIterator final : public IndexIterator {
     // if the cache is enabled, it must use the VPackKeyHasher!
     TRI_ASSERT(_cache == nullptr || _cache->hasherName() == "VPackKeyHasher");
 
+    if (_chainLookups) {
+      // the RocksDB iterator is bounded by the entire index, so that it
+      // stays valid when moving from one lookup range to the next one.
+      // the bounds of the current lookup range are checked by us
+      TRI_ASSERT(mustCheckBounds);
+      uint64_t objectId = index->objectId();
+      if constexpr (unique) {
+        _iterateBounds = RocksDBKeyBounds::UniqueVPackIndex(objectId, reverse);
+      } else {
+        _iterateBounds = RocksDBKeyBounds::VPackIndex(objectId, reverse);
+      }
+      _iterateBound = reverse ? _iterateBounds.start() : _iterateBounds.end();
+    }
+
     TRI_IF_FAILURE("VPackIndexFailWithoutCache") {
       if (_cache == nullptr) {
         THROW_ARANGO_EXCEPTION(TRI_ERROR_DEBUG);
@@ -579,6 +598,17 @@ class RocksDBVPackIndexIterator final : public IndexIterator {
       _builderOptions.paddingBehavior =
           VPackOptions::PaddingBehavior::UsePadding;
 
+      if constexpr (!unique) {
+        // non-unique indexes can produce many index entries per lookup
+        // value, so their cache values are worth compressing
+        auto& cmf =
+            collection->vocbase().server().getFeature<CacheManagerFeature>();
+        _minValueSizeForCompression =
+            cmf.minValueSizeForPersistentIndexCompression();
+        _compressionAccelerationFactor =
+            static_cast<int>(cmf.accelerationFactorForEdgeCompression());
+      }
+
       // in case we can use the hash cache for looking up data, we need to
       // extract a useful lookup value from _bounds.start() first. this is
       // because the lookup value for RocksDB contains a "min key" vpack
@@ -889,6 +919,9 @@ class RocksDBVPackIndexIterator final : public IndexIterator {
           TRI_ASSERT(limit > 0);  // Someone called with limit == 0. Api broken
           // validate that Iterator is in a good shape and hasn't failed
           rocksutils::checkIteratorStatus(*_iterator);
+          if (limit > 0) {
+            rangeExhausted();
+          }
 
           // store in in-memory cache that we found nothing.
           storeInCache(VPackSlice::emptyArraySlice());
@@ -918,6 +951,9 @@ class RocksDBVPackIndexIterator final : public IndexIterator {
       TRI_ASSERT(limit > 0);  // Someone called with limit == 0. Api broken
       // validate that Iterator is in a good shape and hasn't failed
       rocksutils::checkIteratorStatus(*_iterator);
+      if (limit > 0) {
+        rangeExhausted();
+      }
 
       // no data found
       return false;
@@ -926,10 +962,12 @@ class RocksDBVPackIndexIterator final : public IndexIterator {
     TRI_ASSERT(limit > 0);
 
     // cannot get here if we have a cache
+    bool const skipToNextPrefix =
+        !reverse && _indexIteratorOptions.distinctPrefixFields > 0;
     do {
       consumeIteratorValue();
 
-      if (!advance()) {
+      if (!(skipToNextPrefix ? advanceToNextPrefix() : advance())) {
         // validate that Iterator is in a good shape and hasn't failed
         rocksutils::checkIteratorStatus(*_iterator);
         return false;
@@ -1003,7 +1041,16 @@ class RocksDBVPackIndexIterator final : public IndexIterator {
     if (finding.found()) {
       incrCacheHits();
       // We got sth. in the cache
-      VPackSlice cachedData(finding.value()->value());
+      uint8_t const* data = finding.value()->value();
+      bool const isCompressed = rocksutils::isCompressedCacheValue(data);
+      if (isCompressed) {
+        // the data is lz4-compressed. uncompress it into _resultBuilder
+        _resultBuilder.clear();
+        rocksutils::decompressCacheValue(data, finding.value()->valueSize(),
+                                         _resultBuilder);
+        data = _resultBuilder.slice().start();
+      }
+      VPackSlice cachedData(data);
       TRI_ASSERT(cachedData.isArray());
       if (cachedData.length() / numFields < limit) {
         // Directly return it, no need to copy
@@ -1017,10 +1064,12 @@ class RocksDBVPackIndexIterator final : public IndexIterator {
         return CacheLookupResult::kInCacheAndFullyHandled;
       }
 
-      // We need to copy the data from the cache, and let the caller
-      // handler the result.
-      _resultBuilder.clear();
-      _resultBuilder.add(cachedData);
+      if (!isCompressed) {
+        // We need to copy the data from the cache, and let the caller
+        // handler the result.
+        _resultBuilder.clear();
+        _resultBuilder.add(cachedData);
+      }
       TRI_ASSERT(_resultBuilder.slice().isArray());
       _resultIterator = VPackArrayIterator(_resultBuilder.slice());
       return CacheLookupResult::kInCacheAndPartlyHandled;
@@ -1040,11 +1089,20 @@ class RocksDBVPackIndexIterator final : public IndexIterator {
       return;
     }
 
+    [[maybe_unused]] auto [data, size, didCompress] =
+        rocksutils::tryCompressCacheValue(
+            slice, byteSize, _minValueSizeForCompression,
+            _compressionAccelerationFactor, _lz4CompressBuffer,
+            [this](size_t memoryUsage) {
+              _resourceMonitor.increaseMemoryUsage(memoryUsage);
+              _memoryUsage += memoryUsage;
+            });
+
     VPackSlice key = _cacheKeyBuilder.slice();
     cache::Cache::SimpleInserter<VPackIndexCacheType>{
         static_cast<VPackIndexCacheType&>(*_cache), key.start(),
-        static_cast<uint32_t>(_cacheKeyBuilderSize), slice.start(),
-        static_cast<uint64_t>(byteSize)};
+        static_cast<uint32_t>(_cacheKeyBuilderSize), data,
+        static_cast<uint64_t>(size)};
   }
 
   inline bool outOfRange() const {
@@ -1086,10 +1144,12 @@ class RocksDBVPackIndexIterator final : public IndexIterator {
             TRI_ASSERT(options.prefix_same_as_start);
             // we need to have a pointer to a slice for the upper bound
             // so we need to assign the slice to an instance variable here
+            rocksdb::Slice const* bound =
+                _chainLookups ? &_iterateBound : &_rangeBound;
             if constexpr (reverse) {
-              options.iterate_lower_bound = &_rangeBound;
+              options.iterate_lower_bound = bound;
             } else {
-              options.iterate_upper_bound = &_rangeBound;
+              options.iterate_upper_bound = bound;
             }
             options.readOwnWrites = canReadOwnWrites() == ReadOwnWrites::yes;
           });
@@ -1102,16 +1162,76 @@ class RocksDBVPackIndexIterator final : public IndexIterator {
 
     TRI_ASSERT(_iterator != nullptr);
     if (_mustSeek) {
-      if constexpr (reverse) {
-        _iterator->SeekForPrev(_bounds.end());
-      } else {
-        _iterator->Seek(_bounds.start());
+      if (!catchUp()) {
+        if constexpr (reverse) {
+          _iterator->SeekForPrev(_bounds.end());
+        } else {
+          _iterator->Seek(_bounds.start());
+        }
       }
+      _scannedUpTo.clear();
       _mustSeek = false;
     }
     TRI_ASSERT(!_mustSeek);
   }
 
+  // try to move the iterator from the end of the previous lookup range to
+  // the start of the current one by stepping instead of seeking. the values
+  // of IN lists are sorted in index order, so the next lookup range often
+  // starts just a few keys behind the previous one. returns false if the
+  // caller needs to seek
+  bool catchUp() {
+    if (!_chainLookups || _scannedUpTo.empty() || !_iterator->Valid()) {
+      return false;
+    }
+    // the iterator is positioned on the first key behind the previously
+    // scanned range. stepping from there only finds the start of the
+    // current range if the current range is entirely behind the previous one
+    rocksdb::Slice scannedUpTo(_scannedUpTo);
+    if constexpr (reverse) {
+      if (_cmp->Compare(scannedUpTo, _bounds.end()) <= 0) {
+        return false;
+      }
+    } else {
+      if (_cmp->Compare(scannedUpTo, _bounds.start()) >= 0) {
+        return false;
+      }
+    }
+
+    for (size_t steps = 0; steps < maxCatchUpSteps; ++steps) {
+      if (!_iterator->Valid()) {
+        // end of index. the caller will check the iterator status
+        return true;
+      }
+      int res;
+      if constexpr (reverse) {
+        res = _cmp->Compare(_bounds.end(), _iterator->key());
+      } else {
+        res = _cmp->Compare(_iterator->key(), _bounds.start());
+      }
+      if (res >= 0) {
+        // reached the start of the current range (or went past it, in
+        // which case the range is empty and outOfRange() will notice)
+        return true;
+      }
+      if constexpr (reverse) {
+        _iterator->Prev();
+      } else {
+        _iterator->Next();
+      }
+    }
+    return false;
+  }
+
+  // remember that the current lookup range has been scanned completely and
+  // that the iterator is positioned on the first key behind it
+  void rangeExhausted() {
+    if (_chainLookups) {
+      rocksdb::Slice end = reverse ? _bounds.start() : _bounds.end();
+      _scannedUpTo.assign(end.data(), end.size());
+    }
+  }
+
   inline bool advance() {
     if constexpr (reverse) {
       _iterator->Prev();
@@ -1119,13 +1239,68 @@ class RocksDBVPackIndexIterator final : public IndexIterator {
       _iterator->Next();
     }
 
-    return _iterator->Valid() && !outOfRange();
+    if (_iterator->Valid() && !outOfRange()) {
+      return true;
+    }
+    rangeExhausted();
+    return false;
+  }
+
+  // move the iterator to the first index entry that differs from the
+  // current one in the values of the first distinctPrefixFields index
+  // attributes. the entries in between are not needed by the caller
+  bool advanceToNextPrefix() {
+    TRI_ASSERT(!reverse);
+    TRI_ASSERT(_indexIteratorOptions.distinctPrefixFields > 0);
+
+    // build a key that sorts behind all entries with the current prefix
+    _prefixBuilder.clear();
+    _prefixBuilder.openArray();
+    size_t n = 0;
+    for (VPackSlice it : VPackArrayIterator(
+             RocksDBKey::indexedVPack(_iterator->key()))) {
+      if (n++ == _indexIteratorOptions.distinctPrefixFields) {
+        break;
+      }
+      _prefixBuilder.add(it);
+    }
+    _prefixBuilder.add(VPackSlice::maxKeySlice());
+    _prefixBuilder.close();
+    _prefixKey.constructUniqueVPackIndexValue(_index->objectId(),
+                                              _prefixBuilder.slice());
+    rocksdb::Slice end = _prefixKey.string();
+
+    // if a prefix only has few entries, stepping over them is cheaper than
+    // seeking
+    for (size_t steps = 0; steps < maxPrefixSteps; ++steps) {
+      if (!advance()) {
+        return false;
+      }
+      if (_cmp->Compare(_iterator->key(), end) > 0) {
+        return true;
+      }
+    }
+
+    _iterator->Seek(end);
+    if (_iterator->Valid() && !outOfRange()) {
+      return true;
+    }
+    rangeExhausted();
+    return false;
   }
 
   // expected number of bytes that a RocksDB iterator will use.
   // this is a guess and does not need to be fully accurate.
   static constexpr size_t expectedIteratorMemoryUsage = 8192;
 
+  // maximum number of keys to step over in advanceToNextPrefix() before
+  // seeking to the next prefix
+  static constexpr size_t maxPrefixSteps = 8;
+
+  // maximum number of keys to step over when moving on to the next lookup
+  // range without seeking
+  static constexpr size_t maxCatchUpSteps = 10;
+
   RocksDBVPackIndex const* _index;
   RocksDBVPackComparator const* _cmp;
   std::unique_ptr<rocksdb::Iterator> _iterator;
@@ -1146,16 +1321,37 @@ class RocksDBVPackIndexIterator final : public IndexIterator {
   // Iterator into cache lookup results, pointing into _resultBuilder. only
   // set when _cache is set
   velocypack::ArrayIterator _resultIterator;
+  // values >= this size will be stored LZ4-compressed in the in-memory
+  // cache. only used when _cache is set
+  size_t _minValueSizeForCompression;
+  int _compressionAccelerationFactor;
+  // reusable buffer for lz4 compression. only used when _cache is set
+  std::string _lz4CompressBuffer;
 
   IndexIteratorOptions const _indexIteratorOptions;
   RocksDBKeyBounds _bounds;
   // used for iterate_upper_bound iterate_lower_bound
   rocksdb::Slice _rangeBound;
 
+  // bounds of the entire index. only used if _chainLookups is set
+  RocksDBKeyBounds _iterateBounds;
+  // used for iterate_upper_bound iterate_lower_bound if _chainLookups is set
+  rocksdb::Slice _iterateBound;
+  // end of the last lookup range that was scanned completely, if the
+  // iterator has not been moved since. only used if _chainLookups is set
+  std::string _scannedUpTo;
+  // key behind all entries with the current prefix and the builder for its
+  // index values. only used if distinctPrefixFields is set
+  velocypack::Builder _prefixBuilder;
+  RocksDBKey _prefixKey;
+
   // memory used by this iterator
   size_t _memoryUsage;
   RocksDBVPackIndexSearchValueFormat const _format;
   bool _mustSeek;
+  // whether the iterator is used for a sorted sequence of lookups, i.e. for
+  // the values of an IN list
+  bool const _chainLookups;
 };
 
 uint64_t RocksDBVPackIndex::HashForKey(rocksdb::Slice const& key) {
@@ -2087,6 +2283,23 @@ Result RocksDBVPackIndex::remove(transaction::Methods& trx,
   return res;
 }
 
+std::vector<std::string> RocksDBVPackIndex::cachedKeys(
+    std::size_t maxKeys) const {
+  std::vector<std::string> keys;
+  auto cache = useCache();
+  if (cache == nullptr || maxKeys == 0) {
+    return keys;
+  }
+
+  // cache keys are the index lookup values, which is what refillCache()
+  // expects
+  cache->forEachKey([&](std::string_view key) {
+    keys.emplace_back(key);
+    return keys.size() < maxKeys;
+  });
+  return keys;
+}
+
 void RocksDBVPackIndex::refillCache(transaction::Methods& trx,
                                     std::vector<std::string> const& keys) {
   if (keys.empty()) {
@@ -2128,7 +2341,7 @@ std::unique_ptr<IndexIterator> RocksDBVPackIndex::buildIterator(
     ResourceMonitor& monitor, transaction::Methods* trx,
     VPackSlice searchValues, IndexIteratorOptions const& opts,
     ReadOwnWrites readOwnWrites, RocksDBVPackIndexSearchValueFormat format,
-    bool& isUniqueIndexIterator) const {
+    bool& isUniqueIndexIterator, bool chainLookups) const {
   TRI_ASSERT(searchValues.isArray());
   TRI_ASSERT(format != RocksDBVPackIndexSearchValueFormat::kDetect);
 
@@ -2188,18 +2401,22 @@ std::unique_ptr<IndexIterator> RocksDBVPackIndex::buildIterator(
 
   return buildIteratorFromBounds(monitor, trx, reverse, opts, readOwnWrites,
                                  std::move(bounds), format,
-                                 /*useCache*/ allEq && withCache);
+                                 /*useCache*/ allEq && withCache,
+                                 chainLookups);
 }
 
 std::unique_ptr<IndexIterator> RocksDBVPackIndex::buildIteratorFromBounds(
     ResourceMonitor& monitor, transaction::Methods* trx, bool reverse,
     IndexIteratorOptions const& opts, ReadOwnWrites readOwnWrites,
     RocksDBKeyBounds&& bounds, RocksDBVPackIndexSearchValueFormat format,
-    bool withCache) const {
+    bool withCache, bool chainLookups) const {
   TRI_ASSERT(!bounds.empty());
   TRI_ASSERT(format != RocksDBVPackIndexSearchValueFormat::kDetect);
 
+  // chained lookups use the entire index as iterator bounds, so they always
+  // need to check the bounds of the lookup range themselves
   bool mustCheckBounds =
+      chainLookups ||
       RocksDBTransactionState::toState(trx)->iteratorMustCheckBounds(
           _collection.id(), readOwnWrites);
 
@@ -2210,21 +2427,25 @@ std::unique_ptr<IndexIterator> RocksDBVPackIndex::buildIteratorFromBounds(
       if (mustCheckBounds) {
         return std::make_unique<RocksDBVPackIndexIterator<true, true, true>>(
             monitor, &_collection, trx, this, std::move(bounds),
-            withCache ? useCache() : nullptr, opts, readOwnWrites, format);
+            withCache ? useCache() : nullptr, opts, readOwnWrites, format,
+            chainLookups);
       }
       return std::make_unique<RocksDBVPackIndexIterator<true, true, false>>(
           monitor, &_collection, trx, this, std::move(bounds),
-          withCache ? useCache() : nullptr, opts, readOwnWrites, format);
+          withCache ? useCache() : nullptr, opts, readOwnWrites, format,
+          chainLookups);
     }
     // forward version
     if (mustCheckBounds) {
       return std::make_unique<RocksDBVPackIndexIterator<true, false, true>>(
           monitor, &_collection, trx, this, std::move(bounds),
-          withCache ? useCache() : nullptr, opts, readOwnWrites, format);
+          withCache ? useCache() : nullptr, opts, readOwnWrites, format,
+          chainLookups);
     }
     return std::make_unique<RocksDBVPackIndexIterator<true, false, false>>(
         monitor, &_collection, trx, this, std::move(bounds),
-        withCache ? useCache() : nullptr, opts, readOwnWrites, format);
+        withCache ? useCache() : nullptr, opts, readOwnWrites, format,
+        chainLookups);
   }
 
   // non-unique index
@@ -2233,21 +2454,25 @@ std::unique_ptr<IndexIterator> RocksDBVPackIndex::buildIteratorFromBounds(
     if (mustCheckBounds) {
       return std::make_unique<RocksDBVPackIndexIterator<false, true, true>>(
           monitor, &_collection, trx, this, std::move(bounds),
-          withCache ? useCache() : nullptr, opts, readOwnWrites, format);
+          withCache ? useCache() : nullptr, opts, readOwnWrites, format,
+          chainLookups);
     }
     return std::make_unique<RocksDBVPackIndexIterator<false, true, false>>(
         monitor, &_collection, trx, this, std::move(bounds),
-        withCache ? useCache() : nullptr, opts, readOwnWrites, format);
+        withCache ? useCache() : nullptr, opts, readOwnWrites, format,
+        chainLookups);
   }
   // forward version
   if (mustCheckBounds) {
     return std::make_unique<RocksDBVPackIndexIterator<false, false, true>>(
         monitor, &_collection, trx, this, std::move(bounds),
-        withCache ? useCache() : nullptr, opts, readOwnWrites, format);
+        withCache ? useCache() : nullptr, opts, readOwnWrites, format,
+        chainLookups);
   }
   return std::make_unique<RocksDBVPackIndexIterator<false, false, false>>(
       monitor, &_collection, trx, this, std::move(bounds),
-      withCache ? useCache() : nullptr, opts, readOwnWrites, format);
+      withCache ? useCache() : nullptr, opts, readOwnWrites, format,
+      chainLookups);
 }
 
 // build bounds for an index range
@@ -2368,10 +2593,13 @@ std::unique_ptr<IndexIterator> RocksDBVPackIndex::iteratorForCondition(
     // into an InIterator object, which will cycle through all values of
     // the IN list and employ the lookup iterator for looking up one
     // value at a time.
+    // the IN values are sorted in index order, so the lookup iterator
+    // can move on from one value to the next without seeking every time.
     // note: the call to buildIterator may change the value of
     // isUniqueIndexIterator!
-    auto wrapped = buildIterator(monitor, trx, searchSlice.at(0), opts,
-                                 readOwnWrites, format, isUniqueIndexIterator);
+    auto wrapped =
+        buildIterator(monitor, trx, searchSlice.at(0), opts, readOwnWrites,
+                      format, isUniqueIndexIterator, /*chainLookups*/ true);
 
     return std::make_unique<RocksDBVPackIndexInIterator>(
         monitor, &_collection, trx, this, std::move(wrapped), searchSlice, opts,
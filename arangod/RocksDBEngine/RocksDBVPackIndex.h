@@ -180,6 +180,8 @@ class RocksDBVPackIndex : public RocksDBIndex {
   void refillCache(transaction::Methods& trx,
                    std::vector<std::string> const& keys) override;
 
+  std::vector<std::string> cachedKeys(std::size_t maxKeys) const override;
+
  private:
   Result insertUnique(transaction::Methods& trx, RocksDBMethods* mthds,
                       LocalDocumentId const& documentId, velocypack::Slice doc,
@@ -203,7 +205,7 @@ class RocksDBVPackIndex : public RocksDBIndex {
       ResourceMonitor& monitor, transaction::Methods* trx,
       velocypack::Slice searchValues, IndexIteratorOptions const& opts,
       ReadOwnWrites readOwnWrites, RocksDBVPackIndexSearchValueFormat format,
-      bool& isUniqueIndexIterator) const;
+      bool& isUniqueIndexIterator, bool chainLookups = false) const;
 
   // build bounds for an index range
   void buildIndexRangeBounds(transaction::Methods* trx, VPackSlice searchValues,
@@ -214,7 +216,7 @@ class RocksDBVPackIndex : public RocksDBIndex {
       ResourceMonitor& monitor, transaction::Methods* trx, bool reverse,
       IndexIteratorOptions const& opts, ReadOwnWrites readOwnWrites,
       RocksDBKeyBounds&& bounds, RocksDBVPackIndexSearchValueFormat format,
-      bool withCache) const;
+      bool withCache, bool chainLookups = false) const;
 
   /// @brief returns whether the document can be inserted into the index
   /// (or if there will be a conflict)
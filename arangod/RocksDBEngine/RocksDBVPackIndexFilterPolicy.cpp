@@ -0,0 +1,212 @@
+////////////////////////////////////////////////////////////////////////////////
+/// DISCLAIMER
+///
+/// Copyright 2014-2023 ArangoDB GmbH, Cologne, Germany
+/// Copyright 2004-2014 triAGENS GmbH, Cologne, Germany
+///
+/// Licensed under the Apache License, Version 2.0 (the "License");
+/// you may not use this file except in compliance with the License.
+/// You may obtain a copy of the License at
+///
+///     http://www.apache.org/licenses/LICENSE-2.0
+///
+/// Unless required by applicable law or agreed to in writing, software
+/// distributed under the License is distributed on an "AS IS" BASIS,
+/// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+/// See the License for the specific language governing permissions and
+/// limitations under the License.
+///
+/// Copyright holder is ArangoDB GmbH, Cologne, Germany
+///
+/// @author Jan Steemann
+////////////////////////////////////////////////////////////////////////////////
+
+#include "RocksDBEngine/RocksDBVPackIndexFilterPolicy.h"
+
+#include "Basics/debugging.h"
+#include "Basics/fasthash.h"
+#include "RocksDBEngine/RocksDBKey.h"
+
+#include <velocypack/Iterator.h>
+#include <velocypack/Slice.h>
+
+#include <cstring>
+#include <string_view>
+
+using namespace arangodb;
+
+namespace {
+
+bool isAscii(std::string_view value) noexcept {
+  for (char c : value) {
+    if (static_cast<unsigned char>(c) >= 0x80U) {
+      return false;
+    }
+  }
+  return true;
+}
+
+/// @brief hash a single index value, so that all values that are equal
+/// according to the vpack comparator produce the same hash. values
+/// for which this cannot be guaranteed cheaply only hash their type,
+/// which is safe, but makes the filter less selective for them
+uint64_t hashValue(velocypack::Slice value, uint64_t seed) noexcept {
+  if (value.isNone() || value.isNull()) {
+    return fasthash64_uint64(0x01, seed);
+  }
+  if (value.isBoolean()) {
+    return fasthash64_uint64(value.getBoolean() ? 0x03 : 0x02, seed);
+  }
+  if (value.isNumber()) {
+    // integers and doubles with the same value compare equal
+    double v = value.getNumber<double>();
+    if (v == 0.0) {
+      // turn -0.0 into 0.0
+      v = 0.0;
+    }
+    uint64_t bits;
+    memcpy(&bits, &v, sizeof(bits));
+    return fasthash64_uint64(bits, fasthash64_uint64(0x04, seed));
+  }
+  if (value.isString()) {
+    std::string_view s = value.stringView();
+    if (::isAscii(s)) {
+      return fasthash64(s.data(), s.size(), fasthash64_uint64(0x05, seed));
+    }
+    // the collation can consider non-ASCII strings with different bytes
+    // equal
+    return fasthash64_uint64(0x06, seed);
+  }
+  return fasthash64_uint64(0x07, seed);
+}
+
+class FilterBitsBuilder final : public rocksdb::FilterBitsBuilder {
+ public:
+  explicit FilterBitsBuilder(rocksdb::FilterBitsBuilder* bloom)
+      : _bloom(bloom) {}
+
+  void AddKey(rocksdb::Slice const& key) override {
+    char buffer[RocksDBVPackIndexFilterPolicy::kNormalizedKeySize];
+    RocksDBVPackIndexFilterPolicy::normalizeKey(key, &buffer[0]);
+    _bloom->AddKey(rocksdb::Slice(&buffer[0], sizeof(buffer)));
+  }
+
+#ifdef ARANGODB_ROCKSDB8
+  void AddKeyAndAlt(rocksdb::Slice const& key,
+                    rocksdb::Slice const& alt) override {
+    // only called with a prefix extractor, which this column family
+    // does not have
+    TRI_ASSERT(false);
+    AddKey(key);
+  }
+#endif
+
+  size_t EstimateEntriesAdded() override {
+    return _bloom->EstimateEntriesAdded();
+  }
+
+  rocksdb::Slice Finish(std::unique_ptr<char const[]>* buf) override {
+    return _bloom->Finish(buf);
+  }
+
+  rocksdb::Slice Finish(std::unique_ptr<char const[]>* buf,
+                        rocksdb::Status* status) override {
+    return _bloom->Finish(buf, status);
+  }
+
+  rocksdb::Status MaybePostVerify(rocksdb::Slice const& content) override {
+    return _bloom->MaybePostVerify(content);
+  }
+
+  size_t ApproximateNumEntries(size_t bytes) override {
+    return _bloom->ApproximateNumEntries(bytes);
+  }
+
+ private:
+  std::unique_ptr<rocksdb::FilterBitsBuilder> _bloom;
+};
+
+class FilterBitsReader final : public rocksdb::FilterBitsReader {
+ public:
+  explicit FilterBitsReader(rocksdb::FilterBitsReader* bloom)
+      : _bloom(bloom) {}
+
+  bool MayMatch(rocksdb::Slice const& entry) override {
+    char buffer[RocksDBVPackIndexFilterPolicy::kNormalizedKeySize];
+    RocksDBVPackIndexFilterPolicy::normalizeKey(entry, &buffer[0]);
+    return _bloom->MayMatch(rocksdb::Slice(&buffer[0], sizeof(buffer)));
+  }
+
+  void MayMatch(int numKeys, rocksdb::Slice** keys, bool* mayMatch) override {
+    for (int i = 0; i < numKeys; ++i) {
+      mayMatch[i] = MayMatch(*keys[i]);
+    }
+  }
+
+ private:
+  std::unique_ptr<rocksdb::FilterBitsReader> _bloom;
+};
+
+}  // namespace
+
+RocksDBVPackIndexFilterPolicy::RocksDBVPackIndexFilterPolicy(double bitsPerKey)
+    : _bloom(rocksdb::NewBloomFilterPolicy(bitsPerKey, false)) {}
+
+char const* RocksDBVPackIndexFilterPolicy::Name() const {
+  return "RocksDBVPackIndexFilterPolicy";
+}
+
+char const* RocksDBVPackIndexFilterPolicy::CompatibilityName() const {
+  // must differ from the name of the built-in bloom filter, so that
+  // filters of both kinds are never confused with each other. .sst files
+  // with filters of an unknown kind are read as if they had no filter
+  return Name();
+}
+
+rocksdb::FilterBitsBuilder*
+RocksDBVPackIndexFilterPolicy::GetBuilderWithContext(
+    rocksdb::FilterBuildingContext const& context) const {
+  rocksdb::FilterBitsBuilder* bloom = _bloom->GetBuilderWithContext(context);
+  if (bloom == nullptr) {
+    return nullptr;
+  }
+  return new ::FilterBitsBuilder(bloom);
+}
+
+rocksdb::FilterBitsReader* RocksDBVPackIndexFilterPolicy::GetFilterBitsReader(
+    rocksdb::Slice const& contents) const {
+  return new ::FilterBitsReader(_bloom->GetFilterBitsReader(contents));
+}
+
+void RocksDBVPackIndexFilterPolicy::normalizeKey(rocksdb::Slice key,
+                                                 char* out) noexcept {
+  constexpr std::size_t objectIdSize = RocksDBKey::objectIdSize();
+  static_assert(kNormalizedKeySize == objectIdSize + sizeof(uint64_t));
+
+  if (key.size() <= objectIdSize) {
+    memset(out, 0, kNormalizedKeySize);
+    memcpy(out, key.data(), key.size());
+    return;
+  }
+
+  // the object id is compared bytewise
+  memcpy(out, key.data(), objectIdSize);
+
+  velocypack::Slice values(reinterpret_cast<uint8_t const*>(key.data()) +
+                           objectIdSize);
+  TRI_ASSERT(values.isArray());
+  std::size_t const valuesSize = static_cast<std::size_t>(values.byteSize());
+  TRI_ASSERT(objectIdSize + valuesSize <= key.size());
+
+  uint64_t hash = 0xdeadbeef;
+  for (velocypack::Slice value : velocypack::ArrayIterator(values)) {
+    hash = ::hashValue(value, hash);
+  }
+  // the remainder (the LocalDocumentId for non-unique indexes) is compared
+  // bytewise as well
+  std::size_t const offset = objectIdSize + valuesSize;
+  if (offset < key.size()) {
+    hash = fasthash64(key.data() + offset, key.size() - offset, hash);
+  }
+  memcpy(out + objectIdSize, &hash, sizeof(hash));
+}
@@ -0,0 +1,66 @@
+////////////////////////////////////////////////////////////////////////////////
+/// DISCLAIMER
+///
+/// Copyright 2014-2023 ArangoDB GmbH, Cologne, Germany
+/// Copyright 2004-2014 triAGENS GmbH, Cologne, Germany
+///
+/// Licensed under the Apache License, Version 2.0 (the "License");
+/// you may not use this file except in compliance with the License.
+/// You may obtain a copy of the License at
+///
+///     http://www.apache.org/licenses/LICENSE-2.0
+///
+/// Unless required by applicable law or agreed to in writing, software
+/// distributed under the License is distributed on an "AS IS" BASIS,
+/// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+/// See the License for the specific language governing permissions and
+/// limitations under the License.
+///
+/// Copyright holder is ArangoDB GmbH, Cologne, Germany
+///
+/// @author Jan Steemann
+////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <rocksdb/filter_policy.h>
+#include <rocksdb/slice.h>
+
+#include <cstddef>
+#include <memory>
+
+namespace arangodb {
+
+/// @brief bloom filter policy for the persistent index column family.
+/// the column family's comparator orders index values semantically, so
+/// keys with different bytes can be equal (e.g. `1` and `1.0`). a regular
+/// bloom filter hashes the raw key bytes and would thus produce false
+/// negatives. this policy hashes a normalized form of each key instead,
+/// in which all keys that the comparator considers equal are identical.
+/// the filter is only consulted by point lookups, e.g. the uniqueness
+/// checks of unique indexes
+class RocksDBVPackIndexFilterPolicy final : public rocksdb::FilterPolicy {
+ public:
+  /// @brief size of a normalized key: 8 bytes object id + 8 bytes hash
+  static constexpr std::size_t kNormalizedKeySize = 16;
+
+  explicit RocksDBVPackIndexFilterPolicy(double bitsPerKey);
+
+  char const* Name() const override;
+  char const* CompatibilityName() const override;
+
+  rocksdb::FilterBitsBuilder* GetBuilderWithContext(
+      rocksdb::FilterBuildingContext const& context) const override;
+
+  rocksdb::FilterBitsReader* GetFilterBitsReader(
+      rocksdb::Slice const& contents) const override;
+
+  /// @brief write the normalized form of the index key into out, which
+  /// must have room for kNormalizedKeySize bytes
+  static void normalizeKey(rocksdb::Slice key, char* out) noexcept;
+
+ private:
+  std::unique_ptr<rocksdb::FilterPolicy const> _bloom;
+};
+
+}  // namespace arangodb
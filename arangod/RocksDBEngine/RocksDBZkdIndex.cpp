@@ -120,39 +120,9 @@ class RocksDBZkdIndexIterator final : public IndexIterator {
         } break;
         case IterState::CHECK_CURRENT_ITER: {
           auto const rocksKey = _iter->key();
-          auto const byteStringKey = RocksDBKey::zkdIndexValue(rocksKey);
+          auto const byteStringKey = zkdIndexValue(rocksKey);
 
-          bool foundNextZValueInBox =
-              zkd::testInBox(byteStringKey, _min, _max, _dim);
-          for (size_t numTried = 0;
-               !foundNextZValueInBox && numTried < numNextTries(); ++numTried) {
-            _iter->Next();
-            if (!_iter->Valid()) {
-              rocksutils::checkIteratorStatus(*_iter);
-              _iterState = IterState::DONE;
-              break;  // for loop
-            }
-            foundNextZValueInBox =
-                zkd::testInBox(byteStringKey, _min, _max, _dim);
-          }
-
-          if (_iterState == IterState::DONE) {
-            break;  // case CHECK_CURRENT_ITER
-          }
-
-          if (!foundNextZValueInBox) {
-            _cur = byteStringKey;
-
-            zkd::compareWithBoxInto(_cur, _min, _max, _dim, _compareResult);
-            auto const next =
-                zkd::getNextZValue(_cur, _min, _max, _compareResult);
-            if (!next) {
-              _iterState = IterState::DONE;
-            } else {
-              _cur = next.value();
-              _iterState = IterState::SEEK_ITER_TO_CUR;
-            }
-          } else {
+          if (zkd::testInBox(byteStringKey, _min, _max, _dim)) {
             auto const documentId = std::invoke([&] {
               if constexpr (isUnique) {
                 return RocksDBValue::documentId(_iter->value());
@@ -169,6 +139,36 @@ class RocksDBZkdIndexIterator final : public IndexIterator {
             } else {
               // stay in ::CHECK_CURRENT_ITER
             }
+            break;
+          }
+
+          // the key is outside of the box. compute the next z-value which
+          // is inside the box again
+          _cur = byteStringKey;
+          zkd::compareWithBoxInto(_cur, _min, _max, _dim, _compareResult);
+          auto next = zkd::getNextZValue(_cur, _min, _max, _compareResult);
+          if (!next) {
+            _iterState = IterState::DONE;
+            break;
+          }
+          _cur = std::move(next.value());
+
+          // the next z-value is often only a few keys ahead, in particular
+          // for larger boxes. moving there with Next() is a lot cheaper
+          // than a seek, so try that first. keys that are skipped this way
+          // are all outside of the box
+          _iterState = IterState::SEEK_ITER_TO_CUR;
+          for (size_t numTried = 0; numTried < numNextTries(); ++numTried) {
+            _iter->Next();
+            if (!_iter->Valid()) {
+              rocksutils::checkIteratorStatus(*_iter);
+              _iterState = IterState::DONE;
+              break;
+            }
+            if (zkdIndexValue(_iter->key()) >= zkd::byte_string_view{_cur}) {
+              _iterState = IterState::CHECK_CURRENT_ITER;
+              break;
+            }
           }
         } break;
         case IterState::DONE:
@@ -182,6 +182,14 @@ class RocksDBZkdIndexIterator final : public IndexIterator {
   }
 
  private:
+  static zkd::byte_string_view zkdIndexValue(rocksdb::Slice key) {
+    if constexpr (isUnique) {
+      return RocksDBKey::uniqueZkdIndexValue(key);
+    } else {
+      return RocksDBKey::zkdIndexValue(key);
+    }
+  }
+
   RocksDBKeyBounds _bound;
   rocksdb::Slice _upperBound;
   zkd::byte_string _cur;
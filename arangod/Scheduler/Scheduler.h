@@ -286,6 +286,18 @@ class Scheduler {
   virtual void trackEndOngoingLowPriorityTask() noexcept = 0;
 
   virtual void trackQueueTimeViolation() = 0;
+
+  /// @brief admission control for an incoming request on the lane. returns
+  /// false if the request should be rejected right away, because the lane
+  /// has reached its concurrency limit or is currently shedding load
+  /// because its queue time target is exceeded. if true is returned, the
+  /// caller must call releaseRequest() when the request is finished
+  virtual bool admitRequest(RequestLane lane) noexcept = 0;
+  virtual void releaseRequest(RequestLane lane) noexcept = 0;
+  /// @brief report the time (in seconds) an admitted request on the lane
+  /// spent waiting in the queue
+  virtual void trackRequestQueueTime(RequestLane lane,
+                                     double queueTime) noexcept = 0;
   virtual void trackQueueItemSize(std::int64_t) noexcept = 0;
 
   /// @brief returns the last stored dequeue time [ms]
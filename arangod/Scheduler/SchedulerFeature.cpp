@@ -21,9 +21,11 @@
 /// @author Dr. Frank Celler
 ////////////////////////////////////////////////////////////////////////////////
 
+#include <algorithm>
 #include <atomic>
 #include <chrono>
 #include <limits>
+#include <optional>
 #include <thread>
 
 #include "SchedulerFeature.h"
@@ -31,6 +33,7 @@
 #include "ApplicationFeatures/ApplicationServer.h"
 #include "Basics/asio_ns.h"
 #include "Basics/NumberOfCores.h"
+#include "Basics/StringUtils.h"
 #include "Basics/application-exit.h"
 #include "Basics/signals.h"
 #include "Basics/system-functions.h"
@@ -69,6 +72,24 @@ size_t defaultNumberOfThreads() {
   return result;
 }
 
+// parse a "<lane>=<value>" option value. terminates the process if the
+// value is invalid
+std::pair<arangodb::RequestLane, std::string_view> parseLaneOption(
+    std::string_view option, std::string_view value) {
+  std::optional<arangodb::RequestLane> lane;
+  auto pos = value.find('=');
+  if (pos != std::string_view::npos) {
+    lane = arangodb::RequestLaneFromName(value.substr(0, pos));
+  }
+  if (!lane.has_value() || *lane == arangodb::RequestLane::UNDEFINED) {
+    LOG_TOPIC("9d7a1", FATAL, arangodb::Logger::THREADS)
+        << "invalid value '" << value << "' for --" << option
+        << ", expecting '<lane>=<value>', e.g. 'CLIENT_AQL=10'";
+    FATAL_ERROR_EXIT();
+  }
+  return {*lane, value.substr(pos + 1)};
+}
+
 // atomic flag to track shutdown requests
 std::atomic<bool> receivedShutdownRequest{false};
 
@@ -247,6 +268,57 @@ return HTTP 503 instead of HTTP 200 when their availability API is probed.)");
       new UInt64Parameter(&_fifo1Size),
       arangodb::options::makeDefaultFlags(arangodb::options::Flags::Uncommon));
 
+  options
+      ->addOption("--server.scheduler-local-queue-size",
+                  "The number of tasks per priority that a scheduler thread "
+                  "keeps in its own local queue (0 = no local queues).",
+                  new UInt64Parameter(&_localQueueSize),
+                  arangodb::options::makeDefaultFlags(
+                      arangodb::options::Flags::Uncommon))
+      .setIntroducedIn(31200)
+      .setLongDescription(R"(Tasks that are queued by a scheduler thread
+itself, for example the continuation of an operation, are put into a local
+queue of that thread instead of into the global scheduler queues. The thread
+works on its local tasks first, which reduces contention on the global queues
+and lets related work run on the same core. Idle threads can take tasks from
+the local queues of other threads, so that local tasks are not held back by a
+busy thread. Tasks beyond the configured number go into the global queues.)");
+
+  options
+      ->addOption("--server.lane-concurrency-limit",
+                  "The maximum number of queued and executing requests on a "
+                  "request lane, specified as `<lane>=<limit>`.",
+                  new VectorParameter<StringParameter>(
+                      &_laneConcurrencyLimitOptions),
+                  arangodb::options::makeDefaultFlags(
+                      arangodb::options::Flags::Uncommon))
+      .setIntroducedIn(31200)
+      .setLongDescription(R"(Incoming requests on a request lane that has
+reached its limit are rejected right away with HTTP 503 and a `Retry-After`
+header, instead of being queued. This can be used to stop slow requests, for
+example AQL queries on the `CLIENT_AQL` lane, from occupying all scheduler
+threads while fast requests on other lanes wait. The option can be specified
+multiple times, once per lane, e.g.
+`--server.lane-concurrency-limit CLIENT_AQL=64`.)");
+
+  options
+      ->addOption("--server.lane-queue-time-target",
+                  "The target for the time (in seconds) requests on a "
+                  "request lane spend in the scheduler queue, specified as "
+                  "`<lane>=<seconds>`.",
+                  new VectorParameter<StringParameter>(
+                      &_laneQueueTimeTargetOptions),
+                  arangodb::options::makeDefaultFlags(
+                      arangodb::options::Flags::Uncommon))
+      .setIntroducedIn(31200)
+      .setLongDescription(R"(If the requests on a request lane continuously
+spend more than the target time in the scheduler queue for 100 milliseconds,
+the lane is considered overloaded. New requests on the lane are then rejected
+right away with HTTP 503 and a `Retry-After` header, until queue times drop
+below the target again. This turns overload into early rejections instead of
+timeouts. The option can be specified multiple times, once per lane, e.g.
+`--server.lane-queue-time-target CLIENT_AQL=0.5`.)");
+
   // obsolete options
   options->addObsoleteOption("--server.threads", "number of threads", true);
 
@@ -309,6 +381,18 @@ void SchedulerFeature::validateOptions(
     _fifo2Size = 1;
   }
 
+  for (auto const& it : _laneConcurrencyLimitOptions) {
+    auto [lane, value] =
+        parseLaneOption("server.lane-concurrency-limit", it);
+    _laneConcurrencyLimits[static_cast<size_t>(lane)] =
+        StringUtils::uint64(value);
+  }
+  for (auto const& it : _laneQueueTimeTargetOptions) {
+    auto [lane, value] = parseLaneOption("server.lane-queue-time-target", it);
+    _laneQueueTimeTargets[static_cast<size_t>(lane)] =
+        std::max(0.0, StringUtils::doubleDecimal(value));
+  }
+
   TRI_ASSERT(_queueSize > 0);
 }
 
@@ -335,11 +419,16 @@ void SchedulerFeature::prepare() {
   auto sched = std::make_unique<SupervisedScheduler>(
       server(), _nrMinimalThreads, _nrMaximalThreads, _queueSize, _fifo1Size,
       _fifo2Size, _fifo3Size, ongoingLowPriorityLimit,
-      _unavailabilityQueueFillGrade);
+      _unavailabilityQueueFillGrade, _localQueueSize);
 #if (_MSC_VER >= 1)
 #pragma warning(pop)
 #endif
 
+  for (size_t i = 0; i < kNumRequestLanes; ++i) {
+    sched->setLaneLimits(static_cast<RequestLane>(i),
+                         _laneConcurrencyLimits[i], _laneQueueTimeTargets[i]);
+  }
+
   SCHEDULER = sched.get();
 
   _scheduler = std::move(sched);
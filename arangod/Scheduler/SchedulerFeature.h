@@ -26,8 +26,11 @@
 #include "RestServer/arangod.h"
 #include "Scheduler/Scheduler.h"
 
+#include <array>
 #include <functional>
 #include <memory>
+#include <string>
+#include <vector>
 
 namespace arangodb {
 
@@ -65,9 +68,17 @@ class SchedulerFeature final : public ArangodFeature {
   uint64_t _fifo1Size = 4096;
   uint64_t _fifo2Size = 4096;
   uint64_t _fifo3Size = 4096;
+  uint64_t _localQueueSize = 64;
   double _ongoingLowPriorityMultiplier = 4.0;
   double _unavailabilityQueueFillGrade = 0.75;
 
+  // per-lane admission control, as specified via startup options
+  // ("<lane>=<value>"), and as parsed from them
+  std::vector<std::string> _laneConcurrencyLimitOptions;
+  std::vector<std::string> _laneQueueTimeTargetOptions;
+  std::array<uint64_t, kNumRequestLanes> _laneConcurrencyLimits{};
+  std::array<double, kNumRequestLanes> _laneQueueTimeTargets{};
+
   std::unique_ptr<Scheduler> _scheduler;
 
   struct AsioHandler;
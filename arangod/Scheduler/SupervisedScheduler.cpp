@@ -65,6 +65,16 @@ time_point lastQueueFullWarning[SupervisedScheduler::NumberOfQueues];
 int64_t fullQueueEvents[SupervisedScheduler::NumberOfQueues] = {0};
 std::mutex fullQueueWarningMutex[SupervisedScheduler::NumberOfQueues];
 
+// interval (in microseconds) for which the queue time of a request lane
+// must stay above its target before the lane starts shedding load
+constexpr int64_t laneSheddingInterval = 100'000;  // 100ms
+
+int64_t steadyClockMicros() noexcept {
+  return std::chrono::duration_cast<std::chrono::microseconds>(
+             std::chrono::steady_clock::now().time_since_epoch())
+      .count();
+}
+
 void logQueueWarningEveryNowAndThen(int64_t events, uint64_t maxQueueSize,
                                     uint64_t approxQueueLength) {
   auto const now = std::chrono::steady_clock::now();
@@ -198,12 +208,18 @@ DECLARE_COUNTER(arangodb_scheduler_threads_stopped_total,
                 "Number of scheduler threads stopped");
 DECLARE_GAUGE(arangodb_scheduler_queue_memory_usage, std::int64_t,
               "Number of bytes allocated for tasks in the scheduler queue");
+DECLARE_COUNTER(arangodb_scheduler_lane_concurrency_rejections_total,
+                "Number of requests rejected because their request lane "
+                "reached its concurrency limit");
+DECLARE_COUNTER(arangodb_scheduler_lane_queue_time_rejections_total,
+                "Number of requests rejected because the queue time target "
+                "of their request lane was exceeded");
 
 SupervisedScheduler::SupervisedScheduler(
     ArangodServer& server, uint64_t minThreads, uint64_t maxThreads,
     uint64_t maxQueueSize, uint64_t fifo1Size, uint64_t fifo2Size,
     uint64_t fifo3Size, uint64_t ongoingLowPriorityLimit,
-    double unavailabilityQueueFillGrade)
+    double unavailabilityQueueFillGrade, uint64_t localQueueSize)
     : Scheduler(server),
       _nf(server.getFeature<NetworkFeature>()),
       _sharedPRNG(server.getFeature<SharedPRNGFeature>()),
@@ -218,6 +234,8 @@ SupervisedScheduler::SupervisedScheduler(
       _maxFifoSizes{maxQueueSize, fifo1Size, fifo2Size, fifo3Size},
       _ongoingLowPriorityLimit(ongoingLowPriorityLimit),
       _unavailabilityQueueFillGrade(unavailabilityQueueFillGrade),
+      _localQueueSize(localQueueSize),
+      _numLocalItems(0),
       _numWorking(0),
       _numAwake(0),
       _metricsQueueLength(server.getFeature<metrics::MetricsFeature>().add(
@@ -254,6 +272,12 @@ SupervisedScheduler::SupervisedScheduler(
       _metricsQueueTimeViolations(
           server.getFeature<metrics::MetricsFeature>().add(
               arangodb_scheduler_queue_time_violations_total{})),
+      _metricsLaneConcurrencyRejections(
+          server.getFeature<metrics::MetricsFeature>().add(
+              arangodb_scheduler_lane_concurrency_rejections_total{})),
+      _metricsLaneQueueTimeRejections(
+          server.getFeature<metrics::MetricsFeature>().add(
+              arangodb_scheduler_lane_queue_time_rejections_total{})),
       _ongoingLowPriorityGauge(
           _server.getFeature<metrics::MetricsFeature>().add(
               arangodb_scheduler_ongoing_low_prio{})),
@@ -278,10 +302,85 @@ SupervisedScheduler::SupervisedScheduler(
 
 SupervisedScheduler::~SupervisedScheduler() = default;
 
+thread_local SupervisedScheduler::WorkerState*
+    SupervisedScheduler::_localWorkerState = nullptr;
+
 void SupervisedScheduler::trackQueueItemSize(std::int64_t x) noexcept {
   _schedulerQueueMemory += x;
 }
 
+void SupervisedScheduler::setLaneLimits(RequestLane lane,
+                                        uint64_t maxConcurrency,
+                                        double queueTimeTarget) {
+  TRI_ASSERT(static_cast<size_t>(lane) < kNumRequestLanes);
+  auto& state = _lanes[static_cast<size_t>(lane)];
+  state.maxConcurrency = maxConcurrency;
+  state.queueTimeTarget = static_cast<int64_t>(queueTimeTarget * 1'000'000.0);
+}
+
+bool SupervisedScheduler::admitRequest(RequestLane lane) noexcept {
+  TRI_ASSERT(static_cast<size_t>(lane) < kNumRequestLanes);
+  auto& state = _lanes[static_cast<size_t>(lane)];
+
+  int64_t sheddingUntil = state.sheddingUntil.load(std::memory_order_relaxed);
+  if (sheddingUntil != 0 && ::steadyClockMicros() < sheddingUntil) {
+    ++_metricsLaneQueueTimeRejections;
+    return false;
+  }
+
+  if (state.maxConcurrency > 0 &&
+      state.numAdmitted.fetch_add(1, std::memory_order_relaxed) >=
+          state.maxConcurrency) {
+    state.numAdmitted.fetch_sub(1, std::memory_order_relaxed);
+    ++_metricsLaneConcurrencyRejections;
+    return false;
+  }
+  return true;
+}
+
+void SupervisedScheduler::releaseRequest(RequestLane lane) noexcept {
+  TRI_ASSERT(static_cast<size_t>(lane) < kNumRequestLanes);
+  auto& state = _lanes[static_cast<size_t>(lane)];
+  if (state.maxConcurrency > 0) {
+    [[maybe_unused]] uint64_t old =
+        state.numAdmitted.fetch_sub(1, std::memory_order_relaxed);
+    TRI_ASSERT(old > 0);
+  }
+}
+
+void SupervisedScheduler::trackRequestQueueTime(RequestLane lane,
+                                                double queueTime) noexcept {
+  TRI_ASSERT(static_cast<size_t>(lane) < kNumRequestLanes);
+  auto& state = _lanes[static_cast<size_t>(lane)];
+  if (state.queueTimeTarget == 0) {
+    return;
+  }
+
+  // CoDel-style detection of a standing queue: a single slow dequeue is
+  // no reason to shed load, but if the queue time stays above the target
+  // for a whole interval, the lane is overloaded and new requests are
+  // rejected right away, until we see a queue time below the target again
+  // or no request exceeded the target for another interval
+  if (static_cast<int64_t>(queueTime * 1'000'000.0) < state.queueTimeTarget) {
+    state.aboveTargetSince.store(0, std::memory_order_relaxed);
+    state.sheddingUntil.store(0, std::memory_order_relaxed);
+    return;
+  }
+
+  int64_t now = ::steadyClockMicros();
+  int64_t since = state.aboveTargetSince.load(std::memory_order_relaxed);
+  if (since == 0) {
+    state.aboveTargetSince.store(now, std::memory_order_relaxed);
+  } else if (now - since >= ::laneSheddingInterval) {
+    if (state.sheddingUntil.exchange(now + ::laneSheddingInterval,
+                                     std::memory_order_relaxed) == 0) {
+      LOG_TOPIC("4f1c2", DEBUG, Logger::THREADS)
+          << "queue time target of lane " << lane
+          << " exceeded, rejecting new requests";
+    }
+  }
+}
+
 bool SupervisedScheduler::queueItem(RequestLane lane,
                                     std::unique_ptr<WorkItemBase> work,
                                     bool bounded) {
@@ -332,7 +431,11 @@ bool SupervisedScheduler::queueItem(RequestLane lane,
     return p;
   };
   try {
-    _queues[queueNo].queue.push(makePointer(work.get()));
+    // items queued by a worker thread go into the worker's local queue
+    // if possible, so that they are likely picked up by the same thread
+    if (!pushLocalItem(queueNo, makePointer(work.get()))) {
+      _queues[queueNo].queue.push(makePointer(work.get()));
+    }
   } catch (...) {
     if (bounded) {
       queue.numCountedItems.fetch_sub(1, std::memory_order_relaxed);
@@ -536,6 +639,10 @@ void SupervisedScheduler::runWorker() {
     state->_queueRetryTime_us = 0;
   }
 
+  if (_localQueueSize > 0) {
+    registerLocalWorker(*state);
+  }
+
   // inform the supervisor that this thread is alive
   {
     std::lock_guard<std::mutex> guard(_mutexSupervisor);
@@ -543,6 +650,8 @@ void SupervisedScheduler::runWorker() {
   }
   _conditionSupervisor.notify_one();
 
+  _localWorkerState = state.get();
+
   _numAwake.fetch_add(1, std::memory_order_relaxed);
   while (true) {
     try {
@@ -576,6 +685,11 @@ void SupervisedScheduler::runWorker() {
     _jobsDone.fetch_add(1, std::memory_order_release);
   }
   _numAwake.fetch_sub(1, std::memory_order_relaxed);
+
+  _localWorkerState = nullptr;
+  // hand over the items that are still in our local queues. normally this
+  // has already happened when the thread was asked to stop
+  flushLocalItems(*state);
 }
 
 void SupervisedScheduler::runSupervisor() {
@@ -701,6 +815,9 @@ bool SupervisedScheduler::sortoutLongRunningThreads() {
           std::unique_lock<std::mutex> guard2(state->_mutex);
           state->_stop = true;
         }
+        // the thread may be busy for a long time, so let other threads
+        // work on the items it has queued locally
+        flushLocalItems(*state);
 
         // Move that thread to the abandoned thread
         _abandonedWorkerStates.push_back(std::move(state));
@@ -789,7 +906,8 @@ bool SupervisedScheduler::canPullFromQueue(uint64_t queueIndex) const noexcept {
 
 std::unique_ptr<SupervisedScheduler::WorkItemBase> SupervisedScheduler::getWork(
     std::shared_ptr<WorkerState>& state) {
-  auto checkAllQueues = [this](uint64_t& maxCheckedQueue) -> WorkItemBase* {
+  auto checkAllQueues = [this,
+                         &state](uint64_t& maxCheckedQueue) -> WorkItemBase* {
     for (uint64_t i = 0; i < NumberOfQueues; ++i) {
       if (!this->canPullFromQueue(i)) {
         // if we can't pull from high prio, then we will not be able to
@@ -800,8 +918,18 @@ std::unique_ptr<SupervisedScheduler::WorkItemBase> SupervisedScheduler::getWork(
         break;
       }
       maxCheckedQueue = i;
-      WorkItemBase* res;
-      if (this->_queues[i].queue.pop(res)) {
+      // our own local queue first, then the global queue, and finally the
+      // local queues of other workers
+      WorkItemBase* res = popLocalItem(*state, i);
+      if (res == nullptr) {
+        WorkItemBase* item;
+        if (this->_queues[i].queue.pop(item)) {
+          res = item;
+        } else if (_numLocalItems.load(std::memory_order_relaxed) > 0) {
+          res = stealLocalItem(*state, i);
+        }
+      }
+      if (res != nullptr) {
         auto raw = reinterpret_cast<std::uintptr_t>(res);
         if (raw & 1) {
           // LSB is set, so this is a counted item
@@ -813,9 +941,9 @@ std::unique_ptr<SupervisedScheduler::WorkItemBase> SupervisedScheduler::getWork(
         return res;
       }
     }
-    // Please note that _queues[i].pop(res) can modify res even if it does
+    // Please note that _queues[i].pop(item) can modify item even if it does
     // not return `true`. Therefore it is crucial that we return nullptr
-    // here and not res! We have been there and do not want to go back!
+    // here and not item! We have been there and do not want to go back!
     return nullptr;
   };
 
@@ -967,6 +1095,7 @@ void SupervisedScheduler::stopOneThread() {
     // _stop is set under the mutex, then the worker thread is notified.
   }
   state->_conditionWork.notify_one();
+  flushLocalItems(*state);
 
   ++_metricsThreadsStopped;
 
@@ -995,10 +1124,92 @@ SupervisedScheduler::WorkerState::WorkerState(SupervisedScheduler& scheduler)
       _ready(false),
       _lastJobStarted(clock::now()),
       _thread(std::make_unique<SupervisedSchedulerWorkerThread>(
-          scheduler._server, scheduler)) {}
+          scheduler._server, scheduler)),
+      _scheduler(scheduler),
+      _numLocalItems(0),
+      _acceptsLocalItems(true) {}
 
 bool SupervisedScheduler::WorkerState::start() { return _thread->start(); }
 
+bool SupervisedScheduler::pushLocalItem(uint64_t queueIdx,
+                                        WorkItemBase* item) {
+  WorkerState* state = _localWorkerState;
+  if (_localQueueSize == 0 || state == nullptr || &state->_scheduler != this) {
+    return false;
+  }
+
+  std::lock_guard<std::mutex> guard(state->_localMutex);
+  auto& queue = state->_localQueues[queueIdx];
+  if (!state->_acceptsLocalItems || queue.size() >= _localQueueSize) {
+    return false;
+  }
+  queue.push_back(item);
+  state->_numLocalItems.fetch_add(1, std::memory_order_relaxed);
+  _numLocalItems.fetch_add(1, std::memory_order_relaxed);
+  return true;
+}
+
+SupervisedScheduler::WorkItemBase* SupervisedScheduler::popLocalItem(
+    WorkerState& state, uint64_t queueIdx) {
+  if (state._numLocalItems.load(std::memory_order_relaxed) == 0) {
+    return nullptr;
+  }
+
+  std::lock_guard<std::mutex> guard(state._localMutex);
+  auto& queue = state._localQueues[queueIdx];
+  if (queue.empty()) {
+    return nullptr;
+  }
+  WorkItemBase* item = queue.front();
+  queue.pop_front();
+  state._numLocalItems.fetch_sub(1, std::memory_order_relaxed);
+  _numLocalItems.fetch_sub(1, std::memory_order_relaxed);
+  return item;
+}
+
+SupervisedScheduler::WorkItemBase* SupervisedScheduler::stealLocalItem(
+    WorkerState& state, uint64_t queueIdx) {
+  std::lock_guard<std::mutex> guard(_localWorkersMutex);
+  for (auto* other : _localWorkers) {
+    if (other == &state) {
+      continue;
+    }
+    WorkItemBase* item = popLocalItem(*other, queueIdx);
+    if (item != nullptr) {
+      return item;
+    }
+  }
+  return nullptr;
+}
+
+void SupervisedScheduler::registerLocalWorker(WorkerState& state) {
+  std::lock_guard<std::mutex> guard(_localWorkersMutex);
+  _localWorkers.push_back(&state);
+}
+
+void SupervisedScheduler::flushLocalItems(WorkerState& state) {
+  {
+    // other workers must not steal from us anymore
+    std::lock_guard<std::mutex> guard(_localWorkersMutex);
+    std::erase(_localWorkers, &state);
+  }
+
+  std::lock_guard<std::mutex> guard(state._localMutex);
+  state._acceptsLocalItems = false;
+
+  for (uint64_t i = 0; i < NumberOfQueues; ++i) {
+    auto& queue = state._localQueues[i];
+    while (!queue.empty()) {
+      // the items have already been counted when they were queued, so we
+      // can simply move them over
+      _queues[i].queue.push(queue.front());
+      queue.pop_front();
+      state._numLocalItems.fetch_sub(1, std::memory_order_relaxed);
+      _numLocalItems.fetch_sub(1, std::memory_order_relaxed);
+    }
+  }
+}
+
 // ---------------------------------------------------------------------------
 // Statistics Stuff
 // ---------------------------------------------------------------------------
@@ -26,9 +26,11 @@
 
 #include <array>
 #include <condition_variable>
+#include <deque>
 #include <functional>
 #include <list>
 #include <mutex>
+#include <vector>
 
 #include <boost/lockfree/queue.hpp>
 
@@ -47,7 +49,8 @@ class SupervisedScheduler final : public Scheduler {
                       uint64_t maxThreads, uint64_t maxQueueSize,
                       uint64_t fifo1Size, uint64_t fifo2Size,
                       uint64_t fifo3Size, uint64_t ongoingLowPriorityLimit,
-                      double unavailabilityQueueFillGrade);
+                      double unavailabilityQueueFillGrade,
+                      uint64_t localQueueSize);
   ~SupervisedScheduler() final;
 
   bool start() override;
@@ -63,6 +66,19 @@ class SupervisedScheduler final : public Scheduler {
   void trackQueueTimeViolation() noexcept override;
   void trackQueueItemSize(std::int64_t) noexcept override;
 
+  bool admitRequest(RequestLane lane) noexcept override;
+  void releaseRequest(RequestLane lane) noexcept override;
+  void trackRequestQueueTime(RequestLane lane,
+                             double queueTime) noexcept override;
+
+  /// @brief set the admission control limits for a lane. must be called
+  /// before the scheduler is started. maxConcurrency is the maximum number
+  /// of admitted requests (queued or executing) on the lane, 0 = unlimited.
+  /// queueTimeTarget is the time (in seconds) requests on the lane should
+  /// spend in the queue at most, 0 = no target
+  void setLaneLimits(RequestLane lane, uint64_t maxConcurrency,
+                     double queueTimeTarget);
+
   /// @brief returns the last stored dequeue time [ms]
   uint64_t getLastLowPriorityDequeueTime() const noexcept override;
 
@@ -131,6 +147,24 @@ class SupervisedScheduler final : public Scheduler {
     std::mutex _mutex;
     std::condition_variable _conditionWork;
 
+    // the scheduler this worker belongs to
+    SupervisedScheduler const& _scheduler;
+    // queues (one per priority) for items that were queued by this worker
+    // thread itself. the worker takes items from its local queues before
+    // it looks at the global queues, so that follow-up work tends to run on
+    // the thread that produced it. other workers can steal items from the
+    // local queues. _localQueues and _acceptsLocalItems are protected by
+    // _localMutex. as _localMutex does not protect anything else, it can be
+    // acquired while holding any other mutex, but no other mutex must be
+    // acquired while holding it.
+    std::mutex _localMutex;
+    std::array<std::deque<WorkItemBase*>, NumberOfQueues> _localQueues;
+    // total number of items in _localQueues
+    std::atomic<uint64_t> _numLocalItems;
+    // set to false when the worker is about to be stopped. from then on,
+    // items must go to the global queues
+    bool _acceptsLocalItems;
+
     // initialize with harmless defaults: spin once, sleep forever
     explicit WorkerState(SupervisedScheduler& scheduler);
     WorkerState(WorkerState const&) = delete;
@@ -141,6 +175,20 @@ class SupervisedScheduler final : public Scheduler {
   };
 
   std::unique_ptr<WorkItemBase> getWork(std::shared_ptr<WorkerState>& state);
+
+  // push an item into the local queue of the current worker thread. returns
+  // false if the current thread is not a worker thread of this scheduler or
+  // if its local queue is full
+  bool pushLocalItem(uint64_t queueIdx, WorkItemBase* item);
+  // take an item from the worker's own local queue
+  WorkItemBase* popLocalItem(WorkerState& state, uint64_t queueIdx);
+  // take an item from the local queue of another worker
+  WorkItemBase* stealLocalItem(WorkerState& state, uint64_t queueIdx);
+  // make the worker's local queues visible to other workers
+  void registerLocalWorker(WorkerState& state);
+  // move all items from the worker's local queues to the global queues, and
+  // stop accepting new local items for the worker
+  void flushLocalItems(WorkerState& state);
   void startOneThread();
   void stopOneThread();
 
@@ -191,6 +239,38 @@ class SupervisedScheduler final : public Scheduler {
   /// the server is considered unavailable (because of overload)
   double const _unavailabilityQueueFillGrade;
 
+  /// @brief maximum number of items per worker and priority that are
+  /// kept in the worker's local queue. 0 = local queues are disabled
+  uint64_t const _localQueueSize;
+  /// @brief total number of items in all local queues. only used as a hint
+  /// for idle workers whether it is worth trying to steal work
+  alignas(64) std::atomic<uint64_t> _numLocalItems;
+
+  // admission control state of a request lane. all points in time are in
+  // microseconds of the steady clock
+  struct LaneState {
+    uint64_t maxConcurrency = 0;
+    // queue time target in microseconds, 0 = no target
+    int64_t queueTimeTarget = 0;
+    // number of admitted requests. only maintained if maxConcurrency > 0
+    std::atomic<uint64_t> numAdmitted{0};
+    // since when the queue time has been continuously above the target,
+    // 0 if it is below the target
+    std::atomic<int64_t> aboveTargetSince{0};
+    // new requests on the lane are rejected until this point in time
+    std::atomic<int64_t> sheddingUntil{0};
+  };
+  std::array<LaneState, kNumRequestLanes> _lanes;
+
+  /// @brief workers whose local queues can be stolen from. protected by
+  /// _localWorkersMutex. the lock order is _mutex, then the worker mutex,
+  /// then _localWorkersMutex, then the worker's _localMutex
+  std::mutex _localWorkersMutex;
+  std::vector<WorkerState*> _localWorkers;
+
+  /// @brief state of the worker running on the current thread, if any
+  static thread_local WorkerState* _localWorkerState;
+
   std::list<std::shared_ptr<WorkerState>> _workerStates;
   std::list<std::shared_ptr<WorkerState>> _abandonedWorkerStates;
   std::atomic<uint64_t> _numWorking;  // Number of threads actually working
@@ -224,6 +304,8 @@ class SupervisedScheduler final : public Scheduler {
   metrics::Counter& _metricsThreadsStopped;
   metrics::Counter& _metricsQueueFull;
   metrics::Counter& _metricsQueueTimeViolations;
+  metrics::Counter& _metricsLaneConcurrencyRejections;
+  metrics::Counter& _metricsLaneQueueTimeRejections;
   metrics::Gauge<uint64_t>& _ongoingLowPriorityGauge;
 
   /// @brief amount of time it took for the last low prio item to be dequeued
@@ -61,6 +61,12 @@ DECLARE_COUNTER(arangodb_read_transactions_total,
                 "Number of read transactions");
 DECLARE_COUNTER(arangodb_dirty_read_transactions_total,
                 "Number of read transactions which can do dirty reads");
+DECLARE_COUNTER(arangodb_optimistic_transactions_commits_total,
+                "Number of commit attempts of optimistic transactions");
+DECLARE_COUNTER(
+    arangodb_optimistic_transactions_conflicts_total,
+    "Number of write-write conflicts detected when committing optimistic "
+    "transactions");
 
 DECLARE_COUNTER(arangodb_collection_truncates_total,
                 "Total number of collection truncate operations (excl. "
@@ -97,6 +103,10 @@ TransactionStatistics::TransactionStatistics(metrics::MetricsFeature& metrics)
       _readTransactions(_metrics.add(arangodb_read_transactions_total{})),
       _dirtyReadTransactions(
           _metrics.add(arangodb_dirty_read_transactions_total{})),
+      _optimisticCommits(
+          _metrics.add(arangodb_optimistic_transactions_commits_total{})),
+      _optimisticConflicts(
+          _metrics.add(arangodb_optimistic_transactions_conflicts_total{})),
       _exclusiveLockTimeouts(
           _metrics.add(arangodb_collection_lock_timeouts_exclusive_total{})),
       _writeLockTimeouts(
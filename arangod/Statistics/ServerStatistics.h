@@ -48,6 +48,11 @@ struct TransactionStatistics {
   metrics::Counter& _intermediateCommits;
   metrics::Counter& _readTransactions;
   metrics::Counter& _dirtyReadTransactions;
+  // total number of commits of optimistic transactions
+  metrics::Counter& _optimisticCommits;
+  // total number of write-write conflicts of optimistic transactions that
+  // were detected at commit time
+  metrics::Counter& _optimisticConflicts;
 
   // total number of lock timeouts for exclusive locks
   metrics::Counter& _exclusiveLockTimeouts;
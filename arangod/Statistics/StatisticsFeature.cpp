@@ -609,6 +609,7 @@ StatisticsFeature::StatisticsFeature(Server& server)
       _statisticsHistory(true),
       _statisticsHistoryTouched(false),
       _statisticsAllDatabases(true),
+      _statisticsHistoryInterval(10),
       _descriptions(server) {
   setOptional(true);
   startsAfter<AqlFeaturePhase>();
@@ -706,6 +707,25 @@ This is less intrusive than setting the `--server.statistics` option to
               arangodb::options::Flags::DefaultNoComponents,
               arangodb::options::Flags::OnCoordinator))
       .setIntroducedIn(30800);
+
+  options
+      ->addOption(
+          "--server.statistics-history-interval",
+          "The interval (in seconds) for storing statistics in the database.",
+          new UInt64Parameter(&_statisticsHistoryInterval, /*base*/ 1,
+                              /*minValue*/ 10, /*maxValue*/ 300),
+          arangodb::options::makeFlags(
+              arangodb::options::Flags::Uncommon,
+              arangodb::options::Flags::DefaultNoComponents,
+              arangodb::options::Flags::OnCoordinator,
+              arangodb::options::Flags::OnSingle))
+      .setIntroducedIn(31200)
+      .setLongDescription(R"(If `--server.statistics-history` is enabled,
+the server stores its raw and per-second statistics in the `_statisticsRaw` and
+`_statistics` system collections in this interval. Increasing the interval
+reduces the write load caused by statistics, at the expense of a coarser
+resolution of the statistics in the web interface's dashboard. The 15-minute
+averages in `_statistics15` are not affected.)");
 }
 
 void StatisticsFeature::validateOptions(
@@ -768,7 +788,8 @@ void StatisticsFeature::start() {
   }
 
   if (_statisticsHistory) {
-    _statisticsWorker = std::make_unique<StatisticsWorker>(*vocbase);
+    _statisticsWorker = std::make_unique<StatisticsWorker>(
+        *vocbase, _statisticsHistoryInterval);
 
     if (!_statisticsWorker->start()) {
       LOG_TOPIC("6ecdc", FATAL, arangodb::Logger::STATISTICS)
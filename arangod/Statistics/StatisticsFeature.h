@@ -122,6 +122,7 @@ class StatisticsFeature final : public ArangodFeature {
   bool _statisticsHistory;
   bool _statisticsHistoryTouched;
   bool _statisticsAllDatabases;
+  uint64_t _statisticsHistoryInterval;
 
   stats::Descriptions _descriptions;
   std::unique_ptr<Thread> _statisticsThread;
@@ -92,8 +92,9 @@ double extractNumber(VPackSlice slice, char const* attribute) {
 using namespace arangodb;
 using namespace arangodb::statistics;
 
-StatisticsWorker::StatisticsWorker(TRI_vocbase_t& vocbase)
+StatisticsWorker::StatisticsWorker(TRI_vocbase_t& vocbase, uint64_t interval)
     : ServerThread<ArangodServer>(vocbase.server(), "StatisticsWorker"),
+      _interval(interval),
       _gcTask(GC_STATS),
       _vocbase(vocbase) {
   _bytesSentDistribution.openArray();
@@ -207,7 +208,7 @@ void StatisticsWorker::historian() {
     // iteration
     if (_lastStoredValue.slice().isNone()) {
       auto prevRawBuilder = lastEntry(StaticStrings::StatisticsRawCollection,
-                                      now - 2.0 * INTERVAL);
+                                      now - 2.0 * _interval);
 
       VPackSlice prevRaw = prevRawBuilder->slice();
       if (prevRaw.isArray() && prevRaw.length()) {
@@ -581,7 +582,7 @@ void StatisticsWorker::computePerSeconds(VPackBuilder& result,
   result.clear();
   result.openObject();
 
-  if (prev.get("time").getNumber<double>() + INTERVAL * 1.5 <
+  if (prev.get("time").getNumber<double>() + _interval * 1.5 <
       current.get("time").getNumber<double>()) {
     result.close();
     return;
@@ -1130,9 +1131,9 @@ void StatisticsWorker::run() {
   // if we have multiple servers in the cluster, we don't want them
   // to execute their statistics insert requests all at the same time.
   // we use this term to add a bit of variance
-  TRI_ASSERT(STATISTICS_INTERVAL > 1);
-  uint64_t const ourTerm = RandomGenerator::interval(STATISTICS_INTERVAL - 1);
-  TRI_ASSERT(ourTerm < STATISTICS_INTERVAL);
+  TRI_ASSERT(_interval > 1);
+  uint64_t const ourTerm = RandomGenerator::interval(_interval - 1);
+  TRI_ASSERT(ourTerm < _interval);
 
   uint64_t seconds = 0;
   while (!isStopping()) {
@@ -1144,8 +1145,8 @@ void StatisticsWorker::run() {
 
     seconds++;
     try {
-      if (seconds % STATISTICS_INTERVAL == ourTerm) {
-        // new stats are produced every 10 seconds
+      if (seconds % _interval == ourTerm) {
+        // new stats are produced every 10 seconds by default
         historian();
       }
 
@@ -37,7 +37,7 @@ namespace arangodb {
 
 class StatisticsWorker final : public ServerThread<ArangodServer> {
  public:
-  explicit StatisticsWorker(TRI_vocbase_t& vocbase);
+  StatisticsWorker(TRI_vocbase_t& vocbase, uint64_t interval);
   ~StatisticsWorker() { shutdown(); }
 
   void run() override;
@@ -72,10 +72,11 @@ class StatisticsWorker final : public ServerThread<ArangodServer> {
   // save one statistics object
   void saveSlice(velocypack::Slice slice, std::string const& collection) const;
 
-  static constexpr uint64_t STATISTICS_INTERVAL = 10;    // 10 secs
   static constexpr uint64_t GC_INTERVAL = 8 * 60;        //  8 mins
   static constexpr uint64_t HISTORY_INTERVAL = 15 * 60;  // 15 mins
-  static constexpr double INTERVAL = 10.0;               // 10 secs
+
+  // interval (in seconds) for storing raw and per-second statistics
+  uint64_t const _interval;
 
   enum GarbageCollectionTask { GC_STATS, GC_STATS_RAW, GC_STATS_15 };
 
@@ -159,6 +159,19 @@ bool PhysicalCollection::hasDocuments() {
       "hasDocuments not implemented for this engine");
 }
 
+Result PhysicalCollection::readMany(transaction::Methods* trx,
+                                    std::span<LocalDocumentId const> tokens,
+                                    IndexIterator::DocumentCallback const& cb,
+                                    ReadOwnWrites readOwnWrites) const {
+  for (auto const& token : tokens) {
+    Result res = read(trx, token, cb, readOwnWrites);
+    if (res.fail() && !res.is(TRI_ERROR_ARANGO_DOCUMENT_NOT_FOUND)) {
+      return res;
+    }
+  }
+  return {};
+}
+
 /// @brief Find index by definition
 /*static*/ std::shared_ptr<Index> PhysicalCollection::findIndex(
     velocypack::Slice info, IndexContainerType const& indexes) {
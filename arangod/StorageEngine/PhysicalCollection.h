@@ -38,6 +38,7 @@
 #include <functional>
 #include <memory>
 #include <set>
+#include <span>
 #include <string>
 #include <string_view>
 #include <type_traits>
@@ -207,6 +208,15 @@ class PhysicalCollection {
                       IndexIterator::DocumentCallback const& cb,
                       ReadOwnWrites readOwnWrites) const = 0;
 
+  /// @brief read multiple documents at once. the callback is invoked for
+  /// every document found, in the order of the given document ids.
+  /// documents that cannot be found are skipped. the default implementation
+  /// reads the documents one by one
+  virtual Result readMany(transaction::Methods* trx,
+                          std::span<LocalDocumentId const> tokens,
+                          IndexIterator::DocumentCallback const& cb,
+                          ReadOwnWrites readOwnWrites) const;
+
   virtual Result lookupDocument(transaction::Methods& trx,
                                 LocalDocumentId token,
                                 velocypack::Builder& builder, bool readCache,
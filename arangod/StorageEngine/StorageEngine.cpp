@@ -81,6 +81,9 @@ void StorageEngine::scheduleFullIndexRefill(std::string const& database,
   TRI_ASSERT(false);
 }
 
+void StorageEngine::scheduleBlockCacheWarmup(std::string const& database,
+                                             std::string const& collection) {}
+
 void StorageEngine::syncIndexCaches() {}
 
 IndexFactory const& StorageEngine::indexFactory() const {
@@ -367,6 +367,11 @@ class StorageEngine : public ArangodFeature {
                                        std::string const& collection,
                                        IndexId iid);
 
+  // load the documents and index entries of a collection into the storage
+  // engine's block cache, if the engine has one and this is enabled
+  virtual void scheduleBlockCacheWarmup(std::string const& database,
+                                        std::string const& collection);
+
   virtual bool autoRefillIndexCaches() const = 0;
   virtual bool autoRefillIndexCachesOnFollowers() const = 0;
   virtual void syncIndexCaches();
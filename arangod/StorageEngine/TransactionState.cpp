@@ -31,11 +31,14 @@
 #include "Basics/overload.h"
 #include "Cluster/ClusterFeature.h"
 #include "Cluster/ClusterInfo.h"
+#include "Graph/Cache/GraphSnapshotCache.h"
 #include "Logger/LogMacros.h"
 #include "Logger/Logger.h"
 #include "Logger/LoggerStream.h"
 #include "Metrics/Counter.h"
 #include "Metrics/MetricsFeature.h"
+#include "Network/NetworkFeature.h"
+#include "Network/ServerLatencyTracker.h"
 #include "Statistics/ServerStatistics.h"
 #include "StorageEngine/EngineSelectorFeature.h"
 #include "StorageEngine/StorageEngine.h"
@@ -414,7 +417,7 @@ Result TransactionState::checkCollectionPermission(
 
 /// @brief clear the query cache for all collections that were modified by
 /// the transaction
-void TransactionState::clearQueryCache() const {
+void TransactionState::clearQueryCache(bool committed) const {
   RECURSIVE_READ_LOCKER(_collectionsLock, _collectionsLockOwner);
   if (_collections.empty()) {
     return;
@@ -434,12 +437,18 @@ void TransactionState::clearQueryCache() const {
     }
 
     if (!collections.empty()) {
-      arangodb::aql::QueryCache::instance()->invalidate(&_vocbase, collections);
+      arangodb::aql::QueryCache::instance()->invalidate(
+          &_vocbase, collections, /*dataModification*/ committed);
+      if (committed) {
+        // graph snapshots of the modified collections are outdated now
+        graph::GraphSnapshotCache::instance().invalidate(collections);
+      }
     }
   } catch (...) {
     // in case something goes wrong, we have to remove all queries from the
     // cache
     arangodb::aql::QueryCache::instance()->invalidate(&_vocbase);
+    graph::GraphSnapshotCache::instance().invalidateAll();
   }
 }
 
@@ -526,12 +535,79 @@ void TransactionState::chooseReplicasNolock(
   auto& cf = _vocbase.server().getFeature<ClusterFeature>();
   auto& ci = cf.clusterInfo();
 #ifdef USE_ENTERPRISE
+  auto& nf = _vocbase.server().getFeature<NetworkFeature>();
+  if (nf.adaptiveReplicaSelection() &&
+      chooseFastestReplicasNolock(ci, nf.latencyTracker(), shards)) {
+    return;
+  }
   ci.getResponsibleServersReadFromFollower(shards, *_chosenReplicas);
 #else
   *_chosenReplicas = ci.getResponsibleServers(shards);
 #endif
 }
 
+bool TransactionState::chooseFastestReplicasNolock(
+    ClusterInfo& ci, network::ServerLatencyTracker const& tracker,
+    containers::FlatHashSet<ShardID> const& shards) {
+  TRI_ASSERT(_chosenReplicas != nullptr);
+  // collect the choices first, so that nothing is changed if we have to
+  // fall back to the default selection
+  containers::FlatHashMap<ShardID, ServerID> choices;
+  auto lookup = [&](ShardID const& shard) -> ServerID const* {
+    if (auto it = _chosenReplicas->find(shard); it != _chosenReplicas->end()) {
+      return &it->second;
+    }
+    if (auto it = choices.find(shard); it != choices.end()) {
+      return &it->second;
+    }
+    return nullptr;
+  };
+
+  for (auto const& shard : shards) {
+    if (lookup(shard) != nullptr) {
+      continue;
+    }
+    auto [groupLeader, group] = ci.getShardGroup(shard);
+    ServerID server;
+    if (auto const* chosen = lookup(groupLeader); chosen != nullptr) {
+      server = *chosen;
+    } else {
+      // only servers which are in sync for all shards of the group can be
+      // used
+      std::vector<ServerID> candidates;
+      for (std::size_t i = 0; i < group.size(); ++i) {
+        auto servers = ci.getResponsibleServer(group[i]);
+        if (servers->empty()) {
+          return false;
+        }
+        if (i == 0) {
+          for (auto const& s : *servers) {
+            candidates.emplace_back(s);
+          }
+        } else {
+          std::erase_if(candidates, [&](ServerID const& candidate) {
+            return std::none_of(servers->begin(), servers->end(),
+                                [&](auto const& s) {
+                                  return std::string_view{s} == candidate;
+                                });
+          });
+        }
+      }
+      if (candidates.empty()) {
+        return false;
+      }
+      server = candidates[tracker.chooseFastest(candidates)];
+      choices.try_emplace(groupLeader, server);
+    }
+    choices.try_emplace(shard, std::move(server));
+  }
+
+  for (auto& [shard, server] : choices) {
+    _chosenReplicas->try_emplace(shard, std::move(server));
+  }
+  return true;
+}
+
 void TransactionState::chooseReplicas(
     containers::FlatHashSet<ShardID> const& shards) {
   std::lock_guard guard{_replicaMutex};
@@ -63,11 +63,15 @@ struct TRI_vocbase_t;
 
 namespace arangodb {
 
+namespace network {
+class ServerLatencyTracker;
+}  // namespace network
 namespace transaction {
 class Methods;
 struct Options;
 }  // namespace transaction
 
+class ClusterInfo;
 class TransactionCollection;
 struct TransactionStatistics;
 
@@ -342,8 +346,9 @@ class TransactionState : public std::enable_shared_from_this<TransactionState> {
       DataSourceId cid, AccessMode::Type accessType) = 0;
 
   /// @brief clear the query cache for all collections that were modified by
-  /// the transaction
-  void clearQueryCache() const;
+  /// the transaction. `committed` must be true if the modifications were
+  /// committed, so that cache entries may be kept for stale reads
+  void clearQueryCache(bool committed) const;
 
 #ifdef ARANGODB_USE_GOOGLE_TESTS
   // reset the internal Transaction ID to none.
@@ -362,6 +367,14 @@ class TransactionState : public std::enable_shared_from_this<TransactionState> {
   /// called from other, public methods in this class.
   void chooseReplicasNolock(containers::FlatHashSet<ShardID> const& shards);
 
+  /// @brief choose the replicas with the lowest observed latency, following
+  /// the same principle for shard groups as described at _chosenReplicas.
+  /// returns false without changing anything if no choice can be made for
+  /// some shard, in which case the default selection has to be used
+  bool chooseFastestReplicasNolock(
+      ClusterInfo& ci, network::ServerLatencyTracker const& tracker,
+      containers::FlatHashSet<ShardID> const& shards);
+
   template<typename Callbacks>
   void applyCallbackImpl(Callbacks& callbacks) noexcept {
     for (auto& callback : callbacks) {
@@ -555,6 +555,11 @@ Result transaction::helpers::mergeObjectsForUpdate(
   }
 
   containers::FlatHashSet<std::string_view> keysWritten;
+  // only track the written attributes if the computed values need them
+  bool const trackKeysWritten =
+      batchOptions.computedValues != nullptr &&
+      batchOptions.computedValues->mustTrackKeysWritten(
+          ComputeValuesOn::kUpdate);
 
   // add other attributes after the system attributes
   {
@@ -573,7 +578,7 @@ Result transaction::helpers::mergeObjectsForUpdate(
       if (found == newValues.end()) {
         // use old value
         b->addUnchecked(key, current.value);
-        if (batchOptions.computedValues != nullptr) {
+        if (trackKeysWritten) {
           keysWritten.emplace(key);
         }
       } else if (options.mergeObjects && current.value.isObject() &&
@@ -584,7 +589,7 @@ Result transaction::helpers::mergeObjectsForUpdate(
           b->add(VPackValue(key, VPackValueType::String));
           VPackCollection::merge(*b, current.value, value, true,
                                  !options.keepNull);
-          if (batchOptions.computedValues != nullptr) {
+          if (trackKeysWritten) {
             keysWritten.emplace(key);
           }
         }
@@ -595,7 +600,7 @@ Result transaction::helpers::mergeObjectsForUpdate(
         auto& value = (*found).second;
         if (options.keepNull || (!value.isNone() && !value.isNull())) {
           b->addUnchecked(key, value);
-          if (batchOptions.computedValues != nullptr) {
+          if (trackKeysWritten) {
             keysWritten.emplace(key);
           }
         }
@@ -622,7 +627,7 @@ Result transaction::helpers::mergeObjectsForUpdate(
       b->addUnchecked(it.first, s);
     }
 
-    if (batchOptions.computedValues != nullptr) {
+    if (trackKeysWritten) {
       keysWritten.emplace(it.first);
     }
   }
@@ -721,6 +726,11 @@ Result transaction::helpers::newObjectForInsert(
   }
 
   containers::FlatHashSet<std::string_view> keysWritten;
+  // only track the written attributes if the computed values need them
+  bool const trackKeysWritten =
+      batchOptions.computedValues != nullptr &&
+      batchOptions.computedValues->mustTrackKeysWritten(
+          ComputeValuesOn::kInsert);
 
   // add other attributes after the system attributes
   VPackObjectIterator it(value, true);
@@ -732,7 +742,7 @@ Result transaction::helpers::newObjectForInsert(
          key != StaticStrings::RevString && key != StaticStrings::FromString &&
          key != StaticStrings::ToString)) {
       b->add(key, it.value());
-      if (batchOptions.computedValues != nullptr) {
+      if (trackKeysWritten) {
         // track which attributes we have produced so that they are not
         // added again by the computed attributes later.
         keysWritten.emplace(key);
@@ -822,6 +832,11 @@ Result transaction::helpers::newObjectForReplace(
   }
 
   containers::FlatHashSet<std::string_view> keysWritten;
+  // only track the written attributes if the computed values need them
+  bool const trackKeysWritten =
+      batchOptions.computedValues != nullptr &&
+      batchOptions.computedValues->mustTrackKeysWritten(
+          ComputeValuesOn::kReplace);
 
   // add other attributes after the system attributes
   VPackObjectIterator it(newValue, true);
@@ -834,7 +849,7 @@ Result transaction::helpers::newObjectForReplace(
          key != StaticStrings::RevString && key != StaticStrings::FromString &&
          key != StaticStrings::ToString)) {
       b->add(key, it.value());
-      if (batchOptions.computedValues != nullptr) {
+      if (trackKeysWritten) {
         // track which attributes we have produced so that they are not
         // added again by the computed attributes later.
         keysWritten.emplace(key);
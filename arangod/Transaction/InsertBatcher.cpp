@@ -0,0 +1,203 @@
+////////////////////////////////////////////////////////////////////////////////
+/// DISCLAIMER
+///
+/// Copyright 2014-2023 ArangoDB GmbH, Cologne, Germany
+/// Copyright 2004-2014 triAGENS GmbH, Cologne, Germany
+///
+/// Licensed under the Apache License, Version 2.0 (the "License");
+/// you may not use this file except in compliance with the License.
+/// You may obtain a copy of the License at
+///
+///     http://www.apache.org/licenses/LICENSE-2.0
+///
+/// Unless required by applicable law or agreed to in writing, software
+/// distributed under the License is distributed on an "AS IS" BASIS,
+/// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+/// See the License for the specific language governing permissions and
+/// limitations under the License.
+///
+/// Copyright holder is ArangoDB GmbH, Cologne, Germany
+///
+/// @author Jan Steemann
+////////////////////////////////////////////////////////////////////////////////
+
+#include "InsertBatcher.h"
+
+#include "Basics/Exceptions.h"
+#include "Basics/StaticStrings.h"
+#include "Basics/debugging.h"
+#include "Transaction/StandaloneContext.h"
+#include "Utils/ExecContext.h"
+#include "Utils/OperationOptions.h"
+#include "Utils/SingleCollectionTransaction.h"
+#include "VocBase/LogicalCollection.h"
+#include "VocBase/vocbase.h"
+
+#include <velocypack/Builder.h>
+#include <velocypack/Iterator.h>
+
+#include <algorithm>
+
+using namespace arangodb;
+using namespace arangodb::transaction;
+
+InsertBatcher::InsertBatcher(std::size_t maxBatchSize)
+    : _maxBatchSize(std::max<std::size_t>(1, maxBatchSize)) {}
+
+OperationResult InsertBatcher::insert(TRI_vocbase_t& vocbase,
+                                      LogicalCollection const& collection,
+                                      velocypack::Slice document,
+                                      OperationOptions const& options) {
+  TRI_ASSERT(document.isObject());
+  TRI_ASSERT(!options.returnNew && !options.returnOld);
+  TRI_ASSERT(options.overwriteMode == OperationOptions::OverwriteMode::None);
+
+  // the transaction of a batch is executed with the privileges of its
+  // leader, so we only combine inserts of the same user
+  std::string key = std::to_string(vocbase.id());
+  key.push_back('/');
+  key.append(std::to_string(collection.id().id()));
+  key.push_back('/');
+  key.push_back(options.waitForSync ? '1' : '0');
+  key.push_back('/');
+  key.append(ExecContext::current().user());
+
+  auto group = acquireGroup(key);
+
+  Entry entry{document, options, std::nullopt};
+  {
+    std::unique_lock<std::mutex> lock(group->mutex);
+    group->queue.push_back(&entry);
+
+    while (!entry.result.has_value()) {
+      if (group->leaderActive) {
+        // some other caller is currently committing. our document may
+        // or may not be part of its batch
+        group->cv.wait(lock);
+        continue;
+      }
+
+      // become the leader and commit everything that is queued
+      group->leaderActive = true;
+      std::size_t n = std::min(group->queue.size(), _maxBatchSize);
+      std::vector<Entry*> batch(group->queue.begin(),
+                                group->queue.begin() + n);
+      group->queue.erase(group->queue.begin(), group->queue.begin() + n);
+      lock.unlock();
+
+      auto results = commitBatch(vocbase, collection, batch);
+      TRI_ASSERT(results.size() == batch.size());
+
+      lock.lock();
+      // results must be handed out under the mutex, because the waiting
+      // callers check them under the mutex as well
+      for (std::size_t i = 0; i < batch.size(); ++i) {
+        batch[i]->result.emplace(std::move(results[i]));
+      }
+      group->leaderActive = false;
+      group->cv.notify_all();
+    }
+  }
+
+  releaseGroup(key, group);
+  return std::move(*entry.result);
+}
+
+std::shared_ptr<InsertBatcher::Group> InsertBatcher::acquireGroup(
+    std::string const& key) {
+  std::lock_guard<std::mutex> guard(_groupsMutex);
+  auto& group = _groups[key];
+  if (group == nullptr) {
+    group = std::make_shared<Group>();
+  }
+  ++group->users;
+  return group;
+}
+
+void InsertBatcher::releaseGroup(std::string const& key,
+                                 std::shared_ptr<Group> const& group) {
+  std::lock_guard<std::mutex> guard(_groupsMutex);
+  TRI_ASSERT(group->users > 0);
+  if (--group->users == 0) {
+    // no caller is using the group anymore, so nobody can be queued in it
+    TRI_ASSERT(group->queue.empty());
+    _groups.erase(key);
+  }
+}
+
+std::vector<OperationResult> InsertBatcher::commitBatch(
+    TRI_vocbase_t& vocbase, LogicalCollection const& collection,
+    std::vector<Entry*> const& batch) {
+  TRI_ASSERT(!batch.empty());
+
+  std::vector<OperationResult> results;
+  results.reserve(batch.size());
+
+  auto failAll = [&](Result const& res) {
+    results.clear();
+    for (auto const* entry : batch) {
+      results.emplace_back(res, entry->options);
+    }
+  };
+
+  try {
+    VPackBuilder documents;
+    documents.openArray();
+    for (auto const* entry : batch) {
+      documents.add(entry->document);
+    }
+    documents.close();
+
+    // all entries of a batch have the same waitForSync value. we always
+    // need the per-document results to distribute them to the callers
+    OperationOptions options(batch.front()->options);
+    options.silent = false;
+
+    SingleCollectionTransaction trx(StandaloneContext::Create(vocbase),
+                                    collection.name(),
+                                    AccessMode::Type::WRITE);
+    Result res = trx.begin();
+    if (res.fail()) {
+      failAll(res);
+      return results;
+    }
+
+    OperationResult opRes =
+        trx.insertAsync(collection.name(), documents.slice(), options).get();
+    res = trx.finishAsync(opRes.result).get();
+    if (opRes.fail()) {
+      failAll(opRes.result);
+      return results;
+    }
+    if (res.fail()) {
+      failAll(res);
+      return results;
+    }
+
+    TRI_ASSERT(opRes.slice().isArray());
+    TRI_ASSERT(opRes.slice().length() == batch.size());
+    std::size_t i = 0;
+    for (auto it : VPackArrayIterator(opRes.slice())) {
+      TRI_ASSERT(i < batch.size());
+      OperationOptions const& entryOptions = batch[i]->options;
+      if (it.get(StaticStrings::Error).isTrue()) {
+        auto errorNum = it.get(StaticStrings::ErrorNum).getNumber<int>();
+        results.emplace_back(
+            Result(ErrorCode{errorNum},
+                   it.get(StaticStrings::ErrorMessage).stringView()),
+            entryOptions);
+      } else {
+        VPackBuilder single;
+        single.add(it);
+        results.emplace_back(Result(), single.steal(), entryOptions);
+      }
+      ++i;
+    }
+  } catch (basics::Exception const& ex) {
+    failAll(Result(ex.code(), ex.what()));
+  } catch (std::exception const& ex) {
+    failAll(Result(TRI_ERROR_INTERNAL, ex.what()));
+  }
+
+  return results;
+}
@@ -0,0 +1,111 @@
+////////////////////////////////////////////////////////////////////////////////
+/// DISCLAIMER
+///
+/// Copyright 2014-2023 ArangoDB GmbH, Cologne, Germany
+/// Copyright 2004-2014 triAGENS GmbH, Cologne, Germany
+///
+/// Licensed under the Apache License, Version 2.0 (the "License");
+/// you may not use this file except in compliance with the License.
+/// You may obtain a copy of the License at
+///
+///     http://www.apache.org/licenses/LICENSE-2.0
+///
+/// Unless required by applicable law or agreed to in writing, software
+/// distributed under the License is distributed on an "AS IS" BASIS,
+/// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+/// See the License for the specific language governing permissions and
+/// limitations under the License.
+///
+/// Copyright holder is ArangoDB GmbH, Cologne, Germany
+///
+/// @author Jan Steemann
+////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "Utils/OperationResult.h"
+
+#include <velocypack/Slice.h>
+
+#include <condition_variable>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+struct TRI_vocbase_t;
+
+namespace arangodb {
+class LogicalCollection;
+
+namespace transaction {
+
+/// @brief combines concurrent single-document inserts into the same
+/// collection into a single transaction, so that multiple independent
+/// requests share the cost of one commit (and one WAL sync in case of
+/// waitForSync).
+/// the first caller that arrives for a collection becomes the leader and
+/// commits all inserts that are queued at that point. all other callers
+/// block until the leader has committed their documents, or take over
+/// leadership once the current leader is done. a caller that arrives
+/// when no other caller is active commits its document immediately, so
+/// there is no added latency for non-concurrent workloads.
+/// every document is inserted in its own savepoint, so a failure for one
+/// document (e.g. a unique constraint violation) is reported only to the
+/// caller that inserted it. only errors in beginning or committing the
+/// transaction affect all callers of a batch.
+class InsertBatcher {
+ public:
+  explicit InsertBatcher(std::size_t maxBatchSize);
+
+  InsertBatcher(InsertBatcher const&) = delete;
+  InsertBatcher& operator=(InsertBatcher const&) = delete;
+
+  /// @brief insert a single document into the collection, potentially
+  /// together with documents of other concurrent callers. the options
+  /// must not request an overwrite, returnNew/returnOld or any other
+  /// behavior that depends on other documents of the batch.
+  /// the document must stay valid until the call returns.
+  OperationResult insert(TRI_vocbase_t& vocbase,
+                         LogicalCollection const& collection,
+                         velocypack::Slice document,
+                         OperationOptions const& options);
+
+ private:
+  struct Entry {
+    velocypack::Slice document;
+    OperationOptions const& options;
+    std::optional<OperationResult> result;
+  };
+
+  struct Group {
+    std::mutex mutex;
+    std::condition_variable cv;
+    std::vector<Entry*> queue;
+    bool leaderActive = false;
+    // number of callers currently using the group, protected by
+    // InsertBatcher::_groupsMutex
+    std::size_t users = 0;
+  };
+
+  std::shared_ptr<Group> acquireGroup(std::string const& key);
+  void releaseGroup(std::string const& key,
+                    std::shared_ptr<Group> const& group);
+
+  /// @brief insert all documents of the batch in one transaction. returns
+  /// one result per document, in the order of the batch
+  std::vector<OperationResult> commitBatch(
+      TRI_vocbase_t& vocbase, LogicalCollection const& collection,
+      std::vector<Entry*> const& batch);
+
+  std::size_t const _maxBatchSize;
+
+  std::mutex _groupsMutex;
+  std::unordered_map<std::string, std::shared_ptr<Group>> _groups;
+};
+
+}  // namespace transaction
+}  // namespace arangodb
@@ -41,7 +41,10 @@
 #include "Network/Methods.h"
 #include "Network/NetworkFeature.h"
 #include "Network/Utils.h"
+#include "Replication2/coro-helper.h"
 #include "RestServer/DatabaseFeature.h"
+#include "Scheduler/Scheduler.h"
+#include "Scheduler/SchedulerFeature.h"
 #include "StorageEngine/EngineSelectorFeature.h"
 #include "StorageEngine/StorageEngine.h"
 #include "StorageEngine/TransactionState.h"
@@ -157,11 +160,11 @@ bool Manager::ManagedTrx::hasPerformedIntermediateCommits() const noexcept {
 }
 
 bool Manager::ManagedTrx::expired() const noexcept {
-  return this->expiryTime < TRI_microtime();
+  return expiryTime.load(std::memory_order_relaxed) < TRI_microtime();
 }
 
 void Manager::ManagedTrx::updateExpiry() noexcept {
-  this->expiryTime = TRI_microtime() + this->timeToLive;
+  expiryTime.store(TRI_microtime() + timeToLive, std::memory_order_relaxed);
 }
 
 Manager::ManagedTrx::~ManagedTrx() {
@@ -902,8 +905,11 @@ void Manager::returnManagedTrx(TransactionId tid, bool isSideUser) noexcept {
   bool isSoftAborted = false;
 
   {
+    // a read lock on the bucket is sufficient here: everything we modify
+    // is either atomic or protected by the transaction's own lock. soft
+    // aborts set the expiry time only while holding the write lock
     size_t bucket = getBucket(tid);
-    WRITE_LOCKER(writeLocker, _transactions[bucket]._lock);
+    READ_LOCKER(readLocker, _transactions[bucket]._lock);
 
     auto it = _transactions[bucket]._managed.find(tid);
     if (it == _transactions[bucket]._managed.end() ||
@@ -928,7 +934,8 @@ void Manager::returnManagedTrx(TransactionId tid, bool isSideUser) noexcept {
       // here, because we have not acquired it before!
     } else {
       // garbageCollection might soft abort used transactions
-      isSoftAborted = it->second.expiryTime == 0;
+      isSoftAborted =
+          it->second.expiryTime.load(std::memory_order_relaxed) == 0;
       if (!isSoftAborted) {
         it->second.updateExpiry();
       }
@@ -937,7 +944,7 @@ void Manager::returnManagedTrx(TransactionId tid, bool isSideUser) noexcept {
     }
   }
 
-  // it is important that we release the write lock for the bucket here,
+  // it is important that we release the lock for the bucket here,
   // because abortManagedTrx will call statusChangeWithTimeout, which will
   // call updateTransaction, which then will try to acquire the same
   // write lock
@@ -996,20 +1003,82 @@ Result Manager::statusChangeWithTimeout(TransactionId tid,
   return res;
 }
 
+futures::Future<Result> Manager::statusChangeWithTimeoutAsync(
+    TransactionId tid, std::string database, transaction::Status status) {
+  // the exec context is owned by the request and outlives this operation.
+  // we need to re-establish it after every suspension, because we may be
+  // resumed on a different thread
+  ExecContext const& exec = ExecContext::current();
+  double startTime = 0.0;
+  constexpr double maxWaitTime = 3.0;
+  Result res;
+  while (true) {
+    auto f = [&] {
+      ExecContextScope scope(&exec);
+      return updateTransactionAsync(tid, status, false, database,
+                                    /*isAsync*/ true);
+    }();
+    res = co_await futures::asResult(std::move(f));
+    if (res.ok() || !res.is(TRI_ERROR_LOCKED)) {
+      break;
+    }
+    double now = TRI_microtime();
+    if (startTime <= 0.0001) {  // fp tolerance
+      startTime = now;
+    } else if (now - startTime > maxWaitTime) {
+      // timeout
+      break;
+    }
+    // suspend instead of spinning while the transaction is in use
+    auto* scheduler = SchedulerFeature::SCHEDULER;
+    if (scheduler == nullptr) {
+      std::this_thread::yield();
+    } else {
+      std::ignore = co_await futures::asTry(scheduler->delay(
+          "managed-trx-status-change", std::chrono::milliseconds(1)));
+    }
+  }
+  co_return res;
+}
+
 Result Manager::commitManagedTrx(TransactionId tid,
                                  std::string const& database) {
   READ_LOCKER(guard, _hotbackupCommitLock);
   return statusChangeWithTimeout(tid, database, transaction::Status::COMMITTED);
 }
 
+futures::Future<Result> Manager::commitManagedTrxAsync(TransactionId tid,
+                                                       std::string database) {
+  // the hotbackup commit lock is not bound to a thread, so it is fine to
+  // keep holding it while the commit is suspended
+  READ_LOCKER(guard, _hotbackupCommitLock);
+  co_return co_await futures::asResult(statusChangeWithTimeoutAsync(
+      tid, std::move(database), transaction::Status::COMMITTED));
+}
+
 Result Manager::abortManagedTrx(TransactionId tid,
                                 std::string const& database) {
   return statusChangeWithTimeout(tid, database, transaction::Status::ABORTED);
 }
 
+futures::Future<Result> Manager::abortManagedTrxAsync(TransactionId tid,
+                                                      std::string database) {
+  return statusChangeWithTimeoutAsync(tid, std::move(database),
+                                      transaction::Status::ABORTED);
+}
+
 Result Manager::updateTransaction(TransactionId tid, transaction::Status status,
                                   bool clearServers,
                                   std::string const& database) {
+  // the synchronous variant never suspends, so the future is always ready
+  return updateTransactionAsync(tid, status, clearServers, database,
+                                /*isAsync*/ false)
+      .get();
+}
+
+futures::Future<Result> Manager::updateTransactionAsync(
+    TransactionId tid, transaction::Status status, bool clearServers,
+    std::string database, bool isAsync) {
   TRI_ASSERT(status == transaction::Status::COMMITTED ||
              status == transaction::Status::ABORTED);
 
@@ -1051,15 +1120,15 @@ Result Manager::updateTransaction(TransactionId tid, transaction::Status status,
           arangodb::cluster::CallbackGuard{});
       inserted.first->second.finalStatus = transaction::Status::ABORTED;
       inserted.first->second.db = database;
-      return res.reset(TRI_ERROR_TRANSACTION_NOT_FOUND,
-                       buildErrorMessage(tid, status, /*found*/ false));
+      co_return res.reset(TRI_ERROR_TRANSACTION_NOT_FOUND,
+                          buildErrorMessage(tid, status, /*found*/ false));
     }
 
     ManagedTrx& mtrx = it->second;
     if (!::authorized(mtrx.user) ||
         (!database.empty() && mtrx.db != database)) {
-      return res.reset(TRI_ERROR_TRANSACTION_NOT_FOUND,
-                       buildErrorMessage(tid, status, /*found*/ true));
+      co_return res.reset(TRI_ERROR_TRANSACTION_NOT_FOUND,
+                          buildErrorMessage(tid, status, /*found*/ true));
     }
 
     // in order to modify the transaction's status, we need the write lock here,
@@ -1085,14 +1154,14 @@ Result Manager::updateTransaction(TransactionId tid, transaction::Status status,
                                      operation, " failed. transaction ",
                                      std::to_string(tid.id()), " is in use");
       LOG_TOPIC("dfc30", DEBUG, Logger::TRANSACTIONS) << msg;
-      return res.reset(TRI_ERROR_LOCKED, std::move(msg));
+      co_return res.reset(TRI_ERROR_LOCKED, std::move(msg));
     }
 
     TRI_ASSERT(tryGuard.isLocked());
 
     if (mtrx.type == MetaType::StandaloneAQL) {
-      return res.reset(TRI_ERROR_TRANSACTION_DISALLOWED_OPERATION,
-                       "not allowed to change an AQL transaction");
+      co_return res.reset(TRI_ERROR_TRANSACTION_DISALLOWED_OPERATION,
+                          "not allowed to change an AQL transaction");
     } else if (mtrx.type == MetaType::Tombstone) {
       TRI_ASSERT(mtrx.state == nullptr);
       // make sure everyone who asks gets the updated timestamp
@@ -1106,10 +1175,10 @@ Result Manager::updateTransaction(TransactionId tid, transaction::Status status,
           // intermediate commits already. in this case we return a special
           // error code, which makes the leader drop us as a follower for all
           // shards in the transaction.
-          return res.reset(
+          co_return res.reset(
               TRI_ERROR_CLUSTER_FOLLOWER_TRANSACTION_COMMIT_PERFORMED);
         }
-        return res;  // all good
+        co_return res;  // all good
       } else {
         std::string msg("transaction was already ");
         if (mtrx.wasExpired) {
@@ -1117,8 +1186,8 @@ Result Manager::updateTransaction(TransactionId tid, transaction::Status status,
         } else {
           msg.append(statusString(mtrx.finalStatus));
         }
-        return res.reset(TRI_ERROR_TRANSACTION_DISALLOWED_OPERATION,
-                         std::move(msg));
+        co_return res.reset(TRI_ERROR_TRANSACTION_DISALLOWED_OPERATION,
+                            std::move(msg));
       }
     }
     TRI_ASSERT(mtrx.type == MetaType::Managed);
@@ -1148,7 +1217,7 @@ Result Manager::updateTransaction(TransactionId tid, transaction::Status status,
 
   TRI_ASSERT(state);
   if (!state) {  // this should never happen
-    return res.reset(TRI_ERROR_INTERNAL, "managed trx in an invalid state");
+    co_return res.reset(TRI_ERROR_INTERNAL, "managed trx in an invalid state");
   }
 
   auto abortTombstone = [&] {  // set tombstone entry to aborted
@@ -1161,8 +1230,8 @@ Result Manager::updateTransaction(TransactionId tid, transaction::Status status,
   };
   if (!state->isRunning()) {  // this also should not happen
     abortTombstone();
-    return res.reset(TRI_ERROR_TRANSACTION_ABORTED,
-                     "transaction was not running");
+    co_return res.reset(TRI_ERROR_TRANSACTION_ABORTED,
+                        "transaction was not running");
   }
 
   bool isCoordinator = state->isCoordinator();
@@ -1179,19 +1248,31 @@ Result Manager::updateTransaction(TransactionId tid, transaction::Status status,
     trx.state()->clearKnownServers();
   }
   if (status == transaction::Status::COMMITTED) {
-    res = trx.commit();
+    if (isAsync) {
+      res = co_await trx.commitAsync();
+    } else {
+      res = trx.commit();
+    }
 
     if (res.fail()) {  // set final status to aborted
       // Note that if the failure point TransactionCommitFail is used, then
       // the trx can still be running here.
       if (trx.state()->isRunning()) {
         // ignore return code here
-        std::ignore = trx.abort();
+        if (isAsync) {
+          std::ignore = co_await trx.abortAsync();
+        } else {
+          std::ignore = trx.abort();
+        }
       }
       abortTombstone();
     }
   } else {
-    res = trx.abort();
+    if (isAsync) {
+      res = co_await trx.abortAsync();
+    } else {
+      res = trx.abort();
+    }
     if (intermediateCommits && ServerState::instance()->isDBServer() &&
         tid.isFollowerTransactionId()) {
       // we are trying to abort a follower transaction that had intermediate
@@ -1205,7 +1286,7 @@ Result Manager::updateTransaction(TransactionId tid, transaction::Status status,
   }
   TRI_ASSERT(!trx.state()->isRunning());
 
-  return res;
+  co_return res;
 }
 
 /// @brief calls the callback function for each managed transaction
@@ -1263,7 +1344,8 @@ bool Manager::garbageCollect(bool abortAll) {
           } else if (abortAll) {  // transaction is in use but we want to abort
             LOG_TOPIC("92431", INFO, Logger::TRANSACTIONS)
                 << "soft-aborting expired transaction " << it.first;
-            mtrx.expiryTime = 0;  // soft-abort transaction
+            // soft-abort transaction
+            mtrx.expiryTime.store(0, std::memory_order_relaxed);
             didWork = true;
             LOG_TOPIC("7ad4f", INFO, Logger::TRANSACTIONS)
                 << "soft aborting transaction " << it.first;
@@ -30,6 +30,8 @@
 #include "Basics/Result.h"
 #include "Basics/ResultT.h"
 #include "Cluster/CallbackGuard.h"
+#include "Containers/NodeHashMap.h"
+#include "Futures/Future.h"
 #include "Logger/LogMacros.h"
 #include "Transaction/ManagedContext.h"
 #include "Transaction/Status.h"
@@ -64,7 +66,7 @@ struct IManager {
 
 /// @brief Tracks TransactionState instances
 class Manager final : public IManager {
-  static constexpr size_t numBuckets = 16;
+  static constexpr size_t numBuckets = 64;
   static constexpr double tombstoneTTL = 10.0 * 60.0;              // 10 minutes
   static constexpr size_t maxTransactionSize = 128 * 1024 * 1024;  // 128 MiB
 
@@ -103,7 +105,9 @@ class Manager final : public IManager {
     /// repeated commit / abort messages
     transaction::Status finalStatus;
     double const timeToLive;
-    double expiryTime;                        // time this expires
+    /// @brief time this expires. atomic because it is updated while the
+    /// bucket is only read-locked
+    std::atomic<double> expiryTime;
     std::shared_ptr<TransactionState> state;  /// Transaction, may be nullptr
     arangodb::cluster::CallbackGuard rGuard;
     std::string const user;  /// user owning the transaction
@@ -185,6 +189,14 @@ class Manager final : public IManager {
   Result commitManagedTrx(TransactionId, std::string const& database);
   Result abortManagedTrx(TransactionId, std::string const& database) override;
 
+  /// @brief commit/abort a managed transaction without blocking the calling
+  /// thread. the returned future may be fulfilled on a different thread.
+  /// must be called with the exec context of the request in place
+  futures::Future<Result> commitManagedTrxAsync(TransactionId,
+                                                std::string database);
+  futures::Future<Result> abortManagedTrxAsync(TransactionId,
+                                               std::string database);
+
   /// @brief collect forgotten transactions
   bool garbageCollect(bool abortAll);
 
@@ -261,6 +273,8 @@ class Manager final : public IManager {
   /// @brief performs a status change on a transaction using a timeout
   Result statusChangeWithTimeout(TransactionId tid, std::string const& database,
                                  transaction::Status status);
+  futures::Future<Result> statusChangeWithTimeoutAsync(
+      TransactionId tid, std::string database, transaction::Status status);
 
   /// @brief hashes the transaction id into a bucket
   inline size_t getBucket(TransactionId tid) const noexcept {
@@ -274,6 +288,14 @@ class Manager final : public IManager {
       TransactionId tid, transaction::Status status, bool clearServers,
       std::string const& database =
           "" /* leave empty to operate across all databases */);
+  /// @brief the coroutine implementing updateTransaction. if isAsync is
+  /// false, the transaction is committed/aborted synchronously and the
+  /// returned future is always ready
+  futures::Future<Result> updateTransactionAsync(TransactionId tid,
+                                                 transaction::Status status,
+                                                 bool clearServers,
+                                                 std::string database,
+                                                 bool isAsync);
 
   /// @brief calls the callback function for each managed transaction
   void iterateManagedTrx(
@@ -295,7 +317,9 @@ class Manager final : public IManager {
     mutable basics::ReadWriteLock _lock;
 
     // managed transactions, seperate lifetime from above
-    std::unordered_map<TransactionId, ManagedTrx> _managed;
+    // a node-based map, because ManagedTrx objects contain a lock and must
+    // stay at the same address while the map is modified
+    containers::NodeHashMap<TransactionId, ManagedTrx> _managed;
   } _transactions[numBuckets];
 
   /// Nr of running transactions
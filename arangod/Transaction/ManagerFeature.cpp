@@ -27,6 +27,7 @@
 #include "Basics/FunctionUtils.h"
 #include "Basics/application-exit.h"
 #include "Basics/debugging.h"
+#include "Cluster/ServerState.h"
 #include "Logger/LogMacros.h"
 #include "Logger/Logger.h"
 #include "Logger/LoggerStream.h"
@@ -35,6 +36,7 @@
 #include "Scheduler/SchedulerFeature.h"
 #include "StorageEngine/EngineSelectorFeature.h"
 #include "StorageEngine/StorageEngine.h"
+#include "Transaction/InsertBatcher.h"
 #include "Transaction/Manager.h"
 
 using namespace arangodb::application_features;
@@ -52,6 +54,7 @@ ManagerFeature::ManagerFeature(Server& server)
     : ArangodFeature{server, *this},
       _streamingLockTimeout(8.0),
       _streamingIdleTimeout(defaultStreamingIdleTimeout),
+      _groupSingleDocumentInserts(false),
       _numExpiredTransactions(server.getFeature<metrics::MetricsFeature>().add(
           arangodb_transactions_expired_total{})) {
   static_assert(
@@ -102,6 +105,29 @@ void ManagerFeature::collectOptions(std::shared_ptr<ProgramOptions> options) {
 this period when no further operations are posted into them. Posting an
 operation into a non-expired Stream Transaction resets the transaction's
 timeout to the configured idle timeout.)");
+
+  options
+      ->addOption("--transaction.group-single-document-inserts",
+                  "Whether to combine concurrent single-document inserts "
+                  "into the same collection into one transaction.",
+                  new BooleanParameter(&_groupSingleDocumentInserts),
+                  arangodb::options::makeFlags(
+                      arangodb::options::Flags::DefaultNoComponents,
+                      arangodb::options::Flags::OnSingle,
+                      arangodb::options::Flags::Uncommon))
+      .setIntroducedIn(31200)
+      .setLongDescription(R"(If enabled, concurrent single-document insert
+requests for the same collection are executed together in one transaction,
+so that they share the cost of committing the transaction and, if
+`waitForSync` is used, of syncing the write-ahead log.
+
+Every document is still validated and inserted on its own, and errors for
+a document are only reported to the request that inserted it. An error
+when committing the transaction makes all requests of the batch fail.
+
+Only plain inserts are combined. Requests that use Stream Transactions,
+overwrite modes, `returnNew` or that skip document validation are always
+executed in their own transaction.)");
 }
 
 void ManagerFeature::prepare() {
@@ -111,6 +137,11 @@ void ManagerFeature::prepare() {
                 .getFeature<EngineSelectorFeature>()
                 .engine()
                 .createTransactionManager(*this);
+
+  if (_groupSingleDocumentInserts &&
+      ServerState::instance()->isSingleServer()) {
+    _insertBatcher = std::make_unique<InsertBatcher>(maxInsertBatchSize);
+  }
 }
 
 void ManagerFeature::start() {
@@ -164,7 +195,10 @@ void ManagerFeature::stop() {
   MANAGER->garbageCollect(/*abortAll*/ true);
 }
 
-void ManagerFeature::unprepare() { MANAGER.reset(); }
+void ManagerFeature::unprepare() {
+  _insertBatcher.reset();
+  MANAGER.reset();
+}
 
 void ManagerFeature::queueGarbageCollection() {
   // The RequestLane needs to be something which is `HIGH` priority, otherwise
@@ -27,10 +27,12 @@
 #include "Scheduler/Scheduler.h"
 #include "RestServer/arangod.h"
 
+#include <memory>
 #include <mutex>
 
 namespace arangodb::transaction {
 
+class InsertBatcher;
 class Manager;
 
 class ManagerFeature final : public ArangodFeature {
@@ -56,6 +58,12 @@ class ManagerFeature final : public ArangodFeature {
 
   static transaction::Manager* manager() noexcept { return MANAGER.get(); }
 
+  /// @brief batcher for concurrent single-document inserts. returns a
+  /// nullptr if grouping of inserts is turned off
+  transaction::InsertBatcher* insertBatcher() const noexcept {
+    return _insertBatcher.get();
+  }
+
   /// @brief track number of aborted managed transactions
   void trackExpired(uint64_t numExpired) noexcept;
 
@@ -64,6 +72,8 @@ class ManagerFeature final : public ArangodFeature {
 
   static constexpr double defaultStreamingIdleTimeout = 60.0;
   static constexpr double maxStreamingIdleTimeout = 120.0;
+  // maximum number of single-document inserts combined into one transaction
+  static constexpr std::size_t maxInsertBatchSize = 128;
 
   static std::unique_ptr<transaction::Manager> MANAGER;
 
@@ -79,6 +89,12 @@ class ManagerFeature final : public ArangodFeature {
   /// @brief idle timeout for streaming transactions, in seconds
   double _streamingIdleTimeout;
 
+  /// @brief whether or not concurrent single-document inserts into the
+  /// same collection are combined into one transaction
+  bool _groupSingleDocumentInserts;
+
+  std::unique_ptr<transaction::InsertBatcher> _insertBatcher;
+
   /// @brief number of expired transactions that were aborted by
   /// transaction garbage collection
   metrics::Counter& _numExpiredTransactions;
@@ -570,6 +570,11 @@ struct GetDocumentProcessor
       res.reset();  // With babies the reporting is handled somewhere else.
     }
 
+    if (_methods.state()->isDBServer()) {
+      _collection.loadTracker().trackReads(
+          _value.isArray() ? _value.length() : 1);
+    }
+
     events::ReadDocument(_methods.vocbase().name(), _trxColl.collectionName(),
                          _value, _options, res.errorNumber());
 
@@ -697,6 +702,11 @@ struct ReplicatedProcessorBase : GenericProcessor<Derived> {
     }
     _replicationData->close();
 
+    if (_replicationType == Methods::ReplicationType::LEADER) {
+      this->_collection.loadTracker().trackWrites(
+          this->_value.isArray() ? this->_value.length() : 1);
+    }
+
     // we are done with indexes. release the lock on the list of indexes as
     // early as possible
     _indexesSnapshot.release();
@@ -1918,7 +1928,7 @@ OperationResult transaction::Methods::anyLocal(
     }
   }
 
-  ResourceMonitor monitor(GlobalResourceMonitor::instance());
+  ResourceMonitor monitor(vocbase().resourceMonitor());
 
   resultBuilder.openArray();
 
@@ -2557,7 +2567,7 @@ OperationResult transaction::Methods::allLocal(
     }
   }
 
-  ResourceMonitor monitor(GlobalResourceMonitor::instance());
+  ResourceMonitor monitor(vocbase().resourceMonitor());
 
   resultBuilder.openArray();
 
@@ -3173,6 +3183,7 @@ Future<Result> Methods::replicateOperations(
 
   network::RequestOptions reqOpts;
   reqOpts.database = vocbase().name();
+  reqOpts.compression = network::Compression::kBulk;
   reqOpts.param(StaticStrings::IsRestoreString, "true");
 
   // index cache refilling...
@@ -3288,6 +3299,14 @@ Future<Result> Methods::replicateOperations(
 
   auto startTimeReplication = std::chrono::steady_clock::now();
 
+  // copy the operations only once. all follower requests share this copy
+  // instead of getting a copy of their own
+  auto bodyBuffer = std::make_shared<VPackBuffer<uint8_t>>();
+  bodyBuffer->append(replicationData.slice().start(),
+                     replicationData.slice().byteSize());
+  velocypack::SharedSlice body(
+      std::shared_ptr<uint8_t const>(bodyBuffer, bodyBuffer->data()));
+
   auto* pool = vocbase().server().getFeature<NetworkFeature>().pool();
   for (auto const& f : *followerList) {
     // check following term id for the follower:
@@ -3309,9 +3328,9 @@ Future<Result> Methods::replicateOperations(
     // change it in the loop!
     network::Headers headers;
     ClusterTrxMethods::addTransactionHeader(*this, f, headers);
-    futures.emplace_back(network::sendRequestRetry(
-        pool, "server:" + f, requestType, url, *(replicationData.buffer()),
-        reqOpts, std::move(headers)));
+    futures.emplace_back(network::sendRequestRetryShared(
+        pool, "server:" + f, requestType, url, {body}, reqOpts,
+        std::move(headers)));
 
     LOG_TOPIC("fecaf", TRACE, Logger::REPLICATION)
         << "replicating " << count << " " << opName << " operations for shard "
@@ -121,6 +121,10 @@ void Options::fromVelocyPack(arangodb::velocypack::Slice const& slice) {
   if (value.isBool()) {
     fillBlockCache = value.getBool();
   }
+  value = slice.get("optimistic");
+  if (value.isBool()) {
+    optimistic = value.getBool();
+  }
   value = slice.get("allowDirtyReads");
   if (value.isBool()) {
     allowDirtyReads = value.getBool();
@@ -171,6 +175,7 @@ void Options::toVelocyPack(arangodb::velocypack::Builder& builder) const {
 #endif
   builder.add(StaticStrings::WaitForSyncString, VPackValue(waitForSync));
   builder.add("fillBlockCache", VPackValue(fillBlockCache));
+  builder.add("optimistic", VPackValue(optimistic));
   // we are intentionally *not* writing allowImplicitCollectionForWrite here.
   // this is an internal option only used in replication
   builder.add("allowDirtyReads", VPackValue(allowDirtyReads));
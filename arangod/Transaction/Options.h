@@ -112,6 +112,17 @@ struct Options {
   /// `ensureSnapshot`. This allows us to lock the used keys before the
   /// snapshot is acquired in order to avoid write-write conflict.
   bool delaySnapshot = false;
+
+  /// @brief If set to true, keys written by the transaction are not locked
+  /// when they are written, but only when the transaction commits. Write-write
+  /// conflicts with other transactions are then detected at commit time, by
+  /// validating that none of the written keys was modified since the
+  /// transaction's snapshot was taken. This reduces the time keys are locked
+  /// for long-running transactions with a low conflict probability, but
+  /// conflicting transactions only fail when they try to commit.
+  /// Not used for single operations, follower transactions and transactions
+  /// with a delayed snapshot.
+  bool optimistic = false;
 };
 
 struct AllowImplicitCollectionsSwitcher {
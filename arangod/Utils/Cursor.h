@@ -179,6 +179,11 @@ class Cursor {
   virtual void setWakeupHandler(std::function<bool()> const& cb) {}
   virtual void resetWakeupHandler() {}
 
+  /// @brief start computing the next batch in the background, if the cursor
+  /// supports it. called when a batch was handed out and the cursor is
+  /// returned to the repository
+  virtual void prefetchNextBatch() {}
+
   virtual bool allowDirtyReads() const noexcept { return false; }
 
  protected:
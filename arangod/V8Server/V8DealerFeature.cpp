@@ -131,6 +131,7 @@ V8DealerFeature::V8DealerFeature(Server& server)
       _maxContextAge(60.0),
       _nrMaxContexts(0),
       _nrMinContexts(0),
+      _nrSpareContexts(0),
       _nrInflightContexts(0),
       _maxContextInvocations(0),
       _copyInstallation(false),
@@ -276,6 +277,28 @@ When there are unused V8 contexts that linger around and the number of V8
 contexts is greater than `--javascript.v8-contexts-minimum`, the server's
 garbage collector thread automatically deletes them.)");
 
+  options
+      ->addOption("--javascript.v8-contexts-spare",
+                  "The number of idle V8 contexts to create ahead of time, "
+                  "so that they are ready when they are needed.",
+                  new UInt64Parameter(&_nrSpareContexts),
+                  arangodb::options::makeFlags(
+                      arangodb::options::Flags::DefaultNoComponents,
+                      arangodb::options::Flags::OnCoordinator,
+                      arangodb::options::Flags::OnSingle,
+                      arangodb::options::Flags::Uncommon))
+      .setLongDescription(R"(Creating a V8 context takes a considerable amount
+of time, because the JavaScript bootstrap code has to be run for it. If all
+V8 contexts are in use, the next JavaScript action has to wait until an
+additional context has been created.
+
+With this option, the server's garbage collector thread creates additional
+contexts in the background whenever fewer than the configured number of
+contexts are idle, as long as the number of contexts does not exceed
+`--javascript.v8-contexts`. This moves the context creation out of the
+request path, at the expense of keeping more contexts in memory.)")
+      .setIntroducedIn(31200);
+
   options->addOption(
       "--javascript.v8-contexts-max-invocations",
       "The maximum number of invocations for each V8 context before it is "
@@ -793,6 +816,41 @@ std::unique_ptr<V8Context> V8DealerFeature::addContext() {
   return context;
 }
 
+bool V8DealerFeature::addSpareContext() {
+  {
+    std::lock_guard guard{_contextCondition.mutex};
+
+    if (_stopping || _dynamicContextCreationBlockers > 0 ||
+        _idleContexts.size() + _nrInflightContexts >= _nrSpareContexts ||
+        _contexts.size() + _nrInflightContexts >= _nrMaxContexts) {
+      return false;
+    }
+    ++_nrInflightContexts;
+  }
+
+  std::unique_ptr<V8Context> context;
+  try {
+    context = addContext();
+  } catch (...) {
+    std::lock_guard guard{_contextCondition.mutex};
+    --_nrInflightContexts;
+    throw;
+  }
+
+  std::lock_guard guard{_contextCondition.mutex};
+  --_nrInflightContexts;
+  // push_back will not fail as we reserved enough memory before
+  _contexts.push_back(context.get());
+  _idleContexts.push_back(context.release());
+
+  LOG_TOPIC("8e2c1", DEBUG, Logger::V8)
+      << "created spare V8 context #" << _contexts.back()->id()
+      << ", number of contexts is now " << _contexts.size();
+
+  _contextCondition.cv.notify_all();
+  return true;
+}
+
 void V8DealerFeature::unprepare() {
   shutdownContexts();
 
@@ -1073,7 +1131,10 @@ void V8DealerFeature::collectGarbage() {
         {
           std::unique_lock guard{_contextCondition.mutex};
 
+          // contexts are not removed while they are needed as spare
+          // contexts, so that they are not recreated right away
           if (_contexts.size() > _nrMinContexts && !context->isDefault() &&
+              _idleContexts.size() >= _nrSpareContexts &&
               context->shouldBeRemoved(_maxContextAge,
                                        _maxContextInvocations) &&
               _dynamicContextCreationBlockers == 0) {
@@ -1102,6 +1163,11 @@ void V8DealerFeature::collectGarbage() {
       } else {
         useReducedWait = true;
       }
+
+      // top up the number of idle contexts, so that requests do not have
+      // to wait for the creation of a context
+      while (addSpareContext()) {
+      }
     } catch (...) {
       // simply ignore errors here
       useReducedWait = false;
@@ -1393,6 +1459,12 @@ V8Context* V8DealerFeature::enterContext(
 
     _idleContexts.pop_back();
 
+    if (_idleContexts.size() < _nrSpareContexts) {
+      // wake up the garbage collector thread, so it can create a spare
+      // context in the background
+      _contextCondition.cv.notify_all();
+    }
+
     // should not fail because we reserved enough space beforehand
     _busyContexts.emplace(context);
 
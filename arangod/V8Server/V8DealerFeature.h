@@ -99,6 +99,8 @@ class V8DealerFeature final : public ArangodFeature {
   uint64_t _nrMaxContexts;
   // minimum number of contexts to keep
   uint64_t _nrMinContexts;
+  // number of idle contexts to create ahead of time
+  uint64_t _nrSpareContexts;
   // number of contexts currently in creation
   uint64_t _nrInflightContexts;
   // maximum number of V8 context invocations
@@ -172,6 +174,7 @@ class V8DealerFeature final : public ArangodFeature {
   void copyInstallationFiles();
   void startGarbageCollection();
   std::unique_ptr<V8Context> addContext();
+  bool addSpareContext();
   std::unique_ptr<V8Context> buildContext(TRI_vocbase_t* vocbase, size_t id);
   V8Context* pickFreeContextForGc();
   void shutdownContext(V8Context* context);
@@ -162,6 +162,12 @@ void ComputedValuesExpressionContext::clearVariable(
   _variables.erase(variable);
 }
 
+velocypack::Slice ComputedValuesExpressionContext::getBindParameterValue(
+    std::string_view /*name*/) const {
+  // computed values expressions never contain unresolved bind parameters
+  return velocypack::Slice::noneSlice();
+}
+
 ComputedValues::ComputedValue::ComputedValue(TRI_vocbase_t& vocbase,
                                              std::string_view name,
                                              std::string_view expressionString,
@@ -333,20 +339,25 @@ bool ComputedValues::mustComputeValuesOnReplace() const noexcept {
   return !_attributesForReplace.empty();
 }
 
+bool ComputedValues::mustTrackKeysWritten(
+    ComputeValuesOn mustComputeOn) const noexcept {
+  return (_keepExistingOn & ::mustComputeOnValue(mustComputeOn)) != 0;
+}
+
 void ComputedValues::mergeComputedAttributes(
     aql::ExpressionContext& ctx, transaction::Methods& trx,
     velocypack::Slice input,
     containers::FlatHashSet<std::string_view> const& keysWritten,
     ComputeValuesOn mustComputeOn, velocypack::Builder& output) const {
   if (mustComputeOn == ComputeValuesOn::kInsert) {
-    mergeComputedAttributes(ctx, _attributesForInsert, trx, input, keysWritten,
-                            output);
+    mergeComputedAttributes(ctx, _attributesForInsert, mustComputeOn, trx,
+                            input, keysWritten, output);
   } else if (mustComputeOn == ComputeValuesOn::kUpdate) {
-    mergeComputedAttributes(ctx, _attributesForUpdate, trx, input, keysWritten,
-                            output);
+    mergeComputedAttributes(ctx, _attributesForUpdate, mustComputeOn, trx,
+                            input, keysWritten, output);
   } else if (mustComputeOn == ComputeValuesOn::kReplace) {
-    mergeComputedAttributes(ctx, _attributesForReplace, trx, input, keysWritten,
-                            output);
+    mergeComputedAttributes(ctx, _attributesForReplace, mustComputeOn, trx,
+                            input, keysWritten, output);
   } else {
     TRI_ASSERT(false);
   }
@@ -355,9 +366,15 @@ void ComputedValues::mergeComputedAttributes(
 void ComputedValues::mergeComputedAttributes(
     aql::ExpressionContext& ctx,
     containers::FlatHashMap<std::string, std::size_t> const& attributes,
-    transaction::Methods& trx, velocypack::Slice input,
+    ComputeValuesOn mustComputeOn, transaction::Methods& trx,
+    velocypack::Slice input,
     containers::FlatHashSet<std::string_view> const& keysWritten,
     velocypack::Builder& output) const {
+  // if no computation overwrites existing attributes, all attributes of
+  // the original document are kept, and we can spare the lookups
+  bool const mayOverwrite =
+      (_overwriteOn & ::mustComputeOnValue(mustComputeOn)) != 0;
+
   output.openObject();
 
   {
@@ -370,8 +387,9 @@ void ComputedValues::mergeComputedAttributes(
       // note: key slices can be strings or numbers. they are numbers
       // for the internal attributes _id, _key, _rev, _from, _to
       VPackSlice key = it.key(/*translate*/ false);
-      if (key.isNumber()) {
-        // _id, _key, _rev, _from, _to
+      if (key.isNumber() || !mayOverwrite) {
+        // _id, _key, _rev, _from, _to, or any attribute if nothing is
+        // overwritten
         output.addUnchecked(key, it.value());
       } else {
         auto itCompute = attributes.find(key.stringView());
@@ -546,6 +564,11 @@ Result ComputedValues::buildDefinitions(TRI_vocbase_t& vocbase,
       _values.emplace_back(vocbase, name.stringView(), expression.stringView(),
                            mustComputeOn, overwrite.getBoolean(), failOnWarning,
                            keepNull);
+      if (overwrite.getBoolean()) {
+        _overwriteOn |= ::mustComputeOnValue(mustComputeOn);
+      } else {
+        _keepExistingOn |= ::mustComputeOnValue(mustComputeOn);
+      }
     } catch (std::exception const& ex) {
       return {TRI_ERROR_BAD_PARAMETER,
               absl::StrCat("invalid 'computedValues' entry: ", ex.what())};
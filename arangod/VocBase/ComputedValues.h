@@ -36,6 +36,7 @@
 #include <span>
 #include <string>
 #include <string_view>
+#include <type_traits>
 #include <vector>
 
 struct TRI_vocbase_t;
@@ -109,6 +110,9 @@ class ComputedValuesExpressionContext final : public aql::ExpressionContext {
   // unregister a temporary variable from the ExpressionContext.
   void clearVariable(aql::Variable const* variable) noexcept override;
 
+  velocypack::Slice getBindParameterValue(
+      std::string_view name) const override;
+
  private:
   std::string buildLogMessage(std::string_view type,
                               std::string_view msg) const;
@@ -180,6 +184,12 @@ class ComputedValues {
   bool mustComputeValuesOnUpdate() const noexcept;
   bool mustComputeValuesOnReplace() const noexcept;
 
+  // whether the caller needs to track the attributes it has written into
+  // the document before calling mergeComputedAttributes(). this is only
+  // necessary if at least one computation for the operation does not
+  // overwrite existing attributes
+  bool mustTrackKeysWritten(ComputeValuesOn mustComputeOn) const noexcept;
+
   void mergeComputedAttributes(
       aql::ExpressionContext& ctx, transaction::Methods& trx,
       velocypack::Slice input,
@@ -194,7 +204,8 @@ class ComputedValues {
   void mergeComputedAttributes(
       aql::ExpressionContext& ctx,
       containers::FlatHashMap<std::string, std::size_t> const& attributes,
-      transaction::Methods& trx, velocypack::Slice input,
+      ComputeValuesOn mustComputeOn, transaction::Methods& trx,
+      velocypack::Slice input,
       containers::FlatHashSet<std::string_view> const& keysWritten,
       velocypack::Builder& output) const;
 
@@ -210,6 +221,13 @@ class ComputedValues {
   containers::FlatHashMap<std::string, std::size_t> _attributesForInsert;
   containers::FlatHashMap<std::string, std::size_t> _attributesForUpdate;
   containers::FlatHashMap<std::string, std::size_t> _attributesForReplace;
+
+  // bitmasks of the operations for which at least one computation
+  // overwrites existing attributes (_overwriteOn), or keeps existing
+  // attributes (_keepExistingOn). these are used to skip the per-attribute
+  // lookups for every written document if they are not needed
+  std::underlying_type_t<ComputeValuesOn> _overwriteOn = 0;
+  std::underlying_type_t<ComputeValuesOn> _keepExistingOn = 0;
 };
 
 }  // namespace arangodb
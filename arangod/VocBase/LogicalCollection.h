@@ -26,6 +26,7 @@
 
 #include "Basics/Common.h"
 #include "Basics/ReadWriteLock.h"
+#include "Cluster/ShardLoadTracker.h"
 #include "Containers/FlatHashMap.h"
 #include "Futures/Future.h"
 #include "Indexes/IndexIterator.h"
@@ -387,6 +388,9 @@ class LogicalCollection : public LogicalDataSource {
 
   transaction::CountCache& countCache() { return _countCache; }
 
+  /// @brief document operations on this shard, only tracked on DB servers
+  cluster::ShardLoadTracker& loadTracker() noexcept { return _loadTracker; }
+
   std::unique_ptr<FollowerInfo> const& followers() const;
 
   /// @brief returns the value of _syncByRevision
@@ -484,6 +488,8 @@ class LogicalCollection : public LogicalDataSource {
 
   transaction::CountCache _countCache;
 
+  cluster::ShardLoadTracker _loadTracker;
+
   // options for key creation
   std::unique_ptr<KeyGenerator> _keyGenerator;
 
@@ -27,9 +27,11 @@
 #include "Aql/Query.h"
 #include "Aql/QueryRegistry.h"
 #include "Aql/QueryString.h"
+#include "Aql/UserFunctionExpressionCache.h"
 #include "Basics/StaticStrings.h"
 #include "Basics/StringUtils.h"
 #include "Basics/VelocyPackHelper.h"
+#include "RestServer/DatabaseFeature.h"
 #include "RestServer/QueryRegistryFeature.h"
 #include "Transaction/Helpers.h"
 #include "Transaction/Methods.h"
@@ -46,7 +48,10 @@
 #include <v8.h>
 #include <velocypack/Builder.h>
 #include <velocypack/Iterator.h>
+
+#include <algorithm>
 #include <regex>
+#include <vector>
 
 using namespace arangodb;
 
@@ -60,6 +65,9 @@ std::regex const funcRegEx("[a-zA-Z0-9][a-zA-Z0-9_]*(::[a-zA-Z0-9_]+)+",
 std::regex const funcFilterRegEx("[a-zA-Z0-9_]+(::[a-zA-Z0-9_]*)*",
                                  std::regex::ECMAScript);
 
+// parameter names of expression user functions
+std::regex const paramRegEx("[a-zA-Z_][a-zA-Z0-9_]*", std::regex::ECMAScript);
+
 bool isValidFunctionName(std::string const& testName) {
   return std::regex_match(testName, funcRegEx);
 }
@@ -69,6 +77,12 @@ bool isValidFunctionNameFilter(std::string const& testName) {
 }
 
 void reloadAqlUserFunctions(ArangodServer& server) {
+  // expression user functions are cached per DDL version
+  auto& df = server.getFeature<DatabaseFeature>();
+  if (df.versionTracker() != nullptr) {
+    df.versionTracker()->track("modify AQL user functions");
+  }
+
   if (server.hasFeature<V8DealerFeature>() &&
       server.isEnabled<V8DealerFeature>() &&
       server.getFeature<V8DealerFeature>().isEnabled()) {
@@ -77,6 +91,113 @@ void reloadAqlUserFunctions(ArangodServer& server) {
   }
 }
 
+// inserts or replaces a user function document in _aqlfunctions
+Result storeUserFunction(TRI_vocbase_t& vocbase, VPackSlice document,
+                         bool& replacedExisting) {
+  Result res;
+  {
+    arangodb::OperationOptions opOptions;
+    opOptions.waitForSync = true;
+    opOptions.returnOld = true;
+    opOptions.overwriteMode = OperationOptions::OverwriteMode::Replace;
+
+    // find and load collection given by name or identifier
+    auto ctx = transaction::V8Context::CreateWhenRequired(vocbase, true);
+    SingleCollectionTransaction trx(ctx, StaticStrings::AqlFunctionsCollection,
+                                    AccessMode::Type::WRITE);
+
+    res = trx.begin();
+    if (res.fail()) {
+      return res;
+    }
+
+    arangodb::OperationResult result =
+        trx.insert(StaticStrings::AqlFunctionsCollection, document, opOptions);
+
+    if (result.ok()) {
+      VPackSlice oldSlice = result.slice().get(StaticStrings::Old);
+      replacedExisting = !(oldSlice.isNone() || oldSlice.isNull());
+    }
+    // Will commit if no error occured.
+    // or abort if an error occured.
+    // result stays valid!
+    res = trx.finish(result.result);
+  }
+
+  if (res.ok()) {
+    reloadAqlUserFunctions(vocbase.server());
+  }
+
+  return res;
+}
+
+// registers a user function whose body is an AQL expression. such functions
+// are validated and executed without V8
+Result registerUserFunctionExpression(TRI_vocbase_t& vocbase,
+                                      std::string const& name,
+                                      VPackSlice expression,
+                                      VPackSlice parameters,
+                                      bool& replacedExisting) {
+  if (!expression.isString() || expression.getStringLength() == 0) {
+    return Result(TRI_ERROR_QUERY_FUNCTION_INVALID_CODE,
+                  "expecting string with function expression");
+  }
+
+  std::vector<std::string> names;
+  if (!parameters.isNone()) {
+    if (!parameters.isArray()) {
+      return Result(TRI_ERROR_QUERY_FUNCTION_INVALID_CODE,
+                    "expecting array of parameter names");
+    }
+    for (VPackSlice it : VPackArrayIterator(parameters)) {
+      if (!it.isString() || !std::regex_match(it.copyString(), paramRegEx)) {
+        return Result(TRI_ERROR_QUERY_FUNCTION_INVALID_CODE,
+                      "parameter names must be valid identifiers");
+      }
+      if (std::find(names.begin(), names.end(), it.stringView()) !=
+          names.end()) {
+        return Result(TRI_ERROR_QUERY_FUNCTION_INVALID_CODE,
+                      std::string("duplicate parameter name '") +
+                          it.copyString() + "'");
+      }
+      names.emplace_back(it.copyString());
+    }
+  }
+
+  VPackBuilder body;
+  bool isDeterministic = true;
+  Result res = aql::UserFunctionExpressionCache::compile(
+      vocbase, expression.stringView(), names, body, isDeterministic);
+  if (res.fail()) {
+    return res;
+  }
+
+  std::string _key(name);
+  basics::StringUtils::toupperInPlace(_key);
+
+  VPackBuilder oneFunctionDocument;
+  oneFunctionDocument.openObject();
+  oneFunctionDocument.add(StaticStrings::KeyString, VPackValue(_key));
+  oneFunctionDocument.add("name", VPackValue(name));
+  oneFunctionDocument.add("expression", expression);
+  oneFunctionDocument.add(VPackValue("parameters"));
+  oneFunctionDocument.openArray();
+  for (auto const& it : names) {
+    oneFunctionDocument.add(VPackValue(it));
+  }
+  oneFunctionDocument.close();
+  // calls to expression functions are always inlined into the AST. the
+  // JavaScript code is only a placeholder for consumers that expect it
+  oneFunctionDocument.add(
+      "code", VPackValue("(function () { throw \"AQL user function '" + name +
+                         "' is an AQL expression\"; }\n)"));
+  oneFunctionDocument.add("isDeterministic", VPackValue(isDeterministic));
+  oneFunctionDocument.close();
+
+  return storeUserFunction(vocbase, oneFunctionDocument.slice(),
+                           replacedExisting);
+}
+
 }  // namespace
 
 Result arangodb::unregisterUserFunction(TRI_vocbase_t& vocbase,
@@ -189,14 +310,6 @@ Result arangodb::registerUserFunction(TRI_vocbase_t& vocbase,
 
   Result res;
 
-  auto& server = vocbase.server();
-  if (!server.hasFeature<V8DealerFeature>() ||
-      !server.isEnabled<V8DealerFeature>() ||
-      !server.getFeature<V8DealerFeature>().isEnabled()) {
-    return res.reset(TRI_ERROR_DISABLED,
-                     "JavaScript operations are not available");
-  }
-
   std::string name;
 
   try {
@@ -221,6 +334,21 @@ Result arangodb::registerUserFunction(TRI_vocbase_t& vocbase,
                       "' is not a valid name");
   }
 
+  if (VPackSlice expression = userFunction.get("expression");
+      !expression.isNone()) {
+    return registerUserFunctionExpression(vocbase, name, expression,
+                                          userFunction.get("parameters"),
+                                          replacedExisting);
+  }
+
+  auto& server = vocbase.server();
+  if (!server.hasFeature<V8DealerFeature>() ||
+      !server.isEnabled<V8DealerFeature>() ||
+      !server.getFeature<V8DealerFeature>().isEnabled()) {
+    return res.reset(TRI_ERROR_DISABLED,
+                     "JavaScript operations are not available");
+  }
+
   auto cvString = userFunction.get("code");
   if (!cvString.isString() || cvString.getStringLength() == 0) {
     return Result(TRI_ERROR_QUERY_FUNCTION_INVALID_CODE,
@@ -298,41 +426,8 @@ Result arangodb::registerUserFunction(TRI_vocbase_t& vocbase,
   oneFunctionDocument.add("isDeterministic", VPackValue(isDeterministic));
   oneFunctionDocument.close();
 
-  {
-    arangodb::OperationOptions opOptions;
-    opOptions.waitForSync = true;
-    opOptions.returnOld = true;
-    opOptions.overwriteMode = OperationOptions::OverwriteMode::Replace;
-
-    // find and load collection given by name or identifier
-    auto ctx = transaction::V8Context::CreateWhenRequired(vocbase, true);
-    SingleCollectionTransaction trx(ctx, StaticStrings::AqlFunctionsCollection,
-                                    AccessMode::Type::WRITE);
-
-    res = trx.begin();
-    if (res.fail()) {
-      return res;
-    }
-
-    arangodb::OperationResult result =
-        trx.insert(StaticStrings::AqlFunctionsCollection,
-                   oneFunctionDocument.slice(), opOptions);
-
-    if (result.ok()) {
-      VPackSlice oldSlice = result.slice().get(StaticStrings::Old);
-      replacedExisting = !(oldSlice.isNone() || oldSlice.isNull());
-    }
-    // Will commit if no error occured.
-    // or abort if an error occured.
-    // result stays valid!
-    res = trx.finish(result.result);
-  }
-
-  if (res.ok()) {
-    reloadAqlUserFunctions(vocbase.server());
-  }
-
-  return res;
+  return storeUserFunction(vocbase, oneFunctionDocument.slice(),
+                           replacedExisting);
 }
 
 Result arangodb::toArrayUserFunctions(TRI_vocbase_t& vocbase,
@@ -416,6 +511,14 @@ Result arangodb::toArrayUserFunctions(TRI_vocbase_t& vocbase,
       oneFunction.add("name", name);
       oneFunction.add("code", VPackValue(tmp));
       oneFunction.add("isDeterministic", VPackValue(isDeterministic));
+      if (VPackSlice expression = resolved.get("expression");
+          expression.isString()) {
+        oneFunction.add("expression", expression);
+        VPackSlice parameters = resolved.get("parameters");
+        if (parameters.isArray()) {
+          oneFunction.add("parameters", parameters);
+        }
+      }
       oneFunction.close();
       result.add(oneFunction.slice());
     }
@@ -59,10 +59,15 @@ Result unregisterUserFunctionsGroup(TRI_vocbase_t& vocbase,
 // @brief registers an aql function with the current database
 // will pull v8 context from TLS, or allocate one from the context dealer.
 // needs the V8 context to test the function to eventually throw errors.
+// functions defined as an AQL expression do not need V8. calls to them are
+// inlined into the calling query.
 // @param vocbase current database to work with
 // @param userFunction an Object with the following attributes:
 //    name: the case insensitive name of the user function.
 //    code: the javascript code of the function body
+//    expression: alternatively to code, an AQL expression as function body.
+//    the parameters are referred to as @name in the expression
+//    parameters: the parameter names of an expression function
 //    isDeterministic: whether the function will return the same result on same
 //    params
 // @param replaceExisting set to true if the function replaced a previously
@@ -82,6 +87,7 @@ Result registerUserFunction(TRI_vocbase_t& vocbase,
 //    code: the javascript code of the function body
 //    isDeterministic: whether the function will return the same result on same
 //    params
+//    expression, parameters: for functions defined as an AQL expression
 // @return result object
 Result toArrayUserFunctions(TRI_vocbase_t& vocbase,
                             std::string const& functionFilterPrefix,
@@ -1272,6 +1272,7 @@ futures::Future<Result> Collections::warmup(TRI_vocbase_t& vocbase,
       engine.scheduleFullIndexRefill(vocbase.name(), coll.name(), idx->id());
     }
   }
+  engine.scheduleBlockCacheWarmup(vocbase.name(), coll.name());
   return futures::makeFuture(Result());
 }
 
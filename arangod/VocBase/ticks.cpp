@@ -27,16 +27,42 @@
 #include "ticks.h"
 
 #include "Basics/HybridLogicalClock.h"
+#include "Basics/system-compiler.h"
 #include "Cluster/ServerState.h"
 
 using namespace arangodb;
 using namespace arangodb::basics;
 
-/// @brief current tick identifier (48 bit)
-static std::atomic<uint64_t> CurrentTick(0);
-
-/// @brief a hybrid logical clock
-static HybridLogicalClock hybridLogicalClock;
+namespace {
+/// @brief number of ticks a thread reserves at once from the global tick
+/// counter. the ticks of a block are handed out by the reserving thread
+/// only, so that the global counter is modified only once per block
+constexpr uint64_t tickBlockSize = 64;
+
+/// @brief ticks reserved by the current thread, [next, end)
+struct TickBlock {
+  uint64_t next = 0;
+  uint64_t end = 0;
+  /// @brief value of TickEpoch at the time the block was reserved
+  uint64_t epoch = 0;
+};
+
+thread_local TickBlock LocalTickBlock;
+}  // namespace
+
+/// @brief current tick identifier (48 bit). this is the highest tick that
+/// has been reserved by any thread, not necessarily handed out yet
+alignas(64) static std::atomic<uint64_t> CurrentTick(0);
+
+/// @brief increased whenever TRI_UpdateTickServer moves the global tick
+/// counter forward, so that threads discard the blocks they reserved
+/// before. it is on its own cache line because it is read for every tick,
+/// but written only rarely
+alignas(64) static std::atomic<uint64_t> TickEpoch(0);
+
+/// @brief a hybrid logical clock. kept on its own cache line so that it
+/// does not share one with the tick counter
+alignas(64) static HybridLogicalClock hybridLogicalClock;
 
 /// @brief create a new tick, using a hybrid logical clock
 TRI_voc_tick_t TRI_HybridLogicalClock() {
@@ -51,7 +77,24 @@ TRI_voc_tick_t TRI_HybridLogicalClock(TRI_voc_tick_t received) {
 }
 
 /// @brief create a new tick
-TRI_voc_tick_t TRI_NewTickServer() { return ++CurrentTick; }
+TRI_voc_tick_t TRI_NewTickServer() {
+  TickBlock& block = LocalTickBlock;
+  uint64_t epoch = TickEpoch.load(std::memory_order_acquire);
+  if (ADB_UNLIKELY(block.next == block.end || block.epoch != epoch)) {
+    uint64_t first =
+        CurrentTick.fetch_add(tickBlockSize, std::memory_order_relaxed) + 1;
+    block.next = first;
+    block.end = first + tickBlockSize;
+    block.epoch = epoch;
+  }
+  return block.next++;
+}
+
+/// @brief reserve a contiguous range of ticks, which are not handed out
+/// again. returns the first tick of the range
+TRI_voc_tick_t TRI_NewTickServerRange(uint64_t count) {
+  return CurrentTick.fetch_add(count, std::memory_order_relaxed) + 1;
+}
 
 /// @brief updates the tick counter, with lock
 void TRI_UpdateTickServer(TRI_voc_tick_t tick) {
@@ -60,10 +103,15 @@ void TRI_UpdateTickServer(TRI_voc_tick_t tick) {
   auto expected = CurrentTick.load(std::memory_order_relaxed);
 
   // only update global tick if less than the specified value...
-  while (expected < t && !CurrentTick.compare_exchange_weak(
-                             expected, t, std::memory_order_release,
-                             std::memory_order_relaxed)) {
-    expected = CurrentTick.load(std::memory_order_relaxed);
+  while (expected < t) {
+    if (CurrentTick.compare_exchange_weak(expected, t,
+                                          std::memory_order_release,
+                                          std::memory_order_relaxed)) {
+      // ticks in blocks that have been reserved before may be lower than
+      // the new value. make all threads reserve a new block
+      TickEpoch.fetch_add(1, std::memory_order_release);
+      break;
+    }
   }
 }
 
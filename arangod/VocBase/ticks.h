@@ -35,13 +35,21 @@ TRI_voc_tick_t TRI_HybridLogicalClock();
 /// communications.
 TRI_voc_tick_t TRI_HybridLogicalClock(TRI_voc_tick_t received);
 
-/// @brief create a new tick
+/// @brief create a new tick. ticks are unique and increasing for each
+/// thread, but not necessarily across threads: to avoid contention on the
+/// global tick counter, every thread reserves blocks of ticks from it and
+/// hands them out locally
 TRI_voc_tick_t TRI_NewTickServer();
 
+/// @brief reserve a contiguous range of `count` ticks, which are not handed
+/// out again. returns the first tick of the range
+TRI_voc_tick_t TRI_NewTickServerRange(uint64_t count);
+
 /// @brief updates the tick counter, with lock
 void TRI_UpdateTickServer(TRI_voc_tick_t);
 
-/// @brief returns the current tick counter
+/// @brief returns the current tick counter. this is an upper bound for all
+/// ticks handed out so far
 TRI_voc_tick_t TRI_CurrentTickServer();
 
 /// @brief generates a new tick which also encodes this server's id
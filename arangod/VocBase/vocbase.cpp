@@ -42,6 +42,7 @@
 #include "Auth/Common.h"
 #include "Basics/Exceptions.h"
 #include "Basics/Exceptions.tpp"
+#include "Basics/GlobalResourceMonitor.h"
 #include "Basics/Locking.h"
 #include "Basics/NumberUtils.h"
 #include "Basics/DownCast.h"
@@ -58,6 +59,7 @@
 #include "Cluster/ClusterInfo.h"
 #include "Cluster/ServerState.h"
 #include "Containers/Helpers.h"
+#include "Graph/Cache/GraphSnapshotCache.h"
 #include "Logger/LogMacros.h"
 #include "Metrics/Counter.h"
 #include "Metrics/Gauge.h"
@@ -481,6 +483,7 @@ Result TRI_vocbase_t::dropCollectionWorker(LogicalCollection& collection) {
   TRI_ASSERT(locker.isLocked());
 
   aql::QueryCache::instance()->invalidate(this);
+  graph::GraphSnapshotCache::instance().invalidate({collection.guid()});
 
   collection.setDeleted();
 
@@ -1374,13 +1377,17 @@ Result TRI_vocbase_t::dropView(DataSourceId cid, bool allowDropSystem) {
 }
 
 TRI_vocbase_t::TRI_vocbase_t(CreateDatabaseInfo&& info)
-    : _server(info.server()), _info(std::move(info)) {
+    : _server(info.server()),
+      _info(std::move(info)),
+      _resourceMonitor(std::make_unique<GlobalResourceMonitor>(
+          GlobalResourceMonitor::instance())) {
   TRI_ASSERT(_info.valid());
 
   if (_info.server().hasFeature<QueryRegistryFeature>()) {
     QueryRegistryFeature& feature =
         _info.server().getFeature<QueryRegistryFeature>();
     _queries = std::make_unique<aql::QueryList>(feature);
+    _resourceMonitor->memoryLimit(feature.queryDatabaseMemoryLimit());
   }
   _cursorRepository = std::make_unique<CursorRepository>(*this);
 
@@ -1407,6 +1414,8 @@ TRI_vocbase_t::TRI_vocbase_t(TRI_vocbase_t::MockConstruct,
                              CreateDatabaseInfo&& info)
     : _server(info.server()),
       _info(std::move(info)),
+      _resourceMonitor(std::make_unique<GlobalResourceMonitor>(
+          GlobalResourceMonitor::instance())),
       _logManager(std::make_shared<VocBaseLogManager>(*this, name())) {}
 #endif
 
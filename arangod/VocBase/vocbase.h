@@ -52,6 +52,7 @@ namespace arangodb {
 namespace application_features {
 class ApplicationServer;
 }
+class GlobalResourceMonitor;
 namespace aql {
 class QueryList;
 }
@@ -174,6 +175,10 @@ struct TRI_vocbase_t {
   std::unique_ptr<arangodb::ReplicationClientsProgressTracker>
       _replicationClients;
 
+  // memory usage of all queries and transactions in the database. this is
+  // nested into the global resource monitor
+  std::unique_ptr<arangodb::GlobalResourceMonitor> _resourceMonitor;
+
  public:
   std::shared_ptr<arangodb::VocBaseLogManager> _logManager;
 
@@ -228,6 +233,12 @@ struct TRI_vocbase_t {
 
   arangodb::ArangodServer& server() const noexcept { return _server; }
 
+  /// @brief resource monitor for the memory usage of all queries and
+  /// transactions in the database
+  arangodb::GlobalResourceMonitor& resourceMonitor() const noexcept {
+    return *_resourceMonitor;
+  }
+
   TRI_voc_tick_t id() const { return _info.getId(); }
   decltype(auto) name() const { return _info.getName(); }
   std::string path() const;
@@ -220,53 +220,80 @@ auto zkd::RandomBitManipulator::bits() const -> std::size_t {
   return 8 * _ref.size();
 }
 
+namespace {
+// bit `index` of the byte string, counting from the most significant bit of
+// the first byte. bits past the end are zero
+inline bool getBitUnchecked(unsigned char const* data, std::size_t size,
+                            std::size_t index) noexcept {
+  std::size_t const byte = index / 8;
+  if (byte >= size) {
+    return false;
+  }
+  return (data[byte] >> (7 - index % 8)) & 1;
+}
+}  // namespace
+
 auto zkd::interleave(std::vector<zkd::byte_string> const& vec)
     -> zkd::byte_string {
   std::size_t max_size = 0;
-  std::vector<BitReader> reader;
-  reader.reserve(vec.size());
-
   for (auto const& str : vec) {
-    if (str.size() > max_size) {
-      max_size = str.size();
-    }
-    reader.emplace_back(str);
-  }
-
-  BitWriter bitWriter;
-  bitWriter.reserve(vec.size() * max_size);
-
-  for (size_t i = 0; i < 8 * max_size; i++) {
-    for (auto& it : reader) {
-      auto b = it.next();
-      bitWriter.append(b.value_or(Bit::ZERO));
+    max_size = std::max(max_size, str.size());
+  }
+
+  // all inputs are padded with zero bits to the size of the longest input.
+  // this writes the bits directly into the result instead of going through
+  // a BitReader/BitWriter per bit, because interleaving happens for every
+  // index write and for every query
+  auto result = byte_string(vec.size() * max_size, std::byte{0});
+  auto* out = reinterpret_cast<unsigned char*>(result.data());
+  std::size_t outBit = 0;
+  for (std::size_t byte = 0; byte < max_size; ++byte) {
+    for (unsigned bit = 8; bit-- > 0;) {
+      for (auto const& str : vec) {
+        if (byte < str.size() &&
+            ((static_cast<unsigned char>(str[byte]) >> bit) & 1) != 0) {
+          out[outBit / 8] |=
+              static_cast<unsigned char>(0x80U >> (outBit % 8));
+        }
+        ++outBit;
+      }
     }
   }
+  TRI_ASSERT(outBit == 8 * result.size());
 
-  return std::move(bitWriter).str();
+  return result;
 }
 
 auto zkd::transpose(byte_string_view bs, std::size_t dimensions)
     -> std::vector<zkd::byte_string> {
   assert(dimensions > 0);
-  BitReader reader(bs);
-  std::vector<BitWriter> writer;
-  writer.resize(dimensions);
-
-  while (true) {
-    for (auto& w : writer) {
-      auto b = reader.next();
-      if (!b.has_value()) {
-        goto break_loops;
-      }
-      w.append(b.value());
+  std::size_t const totalBits = 8 * bs.size();
+
+  std::vector<zkd::byte_string> result;
+  result.resize(dimensions);
+  std::vector<unsigned char*> out;
+  out.reserve(dimensions);
+  for (std::size_t d = 0; d < dimensions; ++d) {
+    // number of bits that end up in dimension d
+    std::size_t const bits =
+        totalBits > d ? (totalBits - d + dimensions - 1) / dimensions : 0;
+    result[d].assign((bits + 7) / 8, std::byte{0});
+    out.push_back(reinterpret_cast<unsigned char*>(result[d].data()));
+  }
+
+  auto const* in = reinterpret_cast<unsigned char const*>(bs.data());
+  std::size_t dim = 0;
+  std::size_t step = 0;
+  for (std::size_t i = 0; i < totalBits; ++i) {
+    if (((in[i / 8] >> (7 - i % 8)) & 1) != 0) {
+      out[dim][step / 8] |= static_cast<unsigned char>(0x80U >> (step % 8));
+    }
+    if (++dim == dimensions) {
+      dim = 0;
+      ++step;
     }
   }
-break_loops:
 
-  std::vector<zkd::byte_string> result;
-  std::transform(writer.begin(), writer.end(), std::back_inserter(result),
-                 [](auto& bs) { return std::move(bs).str(); });
   return result;
 }
 
@@ -292,9 +319,9 @@ void zkd::compareWithBoxInto(byte_string_view cur, byte_string_view min,
   std::fill(result.begin(), result.end(), CompareResult{});
   std::size_t max_size = std::max({cur.size(), min.size(), max.size()});
 
-  BitReader cur_reader(cur);
-  BitReader min_reader(min);
-  BitReader max_reader(max);
+  auto const* curData = reinterpret_cast<unsigned char const*>(cur.data());
+  auto const* minData = reinterpret_cast<unsigned char const*>(min.data());
+  auto const* maxData = reinterpret_cast<unsigned char const*>(max.data());
 
   auto const isLargerThanMin = [&result](auto const dim) {
     return result[dim].saveMin != CompareResult::max;
@@ -310,9 +337,12 @@ void zkd::compareWithBoxInto(byte_string_view cur, byte_string_view min,
     TRI_ASSERT(step == i / dimensions);
     TRI_ASSERT(dim == i % dimensions);
 
-    auto cur_bit = cur_reader.next().value_or(Bit::ZERO);
-    auto min_bit = min_reader.next().value_or(Bit::ZERO);
-    auto max_bit = max_reader.next().value_or(Bit::ZERO);
+    auto cur_bit = getBitUnchecked(curData, cur.size(), i) ? Bit::ONE
+                                                             : Bit::ZERO;
+    auto min_bit = getBitUnchecked(minData, min.size(), i) ? Bit::ONE
+                                                           : Bit::ZERO;
+    auto max_bit = getBitUnchecked(maxData, max.size(), i) ? Bit::ONE
+                                                           : Bit::ZERO;
 
     if (result[dim].flag == 0) {
       if (!isLargerThanMin(dim)) {
@@ -352,9 +382,9 @@ auto zkd::testInBox(byte_string_view cur, byte_string_view min,
 
   std::size_t max_size = std::max({cur.size(), min.size(), max.size()});
 
-  BitReader cur_reader(cur);
-  BitReader min_reader(min);
-  BitReader max_reader(max);
+  auto const* curData = reinterpret_cast<unsigned char const*>(cur.data());
+  auto const* minData = reinterpret_cast<unsigned char const*>(min.data());
+  auto const* maxData = reinterpret_cast<unsigned char const*>(max.data());
 
   containers::SmallVector<std::pair<bool, bool>, 32> isLargerLowerThanMinMax;
   isLargerLowerThanMinMax.resize(dimensions);
@@ -362,9 +392,12 @@ auto zkd::testInBox(byte_string_view cur, byte_string_view min,
   unsigned dim = 0;
   unsigned finished_dims = static_cast<unsigned>(2 * dimensions);
   for (std::size_t i = 0; i < 8 * max_size; i++) {
-    auto cur_bit = cur_reader.next().value_or(Bit::ZERO);
-    auto min_bit = min_reader.next().value_or(Bit::ZERO);
-    auto max_bit = max_reader.next().value_or(Bit::ZERO);
+    auto cur_bit = getBitUnchecked(curData, cur.size(), i) ? Bit::ONE
+                                                             : Bit::ZERO;
+    auto min_bit = getBitUnchecked(minData, min.size(), i) ? Bit::ONE
+                                                           : Bit::ZERO;
+    auto max_bit = getBitUnchecked(maxData, max.size(), i) ? Bit::ONE
+                                                           : Bit::ZERO;
 
     if (!isLargerLowerThanMinMax[dim].first) {
       if (cur_bit == Bit::ZERO && min_bit == Bit::ONE) {
@@ -32,6 +32,7 @@
 #include <fstream>
 #include <iomanip>
 #include <iostream>
+#include <sstream>
 #include <thread>
 
 #ifdef TRI_HAVE_UNISTD_H
@@ -100,7 +101,7 @@ BenchFeature::BenchFeature(Server& server, int* result)
       _result(result),
       _histogramNumIntervals(1000),
       _histogramIntervalSize(0.0),
-      _percentiles({50.0, 80.0, 85.0, 90.0, 95.0, 99.0, 99.99}) {
+      _percentiles({50.0, 80.0, 85.0, 90.0, 95.0, 99.0, 99.9, 99.99}) {
   setOptional(false);
   startsAfter<application_features::BasicFeaturePhaseClient>();
 
@@ -115,6 +116,7 @@ BenchFeature::BenchFeature(Server& server, int* result)
   DocumentCrudWriteReadTest::registerTestcase();
   DocumentImportTest::registerTestcase();
   EdgeCrudTest::registerTestcase();
+  MixedWorkloadTest::registerTestcase();
   PersistentIndexTest::registerTestcase();
   VersionTest::registerTestcase();
 }
@@ -198,6 +200,18 @@ void BenchFeature::collectOptions(std::shared_ptr<ProgramOptions> options) {
                      "fixed test count.",
                      new UInt64Parameter(&_duration));
 
+  options
+      ->addOption("--rate",
+                  "The target number of operations per second of all threads "
+                  "combined (0 = send requests as fast as possible).",
+                  new DoubleParameter(&_rate))
+      .setIntroducedIn(31200)
+      .setLongDescription(R"(If set, each thread sends its requests according
+to a fixed schedule (open-loop load generation), and the latency of a request
+is measured from the time it was scheduled for. This way, the time a request
+had to wait for slow predecessors is part of the reported latencies, which
+is hidden when requests are sent back-to-back (coordinated omission).)");
+
   std::unordered_set<std::string> cases;
   for (auto& [name, _] : BenchmarkOperation::allBenchmarks()) {
     cases.emplace(name);
@@ -253,6 +267,31 @@ void BenchFeature::collectOptions(std::shared_ptr<ProgramOptions> options) {
           new StringParameter(&_customQueryBindVars))
       .setIntroducedIn(31000);
 
+  options
+      ->addOption("--workload",
+                  "The mix of operations for the \"mixed\" test case, as a "
+                  "comma-separated list of `operation:weight` pairs. "
+                  "Supported operations are `read`, `update`, `insert` and "
+                  "`query`.",
+                  new StringParameter(&_workload))
+      .setIntroducedIn(31200);
+
+  options
+      ->addOption("--key-space",
+                  "The number of documents the \"mixed\" test case creates "
+                  "and operates on.",
+                  new UInt64Parameter(&_keySpace))
+      .setIntroducedIn(31200);
+
+  options
+      ->addOption("--key-distribution",
+                  "The distribution of the keys that the \"mixed\" test "
+                  "case reads and updates.",
+                  new DiscreteValuesParameter<StringParameter>(
+                      &_keyDistribution,
+                      std::unordered_set<std::string>{"uniform", "zipfian"}))
+      .setIntroducedIn(31200);
+
   options->addOption("--quiet", "suppress status messages",
                      new BooleanParameter(&_quiet));
 
@@ -282,6 +321,11 @@ void BenchFeature::validateOptions(std::shared_ptr<ProgramOptions> options) {
              "'--histogram.generate = true'.";
     }
   }
+  if (_rate < 0.0) {
+    LOG_TOPIC("3b9e1", FATAL, arangodb::Logger::BENCH)
+        << "invalid value for '--rate': " << _rate;
+    FATAL_ERROR_EXIT();
+  }
   if (!_customQueryBindVars.empty()) {
     try {
       _customQueryBindVarsBuilder = VPackParser::fromJson(_customQueryBindVars);
@@ -439,6 +483,14 @@ void BenchFeature::start() {
   // aggregated stats for all runs
   BenchmarkStats totalStats;
 
+  // time between two requests of the same thread in open-loop mode
+  double requestInterval = 0.0;
+  if (_rate > 0.0) {
+    requestInterval = static_cast<double>(_threadCount) *
+                      static_cast<double>(std::max<uint64_t>(_batchSize, 1)) /
+                      _rate;
+  }
+
   VPackBuilder builder;
   builder.openObject();
   std::vector<std::unique_ptr<BenchmarkThread>> threads;
@@ -469,7 +521,8 @@ void BenchFeature::start() {
           server(), benchmark.get(), &startCondition,
           &BenchFeature::updateStartCounter, static_cast<int>(i), _batchSize,
           &operationsCounter, client, _keepAlive, _async,
-          _histogramIntervalSize, _histogramNumIntervals, _generateHistogram);
+          _histogramIntervalSize, _histogramNumIntervals, _generateHistogram,
+          requestInterval);
       thread->setOffset(i * realStep);
       thread->start();
       threads.push_back(std::move(thread));
@@ -589,7 +642,8 @@ void BenchFeature::report(ClientFeature& client,
             << ", replication factor: " << _replicationFactor
             << ", number of shards: " << _numberOfShards
             << ", wait for sync: " << (_waitForSync ? "true" : "false")
-            << ", concurrency level (threads): " << _threadCount << std::endl;
+            << ", concurrency level (threads): " << _threadCount
+            << ", rate: " << _rate << std::endl;
 
   std::cout << "Test case: " << _testCase << ", complexity: " << _complexity
             << ", database: '" << client.databaseName() << "', collection: '"
@@ -604,6 +658,7 @@ void BenchFeature::report(ClientFeature& client,
   builder.add("numberOfShards", VPackValue(_numberOfShards));
   builder.add("waitForSync", VPackValue(_waitForSync));
   builder.add("concurrencyLevel", VPackValue(_threadCount));
+  builder.add("rate", VPackValue(_rate));
   builder.add("testCase", VPackValue(_testCase));
   builder.add("complexity", VPackValue(_complexity));
   builder.add("database", VPackValue(client.databaseName()));
@@ -669,6 +724,19 @@ void BenchFeature::report(ClientFeature& client,
   builder.add("avg", VPackValue(stats.avg()));
   builder.add("max", VPackValue(stats.max));
 
+  // percentiles of the request times of all threads and runs
+  builder.add("percentiles", VPackValue(VPackValueType::Object));
+  for (auto percentile : _percentiles) {
+    std::ostringstream name;
+    name << percentile;
+    double value = stats.percentile(percentile);
+    std::cout << "P" << name.str() << " request time: " << std::setprecision(4)
+              << (value * 1000) << "ms" << std::endl;
+    builder.add(name.str(), VPackValue(value));
+  }
+  builder.close();
+  std::cout << '\n';
+
   if (!_junitReportFile.empty()) {
     writeJunitReport(output);
   }
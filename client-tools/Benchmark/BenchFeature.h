@@ -87,6 +87,10 @@ class BenchFeature final : public ArangoBenchFeature {
     return _customQueryBindVarsBuilder;
   }
 
+  std::string const& workload() const { return _workload; }
+  std::string const& keyDistribution() const { return _keyDistribution; }
+  uint64_t keySpace() const { return _keySpace; }
+
  private:
   void status(std::string const& value);
   void report(ClientFeature& client, std::vector<BenchRunResult> const& results,
@@ -131,6 +135,13 @@ class BenchFeature final : public ArangoBenchFeature {
   std::string _customQueryBindVars;
   std::shared_ptr<VPackBuilder> _customQueryBindVarsBuilder;
 
+  std::string _workload{"read:80,update:15,query:5"};
+  std::string _keyDistribution{"zipfian"};
+  uint64_t _keySpace{100000};
+
+  // target number of operations per second (0 = as fast as possible)
+  double _rate{0.0};
+
   int* _result;
 
   uint64_t _histogramNumIntervals;
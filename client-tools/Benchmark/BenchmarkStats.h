@@ -23,6 +23,11 @@
 
 #pragma once
 
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cmath>
+#include <cstddef>
 #include <cstdint>
 #include <limits>
 #include <utility>
@@ -30,11 +35,18 @@
 namespace arangodb::arangobench {
 
 struct BenchmarkStats {
+  /// @brief number of latency buckets. latencies are tracked with
+  /// microsecond resolution in a log-linear histogram: values below 64us
+  /// are tracked exactly, larger values in 32 buckets per power of two, i.e.
+  /// with a relative error of at most ~3%. the last bucket starts at ~19h
+  static constexpr std::size_t numBuckets = 1024;
+
   constexpr BenchmarkStats() noexcept
       : min(std::numeric_limits<double>::max()),
         max(std::numeric_limits<double>::min()),
         total(0.0),
-        count(0) {}
+        count(0),
+        buckets{} {}
 
   void reset() noexcept { *this = BenchmarkStats{}; }
 
@@ -43,6 +55,7 @@ struct BenchmarkStats {
     max = std::max(max, time);
     total += time;
     ++count;
+    ++buckets[bucketFor(time)];
   }
 
   void add(BenchmarkStats const& other) noexcept {
@@ -50,14 +63,66 @@ struct BenchmarkStats {
     max = std::max(max, other.max);
     total += other.total;
     count += other.count;
+    for (std::size_t i = 0; i < numBuckets; ++i) {
+      buckets[i] += other.buckets[i];
+    }
   }
 
   double avg() const noexcept { return (count != 0) ? (total / count) : 0.0; }
 
+  /// @brief returns the latency (in seconds) that `percent` percent of all
+  /// tracked requests did not exceed
+  double percentile(double percent) const noexcept {
+    if (count == 0) {
+      return 0.0;
+    }
+    uint64_t target = static_cast<uint64_t>(
+        std::ceil(static_cast<double>(count) * percent / 100.0));
+    target = std::clamp<uint64_t>(target, 1, count);
+    uint64_t seen = 0;
+    for (std::size_t i = 0; i < numBuckets; ++i) {
+      seen += buckets[i];
+      if (seen >= target) {
+        // the last bucket has no upper bound
+        return (i + 1 < numBuckets) ? std::min(upperBound(i), max) : max;
+      }
+    }
+    return max;
+  }
+
   double min;
   double max;
   double total;
   uint64_t count;
+  std::array<uint64_t, numBuckets> buckets;
+
+ private:
+  static std::size_t bucketFor(double time) noexcept {
+    if (!(time > 0.0)) {
+      return 0;
+    }
+    double micros = time * 1000000.0;
+    if (micros >= 68719476736.0) {  // 2^36us
+      return numBuckets - 1;
+    }
+    uint64_t value = static_cast<uint64_t>(micros);
+    if (value < 64) {
+      return static_cast<std::size_t>(value);
+    }
+    int shift = 63 - std::countl_zero(value) - 5;
+    return std::min<std::size_t>(64 + (shift - 1) * 32 + (value >> shift) - 32,
+                                 numBuckets - 1);
+  }
+
+  // exclusive upper bound of a bucket, in seconds
+  static double upperBound(std::size_t bucket) noexcept {
+    if (bucket < 64) {
+      return static_cast<double>(bucket + 1) / 1000000.0;
+    }
+    std::size_t shift = (bucket - 64) / 32 + 1;
+    uint64_t sub = (bucket - 64) % 32 + 32;
+    return static_cast<double>((sub + 1) << shift) / 1000000.0;
+  }
 };
 
 }  // namespace arangodb::arangobench
@@ -23,9 +23,11 @@
 
 #pragma once
 
+#include <chrono>
 #include <cmath>
 #include <memory>
 #include <string>
+#include <thread>
 #include <vector>
 #include <shared_mutex>
 
@@ -67,7 +69,7 @@ class BenchmarkThread : public arangodb::Thread {
                   BenchmarkCounter<uint64_t>* operationsCounter,
                   ClientFeature& client, bool keepAlive, bool async,
                   double histogramIntervalSize, uint64_t histogramNumIntervals,
-                  bool generateHistogram)
+                  bool generateHistogram, double requestInterval = 0.0)
       : Thread(server, "BenchmarkThread"),
         _operation(operation),
         _startCondition(condition),
@@ -81,6 +83,8 @@ class BenchmarkThread : public arangodb::Thread {
         _async(async),
         _useVelocyPack(_batchSize == 0),
         _generateHistogram(generateHistogram),
+        _requestInterval(requestInterval),
+        _intendedStart(0.0),
         _httpClient(nullptr),
         _offset(0),
         _counter(0),
@@ -208,6 +212,10 @@ class BenchmarkThread : public arangodb::Thread {
         break;
       }
 
+      if (_requestInterval > 0.0) {
+        waitForSchedule();
+      }
+
       try {
         if (_batchSize < 1) {
           executeSingleRequest();
@@ -233,6 +241,32 @@ class BenchmarkThread : public arangodb::Thread {
   }
 
  private:
+  /// @brief wait until the next request is due in open-loop mode
+  void waitForSchedule() {
+    double now = TRI_microtime();
+    if (_intendedStart == 0.0) {
+      _intendedStart = now;
+    } else {
+      _intendedStart += _requestInterval;
+    }
+    if (_intendedStart > now) {
+      std::this_thread::sleep_for(
+          std::chrono::duration<double>(_intendedStart - now));
+    }
+  }
+
+  /// @brief returns the time from which the latency of a request is
+  /// measured. in open-loop mode, this is the time at which the request was
+  /// due according to the schedule. a slow response then also counts
+  /// towards the latencies of the requests it delayed, instead of hiding
+  /// them (coordinated omission)
+  double measureFrom(double sendTime) const noexcept {
+    if (_requestInterval > 0.0) {
+      return std::min(_intendedStart, sendTime);
+    }
+    return sendTime;
+  }
+
   /// @brief execute a batch request with numOperations parts
   void executeBatchRequest(uint64_t numOperations) {
     TRI_ASSERT(!_useVelocyPack);
@@ -287,7 +321,7 @@ class BenchmarkThread : public arangodb::Thread {
         rest::RequestType::POST, "/_api/batch", _payloadBuffer.data(),
         _payloadBuffer.size(), _headers));
 
-    double delta = TRI_microtime() - start;
+    double delta = TRI_microtime() - measureFrom(start);
     trackTime(delta);
     processResponse(result.get(), /*batch*/ true, numOperations);
 
@@ -329,7 +363,7 @@ class BenchmarkThread : public arangodb::Thread {
     double start = TRI_microtime();
     std::unique_ptr<httpclient::SimpleHttpResult> result(_httpClient->request(
         _requestData.type, _requestData.url, p, length, _headers));
-    double delta = TRI_microtime() - start;
+    double delta = TRI_microtime() - measureFrom(start);
     trackTime(delta);
     processResponse(result.get(), /*batch*/ false, 1);
 
@@ -429,6 +463,13 @@ class BenchmarkThread : public arangodb::Thread {
   /// @brief show the histogram or not
   bool const _generateHistogram;
 
+  /// @brief time (in seconds) between two requests of this thread in
+  /// open-loop mode. 0 means that requests are sent back-to-back
+  double const _requestInterval;
+
+  /// @brief time at which the current request was due in open-loop mode
+  double _intendedStart;
+
   /// @brief underlying http client
   std::unique_ptr<arangodb::httpclient::SimpleHttpClient> _httpClient;
 
@@ -32,5 +32,6 @@
 #include "testcases/DocumentCrudWriteReadTestCase.h"
 #include "testcases/DocumentImportTestCase.h"
 #include "testcases/EdgeCrudTestCase.h"
+#include "testcases/MixedWorkloadTestCase.h"
 #include "testcases/PersistentIndexTestCase.h"
 #include "testcases/VersionTestCase.h"
@@ -0,0 +1,283 @@
+////////////////////////////////////////////////////////////////////////////////
+/// DISCLAIMER
+///
+/// Copyright 2014-2023 ArangoDB GmbH, Cologne, Germany
+/// Copyright 2004-2014 triAGENS GmbH, Cologne, Germany
+///
+/// Licensed under the Apache License, Version 2.0 (the "License");
+/// you may not use this file except in compliance with the License.
+/// You may obtain a copy of the License at
+///
+///     http://www.apache.org/licenses/LICENSE-2.0
+///
+/// Unless required by applicable law or agreed to in writing, software
+/// distributed under the License is distributed on an "AS IS" BASIS,
+/// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+/// See the License for the specific language governing permissions and
+/// limitations under the License.
+///
+/// Copyright holder is ArangoDB GmbH, Cologne, Germany
+///
+/// @author Jan Steemann
+////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "Benchmark.h"
+#include "helpers.h"
+
+#include "Basics/StringUtils.h"
+#include "Logger/LogMacros.h"
+
+#include <velocypack/Builder.h>
+#include <velocypack/Value.h>
+
+#include <cmath>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace arangodb::arangobench {
+
+struct MixedWorkloadTest : public Benchmark<MixedWorkloadTest> {
+  static std::string name() { return "mixed"; }
+
+  MixedWorkloadTest(BenchFeature& arangobench)
+      : Benchmark<MixedWorkloadTest>(arangobench) {}
+
+  bool setUp(arangodb::httpclient::SimpleHttpClient* client) override {
+    if (!parseWorkload(_arangobench.workload())) {
+      return false;
+    }
+
+    _keySpace = std::max<uint64_t>(_arangobench.keySpace(), 1);
+    _zipfian = (_arangobench.keyDistribution() == "zipfian");
+    if (_zipfian) {
+      // constants for the zipfian generator as described in "Quickly
+      // Generating Billion-Record Synthetic Databases" (Gray et al.)
+      double zetan = 0.0;
+      for (uint64_t i = 1; i <= _keySpace; ++i) {
+        zetan += 1.0 / std::pow(static_cast<double>(i), zipfianConstant);
+      }
+      double zeta2 = 1.0 + std::pow(0.5, zipfianConstant);
+      _zetan = zetan;
+      _alpha = 1.0 / (1.0 - zipfianConstant);
+      _eta = (1.0 - std::pow(2.0 / static_cast<double>(_keySpace),
+                             1.0 - zipfianConstant)) /
+             (1.0 - zeta2 / zetan);
+    }
+
+    if (!_arangobench.createCollection()) {
+      // use the existing documents
+      return true;
+    }
+    if (!DeleteCollection(client, _arangobench.collection()) ||
+        !CreateCollection(client, _arangobench.collection(), 2, _arangobench) ||
+        !CreateIndex(client, _arangobench.collection(), "persistent",
+                     "[\"value\"]")) {
+      return false;
+    }
+
+    // create the documents to operate on, in batches
+    constexpr uint64_t batchSize = 1000;
+    for (uint64_t i = 0; i < _keySpace; i += batchSize) {
+      velocypack::Builder builder;
+      builder.openArray();
+      for (uint64_t j = i; j < std::min(i + batchSize, _keySpace); ++j) {
+        buildDocument(builder, j, 0);
+      }
+      builder.close();
+      if (!CreateDocument(client, _arangobench.collection(),
+                          builder.slice().toJson())) {
+        LOG_TOPIC("4f1c7", WARN, Logger::BENCH)
+            << "could not create documents for test case";
+        return false;
+      }
+    }
+    return true;
+  }
+
+  void tearDown() override {}
+
+  void buildRequest(
+      size_t threadNumber, size_t threadCounter, size_t globalCounter,
+      BenchmarkOperation::RequestData& requestData) const override {
+    // the operation and the key are derived from the counter value only, so
+    // that all threads can generate their requests independently
+    uint64_t random = mix(globalCounter);
+    uint64_t choice = random % _totalWeight;
+    Operation operation = _operations.back().first;
+    for (auto const& [op, weight] : _operations) {
+      if (choice < weight) {
+        operation = op;
+        break;
+      }
+      choice -= weight;
+    }
+
+    uint64_t keyId = nextKey(mix(random));
+    std::string const& collection = _arangobench.collection();
+
+    using namespace arangodb::velocypack;
+    switch (operation) {
+      case Operation::kRead:
+        requestData.type = rest::RequestType::GET;
+        requestData.url = "/_api/document/" + collection + "/testkey" +
+                          StringUtils::itoa(keyId);
+        break;
+
+      case Operation::kUpdate:
+        requestData.type = rest::RequestType::PATCH;
+        requestData.url = "/_api/document/" + collection + "/testkey" +
+                          StringUtils::itoa(keyId) + "?silent=true";
+        buildDocument(requestData.payload, keyId, globalCounter);
+        break;
+
+      case Operation::kInsert:
+        // inserted documents get keys outside of the key space, so they
+        // do not conflict with the existing documents
+        requestData.type = rest::RequestType::POST;
+        requestData.url = "/_api/document?collection=" + collection +
+                          "&silent=true";
+        buildDocument(requestData.payload, _keySpace + globalCounter,
+                      globalCounter);
+        break;
+
+      case Operation::kQuery:
+        requestData.type = rest::RequestType::POST;
+        requestData.url = "/_api/cursor";
+        requestData.payload.openObject();
+        requestData.payload.add(
+            "query", Value("FOR doc IN @@collection FILTER doc.value >= @lo "
+                           "&& doc.value < @hi RETURN doc"));
+        requestData.payload.add("bindVars", Value(ValueType::Object));
+        requestData.payload.add("@collection", Value(collection));
+        requestData.payload.add("lo", Value(keyId));
+        requestData.payload.add("hi", Value(keyId + queryRange));
+        requestData.payload.close();
+        requestData.payload.close();
+        break;
+    }
+  }
+
+  char const* getDescription() const noexcept override {
+    return "will perform a configurable mix of operations on a fixed set of "
+           "--key-space documents, which are created during setup. The mix "
+           "is specified via --workload as a list of operations and their "
+           "weights, e.g. \"read:80,update:15,query:5\". \"read\" fetches a "
+           "single document by key, \"update\" updates a single document, "
+           "\"insert\" inserts a new document, and \"query\" is an AQL range "
+           "query on a persistent index returning up to 100 documents. The "
+           "keys are picked according to --key-distribution, so that a few "
+           "hot keys receive the majority of operations with the zipfian "
+           "distribution. There will be a total of --requests operations. "
+           "The --complexity parameter can be used to control the number of "
+           "attributes for the inserted and updated documents. Combine with "
+           "--rate to produce an open-loop load.";
+  }
+
+  bool isDeprecated() const noexcept override { return false; }
+
+ private:
+  enum class Operation { kRead, kUpdate, kInsert, kQuery };
+
+  // skew of the zipfian distribution. this is the value YCSB uses
+  static constexpr double zipfianConstant = 0.99;
+  // number of values the range queries cover
+  static constexpr uint64_t queryRange = 100;
+
+  bool parseWorkload(std::string const& workload) {
+    _operations.clear();
+    _totalWeight = 0;
+    for (auto const& part : StringUtils::split(workload, ',')) {
+      std::string entry = StringUtils::trim(part);
+      auto pos = entry.find(':');
+      std::string_view op = std::string_view(entry).substr(0, pos);
+      uint64_t weight = 1;
+      if (pos != std::string::npos) {
+        weight = StringUtils::uint64(entry.substr(pos + 1));
+      }
+      Operation operation;
+      if (op == "read") {
+        operation = Operation::kRead;
+      } else if (op == "update") {
+        operation = Operation::kUpdate;
+      } else if (op == "insert") {
+        operation = Operation::kInsert;
+      } else if (op == "query") {
+        operation = Operation::kQuery;
+      } else {
+        LOG_TOPIC("a0e3d", FATAL, Logger::BENCH)
+            << "invalid operation '" << op << "' in --workload";
+        return false;
+      }
+      if (weight > 0) {
+        _operations.emplace_back(operation, weight);
+        _totalWeight += weight;
+      }
+    }
+    if (_totalWeight == 0) {
+      LOG_TOPIC("a0e3e", FATAL, Logger::BENCH)
+          << "--workload must contain at least one operation";
+      return false;
+    }
+    return true;
+  }
+
+  void buildDocument(velocypack::Builder& builder, uint64_t keyId,
+                     uint64_t version) const {
+    using namespace arangodb::velocypack;
+    builder.openObject();
+    builder.add(StaticStrings::KeyString,
+                Value("testkey" + StringUtils::itoa(keyId)));
+    builder.add("value", Value(keyId));
+    builder.add("version", Value(version));
+    uint64_t n = _arangobench.complexity();
+    for (uint64_t i = 1; i <= n; ++i) {
+      builder.add(std::string("value") + std::to_string(i), Value(true));
+    }
+    builder.close();
+  }
+
+  /// @brief pick a key id in [0, _keySpace) for a random value
+  uint64_t nextKey(uint64_t random) const noexcept {
+    if (!_zipfian) {
+      return random % _keySpace;
+    }
+    // uniformly distributed value in [0, 1)
+    double u = static_cast<double>(random >> 11) * 0x1.0p-53;
+    double uz = u * _zetan;
+    uint64_t rank;
+    if (uz < 1.0) {
+      rank = 0;
+    } else if (uz < 1.0 + std::pow(0.5, zipfianConstant)) {
+      rank = 1;
+    } else {
+      rank = static_cast<uint64_t>(
+          static_cast<double>(_keySpace) *
+          std::pow(_eta * u - _eta + 1.0, _alpha));
+    }
+    // spread the hot keys over the key space, so that they are not all
+    // stored next to each other
+    return mix(rank) % _keySpace;
+  }
+
+  /// @brief splitmix64 finalizer
+  static uint64_t mix(uint64_t value) noexcept {
+    value += 0x9e3779b97f4a7c15ULL;
+    value = (value ^ (value >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    value = (value ^ (value >> 27)) * 0x94d049bb133111ebULL;
+    return value ^ (value >> 31);
+  }
+
+  std::vector<std::pair<Operation, uint64_t>> _operations;
+  uint64_t _totalWeight = 0;
+  uint64_t _keySpace = 1;
+  bool _zipfian = false;
+  double _zetan = 0.0;
+  double _alpha = 0.0;
+  double _eta = 0.0;
+};
+
+}  // namespace arangodb::arangobench
@@ -48,14 +48,18 @@
 #include "SimpleHttpClient/SimpleHttpResult.h"
 #include "Ssl/SslInterface.h"
 #include "Utilities/NameValidator.h"
+#include "Utils/DumpBatchFormat.h"
 #include "Utils/ManagedDirectory.h"
 
 #include <chrono>
+#include <cstring>
 #include <thread>
+#include <unordered_map>
 
 #include <absl/strings/str_cat.h>
 #include <velocypack/Collection.h>
 #include <velocypack/Iterator.h>
+#include <velocypack/Parser.h>
 
 namespace {
 
@@ -328,6 +332,81 @@ arangodb::Result dumpJsonObjects(arangodb::DumpFeature::Stats& stats,
   return {};
 }
 
+/// @brief converts the JSON lines received from the server into a single
+/// VelocyPack batch and appends it to the dump file (--binary-format)
+arangodb::Result dumpVPackBatch(arangodb::DumpFeature::Stats& stats,
+                                arangodb::maskings::Maskings* maskings,
+                                arangodb::ManagedDirectory::File& file,
+                                arangodb::basics::StringBuffer const& body,
+                                std::string const& collectionName) {
+  arangodb::basics::StringBuffer masked(256, false);
+  char const* p = body.data();
+  char const* e = p + body.length();
+  if (maskings != nullptr) {
+    maskings->mask(collectionName, body, masked);
+    p = masked.data();
+    e = p + masked.length();
+  }
+
+  VPackBuilder batch;
+  VPackBuilder document;
+  try {
+    batch.openArray();
+    while (p < e) {
+      char const* nl = static_cast<char const*>(memchr(p, '\n', e - p));
+      if (nl == nullptr) {
+        nl = e;
+      }
+      if (nl - p > 1) {
+        document.clear();
+        VPackParser parser(document);
+        parser.parse(p, static_cast<size_t>(nl - p));
+        batch.add(document.slice());
+      }
+      p = nl + 1;
+    }
+    batch.close();
+  } catch (arangodb::velocypack::Exception const& ex) {
+    return {TRI_ERROR_HTTP_CORRUPTED_JSON,
+            arangodb::basics::StringUtils::concatT(
+                "got invalid data from server while dumping collection '",
+                collectionName, "': ", ex.what())};
+  }
+
+  if (batch.slice().isEmptyArray()) {
+    return {};
+  }
+
+  arangodb::velocypack::Buffer<uint8_t> scratch;
+  size_t length;
+  arangodb::Result res = arangodb::DumpBatchFormat::writeBatch(
+      file, batch.slice(), scratch, length);
+  if (res.ok()) {
+    stats.totalWritten += static_cast<uint64_t>(length);
+  }
+  return res;
+}
+
+/// @brief writes data received from the server to the dump file, in the
+/// configured output format
+arangodb::Result dumpData(arangodb::DumpFeature::Options const& options,
+                          arangodb::DumpFeature::Stats& stats,
+                          arangodb::maskings::Maskings* maskings,
+                          arangodb::ManagedDirectory::File& file,
+                          arangodb::basics::StringBuffer const& body,
+                          std::string const& collectionName) {
+  if (options.useBinaryFormat) {
+    return dumpVPackBatch(stats, maskings, file, body, collectionName);
+  }
+  return dumpJsonObjects(stats, maskings, file, body, collectionName);
+}
+
+/// @brief suffix of the data files in the configured output format
+std::string_view dataFileSuffix(bool binaryFormat) {
+  return binaryFormat ? arangodb::DumpBatchFormat::fileSuffix
+                      : std::string_view(".data.json");
+}
+
 /// @brief dump the actual data from an individual collection
 arangodb::Result dumpCollection(arangodb::httpclient::SimpleHttpClient& client,
                                 arangodb::DumpFeature::DumpJob& job,
@@ -420,8 +499,8 @@ arangodb::Result dumpCollection(arangodb::httpclient::SimpleHttpClient& client,
 
     // now actually write retrieved data to dump file
     arangodb::basics::StringBuffer const& body = response->getBody();
-    arangodb::Result result = dumpJsonObjects(job.stats, job.maskings, file,
-                                              body, job.collectionName);
+    arangodb::Result result = dumpData(job.options, job.stats, job.maskings,
+                                       file, body, job.collectionName);
 
     if (result.fail()) {
       return result;
@@ -446,6 +525,151 @@ arangodb::Result dumpCollection(arangodb::httpclient::SimpleHttpClient& client,
   return {TRI_ERROR_INTERNAL};
 }
 
+/// @brief dump the documents of a collection that were changed or removed
+/// after fromTick, by tailing the WAL. only the latest state of each document
+/// is dumped, in the enveloped format, so that removals can be restored as
+/// well. sets available to false and writes nothing if the changes cannot be
+/// determined from the WAL anymore, i.e. if the WAL files containing fromTick
+/// have been purged already or if the collection was truncated in between
+arangodb::Result dumpCollectionChanges(
+    arangodb::httpclient::SimpleHttpClient& client,
+    arangodb::DumpFeature::DumpJob& job, arangodb::ManagedDirectory::File& file,
+    std::string const& name, uint64_t fromTick, uint64_t toTick,
+    bool& available) {
+  using arangodb::basics::StringUtils::boolean;
+  using arangodb::basics::StringUtils::uint64;
+  using arangodb::basics::StringUtils::urlEncode;
+
+  // replication marker types, see arangod/Replication/common-defines.h
+  constexpr int markerCollectionTruncate = 2004;
+  constexpr int markerDocument = 2300;
+  constexpr int markerRemove = 2302;
+
+  available = true;
+
+  // latest change per document key, in JSON format
+  std::unordered_map<std::string, std::string> changes;
+
+  std::string const baseUrl = absl::StrCat(
+      "/_api/wal/tail?collection=", urlEncode(name), "&to=", toTick,
+      "&chunkSize=", job.options.maxChunkSize, "&serverId=", clientId,
+      "&syncerId=", syncerId);
+
+  uint64_t lastScannedTick = 0;
+  bool first = true;
+  VPackBuilder marker;
+  VPackBuilder change;
+
+  while (true) {
+    std::string const url = absl::StrCat(baseUrl, "&from=", fromTick,
+                                         "&lastScanned=", lastScannedTick);
+
+    ++job.stats.totalBatches;
+
+    std::unique_ptr<arangodb::httpclient::SimpleHttpResult> response(
+        client.request(arangodb::rest::RequestType::GET, url, nullptr, 0));
+    auto check = ::arangodb::HttpResponseChecker::check(
+        client.getErrorMessage(), response.get());
+    if (check.fail()) {
+      LOG_TOPIC("3b0f4", ERR, arangodb::Logger::DUMP)
+          << "An error occurred while dumping changes of collection '" << name
+          << "': " << check.errorMessage();
+      return check;
+    }
+
+    bool headerExtracted;
+    if (first) {
+      std::string const fromPresent = response->getHeaderField(
+          arangodb::StaticStrings::ReplicationHeaderFromPresent,
+          headerExtracted);
+      if (!headerExtracted || !boolean(fromPresent)) {
+        available = false;
+        return {};
+      }
+      first = false;
+    }
+
+    arangodb::basics::StringBuffer const& body = response->getBody();
+    char const* p = body.data();
+    char const* e = p + body.length();
+    try {
+      while (p < e) {
+        char const* nl = static_cast<char const*>(memchr(p, '\n', e - p));
+        if (nl == nullptr) {
+          nl = e;
+        }
+        if (nl - p > 1) {
+          marker.clear();
+          VPackParser parser(marker);
+          parser.parse(p, static_cast<size_t>(nl - p));
+
+          int const type =
+              arangodb::basics::VelocyPackHelper::getNumericValue<int>(
+                  marker.slice(), "type", 0);
+          if (type == markerCollectionTruncate) {
+            available = false;
+            return {};
+          }
+          VPackSlice data = marker.slice().get("data");
+          if ((type == markerDocument || type == markerRemove) &&
+              data.isObject() &&
+              data.get(arangodb::StaticStrings::KeyString).isString()) {
+            change.clear();
+            change.openObject();
+            change.add("type", VPackValue(type));
+            change.add("data", data);
+            change.close();
+            changes.insert_or_assign(
+                data.get(arangodb::StaticStrings::KeyString).copyString(),
+                change.slice().toJson());
+          }
+        }
+        p = nl + 1;
+      }
+    } catch (arangodb::velocypack::Exception const& ex) {
+      return {TRI_ERROR_HTTP_CORRUPTED_JSON,
+              arangodb::basics::StringUtils::concatT(
+                  "got invalid data from server while dumping changes of "
+                  "collection '",
+                  name, "': ", ex.what())};
+    }
+
+    bool const checkMore = boolean(response->getHeaderField(
+        arangodb::StaticStrings::ReplicationHeaderCheckMore, headerExtracted));
+    uint64_t const lastIncludedTick = uint64(response->getHeaderField(
+        arangodb::StaticStrings::ReplicationHeaderLastIncluded,
+        headerExtracted));
+    lastScannedTick = uint64(response->getHeaderField(
+        arangodb::StaticStrings::ReplicationHeaderLastScanned,
+        headerExtracted));
+
+    if (!checkMore || lastIncludedTick <= fromTick) {
+      break;
+    }
+    fromTick = lastIncludedTick;
+  }
+
+  // write out the changes in chunks
+  arangodb::basics::StringBuffer buffer(256, false);
+  for (auto const& it : changes) {
+    buffer.appendText(it.second);
+    buffer.appendChar('\n');
+    if (buffer.length() >= job.options.maxChunkSize) {
+      arangodb::Result res = dumpData(job.options, job.stats, job.maskings,
+                                      file, buffer, job.collectionName);
+      if (res.fail()) {
+        return res;
+      }
+      buffer.reset();
+    }
+  }
+  if (buffer.length() > 0) {
+    return dumpData(job.options, job.stats, job.maskings, file, buffer,
+                    job.collectionName);
+  }
+  return {};
+}
+
 /// @brief process a single job from the queue
 void processJob(arangodb::httpclient::SimpleHttpClient& client,
                 arangodb::DumpFeature::DumpJob& job) {
@@ -465,6 +689,43 @@ void processJob(arangodb::httpclient::SimpleHttpClient& client,
   }
 }
 
+/// @brief read the tick from which an incremental dump has to start from the
+/// dump.json file of the base dump
+uint64_t readIncrementalBaseTick(arangodb::EncryptionFeature* encryption,
+                                 std::string const& path) {
+  using arangodb::basics::VelocyPackHelper;
+
+  arangodb::ManagedDirectory directory(encryption, path, false, false, false);
+  VPackBuilder builder;
+  try {
+    builder = directory.vpackFromJsonFile("dump.json");
+  } catch (...) {
+  }
+
+  uint64_t tick = 0;
+  if (VPackSlice meta = builder.slice(); meta.isObject()) {
+    // dumps created by older versions only contain the tick at the start of
+    // the dump
+    tick = VelocyPackHelper::stringUInt64(meta, "snapshotTick");
+    if (tick == 0) {
+      tick = VelocyPackHelper::stringUInt64(meta, "lastTickAtDumpStart");
+    }
+  }
+
+  if (tick == 0) {
+    LOG_TOPIC("9e7c0", FATAL, arangodb::Logger::DUMP)
+        << "cannot read the tick of the base dump from '"
+        << arangodb::basics::FileUtils::buildFilename(path, "dump.json")
+        << "'";
+    FATAL_ERROR_EXIT();
+  }
+
+  LOG_TOPIC("2f0a7", INFO, arangodb::Logger::DUMP)
+      << "Dumping changes since tick " << tick << " of the base dump in '"
+      << path << "'";
+  return tick;
+}
+
 /// @brief return either the name of the database to be used as a folder name,
 /// or its id if its name contains special characters and is not fully supported
 /// in every OS
@@ -585,9 +846,11 @@ Result DumpFeature::DumpCollectionJob::run(
 
   if (res.ok() && !options.useExperimentalDump) {
     // always create the file so that arangorestore does not complain
+    // binary dump files are compressed already
     auto file = directory.writableFile(
-        absl::StrCat(escapedName, "_", hexString, ".data.json"),
-        true /*overwrite*/, 0, true /*gzipOk*/);
+        absl::StrCat(escapedName, "_", hexString,
+                     ::dataFileSuffix(options.useBinaryFormat)),
+        true /*overwrite*/, 0, /*gzipOk*/ !options.useBinaryFormat);
     if (!::fileOk(file.get())) {
       return ::fileError(file.get(), true);
     }
@@ -639,9 +902,31 @@ Result DumpFeature::DumpCollectionJob::run(
         // keep the batch alive
         ::extendBatch(client, "", batchId);
 
-        // do the hard work in another function...
-        res = ::dumpCollection(client, *this, *file, collectionName, "",
-                               batchId, options.tickStart, options.tickEnd);
+        bool dumped = false;
+        uint64_t const cid = arangodb::basics::VelocyPackHelper::extractIdValue(
+            collectionInfo.get("parameters"));
+        if (options.incrementalFromTick != 0 &&
+            cid <= options.incrementalFromTick) {
+          // collection ids are ticks, so the collection already existed when
+          // the base dump was taken. only its changes need to be dumped
+          res = ::dumpCollectionChanges(client, *this, *file, collectionName,
+                                        options.incrementalFromTick,
+                                        options.tickEnd, dumped);
+          if (res.ok() && dumped) {
+            feature.reportIncrementalCollection(collectionName);
+          } else if (res.ok()) {
+            LOG_TOPIC("6c2b8", INFO, arangodb::Logger::DUMP)
+                << "# Changes of collection '" << collectionName
+                << "' since tick " << options.incrementalFromTick
+                << " are not available, dumping it entirely";
+          }
+        }
+
+        if (res.ok() && !dumped) {
+          // do the hard work in another function...
+          res = ::dumpCollection(client, *this, *file, collectionName, "",
+                                 batchId, options.tickStart, options.tickEnd);
+        }
       }
     }
   }
@@ -779,6 +1064,24 @@ void DumpFeature::collectOptions(
   options->addOption("--tick-end", "Last tick to be included in data dump.",
                      new UInt64Parameter(&_options.tickEnd));
 
+  options
+      ->addOption("--incremental-base",
+                  "The directory of a previous dump. Only dump the documents "
+                  "that were changed or removed since that dump was taken.",
+                  new StringParameter(&_options.incrementalBase))
+      .setIntroducedIn(31200)
+      .setLongDescription(R"(The changes are read from the server's
+write-ahead log. Collections for which the write-ahead log does not contain
+all changes anymore, that were truncated, or that were created after the
+base dump are dumped entirely. Incremental dumps always use the enveloped
+data format, so that they can contain removals, and are only supported for
+single servers.
+
+To restore, apply the full dump and then each incremental dump in the order
+in which they were taken, using separate arangorestore invocations.
+arangorestore does not recreate the collections of which only changes are
+contained in an incremental dump.)");
+
   options->addOption("--maskings", "A path to a file with masking definitions.",
                      new StringParameter(&_options.maskingsFile));
 
@@ -787,6 +1090,21 @@ void DumpFeature::collectOptions(
                      "gzip format (not compatible with encryption).",
                      new BooleanParameter(&_options.useGzip));
 
+  options
+      ->addOption("--binary-format",
+                  "Store collection contents as lz4-compressed batches of "
+                  "VelocyPack documents instead of JSON lines.",
+                  new BooleanParameter(&_options.useBinaryFormat),
+                  arangodb::options::makeDefaultFlags(
+                      arangodb::options::Flags::Uncommon))
+      .setIntroducedIn(31200)
+      .setLongDescription(R"(Binary dumps are smaller and considerably
+faster to restore, because arangorestore can send the documents to the
+server as they are, without the server having to parse any JSON. The
+`--compress-output` option has no effect on binary data files. Binary dumps
+can only be restored with an arangorestore version that supports them, and
+cannot be combined with the `--envelope` option.)");
+
   options
       ->addOption("--use-experimental-dump",
                   "Enable experimental dump behavior.",
@@ -835,10 +1153,26 @@ single collection/shard from multiple files.)")
       ->addOption("--local-network-threads",
                   "Number of local network threads, i.e. how many requests "
                   "are sent in parallel.",
-                  new UInt64Parameter(&_options.dbserverWorkerThreads),
+                  new UInt64Parameter(&_options.localNetworkThreads),
                   arangodb::options::makeDefaultFlags(
                       arangodb::options::Flags::Uncommon))
       .setIntroducedIn(31200);
+
+  options
+      ->addOption("--local-network-connections",
+                  "Number of HTTP/2 connections per dbserver that the "
+                  "requests of the local network threads are multiplexed "
+                  "over.",
+                  new UInt64Parameter(&_options.localNetworkConnections),
+                  arangodb::options::makeDefaultFlags(
+                      arangodb::options::Flags::Uncommon))
+      .setLongDescription(R"(This option only has effect when the option
+`--use-experimental-dump` is set to `true`. Every connection carries many
+concurrent requests, so that the number of requests in flight, which is set
+via `--local-network-threads`, can be much higher than the number of
+connections. This helps when dumping from servers with a high network
+latency.)")
+      .setIntroducedIn(31200);
 }
 
 void DumpFeature::validateOptions(
@@ -892,12 +1226,36 @@ void DumpFeature::validateOptions(
     _options.threadCount = clamped;
   }
 
+  if (_options.useBinaryFormat && _options.useEnvelope) {
+    LOG_TOPIC("7d2a4", FATAL, arangodb::Logger::DUMP)
+        << "cannot use --binary-format and --envelope at the same time";
+    FATAL_ERROR_EXIT();
+  }
+
   if (_options.useExperimentalDump && _options.useEnvelope) {
     LOG_TOPIC("e088c", FATAL, arangodb::Logger::DUMP)
         << "cannot use --use-experimental-dump and --envelope at the same time";
     FATAL_ERROR_EXIT();
   }
 
+  if (!_options.incrementalBase.empty()) {
+    if (_options.allDatabases || _options.useBinaryFormat ||
+        _options.useExperimentalDump) {
+      LOG_TOPIC("0a9b3", FATAL, arangodb::Logger::DUMP)
+          << "cannot use --incremental-base together with --all-databases, "
+             "--binary-format or --use-experimental-dump";
+      FATAL_ERROR_EXIT();
+    }
+    if (_options.tickStart != 0 || _options.tickEnd != 0) {
+      LOG_TOPIC("c1e5d", FATAL, arangodb::Logger::DUMP)
+          << "cannot use --incremental-base together with --tick-start or "
+             "--tick-end";
+      FATAL_ERROR_EXIT();
+    }
+    // removals can only be stored in the enveloped format
+    _options.useEnvelope = true;
+  }
+
   if (_options.splitFiles && !_options.useExperimentalDump) {
     LOG_TOPIC("b0cbe", FATAL, Logger::DUMP)
         << "--split-files is only available when using "
@@ -1160,8 +1518,9 @@ Result DumpFeature::runDump(httpclient::SimpleHttpClient& client,
 
   if (_options.useExperimentalDump) {
     // now start jobs for each dbserver
-    fileProvider = std::make_shared<DumpFileProvider>(*_directory, restrictList,
-                                                      _options.splitFiles);
+    fileProvider = std::make_shared<DumpFileProvider>(
+        *_directory, restrictList, _options.splitFiles,
+        _options.useBinaryFormat);
 
     for (auto& [dbserver, shards] : shardsByServer) {
       auto job = std::make_unique<ParallelDumpServer>(
@@ -1180,11 +1539,17 @@ Result DumpFeature::runDump(httpclient::SimpleHttpClient& client,
     }
   }
 
+  if (_options.incrementalFromTick != 0) {
+    // store the final list of collections of which only the changes were
+    // dumped
+    return storeDumpJson(body, dbName);
+  }
+
   return {};
 }
 
 Result DumpFeature::storeDumpJson(VPackSlice body,
-                                  std::string const& dbName) const {
+                                  std::string const& dbName) {
   // read the server's max tick value
   std::string const tickString =
       basics::VelocyPackHelper::getStringValue(body, "tick", "");
@@ -1199,7 +1564,28 @@ Result DumpFeature::storeDumpJson(VPackSlice body,
     meta.openObject();
     meta.add("database", VPackValue(dbName));
     meta.add("lastTickAtDumpStart", VPackValue(tickString));
+    // tick of the snapshot the data was read from. this is where the changes
+    // of a later incremental dump based on this one start
+    if (VPackSlice state = body.get("state"); state.isObject()) {
+      if (VPackSlice tick = state.get("lastLogTick"); tick.isString()) {
+        meta.add("snapshotTick", tick);
+      }
+    }
     meta.add("useEnvelope", VPackValue(_options.useEnvelope));
+    if (_options.incrementalFromTick != 0) {
+      meta.add("incremental", VPackValue(VPackValueType::Object));
+      meta.add("fromTick",
+               VPackValue(std::to_string(_options.incrementalFromTick)));
+      meta.add("collections", VPackValue(VPackValueType::Array));
+      {
+        std::lock_guard lock{_incrementalLock};
+        for (auto const& name : _incrementalCollections) {
+          meta.add(VPackValue(name));
+        }
+      }
+      meta.close();
+      meta.close();
+    }
     auto props = body.get("properties");
     if (props.isObject()) {
       meta.add("properties", props);
@@ -1272,6 +1658,11 @@ void DumpFeature::reportError(Result const& error) {
   }
 }
 
+void DumpFeature::reportIncrementalCollection(std::string const& name) {
+  std::lock_guard lock{_incrementalLock};
+  _incrementalCollections.emplace_back(name);
+}
+
 ClientTaskQueue<DumpFeature::DumpJob>& DumpFeature::taskQueue() {
   return _clientTaskQueue;
 }
@@ -1369,6 +1760,16 @@ void DumpFeature::start() {
           << "Error: cannot use tick-start or tick-end on a cluster";
       FATAL_ERROR_EXIT();
     }
+    if (!_options.incrementalBase.empty()) {
+      LOG_TOPIC("f4b7e", ERR, Logger::DUMP)
+          << "Error: cannot use incremental-base on a cluster";
+      FATAL_ERROR_EXIT();
+    }
+  }
+
+  if (!_options.incrementalBase.empty()) {
+    _options.incrementalFromTick =
+        ::readIncrementalBaseTick(encryption, _options.incrementalBase);
   }
 
   if (!_options.clusterMode) {
@@ -1579,11 +1980,17 @@ Result DumpFeature::ParallelDumpServer::run(
   // create context on dbserver
   createDumpContext(client);
 
+  // the network threads share a few HTTP/2 connections, each of which
+  // multiplexes the requests of several threads
+  ClientConnectionPool pool(
+      feature.server().getFeature<HttpEndpointProvider, ClientFeature>(),
+      options.localNetworkConnections, options.localNetworkThreads);
+
   // start n network threads
   std::vector<std::thread> threads;
   for (size_t i = 0; i < options.localNetworkThreads; i++) {
-    threads.emplace_back([&, i, guard = BoundedChannelProducerGuard{queue}] {
-      runNetworkThread(i);
+    threads.emplace_back([&, guard = BoundedChannelProducerGuard{queue}] {
+      runNetworkThread(pool);
     });
   }
 
@@ -1669,65 +2076,98 @@ DumpFeature::ParallelDumpServer::ParallelDumpServer(
       server(std::move(server)),
       queue(options.localWriterThreads) {}
 
-std::unique_ptr<httpclient::SimpleHttpResult>
+std::unique_ptr<DumpFeature::ParallelDumpServer::Batch>
 DumpFeature::ParallelDumpServer::receiveNextBatch(
-    httpclient::SimpleHttpClient& client, std::uint64_t batchId,
+    ClientConnectionPool& pool, std::uint64_t batchId,
     std::optional<std::uint64_t> lastBatch) {
-  std::string url = basics::StringUtils::concatT(
-      "_api/dump/next/", dumpId, "?batchId=", batchId, "&dbserver=", server);
+  fuerte::StringMap parameters;
+  parameters.emplace("batchId", std::to_string(batchId));
+  parameters.emplace("dbserver", server);
   if (lastBatch) {
-    url += "&lastBatch=" + std::to_string(*lastBatch);
+    parameters.emplace("lastBatch", std::to_string(*lastBatch));
   }
+  std::string const path = basics::StringUtils::concatT("/_api/dump/next/",
+                                                        dumpId);
 
   std::size_t retryCounter = 100;
 
   while (true) {
-    std::unique_ptr<arangodb::httpclient::SimpleHttpResult> response(
-        client.request(arangodb::rest::RequestType::POST, url, nullptr, 0, {}));
-    auto check = ::arangodb::HttpResponseChecker::check(
-        client.getErrorMessage(), response.get());
-    if (check.fail()) {
-      LOG_TOPIC("ad972", ERR, arangodb::Logger::DUMP)
-          << "An error occurred while dumping from server '" << server
-          << "': " << check.errorMessage();
+    auto [res, response] = pool.sendRequest(
+        pool.createRequest(fuerte::RestVerb::Post, path, parameters));
 
-      bool const retry = shouldRetryRequest(response.get(), check);
-      if (!retry || --retryCounter == 0) {
-        if (retryCounter == 0) {
-          LOG_TOPIC("684ee", FATAL, Logger::DUMP) << "Too many network errors.";
-        }
-        LOG_TOPIC("5cb01", FATAL, Logger::DUMP)
-            << "Unrecoverable network/http error: " << check.errorMessage();
+    if (res.ok() && response->statusCode() == fuerte::StatusNoContent) {
+      return nullptr;
+    }
+    if (res.ok() && response->statusCode() == fuerte::StatusOK) {
+      auto batch = std::make_unique<Batch>();
+      auto payload = response->payload();
+      batch->body.appendText(static_cast<char const*>(payload.data()),
+                             payload.size());
+      bool found;
+      batch->shardId =
+          response->header.metaByKey(StaticStrings::DumpShardId, found);
+      if (!found) {
+        LOG_TOPIC("14cbf", FATAL, Logger::DUMP)
+            << "Missing header field '" << StaticStrings::DumpShardId << "'";
         FATAL_ERROR_EXIT();
       }
-    } else if (response->getHttpReturnCode() == 204) {
-      return nullptr;
-    } else if (response->getHttpReturnCode() == 200) {
-      return response;
+      // block counts from remote servers
+      auto const& counts =
+          response->header.metaByKey(StaticStrings::DumpBlockCounts, found);
+      if (found) {
+        batch->blockCounts = basics::StringUtils::int64(counts);
+      }
+      return batch;
+    }
+
+    bool retry = false;
+    if (res.fail()) {
+      // network error
+      retry = true;
+      if (res.is(TRI_ERROR_SIMPLE_CLIENT_COULD_NOT_CONNECT)) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(500));
+      }
+    } else if (response->statusCode() == fuerte::StatusServiceUnavailable ||
+               response->statusCode() == fuerte::StatusGatewayTimeout) {
+      retry = true;
+      res.reset(TRI_ERROR_CLUSTER_TIMEOUT,
+                basics::StringUtils::concatT(
+                    "got HTTP ", response->statusCode(), ": ",
+                    response->payloadAsString()));
     } else {
       LOG_TOPIC("2668f", FATAL, Logger::DUMP)
-          << "Got invalid return code: " << response->getHttpReturnCode() << " "
-          << response->getHttpReturnMessage();
+          << "Got invalid return code: " << response->statusCode() << " "
+          << response->payloadAsString();
+      FATAL_ERROR_EXIT();
+    }
+
+    LOG_TOPIC("ad972", ERR, arangodb::Logger::DUMP)
+        << "An error occurred while dumping from server '" << server
+        << "': " << res.errorMessage();
+
+    if (!retry || --retryCounter == 0) {
+      if (retryCounter == 0) {
+        LOG_TOPIC("684ee", FATAL, Logger::DUMP) << "Too many network errors.";
+      }
+      LOG_TOPIC("5cb01", FATAL, Logger::DUMP)
+          << "Unrecoverable network/http error: " << res.errorMessage();
       FATAL_ERROR_EXIT();
     }
   }
 }
 
 void DumpFeature::ParallelDumpServer::runNetworkThread(
-    size_t threadId) noexcept {
-  std::unique_ptr<httpclient::SimpleHttpClient> client;
-  clientManager.getConnectedClient(client, /* force */ true, false, false, true,
-                                   threadId);
+    ClientConnectionPool& pool) noexcept {
   std::uint64_t batchId;
   std::optional<std::uint64_t> lastBatchId;
   while (true) {
     batchId = _batchCounter.fetch_add(1);
-    auto response = receiveNextBatch(*client, batchId, lastBatchId);
-    if (response == nullptr) {
+    auto batch = receiveNextBatch(pool, batchId, lastBatchId);
+    if (batch == nullptr) {
       break;
     }
     ++stats.totalBatches;
-    auto [stopped, blocked] = queue.push(std::move(response));
+    auto [stopped, blocked] = queue.push(std::move(batch));
     if (stopped) {
       LOG_TOPIC("b3cf8", DEBUG, Logger::DUMP)
           << "network thread stopped by stopped channel";
@@ -1763,40 +2203,21 @@ void DumpFeature::ParallelDumpServer::runWriterThread() noexcept {
   };
 
   while (true) {
-    auto [response, blocked] = queue.pop();
-    if (response == nullptr) {
+    auto [batch, blocked] = queue.pop();
+    if (batch == nullptr) {
       break;
     }
     if (blocked) {
       countBlocker(kLocalQueue, 1);
     }
-    // Decode which shard this is from header field
-    arangodb::basics::StringBuffer const& body = response->getBody();
-    bool headerExtracted;
-    auto shardId =
-        response->getHeaderField(StaticStrings::DumpShardId, headerExtracted);
-    if (!headerExtracted) {
-      LOG_TOPIC("14cbf", FATAL, Logger::DUMP)
-          << "Missing header field '" << StaticStrings::DumpShardId << "'";
-      FATAL_ERROR_EXIT();
-    }
 
     // update block counts from remote servers
-    auto count = [&, &response = response]() -> int64_t {
-      bool headerExtracted;
-      auto str = response->getHeaderField(StaticStrings::DumpBlockCounts,
-                                          headerExtracted);
-      if (!headerExtracted) {
-        return 0;
-      }
-      return basics::StringUtils::int64(str);
-    }();
-
-    countBlocker(kRemoteQueue, count);
+    countBlocker(kRemoteQueue, batch->blockCounts);
 
-    auto file = getFileForShard(shardId);
-    arangodb::Result result = dumpJsonObjects(
-        stats, maskings, *file, body, shards.at(shardId).collectionName);
+    auto file = getFileForShard(batch->shardId);
+    arangodb::Result result =
+        dumpData(options, stats, maskings, *file, batch->body,
+                 shards.at(batch->shardId).collectionName);
 
     if (result.fail()) {
       LOG_TOPIC("77881", FATAL, Logger::DUMP)
@@ -1810,8 +2231,9 @@ void DumpFeature::ParallelDumpServer::runWriterThread() noexcept {
 DumpFeature::DumpFileProvider::DumpFileProvider(
     ManagedDirectory& directory,
     std::map<std::string, arangodb::velocypack::Slice>& collectionInfo,
-    bool splitFiles)
+    bool splitFiles, bool binaryFormat)
     : _splitFiles(splitFiles),
+      _binaryFormat(binaryFormat),
       _directory(directory),
       _collectionInfo(collectionInfo) {
   if (!_splitFiles) {
@@ -1827,9 +2249,10 @@ DumpFeature::DumpFileProvider::DumpFileProvider(
       std::string escapedName =
           escapedCollectionName(name, info.get("parameters"));
 
-      std::string filename = escapedName + "_" + hexString + ".data.json";
+      std::string filename = absl::StrCat(escapedName, "_", hexString,
+                                          ::dataFileSuffix(_binaryFormat));
       auto file = _directory.writableFile(filename, true /*overwrite*/, 0,
-                                          true /*gzipOk*/);
+                                          /*gzipOk*/ !_binaryFormat);
       if (file == nullptr || file->status().fail()) {
         LOG_TOPIC("40543", FATAL, Logger::DUMP)
             << "Failed to open file " << filename
@@ -1853,10 +2276,10 @@ std::shared_ptr<ManagedDirectory::File> DumpFeature::DumpFileProvider::getFile(
 
   if (_splitFiles) {
     auto cnt = _filesByCollection[name].count++;
-    std::string filename = escapedName + "_" + hexString + "." +
-                           std::to_string(cnt) + ".data.json";
+    std::string filename = absl::StrCat(escapedName, "_", hexString, ".", cnt,
+                                        ::dataFileSuffix(_binaryFormat));
     auto file = _directory.writableFile(filename, true /*overwrite*/, 0,
-                                        true /*gzipOk*/);
+                                        /*gzipOk*/ !_binaryFormat);
     if (file == nullptr || file->status().fail()) {
       LOG_TOPIC("43543", FATAL, Logger::DUMP)
           << "Failed to open file " << filename
@@ -28,7 +28,9 @@
 #include "ApplicationFeatures/ApplicationFeature.h"
 
 #include "Basics/Result.h"
+#include "Basics/StringBuffer.h"
 #include "Maskings/Maskings.h"
+#include "Utils/ClientConnectionPool.h"
 #include "Utils/ClientManager.h"
 #include "Utils/ClientTaskQueue.h"
 #include "Utils/ManagedDirectory.h"
@@ -61,6 +63,13 @@ class DumpFeature final : public ArangoDumpFeature {
    */
   void reportError(Result const& error);
 
+  /**
+   * @brief Registers a collection of which only the changes since the base
+   * dump were dumped (--incremental-base)
+   * @param name Name of the collection
+   */
+  void reportIncrementalCollection(std::string const& name);
+
   /// @brief Holds configuration data to pass between methods
   struct Options {
     std::vector<std::string> collections{};
@@ -72,6 +81,8 @@ class DumpFeature final : public ArangoDumpFeature {
     uint32_t threadCount{2};
     uint64_t tickStart{0};
     uint64_t tickEnd{0};
+    std::string incrementalBase{};
+    uint64_t incrementalFromTick{0};
     bool allDatabases{false};
     bool clusterMode{false};
     bool dumpData{true};
@@ -83,6 +94,7 @@ class DumpFeature final : public ArangoDumpFeature {
     bool progress{true};
     bool useGzip{true};
     bool useEnvelope{false};
+    bool useBinaryFormat{false};
 
     bool useExperimentalDump{false};
     bool splitFiles{false};
@@ -90,6 +102,7 @@ class DumpFeature final : public ArangoDumpFeature {
     std::uint64_t dbserverPrefetchBatches{5};
     std::uint64_t localWriterThreads{5};
     std::uint64_t localNetworkThreads{4};
+    std::uint64_t localNetworkConnections{2};
   };
 
   /// @brief Stores stats about the overall dump progress
@@ -153,7 +166,7 @@ class DumpFeature final : public ArangoDumpFeature {
     explicit DumpFileProvider(
         ManagedDirectory& directory,
         std::map<std::string, arangodb::velocypack::Slice>& collectionInfo,
-        bool splitFiles);
+        bool splitFiles, bool binaryFormat);
     std::shared_ptr<ManagedDirectory::File> getFile(
         std::string const& collection);
 
@@ -164,6 +177,7 @@ class DumpFeature final : public ArangoDumpFeature {
     };
 
     bool const _splitFiles;
+    bool const _binaryFormat;
     std::mutex _mutex;
     std::unordered_map<std::string, CollectionFiles> _filesByCollection;
     ManagedDirectory& _directory;
@@ -175,6 +189,13 @@ class DumpFeature final : public ArangoDumpFeature {
       std::string collectionName;
     };
 
+    /// @brief a batch of documents received from the server
+    struct Batch {
+      basics::StringBuffer body;
+      std::string shardId;
+      std::int64_t blockCounts{0};
+    };
+
     ParallelDumpServer(ManagedDirectory&, DumpFeature&, ClientManager&,
                        Options const& options, maskings::Maskings* maskings,
                        Stats& stats, std::shared_ptr<DumpFileProvider>,
@@ -183,11 +204,11 @@ class DumpFeature final : public ArangoDumpFeature {
 
     Result run(httpclient::SimpleHttpClient&) override;
 
-    std::unique_ptr<httpclient::SimpleHttpResult> receiveNextBatch(
-        httpclient::SimpleHttpClient&, std::uint64_t batchId,
+    std::unique_ptr<Batch> receiveNextBatch(
+        ClientConnectionPool&, std::uint64_t batchId,
         std::optional<std::uint64_t> lastBatch);
 
-    void runNetworkThread(size_t threadId) noexcept;
+    void runNetworkThread(ClientConnectionPool& pool) noexcept;
     void runWriterThread() noexcept;
 
     void createDumpContext(httpclient::SimpleHttpClient& client);
@@ -199,7 +220,7 @@ class DumpFeature final : public ArangoDumpFeature {
     std::string const server;
     std::atomic<std::uint64_t> _batchCounter{0};
     std::string dumpId;
-    BoundedChannel<arangodb::httpclient::SimpleHttpResult> queue;
+    BoundedChannel<Batch> queue;
 
     enum BlockAt { kLocalQueue = 0, kRemoteQueue = 1 };
 
@@ -220,6 +241,8 @@ class DumpFeature final : public ArangoDumpFeature {
   Stats _stats;
   std::mutex _workerErrorLock;
   std::vector<Result> _workerErrors;
+  std::mutex _incrementalLock;
+  std::vector<std::string> _incrementalCollections;
   std::unique_ptr<maskings::Maskings> _maskings;
 
   Result runClusterDump(httpclient::SimpleHttpClient& client,
@@ -232,7 +255,7 @@ class DumpFeature final : public ArangoDumpFeature {
                  std::string const& baseUrl, std::string const& dbName,
                  uint64_t batchId);
 
-  Result storeDumpJson(VPackSlice body, std::string const& dbName) const;
+  Result storeDumpJson(VPackSlice body, std::string const& dbName);
   Result storeViews(velocypack::Slice views) const;
 };
 
@@ -43,10 +43,16 @@
 #include <boost/property_tree/detail/xml_parser_utils.hpp>
 #include <velocypack/Builder.h>
 #include <velocypack/Dumper.h>
+#include <velocypack/Parser.h>
 #include <velocypack/Slice.h>
 #include <velocypack/Sink.h>
+#include <cstring>
 #include <iostream>
+#include <mutex>
+#include <optional>
 #include <regex>
+#include <thread>
+#include <unordered_map>
 #include <sys/types.h>
 #include <sys/stat.h>
 #include <fcntl.h>
@@ -60,11 +66,115 @@ using namespace arangodb::httpclient;
 using namespace arangodb::options;
 using namespace boost::property_tree::xml_parser;
 
+namespace arangodb {
+
 namespace {
 constexpr double ttlValue = 1200.;
+
+// size of the batches produced by the server for parallel exports (in bytes)
+constexpr uint64_t dumpBatchSize = 4 * 1024 * 1024;
+
+// a dump context on a single server or on one DB server, which provides
+// the documents of all exported collections (or their leader shards on this
+// DB server) from a consistent snapshot
+struct DumpContext {
+  // id of the DB server. empty for single servers
+  std::string server;
+  std::vector<std::string> shards;
+  std::string id;
+  std::atomic<uint64_t> nextBatchId{0};
+
+  std::string url(std::string path) const {
+    if (!server.empty()) {
+      path.push_back(path.find('?') == std::string::npos ? '?' : '&');
+      path.append("dbserver=");
+      path.append(StringUtils::urlEncode(server));
+    }
+    return path;
+  }
+};
+
+// name of the file written by export thread <index> for a collection
+std::string parallelFileName(std::string const& collection, size_t index,
+                             std::string const& type) {
+  return collection + "." + std::to_string(index) + "." + type;
 }
 
-namespace arangodb {
+void startDumpContext(SimpleHttpClient& httpClient, DumpContext& context,
+                      uint32_t threads) {
+  VPackBuilder builder;
+  {
+    VPackObjectBuilder ob(&builder);
+    builder.add("batchSize", VPackValue(::dumpBatchSize));
+    builder.add("prefetchCount", VPackValue(threads));
+    builder.add("parallelism", VPackValue(threads));
+    builder.add("ttl", VPackValue(::ttlValue));
+    {
+      VPackArrayBuilder ab(&builder, "shards");
+      for (auto const& shard : context.shards) {
+        builder.add(VPackValue(shard));
+      }
+    }
+  }
+  std::string const body = builder.toJson();
+
+  std::unique_ptr<SimpleHttpResult> response(
+      httpClient.request(rest::RequestType::POST,
+                         context.url("_api/dump/start"), body.c_str(),
+                         body.size()));
+  auto check = arangodb::HttpResponseChecker::check(
+      httpClient.getErrorMessage(), response.get());
+  if (check.fail()) {
+    THROW_ARANGO_EXCEPTION_MESSAGE(
+        check.errorNumber(),
+        "unable to create dump context: " + check.errorMessage());
+  }
+
+  bool found = false;
+  context.id = response->getHeaderField(StaticStrings::DumpId, found);
+  if (!found) {
+    THROW_ARANGO_EXCEPTION_MESSAGE(TRI_ERROR_INTERNAL,
+                                   "dump response did not contain a dump id");
+  }
+}
+
+// returns nullptr if the dump context is exhausted
+std::unique_ptr<SimpleHttpResult> fetchDumpBatch(
+    SimpleHttpClient& httpClient, DumpContext const& context, uint64_t batchId,
+    std::optional<uint64_t> lastBatchId) {
+  std::string path =
+      "_api/dump/next/" + context.id + "?batchId=" + std::to_string(batchId);
+  if (lastBatchId.has_value()) {
+    path += "&lastBatch=" + std::to_string(*lastBatchId);
+  }
+
+  std::unique_ptr<SimpleHttpResult> response(httpClient.request(
+      rest::RequestType::POST, context.url(std::move(path)), nullptr, 0));
+  auto check = arangodb::HttpResponseChecker::check(
+      httpClient.getErrorMessage(), response.get());
+  if (check.fail()) {
+    THROW_ARANGO_EXCEPTION(std::move(check));
+  }
+  if (response->getHttpReturnCode() ==
+      static_cast<int>(rest::ResponseCode::NO_CONTENT)) {
+    return nullptr;
+  }
+  return response;
+}
+
+void finishDumpContext(SimpleHttpClient& httpClient,
+                       DumpContext const& context) {
+  std::unique_ptr<SimpleHttpResult> response(
+      httpClient.request(rest::RequestType::DELETE_REQ,
+                         context.url("_api/dump/" + context.id), nullptr, 0));
+  auto check = arangodb::HttpResponseChecker::check(
+      httpClient.getErrorMessage(), response.get());
+  if (check.fail()) {
+    LOG_TOPIC("6e1d4", WARN, Logger::FIXME)
+        << "failed to remove dump context: " << check.errorMessage();
+  }
+}
+}  // namespace
 
 ExportFeature::ExportFeature(Server& server, int* result)
     : ArangoExportFeature{server, *this},
@@ -79,6 +189,7 @@ ExportFeature::ExportFeature(Server& server, int* result)
       _useGzip(false),
       _firstLine(true),
       _documentsPerBatch(1000),
+      _threads(1),
       _skippedDeepNested(0),
       _httpRequestsDone(0),
       _currentCollection(),
@@ -150,6 +261,16 @@ void ExportFeature::collectOptions(
                   new BooleanParameter(&_escapeCsvFormulae))
       .setIntroducedIn(30805);
 
+  options
+      ->addOption("--threads",
+                  "The number of threads used for exporting collections. "
+                  "Values greater than 1 read all collections in parallel "
+                  "from one consistent snapshot per server, and make each "
+                  "thread write its own output file per collection "
+                  "(only supported for the jsonl and csv export types).",
+                  new UInt32Parameter(&_threads))
+      .setIntroducedIn(31200);
+
   options->addOption("--overwrite",
                      "Overwrite the data in the output directory.",
                      new BooleanParameter(&_overwrite));
@@ -250,6 +371,20 @@ void ExportFeature::validateOptions(
     FATAL_ERROR_EXIT();
   }
 
+  if (_threads == 0) {
+    LOG_TOPIC("0c6a2", FATAL, Logger::CONFIG)
+        << "expecting a value of at least 1 for `--threads`";
+    FATAL_ERROR_EXIT();
+  }
+
+  if (_threads > 1 && !_collections.empty() && _graphName.empty() &&
+      _typeExport != "jsonl" && _typeExport != "csv") {
+    LOG_TOPIC("2d9a1", FATAL, Logger::CONFIG)
+        << "parallel export with `--threads` is only supported for the "
+           "jsonl and csv export types";
+    FATAL_ERROR_EXIT();
+  }
+
   if (_typeExport == "csv") {
     if (_csvFieldOptions.empty()) {
       LOG_TOPIC("76fbf", FATAL, Logger::CONFIG)
@@ -341,11 +476,25 @@ void ExportFeature::start() {
       _typeExport == "csv") {
     if (_collections.size()) {
       progressDetails = std::to_string(_collections.size()) + " collection(s)";
-      collectionExport(httpClient.get());
+      std::vector<std::string> fileNames;
+      if (_threads > 1) {
+        parallelCollectionExport(httpClient.get());
+        for (auto const& collection : _collections) {
+          for (size_t i = 0; i < _threads; ++i) {
+            fileNames.emplace_back(
+                ::parallelFileName(collection, i, _typeExport));
+          }
+        }
+      } else {
+        collectionExport(httpClient.get());
+        for (auto const& collection : _collections) {
+          fileNames.emplace_back(collection + "." + _typeExport);
+        }
+      }
 
-      for (auto const& collection : _collections) {
-        std::string filePath = _outputDirectory + TRI_DIR_SEPARATOR_STR +
-                               collection + "." + _typeExport;
+      for (auto const& fileName : fileNames) {
+        std::string filePath =
+            _outputDirectory + TRI_DIR_SEPARATOR_STR + fileName;
         if (_useGzip) {
           filePath.append(".gz");
         }  // if
@@ -384,7 +533,7 @@ void ExportFeature::start() {
   using arangodb::basics::StringUtils::formatSize;
 
   std::cout << "Processed " << progressDetails << ", wrote "
-            << formatSize(exportedSize) << ", " << _httpRequestsDone
+            << formatSize(exportedSize) << ", " << _httpRequestsDone.load()
             << " HTTP request(s)" << std::endl;
 
   *_result = ret;
@@ -452,6 +601,208 @@ void ExportFeature::collectionExport(SimpleHttpClient* httpClient) {
   }
 }
 
+void ExportFeature::parallelCollectionExport(SimpleHttpClient* httpClient) {
+  ClientFeature& client =
+      server().getFeature<HttpEndpointProvider, ClientFeature>();
+
+  std::shared_ptr<VPackBuilder> parsedBody =
+      httpCall(httpClient, "/_admin/server/role", rest::RequestType::GET);
+  bool const isCluster =
+      parsedBody->slice().get("role").isEqualString("COORDINATOR");
+
+  // shard (or collection on a single server) => index in _collections
+  std::unordered_map<std::string, size_t> collectionIndexes;
+  // one dump context per server. all exported collections are read from the
+  // same context, so that they are consistent with each other
+  std::vector<std::unique_ptr<::DumpContext>> contexts;
+
+  auto contextForServer = [&](std::string const& server) -> ::DumpContext& {
+    for (auto& context : contexts) {
+      if (context->server == server) {
+        return *context;
+      }
+    }
+    auto& context = contexts.emplace_back(std::make_unique<::DumpContext>());
+    context->server = server;
+    return *context;
+  };
+
+  for (size_t i = 0; i < _collections.size(); ++i) {
+    auto const& collection = _collections[i];
+    if (_progress) {
+      std::cout << "# Exporting collection '" << collection << "' using "
+                << _threads << " threads..." << std::endl;
+    }
+
+    if (!isCluster) {
+      contextForServer("").shards.emplace_back(collection);
+      collectionIndexes.emplace(collection, i);
+      continue;
+    }
+
+    // dump the leader shards of the collection from their DB servers
+    parsedBody = httpCall(httpClient,
+                          "_api/collection/" +
+                              StringUtils::urlEncode(collection) +
+                              "/shards?details=true",
+                          rest::RequestType::GET);
+    for (auto it : VPackObjectIterator(parsedBody->slice().get("shards"))) {
+      VPackSlice servers = it.value;
+      if (!servers.isArray() || servers.isEmptyArray()) {
+        THROW_ARANGO_EXCEPTION_MESSAGE(
+            TRI_ERROR_CLUSTER_BACKEND_UNAVAILABLE,
+            "no leader found for shard '" + it.key.copyString() +
+                "' of collection '" + collection + "'");
+      }
+      contextForServer(servers.at(0).copyString())
+          .shards.emplace_back(it.key.copyString());
+      collectionIndexes.emplace(it.key.copyString(), i);
+    }
+  }
+
+  // always remove the dump contexts on the servers, so that they do not
+  // keep their snapshots until they expire
+  auto cleanup = scopeGuard([&]() noexcept {
+    try {
+      for (auto const& context : contexts) {
+        if (!context->id.empty()) {
+          ::finishDumpContext(*httpClient, *context);
+          ++_httpRequestsDone;
+        }
+      }
+    } catch (...) {
+    }
+  });
+
+  for (auto& context : contexts) {
+    ::startDumpContext(*httpClient, *context, _threads);
+    ++_httpRequestsDone;
+  }
+
+  // every thread writes to its own file per collection, so that the threads
+  // never have to wait for each other
+  std::vector<std::vector<std::unique_ptr<ManagedDirectory::File>>> files;
+  std::vector<std::unique_ptr<SimpleHttpClient>> clients;
+  for (size_t t = 0; t < _threads; ++t) {
+    auto& threadFiles = files.emplace_back();
+    for (auto const& collection : _collections) {
+      std::string fileName = ::parallelFileName(collection, t, _typeExport);
+      auto& fd = threadFiles.emplace_back(
+          _directory->writableFile(fileName, _overwrite, 0, true));
+      if (nullptr == fd.get() || !fd->status().ok()) {
+        THROW_ARANGO_EXCEPTION_MESSAGE(
+            TRI_ERROR_CANNOT_WRITE_FILE,
+            "cannot write to file '" + fileName + "'");
+      }
+      writeFirstLine(*fd, fileName, collection);
+    }
+    clients.emplace_back(client.createHttpClient());
+  }
+
+  std::mutex errorMutex;
+  Result error;
+  std::atomic<bool> aborted{false};
+
+  auto work = [&](size_t t) {
+    try {
+      SimpleHttpClient& threadClient = *clients[t];
+      for (auto const& context : contexts) {
+        std::optional<uint64_t> lastBatchId;
+        while (!aborted.load(std::memory_order_relaxed)) {
+          uint64_t batchId = context->nextBatchId.fetch_add(1);
+          auto response =
+              ::fetchDumpBatch(threadClient, *context, batchId, lastBatchId);
+          ++_httpRequestsDone;
+          if (response == nullptr) {
+            // no more data on this server
+            break;
+          }
+
+          bool found = false;
+          std::string shard =
+              response->getHeaderField(StaticStrings::DumpShardId, found);
+          auto it = collectionIndexes.find(shard);
+          if (!found || it == collectionIndexes.end()) {
+            THROW_ARANGO_EXCEPTION_MESSAGE(
+                TRI_ERROR_INTERNAL,
+                "server returned an unexpected shard '" + shard + "'");
+          }
+
+          auto const& body = response->getBody();
+          writeDumpBatch(
+              *files[t][it->second], std::string_view(body.data(), body.size()),
+              ::parallelFileName(_collections[it->second], t, _typeExport));
+          lastBatchId = batchId;
+        }
+      }
+    } catch (basics::Exception const& ex) {
+      std::lock_guard guard(errorMutex);
+      if (error.ok()) {
+        error.reset(ex.code(), ex.what());
+      }
+      aborted.store(true);
+    } catch (std::exception const& ex) {
+      std::lock_guard guard(errorMutex);
+      if (error.ok()) {
+        error.reset(TRI_ERROR_INTERNAL, ex.what());
+      }
+      aborted.store(true);
+    }
+  };
+
+  std::vector<std::thread> threads;
+  for (size_t t = 0; t < _threads; ++t) {
+    threads.emplace_back(work, t);
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  if (error.fail()) {
+    THROW_ARANGO_EXCEPTION(error);
+  }
+}
+
+void ExportFeature::writeDumpBatch(ManagedDirectory::File& fd,
+                                   std::string_view data,
+                                   std::string const& fileName) {
+  if (_typeExport == "jsonl") {
+    // the server produces batches in JSONL format already, so there is no
+    // need to parse and stringify the documents again
+    fd.write(data.data(), data.size());
+    auto res = fd.status();
+    if (res.fail()) {
+      THROW_ARANGO_EXCEPTION(std::move(res));
+    }
+    return;
+  }
+
+  VPackBuilder documents;
+  VPackBuilder builder;
+  documents.openArray();
+
+  char const* p = data.data();
+  char const* e = p + data.size();
+  while (p < e) {
+    char const* nl = static_cast<char const*>(memchr(p, '\n', e - p));
+    size_t len = (nl == nullptr ? e : nl) - p;
+    if (len > 0) {
+      builder.clear();
+      VPackParser parser(builder, builder.options);
+      parser.parse(p, len);
+      documents.add(builder.slice());
+    }
+    if (nl == nullptr) {
+      break;
+    }
+    // advance behind newline
+    p = nl + 1;
+  }
+
+  documents.close();
+  writeBatch(fd, VPackArrayIterator(documents.slice()), fileName);
+}
+
 void ExportFeature::queryExport(SimpleHttpClient* httpClient) {
   std::string errorMsg;
 
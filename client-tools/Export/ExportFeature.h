@@ -32,6 +32,7 @@
 #include "Rest/CommonDefines.h"
 #include "Utils/ManagedDirectory.h"
 
+#include <atomic>
 #include <memory>
 
 namespace arangodb {
@@ -60,6 +61,9 @@ class ExportFeature final : public ArangoExportFeature {
 
  private:
   void collectionExport(httpclient::SimpleHttpClient* httpClient);
+  void parallelCollectionExport(httpclient::SimpleHttpClient* httpClient);
+  void writeDumpBatch(ManagedDirectory::File& fd, std::string_view data,
+                      std::string const& fileName);
   void queryExport(httpclient::SimpleHttpClient* httpClient);
   void writeFirstLine(ManagedDirectory::File& fd, std::string const& fileName,
                       std::string const& collection);
@@ -97,8 +101,9 @@ class ExportFeature final : public ArangoExportFeature {
   bool _useGzip;
   bool _firstLine;
   uint64_t _documentsPerBatch;
+  uint32_t _threads;
   uint64_t _skippedDeepNested;
-  uint64_t _httpRequestsDone;
+  std::atomic<uint64_t> _httpRequestsDone;
   std::string _currentCollection;
   std::string _currentGraph;
   std::string _customQueryBindVars;
@@ -21,6 +21,7 @@
 /// @author Matthew Von-Maszewski
 ////////////////////////////////////////////////////////////////////////////////
 
+#include <algorithm>
 #include <iostream>
 #include <thread>
 
@@ -57,6 +58,11 @@ using namespace arangodb::import;
 // release
 //  a new thread early in such cases to again encourage rate growth.
 //
+// If the server signals back-pressure (RocksDB write stalls or long scheduler
+//  queues) during a period, the batch size is halved and one sender thread
+//  less is used.  Without back-pressure, sender threads are added back one
+//  per period.
+//
 ////////////////////////////////////////////////////////////////////////////////
 
 AutoTuneThread::AutoTuneThread(application_features::ApplicationServer& server,
@@ -78,6 +84,8 @@ void AutoTuneThread::beginShutdown() {
 
 void AutoTuneThread::run() {
   constexpr uint64_t period = 2;  // seconds
+  // lower bound for the batch size when shrinking it due to back-pressure
+  constexpr uint64_t minUploadSize = 64 * 1024;
 
   while (!isStopping()) {
     {
@@ -89,23 +97,38 @@ void AutoTuneThread::run() {
       uint64_t currentMax = _importHelper.getMaxUploadSize();
       currentMax *= _importHelper.getThreadCount();
       uint64_t periodActual = _importHelper.rotatePeriodByteCount();
+      uint64_t backPressure = _importHelper.rotateBackPressureCount();
+      uint32_t activeSenders = _importHelper.getActiveSenders();
       uint64_t newMax;
 
-      // is currentMax way too big
-      if (periodActual < currentMax && period < periodActual) {
-        newMax = periodActual / period;
-      } else if (periodActual <= period) {
-        newMax = currentMax / period;
+      if (backPressure > 0) {
+        // server is overloaded. back off quickly
+        newMax = std::max(
+            currentMax / _importHelper.getThreadCount() / 2, minUploadSize);
+        if (activeSenders > 1) {
+          --activeSenders;
+        }
       } else {
-        newMax = (currentMax + periodActual / period) / 2;
+        // is currentMax way too big
+        if (periodActual < currentMax && period < periodActual) {
+          newMax = periodActual / period;
+        } else if (periodActual <= period) {
+          newMax = currentMax / period;
+        } else {
+          newMax = (currentMax + periodActual / period) / 2;
+        }
+
+        // grow number slowly (25%)
+        newMax += newMax / 4;
+
+        // make "per thread"
+        newMax /= _importHelper.getThreadCount();
+
+        if (activeSenders < _importHelper.getThreadCount()) {
+          ++activeSenders;
+        }
       }
 
-      // grow number slowly (25%)
-      newMax += newMax / 4;
-
-      // make "per thread"
-      newMax /= _importHelper.getThreadCount();
-
       // notes in Import mention an internal limit of 768MBytes
       if ((arangodb::import::ImportHelper::MaxBatchSize) < newMax) {
         newMax = arangodb::import::ImportHelper::MaxBatchSize;
@@ -113,9 +136,11 @@ void AutoTuneThread::run() {
 
       LOG_TOPIC("e815e", DEBUG, arangodb::Logger::FIXME)
           << "current: " << currentMax << ", period: " << periodActual
-          << ", new: " << newMax;
+          << ", new: " << newMax << ", back-pressure: " << backPressure
+          << ", active senders: " << activeSenders;
 
       _importHelper.setMaxUploadSize(newMax);
+      _importHelper.setActiveSenders(activeSenders);
     }
   }
 }
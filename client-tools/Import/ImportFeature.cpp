@@ -95,7 +95,9 @@ void ImportFeature::collectOptions(
 
   options->addOption("--auto-rate-limit",
                      "Adjust the data loading rate automatically, starting at "
-                     "`--batch-size` bytes per thread per second.",
+                     "`--batch-size` bytes per thread per second. Batch sizes "
+                     "and the number of sending threads are also reduced "
+                     "while the server reports write stalls or long queues.",
                      new BooleanParameter(&_autoChunkSize));
 
   options->addOption("--backslash-escape",
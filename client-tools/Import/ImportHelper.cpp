@@ -41,6 +41,7 @@
 #include <velocypack/Builder.h>
 #include <velocypack/Collection.h>
 #include <velocypack/Iterator.h>
+#include <velocypack/Parser.h>
 
 #ifdef TRI_HAVE_UNISTD_H
 #include <unistd.h>
@@ -138,6 +139,72 @@ bool isDecimal(char const* field, size_t fieldLength) {
   return true;
 }
 
+/// @brief count the line breaks in a buffer
+size_t countLines(char const* data, size_t length) {
+  size_t lines = 0;
+  char const* end = data + length;
+  // memchr is vectorized by the standard library, so this is much faster
+  // than comparing byte by byte
+  while ((data = static_cast<char const*>(memchr(data, '\n', end - data))) !=
+         nullptr) {
+    ++lines;
+    ++data;
+  }
+  return lines;
+}
+
+/// @brief parse the JSONL documents in data, remove the specified attributes
+/// from them and replace the buffer contents with the rewritten documents.
+/// this is executed by the sender threads
+void rewriteJsonLines(StringBuffer& data,
+                      std::unordered_set<std::string> const& removeAttributes,
+                      import::ImportStatistics& stats) {
+  StringBuffer output(data.length(), false);
+  size_t numErrors = 0;
+
+  char const* p = data.begin();
+  char const* e = data.end();
+  while (p < e) {
+    char const* eol = static_cast<char const*>(memchr(p, '\n', e - p));
+    if (eol == nullptr) {
+      eol = e;
+    }
+    while (p < eol && isWhitespaceCharacter(p)) {
+      ++p;
+    }
+    if (p < eol) {
+      try {
+        auto builder = VPackParser::fromJson(p, std::distance(p, eol));
+        // We are required to have an object here, otherwise the format is
+        // invalid
+        if (!builder->slice().isObject()) {
+          THROW_ARANGO_EXCEPTION(TRI_ERROR_BAD_PARAMETER);
+        }
+        auto removed =
+            VPackCollection::remove(builder->slice(), removeAttributes);
+        auto serializedObject = removed.toJson();
+        output.appendText(serializedObject.data(), serializedObject.size());
+        output.appendChar('\n');
+      } catch (...) {
+        ++numErrors;
+        // Produce a log message
+        auto keyLength = std::distance(p, eol);
+        LOG_TOPIC("ad69b", WARN, arangodb::Logger::FIXME)
+            << "invalid JSON type: "
+            << std::string_view(p, std::min<uint64_t>(keyLength, 255))
+            << (keyLength > 255 ? "..." : "");
+      }
+    }
+    p = eol + 1;
+  }
+
+  if (numErrors > 0) {
+    std::lock_guard guard{stats._mutex};
+    stats._numberErrors += numErrors;
+  }
+  data.swap(&output);
+}
+
 }  // namespace
 
 namespace arangodb {
@@ -176,6 +243,7 @@ ImportHelper::ImportHelper(EncryptionFeature* encryption,
       _periodByteCount(0),
       _autoUploadSize(autoUploadSize),
       _threadCount(threadCount),
+      _activeSenders(threadCount),
       _tempBuffer(false),
       _separator(","),
       _quote("\""),
@@ -698,9 +766,9 @@ bool ImportHelper::importJsonWithRewrite(std::string const& collectionName,
     // add a line-break
     _outputBuffer.appendChar('\n');
     if (_outputBuffer.length() > maxUploadSize) {
+      // sendJsonBuffer() copies the data, so we can reuse the buffer without
+      // waiting for the sender
       sendJsonBuffer(_outputBuffer.c_str(), _outputBuffer.length(), false);
-      waitForSenders();
-      // All send out, clear out buffer
       _outputBuffer.clear();
     }
   };
@@ -750,88 +818,54 @@ bool ImportHelper::importJsonWithRewrite(std::string const& collectionName,
       doTransformAndOutputOneDoc(doc);
     }
   } else {
-    // We are in JSONL format, now "simply" read input line by line.
-    char const* startOfNextLine = tmpBuffer.begin();
-    char const* endOfNextLine = tmpBuffer.end();
-    while (true) {
-      // Move startOfNextLine to first non-whitespace character
-      while (startOfNextLine < tmpBuffer.end() &&
-             isWhitespaceCharacter(startOfNextLine)) {
-        startOfNextLine++;
-      }
-      // endOfNext has to be at least at the start
-      endOfNextLine = startOfNextLine;
-      // Now move forward endOfLine until we reach the first line-break
-      // character, or the end of processable buffer input
-      while (endOfNextLine < tmpBuffer.end() &&
-             !isLineBreakCharacter(endOfNextLine)) {
-        endOfNextLine++;
-      }
-      if (endOfNextLine == tmpBuffer.end()) {
-        // NOT enough input, read more data from file
-        if (startOfNextLine == tmpBuffer.end()) {
-          // We consumed all of our tmp buffer.
-          // Easy case, just clear it and fill it fresh
-          tmpBuffer.clear();
-        } else {
-          // We still need to process pieces of the input
-          // Clear only the front!
-          tmpBuffer.erase_front(
-              std::distance<char const*>(tmpBuffer.begin(), startOfNextLine));
+    // We are in JSONL format. The lines are only split into batches here,
+    // and the sender threads parse and rewrite them before sending, so that
+    // the parsing scales with the number of threads.
+    auto transform = [this](StringBuffer& data) {
+      rewriteJsonLines(data, _removeAttributes, _stats);
+    };
+    while (!_hasError) {
+      if (tmpBuffer.length() > getMaxUploadSize()) {
+        // send all data before last '\n'
+        char const* first = tmpBuffer.c_str();
+        char const* pos = static_cast<char const*>(
+            memrchr(first, '\n', tmpBuffer.length()));
+
+        if (pos != nullptr) {
+          size_t len = pos - first + 1;
+          _rowsRead += countLines(first, len);
+          sendJsonBuffer(first, len, false, transform);
+          tmpBuffer.erase_front(len);
+          _rowOffset = _rowsRead;
         }
+      }
 
-        n = fd->read(tmpBuffer.end(), BUFFER_SIZE - 1);
-        if (n < 0) {
-          _errorMessages.emplace_back(TRI_LAST_ERROR_STR);
-          return false;
-        }
-        if (n == 0) {
-          break;
-        }
-        tmpBuffer.increaseLength(n);
-        reportProgress(totalLength, fd->offset(), nextProgress);
-
-        startOfNextLine = tmpBuffer.begin();
-        endOfNextLine = tmpBuffer.end();
-      } else {
-        // We now have a single line between start and end, let's throw it
-        // through the parsing process
-        try {
-          auto builder = VPackParser::fromJson(
-              startOfNextLine, std::distance(startOfNextLine, endOfNextLine));
-          // We are required to have an object here, otherwise the format is
-          // invalid
-          if (!builder->slice().isObject()) {
-            // Will be ignored in the lines below
-            // We have the option to do a more sophisticated error reporting
-            // here.
-            THROW_ARANGO_EXCEPTION(TRI_ERROR_BAD_PARAMETER);
-          }
-          doTransformAndOutputOneDoc(builder->slice());
-        } catch (...) {
-          {
-            // Count the error
-            std::lock_guard guard{_stats._mutex};
-            _stats._numberErrors++;
-          }
-          // Produce a log message
-          auto keyLength = std::distance(startOfNextLine, endOfNextLine);
-          LOG_TOPIC("ad69b", WARN, arangodb::Logger::FIXME)
-              << "invalid JSON type: "
-              << std::string_view(startOfNextLine,
-                                  std::min<uint64_t>(keyLength, 255))
-              << (keyLength > 255 ? "..." : "");
-        }
-        // Move the start forward
-        startOfNextLine = endOfNextLine;
+      if (tmpBuffer.reserve(BUFFER_SIZE) == TRI_ERROR_OUT_OF_MEMORY) {
+        _errorMessages.emplace_back(TRI_errno_string(TRI_ERROR_OUT_OF_MEMORY));
+        return false;
+      }
+      n = fd->read(tmpBuffer.end(), BUFFER_SIZE - 1);
+      if (n < 0) {
+        _errorMessages.emplace_back(TRI_LAST_ERROR_STR);
+        return false;
+      }
+      if (n == 0) {
+        break;
       }
+      tmpBuffer.increaseLength(n);
+      reportProgress(totalLength, fd->offset(), nextProgress);
+    }
+
+    if (tmpBuffer.length() > 0) {
+      _rowsRead += countLines(tmpBuffer.c_str(), tmpBuffer.length()) + 1;
+      sendJsonBuffer(tmpBuffer.c_str(), tmpBuffer.length(), false, transform);
     }
   }
 
   if (!_outputBuffer.empty()) {
     sendJsonBuffer(_outputBuffer.c_str(), _outputBuffer.length(), false);
-    waitForSenders();
   }
+  waitForSenders();
   reportProgress(totalLength, fd->offset(), nextProgress);
 
   std::lock_guard guard{_stats._mutex};
@@ -1442,6 +1476,9 @@ void ImportHelper::handleCsvBuffer(uint64_t bufferSizeThreshold) {
   if (_skipValidation) {
     url += "&"s + StaticStrings::SkipDocumentValidation + "=true";
   }
+  if (_autoUploadSize) {
+    url += "&backPressure=true";
+  }
   if (_firstChunk && _overwrite) {
     // url += "&overwrite=true";
     truncateCollection();
@@ -1459,7 +1496,8 @@ void ImportHelper::handleCsvBuffer(uint64_t bufferSizeThreshold) {
   _rowOffset = _rowsRead;
 }
 
-void ImportHelper::sendJsonBuffer(char const* str, size_t len, bool isObject) {
+void ImportHelper::sendJsonBuffer(char const* str, size_t len, bool isObject,
+                                  SenderThread::Transform const& transform) {
   if (_hasError) {
     return;
   }
@@ -1489,6 +1527,9 @@ void ImportHelper::sendJsonBuffer(char const* str, size_t len, bool isObject) {
   if (_skipValidation) {
     url += "&"s + StaticStrings::SkipDocumentValidation + "=true";
   }
+  if (_autoUploadSize) {
+    url += "&backPressure=true";
+  }
 
   _firstChunk = false;
 
@@ -1496,7 +1537,7 @@ void ImportHelper::sendJsonBuffer(char const* str, size_t len, bool isObject) {
   if (t != nullptr) {
     _tempBuffer.reset();
     _tempBuffer.appendText(str, len);
-    t->sendData(url, &_tempBuffer, _rowOffset + 1, _rowsRead);
+    t->sendData(url, &_tempBuffer, _rowOffset + 1, _rowsRead, transform);
     addPeriodByteCount(len + url.length());
   }
 }
@@ -1509,12 +1550,16 @@ SenderThread* ImportHelper::findIdleSender() {
   }
 
   while (!_senderThreads.empty()) {
-    for (auto const& t : _senderThreads) {
+    // only the first few threads may be used if the auto-tuning has reduced
+    // the concurrency. errors are collected from all threads though
+    size_t const activeSenders = getActiveSenders();
+    for (size_t i = 0; i < _senderThreads.size(); ++i) {
+      auto const& t = _senderThreads[i];
       if (t->hasError()) {
         _hasError = true;
         _errorMessages.push_back(t->errorMessage());
         return nullptr;
-      } else if (t->isIdle()) {
+      } else if (i < activeSenders && t->isIdle()) {
         return t.get();
       }
     }
@@ -30,6 +30,7 @@
 
 #include "AutoTuneThread.h"
 #include "QuickHistogram.h"
+#include "SenderThread.h"
 
 #include "Basics/Common.h"
 #include "Basics/ConditionVariable.h"
@@ -56,7 +57,6 @@ struct SimpleHttpClientParams;
 
 namespace arangodb {
 namespace import {
-class SenderThread;
 
 struct ImportStatistics {
   size_t _numberCreated = 0;
@@ -64,6 +64,10 @@ struct ImportStatistics {
   size_t _numberUpdated = 0;
   size_t _numberIgnored = 0;
 
+  // number of server responses signaling back-pressure since the last
+  // auto-tuning period. not protected by _mutex
+  std::atomic<uint64_t> _backPressureHints{0};
+
   std::mutex _mutex;
   QuickHistogram _histogram;
 
@@ -320,6 +324,19 @@ class ImportHelper {
 
   uint32_t getThreadCount() const { return _threadCount; }
 
+  // number of sender threads that may be used for sending batches. this is
+  // between 1 and the thread count and is adjusted by the auto-tuning
+  uint32_t getActiveSenders() const {
+    return _activeSenders.load(std::memory_order_relaxed);
+  }
+  void setActiveSenders(uint32_t value) {
+    _activeSenders.store(value, std::memory_order_relaxed);
+  }
+
+  uint64_t rotateBackPressureCount() {
+    return _stats._backPressureHints.exchange(0);
+  }
+
   static unsigned const MaxBatchSize;
 
  private:
@@ -346,7 +363,8 @@ class ImportHelper {
   bool truncateCollection();
 
   void handleCsvBuffer(uint64_t bufferSizeThreshold);
-  void sendJsonBuffer(char const* str, size_t len, bool isObject);
+  void sendJsonBuffer(char const* str, size_t len, bool isObject,
+                      SenderThread::Transform const& transform = nullptr);
   SenderThread* findIdleSender();
   void waitForSenders();
 
@@ -359,6 +377,7 @@ class ImportHelper {
   std::unique_ptr<AutoTuneThread> _autoTuneThread;
   std::vector<std::unique_ptr<SenderThread>> _senderThreads;
   uint32_t const _threadCount;
+  std::atomic<uint32_t> _activeSenders;
   basics::ConditionVariable _threadsCondition;
   basics::StringBuffer _tempBuffer;
 
@@ -37,6 +37,12 @@
 using namespace arangodb;
 using namespace arangodb::import;
 
+namespace {
+// queue time (in seconds) reported by the server above which we consider
+// the server to be overloaded
+constexpr double maxQueueTime = 0.5;
+}  // namespace
+
 SenderThread::SenderThread(application_features::ApplicationServer& server,
                            std::unique_ptr<httpclient::SimpleHttpClient> client,
                            ImportStatistics* stats,
@@ -64,10 +70,12 @@ void SenderThread::beginShutdown() {
 
 void SenderThread::sendData(std::string const& url,
                             arangodb::basics::StringBuffer* data,
-                            size_t lowLine, size_t highLine) {
+                            size_t lowLine, size_t highLine,
+                            Transform transform) {
   TRI_ASSERT(_idle && !_hasError);
   _url = url;
   _data.swap(data);
+  _transform = std::move(transform);
 
   // wake up the thread that may be waiting in run()
   std::lock_guard guard{_condition.mutex};
@@ -124,6 +132,10 @@ void SenderThread::run() {
       break;
     }
     try {
+      if (_transform) {
+        _transform(_data);
+        _transform = nullptr;
+      }
       if (_data.length() > 0) {
         TRI_ASSERT(!_idle && !_url.empty());
 
@@ -188,6 +200,16 @@ void SenderThread::handleResult(httpclient::SimpleHttpResult* result) {
       }
     }
 
+    // the server includes hints about its load if auto-tuning is active
+    VPackSlice const backPressure = body.get("backPressure");
+    if (backPressure.isObject() &&
+        (arangodb::basics::VelocyPackHelper::getBooleanValue(
+             backPressure, "writesStalled", false) ||
+         arangodb::basics::VelocyPackHelper::getNumericValue<double>(
+             backPressure, "queueTime", 0.0) > maxQueueTime)) {
+      _stats->_backPressureHints.fetch_add(1);
+    }
+
     {
       // first update all the statistics
       std::lock_guard guard{_stats->_mutex};
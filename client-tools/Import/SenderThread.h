@@ -49,6 +49,10 @@ class SenderThread final : public arangodb::Thread {
   SenderThread& operator=(SenderThread const&) = delete;
 
  public:
+  /// @brief optional function that rewrites the data of a batch before it
+  /// is sent. it is executed by the sender thread
+  using Transform = std::function<void(basics::StringBuffer& data)>;
+
   explicit SenderThread(application_features::ApplicationServer& server,
                         std::unique_ptr<httpclient::SimpleHttpClient>,
                         ImportStatistics* stats,
@@ -61,7 +65,8 @@ class SenderThread final : public arangodb::Thread {
   //////////////////////////////////////////////////////////////////////////////
 
   void sendData(std::string const& url, basics::StringBuffer* sender,
-                size_t lowLine = 0, size_t highLine = 0);
+                size_t lowLine = 0, size_t highLine = 0,
+                Transform transform = nullptr);
 
   bool hasError();
   /// Ready to start sending
@@ -83,6 +88,7 @@ class SenderThread final : public arangodb::Thread {
   std::function<void()> _wakeup;
   std::string _url;
   basics::StringBuffer _data;
+  Transform _transform;
   bool _hasError;
   bool _idle;
   bool _ready;
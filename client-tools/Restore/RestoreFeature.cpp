@@ -63,14 +63,15 @@
 #include "SimpleHttpClient/SimpleHttpResult.h"
 #include "Ssl/SslInterface.h"
 #include "Utilities/NameValidator.h"
+#include "Utils/DumpBatchFormat.h"
 
 #ifdef USE_ENTERPRISE
 #include "Enterprise/Encryption/EncryptionFeature.h"
 #endif
 
 namespace {
-std::regex const splitFilesRegex(".*\\.[0-9]+\\.data\\.json(\\.gz)?$",
-                                 std::regex::ECMAScript);
+std::regex const splitFilesRegex(
+    ".*\\.[0-9]+\\.data\\.(json(\\.gz)?|vpack)$", std::regex::ECMAScript);
 
 std::string escapedCollectionName(std::string const& name,
                                   VPackSlice parameters) {
@@ -365,9 +366,12 @@ void getDBProperties(arangodb::ManagedDirectory& directory,
 }
 
 /// @brief Check the database name specified by the dump file
-arangodb::Result checkDumpDatabase(arangodb::ArangoRestoreServer& server,
-                                   arangodb::ManagedDirectory& directory,
-                                   bool forceSameDatabase, bool& useEnvelope) {
+/// and the data format details of the dump
+arangodb::Result checkDumpDatabase(
+    arangodb::ArangoRestoreServer& server,
+    arangodb::ManagedDirectory& directory, bool forceSameDatabase,
+    bool& useEnvelope,
+    std::unordered_set<std::string>& incrementalCollections) {
   using arangodb::ClientFeature;
   using arangodb::HttpEndpointProvider;
   using arangodb::Logger;
@@ -381,6 +385,13 @@ arangodb::Result checkDumpDatabase(arangodb::ArangoRestoreServer& server,
     if (VPackSlice s = fileContent.get("useEnvelope"); s.isBoolean()) {
       useEnvelope = s.getBoolean();
     }
+    // collections of which an incremental dump only contains the changes
+    // since its base dump
+    if (VPackSlice s = fileContent.get("incremental"); s.isObject()) {
+      for (VPackSlice name : VPackArrayIterator(s.get("collections"))) {
+        incrementalCollections.emplace(name.copyString());
+      }
+    }
   } catch (...) {
     // the above may go wrong for several reasons
   }
@@ -568,7 +579,8 @@ arangodb::Result processInputDirectory(
     arangodb::RestoreFeature::Options const& options,
     arangodb::ManagedDirectory& directory,
     arangodb::RestoreFeature::RestoreProgressTracker& progressTracker,
-    arangodb::RestoreFeature::Stats& stats, bool useEnvelope) {
+    arangodb::RestoreFeature::Stats& stats, bool useEnvelope,
+    std::unordered_set<std::string> const& incrementalCollections) {
   using arangodb::Logger;
   using arangodb::Result;
   using arangodb::StaticStrings;
@@ -801,8 +813,10 @@ arangodb::Result processInputDirectory(
           directory, feature, progressTracker, options, stats, collection,
           useEnvelope);
 
-      // take care of collection creation now, serially
+      // take care of collection creation now, serially. the changes from an
+      // incremental dump are applied to the existing collection
       if (options.importStructure &&
+          !incrementalCollections.contains(name.copyString()) &&
           progressTracker.getStatus(name.copyString()).state <
               arangodb::RestoreFeature::CREATED) {
         Result result = ::recreateCollection(httpClient, *job);
@@ -1178,16 +1192,22 @@ Result RestoreFeature::RestoreJob::sendRestoreData(
       "/_api/replication/restore-data?collection=" + urlEncode(collectionName) +
       "&force=" + (options.force ? "true" : "false");
 
+  // binary data is sent as a VelocyPack array of documents, which the
+  // server can process without any JSON parsing
+  bool const binary = sharedState->binaryFormat;
+
   std::unordered_map<std::string, std::string> headers;
   headers.emplace(arangodb::StaticStrings::ContentTypeHeader,
-                  arangodb::StaticStrings::MimeTypeDump);
+                  binary ? arangodb::StaticStrings::MimeTypeVPack
+                         : arangodb::StaticStrings::MimeTypeDump);
 
   std::unique_ptr<SimpleHttpResult> response(client.request(
       arangodb::rest::RequestType::PUT, url, buffer, bufferSize, headers));
   arangodb::Result res = arangodb::HttpResponseChecker::check(
       client.getErrorMessage(), response.get(), "restoring data",
       std::string_view(buffer, bufferSize),
-      arangodb::HttpResponseChecker::PayloadType::JSONL);
+      binary ? arangodb::HttpResponseChecker::PayloadType::VPACK
+             : arangodb::HttpResponseChecker::PayloadType::JSONL);
 
   if (res.fail()) {
     // error
@@ -1274,22 +1294,29 @@ RestoreFeature::RestoreMainJob::RestoreMainJob(
 
 Result RestoreFeature::RestoreMainJob::run(
     arangodb::httpclient::SimpleHttpClient& client) {
-  // restore indexes first
-  arangodb::Result res = restoreIndexes(client);
+  arangodb::Result res;
+  if (!options.createIndexesAfterData) {
+    // restore indexes first
+    res = restoreIndexes(client);
+  }
   if (res.ok() && options.importData) {
     res = restoreData(client);
+  }
+  if (res.ok() && options.createIndexesAfterData) {
+    // the server builds the indexes for all documents in one go, which
+    // is cheaper than maintaining them for every document restored
+    res = restoreIndexes(client);
+  }
+  if (res.ok() && options.importData) {
+    ++stats.restoredCollections;
 
-    if (res.ok()) {
-      ++stats.restoredCollections;
-
-      if (options.progress) {
-        int type = arangodb::basics::VelocyPackHelper::getNumericValue<int>(
-            parameters, "type", 2);
-        std::string const collectionType(type == 2 ? "document" : "edge");
-        LOG_TOPIC("6ae09", INFO, arangodb::Logger::RESTORE)
-            << "# Successfully restored " << collectionType << " collection '"
-            << collectionName << "'";
-      }
+    if (options.progress) {
+      int type = arangodb::basics::VelocyPackHelper::getNumericValue<int>(
+          parameters, "type", 2);
+      std::string const collectionType(type == 2 ? "document" : "edge");
+      LOG_TOPIC("6ae09", INFO, arangodb::Logger::RESTORE)
+          << "# Successfully restored " << collectionType << " collection '"
+          << collectionName << "'";
     }
   }
 
@@ -1308,7 +1335,23 @@ Result RestoreFeature::RestoreMainJob::dispatchRestoreData(
   // data into it (which is the normal case)
   arangodb::basics::StringBuffer cleaned;
 
-  if (options.cleanupDuplicateAttributes) {
+  if (options.cleanupDuplicateAttributes && sharedState->binaryFormat) {
+    // binary data is an array of documents, which we can clean up directly
+    arangodb::velocypack::Builder result;
+    VPackSlice documents(reinterpret_cast<uint8_t const*>(data));
+    result.openArray();
+    for (VPackSlice doc : VPackArrayIterator(documents)) {
+      makeAttributesUnique(result, doc);
+    }
+    result.close();
+
+    cleaned.appendText(reinterpret_cast<char const*>(result.slice().start()),
+                       result.slice().byteSize());
+
+    // now point to the cleaned up data
+    data = cleaned.c_str();
+    length = cleaned.length();
+  } else if (options.cleanupDuplicateAttributes) {
     auto res = cleaned.reserve(length);
 
     if (res != TRI_ERROR_NO_ERROR) {
@@ -1458,6 +1501,14 @@ Result RestoreFeature::RestoreMainJob::restoreData(
   if (!datafile || datafile->status().fail()) {
     datafile = directory.readableFile(escapedName + ".data.json");
   }
+  if (!datafile || datafile->status().fail()) {
+    datafile = directory.readableFile(basics::StringUtils::concatT(
+        escapedName, "_", nameHash, DumpBatchFormat::fileSuffix));
+  }
+  if (!datafile || datafile->status().fail()) {
+    datafile = directory.readableFile(basics::StringUtils::concatT(
+        escapedName, "_", nameHash, ".0", DumpBatchFormat::fileSuffix));
+  }
   if (!datafile || datafile->status().fail()) {
     {
       std::lock_guard locker{sharedState->mutex};
@@ -1471,6 +1522,11 @@ Result RestoreFeature::RestoreMainJob::restoreData(
   TRI_ASSERT(datafile);
   // check if we are dealing with compressed file(s)
   bool const isCompressed = datafile->path().ends_with(".gz");
+  // check if we are dealing with binary file(s)
+  bool const isBinary = datafile->path().ends_with(DumpBatchFormat::fileSuffix);
+  std::string const dataFileSuffix =
+      isBinary ? std::string(DumpBatchFormat::fileSuffix)
+               : (isCompressed ? ".data.json.gz" : ".data.json");
   // check if we are dealing with multiple files (created via `--split-file
   // true`)
   bool const isMultiFile =
@@ -1522,7 +1578,7 @@ Result RestoreFeature::RestoreMainJob::restoreData(
     if (datafileReadOffset.fileNo != 0) {
       datafile = directory.readableFile(basics::StringUtils::concatT(
           escapedName, "_", nameHash, ".", datafileReadOffset.fileNo,
-          ".data.json", isCompressed ? ".gz" : ""));
+          dataFileSuffix));
       if (datafile->status().fail()) {
         return datafile->status();
       }
@@ -1534,6 +1590,17 @@ Result RestoreFeature::RestoreMainJob::restoreData(
     }
   }
 
+  if (isBinary) {
+    sharedState->binaryFormat = true;
+    arangodb::Result result = restoreBinaryData(
+        client, std::move(datafile), datafileReadOffset,
+        escapedName + "_" + nameHash, isMultiFile, fileSize);
+    if (result.ok()) {
+      waitForPendingJobs();
+    }
+    return result;
+  }
+
   // 1MB buffer by default
   size_t bufferSize = 1048576;
   if (bufferSize > options.chunkSize) {
@@ -1657,7 +1724,7 @@ Result RestoreFeature::RestoreMainJob::restoreData(
       datafileReadOffset.readOffset = 0;
       datafile = directory.readableFile(basics::StringUtils::concatT(
           escapedName, "_", nameHash, ".", datafileReadOffset.fileNo,
-          ".data.json", isCompressed ? ".gz" : ""));
+          dataFileSuffix));
       if (!datafile || datafile->status().fail()) {
         break;
       }
@@ -1668,25 +1735,107 @@ Result RestoreFeature::RestoreMainJob::restoreData(
 
   // end of main job
   if (result.ok()) {
-    while (true) {
-      {
-        std::lock_guard locker{sharedState->mutex};
-        if (sharedState->pendingJobs == 0) {
-          // no more pending jobs. we are done!
-          sharedState->readCompleteInputfile = true;
-          break;
-        }
+    waitForPendingJobs();
+  }
+
+  return result;
+}
+
+/// @brief Restore the data for a collection from binary data files, as
+/// produced by arangodump --binary-format. each batch in the data files is
+/// sent to the server as it is, so there is no need to look for line ends
+/// or to convert anything from/to JSON
+Result RestoreFeature::RestoreMainJob::restoreBinaryData(
+    arangodb::httpclient::SimpleHttpClient& client,
+    std::unique_ptr<ManagedDirectory::File> datafile,
+    MultiFileReadOffset readOffset, std::string const& filePrefix,
+    bool isMultiFile, int64_t fileSize) {
+  using arangodb::basics::StringUtils::formatSize;
+
+  arangodb::velocypack::Buffer<uint8_t> scratch;
+  arangodb::velocypack::Buffer<uint8_t> documents;
+
+  int64_t numReadForThisCollection = 0;
+  int64_t numReadSinceLastReport = 0;
+
+  while (true) {
+    size_t bytesRead;
+    arangodb::Result result =
+        DumpBatchFormat::readBatch(*datafile, scratch, documents, bytesRead);
+    if (result.fail()) {
+      return result;
+    }
+
+    if (bytesRead == 0) {  // EOF
+      if (!isMultiFile) {
+        break;
+      }
+      readOffset.fileNo += 1;
+      readOffset.readOffset = 0;
+      datafile = directory.readableFile(basics::StringUtils::concatT(
+          filePrefix, ".", readOffset.fileNo, DumpBatchFormat::fileSuffix));
+      if (!datafile || datafile->status().fail()) {
+        break;
       }
-      // we still have pending jobs, which are dispatched to other
-      // threads but not yet finished. wait for all of them to be
-      // fully processed
-      std::this_thread::sleep_for(std::chrono::milliseconds(10));
+      continue;
     }
 
-    updateProgress();
+    stats.totalRead += static_cast<uint64_t>(bytesRead);
+    numReadForThisCollection += bytesRead;
+    numReadSinceLastReport += bytesRead;
+
+    result = dispatchRestoreData(
+        client, readOffset, reinterpret_cast<char const*>(documents.data()),
+        documents.size(), /*forceDirect*/ false);
+
+    // check if our status was changed by background jobs
+    if (result.ok()) {
+      std::lock_guard locker{sharedState->mutex};
+      result = sharedState->result;
+    }
+
+    if (result.fail()) {
+      if (!options.force) {
+        return result;
+      }
+      // pretend nothing happened
+    }
+
+    readOffset.readOffset += bytesRead;
+
+    if (options.progress && fileSize > 0 &&
+        numReadSinceLastReport > 1024 * 1024 * 8) {
+      // report every 8MB of transferred data
+      LOG_TOPIC("c2a9e", INFO, Logger::RESTORE)
+          << "# Loading data into collection '" << collectionName << "', "
+          << formatSize(numReadForThisCollection) << " of "
+          << formatSize(fileSize) << " read ("
+          << int(100. * double(numReadForThisCollection) / double(fileSize))
+          << " %)";
+      numReadSinceLastReport = 0;
+    }
   }
 
-  return result;
+  return {};
+}
+
+void RestoreFeature::RestoreMainJob::waitForPendingJobs() {
+  while (true) {
+    {
+      std::lock_guard locker{sharedState->mutex};
+      if (sharedState->pendingJobs == 0) {
+        // no more pending jobs. we are done!
+        sharedState->readCompleteInputfile = true;
+        break;
+      }
+    }
+    // we still have pending jobs, which are dispatched to other
+    // threads but not yet finished. wait for all of them to be
+    // fully processed
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  }
+
+  updateProgress();
 }
 
 /// @brief Restore a collection's indexes given its description
@@ -1883,6 +2032,23 @@ void RestoreFeature::collectOptions(
                   new BooleanParameter(&_options.enableRevisionTrees))
       .setIntroducedIn(30807);
 
+  options
+      ->addOption("--create-indexes-after-data",
+                  "Create the indexes of a collection after restoring its "
+                  "data, instead of before.",
+                  new BooleanParameter(&_options.createIndexesAfterData))
+      .setIntroducedIn(31200)
+      .setLongDescription(R"(By default, the indexes of a collection are
+created before its data is restored, so that every restored document needs
+to be inserted into all indexes of the collection. If this option is set,
+the indexes are created after all data of the collection has been restored
+instead. The server can then build each index in one go, which is
+considerably faster for large collections with secondary indexes, because
+non-unique indexes are then filled via sorted .sst files.
+
+Note that this can delay the detection of unique constraint violations
+until after the data has been restored.)");
+
 #ifdef ARANGODB_ENABLE_FAILURE_TESTS
   options->addOption(
       "--fail-after-update-continue-file", "",
@@ -2301,8 +2467,10 @@ void RestoreFeature::start() {
 
     // read dump info
     bool useEnvelope = _options.useEnvelope;
+    std::unordered_set<std::string> incrementalCollections;
     result = ::checkDumpDatabase(server(), *_directory,
-                                 _options.forceSameDatabase, useEnvelope);
+                                 _options.forceSameDatabase, useEnvelope,
+                                 incrementalCollections);
     if (result.fail()) {
       LOG_TOPIC("0cbdf", FATAL, arangodb::Logger::RESTORE)
           << result.errorMessage();
@@ -2321,7 +2489,8 @@ void RestoreFeature::start() {
     try {
       result = ::processInputDirectory(*httpClient, _clientTaskQueue, *this,
                                        _options, *_directory, *_progressTracker,
-                                       _stats, useEnvelope);
+                                       _stats, useEnvelope,
+                                       incrementalCollections);
     } catch (basics::Exception const& ex) {
       LOG_TOPIC("52b22", ERR, arangodb::Logger::RESTORE)
           << "caught exception: " << ex.what();
@@ -111,6 +111,7 @@ class RestoreFeature final : public ArangoRestoreFeature {
     bool useEnvelope{false};
     bool enableRevisionTrees{true};
     bool continueRestore{false};
+    bool createIndexesAfterData{false};
 #ifdef ARANGODB_ENABLE_FAILURE_TESTS
     bool failOnUpdateContinueFile{false};
 #endif
@@ -186,6 +187,11 @@ class RestoreFeature final : public ArangoRestoreFeature {
     /// @brief whether ot not we have read the complete input data file for the
     /// collection
     bool readCompleteInputfile{false};
+
+    /// @brief whether the data files are in binary format (arangodump
+    /// --binary-format). set once by the RestoreMainJob before it dispatches
+    /// any data
+    bool binaryFormat{false};
   };
 
   /// @brief Stores all necessary data to restore a single collection or shard
@@ -227,6 +233,16 @@ class RestoreFeature final : public ArangoRestoreFeature {
 
     Result restoreData(arangodb::httpclient::SimpleHttpClient& client);
 
+    /// @brief Restore the data for a collection from binary data files
+    Result restoreBinaryData(arangodb::httpclient::SimpleHttpClient& client,
+                             std::unique_ptr<ManagedDirectory::File> datafile,
+                             MultiFileReadOffset readOffset,
+                             std::string const& filePrefix, bool isMultiFile,
+                             int64_t fileSize);
+
+    /// @brief wait until all dispatched send jobs have finished
+    void waitForPendingJobs();
+
     /// @brief Restore a collection's indexes given its description
     Result restoreIndexes(arangodb::httpclient::SimpleHttpClient& client);
 
@@ -0,0 +1,180 @@
+////////////////////////////////////////////////////////////////////////////////
+/// DISCLAIMER
+///
+/// Copyright 2014-2023 ArangoDB GmbH, Cologne, Germany
+/// Copyright 2004-2014 triAGENS GmbH, Cologne, Germany
+///
+/// Licensed under the Apache License, Version 2.0 (the "License");
+/// you may not use this file except in compliance with the License.
+/// You may obtain a copy of the License at
+///
+///     http://www.apache.org/licenses/LICENSE-2.0
+///
+/// Unless required by applicable law or agreed to in writing, software
+/// distributed under the License is distributed on an "AS IS" BASIS,
+/// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+/// See the License for the specific language governing permissions and
+/// limitations under the License.
+///
+/// Copyright holder is ArangoDB GmbH, Cologne, Germany
+///
+/// @author Jan Steemann
+////////////////////////////////////////////////////////////////////////////////
+
+#include "ClientConnectionPool.h"
+
+#include "Basics/debugging.h"
+#include "Basics/voc-errors.h"
+#include "Shell/ClientFeature.h"
+
+#include <fuerte/jwt.h>
+
+#include <algorithm>
+#include <chrono>
+
+namespace arangodb {
+
+namespace {
+ErrorCode fuerteToArangoErrorCode(fuerte::Error error) {
+  switch (error) {
+    case fuerte::Error::CouldNotConnect:
+    case fuerte::Error::ConnectionClosed:
+      return TRI_ERROR_SIMPLE_CLIENT_COULD_NOT_CONNECT;
+    case fuerte::Error::ReadError:
+      return TRI_ERROR_SIMPLE_CLIENT_COULD_NOT_READ;
+    case fuerte::Error::WriteError:
+      return TRI_ERROR_SIMPLE_CLIENT_COULD_NOT_WRITE;
+    case fuerte::Error::RequestTimeout:
+      return TRI_ERROR_CLUSTER_TIMEOUT;
+    default:
+      return TRI_ERROR_SIMPLE_CLIENT_UNKNOWN_ERROR;
+  }
+}
+}  // namespace
+
+ClientConnectionPool::ClientConnectionPool(ClientFeature& client,
+                                           std::size_t numConnections,
+                                           std::size_t maxInFlight)
+    : _client(client),
+      _databaseName(client.databaseName()),
+      _maxInFlight(std::max<std::size_t>(maxInFlight, 1)),
+      _loop(1, "ClientConnectionPool"),
+      _inFlight(0) {
+  _builder.endpoint(_client.endpoint());
+  // all requests on a connection are multiplexed as HTTP/2 streams
+  _builder.protocolType(fuerte::ProtocolType::Http2);
+  _builder.maxConnectRetries(3);
+  _builder.connectRetryPause(std::chrono::milliseconds(100));
+  _builder.connectTimeout(std::chrono::milliseconds(
+      static_cast<int64_t>(1000.0 * _client.connectionTimeout())));
+  // check jwtSecret first, as it is empty by default,
+  // but username defaults to "root" in most configurations
+  if (!_client.jwtSecret().empty()) {
+    _builder.jwtToken(
+        fuerte::jwt::generateInternalToken(_client.jwtSecret(), "arangosh"));
+    _builder.authenticationType(fuerte::AuthenticationType::Jwt);
+  } else {
+    _builder.user(_client.username()).password(_client.password());
+    _builder.authenticationType(fuerte::AuthenticationType::Basic);
+  }
+
+  // connections are established lazily on first use
+  _connections.resize(std::max<std::size_t>(numConnections, 1));
+}
+
+ClientConnectionPool::~ClientConnectionPool() {
+  {
+    std::unique_lock guard(_mutex);
+    for (auto& connection : _connections) {
+      if (connection != nullptr) {
+        connection->cancel();
+      }
+    }
+    _connections.clear();
+  }
+  _loop.stop();
+}
+
+std::unique_ptr<fuerte::Request> ClientConnectionPool::createRequest(
+    fuerte::RestVerb verb, std::string const& path,
+    fuerte::StringMap const& parameters) const {
+  auto request = fuerte::createRequest(verb, path, parameters);
+  request->header.database = _databaseName;
+  request->timeout(std::chrono::milliseconds(
+      static_cast<int64_t>(1000.0 * _client.requestTimeout())));
+  return request;
+}
+
+std::pair<Result, std::unique_ptr<fuerte::Response>>
+ClientConnectionPool::sendRequest(std::unique_ptr<fuerte::Request> request) {
+  {
+    std::unique_lock guard(_mutex);
+    _cv.wait(guard, [&] { return _inFlight < _maxInFlight; });
+    ++_inFlight;
+  }
+
+  auto releaseSlot = [&]() {
+    {
+      std::unique_lock guard(_mutex);
+      TRI_ASSERT(_inFlight > 0);
+      --_inFlight;
+    }
+    _cv.notify_one();
+  };
+
+  fuerte::Error error = fuerte::Error::NoError;
+  std::unique_ptr<fuerte::Response> response;
+  // a connection that was closed by the server in the meantime is replaced
+  // once. the request has to be copied, because sending consumes it
+  for (int attempt = 0; attempt < 2; ++attempt) {
+    auto connection = acquireConnection();
+    error = fuerte::Error::NoError;
+    try {
+      response = connection->sendRequest(
+          attempt == 0 ? std::make_unique<fuerte::Request>(*request)
+                       : std::move(request));
+    } catch (fuerte::Error const& ec) {
+      error = ec;
+    } catch (...) {
+      releaseSlot();
+      throw;
+    }
+    if (error != fuerte::Error::ConnectionClosed) {
+      break;
+    }
+  }
+  releaseSlot();
+
+  if (response == nullptr) {
+    if (error == fuerte::Error::NoError) {
+      error = fuerte::Error::ProtocolError;
+    }
+    return {Result(fuerteToArangoErrorCode(error), fuerte::to_string(error)),
+            nullptr};
+  }
+  return {Result(), std::move(response)};
+}
+
+std::shared_ptr<fuerte::Connection> ClientConnectionPool::acquireConnection() {
+  std::unique_lock guard(_mutex);
+
+  // pick the connection with the fewest outstanding requests, so that the
+  // streams are spread evenly. connections that were closed are replaced
+  std::shared_ptr<fuerte::Connection>* best = nullptr;
+  std::size_t bestLoad = 0;
+  for (auto& connection : _connections) {
+    if (connection == nullptr ||
+        connection->state() == fuerte::Connection::State::Closed) {
+      connection = _builder.connect(_loop);
+    }
+    std::size_t load = connection->requestsLeft();
+    if (best == nullptr || load < bestLoad) {
+      best = &connection;
+      bestLoad = load;
+    }
+  }
+  TRI_ASSERT(best != nullptr);
+  return *best;
+}
+
+}  // namespace arangodb
@@ -0,0 +1,90 @@
+////////////////////////////////////////////////////////////////////////////////
+/// DISCLAIMER
+///
+/// Copyright 2014-2023 ArangoDB GmbH, Cologne, Germany
+/// Copyright 2004-2014 triAGENS GmbH, Cologne, Germany
+///
+/// Licensed under the Apache License, Version 2.0 (the "License");
+/// you may not use this file except in compliance with the License.
+/// You may obtain a copy of the License at
+///
+///     http://www.apache.org/licenses/LICENSE-2.0
+///
+/// Unless required by applicable law or agreed to in writing, software
+/// distributed under the License is distributed on an "AS IS" BASIS,
+/// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+/// See the License for the specific language governing permissions and
+/// limitations under the License.
+///
+/// Copyright holder is ArangoDB GmbH, Cologne, Germany
+///
+/// @author Jan Steemann
+////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "Basics/Result.h"
+
+#include <fuerte/connection.h>
+#include <fuerte/loop.h>
+#include <fuerte/requests.h>
+#include <fuerte/types.h>
+
+#include <condition_variable>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace arangodb {
+class ClientFeature;
+
+/// @brief a small pool of fuerte HTTP/2 connections to the server the
+/// client is configured for. every connection can carry many concurrent
+/// requests (streams), so that a client tool does not need one connection
+/// per thread to keep a high number of requests in flight. this matters
+/// most for servers with a high round-trip time, for which strict
+/// request/response on a single connection is latency-bound.
+/// the pool is thread-safe. the number of connections and the maximum
+/// number of requests in flight are configured independently of each other
+/// and of the number of threads using the pool.
+class ClientConnectionPool {
+ public:
+  ClientConnectionPool(ClientFeature& client, std::size_t numConnections,
+                       std::size_t maxInFlight);
+  ~ClientConnectionPool();
+
+  ClientConnectionPool(ClientConnectionPool const&) = delete;
+  ClientConnectionPool& operator=(ClientConnectionPool const&) = delete;
+
+  /// @brief create a request for the database that was configured when the
+  /// pool was created, with the configured request timeout
+  std::unique_ptr<fuerte::Request> createRequest(
+      fuerte::RestVerb verb, std::string const& path,
+      fuerte::StringMap const& parameters = {}) const;
+
+  /// @brief send a request over the least busy connection and wait for the
+  /// response. blocks while the maximum number of requests is in flight.
+  /// a failed result is only returned for network errors; it is up to the
+  /// caller to inspect the HTTP status code of the response
+  std::pair<Result, std::unique_ptr<fuerte::Response>> sendRequest(
+      std::unique_ptr<fuerte::Request> request);
+
+ private:
+  std::shared_ptr<fuerte::Connection> acquireConnection();
+
+  ClientFeature& _client;
+  std::string const _databaseName;
+  std::size_t const _maxInFlight;
+  fuerte::EventLoopService _loop;
+  fuerte::ConnectionBuilder _builder;
+
+  std::mutex _mutex;
+  std::condition_variable _cv;
+  std::size_t _inFlight;
+  std::vector<std::shared_ptr<fuerte::Connection>> _connections;
+};
+
+}  // namespace arangodb
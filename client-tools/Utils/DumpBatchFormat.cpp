@@ -0,0 +1,164 @@
+////////////////////////////////////////////////////////////////////////////////
+/// DISCLAIMER
+///
+/// Copyright 2014-2023 ArangoDB GmbH, Cologne, Germany
+/// Copyright 2004-2014 triAGENS GmbH, Cologne, Germany
+///
+/// Licensed under the Apache License, Version 2.0 (the "License");
+/// you may not use this file except in compliance with the License.
+/// You may obtain a copy of the License at
+///
+///     http://www.apache.org/licenses/LICENSE-2.0
+///
+/// Unless required by applicable law or agreed to in writing, software
+/// distributed under the License is distributed on an "AS IS" BASIS,
+/// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+/// See the License for the specific language governing permissions and
+/// limitations under the License.
+///
+/// Copyright holder is ArangoDB GmbH, Cologne, Germany
+///
+/// @author Jan Steemann
+////////////////////////////////////////////////////////////////////////////////
+
+#include "DumpBatchFormat.h"
+
+#include "Basics/EncodingUtils.h"
+#include "Basics/Endian.h"
+#include "Basics/StringUtils.h"
+#include "Basics/voc-errors.h"
+
+#include <cstring>
+
+namespace {
+// upper bound for the compressed size of a single batch, to protect
+// against reading garbage from damaged files
+constexpr std::size_t maxCompressedSize = 1024 * 1024 * 1024;
+
+arangodb::Result readFully(arangodb::ManagedDirectory::File& file, char* data,
+                           std::size_t length, std::size_t& bytesRead) {
+  bytesRead = 0;
+  while (bytesRead < length) {
+    auto n = file.read(data + bytesRead, length - bytesRead);
+    if (file.status().fail()) {
+      return file.status();
+    }
+    if (n <= 0) {
+      // end of file
+      break;
+    }
+    bytesRead += static_cast<std::size_t>(n);
+  }
+  return {};
+}
+
+arangodb::Result truncatedFile(arangodb::ManagedDirectory::File& file) {
+  return {TRI_ERROR_ARANGO_CORRUPTED_DATAFILE,
+          arangodb::basics::StringUtils::concatT(
+              "unexpected end of binary dump file '", file.path(), "'")};
+}
+}  // namespace
+
+namespace arangodb {
+
+Result DumpBatchFormat::writeBatch(ManagedDirectory::File& file,
+                                   velocypack::Slice documents,
+                                   velocypack::Buffer<uint8_t>& scratch,
+                                   std::size_t& bytesWritten) {
+  TRI_ASSERT(documents.isArray());
+  bytesWritten = 0;
+
+  velocypack::Buffer<uint8_t> compressed;
+  if (auto res =
+          encoding::lz4Compress(documents.start(), documents.byteSize(),
+                                compressed);
+      res != TRI_ERROR_NO_ERROR) {
+    return {res, "unable to compress dump batch"};
+  }
+
+  std::uint32_t header[3] = {
+      basics::hostToBig<std::uint32_t>(magic),
+      basics::hostToBig<std::uint32_t>(
+          static_cast<std::uint32_t>(compressed.size())),
+      basics::hostToBig<std::uint32_t>(
+          static_cast<std::uint32_t>(documents.length()))};
+  static_assert(sizeof(header) == headerSize);
+
+  // header and data are written in a single call, because multiple
+  // threads may append to the same file
+  scratch.clear();
+  scratch.reserve(headerSize + compressed.size());
+  scratch.append(reinterpret_cast<char const*>(&header[0]), headerSize);
+  scratch.append(compressed.data(), compressed.size());
+
+  file.write(reinterpret_cast<char const*>(scratch.data()), scratch.size());
+  if (file.status().fail()) {
+    return {TRI_ERROR_CANNOT_WRITE_FILE,
+            basics::StringUtils::concatT("cannot write file '", file.path(),
+                                         "': ", file.status().errorMessage())};
+  }
+  bytesWritten = scratch.size();
+  return {};
+}
+
+Result DumpBatchFormat::readBatch(ManagedDirectory::File& file,
+                                  velocypack::Buffer<uint8_t>& scratch,
+                                  velocypack::Buffer<uint8_t>& documents,
+                                  std::size_t& bytesRead) {
+  bytesRead = 0;
+  documents.clear();
+
+  std::uint32_t header[3];
+  std::size_t n;
+  if (auto res = readFully(file, reinterpret_cast<char*>(&header[0]),
+                           headerSize, n);
+      res.fail()) {
+    return res;
+  }
+  if (n == 0) {
+    // end of file
+    return {};
+  }
+  if (n != headerSize) {
+    return truncatedFile(file);
+  }
+  if (basics::bigToHost<std::uint32_t>(header[0]) != magic) {
+    return {TRI_ERROR_ARANGO_CORRUPTED_DATAFILE,
+            basics::StringUtils::concatT("invalid batch header in binary "
+                                         "dump file '",
+                                         file.path(), "'")};
+  }
+  std::size_t length = basics::bigToHost<std::uint32_t>(header[1]);
+  if (length > ::maxCompressedSize) {
+    return {TRI_ERROR_ARANGO_CORRUPTED_DATAFILE,
+            basics::StringUtils::concatT("invalid batch length in binary "
+                                         "dump file '",
+                                         file.path(), "'")};
+  }
+
+  scratch.clear();
+  scratch.reserve(length);
+  if (auto res =
+          readFully(file, reinterpret_cast<char*>(scratch.data()), length, n);
+      res.fail()) {
+    return res;
+  }
+  if (n != length) {
+    return truncatedFile(file);
+  }
+  scratch.resetTo(length);
+
+  if (auto res = encoding::lz4Uncompress(scratch.data(), scratch.size(),
+                                         documents);
+      res != TRI_ERROR_NO_ERROR) {
+    return {TRI_ERROR_ARANGO_CORRUPTED_DATAFILE,
+            basics::StringUtils::concatT("unable to uncompress batch in "
+                                         "binary dump file '",
+                                         file.path(), "'")};
+  }
+
+  bytesRead = headerSize + length;
+  return {};
+}
+
+}  // namespace arangodb
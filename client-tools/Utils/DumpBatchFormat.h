@@ -0,0 +1,76 @@
+////////////////////////////////////////////////////////////////////////////////
+/// DISCLAIMER
+///
+/// Copyright 2014-2023 ArangoDB GmbH, Cologne, Germany
+/// Copyright 2004-2014 triAGENS GmbH, Cologne, Germany
+///
+/// Licensed under the Apache License, Version 2.0 (the "License");
+/// you may not use this file except in compliance with the License.
+/// You may obtain a copy of the License at
+///
+///     http://www.apache.org/licenses/LICENSE-2.0
+///
+/// Unless required by applicable law or agreed to in writing, software
+/// distributed under the License is distributed on an "AS IS" BASIS,
+/// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+/// See the License for the specific language governing permissions and
+/// limitations under the License.
+///
+/// Copyright holder is ArangoDB GmbH, Cologne, Germany
+///
+/// @author Jan Steemann
+////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "Basics/Result.h"
+#include "Utils/ManagedDirectory.h"
+
+#include <velocypack/Buffer.h>
+#include <velocypack/Slice.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+namespace arangodb {
+
+/// @brief binary format for the collection data in dumps (arangodump
+/// --binary-format). the data file of a collection is a sequence of
+/// batches, each of which consists of a fixed-size header and an
+/// lz4-compressed VelocyPack array with the documents of the batch:
+///   - 4 bytes magic value
+///   - 4 bytes length of the compressed data (big endian)
+///   - 4 bytes number of documents in the batch (big endian)
+///   - compressed data
+/// the headers allow readers to hop from batch to batch without
+/// decompressing or parsing anything, and arangorestore can send the
+/// documents of a batch to the server as they are, without converting
+/// them from/to JSON.
+struct DumpBatchFormat {
+  /// @brief suffix for data files in binary format
+  static constexpr std::string_view fileSuffix = ".data.vpack";
+
+  static constexpr std::uint32_t magic = 0x41444231;  // "ADB1"
+  static constexpr std::size_t headerSize = 3 * sizeof(std::uint32_t);
+
+  /// @brief append a batch with the documents in `documents` (which must
+  /// be an array) to the file. `scratch` is used as a temporary buffer
+  /// and can be reused between calls. returns the number of bytes written
+  /// in `bytesWritten`
+  static Result writeBatch(ManagedDirectory::File& file,
+                           velocypack::Slice documents,
+                           velocypack::Buffer<uint8_t>& scratch,
+                           std::size_t& bytesWritten);
+
+  /// @brief read the next batch from the file and store the uncompressed
+  /// VelocyPack array of its documents in `documents`. returns the number
+  /// of bytes read from the file in `bytesRead`, which is 0 at the end of
+  /// the file
+  static Result readBatch(ManagedDirectory::File& file,
+                          velocypack::Buffer<uint8_t>& scratch,
+                          velocypack::Buffer<uint8_t>& documents,
+                          std::size_t& bytesRead);
+};
+
+}  // namespace arangodb
@@ -48,5 +48,18 @@ template<typename T>
 [[nodiscard]] ErrorCode gzipDeflate(uint8_t const* uncompressed,
                                     size_t uncompressedLength, T& compressed);
 
+/// @brief compress data with lz4. the result consists of the uncompressed
+/// length (4 bytes, big endian) followed by a single lz4 block. this is fast
+/// enough for latency-sensitive cluster-internal traffic
+template<typename T>
+[[nodiscard]] ErrorCode lz4Compress(uint8_t const* uncompressed,
+                                    size_t uncompressedLength, T& compressed);
+
+/// @brief uncompress data produced by lz4Compress
+template<typename T>
+[[nodiscard]] ErrorCode lz4Uncompress(uint8_t const* compressed,
+                                      size_t compressedLength,
+                                      T& uncompressed);
+
 }  // namespace encoding
 }  // namespace arangodb
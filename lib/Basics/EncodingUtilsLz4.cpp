@@ -0,0 +1,124 @@
+////////////////////////////////////////////////////////////////////////////////
+/// DISCLAIMER
+///
+/// Copyright 2014-2023 ArangoDB GmbH, Cologne, Germany
+/// Copyright 2004-2014 triAGENS GmbH, Cologne, Germany
+///
+/// Licensed under the Apache License, Version 2.0 (the "License");
+/// you may not use this file except in compliance with the License.
+/// You may obtain a copy of the License at
+///
+///     http://www.apache.org/licenses/LICENSE-2.0
+///
+/// Unless required by applicable law or agreed to in writing, software
+/// distributed under the License is distributed on an "AS IS" BASIS,
+/// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+/// See the License for the specific language governing permissions and
+/// limitations under the License.
+///
+/// Copyright holder is ArangoDB GmbH, Cologne, Germany
+///
+/// @author Jan Steemann
+////////////////////////////////////////////////////////////////////////////////
+
+// the lz4 functions live in their own file, so that only executables which
+// use them need to link against lz4
+
+#include "EncodingUtils.h"
+#include "Basics/Endian.h"
+#include "Basics/voc-errors.h"
+
+#include <velocypack/Buffer.h>
+
+#include <lz4.h>
+
+#include <cstring>
+#include <string>
+
+namespace {
+constexpr size_t maxUncompressedSize = 512 * 1024 * 1024;
+}  // namespace
+
+namespace arangodb {
+
+template<typename T>
+ErrorCode encoding::lz4Compress(uint8_t const* uncompressed,
+                                size_t uncompressedLength, T& compressed) {
+  compressed.clear();
+
+  if (uncompressedLength > ::maxUncompressedSize) {
+    return TRI_ERROR_BAD_PARAMETER;
+  }
+  int maxLength = LZ4_compressBound(static_cast<int>(uncompressedLength));
+  if (maxLength <= 0) {
+    return TRI_ERROR_BAD_PARAMETER;
+  }
+
+  try {
+    compressed.reserve(sizeof(uint32_t) + static_cast<size_t>(maxLength));
+    uint32_t length =
+        basics::hostToBig(static_cast<uint32_t>(uncompressedLength));
+    compressed.append(reinterpret_cast<char const*>(&length), sizeof(length));
+
+    std::string scratch;
+    scratch.resize(static_cast<size_t>(maxLength));
+    int compressedSize = LZ4_compress_default(
+        reinterpret_cast<char const*>(uncompressed), scratch.data(),
+        static_cast<int>(uncompressedLength), maxLength);
+    if (compressedSize <= 0) {
+      compressed.clear();
+      return TRI_ERROR_INTERNAL;
+    }
+    compressed.append(scratch.data(), static_cast<size_t>(compressedSize));
+  } catch (...) {
+    compressed.clear();
+    return TRI_ERROR_OUT_OF_MEMORY;
+  }
+  return TRI_ERROR_NO_ERROR;
+}
+
+template<typename T>
+ErrorCode encoding::lz4Uncompress(uint8_t const* compressed,
+                                  size_t compressedLength, T& uncompressed) {
+  uncompressed.clear();
+
+  uint32_t length;
+  if (compressedLength < sizeof(length)) {
+    return TRI_ERROR_BAD_PARAMETER;
+  }
+  memcpy(&length, compressed, sizeof(length));
+  length = basics::bigToHost<uint32_t>(length);
+  if (length > ::maxUncompressedSize) {
+    return TRI_ERROR_OUT_OF_MEMORY;
+  }
+
+  try {
+    std::string scratch;
+    scratch.resize(length);
+    int decompressedSize = LZ4_decompress_safe(
+        reinterpret_cast<char const*>(compressed) + sizeof(length),
+        scratch.data(), static_cast<int>(compressedLength - sizeof(length)),
+        static_cast<int>(length));
+    if (decompressedSize < 0 ||
+        static_cast<uint32_t>(decompressedSize) != length) {
+      return TRI_ERROR_BAD_PARAMETER;
+    }
+    uncompressed.append(scratch.data(), length);
+  } catch (...) {
+    uncompressed.clear();
+    return TRI_ERROR_OUT_OF_MEMORY;
+  }
+  return TRI_ERROR_NO_ERROR;
+}
+
+// template instantiations
+template ErrorCode encoding::lz4Compress<arangodb::velocypack::Buffer<uint8_t>>(
+    uint8_t const* uncompressed, size_t uncompressedLength,
+    arangodb::velocypack::Buffer<uint8_t>& compressed);
+
+template ErrorCode
+encoding::lz4Uncompress<arangodb::velocypack::Buffer<uint8_t>>(
+    uint8_t const* compressed, size_t compressedLength,
+    arangodb::velocypack::Buffer<uint8_t>& uncompressed);
+
+}  // namespace arangodb
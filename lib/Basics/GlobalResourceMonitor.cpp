@@ -56,6 +56,8 @@ GlobalResourceMonitor::Stats GlobalResourceMonitor::stats() const noexcept {
       _globalLimitReachedCounter.load(std::memory_order_relaxed);
   stats.localLimitReached =
       _localLimitReachedCounter.load(std::memory_order_relaxed);
+  stats.nestedLimitReached =
+      _nestedLimitReachedCounter.load(std::memory_order_relaxed);
   return stats;
 }
 
@@ -67,12 +69,34 @@ void GlobalResourceMonitor::trackGlobalViolation() noexcept {
 /// @brief increase the counter for local memory limit violations
 void GlobalResourceMonitor::trackLocalViolation() noexcept {
   _localLimitReachedCounter.fetch_add(1, std::memory_order_relaxed);
+  if (_parent != nullptr) {
+    _parent->trackLocalViolation();
+  }
 }
 
 /// @brief increase global memory usage by <value> bytes. if increasing exceeds
-/// the memory limit, does not perform the increase and returns false. if
-/// increasing succeeds, the global value is modified and true is returned
+/// the memory limit of this monitor or any of its parents, does not perform
+/// the increase and returns false. if increasing succeeds, the global value
+/// is modified and true is returned
 bool GlobalResourceMonitor::increaseMemoryUsage(std::int64_t value) noexcept {
+  if (!increaseOwnMemoryUsage(value)) {
+    trackGlobalViolation();
+    for (auto* p = _parent; p != nullptr; p = p->_parent) {
+      p->_nestedLimitReachedCounter.fetch_add(1, std::memory_order_relaxed);
+    }
+    return false;
+  }
+  if (_parent != nullptr && !_parent->increaseMemoryUsage(value)) {
+    // the parent's limit was reached. the parent has already counted the
+    // violation
+    _current.fetch_sub(value, std::memory_order_relaxed);
+    return false;
+  }
+  return true;
+}
+
+bool GlobalResourceMonitor::increaseOwnMemoryUsage(
+    std::int64_t value) noexcept {
   TRI_ASSERT(value >= 0);
   if (_limit == 0) {
     // since we have no limit, we can simply use fetch-add for the increment
@@ -97,11 +121,17 @@ bool GlobalResourceMonitor::increaseMemoryUsage(std::int64_t value) noexcept {
 void GlobalResourceMonitor::decreaseMemoryUsage(std::int64_t value) noexcept {
   TRI_ASSERT(value >= 0);
   _current.fetch_sub(value, std::memory_order_relaxed);
+  if (_parent != nullptr) {
+    _parent->decreaseMemoryUsage(value);
+  }
 }
 
 void GlobalResourceMonitor::forceUpdateMemoryUsage(
     std::int64_t value) noexcept {
   _current.fetch_add(value, std::memory_order_relaxed);
+  if (_parent != nullptr) {
+    _parent->forceUpdateMemoryUsage(value);
+  }
 }
 
 /// @brief returns a reference to a global shared instance
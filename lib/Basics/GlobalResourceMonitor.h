@@ -38,12 +38,29 @@ class alignas(64) GlobalResourceMonitor final {
   constexpr GlobalResourceMonitor()
       : _current(0),
         _limit(0),
+        _parent(nullptr),
         _globalLimitReachedCounter(0),
-        _localLimitReachedCounter(0) {}
+        _localLimitReachedCounter(0),
+        _nestedLimitReachedCounter(0) {}
+
+  /// @brief create a nested monitor, e.g. for all operations in a database.
+  /// all memory usage tracked by the nested monitor is also tracked by the
+  /// parent, and an increase only succeeds if neither the nested monitor's
+  /// limit nor the parent's limit would be exceeded. the parent must outlive
+  /// the nested monitor.
+  explicit GlobalResourceMonitor(GlobalResourceMonitor& parent) noexcept
+      : _current(0),
+        _limit(0),
+        _parent(&parent),
+        _globalLimitReachedCounter(0),
+        _localLimitReachedCounter(0),
+        _nestedLimitReachedCounter(0) {}
 
   struct Stats {
     std::uint64_t globalLimitReached;
     std::uint64_t localLimitReached;
+    /// @brief number of times the limit of any nested monitor was reached
+    std::uint64_t nestedLimitReached;
   };
 
   /// @brief set the global memory limit
@@ -61,11 +78,14 @@ class alignas(64) GlobalResourceMonitor final {
   /// @brief increase the counter for global memory limit violations
   void trackGlobalViolation() noexcept;
 
-  /// @brief increase the counter for local memory limit violations
+  /// @brief increase the counter for local memory limit violations. the
+  /// violation is also counted in the parent monitor, if any
   void trackLocalViolation() noexcept;
 
   /// @brief increase global memory usage by <value> bytes. if increasing
-  /// exceeds the memory limit, does not perform the increase and returns false.
+  /// exceeds the memory limit of this monitor or any of its parents, does not
+  /// perform the increase, counts a limit violation in the monitor whose limit
+  /// was reached and returns false.
   /// if increasing succeeds, the global value is modified and true is returned
   /// Note: value must be >= 0
   [[nodiscard]] bool increaseMemoryUsage(std::int64_t value) noexcept;
@@ -83,6 +103,10 @@ class alignas(64) GlobalResourceMonitor final {
   static GlobalResourceMonitor& instance() noexcept;
 
  private:
+  /// @brief increase the memory usage of this instance only, respecting its
+  /// limit
+  [[nodiscard]] bool increaseOwnMemoryUsage(std::int64_t value) noexcept;
+
   /// @brief the current combined memory usage of all tracked operations.
   /// Theoretically it can happen that the global limit is exceeded due to the
   /// correction applied as part of the rollback in increaseMemoryUsage, but at
@@ -96,11 +120,17 @@ class alignas(64) GlobalResourceMonitor final {
   /// combined. a value of 0 means that there will be no global limit enforced.
   std::int64_t _limit;
 
+  /// @brief the parent monitor of a nested monitor, otherwise a nullptr
+  GlobalResourceMonitor* _parent;
+
   /// @brief number of times the global memory limit was reached
   std::atomic<std::uint64_t> _globalLimitReachedCounter;
 
   /// @brief number of times a local memory limit was reached
   std::atomic<std::uint64_t> _localLimitReachedCounter;
+
+  /// @brief number of times the limit of a nested monitor was reached
+  std::atomic<std::uint64_t> _nestedLimitReachedCounter;
 };
 
 }  // namespace arangodb
@@ -0,0 +1,82 @@
+////////////////////////////////////////////////////////////////////////////////
+/// DISCLAIMER
+///
+/// Copyright 2014-2023 ArangoDB GmbH, Cologne, Germany
+/// Copyright 2004-2014 triAGENS GmbH, Cologne, Germany
+///
+/// Licensed under the Apache License, Version 2.0 (the "License");
+/// you may not use this file except in compliance with the License.
+/// You may obtain a copy of the License at
+///
+///     http://www.apache.org/licenses/LICENSE-2.0
+///
+/// Unless required by applicable law or agreed to in writing, software
+/// distributed under the License is distributed on an "AS IS" BASIS,
+/// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+/// See the License for the specific language governing permissions and
+/// limitations under the License.
+///
+/// Copyright holder is ArangoDB GmbH, Cologne, Germany
+///
+/// @author Jan Steemann
+////////////////////////////////////////////////////////////////////////////////
+
+#include "LockContention.h"
+
+#include <algorithm>
+#include <bit>
+
+using namespace arangodb::basics;
+
+// constant-initialized, so that sites can register themselves during the
+// dynamic initialization of other translation units
+constinit std::atomic<LockContentionSite*> LockContentionSite::_head{nullptr};
+constinit std::atomic<bool> LockContentionSite::_enabled{false};
+
+LockContentionSite::LockContentionSite(std::string_view name) noexcept
+    : _name(name) {
+  // sites are only ever added, never removed
+  _next = _head.load(std::memory_order_relaxed);
+  while (!_head.compare_exchange_weak(_next, this, std::memory_order_release,
+                                      std::memory_order_relaxed)) {
+  }
+}
+
+void LockContentionSite::record(std::chrono::nanoseconds wait) noexcept {
+  uint64_t nanos = static_cast<uint64_t>(std::max<int64_t>(wait.count(), 0));
+  uint64_t micros = nanos / 1000;
+  // smallest i with micros <= 2^i
+  std::size_t bucket =
+      micros <= 1 ? 0 : static_cast<std::size_t>(std::bit_width(micros - 1));
+  if (bucket >= kNumBuckets) {
+    bucket = kNumBuckets - 1;
+  }
+
+  _buckets[bucket].fetch_add(1, std::memory_order_relaxed);
+  _count.fetch_add(1, std::memory_order_relaxed);
+  _totalWaitNanos.fetch_add(nanos, std::memory_order_relaxed);
+  uint64_t max = _maxWaitNanos.load(std::memory_order_relaxed);
+  while (max < nanos && !_maxWaitNanos.compare_exchange_weak(
+                            max, nanos, std::memory_order_relaxed)) {
+  }
+}
+
+LockContentionSite::Snapshot LockContentionSite::snapshot() const noexcept {
+  Snapshot result;
+  result.count = _count.load(std::memory_order_relaxed);
+  result.totalWaitNanos = _totalWaitNanos.load(std::memory_order_relaxed);
+  result.maxWaitNanos = _maxWaitNanos.load(std::memory_order_relaxed);
+  for (std::size_t i = 0; i < kNumBuckets; ++i) {
+    result.buckets[i] = _buckets[i].load(std::memory_order_relaxed);
+  }
+  return result;
+}
+
+void LockContentionSite::reset() noexcept {
+  _count.store(0, std::memory_order_relaxed);
+  _totalWaitNanos.store(0, std::memory_order_relaxed);
+  _maxWaitNanos.store(0, std::memory_order_relaxed);
+  for (auto& bucket : _buckets) {
+    bucket.store(0, std::memory_order_relaxed);
+  }
+}
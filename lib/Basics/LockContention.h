@@ -0,0 +1,130 @@
+////////////////////////////////////////////////////////////////////////////////
+/// DISCLAIMER
+///
+/// Copyright 2014-2023 ArangoDB GmbH, Cologne, Germany
+/// Copyright 2004-2014 triAGENS GmbH, Cologne, Germany
+///
+/// Licensed under the Apache License, Version 2.0 (the "License");
+/// you may not use this file except in compliance with the License.
+/// You may obtain a copy of the License at
+///
+///     http://www.apache.org/licenses/LICENSE-2.0
+///
+/// Unless required by applicable law or agreed to in writing, software
+/// distributed under the License is distributed on an "AS IS" BASIS,
+/// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+/// See the License for the specific language governing permissions and
+/// limitations under the License.
+///
+/// Copyright holder is ArangoDB GmbH, Cologne, Germany
+///
+/// @author Jan Steemann
+////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string_view>
+
+namespace arangodb::basics {
+
+/// @brief a named place in the code, or a class of locks, for which the
+/// time spent waiting for locks is profiled. sites register themselves in
+/// a global list on construction, and must therefore have static storage
+/// duration.
+/// only waits for locks that could not be acquired immediately are
+/// recorded, so uncontended locking is not affected by the profiling.
+class LockContentionSite {
+ public:
+  /// @brief number of wait time buckets. bucket i counts waits of up to
+  /// 2^i microseconds, the last bucket counts all longer waits
+  static constexpr std::size_t kNumBuckets = 20;
+
+  struct Snapshot {
+    uint64_t count = 0;
+    uint64_t totalWaitNanos = 0;
+    uint64_t maxWaitNanos = 0;
+    std::array<uint64_t, kNumBuckets> buckets{};
+  };
+
+  explicit LockContentionSite(std::string_view name) noexcept;
+  LockContentionSite(LockContentionSite const&) = delete;
+  LockContentionSite& operator=(LockContentionSite const&) = delete;
+
+  std::string_view name() const noexcept { return _name; }
+
+  void record(std::chrono::nanoseconds wait) noexcept;
+  Snapshot snapshot() const noexcept;
+  void reset() noexcept;
+
+  /// @brief upper bound of a bucket in microseconds
+  static uint64_t bucketLimitMicros(std::size_t bucket) noexcept {
+    return uint64_t{1} << bucket;
+  }
+
+  /// @brief calls the callback for every registered site
+  template<typename F>
+  static void visit(F&& callback) {
+    for (auto* site = _head.load(std::memory_order_acquire); site != nullptr;
+         site = site->_next) {
+      callback(*site);
+    }
+  }
+
+  /// @brief whether or not lock waits are recorded. turned off by default
+  static bool enabled() noexcept {
+    return _enabled.load(std::memory_order_relaxed);
+  }
+  static void setEnabled(bool value) noexcept {
+    _enabled.store(value, std::memory_order_relaxed);
+  }
+
+ private:
+  static std::atomic<LockContentionSite*> _head;
+  static std::atomic<bool> _enabled;
+
+  std::string_view const _name;
+  LockContentionSite* _next = nullptr;
+  std::atomic<uint64_t> _count{0};
+  std::atomic<uint64_t> _totalWaitNanos{0};
+  std::atomic<uint64_t> _maxWaitNanos{0};
+  std::array<std::atomic<uint64_t>, kNumBuckets> _buckets{};
+};
+
+/// @brief measures the time from its construction (or from the call to
+/// start()) until its destruction, and records it as lock wait time for
+/// the site. does nothing if lock contention profiling is turned off.
+class LockWaitTimer {
+ public:
+  explicit LockWaitTimer(LockContentionSite& site) noexcept : _site(site) {
+    start();
+  }
+  LockWaitTimer(LockContentionSite& site, std::defer_lock_t) noexcept
+      : _site(site) {}
+  ~LockWaitTimer() {
+    if (_started) {
+      _site.record(std::chrono::steady_clock::now() - _start);
+    }
+  }
+  LockWaitTimer(LockWaitTimer const&) = delete;
+  LockWaitTimer& operator=(LockWaitTimer const&) = delete;
+
+  void start() noexcept {
+    if (!_started && LockContentionSite::enabled()) {
+      _start = std::chrono::steady_clock::now();
+      _started = true;
+    }
+  }
+
+ private:
+  LockContentionSite& _site;
+  std::chrono::steady_clock::time_point _start;
+  bool _started = false;
+};
+
+}  // namespace arangodb::basics
@@ -23,15 +23,22 @@
 
 #include "ReadWriteLock.h"
 
+#include "Basics/LockContention.h"
 #include "Basics/debugging.h"
 
 using namespace arangodb::basics;
 
+namespace {
+LockContentionSite writeSite("ReadWriteLock::write");
+LockContentionSite readSite("ReadWriteLock::read");
+}  // namespace
+
 /// @brief locks for writing
 void ReadWriteLock::lockWrite() {
   if (tryLockWrite()) {
     return;
   }
+  LockWaitTimer timer(::writeSite);
 
   // the lock is either held by another writer or we have active readers
   // -> announce that we want to write
@@ -63,6 +70,7 @@ bool ReadWriteLock::tryLockWriteFor(std::chrono::microseconds timeout) {
   if (tryLockWrite()) {
     return true;
   }
+  LockWaitTimer timer(::writeSite);
 
   // the lock is either held by another writer or we have active readers
   // -> announce that we want to write
@@ -127,6 +135,7 @@ void ReadWriteLock::lockRead() {
   if (tryLockRead()) {
     return;
   }
+  LockWaitTimer timer(::readSite);
 
   std::unique_lock<std::mutex> guard(_reader_mutex);
   while (true) {
@@ -142,6 +151,7 @@ bool ReadWriteLock::tryLockReadFor(std::chrono::microseconds timeout) {
   if (tryLockRead()) {
     return true;
   }
+  LockWaitTimer timer(::readSite);
   auto end_time = std::chrono::steady_clock::now() + timeout;
   std::cv_status status(std::cv_status::no_timeout);
   std::unique_lock<std::mutex> guard(_reader_mutex);
@@ -24,6 +24,7 @@
 
 #include "ReadWriteSpinLock.h"
 
+#include "Basics/LockContention.h"
 #include "Basics/cpu-relax.h"
 #include "Basics/debugging.h"
 
@@ -53,6 +54,9 @@ static_assert(
     (::QueuedWriterMask & ::QueuedWriterIncrement) != 0 &&
         (::QueuedWriterMask & (::QueuedWriterIncrement >> 1)) == 0,
     "::QueuedWriterIncrement must be first bit in ::QueuedWriterMask");
+
+arangodb::basics::LockContentionSite writeSite("ReadWriteSpinLock::write");
+arangodb::basics::LockContentionSite readSite("ReadWriteSpinLock::read");
 }  // namespace
 
 namespace arangodb::basics {
@@ -90,6 +94,7 @@ void ReadWriteSpinLock::lockWrite() noexcept {
   if (tryLockWrite()) {
     return;
   }
+  LockWaitTimer timer(::writeSite);
 
   // the lock is either hold by another writer or we have active readers
   // -> announce that we want to write
@@ -113,6 +118,7 @@ bool ReadWriteSpinLock::lockWrite(std::size_t maxAttempts) noexcept {
   if (tryLockWrite()) {
     return true;
   }
+  LockWaitTimer timer(::writeSite);
 
   uint64_t attempts = 0;
 
@@ -158,20 +164,24 @@ bool ReadWriteSpinLock::tryLockRead() noexcept {
 }
 
 void ReadWriteSpinLock::lockRead() noexcept {
+  LockWaitTimer timer(::readSite, std::defer_lock);
   for (;;) {
     if (tryLockRead()) {
       return;
     }
+    timer.start();
     cpu_relax();
   }
 }
 
 bool ReadWriteSpinLock::lockRead(std::size_t maxAttempts) noexcept {
+  LockWaitTimer timer(::readSite, std::defer_lock);
   uint64_t attempts = 0;
   while (attempts++ <= maxAttempts) {
     if (tryLockRead()) {
       return true;
     }
+    timer.start();
     cpu_relax();
   }
   return false;
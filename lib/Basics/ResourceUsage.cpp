@@ -148,11 +148,9 @@ void ResourceMonitor::increaseMemoryUsage(std::uint64_t value) {
     // now modify the global counter value, too.
     if (!_global.increaseMemoryUsage(diff * chunkSize)) {
       // the allocation would exceed the global maximum value, so we need to
-      // roll back.
+      // roll back. the global monitor has already counted the violation
       rollback();
 
-      // track global limit violation
-      _global.trackGlobalViolation();
       // now we can safely signal an exception
       THROW_ARANGO_EXCEPTION_MESSAGE(TRI_ERROR_RESOURCE_LIMIT,
                                      "global memory limit exceeded");
@@ -225,6 +225,8 @@ std::string const StaticStrings::PotentialDirtyRead(
 std::string const StaticStrings::RequestForwardedTo(
     "x-arango-request-forwarded-to");
 std::string const StaticStrings::Server("server");
+std::string const StaticStrings::ShardMapVersion(
+    "x-arango-shard-map-version");
 std::string const StaticStrings::TransferEncoding("transfer-encoding");
 std::string const StaticStrings::TransactionBody("x-arango-trx-body");
 std::string const StaticStrings::TransactionId("x-arango-trx-id");
@@ -233,12 +235,15 @@ std::string const StaticStrings::Unlimited("unlimited");
 std::string const StaticStrings::UserAgent("user-agent");
 std::string const StaticStrings::WwwAuthenticate("www-authenticate");
 std::string const StaticStrings::XContentTypeOptions("x-content-type-options");
+std::string const StaticStrings::XArangoAcceptEncoding(
+    "x-arango-accept-encoding");
 std::string const StaticStrings::XArangoFrontend("x-arango-frontend");
 std::string const StaticStrings::XArangoQueueTimeSeconds(
     "x-arango-queue-time-seconds");
 std::string const StaticStrings::ContentSecurityPolicy(
     "content-security-policy");
 std::string const StaticStrings::Pragma("pragma");
+std::string const StaticStrings::RetryAfter("retry-after");
 std::string const StaticStrings::Expires("expires");
 std::string const StaticStrings::HSTS("strict-transport-security");
 
@@ -258,6 +263,7 @@ std::string const StaticStrings::MimeTypeVPack("application/x-velocypack");
 std::string const StaticStrings::MultiPartContentType("multipart/form-data");
 
 // accept-encodings
+std::string const StaticStrings::EncodingArangoLz4("x-arango-lz4");
 std::string const StaticStrings::EncodingDeflate("deflate");
 std::string const StaticStrings::EncodingGzip("gzip");
 
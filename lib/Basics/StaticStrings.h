@@ -211,6 +211,7 @@ class StaticStrings {
   static std::string const PotentialDirtyRead;
   static std::string const RequestForwardedTo;
   static std::string const Server;
+  static std::string const ShardMapVersion;
   static std::string const TransferEncoding;
   static std::string const TransactionBody;
   static std::string const TransactionId;
@@ -218,10 +219,12 @@ class StaticStrings {
   static std::string const UserAgent;
   static std::string const WwwAuthenticate;
   static std::string const XContentTypeOptions;
+  static std::string const XArangoAcceptEncoding;
   static std::string const XArangoFrontend;
   static std::string const XArangoQueueTimeSeconds;
   static std::string const ContentSecurityPolicy;
   static std::string const Pragma;
+  static std::string const RetryAfter;
   static std::string const Expires;
   static std::string const HSTS;
 
@@ -238,6 +241,7 @@ class StaticStrings {
   static std::string const MultiPartContentType;
 
   // encodings
+  static std::string const EncodingArangoLz4;
   static std::string const EncodingDeflate;
   static std::string const EncodingGzip;
 
@@ -1603,6 +1603,30 @@ std::string correctPath(std::string_view incorrectPath) {
 #endif
 }
 
+bool isAscii(char const* value, size_t length) noexcept {
+  constexpr uint64_t highBits = 0x8080808080808080ULL;
+
+  char const* p = value;
+  char const* e = p + length;
+  while (p + 32 <= e) {
+    uint64_t w[4];
+    memcpy(&w[0], p, sizeof(w));
+    if (((w[0] | w[1] | w[2] | w[3]) & highBits) != 0) {
+      return false;
+    }
+    p += 32;
+  }
+  uint64_t bits = 0;
+  while (p < e) {
+    bits |= static_cast<unsigned char>(*p++);
+  }
+  return (bits & 0x80U) == 0;
+}
+
+bool isAscii(std::string_view value) noexcept {
+  return StringUtils::isAscii(value.data(), value.size());
+}
+
 std::string encodeHex(char const* value, size_t length) {
   std::string result;
   result.reserve(length * 2);
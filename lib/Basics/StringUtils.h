@@ -413,6 +413,13 @@ static bool toNumber(std::string const& key, T& val) noexcept {
 /// @brief replaces incorrect path delimiter character for window and linux
 std::string correctPath(std::string_view incorrectPath);
 
+/// @brief whether or not the input consists of 7-bit ASCII characters only.
+/// ASCII input is always valid UTF-8. the check processes 32 bytes per
+/// iteration without any branches on the contents, so that compilers can
+/// turn it into SIMD instructions
+bool isAscii(char const* value, size_t length) noexcept;
+bool isAscii(std::string_view value) noexcept;
+
 /// @brief converts to hex
 std::string encodeHex(char const* value, size_t length);
 std::string encodeHex(std::string_view value);
@@ -23,11 +23,25 @@
 
 #include "UnshackledMutex.h"
 
+#include "Basics/LockContention.h"
 #include "Basics/debugging.h"
 
 namespace arangodb::basics {
 
+namespace {
+LockContentionSite lockSite("UnshackledMutex");
+}  // namespace
+
 void UnshackledMutex::lock() noexcept {
+  // only measure waits if the mutex could not be acquired immediately. the
+  // additional try_lock() is only done while profiling is turned on
+  LockWaitTimer timer(lockSite, std::defer_lock);
+  if (LockContentionSite::enabled()) {
+    if (try_lock()) {
+      return;
+    }
+    timer.start();
+  }
   // cppcheck-suppress throwInNoexceptFunction
   auto func = +[](bool const* locked) noexcept { return !*locked; };
   absl::MutexLock guard{&_mutex,
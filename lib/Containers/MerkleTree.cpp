@@ -617,18 +617,18 @@ void MerkleTree<Hasher, BranchingBits>::insert(
     return;
   }
 
-  std::vector<std::uint64_t> sortedKeys = keys;
-  std::sort(sortedKeys.begin(), sortedKeys.end());
-
-  std::uint64_t minKey = sortedKeys[0];
-  std::uint64_t maxKey = sortedKeys[sortedKeys.size() - 1];
+  // the order of the keys does not matter for the modification, so we
+  // only need the bounds, but not to sort a copy of the keys
+  auto [minIt, maxIt] = std::minmax_element(keys.begin(), keys.end());
+  std::uint64_t minKey = *minIt;
+  std::uint64_t maxKey = *maxIt;
 
   std::unique_lock<std::shared_mutex> guard(_dataLock);
 
   // may grow the tree so it can store minKey and MaxKey
   prepareInsertMinMax(guard, minKey, maxKey);
 
-  modify(sortedKeys, /*isInsert*/ true);
+  modify(keys, /*isInsert*/ true);
 }
 
 template<typename Hasher, std::uint64_t const BranchingBits>
@@ -654,11 +654,10 @@ void MerkleTree<Hasher, BranchingBits>::remove(
     return;
   }
 
-  std::vector<std::uint64_t> sortedKeys = keys;
-  std::sort(sortedKeys.begin(), sortedKeys.end());
-
-  std::uint64_t minKey = sortedKeys[0];
-  std::uint64_t maxKey = sortedKeys[sortedKeys.size() - 1];
+  // as in insert(), only the bounds of the keys are needed
+  auto [minIt, maxIt] = std::minmax_element(keys.begin(), keys.end());
+  std::uint64_t minKey = *minIt;
+  std::uint64_t maxKey = *maxIt;
 
   std::unique_lock<std::shared_mutex> guard(_dataLock);
 
@@ -666,7 +665,7 @@ void MerkleTree<Hasher, BranchingBits>::remove(
     throw std::out_of_range("Cannot remove, key out of current range.");
   }
 
-  modify(sortedKeys, /*isInsert*/ false);
+  modify(keys, /*isInsert*/ false);
 }
 
 template<typename Hasher, std::uint64_t const BranchingBits>
@@ -0,0 +1,556 @@
+////////////////////////////////////////////////////////////////////////////////
+/// DISCLAIMER
+///
+/// Copyright 2014-2023 ArangoDB GmbH, Cologne, Germany
+/// Copyright 2004-2014 triAGENS GmbH, Cologne, Germany
+///
+/// Licensed under the Apache License, Version 2.0 (the "License");
+/// you may not use this file except in compliance with the License.
+/// You may obtain a copy of the License at
+///
+///     http://www.apache.org/licenses/LICENSE-2.0
+///
+/// Unless required by applicable law or agreed to in writing, software
+/// distributed under the License is distributed on an "AS IS" BASIS,
+/// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+/// See the License for the specific language governing permissions and
+/// limitations under the License.
+///
+/// Copyright holder is ArangoDB GmbH, Cologne, Germany
+///
+/// @author Jan Steemann
+////////////////////////////////////////////////////////////////////////////////
+
+#include "SamplingProfiler.h"
+
+#include "Basics/operating-system.h"
+#include "Basics/voc-errors.h"
+
+#ifdef TRI_HAVE_SIGNAL_H
+#include <signal.h>
+#endif
+
+#ifdef __linux__
+#include <sys/time.h>
+#include <ucontext.h>
+#endif
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#ifdef ARANGODB_HAVE_LIBUNWIND
+#define UNW_LOCAL_ONLY
+#include <libunwind.h>
+#endif
+
+#if defined(ARANGODB_HAVE_LIBUNWIND) && defined(__linux__)
+#define ARANGODB_HAVE_SAMPLING_PROFILER 1
+#endif
+
+using namespace arangodb;
+
+namespace {
+
+// maximum number of frames recorded per sample
+constexpr std::size_t kMaxFrames = 48;
+// maximum number of frames belonging to the signal handler itself, which
+// are skipped when searching for the interrupted frame
+constexpr std::size_t kMaxSkipFrames = 8;
+
+struct Tags {
+  char lane[32];
+  char database[64];
+  char user[64];
+  std::uint8_t laneLength;
+  std::uint8_t databaseLength;
+  std::uint8_t userLength;
+};
+
+struct Sample {
+  std::atomic<bool> ready;
+  std::uint32_t depth;
+  std::uintptr_t pcs[kMaxFrames];
+  Tags tags;
+};
+
+// tags of the current thread. both variables are trivially initialized, so
+// they can be accessed from inside the signal handler
+thread_local Tags threadTags;
+thread_local std::atomic<bool> threadTagsValid{false};
+
+// serializes start() and stop()
+std::mutex profilerMutex;
+std::atomic<bool> running{false};
+// number of signal handler invocations currently in progress
+std::atomic<std::size_t> activeHandlers{0};
+std::atomic<std::size_t> nextSample{0};
+std::atomic<std::uint64_t> droppedSamples{0};
+std::atomic<std::uint64_t> currentFrequency{0};
+
+// the following variables are only modified while the profiler is not
+// running, and are protected by profilerMutex
+std::unique_ptr<Sample[]> sampleBuffer;
+std::size_t sampleCapacity = 0;
+std::chrono::system_clock::time_point startTime;
+bool handlerInstalled = false;
+
+template<std::size_t N>
+std::uint8_t copyTag(char (&dst)[N], std::string_view src) noexcept {
+  static_assert(N <= UINT8_MAX);
+  std::size_t length = std::min(src.size(), N);
+  std::memcpy(dst, src.data(), length);
+  return static_cast<std::uint8_t>(length);
+}
+
+#ifdef ARANGODB_HAVE_SAMPLING_PROFILER
+std::uintptr_t interruptedPc(void* ucontext) noexcept {
+  if (ucontext == nullptr) {
+    return 0;
+  }
+#if defined(__x86_64__)
+  return static_cast<std::uintptr_t>(
+      static_cast<ucontext_t*>(ucontext)->uc_mcontext.gregs[REG_RIP]);
+#elif defined(__aarch64__)
+  return static_cast<std::uintptr_t>(
+      static_cast<ucontext_t*>(ucontext)->uc_mcontext.pc);
+#else
+  return 0;
+#endif
+}
+
+// walks the stack of the current thread, skipping all frames up to the
+// interrupted one. returns the number of frames stored
+std::uint32_t collectStack(std::uintptr_t* pcs,
+                           std::uintptr_t signalPc) noexcept {
+  unw_context_t context;
+  unw_cursor_t cursor;
+  if (unw_getcontext(&context) != 0 || unw_init_local(&cursor, &context) != 0) {
+    return 0;
+  }
+
+  bool found = (signalPc == 0);
+  std::size_t skipped = 0;
+  std::uint32_t depth = 0;
+  do {
+    unw_word_t pc;
+    if (unw_get_reg(&cursor, UNW_REG_IP, &pc) != 0 || pc == 0) {
+      break;
+    }
+    if (!found) {
+      if (static_cast<std::uintptr_t>(pc) != signalPc) {
+        if (++skipped == kMaxSkipFrames) {
+          break;
+        }
+        continue;
+      }
+      found = true;
+    }
+    pcs[depth++] = static_cast<std::uintptr_t>(pc);
+  } while (depth < kMaxFrames && unw_step(&cursor) > 0);
+
+  if (!found && signalPc != 0) {
+    // could not unwind through the signal frame. at least record the
+    // interrupted instruction
+    pcs[0] = signalPc;
+    depth = 1;
+  }
+  return depth;
+}
+
+void profilerSignalHandler(int /*signal*/, siginfo_t* /*info*/,
+                           void* ucontext) {
+  int const savedErrno = errno;
+  // must be incremented before checking `running`, so that stop() can
+  // wait for all handlers that still access the sample buffer
+  activeHandlers.fetch_add(1);
+  if (running.load()) {
+    std::size_t index = nextSample.fetch_add(1, std::memory_order_relaxed);
+    if (index < sampleCapacity) {
+      Sample& sample = sampleBuffer[index];
+      sample.depth = collectStack(sample.pcs, interruptedPc(ucontext));
+      if (threadTagsValid.load(std::memory_order_relaxed)) {
+        std::atomic_signal_fence(std::memory_order_acquire);
+        sample.tags = threadTags;
+      }
+      sample.ready.store(true, std::memory_order_release);
+    } else {
+      droppedSamples.fetch_add(1, std::memory_order_relaxed);
+    }
+  }
+  activeHandlers.fetch_sub(1);
+  errno = savedErrno;
+}
+
+void waitForSignalHandlers() noexcept {
+  while (activeHandlers.load() != 0) {
+    std::this_thread::yield();
+  }
+}
+
+/// @brief minimal protobuf encoder, sufficient for writing pprof profiles
+class ProtoWriter {
+ public:
+  void varint(std::uint64_t value) {
+    while (value >= 0x80) {
+      _data.push_back(static_cast<char>((value & 0x7f) | 0x80));
+      value >>= 7;
+    }
+    _data.push_back(static_cast<char>(value));
+  }
+
+  void integer(std::uint32_t field, std::uint64_t value) {
+    key(field, 0);
+    varint(value);
+  }
+
+  void bytes(std::uint32_t field, std::string_view value) {
+    key(field, 2);
+    varint(value.size());
+    _data.append(value);
+  }
+
+  void packed(std::uint32_t field, std::vector<std::uint64_t> const& values) {
+    ProtoWriter inner;
+    for (auto value : values) {
+      inner.varint(value);
+    }
+    bytes(field, inner.data());
+  }
+
+  std::string const& data() const noexcept { return _data; }
+  std::string&& steal() noexcept { return std::move(_data); }
+
+ private:
+  void key(std::uint32_t field, std::uint32_t wireType) {
+    varint((static_cast<std::uint64_t>(field) << 3) | wireType);
+  }
+
+  std::string _data;
+};
+
+class StringTable {
+ public:
+  StringTable() {
+    // pprof requires the first string to be the empty string
+    index("");
+  }
+
+  std::uint64_t index(std::string_view value) {
+    auto [it, inserted] =
+        _indexes.try_emplace(std::string(value), _strings.size());
+    if (inserted) {
+      _strings.emplace_back(value);
+    }
+    return it->second;
+  }
+
+  std::vector<std::string> const& strings() const noexcept {
+    return _strings;
+  }
+
+ private:
+  std::unordered_map<std::string, std::uint64_t> _indexes;
+  std::vector<std::string> _strings;
+};
+
+struct Mapping {
+  std::uintptr_t start;
+  std::uintptr_t limit;
+  std::uintptr_t offset;
+  std::string file;
+};
+
+// returns the executable memory mappings of the process, sorted by start
+// address
+std::vector<Mapping> readMappings() {
+  std::vector<Mapping> mappings;
+  std::ifstream in("/proc/self/maps");
+  std::string line;
+  while (std::getline(in, line)) {
+    unsigned long long start = 0;
+    unsigned long long limit = 0;
+    unsigned long long offset = 0;
+    char perms[5] = {0};
+    int pathPos = 0;
+    if (std::sscanf(line.c_str(), "%llx-%llx %4s %llx %*s %*s %n", &start,
+                    &limit, perms, &offset, &pathPos) < 4 ||
+        perms[2] != 'x') {
+      continue;
+    }
+    mappings.push_back(
+        Mapping{static_cast<std::uintptr_t>(start),
+                static_cast<std::uintptr_t>(limit),
+                static_cast<std::uintptr_t>(offset),
+                pathPos > 0 ? line.substr(pathPos) : std::string()});
+  }
+  std::sort(mappings.begin(), mappings.end(),
+            [](auto const& lhs, auto const& rhs) {
+              return lhs.start < rhs.start;
+            });
+  return mappings;
+}
+
+// returns the 1-based id of the mapping containing the address, or 0
+std::uint64_t findMapping(std::vector<Mapping> const& mappings,
+                          std::uintptr_t address) {
+  auto it = std::upper_bound(
+      mappings.begin(), mappings.end(), address,
+      [](std::uintptr_t value, auto const& m) { return value < m.start; });
+  if (it == mappings.begin()) {
+    return 0;
+  }
+  --it;
+  if (address >= it->limit) {
+    return 0;
+  }
+  return static_cast<std::uint64_t>(std::distance(mappings.begin(), it)) + 1;
+}
+
+std::string encodeProfile(Sample const* samples, std::size_t numSamples,
+                          std::uint64_t frequency,
+                          std::chrono::system_clock::time_point start,
+                          std::chrono::nanoseconds duration) {
+  StringTable strings;
+  ProtoWriter profile;
+
+  auto valueType = [&](std::string_view type, std::string_view unit) {
+    ProtoWriter w;
+    w.integer(1, strings.index(type));
+    w.integer(2, strings.index(unit));
+    return w.steal();
+  };
+
+  std::uint64_t const period = 1000000000ULL / frequency;
+  profile.bytes(1, valueType("samples", "count"));
+  profile.bytes(1, valueType("cpu", "nanoseconds"));
+
+  // aggregate samples with identical stacks and tags. the value is the
+  // index of the first such sample plus the number of samples
+  std::unordered_map<std::string, std::pair<std::size_t, std::uint64_t>>
+      aggregated;
+  std::string key;
+  for (std::size_t i = 0; i < numSamples; ++i) {
+    Sample const& sample = samples[i];
+    if (!sample.ready.load(std::memory_order_acquire) || sample.depth == 0) {
+      continue;
+    }
+    key.assign(reinterpret_cast<char const*>(sample.pcs),
+               sample.depth * sizeof(std::uintptr_t));
+    key.append(reinterpret_cast<char const*>(&sample.tags),
+               sizeof(sample.tags));
+    auto it = aggregated.try_emplace(key, i, 0).first;
+    ++it->second.second;
+  }
+
+  auto const mappings = readMappings();
+  std::unordered_map<std::uintptr_t, std::uint64_t> locations;
+
+  auto addLabel = [&](ProtoWriter& w, std::string_view name, char const* data,
+                      std::uint8_t length) {
+    if (length == 0) {
+      return;
+    }
+    ProtoWriter label;
+    label.integer(1, strings.index(name));
+    label.integer(2, strings.index(std::string_view(data, length)));
+    w.bytes(3, label.data());
+  };
+
+  std::vector<std::uint64_t> ids;
+  for (auto const& [k, entry] : aggregated) {
+    Sample const& sample = samples[entry.first];
+    ids.clear();
+    for (std::uint32_t j = 0; j < sample.depth; ++j) {
+      // all frames but the innermost one contain return addresses. use
+      // the address of the call instruction instead, as pprof expects
+      std::uintptr_t address = sample.pcs[j] - (j == 0 ? 0 : 1);
+      auto it = locations.try_emplace(address, locations.size() + 1).first;
+      ids.push_back(it->second);
+    }
+    ProtoWriter w;
+    w.packed(1, ids);
+    w.packed(2, {entry.second, entry.second * period});
+    addLabel(w, "lane", sample.tags.lane, sample.tags.laneLength);
+    addLabel(w, "database", sample.tags.database, sample.tags.databaseLength);
+    addLabel(w, "user", sample.tags.user, sample.tags.userLength);
+    profile.bytes(2, w.data());
+  }
+
+  for (std::size_t i = 0; i < mappings.size(); ++i) {
+    ProtoWriter w;
+    w.integer(1, i + 1);
+    w.integer(2, mappings[i].start);
+    w.integer(3, mappings[i].limit);
+    w.integer(4, mappings[i].offset);
+    w.integer(5, strings.index(mappings[i].file));
+    profile.bytes(3, w.data());
+  }
+
+  for (auto const& [address, id] : locations) {
+    ProtoWriter w;
+    w.integer(1, id);
+    w.integer(2, findMapping(mappings, address));
+    w.integer(3, address);
+    profile.bytes(4, w.data());
+  }
+
+  std::string const periodType = valueType("cpu", "nanoseconds");
+  for (auto const& s : strings.strings()) {
+    profile.bytes(6, s);
+  }
+  profile.integer(9, std::chrono::duration_cast<std::chrono::nanoseconds>(
+                         start.time_since_epoch())
+                         .count());
+  profile.integer(10, duration.count());
+  profile.bytes(11, periodType);
+  profile.integer(12, period);
+  return profile.steal();
+}
+#endif
+
+}  // namespace
+
+SamplingProfiler::TagScope::TagScope(std::string_view lane,
+                                     std::string_view database,
+                                     std::string_view user) noexcept {
+  // the signal handler may interrupt this thread at any point, so the
+  // tags are marked as invalid while they are modified
+  ::threadTagsValid.store(false, std::memory_order_relaxed);
+  std::atomic_signal_fence(std::memory_order_seq_cst);
+  ::threadTags.laneLength = ::copyTag(::threadTags.lane, lane);
+  ::threadTags.databaseLength = ::copyTag(::threadTags.database, database);
+  ::threadTags.userLength = ::copyTag(::threadTags.user, user);
+  std::atomic_signal_fence(std::memory_order_seq_cst);
+  ::threadTagsValid.store(true, std::memory_order_relaxed);
+}
+
+SamplingProfiler::TagScope::~TagScope() {
+  ::threadTagsValid.store(false, std::memory_order_relaxed);
+}
+
+Result SamplingProfiler::start(uint64_t frequency, std::size_t maxSamples) {
+#ifndef ARANGODB_HAVE_SAMPLING_PROFILER
+  return {TRI_ERROR_NOT_IMPLEMENTED,
+          "sampling profiler is not supported on this platform"};
+#else
+  if (frequency == 0 || frequency > kMaxFrequency) {
+    return {TRI_ERROR_BAD_PARAMETER, "invalid profiling frequency"};
+  }
+  if (maxSamples == 0 || maxSamples > kMaxMaxSamples) {
+    return {TRI_ERROR_BAD_PARAMETER, "invalid maximum number of samples"};
+  }
+
+  std::lock_guard guard(::profilerMutex);
+  if (::running.load()) {
+    return {TRI_ERROR_FAILED, "sampling profiler is already running"};
+  }
+
+  try {
+    ::sampleBuffer = std::make_unique<Sample[]>(maxSamples);
+  } catch (std::bad_alloc const&) {
+    return {TRI_ERROR_OUT_OF_MEMORY};
+  }
+  ::sampleCapacity = maxSamples;
+  ::nextSample.store(0);
+  ::droppedSamples.store(0);
+  ::currentFrequency.store(frequency);
+  ::startTime = std::chrono::system_clock::now();
+
+  if (!::handlerInstalled) {
+    // the handler stays installed after the profiler is stopped, so that
+    // late signals cannot terminate the process
+    struct sigaction act;
+    sigemptyset(&act.sa_mask);
+    act.sa_flags = SA_RESTART | SA_SIGINFO;
+    act.sa_sigaction = ::profilerSignalHandler;
+    if (sigaction(SIGPROF, &act, nullptr) != 0) {
+      ::sampleBuffer.reset();
+      return {TRI_ERROR_SYS_ERROR, "unable to install SIGPROF handler"};
+    }
+    ::handlerInstalled = true;
+  }
+
+  // libunwind may initialize internal state on first use. do this here,
+  // outside of the signal handler
+  {
+    std::uintptr_t pcs[kMaxFrames];
+    ::collectStack(pcs, 0);
+  }
+
+  ::running.store(true);
+
+  std::uint64_t const interval = 1000000 / frequency;
+  struct itimerval timer;
+  timer.it_interval.tv_sec = static_cast<time_t>(interval / 1000000);
+  timer.it_interval.tv_usec = static_cast<suseconds_t>(interval % 1000000);
+  timer.it_value = timer.it_interval;
+  if (setitimer(ITIMER_PROF, &timer, nullptr) != 0) {
+    ::running.store(false);
+    ::waitForSignalHandlers();
+    ::sampleBuffer.reset();
+    return {TRI_ERROR_SYS_ERROR, "unable to start profiling timer"};
+  }
+  return {};
+#endif
+}
+
+Result SamplingProfiler::stop(std::string& profile) {
+#ifndef ARANGODB_HAVE_SAMPLING_PROFILER
+  return {TRI_ERROR_NOT_IMPLEMENTED,
+          "sampling profiler is not supported on this platform"};
+#else
+  std::lock_guard guard(::profilerMutex);
+  if (!::running.load()) {
+    return {TRI_ERROR_FAILED, "sampling profiler is not running"};
+  }
+
+  struct itimerval timer;
+  std::memset(&timer, 0, sizeof(timer));
+  setitimer(ITIMER_PROF, &timer, nullptr);
+
+  ::running.store(false);
+  // after this, no signal handler will access the sample buffer anymore
+  ::waitForSignalHandlers();
+
+  auto const duration = std::chrono::system_clock::now() - ::startTime;
+  std::size_t const numSamples =
+      std::min(::nextSample.load(), ::sampleCapacity);
+
+  Result res;
+  try {
+    profile = ::encodeProfile(
+        ::sampleBuffer.get(), numSamples, ::currentFrequency.load(),
+        ::startTime,
+        std::chrono::duration_cast<std::chrono::nanoseconds>(duration));
+  } catch (std::bad_alloc const&) {
+    res.reset(TRI_ERROR_OUT_OF_MEMORY);
+  } catch (std::exception const& ex) {
+    res.reset(TRI_ERROR_INTERNAL, ex.what());
+  }
+  ::sampleBuffer.reset();
+  ::sampleCapacity = 0;
+  return res;
+#endif
+}
+
+SamplingProfiler::Status SamplingProfiler::status() noexcept {
+  Status status;
+  status.running = ::running.load();
+  status.frequency = ::currentFrequency.load();
+  // load the number of dropped samples first, so that the difference
+  // cannot become negative
+  status.dropped = ::droppedSamples.load();
+  status.samples = ::nextSample.load() - status.dropped;
+  return status;
+}
@@ -0,0 +1,83 @@
+////////////////////////////////////////////////////////////////////////////////
+/// DISCLAIMER
+///
+/// Copyright 2014-2023 ArangoDB GmbH, Cologne, Germany
+/// Copyright 2004-2014 triAGENS GmbH, Cologne, Germany
+///
+/// Licensed under the Apache License, Version 2.0 (the "License");
+/// you may not use this file except in compliance with the License.
+/// You may obtain a copy of the License at
+///
+///     http://www.apache.org/licenses/LICENSE-2.0
+///
+/// Unless required by applicable law or agreed to in writing, software
+/// distributed under the License is distributed on an "AS IS" BASIS,
+/// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+/// See the License for the specific language governing permissions and
+/// limitations under the License.
+///
+/// Copyright holder is ArangoDB GmbH, Cologne, Germany
+///
+/// @author Jan Steemann
+////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "Basics/Result.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+namespace arangodb {
+
+/// @brief process-wide sampling CPU profiler. when started, the process
+/// receives SIGPROF signals at the requested frequency (measured in consumed
+/// CPU time), and the signal handler records the stack of the interrupted
+/// thread into a preallocated buffer, together with the tags set for the
+/// thread via TagScope. stopping the profiler returns the recorded samples
+/// as a profile in pprof's protobuf format, which can be inspected with
+/// `pprof <binary> <profile>`.
+/// note: profiling is only supported on Linux builds with libunwind.
+class SamplingProfiler {
+ public:
+  struct Status {
+    bool running = false;
+    uint64_t frequency = 0;
+    uint64_t samples = 0;
+    uint64_t dropped = 0;
+  };
+
+  /// @brief tags all samples taken for the current thread while the scope
+  /// is alive with the given request lane, database and user. overlong
+  /// values are truncated
+  class TagScope {
+   public:
+    TagScope(std::string_view lane, std::string_view database,
+             std::string_view user) noexcept;
+    ~TagScope();
+
+    TagScope(TagScope const&) = delete;
+    TagScope& operator=(TagScope const&) = delete;
+  };
+
+  static constexpr uint64_t kDefaultFrequency = 99;
+  static constexpr uint64_t kMaxFrequency = 1000;
+  static constexpr std::size_t kDefaultMaxSamples = 32768;
+  static constexpr std::size_t kMaxMaxSamples = 1048576;
+
+  /// @brief starts profiling with `frequency` samples per second of consumed
+  /// CPU time. at most `maxSamples` samples are recorded, further samples
+  /// are dropped. fails if the profiler is already running or if profiling
+  /// is not supported
+  static Result start(uint64_t frequency, std::size_t maxSamples);
+
+  /// @brief stops profiling and returns the recorded profile in pprof's
+  /// (uncompressed) protobuf format. fails if the profiler is not running
+  static Result stop(std::string& profile);
+
+  static Status status() noexcept;
+};
+
+}  // namespace arangodb
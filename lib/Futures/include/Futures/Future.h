@@ -166,6 +166,8 @@ class Future {
                 "use futures::Unit instead of void");
 
   friend class Promise<T>;
+  template<typename T2>
+  friend class Future;
   template<class T2>
   friend Future<T2> makeFuture(Try<T2>&&);
   friend Future<Unit> makeFuture();
@@ -291,6 +293,13 @@ class Future {
   ///   i.e., as if `*this` was moved into RESULT.
   /// - `RESULT.valid() == true`
 
+  ///
+  /// If the result is already available when the continuation is attached,
+  /// the continuation is executed right away, in the same way as setting the
+  /// callback on a ready shared state would do. In this case no Promise is
+  /// created and the continuation is not type-erased into a callback, which
+  /// saves two heap allocations per stage in chains of ready futures.
+
   /// Variant: callable accepts T&&, returns value
   ///  e.g. f.then([](T&& t){ return t; });
   template<typename F, typename R = detail::valueCallableResult<T, F>>
@@ -305,6 +314,19 @@ class Future {
     static_assert(!std::is_same<B, void>::value, "");
     static_assert(!R::ReturnsFuture::value, "");
 
+    if (getState().hasResult()) {
+      // fast path, see comment above
+      Try<T>& t = getState().getTry();
+      if (t.hasException()) {
+        return Future<B>(
+            detail::SharedState<B>::make(Try<B>(std::move(t).exception())));
+      }
+      return Future<B>(
+          detail::SharedState<B>::make(detail::makeTryWith([&fn, &t] {
+            return std::invoke(std::forward<F>(fn), std::move(t).get());
+          })));
+    }
+
     Promise<B> promise;
     auto future = promise.getFuture();
     getState().setCallback([fn = std::forward<DF>(fn),
@@ -334,6 +356,21 @@ class Future {
     static_assert(std::is_invocable_r<Future<B>, F, T>::value,
                   "Function must be invocable with T");
 
+    if (getState().hasResult()) {
+      // fast path, see comment above
+      Try<T>& t = getState().getTry();
+      if (t.hasException()) {
+        return Future<B>(
+            detail::SharedState<B>::make(Try<B>(std::move(t).exception())));
+      }
+      try {
+        return std::invoke(std::forward<F>(fn), std::move(t).get());
+      } catch (...) {
+        return Future<B>(
+            detail::SharedState<B>::make(Try<B>(std::current_exception())));
+      }
+    }
+
     Promise<B> promise;
     auto future = promise.getFuture();
     getState().setCallback([fn = std::forward<DF>(fn),
@@ -367,6 +404,15 @@ class Future {
     static_assert(!isFuture<B>::value, "");
     static_assert(!std::is_same<B, void>::value, "");
 
+    if (getState().hasResult()) {
+      // fast path, see comment above
+      Try<T>& t = getState().getTry();
+      return Future<B>(
+          detail::SharedState<B>::make(detail::makeTryWith([&func, &t] {
+            return std::invoke(std::forward<F>(func), std::move(t));
+          })));
+    }
+
     Promise<B> promise;
     auto future = promise.getFuture();
     getState().setCallback([fn = std::forward<DF>(func),
@@ -388,6 +434,17 @@ class Future {
     typedef typename R::ReturnsFuture::inner B;
     static_assert(!isFuture<B>::value, "");
 
+    if (getState().hasResult()) {
+      // fast path, see comment above
+      try {
+        return std::invoke(std::forward<F>(func),
+                           std::move(getState().getTry()));
+      } catch (...) {
+        return Future<B>(
+            detail::SharedState<B>::make(Try<B>(std::current_exception())));
+      }
+    }
+
     Promise<B> promise;
     auto future = promise.getFuture();
     getState().setCallback([fn = std::forward<F>(func),
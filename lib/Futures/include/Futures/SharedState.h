@@ -272,7 +272,15 @@ class SharedState {
   }
 
  private:
-  using Callback = fu2::unique_function<void(Try<T>&&)>;
+  /// inline storage for the callback. the continuations created by
+  /// Future::then() etc. capture the user-provided callable plus a Promise,
+  /// and most of them fit into this buffer, so that installing a callback
+  /// does not require a separate heap allocation
+  static constexpr std::size_t kCallbackCapacity = 64;
+  using Callback = fu2::function_base<
+      /*IsOwning*/ true, /*IsCopyable*/ false,
+      fu2::capacity_fixed<kCallbackCapacity>, /*IsThrowing*/ true,
+      /*HasStrongExceptGuarantee*/ false, void(Try<T>&&)>;
   Callback _callback;
   union {  // avoids having to construct the result
     Try<T> _result;
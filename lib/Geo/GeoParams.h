@@ -143,6 +143,9 @@ struct QueryParams {
 
   FilterType filterType = FilterType::NONE;
   ShapeContainer filterShape;
+  /// @brief serialized GeoJSON the filter shape was parsed from, used to
+  /// look up cached coverings of the shape. empty if not known
+  std::string filterShapeKey;
 
   // parameters to calculate the cover for index
   // lookup intervals
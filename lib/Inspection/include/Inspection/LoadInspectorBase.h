@@ -29,7 +29,9 @@
 #include <string_view>
 #include <tuple>
 #include <type_traits>
+#include <utility>
 #include <variant>
+#include <vector>
 
 #include "Inspection/InspectorBase.h"
 #include "Inspection/Factory.h"
@@ -155,6 +157,7 @@ struct LoadInspectorBase : InspectorBase<Derived, Context> {
   template<class... Args>
   Status applyFields(Args&&... args) {
     FieldsMap fields;
+    fields.reserve(sizeof...(Args));
     this->self().doProcessObject([&](std::string_view key, ValueType value) {
       fields.emplace(key, std::make_pair(std::move(value), false));
       return Status::Success{};
@@ -163,7 +166,7 @@ struct LoadInspectorBase : InspectorBase<Derived, Context> {
     auto result = parseFields(fields, std::forward<Args>(args)...);
     if (result.ok() && !_options.ignoreUnknownFields) {
       for (auto& [k, v] : fields) {
-        if (!v.second) {
+        if (!v.second && !fields.isDuplicate(k)) {
           return {"Found unexpected attribute '" + std::string(k) + "'"};
         }
       }
@@ -184,8 +187,58 @@ struct LoadInspectorBase : InspectorBase<Derived, Context> {
   }
 
  protected:
-  using FieldsMap =
-      std::unordered_map<std::string_view, std::pair<ValueType, bool>>;
+  // the attributes of the object that is currently loaded, in the order in
+  // which they are stored. objects usually have only a few attributes, and
+  // the fields of a type are typically inspected in the same order in which
+  // they have been serialized. a linear search that starts right behind the
+  // previously found attribute thus usually finds the next field with a
+  // single comparison, which is much cheaper than building a hash table for
+  // every object that is loaded.
+  struct FieldsMap {
+    using Entry = std::pair<std::string_view, std::pair<ValueType, bool>>;
+    using iterator = typename std::vector<Entry>::iterator;
+
+    void reserve(std::size_t n) { _entries.reserve(n); }
+
+    void emplace(std::string_view key, std::pair<ValueType, bool>&& value) {
+      _entries.emplace_back(key, std::move(value));
+    }
+
+    iterator find(std::string_view key) noexcept {
+      std::size_t const n = _entries.size();
+      std::size_t pos = _next;
+      for (std::size_t i = 0; i < n; ++i, ++pos) {
+        if (pos >= n) {
+          pos = 0;
+        }
+        if (_entries[pos].first == key) {
+          _next = pos + 1;
+          return _entries.begin() + pos;
+        }
+      }
+      return end();
+    }
+
+    // whether the attribute name occurs multiple times in the object and one
+    // of its occurrences has been processed. only used for error reporting,
+    // so that objects with duplicate attribute names are still accepted
+    bool isDuplicate(std::string_view key) const noexcept {
+      for (auto const& [k, v] : _entries) {
+        if (k == key && v.second) {
+          return true;
+        }
+      }
+      return false;
+    }
+
+    iterator begin() noexcept { return _entries.begin(); }
+    iterator end() noexcept { return _entries.end(); }
+
+   private:
+    std::vector<Entry> _entries;
+    // position at which the next lookup starts
+    std::size_t _next = 0;
+  };
 
   using EmbeddedParam = FieldsMap;
 
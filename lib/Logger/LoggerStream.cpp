@@ -21,7 +21,9 @@
 /// @author Dr. Frank Celler
 ////////////////////////////////////////////////////////////////////////////////
 
+#include <algorithm>
 #include <cstdint>
+#include <cstring>
 #include <iomanip>
 #include <iostream>
 #include <string>
@@ -32,8 +34,48 @@
 
 namespace arangodb {
 
+LoggerStreamBuffer::LoggerStreamBuffer() noexcept {
+  setp(_inline, _inline + kInlineSize);
+}
+
+LoggerStreamBuffer::int_type LoggerStreamBuffer::overflow(int_type ch) {
+  if (traits_type::eq_int_type(ch, traits_type::eof())) {
+    return traits_type::not_eof(ch);
+  }
+  grow(1);
+  *pptr() = traits_type::to_char_type(ch);
+  pbump(1);
+  return ch;
+}
+
+std::streamsize LoggerStreamBuffer::xsputn(char const* data,
+                                           std::streamsize length) {
+  if (length <= 0) {
+    return 0;
+  }
+  if (epptr() - pptr() < length) {
+    grow(static_cast<std::size_t>(length));
+  }
+  memcpy(pptr(), data, static_cast<std::size_t>(length));
+  pbump(static_cast<int>(length));
+  return length;
+}
+
+void LoggerStreamBuffer::grow(std::size_t minFree) {
+  std::size_t used = static_cast<std::size_t>(pptr() - pbase());
+  std::size_t capacity = static_cast<std::size_t>(epptr() - pbase());
+  std::size_t newCapacity = std::max(2 * capacity, used + minFree);
+
+  auto buffer = std::make_unique<char[]>(newCapacity);
+  memcpy(buffer.get(), pbase(), used);
+  _heap = std::move(buffer);
+  setp(_heap.get(), _heap.get() + newCapacity);
+  pbump(static_cast<int>(used));
+}
+
 LoggerStreamBase::LoggerStreamBase(bool enabled)
-    : _topicId(LogTopic::MAX_LOG_TOPICS),
+    : _out(&_buffer),
+      _topicId(LogTopic::MAX_LOG_TOPICS),
       _level(LogLevel::DEFAULT),
       _line(0),
 #ifdef ARANGODB_ENABLE_MAINTAINER_MODE
@@ -59,9 +101,13 @@ LoggerStreamBase& LoggerStreamBase::operator<<(LogTopic const& topic) noexcept {
 LoggerStreamBase& LoggerStreamBase::operator<<(
     Logger::FIXED const& value) noexcept {
   try {
-    std::ostringstream tmp;
-    tmp << std::setprecision(value._precision) << std::fixed << value._value;
-    _out << tmp.str();
+    // restore the stream's formatting afterwards, so that it does not
+    // affect values printed later
+    auto flags = _out.flags();
+    auto precision = _out.precision();
+    _out << std::setprecision(value._precision) << std::fixed << value._value;
+    _out.flags(flags);
+    _out.precision(precision);
   } catch (...) {
     // ignore any errors here. logging should not have side effects
   }
@@ -109,14 +155,13 @@ LoggerStream::~LoggerStream() {
 #endif
 
   try {
-    // TODO: with c++20, we can get a view on the stream's underlying buffer,
-    // without copying it
-    Logger::log(_logid, _function, _file, _line, _level, _topicId, _out.str());
+    Logger::log(_logid, _function, _file, _line, _level, _topicId,
+                _buffer.view());
   } catch (...) {
     try {
       // logging the error may fail as well, and we should never throw in the
       // dtor
-      std::cerr << "failed to log: " << _out.str() << std::endl;
+      std::cerr << "failed to log: " << _buffer.view() << std::endl;
     } catch (...) {
     }
   }
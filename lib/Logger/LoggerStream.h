@@ -24,14 +24,46 @@
 #pragma once
 
 #include <cstddef>
+#include <memory>
+#include <ostream>
 #include <sstream>
+#include <streambuf>
 #include <string>
+#include <string_view>
 
 #include "Logger/LogLevel.h"
 #include "Logger/LogTopic.h"
 #include "Logger/Logger.h"
 
 namespace arangodb {
+/// @brief stream buffer in which log messages are assembled. messages of
+/// up to kInlineSize bytes are kept in an inline buffer, so that the
+/// common case of short log messages does not need any heap allocations.
+/// only longer messages are moved into a dynamically allocated buffer.
+class LoggerStreamBuffer final : public std::streambuf {
+ public:
+  static constexpr std::size_t kInlineSize = 256;
+
+  LoggerStreamBuffer() noexcept;
+  LoggerStreamBuffer(LoggerStreamBuffer const&) = delete;
+  LoggerStreamBuffer& operator=(LoggerStreamBuffer const&) = delete;
+
+  /// @brief the message assembled so far
+  std::string_view view() const noexcept {
+    return {pbase(), static_cast<std::size_t>(pptr() - pbase())};
+  }
+
+ protected:
+  int_type overflow(int_type ch) override;
+  std::streamsize xsputn(char const* data, std::streamsize length) override;
+
+ private:
+  void grow(std::size_t minFree);
+
+  std::unique_ptr<char[]> _heap;
+  char _inline[kInlineSize];
+};
+
 /// @brief base class for regular logging and audit logging streams.
 /// do _not_ add virtual methods here, as this will be bad for efficiency.
 class LoggerStreamBase {
@@ -71,7 +103,8 @@ class LoggerStreamBase {
   }
 
  protected:
-  std::stringstream _out;
+  LoggerStreamBuffer _buffer;
+  std::ostream _out;
   size_t _topicId;
   LogLevel _level;
   int _line;
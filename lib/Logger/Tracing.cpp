@@ -0,0 +1,456 @@
+////////////////////////////////////////////////////////////////////////////////
+/// DISCLAIMER
+///
+/// Copyright 2014-2023 ArangoDB GmbH, Cologne, Germany
+/// Copyright 2004-2014 triAGENS GmbH, Cologne, Germany
+///
+/// Licensed under the Apache License, Version 2.0 (the "License");
+/// you may not use this file except in compliance with the License.
+/// You may obtain a copy of the License at
+///
+///     http://www.apache.org/licenses/LICENSE-2.0
+///
+/// Unless required by applicable law or agreed to in writing, software
+/// distributed under the License is distributed on an "AS IS" BASIS,
+/// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+/// See the License for the specific language governing permissions and
+/// limitations under the License.
+///
+/// Copyright holder is ArangoDB GmbH, Cologne, Germany
+///
+/// @author Jan Steemann
+////////////////////////////////////////////////////////////////////////////////
+
+#include "Tracing.h"
+
+#include "Basics/Exceptions.h"
+#include "Basics/debugging.h"
+#include "Basics/voc-errors.h"
+#include "Logger/LogMacros.h"
+#include "Logger/Logger.h"
+#include "Logger/LoggerStream.h"
+#include "Random/RandomGenerator.h"
+
+#include <velocypack/Builder.h>
+#include <velocypack/Slice.h>
+#include <velocypack/Value.h>
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstdio>
+#include <fstream>
+#include <limits>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <variant>
+#include <vector>
+
+namespace arangodb::tracing {
+
+struct SpanData {
+  std::string name;
+  SpanKind kind;
+  SpanContext context;
+  uint64_t parentSpanId = 0;
+  std::chrono::system_clock::time_point startTime;
+  std::chrono::system_clock::time_point endTime;
+  std::vector<std::pair<std::string, std::variant<std::string, int64_t>>>
+      attributes;
+  bool error = false;
+  std::string errorMessage;
+};
+
+namespace {
+
+thread_local SpanContext currentSpanContext;
+
+struct TracerState {
+  std::atomic<bool> enabled{false};
+  // new traces are sampled if a random value is below this threshold
+  std::atomic<uint64_t> sampleThreshold{0};
+  std::atomic<uint64_t> exported{0};
+  std::atomic<uint64_t> dropped{0};
+
+  // protects everything below
+  std::mutex mutex;
+  std::condition_variable cv;
+  std::vector<std::unique_ptr<SpanData>> queue;
+  bool stopping = false;
+  Tracer::Options options;
+  std::ofstream out;
+  std::thread thread;
+};
+
+TracerState& state() {
+  // intentionally leaked, so that spans ended during static destruction
+  // do not access a destroyed object
+  static TracerState* s = new TracerState();
+  return *s;
+}
+
+uint64_t randomId() noexcept {
+  uint64_t id;
+  do {
+    id = RandomGenerator::interval(std::numeric_limits<uint64_t>::max());
+  } while (id == 0);
+  return id;
+}
+
+int64_t toUnixNanos(std::chrono::system_clock::time_point tp) noexcept {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+             tp.time_since_epoch())
+      .count();
+}
+
+std::string toHex(uint64_t value) {
+  char buffer[17];
+  snprintf(buffer, sizeof(buffer), "%016llx",
+           static_cast<unsigned long long>(value));
+  return std::string(buffer, 16);
+}
+
+bool parseHex(std::string_view value, uint64_t& result) noexcept {
+  TRI_ASSERT(value.size() <= 16);
+  result = 0;
+  for (char c : value) {
+    result <<= 4;
+    if (c >= '0' && c <= '9') {
+      result |= static_cast<uint64_t>(c - '0');
+    } else if (c >= 'a' && c <= 'f') {
+      result |= static_cast<uint64_t>(c - 'a' + 10);
+    } else {
+      // the spec only allows lowercase hex digits
+      return false;
+    }
+  }
+  return true;
+}
+
+void writeBatch(TracerState& s,
+                std::vector<std::unique_ptr<SpanData>> const& batch) {
+  std::string serverId;
+  if (s.options.serverId) {
+    serverId = s.options.serverId();
+  }
+
+  velocypack::Builder builder;
+  std::string line;
+  for (auto const& span : batch) {
+    builder.clear();
+    builder.openObject();
+    builder.add("traceId", velocypack::Value(span->context.traceIdString()));
+    builder.add("spanId", velocypack::Value(span->context.spanIdString()));
+    if (span->parentSpanId != 0) {
+      builder.add("parentSpanId", velocypack::Value(toHex(span->parentSpanId)));
+    }
+    builder.add("name", velocypack::Value(span->name));
+    builder.add("kind", velocypack::Value(static_cast<int>(span->kind)));
+    // 64 bit integers are encoded as strings, as in OTLP/JSON
+    builder.add("startTimeUnixNano", velocypack::Value(std::to_string(
+                                         toUnixNanos(span->startTime))));
+    builder.add("endTimeUnixNano", velocypack::Value(std::to_string(
+                                       toUnixNanos(span->endTime))));
+    builder.add("attributes", velocypack::Value(velocypack::ValueType::Object));
+    for (auto const& [key, value] : span->attributes) {
+      if (std::holds_alternative<int64_t>(value)) {
+        builder.add(key, velocypack::Value(std::get<int64_t>(value)));
+      } else {
+        builder.add(key, velocypack::Value(std::get<std::string>(value)));
+      }
+    }
+    builder.close();
+    if (span->error) {
+      builder.add("status", velocypack::Value(velocypack::ValueType::Object));
+      builder.add("code", velocypack::Value("error"));
+      builder.add("message", velocypack::Value(span->errorMessage));
+      builder.close();
+    }
+    builder.add("resource", velocypack::Value(velocypack::ValueType::Object));
+    builder.add("service.name", velocypack::Value("arangod"));
+    if (!s.options.role.empty()) {
+      builder.add("arangodb.role", velocypack::Value(s.options.role));
+    }
+    if (!serverId.empty()) {
+      builder.add("arangodb.server_id", velocypack::Value(serverId));
+    }
+    builder.close();
+    builder.close();
+
+    line = builder.slice().toJson();
+    line.push_back('\n');
+    s.out.write(line.data(), static_cast<std::streamsize>(line.size()));
+  }
+  s.out.flush();
+  if (!s.out.good()) {
+    LOG_TOPIC("6a1f3", WARN, Logger::REQUESTS)
+        << "unable to write spans to trace output file '"
+        << s.options.outputFile << "'";
+    s.out.clear();
+  } else {
+    s.exported.fetch_add(batch.size(), std::memory_order_relaxed);
+  }
+}
+
+void exportLoop() {
+  auto& s = state();
+  std::vector<std::unique_ptr<SpanData>> batch;
+  uint64_t reportedDrops = 0;
+  auto lastReport = std::chrono::steady_clock::now();
+
+  std::unique_lock lock(s.mutex);
+  while (true) {
+    // wake up early if the queue is filling up, so that we don't need to
+    // drop spans
+    s.cv.wait_for(lock, s.options.exportInterval, [&] {
+      return s.stopping || s.queue.size() >= s.options.maxQueuedSpans / 2;
+    });
+    bool const stopping = s.stopping;
+    batch.swap(s.queue);
+    lock.unlock();
+
+    if (!batch.empty()) {
+      try {
+        writeBatch(s, batch);
+      } catch (std::exception const& ex) {
+        LOG_TOPIC("9f2d0", WARN, Logger::REQUESTS)
+            << "caught exception while exporting spans: " << ex.what();
+      }
+      batch.clear();
+    }
+
+    uint64_t dropped = s.dropped.load(std::memory_order_relaxed);
+    auto now = std::chrono::steady_clock::now();
+    if (dropped != reportedDrops &&
+        (stopping || now - lastReport >= std::chrono::minutes(1))) {
+      LOG_TOPIC("c83e5", WARN, Logger::REQUESTS)
+          << "dropped " << (dropped - reportedDrops)
+          << " trace span(s) because the export queue was full";
+      reportedDrops = dropped;
+      lastReport = now;
+    }
+
+    lock.lock();
+    if (stopping && s.queue.empty()) {
+      break;
+    }
+  }
+}
+
+}  // namespace
+
+std::string SpanContext::traceIdString() const {
+  return toHex(traceIdHigh) + toHex(traceIdLow);
+}
+
+std::string SpanContext::spanIdString() const { return toHex(spanId); }
+
+std::string SpanContext::toTraceParent() const {
+  // version 00: "00-<trace id>-<parent id>-<flags>"
+  std::string result;
+  result.reserve(55);
+  result.append("00-");
+  result.append(traceIdString());
+  result.push_back('-');
+  result.append(spanIdString());
+  result.append(sampled ? "-01" : "-00");
+  return result;
+}
+
+std::optional<SpanContext> SpanContext::fromTraceParent(
+    std::string_view value) noexcept {
+  if (value.size() != 55 || value.substr(0, 3) != "00-" || value[35] != '-' ||
+      value[52] != '-') {
+    return std::nullopt;
+  }
+  SpanContext context;
+  uint64_t flags;
+  if (!parseHex(value.substr(3, 16), context.traceIdHigh) ||
+      !parseHex(value.substr(19, 16), context.traceIdLow) ||
+      !parseHex(value.substr(36, 16), context.spanId) ||
+      !parseHex(value.substr(53, 2), flags) || !context.valid()) {
+    return std::nullopt;
+  }
+  context.sampled = (flags & 0x01) != 0;
+  return context;
+}
+
+SpanContext const& currentContext() noexcept { return currentSpanContext; }
+
+ContextScope::ContextScope(SpanContext const& context) noexcept
+    : _previous(currentSpanContext) {
+  currentSpanContext = context;
+}
+
+ContextScope::~ContextScope() { currentSpanContext = _previous; }
+
+Span::Span() noexcept = default;
+
+Span::Span(std::string_view name, SpanKind kind)
+    : Span(name, kind, currentSpanContext) {}
+
+Span::Span(std::string_view name, SpanKind kind, SpanContext const& parent) {
+  if (!Tracer::enabled()) {
+    return;
+  }
+  if (parent.valid()) {
+    _context.traceIdHigh = parent.traceIdHigh;
+    _context.traceIdLow = parent.traceIdLow;
+    _context.sampled = parent.sampled;
+  } else {
+    _context.traceIdHigh = randomId();
+    _context.traceIdLow = randomId();
+    _context.sampled = Tracer::sampleNewTrace();
+  }
+  _context.spanId = randomId();
+
+  if (_context.sampled) {
+    _data = std::make_unique<SpanData>();
+    _data->name = name;
+    _data->kind = kind;
+    _data->parentSpanId = parent.valid() ? parent.spanId : 0;
+    _data->startTime = std::chrono::system_clock::now();
+  }
+}
+
+Span::~Span() { end(); }
+
+Span::Span(Span&& other) noexcept
+    : _context(other._context), _data(std::move(other._data)) {
+  other._context = SpanContext{};
+}
+
+Span& Span::operator=(Span&& other) noexcept {
+  if (this != &other) {
+    end();
+    _context = other._context;
+    _data = std::move(other._data);
+    other._context = SpanContext{};
+  }
+  return *this;
+}
+
+void Span::setAttribute(std::string_view key, std::string_view value) {
+  if (_data != nullptr) {
+    _data->attributes.emplace_back(std::string(key), std::string(value));
+  }
+}
+
+void Span::setAttribute(std::string_view key, int64_t value) {
+  if (_data != nullptr) {
+    _data->attributes.emplace_back(std::string(key), value);
+  }
+}
+
+void Span::setError(std::string_view message) {
+  if (_data != nullptr) {
+    _data->error = true;
+    _data->errorMessage = message;
+  }
+}
+
+void Span::end() noexcept {
+  if (_data != nullptr) {
+    _data->endTime = std::chrono::system_clock::now();
+    _data->context = _context;
+    Tracer::submit(std::move(_data));
+  }
+}
+
+void Tracer::start(Options options) {
+  auto& s = state();
+  std::lock_guard guard(s.mutex);
+  if (s.thread.joinable()) {
+    THROW_ARANGO_EXCEPTION_MESSAGE(TRI_ERROR_INTERNAL,
+                                   "tracing is already turned on");
+  }
+
+  s.out.open(options.outputFile, std::ios::out | std::ios::app);
+  if (!s.out.is_open()) {
+    THROW_ARANGO_EXCEPTION_MESSAGE(
+        TRI_ERROR_CANNOT_WRITE_FILE,
+        "unable to open trace output file '" + options.outputFile + "'");
+  }
+
+  double rate = std::clamp(options.sampleRate, 0.0, 1.0);
+  uint64_t threshold =
+      rate >= 1.0 ? std::numeric_limits<uint64_t>::max()
+                  : static_cast<uint64_t>(
+                        rate * static_cast<double>(
+                                   std::numeric_limits<uint64_t>::max()));
+  options.maxQueuedSpans = std::max<std::size_t>(options.maxQueuedSpans, 2);
+  s.options = std::move(options);
+  s.stopping = false;
+  s.sampleThreshold.store(threshold, std::memory_order_relaxed);
+  s.thread = std::thread(&exportLoop);
+  s.enabled.store(true, std::memory_order_release);
+}
+
+void Tracer::stop() {
+  auto& s = state();
+  s.enabled.store(false, std::memory_order_release);
+  std::thread thread;
+  {
+    std::lock_guard guard(s.mutex);
+    s.stopping = true;
+    thread = std::move(s.thread);
+  }
+  s.cv.notify_one();
+  if (thread.joinable()) {
+    thread.join();
+  }
+  std::lock_guard guard(s.mutex);
+  if (s.out.is_open()) {
+    s.out.close();
+  }
+}
+
+bool Tracer::enabled() noexcept {
+  return state().enabled.load(std::memory_order_acquire);
+}
+
+uint64_t Tracer::exportedSpans() noexcept {
+  return state().exported.load(std::memory_order_relaxed);
+}
+
+uint64_t Tracer::droppedSpans() noexcept {
+  return state().dropped.load(std::memory_order_relaxed);
+}
+
+bool Tracer::sampleNewTrace() noexcept {
+  uint64_t threshold = state().sampleThreshold.load(std::memory_order_relaxed);
+  if (threshold == 0) {
+    return false;
+  }
+  if (threshold == std::numeric_limits<uint64_t>::max()) {
+    return true;
+  }
+  return RandomGenerator::interval(std::numeric_limits<uint64_t>::max()) <
+         threshold;
+}
+
+void Tracer::submit(std::unique_ptr<SpanData> data) noexcept {
+  auto& s = state();
+  bool notify = false;
+  {
+    std::lock_guard guard(s.mutex);
+    if (s.stopping || !s.thread.joinable() ||
+        s.queue.size() >= s.options.maxQueuedSpans) {
+      s.dropped.fetch_add(1, std::memory_order_relaxed);
+      return;
+    }
+    try {
+      s.queue.emplace_back(std::move(data));
+    } catch (...) {
+      s.dropped.fetch_add(1, std::memory_order_relaxed);
+      return;
+    }
+    notify = s.queue.size() >= s.options.maxQueuedSpans / 2;
+  }
+  if (notify) {
+    s.cv.notify_one();
+  }
+}
+
+}  // namespace arangodb::tracing
@@ -0,0 +1,187 @@
+////////////////////////////////////////////////////////////////////////////////
+/// DISCLAIMER
+///
+/// Copyright 2014-2023 ArangoDB GmbH, Cologne, Germany
+/// Copyright 2004-2014 triAGENS GmbH, Cologne, Germany
+///
+/// Licensed under the Apache License, Version 2.0 (the "License");
+/// you may not use this file except in compliance with the License.
+/// You may obtain a copy of the License at
+///
+///     http://www.apache.org/licenses/LICENSE-2.0
+///
+/// Unless required by applicable law or agreed to in writing, software
+/// distributed under the License is distributed on an "AS IS" BASIS,
+/// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+/// See the License for the specific language governing permissions and
+/// limitations under the License.
+///
+/// Copyright holder is ArangoDB GmbH, Cologne, Germany
+///
+/// @author Jan Steemann
+////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+
+namespace arangodb::tracing {
+
+/// @brief identifies a span within a trace, following the W3C trace
+/// context specification (https://www.w3.org/TR/trace-context/).
+/// a span context is propagated between servers in the `traceparent`
+/// header, so that the spans of all servers involved in handling a
+/// request can be put together into a single trace.
+struct SpanContext {
+  uint64_t traceIdHigh = 0;
+  uint64_t traceIdLow = 0;
+  uint64_t spanId = 0;
+  /// @brief whether or not the spans of this trace are recorded. the
+  /// sampling decision is made once for the root span of a trace, and is
+  /// then inherited by all its descendants, on all servers.
+  bool sampled = false;
+
+  bool valid() const noexcept {
+    return (traceIdHigh != 0 || traceIdLow != 0) && spanId != 0;
+  }
+
+  /// @brief trace id as 32 lowercase hex digits
+  std::string traceIdString() const;
+  /// @brief span id as 16 lowercase hex digits
+  std::string spanIdString() const;
+
+  /// @brief value for the `traceparent` header
+  std::string toTraceParent() const;
+  /// @brief parse a `traceparent` header value. returns std::nullopt if the
+  /// value is not a valid version 00 traceparent.
+  static std::optional<SpanContext> fromTraceParent(
+      std::string_view value) noexcept;
+};
+
+/// @brief name of the HTTP header used for propagating span contexts
+inline constexpr std::string_view kTraceParentHeader = "traceparent";
+
+/// @brief kind of a span. values are the same as in OpenTelemetry
+enum class SpanKind : uint8_t {
+  kInternal = 1,
+  // handling of a request received from another process
+  kServer = 2,
+  // a request sent to another process
+  kClient = 3,
+};
+
+/// @brief returns the span context that is active on the current thread.
+/// the returned context is invalid if there is no active span.
+SpanContext const& currentContext() noexcept;
+
+/// @brief makes a span context the active one on the current thread, for
+/// the lifetime of the scope object. spans that are started while the scope
+/// is active become children of the context, and outgoing cluster-internal
+/// requests propagate it.
+/// note: the active context is thread-local, and it is not carried over to
+/// other threads automatically.
+class ContextScope {
+ public:
+  explicit ContextScope(SpanContext const& context) noexcept;
+  ~ContextScope();
+
+  ContextScope(ContextScope const&) = delete;
+  ContextScope& operator=(ContextScope const&) = delete;
+
+ private:
+  SpanContext _previous;
+};
+
+struct SpanData;
+
+/// @brief a timed operation that is part of a trace. spans are started
+/// when they are constructed and ended at the latest when they are
+/// destroyed. only spans of sampled traces are recorded. for all other
+/// spans, only the span context is maintained, so that the (negative)
+/// sampling decision is propagated to other servers.
+/// if tracing is turned off, spans are no-ops and have an invalid context.
+/// spans are not thread-safe, but they can be moved between threads.
+class Span {
+ public:
+  /// @brief creates an empty span, which does nothing
+  Span() noexcept;
+  /// @brief starts a span, as a child of the span that is active on the
+  /// current thread. if there is none, the span starts a new trace.
+  Span(std::string_view name, SpanKind kind);
+  /// @brief starts a span, as a child of the given (remote) parent. if
+  /// the parent is invalid, the span starts a new trace.
+  Span(std::string_view name, SpanKind kind, SpanContext const& parent);
+  ~Span();
+
+  Span(Span&& other) noexcept;
+  Span& operator=(Span&& other) noexcept;
+  Span(Span const&) = delete;
+  Span& operator=(Span const&) = delete;
+
+  SpanContext const& context() const noexcept { return _context; }
+
+  /// @brief whether or not the span is recorded and exported
+  bool isRecording() const noexcept { return _data != nullptr; }
+
+  void setAttribute(std::string_view key, std::string_view value);
+  void setAttribute(std::string_view key, int64_t value);
+  /// @brief marks the span as failed
+  void setError(std::string_view message);
+
+  /// @brief ends the span and hands it over to the exporter. calling end()
+  /// more than once has no effect.
+  void end() noexcept;
+
+ private:
+  SpanContext _context;
+  std::unique_ptr<SpanData> _data;
+};
+
+/// @brief collects ended spans and exports them in batches from a
+/// background thread.
+class Tracer {
+ public:
+  struct Options {
+    /// @brief file to which spans are appended, one JSON object per line
+    std::string outputFile;
+    /// @brief probability with which new traces are sampled
+    double sampleRate = 0.001;
+    /// @brief maximum number of ended spans waiting for export. spans are
+    /// dropped if the exporter cannot keep up
+    std::size_t maxQueuedSpans = 65536;
+    /// @brief interval in which queued spans are exported
+    std::chrono::milliseconds exportInterval{1000};
+    /// @brief role of this server, added to every exported span
+    std::string role;
+    /// @brief returns the id of this server, which is added to every
+    /// exported span. called for every batch, because the id may not be
+    /// known yet when tracing is started
+    std::function<std::string()> serverId;
+  };
+
+  /// @brief turn on tracing and start the export thread. throws if the
+  /// output file cannot be opened
+  static void start(Options options);
+  /// @brief turn off tracing, and export all remaining spans
+  static void stop();
+
+  /// @brief whether or not tracing is turned on
+  static bool enabled() noexcept;
+
+  /// @brief number of spans that were exported/dropped since start
+  static uint64_t exportedSpans() noexcept;
+  static uint64_t droppedSpans() noexcept;
+
+ private:
+  friend class Span;
+  static bool sampleNewTrace() noexcept;
+  static void submit(std::unique_ptr<SpanData> data) noexcept;
+};
+
+}  // namespace arangodb::tracing
@@ -101,3 +101,8 @@ ParseResult<AttributeMasking> AttributeMasking::parse(Maskings* maskings,
 bool AttributeMasking::match(std::vector<std::string_view> const& path) const {
   return _path.match(path);
 }
+
+bool AttributeMasking::mayMatchBelow(
+    std::vector<std::string_view> const& path) const {
+  return _path.mayMatchBelow(path);
+}
@@ -59,6 +59,7 @@ class AttributeMasking {
       : _path(std::move(path)), _func(std::move(func)) {}
 
   bool match(std::vector<std::string_view> const&) const;
+  bool mayMatchBelow(std::vector<std::string_view> const&) const;
 
   MaskingFunction* func() const { return _func.get(); }
 
@@ -104,3 +104,13 @@ MaskingFunction* Collection::masking(
 
   return nullptr;
 }
+
+bool Collection::mayMaskBelow(std::vector<std::string_view> const& path) const {
+  for (auto const& m : _maskings) {
+    if (m.mayMatchBelow(path)) {
+      return true;
+    }
+  }
+
+  return false;
+}
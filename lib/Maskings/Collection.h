@@ -55,6 +55,9 @@ class Collection {
 
   MaskingFunction* masking(std::vector<std::string_view> const& path) const;
 
+  /// @brief whether any masking can apply to path or to a path below it
+  bool mayMaskBelow(std::vector<std::string_view> const& path) const;
+
  private:
   CollectionSelection _selection;
   // LATER: CollectionFilter _filter;
@@ -268,7 +268,13 @@ void Maskings::addMaskedObject(Collection const& collection,
 
     path.push_back(key);
 
-    if (value.isObject()) {
+    if ((value.isObject() || value.isArray()) &&
+        !collection.mayMaskBelow(path)) {
+      // no masking can apply to anything in this subtree. all values
+      // that come from JSON input are copied unmodified, so we can copy
+      // the whole subtree at once
+      out.add(key, value);
+    } else if (value.isObject()) {
       VPackObjectBuilder ob(&out, key);
       addMaskedObject(collection, path, value, out, buffer);
     } else if (value.isArray()) {
@@ -284,13 +290,14 @@ void Maskings::addMaskedObject(Collection const& collection,
 }
 
 void Maskings::addMasked(Collection const& collection, VPackBuilder& out,
-                         velocypack::Slice data) const {
+                         velocypack::Slice data,
+                         std::vector<std::string_view>& path,
+                         std::string& buffer) const {
   if (!data.isObject()) {
     return;
   }
 
-  std::string buffer;
-  std::vector<std::string_view> path;
+  TRI_ASSERT(path.empty());
   std::string_view dataStr("data");
   VPackObjectBuilder ob(&out, dataStr);
 
@@ -298,19 +305,21 @@ void Maskings::addMasked(Collection const& collection, VPackBuilder& out,
 }
 
 void Maskings::addMasked(Collection const& collection,
-                         basics::StringBuffer& data,
-                         velocypack::Slice slice) const {
+                         basics::StringBuffer& data, velocypack::Slice slice,
+                         velocypack::Builder& builder,
+                         std::vector<std::string_view>& path,
+                         std::string& buffer) const {
   if (!slice.isObject()) {
     return;
   }
 
-  VPackBuilder builder;
+  builder.clear();
 
   if (slice.hasKey(StaticStrings::KeyString)) {
     // non-enveloped format - the document is at the top level
     {
       VPackObjectBuilder ob(&builder);
-      addMasked(collection, builder, slice);
+      addMasked(collection, builder, slice, path, buffer);
     }
 
     // the maskings will generate a result object that contains a "data"
@@ -327,7 +336,7 @@ void Maskings::addMasked(Collection const& collection,
         auto key = entry.key.stringView();
 
         if (key == dataStr) {
-          addMasked(collection, builder, entry.value);
+          addMasked(collection, builder, entry.value, path, buffer);
         } else {
           builder.add(key, entry.value);
         }
@@ -374,14 +383,23 @@ void Maskings::mask(std::string const& name, basics::StringBuffer const& data,
   char const* e = p + data.length();
   char const* q = p;
 
+  // the builders and buffers are reused for all documents of the batch, so
+  // that we don't need to allocate new ones for every document
+  VPackBuilder parsed;
+  VPackParser parser(parsed);
+  VPackBuilder builder;
+  std::vector<std::string_view> path;
+  std::string buffer;
+
   while (p < e) {
     while (p < e && (*p != '\n' && *p != '\r')) {
       ++p;
     }
 
-    std::shared_ptr<VPackBuilder> builder = VPackParser::fromJson(q, p - q);
+    parsed.clear();
+    parser.parse(q, p - q);
 
-    addMasked(*collection, result, builder->slice());
+    addMasked(*collection, result, parsed.slice(), builder, path, buffer);
 
     while (p < e && (*p == '\n' || *p == '\r')) {
       ++p;
@@ -88,9 +88,12 @@ class Maskings {
                        velocypack::Slice data, velocypack::Builder& builder,
                        std::string& buffer) const;
   void addMasked(Collection const& collection, VPackBuilder& out,
-                 velocypack::Slice data) const;
+                 velocypack::Slice data, std::vector<std::string_view>& path,
+                 std::string& buffer) const;
   void addMasked(Collection const& collection, basics::StringBuffer& data,
-                 velocypack::Slice slice) const;
+                 velocypack::Slice slice, velocypack::Builder& builder,
+                 std::vector<std::string_view>& path,
+                 std::string& buffer) const;
 
  private:
   std::map<std::string, Collection> _collections;
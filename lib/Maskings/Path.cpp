@@ -164,3 +164,22 @@ bool Path::match(std::vector<std::string_view> const& path) const {
 
   return true;
 }
+
+bool Path::mayMatchBelow(std::vector<std::string_view> const& path) const {
+  if (_any || _wildcard) {
+    // wildcard paths can match at any depth
+    return true;
+  }
+
+  if (path.size() > _components.size()) {
+    return false;
+  }
+
+  for (size_t i = 0; i < path.size(); ++i) {
+    if (path[i] != _components[i]) {
+      return false;
+    }
+  }
+
+  return true;
+}
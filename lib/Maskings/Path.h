@@ -44,6 +44,9 @@ class Path {
 
   bool match(std::vector<std::string_view> const& path) const;
 
+  /// @brief whether the path can match path or any path below it
+  bool mayMatchBelow(std::vector<std::string_view> const& path) const;
+
  private:
   bool _wildcard;
   bool _any;
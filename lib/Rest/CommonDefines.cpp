@@ -49,7 +49,7 @@ std::string contentTypeToString(ContentType type) {
   }
 }
 
-ContentType stringToContentType(std::string const& val, ContentType def) {
+ContentType stringToContentType(std::string_view val, ContentType def) {
   if (val.size() >= StaticStrings::MimeTypeJsonNoEncoding.size() &&
       val.compare(0, StaticStrings::MimeTypeJsonNoEncoding.size(),
                   StaticStrings::MimeTypeJsonNoEncoding) == 0) {
@@ -26,6 +26,7 @@
 #include <cstdint>
 #include <ostream>
 #include <string>
+#include <string_view>
 
 namespace arangodb {
 namespace rest {
@@ -79,7 +80,7 @@ enum class ContentType {
 };
 
 std::string contentTypeToString(ContentType type);
-ContentType stringToContentType(std::string const& input, ContentType def);
+ContentType stringToContentType(std::string_view input, ContentType def);
 
 enum class EncodingType { DEFLATE, GZIP, UNSET };
 
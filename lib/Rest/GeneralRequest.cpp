@@ -403,4 +403,18 @@ velocypack::Options const* GeneralRequest::validationOptions(
   return &basics::VelocyPackHelper::looseRequestValidationOptions;
 }
 
+/// @brief get VelocyPack options for parsing a JSON body. if the body is
+/// pure ASCII, it cannot contain invalid UTF-8 sequences, so the parser
+/// can skip validating every string value
+velocypack::Options const* GeneralRequest::jsonValidationOptions(
+    bool strictValidation, uint8_t const* data, size_t length) {
+  if (strictValidation &&
+      basics::StringUtils::isAscii(reinterpret_cast<char const*>(data),
+                                   length)) {
+    // the loose options only differ by not validating UTF-8
+    strictValidation = false;
+  }
+  return validationOptions(strictValidation);
+}
+
 }  // namespace arangodb
@@ -217,6 +217,13 @@ class GeneralRequest {
   /// internal requests
   velocypack::Options const* validationOptions(bool strictValidation);
 
+  /// @brief get VelocyPack options for parsing a JSON body. if the body is
+  /// pure ASCII, it cannot contain invalid UTF-8 sequences, so the parser
+  /// can skip validating every string value
+  velocypack::Options const* jsonValidationOptions(bool strictValidation,
+                                                   uint8_t const* data,
+                                                   size_t length);
+
   ConnectionInfo _connectionInfo;  /// connection info
 
   /// request payload buffer, exact access semantics are defined in subclass
@@ -135,6 +135,9 @@ class GeneralResponse {
 
   virtual bool isResponseEmpty() const noexcept = 0;
 
+  // returns the memory allocated for the response payload
+  virtual std::size_t memoryUsage() const noexcept = 0;
+
   uint64_t messageId() const { return _messageId; }
   void setMessageId(uint64_t msgId) { _messageId = msgId; }
 
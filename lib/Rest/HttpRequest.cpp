@@ -41,9 +41,19 @@ using namespace arangodb::basics;
 
 namespace {
 std::string urlDecode(char const* begin, char const* end) {
+  // fast path for the common case of values that don't need any decoding
+  char const* i = begin;
+  while (i != end && *i != '%' && *i != '+') {
+    ++i;
+  }
+  if (i == end) {
+    return std::string(begin, end);
+  }
+
   std::string out;
   out.reserve(static_cast<size_t>(end - begin));
-  for (char const* i = begin; i != end; ++i) {
+  out.append(begin, i);
+  for (; i != end; ++i) {
     std::string::value_type c = (*i);
     if (c == '%') {
       if (i + 2 < end) {
@@ -430,8 +440,8 @@ void HttpRequest::parseHeader(char* start, size_t length) {
         }
 
         if (keyBegin < keyEnd) {
-          setHeader(std::string(keyBegin, keyEnd - keyBegin),
-                    std::string(valueBegin, valueEnd - valueBegin));
+          setHeader(std::string_view(keyBegin, keyEnd - keyBegin),
+                    std::string_view(valueBegin, valueEnd - valueBegin));
         }
       }
 
@@ -451,8 +461,8 @@ void HttpRequest::parseHeader(char* start, size_t length) {
 
         // use empty value
         if (keyBegin < keyEnd) {
-          setHeader(std::string(keyBegin, keyEnd - keyBegin),
-                    std::string("", 0));
+          setHeader(std::string_view(keyBegin, keyEnd - keyBegin),
+                    std::string_view());
         }
       }
     }
@@ -462,20 +472,24 @@ void HttpRequest::parseHeader(char* start, size_t length) {
 }
 
 void HttpRequest::parseUrl(char const* path, size_t length) {
+  std::string_view url(path, length);
   std::string tmp;
-  tmp.reserve(length);
-  // get rid of '//'
-  for (size_t i = 0; i < length; ++i) {
-    tmp.push_back(path[i]);
-    if (path[i] == '/') {
-      while (i + 1 < length && path[i + 1] == '/') {
-        ++i;
+  if (url.find("//") != std::string_view::npos) {
+    tmp.reserve(length);
+    // get rid of '//'
+    for (size_t i = 0; i < length; ++i) {
+      tmp.push_back(path[i]);
+      if (path[i] == '/') {
+        while (i + 1 < length && path[i + 1] == '/') {
+          ++i;
+        }
       }
     }
+    url = tmp;
   }
 
-  char const* start = tmp.data();
-  char const* end = start + tmp.size();
+  char const* start = url.data();
+  char const* end = start + url.size();
   // look for database name in URL
   if (end - start >= 5) {
     char const* q = start;
@@ -567,12 +581,16 @@ void HttpRequest::parseUrl(char const* path, size_t length) {
   }
 }
 
-void HttpRequest::setHeader(std::string key, std::string value) {
-  StringUtils::tolowerInPlace(key);  // always lowercase key
+void HttpRequest::setHeader(std::string_view key, std::string_view value) {
+  // always lowercase key. header names are typically short enough for the
+  // small string optimization, so this does not allocate memory for most
+  // of the headers that are not stored
+  std::string lowerKey(key);
+  StringUtils::tolowerInPlace(lowerKey);
 
-  if (key == StaticStrings::ContentLength) {
-    size_t len = NumberUtils::atoi_zero<uint64_t>(value.c_str(),
-                                                  value.c_str() + value.size());
+  if (lowerKey == StaticStrings::ContentLength) {
+    size_t len = NumberUtils::atoi_zero<uint64_t>(value.data(),
+                                                  value.data() + value.size());
     if (_payload.capacity() < len) {
       // lets not reserve more than 64MB at once
       uint64_t maxReserve = std::min<uint64_t>(2 << 26, len);
@@ -582,17 +600,17 @@ void HttpRequest::setHeader(std::string key, std::string value) {
     return;
   }
 
-  if (key == StaticStrings::Accept) {
+  if (lowerKey == StaticStrings::Accept) {
     _contentTypeResponse =
         rest::stringToContentType(value, /*default*/ ContentType::JSON);
     if (value.find(',') != std::string::npos) {
-      setStringValue(_contentTypeResponsePlain, std::move(value));
+      setStringValue(_contentTypeResponsePlain, std::string(value));
     } else {
       setStringValue(_contentTypeResponsePlain, std::string());
     }
     return;
   } else if (_contentType == ContentType::UNSET &&
-             key == StaticStrings::ContentTypeHeader) {
+             lowerKey == StaticStrings::ContentTypeHeader) {
     auto res = rest::stringToContentType(value, /*default*/ ContentType::UNSET);
     // simon: the "@arangodb/requests" module by default the "text/plain"
     // content-types for JSON in most tests. As soon as someone fixes all the
@@ -602,7 +620,7 @@ void HttpRequest::setHeader(std::string key, std::string value) {
       _contentType = res;
       return;
     }
-  } else if (key == StaticStrings::AcceptEncoding) {
+  } else if (lowerKey == StaticStrings::AcceptEncoding) {
     // This can be much more elaborated as the can specify weights on encodings
     // However, for now just toggle on deflate if deflate is requested
     if (StaticStrings::EncodingDeflate == value) {
@@ -612,17 +630,18 @@ void HttpRequest::setHeader(std::string key, std::string value) {
     } else if (StaticStrings::EncodingGzip == value) {
       _acceptEncoding = EncodingType::GZIP;
     }
-  } else if (key == "cookie") {
-    parseCookies(value.c_str(), value.size());
+  } else if (lowerKey == "cookie") {
+    // parseCookies modifies the buffer in place, so it needs a copy
+    std::string cookies(value);
+    parseCookies(cookies.data(), cookies.size());
     return;
   }
 
-  auto memoryUsage = key.size() + value.size();
-  auto it = _headers.try_emplace(std::move(key), std::move(value));
+  auto memoryUsage = lowerKey.size() + value.size();
+  auto it = _headers.try_emplace(std::move(lowerKey), value);
   if (!it.second) {
     auto old = it.first->first.size() + it.first->second.size();
-    // cppcheck-suppress accessMoved
-    _headers[std::move(key)] = std::move(value);
+    it.first->second = value;
     _memoryUsage -= old;
   }
   _memoryUsage += memoryUsage;
@@ -885,7 +904,8 @@ VPackSlice HttpRequest::payload(bool strictValidation) {
     if (!_payload.empty()) {
       if (!_vpackBuilder) {
         TRI_ASSERT(!_validatedPayload);
-        VPackOptions const* options = validationOptions(strictValidation);
+        VPackOptions const* options = jsonValidationOptions(
+            strictValidation, _payload.data(), _payload.size());
         VPackParser parser(options);
         parser.parse(_payload.data(), _payload.size());
         _vpackBuilder = parser.steal();
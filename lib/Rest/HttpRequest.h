@@ -72,7 +72,7 @@ class HttpRequest final : public GeneralRequest {
 
   /// @brief parse an existing path
   void parseUrl(char const* start, size_t len);
-  void setHeader(std::string key, std::string value);
+  void setHeader(std::string_view key, std::string_view value);
 
  private:
   void setCookie(std::string key, std::string value);
@@ -65,6 +65,10 @@ class HttpResponse : public GeneralResponse {
 
   size_t bodySize() const;
 
+  std::size_t memoryUsage() const noexcept override {
+    return _body == nullptr ? 0 : _body->capacity();
+  }
+
   void sealBody() { _bodySize = _body->length(); }
 
   // you should call writeHeader only after the body has been created
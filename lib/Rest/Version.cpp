@@ -387,6 +387,8 @@ std::string Version::getBoostVersion() {
 std::string Version::getBoostReactorType() {
 #if defined(BOOST_ASIO_HAS_IOCP)
   return std::string("iocp");
+#elif defined(BOOST_ASIO_HAS_IO_URING_AS_DEFAULT)
+  return std::string("io_uring");
 #elif defined(BOOST_ASIO_HAS_EPOLL)
   return std::string("epoll");
 #elif defined(BOOST_ASIO_HAS_KQUEUE)
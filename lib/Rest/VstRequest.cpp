@@ -114,7 +114,9 @@ VPackSlice VstRequest::payload(bool strictValidation) {
     if (!_vpackBuilder && _payload.size() > _payloadOffset) {
       _vpackBuilder = VPackParser::fromJson(
           _payload.data() + _payloadOffset, _payload.size() - _payloadOffset,
-          validationOptions(strictValidation));
+          jsonValidationOptions(strictValidation,
+                                _payload.data() + _payloadOffset,
+                                _payload.size() - _payloadOffset));
       _memoryUsage += _vpackBuilder->bufferRef().size();
     }
     if (_vpackBuilder) {
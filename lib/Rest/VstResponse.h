@@ -41,6 +41,10 @@ class VstResponse : public GeneralResponse {
 
   bool isResponseEmpty() const noexcept override { return _payload.empty(); }
 
+  std::size_t memoryUsage() const noexcept override {
+    return _payload.capacity();
+  }
+
   Endpoint::TransportType transportType() override {
     return Endpoint::TransportType::VST;
   }
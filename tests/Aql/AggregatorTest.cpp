@@ -0,0 +1,170 @@
+////////////////////////////////////////////////////////////////////////////////
+/// DISCLAIMER
+///
+/// Copyright 2014-2023 ArangoDB GmbH, Cologne, Germany
+/// Copyright 2004-2014 triAGENS GmbH, Cologne, Germany
+///
+/// Licensed under the Apache License, Version 2.0 (the "License");
+/// you may not use this file except in compliance with the License.
+/// You may obtain a copy of the License at
+///
+///     http://www.apache.org/licenses/LICENSE-2.0
+///
+/// Unless required by applicable law or agreed to in writing, software
+/// distributed under the License is distributed on an "AS IS" BASIS,
+/// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+/// See the License for the specific language governing permissions and
+/// limitations under the License.
+///
+/// Copyright holder is ArangoDB GmbH, Cologne, Germany
+///
+/// @author Jan Steemann
+////////////////////////////////////////////////////////////////////////////////
+
+#include "gtest/gtest.h"
+
+#include "Aql/Aggregator.h"
+#include "Aql/AqlValue.h"
+
+#include <velocypack/Builder.h>
+#include <velocypack/Iterator.h>
+#include <velocypack/Options.h>
+#include <velocypack/Parser.h>
+
+#include <memory>
+#include <string_view>
+#include <vector>
+
+using namespace arangodb;
+using namespace arangodb::aql;
+
+namespace {
+
+// feeds the partial results into the aggregator and returns the result
+std::shared_ptr<velocypack::Builder> aggregate(
+    std::string_view type, std::initializer_list<char const*> partials) {
+  auto aggregator =
+      Aggregator::fromTypeString(&velocypack::Options::Defaults, type);
+  for (auto json : partials) {
+    auto input = velocypack::Parser::fromJson(json);
+    aggregator->reduce(AqlValue(AqlValueHintSliceNoCopy(input->slice())));
+  }
+  auto result = std::make_shared<velocypack::Builder>();
+  AqlValue value = aggregator->stealValue();
+  result->add(value.slice());
+  value.destroy();
+  return result;
+}
+
+}  // namespace
+
+TEST(AggregatorTest, all_official_aggregators_can_run_in_two_phases) {
+  for (auto type :
+       {"LENGTH", "MIN", "MAX", "SUM", "AVERAGE", "VARIANCE_POPULATION",
+        "VARIANCE_SAMPLE", "STDDEV_POPULATION", "STDDEV_SAMPLE", "UNIQUE",
+        "SORTED_UNIQUE", "COUNT_DISTINCT", "BIT_AND", "BIT_OR", "BIT_XOR",
+        "APPROX_COUNT_DISTINCT"}) {
+    ASSERT_TRUE(Aggregator::isValid(type)) << type;
+    std::string_view dbServer = Aggregator::pushToDBServerAs(type);
+    std::string_view coordinator = Aggregator::runOnCoordinatorAs(type);
+    EXPECT_FALSE(dbServer.empty()) << type;
+    EXPECT_FALSE(coordinator.empty()) << type;
+    // both parts must be known aggregators
+    EXPECT_NO_THROW(Aggregator::factoryFromTypeString(dbServer)) << type;
+    EXPECT_NO_THROW(Aggregator::factoryFromTypeString(coordinator)) << type;
+  }
+}
+
+TEST(AggregatorTest, unique_step2_merges_all_partial_results) {
+  auto result = aggregate("UNIQUE_STEP2", {R"([1, 2])", R"([2, 3, 4])"});
+  EXPECT_EQ("[1,2,3,4]", result->slice().toJson());
+}
+
+TEST(AggregatorTest, sorted_unique_step2_merges_all_partial_results) {
+  auto result =
+      aggregate("SORTED_UNIQUE_STEP2", {R"([3, 1])", R"([1, 4, 2])"});
+  EXPECT_EQ("[1,2,3,4]", result->slice().toJson());
+}
+
+TEST(AggregatorTest, count_distinct_step2_merges_all_partial_results) {
+  auto result = aggregate("COUNT_DISTINCT_STEP2",
+                          {R"(["a", "b"])", R"(["b", "c", "d"])"});
+  EXPECT_EQ(4, result->slice().getNumber<int64_t>());
+}
+
+TEST(AggregatorTest, union_step2_concatenates_partial_groups) {
+  auto result = aggregate("UNION_STEP2", {R"([1, 2])", R"([2, 3])", R"([])"});
+  EXPECT_EQ("[1,2,2,3]", result->slice().toJson());
+}
+
+TEST(AggregatorTest, sliding_aggregators_support_removal) {
+  for (auto type : {"LENGTH", "COUNT", "MIN", "MAX", "SUM", "AVERAGE", "AVG"}) {
+    EXPECT_NE(nullptr, Aggregator::slidingFromTypeString(
+                           &velocypack::Options::Defaults, type))
+        << type;
+  }
+  for (auto type : {"UNIQUE", "STDDEV", "BIT_AND", "COUNT_DISTINCT"}) {
+    EXPECT_EQ(nullptr, Aggregator::slidingFromTypeString(
+                           &velocypack::Options::Defaults, type))
+        << type;
+  }
+}
+
+TEST(AggregatorTest, sliding_aggregators_produce_window_results) {
+  auto input = velocypack::Parser::fromJson("[3, 1, 4, 1, 5, 9, 2, 6]");
+  std::vector<AqlValue> values;
+  for (auto v : velocypack::ArrayIterator(input->slice())) {
+    values.emplace_back(AqlValueHintSliceNoCopy(v));
+  }
+
+  // window of 3 rows, sliding over the input
+  auto check = [&](std::string_view type, std::string_view expected) {
+    auto aggregator =
+        Aggregator::slidingFromTypeString(&velocypack::Options::Defaults, type);
+    ASSERT_NE(nullptr, aggregator);
+    velocypack::Builder result;
+    result.openArray();
+    for (size_t i = 0; i < values.size(); ++i) {
+      aggregator->reduce(values[i]);
+      if (i >= 3) {
+        aggregator->remove(values[i - 3]);
+      }
+      if (i >= 2) {
+        AqlValue value = aggregator->get();
+        result.add(value.slice());
+        value.destroy();
+      }
+    }
+    result.close();
+    EXPECT_EQ(expected, result.slice().toJson()) << type;
+  };
+
+  check("LENGTH", "[3,3,3,3,3,3]");
+  check("MIN", "[1,1,1,1,2,2]");
+  check("MAX", "[4,4,5,9,9,9]");
+  check("SUM", "[8,6,10,15,16,17]");
+}
+
+TEST(AggregatorTest, sliding_sum_handles_invalid_values_and_precision) {
+  auto input = velocypack::Parser::fromJson(R"([1e20, 1, "foo", 1])");
+  std::vector<AqlValue> values;
+  for (auto v : velocypack::ArrayIterator(input->slice())) {
+    values.emplace_back(AqlValueHintSliceNoCopy(v));
+  }
+
+  auto aggregator =
+      Aggregator::slidingFromTypeString(&velocypack::Options::Defaults, "SUM");
+  for (auto const& v : values) {
+    aggregator->reduce(v);
+  }
+  // the string makes the sum invalid
+  EXPECT_TRUE(aggregator->get().isNull(false));
+
+  aggregator->remove(values[0]);
+  aggregator->remove(values[1]);
+  EXPECT_TRUE(aggregator->get().isNull(false));
+
+  aggregator->remove(values[2]);
+  // no precision is lost by adding and removing the large value
+  EXPECT_EQ(1.0, aggregator->get().toDouble());
+}
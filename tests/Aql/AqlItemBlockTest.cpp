@@ -190,6 +190,37 @@ TEST_F(AqlItemBlockTest, test_emplace_values) {
   EXPECT_EQ(block->getValueReference(1, 1).toInt64(), 4);
 }
 
+TEST_F(AqlItemBlockTest, test_steal_or_clone_values) {
+  SharedAqlItemBlockPtr block{new AqlItemBlock(itemBlockManager, 2, 2)};
+  AqlValue a(dummyData(4));
+  ASSERT_TRUE(a.requiresDestruction());
+  // the same value is used in two registers of the first row
+  block->setValue(0, 0, a);
+  block->setValue(0, 1, a);
+  block->emplaceValue(1, 0, dummyData(5));
+  block->emplaceValue(1, 1, dummyData(0));
+
+  InputAqlItemRow input{block, 0};
+  AqlValue first = input.stealOrCloneValue(RegisterId(0));
+  AqlValueGuard firstGuard{first, true};
+  EXPECT_EQ(a.data(), first.data());
+
+  // the value was already taken over, so we must get a copy now
+  AqlValue second = input.stealOrCloneValue(RegisterId(1));
+  AqlValueGuard secondGuard{second, true};
+  EXPECT_NE(a.data(), second.data());
+  compareWithDummy(block, 0, 1, 4);
+  EXPECT_EQ(VelocyPackHelper::compare(second.slice(), dummyData(4), false),
+            0);
+
+  // values that are not stolen are still owned by the block
+  InputAqlItemRow other{block, 1};
+  AqlValue third = other.stealOrCloneValue(RegisterId(0));
+  AqlValueGuard thirdGuard{third, true};
+  compareWithDummy(block, 1, 0, 5);
+  EXPECT_FALSE(block->steal(third));
+}
+
 TEST_F(AqlItemBlockTest, test_block_contains_shadow_rows) {
   auto block = buildBlock<1>(itemBlockManager, {{{5}}, {{6}}, {{7}}, {{8}}});
 
@@ -22,13 +22,16 @@
 ////////////////////////////////////////////////////////////////////////////////
 
 #include "Aql/AstResources.h"
+#include "Aql/QueryArena.h"
 #include "Aql/ShortStringStorage.h"
 #include "Basics/GlobalResourceMonitor.h"
 #include "Basics/ResourceUsage.h"
 
 #include "gtest/gtest.h"
 
+#include <memory_resource>
 #include <string_view>
+#include <vector>
 
 namespace {
 
@@ -193,4 +196,84 @@ TEST(AstResourcesTest, testLongStringsFillAndClearMost) {
   EXPECT_EQ(capacity * overheadPerString, resourceMonitor.current());
 }
 
+TEST(QueryArenaTest, testEmpty) {
+  arangodb::GlobalResourceMonitor global;
+  arangodb::ResourceMonitor resourceMonitor(global);
+  arangodb::aql::QueryArena arena(resourceMonitor);
+
+  EXPECT_EQ(0, arena.usedBlocks());
+  EXPECT_EQ(0, arena.memoryUsage());
+  EXPECT_EQ(0, resourceMonitor.current());
+}
+
+TEST(QueryArenaTest, testAllocateAndRelease) {
+  arangodb::GlobalResourceMonitor global;
+  arangodb::ResourceMonitor resourceMonitor(global);
+  arangodb::aql::QueryArena arena(resourceMonitor);
+
+  std::pmr::vector<uint64_t> values(&arena);
+  for (uint64_t i = 0; i < 10000; ++i) {
+    values.push_back(i);
+    EXPECT_EQ(arena.memoryUsage(), resourceMonitor.current());
+  }
+  for (uint64_t i = 0; i < 10000; ++i) {
+    EXPECT_EQ(i, values[i]);
+  }
+  EXPECT_LT(1, arena.usedBlocks());
+  EXPECT_LE(10000 * sizeof(uint64_t), arena.memoryUsage());
+
+  // the vector must give its memory back first, otherwise it would
+  // point into released memory
+  values = std::pmr::vector<uint64_t>(&arena);
+  arena.releaseMost();
+  EXPECT_EQ(1, arena.usedBlocks());
+  EXPECT_EQ(arangodb::aql::QueryArena::kMinBlockSize, arena.memoryUsage());
+  EXPECT_EQ(arena.memoryUsage(), resourceMonitor.current());
+
+  arena.release();
+  EXPECT_EQ(0, arena.usedBlocks());
+  EXPECT_EQ(0, resourceMonitor.current());
+}
+
+TEST(QueryArenaTest, testAlignment) {
+  arangodb::GlobalResourceMonitor global;
+  arangodb::ResourceMonitor resourceMonitor(global);
+  arangodb::aql::QueryArena arena(resourceMonitor);
+
+  for (size_t alignment : {1, 2, 4, 8, 16, 64}) {
+    void* p = arena.allocate(3, alignment);
+    EXPECT_EQ(0, reinterpret_cast<uintptr_t>(p) % alignment);
+  }
+
+  // an oversized allocation gets a block of its own
+  constexpr size_t kSize = arangodb::aql::QueryArena::kMaxBlockSize * 2;
+  char* p = static_cast<char*>(arena.allocate(kSize, 8));
+  p[0] = 'a';
+  p[kSize - 1] = 'z';
+  EXPECT_EQ(2, arena.usedBlocks());
+  EXPECT_EQ(arena.memoryUsage(), resourceMonitor.current());
+}
+
+TEST(AstResourcesTest, testMembersUseArena) {
+  arangodb::GlobalResourceMonitor global;
+  arangodb::ResourceMonitor resourceMonitor(global);
+  arangodb::aql::AstResources resources(resourceMonitor);
+
+  auto* node =
+      resources.registerNode(arangodb::aql::NODE_TYPE_OPERATOR_NARY_AND);
+  EXPECT_EQ(0, resources.arena().memoryUsage());
+
+  resources.reserveChildNodes(node, 4);
+  for (size_t i = 0; i < 4; ++i) {
+    node->addMember(resources.registerNode(arangodb::aql::NODE_TYPE_VALUE));
+  }
+  EXPECT_EQ(4, node->numMembers());
+  EXPECT_EQ(arangodb::aql::QueryArena::kMinBlockSize,
+            resources.arena().memoryUsage());
+
+  resources.clear();
+  EXPECT_EQ(0, resources.arena().memoryUsage());
+  EXPECT_EQ(0, resourceMonitor.current());
+}
+
 }  // namespace
@@ -378,6 +378,195 @@ TEST_P(CalculationExecutorTest, DISABLED_v8condition_some_input) {
       .run(true);
 }
 
+TEST_P(CalculationExecutorTest, condition_numeric_comparison) {
+  AqlCall call{};
+  ExecutionStats stats{};
+
+  // a.value > 2. uses the numeric comparison shortcut for all inputs that
+  // contain a numeric "value" attribute, and the generic evaluation for all
+  // other inputs
+  Expression comparison(
+      &ast, ast.createNodeBinaryOperator(
+                AstNodeType::NODE_TYPE_OPERATOR_BINARY_GT,
+                ast.createNodeAttributeAccess(a, "value"),
+                ast.createNodeValueInt(2)));
+  std::vector<std::pair<VariableId, RegisterId>> varToRegs{
+      std::make_pair(var.id, inRegID)};
+
+  makeExecutorTestHelper<2, 2>()
+      .addConsumer<CalculationExecutor<CalculationType::Condition>>(
+          std::move(registerInfos),
+          CalculationExecutorInfos{outRegID, *fakedQuery.get(), comparison,
+                                   std::move(varToRegs)})
+      .setInputValue(MatrixBuilder<2>{
+          RowBuilder<2>{R"({"value":1})", NoneEntry{}},
+          RowBuilder<2>{R"({"value":2})", NoneEntry{}},
+          RowBuilder<2>{R"({"value":2.5})", NoneEntry{}},
+          RowBuilder<2>{R"({"value":-100})", NoneEntry{}},
+          RowBuilder<2>{R"({"value":12345678901})", NoneEntry{}},
+          RowBuilder<2>{R"({"value":"a"})", NoneEntry{}},
+          RowBuilder<2>{R"({"value":null})", NoneEntry{}},
+          RowBuilder<2>{R"({"other":3})", NoneEntry{}},
+          RowBuilder<2>{3, NoneEntry{}}})
+      .setInputSplitType(getSplit())
+      .setCall(call)
+      .expectOutput(
+          {0, 1},
+          MatrixBuilder<2>{RowBuilder<2>{R"({"value":1})", "false"},
+                           RowBuilder<2>{R"({"value":2})", "false"},
+                           RowBuilder<2>{R"({"value":2.5})", "true"},
+                           RowBuilder<2>{R"({"value":-100})", "false"},
+                           RowBuilder<2>{R"({"value":12345678901})", "true"},
+                           RowBuilder<2>{R"({"value":"a"})", "true"},
+                           RowBuilder<2>{R"({"value":null})", "false"},
+                           RowBuilder<2>{R"({"other":3})", "false"},
+                           RowBuilder<2>{3, "false"}})
+      .allowAnyOutputOrder(false)
+      .expectSkipped(0)
+      .expectedState(ExecutionState::DONE)
+      .run(true);
+}
+
+TEST_P(CalculationExecutorTest, condition_numeric_program) {
+  AqlCall call{};
+  ExecutionStats stats{};
+
+  // (a.x * 2 + -a.y) / a.z. evaluated via the compiled numeric program for
+  // all inputs with numeric attributes, and via the generic evaluation for
+  // all other inputs (type casts, division by zero)
+  Expression arithmetic(
+      &ast,
+      ast.createNodeBinaryOperator(
+          AstNodeType::NODE_TYPE_OPERATOR_BINARY_DIV,
+          ast.createNodeBinaryOperator(
+              AstNodeType::NODE_TYPE_OPERATOR_BINARY_PLUS,
+              ast.createNodeBinaryOperator(
+                  AstNodeType::NODE_TYPE_OPERATOR_BINARY_TIMES,
+                  ast.createNodeAttributeAccess(a, "x"),
+                  ast.createNodeValueInt(2)),
+              ast.createNodeUnaryOperator(
+                  AstNodeType::NODE_TYPE_OPERATOR_UNARY_MINUS,
+                  ast.createNodeAttributeAccess(a, "y"))),
+          ast.createNodeAttributeAccess(a, "z")));
+  std::vector<std::pair<VariableId, RegisterId>> varToRegs{
+      std::make_pair(var.id, inRegID)};
+
+  makeExecutorTestHelper<2, 2>()
+      .addConsumer<CalculationExecutor<CalculationType::Condition>>(
+          std::move(registerInfos),
+          CalculationExecutorInfos{outRegID, *fakedQuery.get(), arithmetic,
+                                   std::move(varToRegs)})
+      .setInputValue(MatrixBuilder<2>{
+          RowBuilder<2>{R"({"x":1,"y":1,"z":1})", NoneEntry{}},
+          RowBuilder<2>{R"({"x":3,"y":2,"z":2})", NoneEntry{}},
+          RowBuilder<2>{R"({"x":-1.5,"y":0.5,"z":0.5})", NoneEntry{}},
+          RowBuilder<2>{R"({"x":"4","y":2,"z":3})", NoneEntry{}},
+          RowBuilder<2>{R"({"x":null,"y":2,"z":2})", NoneEntry{}},
+          RowBuilder<2>{R"({"x":1,"y":1,"z":0})", NoneEntry{}},
+          RowBuilder<2>{3, NoneEntry{}}})
+      .setInputSplitType(getSplit())
+      .setCall(call)
+      .expectOutput({0, 1},
+                    MatrixBuilder<2>{
+                        RowBuilder<2>{R"({"x":1,"y":1,"z":1})", 1},
+                        RowBuilder<2>{R"({"x":3,"y":2,"z":2})", 2},
+                        RowBuilder<2>{R"({"x":-1.5,"y":0.5,"z":0.5})", -7},
+                        RowBuilder<2>{R"({"x":"4","y":2,"z":3})", 2},
+                        RowBuilder<2>{R"({"x":null,"y":2,"z":2})", -1},
+                        RowBuilder<2>{R"({"x":1,"y":1,"z":0})", "null"},
+                        RowBuilder<2>{3, "null"}})
+      .allowAnyOutputOrder(false)
+      .expectSkipped(0)
+      .expectedState(ExecutionState::DONE)
+      .run(true);
+}
+
+TEST_P(CalculationExecutorTest, condition_constant_in_lookup) {
+  AqlCall call{};
+  ExecutionStats stats{};
+
+  // a IN [0, 2, 4, ..., 78]. uses the hash-based lookup for numbers and
+  // ASCII strings, and the generic evaluation for all other inputs
+  AstNode* values = ast.createNodeArray();
+  for (int i = 0; i < 40; ++i) {
+    values->addMember(ast.createNodeValueInt(2 * i));
+  }
+  Expression in(&ast,
+                ast.createNodeBinaryOperator(
+                    AstNodeType::NODE_TYPE_OPERATOR_BINARY_IN, a, values));
+  std::vector<std::pair<VariableId, RegisterId>> varToRegs{
+      std::make_pair(var.id, inRegID)};
+
+  makeExecutorTestHelper<2, 2>()
+      .addConsumer<CalculationExecutor<CalculationType::Condition>>(
+          std::move(registerInfos),
+          CalculationExecutorInfos{outRegID, *fakedQuery.get(), in,
+                                   std::move(varToRegs)})
+      .setInputValue(MatrixBuilder<2>{
+          RowBuilder<2>{0, NoneEntry{}}, RowBuilder<2>{1, NoneEntry{}},
+          RowBuilder<2>{78, NoneEntry{}}, RowBuilder<2>{80, NoneEntry{}},
+          RowBuilder<2>{R"(4.0)", NoneEntry{}},
+          RowBuilder<2>{R"("4")", NoneEntry{}},
+          RowBuilder<2>{R"(null)", NoneEntry{}},
+          RowBuilder<2>{R"([4])", NoneEntry{}}})
+      .setInputSplitType(getSplit())
+      .setCall(call)
+      .expectOutput({0, 1}, MatrixBuilder<2>{RowBuilder<2>{0, "true"},
+                                             RowBuilder<2>{1, "false"},
+                                             RowBuilder<2>{78, "true"},
+                                             RowBuilder<2>{80, "false"},
+                                             RowBuilder<2>{R"(4.0)", "true"},
+                                             RowBuilder<2>{R"("4")", "false"},
+                                             RowBuilder<2>{R"(null)", "false"},
+                                             RowBuilder<2>{R"([4])", "false"}})
+      .allowAnyOutputOrder(false)
+      .expectSkipped(0)
+      .expectedState(ExecutionState::DONE)
+      .run(true);
+}
+
+TEST_P(CalculationExecutorTest, condition_batched_function_call) {
+  AqlCall call{};
+  ExecutionStats stats{};
+
+  // DATE_TRUNC(a, "day"). evaluated via the batched function implementation,
+  // which must produce the same results as calling the function per row
+  AstNode* args = ast.createNodeArray();
+  args->addMember(a);
+  args->addMember(ast.createNodeValueString("day", 3));
+  Expression trunc(&ast, ast.createNodeFunctionCall("DATE_TRUNC", args, false));
+  std::vector<std::pair<VariableId, RegisterId>> varToRegs{
+      std::make_pair(var.id, inRegID)};
+
+  makeExecutorTestHelper<2, 2>()
+      .addConsumer<CalculationExecutor<CalculationType::Condition>>(
+          std::move(registerInfos),
+          CalculationExecutorInfos{outRegID, *fakedQuery.get(), trunc,
+                                   std::move(varToRegs)})
+      .setInputValue(MatrixBuilder<2>{
+          RowBuilder<2>{R"("2023-05-17T13:45:12.345Z")", NoneEntry{}},
+          RowBuilder<2>{R"("2023-05-18T00:00:00.000Z")", NoneEntry{}},
+          RowBuilder<2>{0, NoneEntry{}},
+          RowBuilder<2>{R"("foo")", NoneEntry{}},
+          RowBuilder<2>{R"(null)", NoneEntry{}}})
+      .setInputSplitType(getSplit())
+      .setCall(call)
+      .expectOutput(
+          {0, 1},
+          MatrixBuilder<2>{
+              RowBuilder<2>{R"("2023-05-17T13:45:12.345Z")",
+                            R"("2023-05-17T00:00:00.000Z")"},
+              RowBuilder<2>{R"("2023-05-18T00:00:00.000Z")",
+                            R"("2023-05-18T00:00:00.000Z")"},
+              RowBuilder<2>{0, R"("1970-01-01T00:00:00.000Z")"},
+              RowBuilder<2>{R"("foo")", "null"},
+              RowBuilder<2>{R"(null)", "null"}})
+      .allowAnyOutputOrder(false)
+      .expectSkipped(0)
+      .expectedState(ExecutionState::DONE)
+      .run(true);
+}
+
 }  // namespace aql
 }  // namespace tests
 }  // namespace arangodb
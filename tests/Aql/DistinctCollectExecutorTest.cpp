@@ -40,6 +40,7 @@
 #include "Basics/ResourceUsage.h"
 #include "ExecutorTestHelper.h"
 #include "Mocks/Servers.h"
+#include "RestServer/TemporaryStorageFeature.h"
 #include "Transaction/Context.h"
 #include "Transaction/Methods.h"
 
@@ -72,14 +73,19 @@ class DistinctCollectExecutorTest : public AqlExecutorTestCaseWithParam<
   NoStats stats;
 
   RegisterInfos registerInfos;
+  std::unique_ptr<TemporaryStorageFeature> tempStorage;
   DistinctCollectExecutorInfos executorInfos;
 
   DistinctCollectExecutorTest()
       : registerInfos(std::move(readableInputRegisters),
                       std::move(writeableOutputRegisters), 1, 2, RegIdFlatSet{},
                       RegIdFlatSetStack{{}}),
+        tempStorage(std::make_unique<TemporaryStorageFeature>(
+            fakedQuery->vocbase().server())),
         executorInfos(std::make_pair<RegisterId, RegisterId>(1, 0),
-                      &VPackOptions::Defaults, monitor) {}
+                      &VPackOptions::Defaults, monitor, *tempStorage,
+                      /*spillOverThresholdNumRows*/ 1000,
+                      /*spillOverThresholdMemoryUsage*/ 1024 * 1024) {}
 };
 
 TEST_P(DistinctCollectExecutorTest, split_1) {
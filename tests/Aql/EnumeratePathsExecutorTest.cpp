@@ -489,6 +489,153 @@ INSTANTIATE_TEST_CASE_P(KShortestPathExecutorInputTestInstance,
 INSTANTIATE_TEST_CASE_P(KShortestPathExecutorPathsTestInstance,
                         EnumeratePathsExecutorPathsTest,
                         testing::Combine(inputs, paths, calls, blockSizes));
+
+// The FakePairPathsFinder produces a fixed number of paths for every pair of
+// source and target it is reset with. Every path consists of the source, an
+// intermediate vertex with the index of the path, and the target.
+class FakePairPathsFinder {
+  using VertexRef = arangodb::velocypack::HashedStringRef;
+
+ public:
+  explicit FakePairPathsFinder(size_t numPaths)
+      : _numPaths(numPaths), _produced(numPaths), _numResets(0) {}
+
+  bool isDone() const { return _produced == _numPaths; }
+
+  void clear() {}
+  void destroyEngines() {}
+  void reset(VertexRef source, VertexRef target, size_t depth = 0) {
+    _source = source.toString();
+    _target = target.toString();
+    _produced = 0;
+    ++_numResets;
+  }
+
+  bool getNextPath(arangodb::velocypack::Builder& result) {
+    if (isDone()) {
+      return false;
+    }
+    result.openArray();
+    result.add(VPackValue(_source));
+    result.add(VPackValue("vertex/intermed" + std::to_string(_produced)));
+    result.add(VPackValue(_target));
+    result.close();
+    ++_produced;
+    return true;
+  }
+
+  bool skipPath() {
+    Builder builder{};
+    return getNextPath(builder);
+  }
+
+  aql::TraversalStats stealStats() { return {}; }
+
+  size_t numResets() const noexcept { return _numResets; }
+
+ private:
+  size_t _numPaths;
+  size_t _produced;
+  size_t _numResets;
+  std::string _source;
+  std::string _target;
+};
+
+class EnumeratePathsExecutorParallelTest : public ::testing::Test {
+ protected:
+  static constexpr size_t numPaths = 3;
+
+  MockAqlServer server{};
+  arangodb::GlobalResourceMonitor global{};
+  arangodb::ResourceMonitor monitor{global};
+  AqlItemBlockManager itemBlockManager{monitor};
+  std::shared_ptr<arangodb::aql::Query> fakedQuery{server.createFakeQuery()};
+  RegisterInfos registerInfos{RegIdSet{0, 1}, RegIdSet{2}, 2, 3,
+                              RegIdFlatSet{}, RegIdFlatSetStack{{}}};
+  EnumeratePathsExecutorInfos<FakePairPathsFinder> executorInfos{
+      RegisterId{2},
+      *fakedQuery,
+      std::make_unique<FakePairPathsFinder>(numPaths),
+      Vertex{regSource},
+      Vertex{regTarget},
+      makeWorkers(2)};
+  SharedAqlItemBlockPtr inputBlock{
+      buildBlock<2>(itemBlockManager, MatrixBuilder<2>(someRows))};
+  AqlItemBlockInputRange input{MainQueryState::DONE, 0, inputBlock, 0};
+  std::shared_ptr<Builder> fakeUnusedBlock{VPackParser::fromJson("[]")};
+  SingleRowFetcherHelper<::arangodb::aql::BlockPassthrough::Disable> fetcher{
+      itemBlockManager, fakeUnusedBlock->steal(), false};
+  EnumeratePathsExecutor<FakePairPathsFinder> testee{fetcher, executorInfos};
+
+  // the sources of the input rows, in input order
+  std::vector<std::string> const sources{"vertex/c", "vertex/b", "vertex/e",
+                                         "vertex/a"};
+
+  static std::vector<EnumeratePathsExecutorInfos<FakePairPathsFinder>::Worker>
+  makeWorkers(size_t n) {
+    std::vector<EnumeratePathsExecutorInfos<FakePairPathsFinder>::Worker>
+        workers;
+    for (size_t i = 0; i < n; ++i) {
+      workers.push_back(
+          {nullptr, std::make_unique<FakePairPathsFinder>(numPaths)});
+    }
+    return workers;
+  }
+
+  SharedAqlItemBlockPtr produceAll() {
+    OutputAqlItemRow output(itemBlockManager.requestBlock(1000, 3),
+                            registerInfos.getOutputRegisters(),
+                            registerInfos.registersToKeep(),
+                            registerInfos.registersToClear());
+    auto state = ExecutorState{ExecutorState::HASMORE};
+    std::tie(state, std::ignore, std::ignore) =
+        testee.produceRows(input, output);
+    EXPECT_EQ(ExecutorState::DONE, state);
+    return output.stealBlock();
+  }
+
+  void validatePath(SharedAqlItemBlockPtr const& block, size_t row,
+                    size_t expected) {
+    AqlValue value = block->getValue(row, RegisterId{2});
+    ASSERT_TRUE(value.isArray());
+    EXPECT_EQ(sources[expected / numPaths],
+              value.slice().at(0).copyString());
+    EXPECT_EQ("vertex/intermed" + std::to_string(expected % numPaths),
+              value.slice().at(1).copyString());
+  }
+};
+
+TEST_F(EnumeratePathsExecutorParallelTest, paths_are_produced_in_input_order) {
+  auto block = produceAll();
+  ASSERT_NE(nullptr, block);
+  ASSERT_EQ(sources.size() * numPaths, block->numRows());
+  for (size_t row = 0; row < block->numRows(); ++row) {
+    validatePath(block, row, row);
+  }
+  // the first three input rows are distributed over the three finders, the
+  // last one is handled by the first finder again
+  EXPECT_EQ(2, executorInfos.finder().numResets());
+  for (auto const& worker : executorInfos.workers()) {
+    EXPECT_EQ(1, worker.finder->numResets());
+  }
+}
+
+TEST_F(EnumeratePathsExecutorParallelTest, skipping_keeps_input_order) {
+  AqlCall call{numPaths + 1};
+  auto state = ExecutorState{ExecutorState::DONE};
+  auto skipped = size_t{0};
+  std::tie(state, std::ignore, skipped, std::ignore) =
+      testee.skipRowsRange(input, call);
+  EXPECT_EQ(ExecutorState::HASMORE, state);
+  EXPECT_EQ(numPaths + 1, skipped);
+
+  auto block = produceAll();
+  ASSERT_NE(nullptr, block);
+  ASSERT_EQ(sources.size() * numPaths - skipped, block->numRows());
+  for (size_t row = 0; row < block->numRows(); ++row) {
+    validatePath(block, row, row + skipped);
+  }
+}
 }  // namespace
 
 }  // namespace aql
@@ -0,0 +1,114 @@
+////////////////////////////////////////////////////////////////////////////////
+/// DISCLAIMER
+///
+/// Copyright 2014-2023 ArangoDB GmbH, Cologne, Germany
+/// Copyright 2004-2014 triAGENS GmbH, Cologne, Germany
+///
+/// Licensed under the Apache License, Version 2.0 (the "License");
+/// you may not use this file except in compliance with the License.
+/// You may obtain a copy of the License at
+///
+///     http://www.apache.org/licenses/LICENSE-2.0
+///
+/// Unless required by applicable law or agreed to in writing, software
+/// distributed under the License is distributed on an "AS IS" BASIS,
+/// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+/// See the License for the specific language governing permissions and
+/// limitations under the License.
+///
+/// Copyright holder is ArangoDB GmbH, Cologne, Germany
+///
+/// @author Jan Steemann
+////////////////////////////////////////////////////////////////////////////////
+
+#include "gtest/gtest.h"
+
+#include "Aql/HyperLogLog.h"
+
+#include <velocypack/Builder.h>
+#include <velocypack/Parser.h>
+
+#include <cstdint>
+
+using namespace arangodb;
+using namespace arangodb::aql;
+
+namespace {
+
+uint64_t hashValue(int64_t value) {
+  velocypack::Builder b;
+  b.add(velocypack::Value(value));
+  return b.slice().normalizedHash();
+}
+
+void expectNear(uint64_t expected, uint64_t actual) {
+  // 5% is more than 3 times the standard error of the estimate
+  EXPECT_LE(static_cast<double>(expected) * 0.95, static_cast<double>(actual));
+  EXPECT_GE(static_cast<double>(expected) * 1.05, static_cast<double>(actual));
+}
+
+}  // namespace
+
+TEST(HyperLogLogTest, small_sets_are_counted_exactly) {
+  HyperLogLog sketch;
+  EXPECT_EQ(0, sketch.estimate());
+
+  for (int64_t i = 0; i < 100; ++i) {
+    sketch.add(hashValue(i));
+    sketch.add(hashValue(i));
+  }
+  EXPECT_FALSE(sketch.isDense());
+  EXPECT_EQ(100, sketch.estimate());
+
+  sketch.clear();
+  EXPECT_EQ(0, sketch.estimate());
+}
+
+TEST(HyperLogLogTest, large_sets_are_estimated) {
+  for (int64_t n : {1000, 10000, 1000000}) {
+    HyperLogLog sketch;
+    for (int64_t i = 0; i < n; ++i) {
+      sketch.add(hashValue(i));
+    }
+    EXPECT_TRUE(sketch.isDense());
+    expectNear(n, sketch.estimate());
+  }
+}
+
+TEST(HyperLogLogTest, merge_serialized_sketches) {
+  HyperLogLog sparse;
+  HyperLogLog dense;
+  for (int64_t i = 0; i < 50000; ++i) {
+    dense.add(hashValue(i));
+  }
+  // overlaps with the values in the dense sketch
+  for (int64_t i = 49990; i < 50010; ++i) {
+    sparse.add(hashValue(i));
+  }
+
+  velocypack::Builder sparseBuilder;
+  sparse.toVelocyPack(sparseBuilder);
+  EXPECT_TRUE(sparseBuilder.slice().isArray());
+  velocypack::Builder denseBuilder;
+  dense.toVelocyPack(denseBuilder);
+  EXPECT_TRUE(denseBuilder.slice().isString());
+
+  HyperLogLog merged;
+  ASSERT_TRUE(merged.mergeVelocyPack(sparseBuilder.slice()));
+  EXPECT_EQ(20, merged.estimate());
+  ASSERT_TRUE(merged.mergeVelocyPack(denseBuilder.slice()));
+  expectNear(50010, merged.estimate());
+
+  // merging in memory produces the same result
+  dense.merge(sparse);
+  EXPECT_EQ(dense.estimate(), merged.estimate());
+}
+
+TEST(HyperLogLogTest, invalid_serialized_sketches_are_rejected) {
+  HyperLogLog sketch;
+  for (auto json : {R"(null)", R"(1)", R"(["a"])", R"([-1])", R"("abc")"}) {
+    auto input = velocypack::Parser::fromJson(json);
+    EXPECT_FALSE(sketch.mergeVelocyPack(input->slice()));
+  }
+  EXPECT_EQ(0, sketch.estimate());
+}
@@ -0,0 +1,84 @@
+////////////////////////////////////////////////////////////////////////////////
+/// DISCLAIMER
+///
+/// Copyright 2014-2023 ArangoDB GmbH, Cologne, Germany
+/// Copyright 2004-2014 triAGENS GmbH, Cologne, Germany
+///
+/// Licensed under the Apache License, Version 2.0 (the "License");
+/// you may not use this file except in compliance with the License.
+/// You may obtain a copy of the License at
+///
+///     http://www.apache.org/licenses/LICENSE-2.0
+///
+/// Unless required by applicable law or agreed to in writing, software
+/// distributed under the License is distributed on an "AS IS" BASIS,
+/// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+/// See the License for the specific language governing permissions and
+/// limitations under the License.
+///
+/// Copyright holder is ArangoDB GmbH, Cologne, Germany
+///
+/// @author Jan Steemann
+////////////////////////////////////////////////////////////////////////////////
+
+#include "gtest/gtest.h"
+
+#include "Aql/PreparedQueryRegistry.h"
+
+using namespace arangodb;
+using namespace arangodb::aql;
+
+TEST(PreparedQueryRegistryTest, insert_and_lookup) {
+  PreparedQueryRegistry registry(10);
+  auto id = registry.insert("testDB", "user", "RETURN @value");
+  ASSERT_TRUE(id.ok());
+  EXPECT_EQ(1, registry.size());
+
+  auto entry = registry.lookup(id.get(), "testDB", "user");
+  ASSERT_NE(nullptr, entry);
+  EXPECT_EQ("testDB", entry->databaseName);
+  EXPECT_EQ("user", entry->user);
+  EXPECT_EQ("RETURN @value", entry->queryString);
+
+  // prepared queries are bound to their database and user
+  EXPECT_EQ(nullptr, registry.lookup(id.get(), "otherDB", "user"));
+  EXPECT_EQ(nullptr, registry.lookup(id.get(), "testDB", "other"));
+  EXPECT_EQ(nullptr, registry.lookup(id.get() + 1, "testDB", "user"));
+}
+
+TEST(PreparedQueryRegistryTest, remove) {
+  PreparedQueryRegistry registry(10);
+  auto id = registry.insert("testDB", "user", "RETURN 1");
+  ASSERT_TRUE(id.ok());
+
+  EXPECT_FALSE(registry.remove(id.get(), "testDB", "other"));
+  EXPECT_TRUE(registry.remove(id.get(), "testDB", "user"));
+  EXPECT_FALSE(registry.remove(id.get(), "testDB", "user"));
+  EXPECT_EQ(nullptr, registry.lookup(id.get(), "testDB", "user"));
+  EXPECT_EQ(0, registry.size());
+}
+
+TEST(PreparedQueryRegistryTest, invalidate) {
+  PreparedQueryRegistry registry(10);
+  auto id1 = registry.insert("db1", "user", "RETURN 1");
+  auto id2 = registry.insert("db2", "user", "RETURN 1");
+  ASSERT_TRUE(id1.ok());
+  ASSERT_TRUE(id2.ok());
+  EXPECT_NE(id1.get(), id2.get());
+
+  registry.invalidate("db1");
+  EXPECT_EQ(1, registry.size());
+  EXPECT_EQ(nullptr, registry.lookup(id1.get(), "db1", "user"));
+  EXPECT_NE(nullptr, registry.lookup(id2.get(), "db2", "user"));
+}
+
+TEST(PreparedQueryRegistryTest, limit_is_enforced) {
+  PreparedQueryRegistry registry(2);
+  EXPECT_TRUE(registry.insert("testDB", "user", "RETURN 1").ok());
+  EXPECT_TRUE(registry.insert("testDB", "user", "RETURN 2").ok());
+
+  auto id = registry.insert("testDB", "user", "RETURN 3");
+  ASSERT_TRUE(id.fail());
+  EXPECT_EQ(TRI_ERROR_RESOURCE_LIMIT, id.errorNumber());
+  EXPECT_EQ(2, registry.size());
+}
@@ -0,0 +1,137 @@
+////////////////////////////////////////////////////////////////////////////////
+/// DISCLAIMER
+///
+/// Copyright 2014-2023 ArangoDB GmbH, Cologne, Germany
+/// Copyright 2004-2014 triAGENS GmbH, Cologne, Germany
+///
+/// Licensed under the Apache License, Version 2.0 (the "License");
+/// you may not use this file except in compliance with the License.
+/// You may obtain a copy of the License at
+///
+///     http://www.apache.org/licenses/LICENSE-2.0
+///
+/// Unless required by applicable law or agreed to in writing, software
+/// distributed under the License is distributed on an "AS IS" BASIS,
+/// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+/// See the License for the specific language governing permissions and
+/// limitations under the License.
+///
+/// Copyright holder is ArangoDB GmbH, Cologne, Germany
+///
+/// @author Jan Steemann
+////////////////////////////////////////////////////////////////////////////////
+
+#include "gtest/gtest.h"
+
+#include "Aql/QueryCache.h"
+#include "Aql/QueryString.h"
+
+#include <velocypack/Builder.h>
+#include <velocypack/Parser.h>
+
+using namespace arangodb;
+using namespace arangodb::aql;
+
+namespace {
+
+std::shared_ptr<QueryCacheResultEntry> makeEntry(uint64_t hash,
+                                                 QueryString const& query,
+                                                 double maxStaleness) {
+  auto entry = std::make_shared<QueryCacheResultEntry>(
+      hash, query, velocypack::Parser::fromJson("[1,2,3]"), nullptr,
+      std::unordered_map<std::string, std::string>{{"guid1", "test"}});
+  entry->_maxStaleness = maxStaleness;
+  return entry;
+}
+
+}  // namespace
+
+TEST(QueryCacheTest, data_modifications_remove_entries_by_default) {
+  QueryCacheDatabaseEntry cache;
+  QueryString query(std::string_view{"FOR doc IN test RETURN doc"});
+
+  cache.store(makeEntry(1, query, 0.0), 128, 1024 * 1024);
+  EXPECT_NE(nullptr, cache.lookup(1, query, nullptr, 0.0));
+
+  cache.invalidate("guid1", /*keepStaleEntries*/ true);
+  EXPECT_EQ(nullptr, cache.lookup(1, query, nullptr, 60.0));
+  EXPECT_EQ(0, cache._numResults);
+}
+
+TEST(QueryCacheTest, stale_entries_are_returned_within_tolerance) {
+  QueryCacheDatabaseEntry cache;
+  QueryString query(std::string_view{"FOR doc IN test RETURN doc"});
+
+  cache.store(makeEntry(1, query, 60.0), 128, 1024 * 1024);
+  auto entry = cache.lookup(1, query, nullptr, 0.0);
+  ASSERT_NE(nullptr, entry);
+  EXPECT_FALSE(entry->isStale());
+
+  cache.invalidate("guid1", /*keepStaleEntries*/ true);
+  // queries without a staleness tolerance must not see the entry anymore
+  EXPECT_EQ(nullptr, cache.lookup(1, query, nullptr, 0.0));
+  entry = cache.lookup(1, query, nullptr, 60.0);
+  ASSERT_NE(nullptr, entry);
+  EXPECT_TRUE(entry->isStale());
+
+  // DDL operations remove stale entries, too
+  cache.invalidate("guid1", /*keepStaleEntries*/ false);
+  EXPECT_EQ(nullptr, cache.lookup(1, query, nullptr, 60.0));
+  EXPECT_EQ(0, cache._numResults);
+}
+
+TEST(QueryCacheTest, storing_a_fresh_result_replaces_a_stale_entry) {
+  QueryCacheDatabaseEntry cache;
+  QueryString query(std::string_view{"FOR doc IN test RETURN doc"});
+
+  cache.store(makeEntry(1, query, 60.0), 128, 1024 * 1024);
+  cache.invalidate("guid1", /*keepStaleEntries*/ true);
+  cache.store(makeEntry(1, query, 60.0), 128, 1024 * 1024);
+
+  auto entry = cache.lookup(1, query, nullptr, 0.0);
+  ASSERT_NE(nullptr, entry);
+  EXPECT_FALSE(entry->isStale());
+  EXPECT_EQ(1, cache._numResults);
+}
+
+TEST(QueryCacheTest, eviction_prefers_cheap_entries) {
+  QueryCacheDatabaseEntry cache;
+  QueryString query1(std::string_view{"FOR doc IN test RETURN doc"});
+  QueryString query2(std::string_view{"FOR doc IN test RETURN doc._key"});
+  QueryString query3(std::string_view{"FOR doc IN test RETURN doc.value"});
+
+  auto makeCostedEntry = [](uint64_t hash, QueryString const& query,
+                            double executionTime) {
+    auto entry = makeEntry(hash, query, 0.0);
+    entry->_stats = velocypack::Parser::fromJson(
+        "{\"stats\":{\"executionTime\":" + std::to_string(executionTime) +
+        "}}");
+    return entry;
+  };
+
+  // the oldest entry is expensive to compute, the second one is cheap
+  cache.store(makeCostedEntry(1, query1, 10.0), 2, 1024 * 1024);
+  cache.store(makeCostedEntry(2, query2, 0.001), 2, 1024 * 1024);
+  cache.store(makeCostedEntry(3, query3, 1.0), 2, 1024 * 1024);
+
+  EXPECT_EQ(2, cache._numResults);
+  EXPECT_NE(nullptr, cache.lookup(1, query1, nullptr, 0.0));
+  EXPECT_EQ(nullptr, cache.lookup(2, query2, nullptr, 0.0));
+  EXPECT_NE(nullptr, cache.lookup(3, query3, nullptr, 0.0));
+}
+
+TEST(QueryCacheTest, eviction_is_fifo_for_equal_benefits) {
+  QueryCacheDatabaseEntry cache;
+  QueryString query1(std::string_view{"FOR doc IN test RETURN doc"});
+  QueryString query2(std::string_view{"FOR doc IN test RETURN doc._key"});
+  QueryString query3(std::string_view{"FOR doc IN test RETURN doc.value"});
+
+  cache.store(makeEntry(1, query1, 0.0), 2, 1024 * 1024);
+  cache.store(makeEntry(2, query2, 0.0), 2, 1024 * 1024);
+  cache.store(makeEntry(3, query3, 0.0), 2, 1024 * 1024);
+
+  EXPECT_EQ(2, cache._numResults);
+  EXPECT_EQ(nullptr, cache.lookup(1, query1, nullptr, 0.0));
+  EXPECT_NE(nullptr, cache.lookup(2, query2, nullptr, 0.0));
+  EXPECT_NE(nullptr, cache.lookup(3, query3, nullptr, 0.0));
+}
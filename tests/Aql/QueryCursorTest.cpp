@@ -93,6 +93,47 @@ TEST_F(QueryCursorTest, resultCursorResultArrayIndexSingleBatch) {
   ASSERT_EQ(0x13, resultSlice.head());
 }
 
+TEST_F(QueryCursorTest, resultCursorSingleBatchContents) {
+  auto& vocbase = server->getSystemDatabase();
+  auto fakeRequest = std::make_unique<GeneralRequestMock>(vocbase);
+  auto fakeResponse = std::make_unique<GeneralResponseMock>();
+  fakeRequest->setRequestType(arangodb::rest::RequestType::POST);
+  fakeRequest->_payload.add(R"json(
+    {
+      "query": "FOR i IN 1..3 RETURN {_key: CONCAT('k', i), value: i}",
+      "count": true
+    }
+  )json"_vpack);
+
+  auto* registry = arangodb::QueryRegistryFeature::registry();
+
+  auto testee = std::make_shared<arangodb::RestCursorHandler>(
+      server->server(), fakeRequest.release(), fakeResponse.release(),
+      registry);
+
+  testee->execute();
+
+  fakeResponse.reset(
+      dynamic_cast<GeneralResponseMock*>(testee->stealResponse().release()));
+
+  auto const responseBodySlice = fakeResponse->_payload.slice();
+
+  ASSERT_TRUE(responseBodySlice.isObject());
+  EXPECT_FALSE(responseBodySlice.get("hasMore").getBool());
+  EXPECT_EQ(3, responseBodySlice.get("count").getNumber<int>());
+  EXPECT_TRUE(responseBodySlice.get("id").isNone());
+
+  auto resultSlice = responseBodySlice.get("result").resolveExternal();
+  ASSERT_TRUE(resultSlice.isArray());
+  ASSERT_EQ(3, resultSlice.length());
+  for (int i = 0; i < 3; ++i) {
+    auto doc = resultSlice.at(i).resolveExternal();
+    ASSERT_TRUE(doc.isObject());
+    EXPECT_EQ("k" + std::to_string(i + 1), doc.get("_key").copyString());
+    EXPECT_EQ(i + 1, doc.get("value").getNumber<int>());
+  }
+}
+
 TEST_F(QueryCursorTest, resultCursorResultArrayIndexTwoBatches) {
   auto& vocbase = server->getSystemDatabase();
   auto fakeRequest = std::make_unique<GeneralRequestMock>(vocbase);
@@ -217,3 +258,119 @@ TEST_F(QueryCursorTest, streamingCursorResultArrayIndexTwoBatches) {
   // should be a compact array
   ASSERT_EQ(0x13, resultSlice.head());
 }
+
+TEST_F(QueryCursorTest, streamingCursorBatchMemoryLimit) {
+  auto& vocbase = server->getSystemDatabase();
+  auto fakeRequest = std::make_unique<GeneralRequestMock>(vocbase);
+  auto fakeResponse = std::make_unique<GeneralResponseMock>();
+  fakeRequest->setRequestType(arangodb::rest::RequestType::POST);
+  fakeRequest->_payload.add(R"json(
+    {
+      "query": "FOR i IN 1..100 RETURN CONCAT('', i)",
+      "batchSize": 1000,
+      "options": { "stream": true, "batchMemoryLimit": 1 }
+    }
+  )json"_vpack);
+
+  auto* registry = arangodb::QueryRegistryFeature::registry();
+
+  auto testee = std::make_shared<arangodb::RestCursorHandler>(
+      server->server(), fakeRequest.release(), fakeResponse.release(),
+      registry);
+
+  testee->execute();
+
+  fakeResponse.reset(
+      dynamic_cast<GeneralResponseMock*>(testee->stealResponse().release()));
+  // this is necessary to reset the wakeup handler, which otherwise holds a
+  // shared_ptr to testee.
+  testee->shutdownExecute(true);
+
+  auto const responseBodySlice = fakeResponse->_payload.slice();
+
+  {  // release the query, so the AQL feature doesn't wait on it during shutdown
+    auto const idSlice = responseBodySlice.get("id");
+    ASSERT_FALSE(idSlice.isNone());
+    ASSERT_TRUE(idSlice.isString());
+    auto fakeRequest = std::make_unique<GeneralRequestMock>(vocbase);
+    fakeRequest->setRequestType(arangodb::rest::RequestType::DELETE_REQ);
+    fakeRequest->addSuffix(idSlice.copyString());
+    auto fakeResponse = std::make_unique<GeneralResponseMock>();
+    auto restHandler = std::make_shared<arangodb::RestCursorHandler>(
+        server->server(), fakeRequest.release(), fakeResponse.release(),
+        registry);
+    restHandler->execute();
+    fakeResponse.reset(
+        dynamic_cast<GeneralResponseMock*>(testee->stealResponse().release()));
+  }
+
+  testee.reset();
+
+  ASSERT_TRUE(responseBodySlice.isObject());
+
+  // the batch is cut off after the first row because of the memory limit
+  auto const resultSlice = responseBodySlice.get("result").resolveExternal();
+  ASSERT_TRUE(resultSlice.isArray());
+  ASSERT_EQ(1, resultSlice.length());
+  ASSERT_TRUE(responseBodySlice.get("hasMore").isTrue());
+}
+
+TEST_F(QueryCursorTest, streamingCursorPrefetchNextBatch) {
+  auto& vocbase = server->getSystemDatabase();
+  auto* registry = arangodb::QueryRegistryFeature::registry();
+
+  auto runRequest = [&](arangodb::rest::RequestType type,
+                        std::string const& suffix,
+                        VPackSlice body) {
+    auto fakeRequest = std::make_unique<GeneralRequestMock>(vocbase);
+    auto fakeResponse = std::make_unique<GeneralResponseMock>();
+    fakeRequest->setRequestType(type);
+    if (!suffix.empty()) {
+      fakeRequest->addSuffix(suffix);
+    }
+    if (!body.isNone()) {
+      fakeRequest->_payload.add(body);
+    }
+    auto testee = std::make_shared<arangodb::RestCursorHandler>(
+        server->server(), fakeRequest.release(), fakeResponse.release(),
+        registry);
+    testee->execute();
+    fakeResponse.reset(
+        dynamic_cast<GeneralResponseMock*>(testee->stealResponse().release()));
+    // this returns the cursor to the repository and starts prefetching
+    testee->shutdownExecute(true);
+    VPackBuilder result;
+    result.add(fakeResponse->_payload.slice());
+    return result;
+  };
+
+  auto response = runRequest(arangodb::rest::RequestType::POST, "", R"json(
+    {
+      "query": "FOR i IN 1..25 RETURN i",
+      "batchSize": 10,
+      "options": { "stream": true, "prefetchNextBatch": true }
+    }
+  )json"_vpack.slice());
+
+  std::vector<int64_t> values;
+  auto const id = response.slice().get("id").copyString();
+  while (true) {
+    auto body = response.slice();
+    ASSERT_TRUE(body.isObject());
+    ASSERT_TRUE(body.get("error").isFalse()) << body.toJson();
+    for (auto v : VPackArrayIterator(body.get("result").resolveExternal())) {
+      values.push_back(v.getNumber<int64_t>());
+    }
+    if (!body.get("hasMore").isTrue()) {
+      break;
+    }
+    ASSERT_EQ(id, body.get("id").copyString());
+    response = runRequest(arangodb::rest::RequestType::PUT, id,
+                          VPackSlice::noneSlice());
+  }
+
+  ASSERT_EQ(25, values.size());
+  for (size_t i = 0; i < values.size(); ++i) {
+    EXPECT_EQ(static_cast<int64_t>(i + 1), values[i]);
+  }
+}
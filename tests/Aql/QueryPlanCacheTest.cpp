@@ -0,0 +1,205 @@
+////////////////////////////////////////////////////////////////////////////////
+/// DISCLAIMER
+///
+/// Copyright 2014-2023 ArangoDB GmbH, Cologne, Germany
+/// Copyright 2004-2014 triAGENS GmbH, Cologne, Germany
+///
+/// Licensed under the Apache License, Version 2.0 (the "License");
+/// you may not use this file except in compliance with the License.
+/// You may obtain a copy of the License at
+///
+///     http://www.apache.org/licenses/LICENSE-2.0
+///
+/// Unless required by applicable law or agreed to in writing, software
+/// distributed under the License is distributed on an "AS IS" BASIS,
+/// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+/// See the License for the specific language governing permissions and
+/// limitations under the License.
+///
+/// Copyright holder is ArangoDB GmbH, Cologne, Germany
+///
+/// @author Jan Steemann
+////////////////////////////////////////////////////////////////////////////////
+
+#include "gtest/gtest.h"
+
+#include "Aql/QueryOptions.h"
+#include "Aql/QueryPlanCache.h"
+#include "Aql/QueryString.h"
+
+#include <velocypack/Builder.h>
+#include <velocypack/Parser.h>
+
+using namespace arangodb;
+using namespace arangodb::aql;
+
+namespace {
+
+std::shared_ptr<QueryPlanCache::Value const> makeValue(
+    uint64_t ddlVersion, std::string_view structuralParameters = "{}") {
+  auto value = std::make_shared<QueryPlanCache::Value>();
+  value->plan.openObject();
+  value->plan.add("nodes", VPackValue(VPackValueType::Array));
+  value->plan.close();
+  value->plan.close();
+  value->structuralParameters.add(
+      velocypack::Parser::fromJson(structuralParameters.data(),
+                                   structuralParameters.size())
+          ->slice());
+  value->ddlVersion = ddlVersion;
+  value->containsModificationNode = false;
+  value->containsParallelNode = false;
+  value->containsUpsertNode = false;
+  value->isResultCacheable = true;
+  return value;
+}
+
+QueryPlanCache::Key makeKey(std::string_view query,
+                            velocypack::Slice bindParameters,
+                            std::string databaseName = "testDB",
+                            QueryOptions const& options = {}) {
+  return QueryPlanCache::Key(std::move(databaseName), QueryString(query),
+                             bindParameters, options);
+}
+
+}  // namespace
+
+TEST(QueryPlanCacheTest, keys_depend_on_bind_parameter_types_only) {
+  auto query = "FOR doc IN test FILTER doc.value == @value RETURN doc";
+  auto bind1 = velocypack::Parser::fromJson(R"({"value":1})");
+  auto bind2 = velocypack::Parser::fromJson(R"({"value":42.5})");
+  auto bind3 = velocypack::Parser::fromJson(R"({"value":"foo"})");
+
+  auto key1 = makeKey(query, bind1->slice());
+  auto key2 = makeKey(query, bind2->slice());
+  auto key3 = makeKey(query, bind3->slice());
+
+  EXPECT_TRUE(key1 == key2);
+  EXPECT_EQ(key1.hash, key2.hash);
+  EXPECT_FALSE(key1 == key3);
+}
+
+TEST(QueryPlanCacheTest, keys_do_not_depend_on_bind_parameter_order) {
+  auto query = "FOR doc IN @@c FILTER doc.value == @value RETURN doc";
+  auto bind1 = velocypack::Parser::fromJson(R"({"@c":"test","value":1})");
+  auto bind2 = velocypack::Parser::fromJson(R"({"value":2,"@c":"test"})");
+
+  EXPECT_TRUE(makeKey(query, bind1->slice()) ==
+              makeKey(query, bind2->slice()));
+}
+
+TEST(QueryPlanCacheTest, keys_depend_on_database_and_options) {
+  auto query = "FOR doc IN test RETURN doc";
+  auto bind = velocypack::Parser::fromJson("{}");
+
+  EXPECT_FALSE(makeKey(query, bind->slice(), "db1") ==
+               makeKey(query, bind->slice(), "db2"));
+
+  QueryOptions options;
+  options.fullCount = true;
+  EXPECT_FALSE(makeKey(query, bind->slice()) ==
+               makeKey(query, bind->slice(), "testDB", options));
+
+  options.fullCount = false;
+  options.optimizerRules.emplace_back("-all");
+  EXPECT_FALSE(makeKey(query, bind->slice()) ==
+               makeKey(query, bind->slice(), "testDB", options));
+}
+
+TEST(QueryPlanCacheTest, store_and_lookup) {
+  QueryPlanCache cache(10, 1024 * 1024);
+  auto query = "FOR doc IN test FILTER doc.value == @value RETURN doc";
+  auto bind = velocypack::Parser::fromJson(R"({"value":1})");
+
+  EXPECT_EQ(nullptr, cache.lookup(makeKey(query, bind->slice()),
+                                  bind->slice(), 1));
+
+  cache.store(makeKey(query, bind->slice()), makeValue(1));
+
+  auto other = velocypack::Parser::fromJson(R"({"value":2})");
+  auto entry = cache.lookup(makeKey(query, other->slice()), other->slice(), 1);
+  ASSERT_NE(nullptr, entry);
+  EXPECT_TRUE(entry->plan.slice().isObject());
+
+  auto stats = cache.stats();
+  EXPECT_EQ(1, stats.hits);
+  EXPECT_EQ(1, stats.misses);
+  EXPECT_EQ(1, stats.numEntries);
+  EXPECT_LT(0, stats.memoryUsage);
+}
+
+TEST(QueryPlanCacheTest, lookup_fails_after_ddl_change) {
+  QueryPlanCache cache(10, 1024 * 1024);
+  auto query = "FOR doc IN test RETURN doc";
+  auto bind = velocypack::Parser::fromJson("{}");
+
+  cache.store(makeKey(query, bind->slice()), makeValue(5));
+  EXPECT_NE(nullptr,
+            cache.lookup(makeKey(query, bind->slice()), bind->slice(), 5));
+  EXPECT_EQ(nullptr,
+            cache.lookup(makeKey(query, bind->slice()), bind->slice(), 6));
+
+  // storing a new plan replaces the outdated one
+  cache.store(makeKey(query, bind->slice()), makeValue(6));
+  EXPECT_NE(nullptr,
+            cache.lookup(makeKey(query, bind->slice()), bind->slice(), 6));
+  EXPECT_EQ(1, cache.stats().numEntries);
+}
+
+TEST(QueryPlanCacheTest, lookup_requires_identical_structural_parameters) {
+  QueryPlanCache cache(10, 1024 * 1024);
+  auto query = "FOR doc IN @@c FILTER doc.value == @value RETURN doc";
+  auto bind1 = velocypack::Parser::fromJson(R"({"@c":"test1","value":1})");
+  auto bind2 = velocypack::Parser::fromJson(R"({"@c":"test1","value":2})");
+  auto bind3 = velocypack::Parser::fromJson(R"({"@c":"test2","value":1})");
+
+  cache.store(makeKey(query, bind1->slice()),
+              makeValue(1, R"({"@c":"test1"})"));
+
+  EXPECT_NE(nullptr,
+            cache.lookup(makeKey(query, bind2->slice()), bind2->slice(), 1));
+  EXPECT_EQ(nullptr,
+            cache.lookup(makeKey(query, bind3->slice()), bind3->slice(), 1));
+}
+
+TEST(QueryPlanCacheTest, invalidate) {
+  QueryPlanCache cache(10, 1024 * 1024);
+  auto query = "FOR doc IN test RETURN doc";
+  auto bind = velocypack::Parser::fromJson("{}");
+
+  cache.store(makeKey(query, bind->slice(), "db1"), makeValue(1));
+  cache.store(makeKey(query, bind->slice(), "db2"), makeValue(1));
+  EXPECT_EQ(2, cache.stats().numEntries);
+
+  cache.invalidate("db1");
+  EXPECT_EQ(1, cache.stats().numEntries);
+  EXPECT_EQ(nullptr, cache.lookup(makeKey(query, bind->slice(), "db1"),
+                                  bind->slice(), 1));
+  EXPECT_NE(nullptr, cache.lookup(makeKey(query, bind->slice(), "db2"),
+                                  bind->slice(), 1));
+
+  cache.invalidateAll();
+  EXPECT_EQ(0, cache.stats().numEntries);
+  EXPECT_EQ(0, cache.stats().memoryUsage);
+}
+
+TEST(QueryPlanCacheTest, limits_are_enforced) {
+  auto bind = velocypack::Parser::fromJson("{}");
+  {
+    QueryPlanCache cache(3, 1024 * 1024);
+    for (int i = 0; i < 10; ++i) {
+      cache.store(makeKey("RETURN " + std::to_string(i), bind->slice()),
+                  makeValue(1));
+      EXPECT_GE(3, cache.stats().numEntries);
+    }
+    EXPECT_EQ(3, cache.stats().numEntries);
+  }
+
+  {
+    // entries that are larger than the cache are not stored at all
+    QueryPlanCache cache(10, 16);
+    cache.store(makeKey("RETURN 1", bind->slice()), makeValue(1));
+    EXPECT_EQ(0, cache.stats().numEntries);
+    EXPECT_EQ(0, cache.stats().memoryUsage);
+  }
+}
@@ -332,4 +332,32 @@ TEST_P(SortExecutorTest, regression_bts_1511) {
       .run();
 }
 
+TEST_P(SortExecutorTest, sorts_mixed_types_in_aql_order) {
+  AqlCall call{};          // unlimited produce
+  ExecutionStats stats{};  // No stats here
+  makeExecutorTestHelper()
+      .addConsumer<SortExecutor>(makeRegisterInfos(), makeExecutorInfos(),
+                                 ExecutionNode::SORT)
+      .setInputSplitType(getSplit())
+      .setInputValueList(R"("b")", R"([1])", R"(2.5)", R"(true)",
+                         R"(null)", R"({})", R"("a")", R"(false)", -3,
+                         R"(9007199254740993)", R"(9007199254740992)", 0)
+      .expectOutput({0}, {{R"(null)"},
+                          {R"(false)"},
+                          {R"(true)"},
+                          {-3},
+                          {0},
+                          {R"(2.5)"},
+                          {R"(9007199254740992)"},
+                          {R"(9007199254740993)"},
+                          {R"("a")"},
+                          {R"("b")"},
+                          {R"([1])"},
+                          {R"({})"}})
+      .setCall(call)
+      .expectSkipped(0)
+      .expectedState(ExecutionState::DONE)
+      .run();
+}
+
 }  // namespace arangodb::tests::aql
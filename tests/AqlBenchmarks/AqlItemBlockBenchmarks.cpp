@@ -0,0 +1,116 @@
+////////////////////////////////////////////////////////////////////////////////
+/// DISCLAIMER
+///
+/// Copyright 2014-2023 ArangoDB GmbH, Cologne, Germany
+/// Copyright 2004-2014 triAGENS GmbH, Cologne, Germany
+///
+/// Licensed under the Apache License, Version 2.0 (the "License");
+/// you may not use this file except in compliance with the License.
+/// You may obtain a copy of the License at
+///
+///     http://www.apache.org/licenses/LICENSE-2.0
+///
+/// Unless required by applicable law or agreed to in writing, software
+/// distributed under the License is distributed on an "AS IS" BASIS,
+/// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+/// See the License for the specific language governing permissions and
+/// limitations under the License.
+///
+/// Copyright holder is ArangoDB GmbH, Cologne, Germany
+///
+/// @author Jan Steemann
+////////////////////////////////////////////////////////////////////////////////
+
+#include "Aql/AqlItemBlock.h"
+#include "Aql/AqlItemBlockManager.h"
+#include "Aql/AqlValue.h"
+#include "Aql/SharedAqlItemBlockPtr.h"
+#include "Basics/GlobalResourceMonitor.h"
+#include "Basics/ResourceUsage.h"
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+
+using namespace arangodb;
+using namespace arangodb::aql;
+
+namespace {
+
+// requesting and returning blocks, as done by every executor for every
+// output block. the manager recycles returned blocks
+void BM_AqlItemBlockManagerRequestBlock(benchmark::State& state) {
+  GlobalResourceMonitor global;
+  ResourceMonitor monitor(global);
+  AqlItemBlockManager manager(monitor);
+  auto const numRows = static_cast<std::size_t>(state.range(0));
+  auto const numRegisters = static_cast<RegisterCount>(state.range(1));
+
+  for (auto _ : state) {
+    SharedAqlItemBlockPtr block = manager.requestBlock(numRows, numRegisters);
+    benchmark::DoNotOptimize(block.get());
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+// filling a block with values and reading them back
+void BM_AqlItemBlockSetAndGetValues(benchmark::State& state) {
+  GlobalResourceMonitor global;
+  ResourceMonitor monitor(global);
+  AqlItemBlockManager manager(monitor);
+  auto const numRows = static_cast<std::size_t>(state.range(0));
+  constexpr RegisterCount numRegisters = 4;
+
+  for (auto _ : state) {
+    SharedAqlItemBlockPtr block = manager.requestBlock(numRows, numRegisters);
+    for (std::size_t row = 0; row < numRows; ++row) {
+      for (RegisterId::value_t reg = 0; reg < numRegisters; ++reg) {
+        block->emplaceValue(row, reg,
+                            AqlValueHintInt(static_cast<int64_t>(row + reg)));
+      }
+    }
+    std::int64_t sum = 0;
+    for (std::size_t row = 0; row < numRows; ++row) {
+      for (RegisterId::value_t reg = 0; reg < numRegisters; ++reg) {
+        sum += block->getValueReference(row, RegisterId(reg)).toInt64();
+      }
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * numRows * numRegisters);
+}
+
+// copying a range of rows into a new block, e.g. for passing on partial
+// blocks
+void BM_AqlItemBlockSlice(benchmark::State& state) {
+  GlobalResourceMonitor global;
+  ResourceMonitor monitor(global);
+  AqlItemBlockManager manager(monitor);
+  auto const numRows = static_cast<std::size_t>(state.range(0));
+  constexpr RegisterCount numRegisters = 4;
+
+  SharedAqlItemBlockPtr block = manager.requestBlock(numRows, numRegisters);
+  for (std::size_t row = 0; row < numRows; ++row) {
+    for (RegisterId::value_t reg = 0; reg < numRegisters; ++reg) {
+      block->emplaceValue(row, reg,
+                          AqlValueHintInt(static_cast<int64_t>(row + reg)));
+    }
+  }
+
+  for (auto _ : state) {
+    SharedAqlItemBlockPtr slice = block->slice(0, numRows / 2);
+    benchmark::DoNotOptimize(slice.get());
+  }
+  state.SetItemsProcessed(state.iterations() * (numRows / 2));
+}
+
+}  // namespace
+
+BENCHMARK(BM_AqlItemBlockManagerRequestBlock)
+    ->ArgNames({"rows", "registers"})
+    ->ArgsProduct({{100, 1000}, {1, 8, 32}});
+BENCHMARK(BM_AqlItemBlockSetAndGetValues)
+    ->ArgName("rows")
+    ->Arg(100)
+    ->Arg(1000);
+BENCHMARK(BM_AqlItemBlockSlice)->ArgName("rows")->Arg(100)->Arg(1000);
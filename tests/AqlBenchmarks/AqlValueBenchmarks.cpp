@@ -0,0 +1,138 @@
+////////////////////////////////////////////////////////////////////////////////
+/// DISCLAIMER
+///
+/// Copyright 2014-2023 ArangoDB GmbH, Cologne, Germany
+/// Copyright 2004-2014 triAGENS GmbH, Cologne, Germany
+///
+/// Licensed under the Apache License, Version 2.0 (the "License");
+/// you may not use this file except in compliance with the License.
+/// You may obtain a copy of the License at
+///
+///     http://www.apache.org/licenses/LICENSE-2.0
+///
+/// Unless required by applicable law or agreed to in writing, software
+/// distributed under the License is distributed on an "AS IS" BASIS,
+/// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+/// See the License for the specific language governing permissions and
+/// limitations under the License.
+///
+/// Copyright holder is ArangoDB GmbH, Cologne, Germany
+///
+/// @author Jan Steemann
+////////////////////////////////////////////////////////////////////////////////
+
+#include "Aql/AqlValue.h"
+
+#include <velocypack/Buffer.h>
+#include <velocypack/Builder.h>
+#include <velocypack/Options.h>
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+using namespace arangodb;
+using namespace arangodb::aql;
+
+namespace {
+
+constexpr std::size_t kNumValues = 1024;
+
+enum class ValueKind : std::int64_t { kInt, kDouble, kString, kArray };
+
+AqlValue makeValue(ValueKind kind, std::size_t i) {
+  switch (kind) {
+    case ValueKind::kInt:
+      return AqlValue(AqlValueHintInt(static_cast<std::int64_t>(i * 7919)));
+    case ValueKind::kDouble:
+      return AqlValue(AqlValueHintDouble(static_cast<double>(i) * 0.37));
+    case ValueKind::kString:
+      return AqlValue(std::string_view("some-prefix-" + std::to_string(i)));
+    case ValueKind::kArray: {
+      velocypack::Buffer<uint8_t> buffer;
+      velocypack::Builder builder(buffer);
+      builder.openArray();
+      for (std::size_t j = 0; j < 8; ++j) {
+        builder.add(velocypack::Value(i + j));
+      }
+      builder.close();
+      return AqlValue(std::move(buffer));
+    }
+  }
+  return AqlValue(AqlValueHintNull());
+}
+
+std::vector<AqlValue> makeValues(ValueKind kind) {
+  std::vector<AqlValue> values;
+  values.reserve(kNumValues);
+  for (std::size_t i = 0; i < kNumValues; ++i) {
+    values.emplace_back(makeValue(kind, i));
+  }
+  return values;
+}
+
+void destroyValues(std::vector<AqlValue>& values) {
+  for (auto& value : values) {
+    value.destroy();
+  }
+}
+
+void BM_AqlValueCompare(benchmark::State& state) {
+  auto values = makeValues(static_cast<ValueKind>(state.range(0)));
+  auto const* options = &velocypack::Options::Defaults;
+
+  std::size_t i = 0;
+  for (auto _ : state) {
+    auto const& left = values[i % kNumValues];
+    auto const& right = values[(i + 1) % kNumValues];
+    // binary string comparison. the UTF-8 comparison would require ICU to
+    // be initialized, and mostly measures ICU
+    benchmark::DoNotOptimize(
+        AqlValue::Compare(options, left, right, /*useUtf8*/ false));
+    ++i;
+  }
+  state.SetItemsProcessed(state.iterations());
+  destroyValues(values);
+}
+
+void BM_AqlValueHash(benchmark::State& state) {
+  auto values = makeValues(static_cast<ValueKind>(state.range(0)));
+
+  std::size_t i = 0;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(values[i % kNumValues].hash());
+    ++i;
+  }
+  state.SetItemsProcessed(state.iterations());
+  destroyValues(values);
+}
+
+void BM_AqlValueClone(benchmark::State& state) {
+  auto values = makeValues(static_cast<ValueKind>(state.range(0)));
+
+  std::size_t i = 0;
+  for (auto _ : state) {
+    AqlValue copy = values[i % kNumValues].clone();
+    benchmark::DoNotOptimize(copy);
+    copy.destroy();
+    ++i;
+  }
+  state.SetItemsProcessed(state.iterations());
+  destroyValues(values);
+}
+
+void valueKinds(benchmark::internal::Benchmark* benchmark) {
+  benchmark->ArgName("kind");
+  for (auto kind : {ValueKind::kInt, ValueKind::kDouble, ValueKind::kString,
+                    ValueKind::kArray}) {
+    benchmark->Arg(static_cast<std::int64_t>(kind));
+  }
+}
+
+}  // namespace
+
+BENCHMARK(BM_AqlValueCompare)->Apply(valueKinds);
+BENCHMARK(BM_AqlValueHash)->Apply(valueKinds);
+BENCHMARK(BM_AqlValueClone)->Apply(valueKinds);
@@ -0,0 +1,96 @@
+////////////////////////////////////////////////////////////////////////////////
+/// DISCLAIMER
+///
+/// Copyright 2014-2023 ArangoDB GmbH, Cologne, Germany
+/// Copyright 2004-2014 triAGENS GmbH, Cologne, Germany
+///
+/// Licensed under the Apache License, Version 2.0 (the "License");
+/// you may not use this file except in compliance with the License.
+/// You may obtain a copy of the License at
+///
+///     http://www.apache.org/licenses/LICENSE-2.0
+///
+/// Unless required by applicable law or agreed to in writing, software
+/// distributed under the License is distributed on an "AS IS" BASIS,
+/// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+/// See the License for the specific language governing permissions and
+/// limitations under the License.
+///
+/// Copyright holder is ArangoDB GmbH, Cologne, Germany
+///
+/// @author Jan Steemann
+////////////////////////////////////////////////////////////////////////////////
+
+#include "Aql/AqlCall.h"
+#include "Aql/AqlItemBlock.h"
+#include "Aql/AqlItemBlockInputRange.h"
+#include "Aql/AqlItemBlockManager.h"
+#include "Aql/AqlValue.h"
+#include "Aql/ExecutionState.h"
+#include "Aql/FilterExecutor.h"
+#include "Aql/OutputAqlItemRow.h"
+#include "Aql/SharedAqlItemBlockPtr.h"
+#include "Basics/GlobalResourceMonitor.h"
+#include "Basics/ResourceUsage.h"
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+
+using namespace arangodb;
+using namespace arangodb::aql;
+
+namespace {
+
+// the executor only needs a fetcher for its constructor. the input rows are
+// passed to produceRows() directly
+struct NoFetcher : FilterExecutor::Fetcher {
+  NoFetcher() = default;
+};
+
+// filters a block with 1000 rows, with the given percentage of rows passing
+// the filter. register 0 holds the filter condition, register 1 a payload
+// value that is copied along
+void BM_FilterExecutorProduceRows(benchmark::State& state) {
+  constexpr std::size_t kNumRows = 1000;
+  constexpr RegisterCount kNumRegisters = 2;
+  auto const selectivity = static_cast<std::size_t>(state.range(0));
+
+  GlobalResourceMonitor global;
+  ResourceMonitor monitor(global);
+  AqlItemBlockManager manager(monitor);
+
+  SharedAqlItemBlockPtr input = manager.requestBlock(kNumRows, kNumRegisters);
+  for (std::size_t row = 0; row < kNumRows; ++row) {
+    input->emplaceValue(row, 0, AqlValueHintBool(row % 100 < selectivity));
+    input->emplaceValue(row, 1, AqlValueHintInt(static_cast<int64_t>(row)));
+  }
+
+  NoFetcher fetcher;
+  FilterExecutorInfos infos(RegisterId(0));
+  FilterExecutor executor(fetcher, infos);
+
+  RegIdSet const outputRegisters{};
+  RegIdFlatSetStack const registersToKeep{RegIdFlatSet{0, 1}};
+  RegIdFlatSet const registersToClear{};
+
+  for (auto _ : state) {
+    AqlItemBlockInputRange inputRange(MainQueryState::DONE, 0, input, 0);
+    OutputAqlItemRow output(manager.requestBlock(kNumRows, kNumRegisters),
+                            outputRegisters, registersToKeep,
+                            registersToClear);
+    auto result = executor.produceRows(inputRange, output);
+    benchmark::DoNotOptimize(result);
+    benchmark::DoNotOptimize(output.numRowsWritten());
+  }
+  state.SetItemsProcessed(state.iterations() * kNumRows);
+}
+
+}  // namespace
+
+BENCHMARK(BM_FilterExecutorProduceRows)
+    ->ArgName("selectivity")
+    ->Arg(0)
+    ->Arg(10)
+    ->Arg(50)
+    ->Arg(100);
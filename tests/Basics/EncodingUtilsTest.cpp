@@ -290,3 +290,58 @@ TEST(EncodingUtilsTest, testVPackBufferGzipInflateDeflate) {
               fasthash64(inflated.data(), inflated.size(), 0xdeadbeef));
   }
 }
+
+TEST(EncodingUtilsTest, testLz4CompressUncompress) {
+  auto roundtrip = [](std::string_view input) {
+    velocypack::Buffer<uint8_t> compressed;
+    EXPECT_EQ(TRI_ERROR_NO_ERROR,
+              encoding::lz4Compress(
+                  reinterpret_cast<uint8_t const*>(input.data()),
+                  input.size(), compressed));
+    // uncompressed length prefix
+    EXPECT_LE(4, compressed.size());
+
+    velocypack::Buffer<uint8_t> uncompressed;
+    EXPECT_EQ(TRI_ERROR_NO_ERROR,
+              encoding::lz4Uncompress(compressed.data(), compressed.size(),
+                                      uncompressed));
+    EXPECT_EQ(input, std::string_view(
+                         reinterpret_cast<char const*>(uncompressed.data()),
+                         uncompressed.size()));
+    return compressed.size();
+  };
+
+  roundtrip("");
+  roundtrip(::shortString);
+  roundtrip(::mediumString);
+
+  std::string large;
+  for (int i = 0; i < 10000; ++i) {
+    large.append(::shortString);
+  }
+  EXPECT_GT(large.size() / 10, roundtrip(large));
+}
+
+TEST(EncodingUtilsTest, testLz4UncompressBrokenInput) {
+  velocypack::Buffer<uint8_t> uncompressed;
+
+  // too short for the length prefix
+  std::string_view input = "ab";
+  EXPECT_EQ(TRI_ERROR_BAD_PARAMETER,
+            encoding::lz4Uncompress(
+                reinterpret_cast<uint8_t const*>(input.data()), input.size(),
+                uncompressed));
+  EXPECT_EQ(0, uncompressed.size());
+
+  // length prefix does not match the data
+  velocypack::Buffer<uint8_t> compressed;
+  ASSERT_EQ(TRI_ERROR_NO_ERROR,
+            encoding::lz4Compress(
+                reinterpret_cast<uint8_t const*>(::shortString),
+                sizeof(::shortString) - 1, compressed));
+  compressed.data()[3] += 1;
+  EXPECT_EQ(TRI_ERROR_BAD_PARAMETER,
+            encoding::lz4Uncompress(compressed.data(), compressed.size(),
+                                    uncompressed));
+  EXPECT_EQ(0, uncompressed.size());
+}
@@ -0,0 +1,112 @@
+////////////////////////////////////////////////////////////////////////////////
+/// DISCLAIMER
+///
+/// Copyright 2014-2023 ArangoDB GmbH, Cologne, Germany
+/// Copyright 2004-2014 triAGENS GmbH, Cologne, Germany
+///
+/// Licensed under the Apache License, Version 2.0 (the "License");
+/// you may not use this file except in compliance with the License.
+/// You may obtain a copy of the License at
+///
+///     http://www.apache.org/licenses/LICENSE-2.0
+///
+/// Unless required by applicable law or agreed to in writing, software
+/// distributed under the License is distributed on an "AS IS" BASIS,
+/// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+/// See the License for the specific language governing permissions and
+/// limitations under the License.
+///
+/// Copyright holder is ArangoDB GmbH, Cologne, Germany
+///
+/// @author Jan Steemann
+////////////////////////////////////////////////////////////////////////////////
+
+#include "Basics/LockContention.h"
+
+#include "gtest/gtest.h"
+
+#include <chrono>
+
+using namespace arangodb::basics;
+
+namespace {
+LockContentionSite testSite("LockContentionTest");
+
+struct ProfilingScope {
+  explicit ProfilingScope(bool enabled)
+      : previous(LockContentionSite::enabled()) {
+    LockContentionSite::setEnabled(enabled);
+    testSite.reset();
+  }
+  ~ProfilingScope() { LockContentionSite::setEnabled(previous); }
+  bool previous;
+};
+}  // namespace
+
+TEST(LockContentionTest, testRecordAndBuckets) {
+  ProfilingScope scope(true);
+
+  testSite.record(std::chrono::nanoseconds(500));
+  testSite.record(std::chrono::microseconds(3));
+  testSite.record(std::chrono::microseconds(4));
+  testSite.record(std::chrono::hours(1));
+
+  auto snapshot = testSite.snapshot();
+  ASSERT_EQ(4, snapshot.count);
+  ASSERT_EQ(std::chrono::nanoseconds(std::chrono::hours(1)).count(),
+            snapshot.maxWaitNanos);
+  ASSERT_EQ(500 + 3000 + 4000 +
+                std::chrono::nanoseconds(std::chrono::hours(1)).count(),
+            snapshot.totalWaitNanos);
+
+  // <= 1us
+  ASSERT_EQ(1, snapshot.buckets[0]);
+  // 3us and 4us both go into the <= 4us bucket
+  ASSERT_EQ(0, snapshot.buckets[1]);
+  ASSERT_EQ(2, snapshot.buckets[2]);
+  // overflow bucket
+  ASSERT_EQ(1, snapshot.buckets[LockContentionSite::kNumBuckets - 1]);
+
+  testSite.reset();
+  snapshot = testSite.snapshot();
+  ASSERT_EQ(0, snapshot.count);
+  ASSERT_EQ(0, snapshot.totalWaitNanos);
+  ASSERT_EQ(0, snapshot.maxWaitNanos);
+  for (auto value : snapshot.buckets) {
+    ASSERT_EQ(0, value);
+  }
+}
+
+TEST(LockContentionTest, testSiteIsRegistered) {
+  bool found = false;
+  LockContentionSite::visit([&](LockContentionSite const& site) {
+    if (&site == &testSite) {
+      ASSERT_EQ("LockContentionTest", site.name());
+      found = true;
+    }
+  });
+  ASSERT_TRUE(found);
+}
+
+TEST(LockContentionTest, testTimerRecordsOnlyWhenEnabled) {
+  {
+    ProfilingScope scope(false);
+    { LockWaitTimer timer(testSite); }
+    ASSERT_EQ(0, testSite.snapshot().count);
+  }
+  {
+    ProfilingScope scope(true);
+    { LockWaitTimer timer(testSite); }
+    ASSERT_EQ(1, testSite.snapshot().count);
+
+    // deferred timers only record if they were started
+    { LockWaitTimer timer(testSite, std::defer_lock); }
+    ASSERT_EQ(1, testSite.snapshot().count);
+    {
+      LockWaitTimer timer(testSite, std::defer_lock);
+      timer.start();
+      timer.start();
+    }
+    ASSERT_EQ(2, testSite.snapshot().count);
+  }
+}
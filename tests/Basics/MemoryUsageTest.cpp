@@ -395,6 +395,60 @@ TEST(ResourceUsageTest, testGlobalMemoryLimitViolationCounterHitByMultiple) {
   ASSERT_EQ(0, stats.localLimitReached);
 }
 
+TEST(ResourceUsageTest, testNestedMemoryLimit) {
+  GlobalResourceMonitor global;
+  global.memoryLimit(4 * 32768);
+
+  GlobalResourceMonitor database1(global);
+  database1.memoryLimit(2 * 32768);
+  GlobalResourceMonitor database2(global);
+
+  ResourceMonitor monitor1(database1);
+  ResourceMonitor monitor2(database2);
+
+  ResourceUsageScope scope1(monitor1);
+  scope1.increase(2 * 32768);
+  ASSERT_EQ(2 * 32768, database1.current());
+  ASSERT_EQ(2 * 32768, global.current());
+
+  // the limit of the nested monitor is reached
+  try {
+    scope1.increase(32768);
+    throw "fail!";
+  } catch (basics::Exception const& ex) {
+    ASSERT_EQ(TRI_ERROR_RESOURCE_LIMIT, ex.code());
+  }
+  ASSERT_EQ(2 * 32768, database1.current());
+  ASSERT_EQ(2 * 32768, global.current());
+  ASSERT_EQ(1, database1.stats().globalLimitReached);
+  ASSERT_EQ(0, global.stats().globalLimitReached);
+  ASSERT_EQ(1, global.stats().nestedLimitReached);
+
+  // the other nested monitor can use the remaining global memory
+  ResourceUsageScope scope2(monitor2);
+  scope2.increase(2 * 32768);
+  ASSERT_EQ(2 * 32768, database2.current());
+  ASSERT_EQ(4 * 32768, global.current());
+
+  // now the limit of the parent is reached
+  try {
+    scope2.increase(32768);
+    throw "fail!";
+  } catch (basics::Exception const& ex) {
+    ASSERT_EQ(TRI_ERROR_RESOURCE_LIMIT, ex.code());
+  }
+  ASSERT_EQ(2 * 32768, database2.current());
+  ASSERT_EQ(4 * 32768, global.current());
+  ASSERT_EQ(0, database2.stats().globalLimitReached);
+  ASSERT_EQ(1, global.stats().globalLimitReached);
+
+  scope1.revert();
+  scope2.revert();
+  ASSERT_EQ(0, database1.current());
+  ASSERT_EQ(0, database2.current());
+  ASSERT_EQ(0, global.current());
+}
+
 TEST(GlobalResourceMonitorTest, testEmpty) {
   GlobalResourceMonitor monitor;
 
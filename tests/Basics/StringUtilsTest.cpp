@@ -280,6 +280,25 @@ TEST_F(StringUtilsTest, test_uint64_trusted) {
             StringUtils::uint64_trusted(std::to_string(UINT64_MAX)));
 }
 
+TEST_F(StringUtilsTest, test_isAscii) {
+  EXPECT_TRUE(StringUtils::isAscii(""));
+  EXPECT_TRUE(StringUtils::isAscii("abc"));
+  EXPECT_TRUE(StringUtils::isAscii(std::string("\x00\x7f", 2)));
+  EXPECT_FALSE(StringUtils::isAscii("\x80"));
+  EXPECT_FALSE(StringUtils::isAscii("m\xc3\xb6p"));
+
+  // non-ASCII characters at all positions, including the tail that is not
+  // processed in blocks of 32 bytes
+  std::string value(100, 'x');
+  EXPECT_TRUE(StringUtils::isAscii(value));
+  for (size_t i = 0; i < value.size(); ++i) {
+    std::string copy = value;
+    copy[i] = '\xff';
+    EXPECT_FALSE(StringUtils::isAscii(copy)) << i;
+    EXPECT_TRUE(StringUtils::isAscii(copy.data(), i)) << i;
+  }
+}
+
 TEST_F(StringUtilsTest, test_encodeHex) {
   EXPECT_EQ("", StringUtils::encodeHex(""));
 
@@ -95,3 +95,36 @@ TEST(CacheBucketStateTest, test_methods_for_nonlock_flags) {
   ASSERT_FALSE(state.isSet(BucketState::Flag::migrated));
   state.unlock();
 }
+
+TEST(CacheBucketStateTest, test_optimistic_reads) {
+  BucketState state;
+
+  auto version = state.beginOptimisticRead();
+  ASSERT_FALSE(BucketState::isSet(version, BucketState::Flag::locked));
+  ASSERT_TRUE(state.validateOptimisticRead(version));
+
+  // locking invalidates a read
+  ASSERT_TRUE(state.lock());
+  ASSERT_FALSE(state.validateOptimisticRead(version));
+  ASSERT_TRUE(BucketState::isSet(state.beginOptimisticRead(),
+                                 BucketState::Flag::locked));
+
+  // unlocking does not restore the previous state
+  state.unlock();
+  ASSERT_FALSE(state.validateOptimisticRead(version));
+
+  // flags are kept when the version changes
+  ASSERT_TRUE(state.lock());
+  state.toggleFlag(BucketState::Flag::migrated);
+  state.unlock();
+  version = state.beginOptimisticRead();
+  ASSERT_TRUE(BucketState::isSet(version, BucketState::Flag::migrated));
+  ASSERT_FALSE(BucketState::isSet(version, BucketState::Flag::locked));
+  ASSERT_TRUE(state.validateOptimisticRead(version));
+
+  ASSERT_TRUE(state.lock());
+  state.clear();
+  state.unlock();
+  ASSERT_FALSE(BucketState::isSet(state.beginOptimisticRead(),
+                                  BucketState::Flag::migrated));
+}
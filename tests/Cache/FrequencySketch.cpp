@@ -0,0 +1,76 @@
+////////////////////////////////////////////////////////////////////////////////
+/// DISCLAIMER
+///
+/// Copyright 2014-2023 ArangoDB GmbH, Cologne, Germany
+/// Copyright 2004-2014 triAGENS GmbH, Cologne, Germany
+///
+/// Licensed under the Apache License, Version 2.0 (the "License");
+/// you may not use this file except in compliance with the License.
+/// You may obtain a copy of the License at
+///
+///     http://www.apache.org/licenses/LICENSE-2.0
+///
+/// Unless required by applicable law or agreed to in writing, software
+/// distributed under the License is distributed on an "AS IS" BASIS,
+/// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+/// See the License for the specific language governing permissions and
+/// limitations under the License.
+///
+/// Copyright holder is ArangoDB GmbH, Cologne, Germany
+///
+/// @author Jan Steemann
+////////////////////////////////////////////////////////////////////////////////
+
+#include "gtest/gtest.h"
+
+#include <cstdint>
+
+#include "Cache/FrequencySketch.h"
+
+using namespace arangodb;
+using namespace arangodb::cache;
+
+TEST(CacheFrequencySketchTest, test_estimates) {
+  FrequencySketch sketch(1024);
+  ASSERT_EQ(sizeof(FrequencySketch) + 1024 * sizeof(std::uint64_t),
+            sketch.memoryUsage());
+
+  for (std::uint32_t hash = 0; hash < 100; ++hash) {
+    ASSERT_EQ(0, sketch.estimate(hash));
+  }
+
+  for (std::uint32_t i = 0; i < 5; ++i) {
+    sketch.record(42);
+  }
+  sketch.record(43);
+
+  // count-min sketches never underestimate
+  EXPECT_LE(5, sketch.estimate(42));
+  EXPECT_LE(1, sketch.estimate(43));
+  EXPECT_GT(sketch.estimate(42), sketch.estimate(43));
+}
+
+TEST(CacheFrequencySketchTest, test_counters_are_capped) {
+  FrequencySketch sketch(1024);
+  for (std::uint32_t i = 0; i < 100; ++i) {
+    sketch.record(42);
+  }
+  EXPECT_EQ(FrequencySketch::kMaxCount, sketch.estimate(42));
+}
+
+TEST(CacheFrequencySketchTest, test_aging) {
+  FrequencySketch sketch(1024);
+  for (std::uint32_t i = 0; i < FrequencySketch::kMaxCount; ++i) {
+    sketch.record(42);
+  }
+  ASSERT_EQ(FrequencySketch::kMaxCount, sketch.estimate(42));
+
+  // record lots of other keys, so that the counters are halved at least
+  // once, and the old popularity of the key fades
+  for (std::uint32_t hash = 0; hash < 100'000; ++hash) {
+    if (hash != 42) {
+      sketch.record(hash);
+    }
+  }
+  EXPECT_GT(FrequencySketch::kMaxCount, sketch.estimate(42));
+}
@@ -206,3 +206,34 @@ TEST(CachePlainBucketTest, verify_eviction_works_correctly) {
     delete ptrs[i];
   }
 }
+
+TEST(CachePlainBucketTest, verify_optimistic_miss_detection) {
+  auto bucket = std::make_unique<PlainBucket>();
+
+  std::uint64_t key = 1;
+  std::uint64_t value = 1;
+  CachedValue* ptr = CachedValue::construct(&key, sizeof(std::uint64_t),
+                                            &value, sizeof(std::uint64_t));
+  TRI_ASSERT(ptr != nullptr);
+
+  // empty bucket
+  ASSERT_TRUE(bucket->definitelyMissing(1));
+
+  ASSERT_TRUE(bucket->lock(-1LL));
+  // locked buckets cannot be read optimistically
+  ASSERT_FALSE(bucket->definitelyMissing(1));
+  bucket->insert(1, ptr);
+  bucket->unlock();
+
+  ASSERT_FALSE(bucket->definitelyMissing(1));
+  ASSERT_TRUE(bucket->definitelyMissing(2));
+
+  ASSERT_TRUE(bucket->lock(-1LL));
+  ASSERT_EQ(ptr,
+            bucket->remove<BinaryKeyHasher>(1, &key, sizeof(std::uint64_t)));
+  bucket->unlock();
+
+  ASSERT_TRUE(bucket->definitelyMissing(1));
+
+  delete ptr;
+}
@@ -417,3 +417,106 @@ TEST(CachePlainCacheTest, test_hit_rate_statistics_reporting) {
   manager.destroyCache(std::move(cacheMiss));
   manager.destroyCache(std::move(cacheMixed));
 }
+
+TEST(CachePlainCacheTest, test_admission_filter_protects_hot_entries) {
+  // returns the number of hits for the hot keys while a scan over many
+  // keys that are accessed only once is running
+  auto runWorkload = [](bool enableAdmissionFilter) {
+    std::uint64_t cacheLimit = 128 * 1024;
+    auto postFn = [](std::function<void()>) -> bool { return false; };
+    MockMetricsServer server;
+    SharedPRNGFeature& sharedPRNG = server.getFeature<SharedPRNGFeature>();
+    CacheOptions co;
+    co.cacheSize = 4 * cacheLimit;
+    co.enableAdmissionFilter = enableAdmissionFilter;
+    Manager manager(sharedPRNG, postFn, co);
+    auto cache = manager.createCache<BinaryKeyHasher>(CacheType::Plain, false,
+                                                      cacheLimit);
+
+    auto lookupOrInsert = [&](std::uint64_t key) {
+      if (cache->find(&key, sizeof(std::uint64_t)).found()) {
+        return true;
+      }
+      CachedValue* value = CachedValue::construct(
+          &key, sizeof(std::uint64_t), &key, sizeof(std::uint64_t));
+      TRI_ASSERT(value != nullptr);
+      if (cache->insert(value) != TRI_ERROR_NO_ERROR) {
+        delete value;
+      }
+      return false;
+    };
+
+    constexpr std::uint64_t numHot = 256;
+    std::uint64_t hotHits = 0;
+    for (std::uint64_t i = 0; i < 64 * 1024; ++i) {
+      lookupOrInsert(1'000'000 + i);
+      if (i % 256 == 0) {
+        for (std::uint64_t key = 0; key < numHot; ++key) {
+          hotHits += lookupOrInsert(key) ? 1 : 0;
+        }
+      }
+    }
+
+    if (enableAdmissionFilter) {
+      EXPECT_LT(0, manager.admissionStats().second);
+    } else {
+      EXPECT_EQ(0, manager.admissionStats().first);
+      EXPECT_EQ(0, manager.admissionStats().second);
+    }
+    manager.destroyCache(std::move(cache));
+    return hotHits;
+  };
+
+  std::uint64_t hitsWithoutFilter = runWorkload(false);
+  std::uint64_t hitsWithFilter = runWorkload(true);
+  EXPECT_GT(hitsWithFilter, hitsWithoutFilter);
+}
+
+TEST(CachePlainCacheTest, test_for_each_key) {
+  std::uint64_t cacheLimit = 128 * 1024;
+  auto postFn = [](std::function<void()>) -> bool { return false; };
+  MockMetricsServer server;
+  SharedPRNGFeature& sharedPRNG = server.getFeature<SharedPRNGFeature>();
+  CacheOptions co;
+  co.cacheSize = 4 * cacheLimit;
+  Manager manager(sharedPRNG, postFn, co);
+  auto cache =
+      manager.createCache<BinaryKeyHasher>(CacheType::Plain, false, cacheLimit);
+
+  std::vector<bool> inserted(256, false);
+  for (std::uint64_t i = 0; i < inserted.size(); i++) {
+    CachedValue* value = CachedValue::construct(&i, sizeof(std::uint64_t), &i,
+                                                sizeof(std::uint64_t));
+    TRI_ASSERT(value != nullptr);
+    if (cache->insert(value) == TRI_ERROR_NO_ERROR) {
+      inserted[i] = true;
+    } else {
+      delete value;
+    }
+  }
+
+  std::vector<bool> visited(inserted.size(), false);
+  cache->forEachKey([&](std::string_view key) {
+    EXPECT_EQ(sizeof(std::uint64_t), key.size());
+    std::uint64_t i;
+    memcpy(&i, key.data(), sizeof(i));
+    if (i >= visited.size()) {
+      ADD_FAILURE() << "unexpected key " << i;
+      return true;
+    }
+    EXPECT_FALSE(visited[i]);
+    visited[i] = true;
+    return true;
+  });
+  EXPECT_EQ(inserted, visited);
+
+  // stops as soon as the callback returns false
+  std::size_t calls = 0;
+  cache->forEachKey([&](std::string_view) {
+    ++calls;
+    return calls < 10;
+  });
+  EXPECT_EQ(10, calls);
+
+  manager.destroyCache(std::move(cache));
+}
@@ -0,0 +1,99 @@
+////////////////////////////////////////////////////////////////////////////////
+/// DISCLAIMER
+///
+/// Copyright 2014-2023 ArangoDB GmbH, Cologne, Germany
+/// Copyright 2004-2014 triAGENS GmbH, Cologne, Germany
+///
+/// Licensed under the Apache License, Version 2.0 (the "License");
+/// you may not use this file except in compliance with the License.
+/// You may obtain a copy of the License at
+///
+///     http://www.apache.org/licenses/LICENSE-2.0
+///
+/// Unless required by applicable law or agreed to in writing, software
+/// distributed under the License is distributed on an "AS IS" BASIS,
+/// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+/// See the License for the specific language governing permissions and
+/// limitations under the License.
+///
+/// Copyright holder is ArangoDB GmbH, Cologne, Germany
+///
+/// @author Jan Steemann
+////////////////////////////////////////////////////////////////////////////////
+
+#include "gtest/gtest.h"
+
+#include "Cluster/ShardLoadTracker.h"
+
+#include <velocypack/Builder.h>
+
+using namespace arangodb;
+using namespace arangodb::cluster;
+
+TEST(ShardLoadTrackerTest, levels_are_logarithmic) {
+  EXPECT_EQ(0, ShardLoadTracker::levelFor(0.0, 0));
+  EXPECT_EQ(0, ShardLoadTracker::levelFor(0.5, 0));
+  EXPECT_EQ(3, ShardLoadTracker::levelFor(7.0, 0));
+  EXPECT_EQ(10, ShardLoadTracker::levelFor(1023.0, 0));
+  EXPECT_EQ(10, ShardLoadTracker::levelFor(1023.0, 20));
+}
+
+TEST(ShardLoadTrackerTest, levels_do_not_flap) {
+  // 2^3.6 - 1, slightly above the boundary between levels 3 and 4
+  double rate = 11.13;
+  EXPECT_EQ(3, ShardLoadTracker::levelFor(rate, 3));
+  EXPECT_EQ(4, ShardLoadTracker::levelFor(rate, 4));
+  EXPECT_EQ(4, ShardLoadTracker::levelFor(rate, 0));
+}
+
+TEST(ShardLoadTrackerTest, rates_are_averaged) {
+  ShardLoadTracker tracker;
+  auto now = ShardLoadTracker::clock::now();
+
+  // the first update only starts the measurement
+  tracker.trackReads(1000);
+  auto levels = tracker.update(now);
+  EXPECT_EQ(0, levels.reads);
+  EXPECT_EQ(0.0, tracker.readRate());
+
+  // 1000 reads and 100 writes per second for ten minutes
+  for (int i = 0; i < 600; ++i) {
+    tracker.trackReads(1000);
+    tracker.trackWrites(100);
+    now += std::chrono::seconds(1);
+    levels = tracker.update(now);
+  }
+  EXPECT_NEAR(1000.0, tracker.readRate(), 1.0);
+  EXPECT_NEAR(100.0, tracker.writeRate(), 1.0);
+  EXPECT_EQ(10, levels.reads);
+  EXPECT_EQ(6, levels.writes);
+
+  // a short pause does not change the levels much
+  now += std::chrono::seconds(5);
+  levels = tracker.update(now);
+  EXPECT_EQ(10, levels.reads);
+  EXPECT_EQ(6, levels.writes);
+
+  // the load goes away eventually
+  now += std::chrono::hours(1);
+  levels = tracker.update(now);
+  EXPECT_EQ(0, levels.reads);
+  EXPECT_EQ(0, levels.writes);
+}
+
+TEST(ShardLoadTrackerTest, levels_round_trip_through_current) {
+  velocypack::Builder builder;
+  builder.openObject();
+  ShardLoadTracker::toVelocyPack({.reads = 5, .writes = 2}, builder);
+  builder.close();
+
+  auto levels = ShardLoadTracker::fromVelocyPack(builder.slice());
+  EXPECT_EQ(5, levels.reads);
+  EXPECT_EQ(2, levels.writes);
+
+  // entries written by older versions have no load
+  levels = ShardLoadTracker::fromVelocyPack(
+      velocypack::Slice::emptyObjectSlice());
+  EXPECT_EQ(0, levels.reads);
+  EXPECT_EQ(0, levels.writes);
+}
@@ -512,6 +512,42 @@ TEST(MerkleTreeTest, test_diff_equal) {
   }
 }
 
+TEST(MerkleTreeTest, test_batch_modifications_with_unsorted_keys) {
+  ::arangodb::containers::MerkleTree<::arangodb::containers::FnvHashProvider, 3>
+      t1(2, 0, 64);
+  ::arangodb::containers::MerkleTree<::arangodb::containers::FnvHashProvider, 3>
+      t2(2, 0, 64);
+
+  std::vector<std::pair<std::uint64_t, std::uint64_t>> expected;  // empty
+
+  // batch inserts, including keys that make the tree grow
+  std::vector<std::uint64_t> order = ::permutation(256);
+  for (std::uint64_t i : order) {
+    t1.insert(i);
+  }
+  t2.insert(order);
+  EXPECT_EQ(t1.count(), t2.count());
+  EXPECT_EQ(t1.rootValue(), t2.rootValue());
+  EXPECT_TRUE(::diffAsExpected(t1, t2, expected));
+
+  // batch removals
+  order = ::permutation(256);
+  order.resize(100);
+  for (std::uint64_t i : order) {
+    t1.remove(i);
+  }
+  t2.remove(order);
+  EXPECT_EQ(156, t2.count());
+  EXPECT_EQ(t1.rootValue(), t2.rootValue());
+  EXPECT_TRUE(::diffAsExpected(t1, t2, expected));
+
+  // removing a key that is not present leaves the tree unchanged
+  order.resize(2);
+  EXPECT_THROW(t2.remove(order), std::invalid_argument);
+  EXPECT_EQ(156, t2.count());
+  EXPECT_EQ(t1.rootValue(), t2.rootValue());
+}
+
 TEST(MerkleTreeTest, test_diff_one_empty) {
   ::arangodb::containers::MerkleTree<::arangodb::containers::FnvHashProvider, 3>
       t1(2, 0, 64);
@@ -622,6 +622,40 @@ TEST(FutureTest, then_static_functions) {
   ASSERT_TRUE(f2.get() == 20);
 }
 
+TEST(FutureTest, then_on_ready_and_pending_futures) {
+  // continuations on ready futures are executed right away, continuations
+  // on pending futures when the promise is fulfilled. both must produce
+  // the same results
+  auto chain = [](Future<int>&& f) {
+    return std::move(f)
+        .thenValue([](int i) { return i + 1; })
+        .then([](Try<int>&& t) { return t.get() * 2; })
+        .thenValue([](int i) { return makeFuture(i + 3); })
+        .then([](Try<int>&& t) { return makeFuture(t.get() * 4); })
+        .thenValue([](int i) {
+          if (i > 100) {
+            throw eggs;
+          }
+          return i;
+        });
+  };
+
+  ASSERT_EQ(28, chain(makeFuture(1)).get());
+  EXPECT_THROW(chain(makeFuture(100)).get(), eggs_t);
+  EXPECT_THROW(chain(makeFuture<int>(eggs)).get(), eggs_t);
+
+  Promise<int> p;
+  auto f = chain(p.getFuture());
+  ASSERT_FALSE(f.isReady());
+  p.setValue(1);
+  ASSERT_EQ(28, f.get());
+
+  Promise<int> p2;
+  auto f2 = chain(p2.getFuture());
+  p2.setException(eggs);
+  EXPECT_THROW(f2.get(), eggs_t);
+}
+
 TEST(FutureTest, get) {
   auto f = makeFuture(std::make_unique<int>(42));
   auto up = std::move(f).get();
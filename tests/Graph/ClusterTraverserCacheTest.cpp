@@ -592,6 +592,38 @@ TEST_F(RefactoredClusterTraverserCacheTest, cache_same_edge_twice_after_clear) {
   }
 }
 
+TEST_F(RefactoredClusterTraverserCacheTest, datalake_copies_slices) {
+  auto& lake = cache().datalake();
+  auto resourceBefore = _monitor.current();
+
+  VPackSlice small;
+  VPackSlice large;
+  {
+    auto data = VPackParser::fromJson(R"({"_key":"123", "value":123})");
+    small = lake.copy(data->slice());
+    EXPECT_NE(small.start(), data->slice().start());
+    EXPECT_TRUE(basics::VelocyPackHelper::equal(small, data->slice(), true));
+
+    // a slice larger than a chunk
+    VPackBuilder builder;
+    builder.add(VPackValue(std::string(100000, 'x')));
+    large = lake.copy(builder.slice());
+    EXPECT_TRUE(basics::VelocyPackHelper::equal(large, builder.slice(), true));
+  }
+  EXPECT_LT(resourceBefore + 100000, _monitor.current())
+      << "Did not increase memory usage.";
+
+  // the copies are still valid after the original data is gone
+  EXPECT_EQ(small.get("value").getNumber<int>(), 123);
+  EXPECT_EQ(large.stringView(), std::string(100000, 'x'));
+  // copies do not count as retained buffers
+  EXPECT_EQ(lake.numEntries(), 0U);
+
+  lake.clear();
+  EXPECT_EQ(resourceBefore, _monitor.current())
+      << "Did not reset resource monitor.";
+}
+
 }  // namespace cluster_traverser_cache_test
 }  // namespace tests
 }  // namespace arangodb
@@ -171,8 +171,10 @@ class DFSFinderTest
     return GetParam();
   }
 
-  auto pathFinder(size_t minDepth, size_t maxDepth) -> DFSFinder {
-    arangodb::graph::OneSidedEnumeratorOptions options{minDepth, maxDepth};
+  auto pathFinder(size_t minDepth, size_t maxDepth,
+                  bool collectDepthStats = false) -> DFSFinder {
+    arangodb::graph::OneSidedEnumeratorOptions options{minDepth, maxDepth,
+                                                       collectDepthStats};
     PathValidatorOptions validatorOpts{&_tmpVar, _expressionContext};
     return DFSFinder(
         {*_query.get(),
@@ -769,6 +771,96 @@ TEST_P(DFSFinderTest, triangle_loop_skip) {
   }
 }
 
+TEST_P(DFSFinderTest, path_shared_prefixes) {
+  VPackBuilder result;
+  auto finder = pathFinder(0, 3);
+  auto source = vId(1);
+  std::vector<bool> emittedPaths;
+
+  finder.reset(toHashedStringRef(source));
+
+  // every path of the chain extends the previous one by one vertex
+  uint64_t previousId = 0;
+  for (size_t depth = 0; depth <= 3; ++depth) {
+    result.clear();
+    auto hasPath = finder.getNextPath();
+    ASSERT_TRUE(hasPath);
+    hasPath->toSharedPrefixVelocyPack(result, emittedPaths);
+
+    auto path = result.slice();
+    ASSERT_TRUE(path.isObject());
+    ASSERT_TRUE(path.get("id").isNumber());
+    if (depth == 0) {
+      EXPECT_TRUE(path.get("parent").isNull());
+      EXPECT_EQ(verticesToString(path), "1");
+      EXPECT_EQ(edgesToString(path), "");
+    } else {
+      ASSERT_TRUE(path.get("parent").isNumber());
+      EXPECT_EQ(path.get("parent").getNumber<uint64_t>(), previousId);
+      EXPECT_EQ(verticesToString(path), std::to_string(depth + 1));
+      EXPECT_EQ(path.get(StaticStrings::GraphQueryEdges).length(), 1);
+    }
+    previousId = path.get("id").getNumber<uint64_t>();
+  }
+  EXPECT_FALSE(finder.getNextPath());
+  EXPECT_TRUE(finder.isDone());
+
+  // prefixes that were not produced cannot be referenced
+  auto diamondFinder = pathFinder(2, 2);
+  diamondFinder.reset(toHashedStringRef(vId(5)));
+  emittedPaths.clear();
+  for (size_t i = 0; i < 3; ++i) {
+    result.clear();
+    auto hasPath = diamondFinder.getNextPath();
+    ASSERT_TRUE(hasPath);
+    hasPath->toSharedPrefixVelocyPack(result, emittedPaths);
+
+    pathStructureValid(result.slice(), 2);
+    EXPECT_TRUE(result.slice().get("parent").isNull());
+  }
+  EXPECT_FALSE(diamondFinder.getNextPath());
+}
+
+TEST_P(DFSFinderTest, path_diamond_depth_stats) {
+  auto finder = pathFinder(2, 2, true);
+  finder.reset(toHashedStringRef(vId(5)));
+
+  size_t paths = 0;
+  while (finder.getNextPath() != nullptr) {
+    ++paths;
+  }
+  EXPECT_EQ(paths, 3U);
+
+  aql::TraversalStats stats = finder.stealStats();
+  auto const& depths = stats.getDepths();
+  ASSERT_EQ(depths.size(), 3U);
+  // 5 expands to 6, 7 and 8, which each expand to 9
+  EXPECT_EQ(depths[0].vertices, 1U);
+  EXPECT_EQ(depths[0].edgesAccepted, 3U);
+  EXPECT_EQ(depths[1].vertices, 3U);
+  EXPECT_EQ(depths[1].edgesAccepted, 3U);
+  // vertices at the maximum depth are not expanded
+  EXPECT_EQ(depths[2].vertices, 3U);
+  EXPECT_EQ(depths[2].edgesAccepted, 0U);
+
+  uint64_t scanned = 0;
+  for (auto const& depth : depths) {
+    scanned += depth.edgesScanned;
+    EXPECT_GE(depth.providerTime, 0.0);
+    EXPECT_GE(depth.validatorTime, 0.0);
+    EXPECT_GE(depth.queueTime, 0.0);
+  }
+  // the per-depth numbers are part of the overall statistics
+  EXPECT_EQ(scanned, stats.getScannedIndex());
+
+  // nothing is collected if not requested
+  auto other = pathFinder(2, 2);
+  other.reset(toHashedStringRef(vId(5)));
+  while (other.getNextPath() != nullptr) {
+  }
+  EXPECT_TRUE(other.stealStats().getDepths().empty());
+}
+
 /* TODO: Add more tests
  * - path_depth_2_to_3
  * - many_neighbours_source
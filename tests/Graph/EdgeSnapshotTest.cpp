@@ -0,0 +1,121 @@
+////////////////////////////////////////////////////////////////////////////////
+/// DISCLAIMER
+///
+/// Copyright 2014-2023 ArangoDB GmbH, Cologne, Germany
+/// Copyright 2004-2014 triAGENS GmbH, Cologne, Germany
+///
+/// Licensed under the Apache License, Version 2.0 (the "License");
+/// you may not use this file except in compliance with the License.
+/// You may obtain a copy of the License at
+///
+///     http://www.apache.org/licenses/LICENSE-2.0
+///
+/// Unless required by applicable law or agreed to in writing, software
+/// distributed under the License is distributed on an "AS IS" BASIS,
+/// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+/// See the License for the specific language governing permissions and
+/// limitations under the License.
+///
+/// Copyright holder is ArangoDB GmbH, Cologne, Germany
+///
+/// @author Jan Steemann
+////////////////////////////////////////////////////////////////////////////////
+
+#include "Graph/Cache/EdgeSnapshot.h"
+
+#include "gtest/gtest.h"
+
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace arangodb;
+using namespace arangodb::graph;
+
+namespace arangodb {
+namespace tests {
+namespace edge_snapshot_test {
+
+using Neighbors = std::vector<std::pair<std::uint64_t, std::string>>;
+
+Neighbors neighbors(EdgeSnapshot const& snapshot, std::string_view vertex) {
+  Neighbors result;
+  snapshot.forEachEdge(
+      vertex, [&](LocalDocumentId id, velocypack::Slice other) {
+        EXPECT_TRUE(other.isString());
+        result.emplace_back(id.id(), other.copyString());
+        return true;
+      });
+  return result;
+}
+
+std::shared_ptr<EdgeSnapshot const> buildSnapshot(
+    TRI_edge_direction_e direction) {
+  EdgeSnapshot::Builder builder(direction);
+  builder.add("v/1", "v/2", LocalDocumentId(1));
+  builder.add("v/2", "v/3", LocalDocumentId(2));
+  builder.add("v/1", "v/3", LocalDocumentId(3));
+  builder.add("v/3", "v/1", LocalDocumentId(4));
+  builder.add("v/1", "v/2", LocalDocumentId(5));
+  return builder.finish(RevisionId{42});
+}
+
+TEST(EdgeSnapshotTest, outbound_adjacency) {
+  auto snapshot = buildSnapshot(TRI_EDGE_OUT);
+  EXPECT_EQ(TRI_EDGE_OUT, snapshot->direction());
+  EXPECT_EQ(RevisionId{42}, snapshot->revision());
+  EXPECT_EQ(3, snapshot->numVertices());
+  EXPECT_EQ(5, snapshot->numEdges());
+  EXPECT_LT(0, snapshot->memoryUsage());
+
+  // edges of a vertex keep their insertion order
+  EXPECT_EQ((Neighbors{{1, "v/2"}, {3, "v/3"}, {5, "v/2"}}),
+            neighbors(*snapshot, "v/1"));
+  EXPECT_EQ((Neighbors{{2, "v/3"}}), neighbors(*snapshot, "v/2"));
+  EXPECT_EQ((Neighbors{{4, "v/1"}}), neighbors(*snapshot, "v/3"));
+  EXPECT_TRUE(neighbors(*snapshot, "v/4").empty());
+}
+
+TEST(EdgeSnapshotTest, inbound_adjacency) {
+  auto snapshot = buildSnapshot(TRI_EDGE_IN);
+  EXPECT_EQ(3, snapshot->numVertices());
+  EXPECT_EQ(5, snapshot->numEdges());
+
+  EXPECT_EQ((Neighbors{{4, "v/3"}}), neighbors(*snapshot, "v/1"));
+  EXPECT_EQ((Neighbors{{1, "v/1"}, {5, "v/1"}}), neighbors(*snapshot, "v/2"));
+  EXPECT_EQ((Neighbors{{2, "v/2"}, {3, "v/1"}}), neighbors(*snapshot, "v/3"));
+}
+
+TEST(EdgeSnapshotTest, vertices_without_outgoing_edges) {
+  EdgeSnapshot::Builder builder(TRI_EDGE_OUT);
+  builder.add("a/1", "b/1", LocalDocumentId(7));
+  auto snapshot = builder.finish(RevisionId{1});
+
+  EXPECT_EQ(2, snapshot->numVertices());
+  EXPECT_EQ((Neighbors{{7, "b/1"}}), neighbors(*snapshot, "a/1"));
+  EXPECT_TRUE(neighbors(*snapshot, "b/1").empty());
+}
+
+TEST(EdgeSnapshotTest, iteration_can_be_stopped) {
+  auto snapshot = buildSnapshot(TRI_EDGE_OUT);
+
+  std::size_t calls = 0;
+  snapshot->forEachEdge("v/1", [&](LocalDocumentId, velocypack::Slice) {
+    ++calls;
+    return calls < 2;
+  });
+  EXPECT_EQ(2, calls);
+}
+
+TEST(EdgeSnapshotTest, empty_snapshot) {
+  EdgeSnapshot::Builder builder(TRI_EDGE_OUT);
+  auto snapshot = builder.finish(RevisionId{1});
+
+  EXPECT_EQ(0, snapshot->numVertices());
+  EXPECT_EQ(0, snapshot->numEdges());
+  EXPECT_TRUE(neighbors(*snapshot, "a/1").empty());
+}
+
+}  // namespace edge_snapshot_test
+}  // namespace tests
+}  // namespace arangodb
@@ -0,0 +1,141 @@
+////////////////////////////////////////////////////////////////////////////////
+/// DISCLAIMER
+///
+/// Copyright 2014-2023 ArangoDB GmbH, Cologne, Germany
+/// Copyright 2004-2014 triAGENS GmbH, Cologne, Germany
+///
+/// Licensed under the Apache License, Version 2.0 (the "License");
+/// you may not use this file except in compliance with the License.
+/// You may obtain a copy of the License at
+///
+///     http://www.apache.org/licenses/LICENSE-2.0
+///
+/// Unless required by applicable law or agreed to in writing, software
+/// distributed under the License is distributed on an "AS IS" BASIS,
+/// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+/// See the License for the specific language governing permissions and
+/// limitations under the License.
+///
+/// Copyright holder is ArangoDB GmbH, Cologne, Germany
+///
+/// @author Jan Steemann
+////////////////////////////////////////////////////////////////////////////////
+
+#include "Geo/GeoParams.h"
+#include "Graph/Providers/GeoDistanceHeuristic.h"
+
+#include "gtest/gtest.h"
+
+#include <velocypack/Builder.h>
+#include <velocypack/Parser.h>
+
+#include <optional>
+#include <string_view>
+#include <vector>
+
+using namespace arangodb;
+using namespace arangodb::graph;
+
+namespace arangodb {
+namespace tests {
+namespace geo_distance_heuristic_test {
+
+double meters(S2LatLng const& lhs, S2LatLng const& rhs) {
+  return lhs.GetDistance(rhs).radians() * geo::kEarthRadiusInMeters;
+}
+
+std::optional<S2LatLng> coordinates(GeoDistanceHeuristic const& heuristic,
+                                    std::string_view json) {
+  auto builder = velocypack::Parser::fromJson(json.data(), json.size());
+  return heuristic.coordinates(builder->slice());
+}
+
+TEST(GeoDistanceHeuristicTest, extracts_coordinates) {
+  GeoDistanceHeuristic heuristic("location", 1.0, false);
+
+  auto latLng = coordinates(heuristic, R"({"location":[6.95, 50.94]})");
+  ASSERT_TRUE(latLng.has_value());
+  EXPECT_NEAR(50.94, latLng->lat().degrees(), 1e-9);
+  EXPECT_NEAR(6.95, latLng->lng().degrees(), 1e-9);
+
+  latLng = coordinates(
+      heuristic,
+      R"({"location":{"type":"Point","coordinates":[6.95, 50.94]}})");
+  ASSERT_TRUE(latLng.has_value());
+  EXPECT_NEAR(50.94, latLng->lat().degrees(), 1e-9);
+  EXPECT_NEAR(6.95, latLng->lng().degrees(), 1e-9);
+
+  EXPECT_FALSE(coordinates(heuristic, R"({"location":[6.95]})").has_value());
+  EXPECT_FALSE(
+      coordinates(heuristic, R"({"location":["a", "b"]})").has_value());
+  EXPECT_FALSE(coordinates(heuristic, R"({"location":[0, 95]})").has_value());
+  EXPECT_FALSE(
+      coordinates(heuristic, R"({"other":[6.95, 50.94]})").has_value());
+  EXPECT_FALSE(coordinates(heuristic, "null").has_value());
+}
+
+TEST(GeoDistanceHeuristicTest, is_inactive_without_endpoints) {
+  GeoDistanceHeuristic heuristic("location", 1.0, false);
+  auto vertex = S2LatLng::FromDegrees(50.94, 6.95);
+  EXPECT_FALSE(heuristic.isActive());
+  EXPECT_EQ(0.0, heuristic.potential(vertex));
+
+  heuristic.setEndpoints(vertex, std::nullopt);
+  EXPECT_FALSE(heuristic.isActive());
+  EXPECT_EQ(0.0, heuristic.potential(vertex));
+
+  heuristic.setEndpoints(vertex, vertex);
+  EXPECT_TRUE(heuristic.isActive());
+  EXPECT_EQ(0.0, heuristic.potential(std::nullopt));
+}
+
+TEST(GeoDistanceHeuristicTest, potentials_of_both_sides_add_up) {
+  auto source = S2LatLng::FromDegrees(50.94, 6.95);
+  auto target = S2LatLng::FromDegrees(52.52, 13.40);
+  double factor = 0.5;
+
+  GeoDistanceHeuristic forward("location", factor, false);
+  GeoDistanceHeuristic backward("location", factor, true);
+  forward.setEndpoints(source, target);
+  backward.setEndpoints(source, target);
+
+  // the start steps of both searches together carry the estimated weight
+  // of the whole path
+  EXPECT_NEAR(factor * meters(source, target),
+              forward.potential(source) + backward.potential(target), 1e-6);
+
+  // at every meeting point the potentials cancel out each other
+  for (auto vertex : {S2LatLng::FromDegrees(51.5, 10.0),
+                      S2LatLng::FromDegrees(48.14, 11.58), source, target}) {
+    EXPECT_NEAR(0.0, forward.potential(vertex) + backward.potential(vertex),
+                1e-6);
+  }
+}
+
+TEST(GeoDistanceHeuristicTest, reduced_edge_weights_are_not_negative) {
+  auto source = S2LatLng::FromDegrees(50.94, 6.95);
+  auto target = S2LatLng::FromDegrees(52.52, 13.40);
+  std::vector<S2LatLng> vertices{
+      source, S2LatLng::FromDegrees(51.5, 10.0),
+      S2LatLng::FromDegrees(53.55, 9.99), S2LatLng::FromDegrees(48.14, 11.58),
+      target};
+  double factor = 2.0;
+
+  for (bool backward : {false, true}) {
+    GeoDistanceHeuristic heuristic("location", factor, backward);
+    heuristic.setEndpoints(source, target);
+    for (auto const& from : vertices) {
+      for (auto const& to : vertices) {
+        // the smallest admissible weight of an edge between both vertices
+        double weight = factor * meters(from, to);
+        EXPECT_LE(
+            -1e-6,
+            weight - heuristic.potential(from) + heuristic.potential(to));
+      }
+    }
+  }
+}
+
+}  // namespace geo_distance_heuristic_test
+}  // namespace tests
+}  // namespace arangodb
@@ -31,7 +31,10 @@
 #include "Graph/Providers/SingleServerProvider.h"
 #include "Graph/Steps/SingleServerProviderStep.h"
 
+#include <algorithm>
+#include <string>
 #include <unordered_set>
+#include <vector>
 
 using namespace arangodb;
 using namespace arangodb::tests;
@@ -81,7 +84,7 @@ class SingleServerProviderTest : public ::testing::Test {
   SingleServerProviderTest() {}
   ~SingleServerProviderTest() {}
 
-  auto makeProvider(MockGraph const& graph)
+  auto makeProvider(MockGraph const& graph, DegreeLimits limits = {})
       -> arangodb::graph::SingleServerProvider<SingleServerProviderStep> {
     // Setup code for each provider type
     s = std::make_unique<GraphTestSetup>();
@@ -119,9 +122,27 @@ class SingleServerProviderTest : public ::testing::Test {
             std::unordered_map<uint64_t, std::vector<IndexAccessor>>{}),
         *_expressionContext.get(), {}, _emptyShardMap, _vertexProjections,
         _edgeProjections, /*produceVertices*/ true);
+    opts.setDegreeLimits(limits);
     return {*query.get(), std::move(opts), _resourceMonitor};
   }
 
+  std::vector<std::string> expandStart(
+      MockGraph const& graph,
+      arangodb::graph::SingleServerProvider<SingleServerProviderStep>&
+          testee) {
+    auto startVertex = graph.vertexToId(0);
+    HashedStringRef hashedStart{startVertex.c_str(),
+                                static_cast<uint32_t>(startVertex.length())};
+    Step s = testee.startVertex(hashedStart);
+
+    std::vector<std::string> results;
+    testee.expand(s, 0, [&](Step next) {
+      results.push_back(next.getVertex().getID().toString());
+    });
+    std::sort(results.begin(), results.end());
+    return results;
+  }
+
   /*
    * generates a condition #TMP._key == '<toMatch>'
    */
@@ -166,6 +187,50 @@ TEST_F(SingleServerProviderTest, it_can_provide_edges) {
   }
 }
 
+TEST_F(SingleServerProviderTest, it_can_cap_the_edges_per_vertex) {
+  MockGraph g;
+  g.addEdge(0, 1, 2);
+  g.addEdge(0, 2, 3);
+  g.addEdge(0, 3, 1);
+  auto testee = makeProvider(g, DegreeLimits{2, false, 0});
+
+  auto results = expandStart(g, testee);
+  ASSERT_EQ(results.size(), 2U);
+  EXPECT_TRUE(std::is_sorted(results.begin(), results.end()));
+  EXPECT_NE(results.at(0), results.at(1));
+}
+
+TEST_F(SingleServerProviderTest, it_can_sample_the_edges_per_vertex) {
+  MockGraph g;
+  g.addEdge(0, 1, 2);
+  g.addEdge(0, 2, 3);
+  g.addEdge(0, 3, 1);
+  auto testee = makeProvider(g, DegreeLimits{1, true, 0});
+
+  auto results = expandStart(g, testee);
+  ASSERT_EQ(results.size(), 1U);
+  EXPECT_TRUE(results.at(0) == "v/1" || results.at(0) == "v/2" ||
+              results.at(0) == "v/3");
+}
+
+TEST_F(SingleServerProviderTest, it_skips_vertices_above_the_max_degree) {
+  MockGraph g;
+  g.addEdge(0, 1, 2);
+  g.addEdge(0, 2, 3);
+  auto testee = makeProvider(g, DegreeLimits{0, false, 1});
+
+  EXPECT_TRUE(expandStart(g, testee).empty());
+}
+
+TEST_F(SingleServerProviderTest, it_expands_vertices_up_to_the_max_degree) {
+  MockGraph g;
+  g.addEdge(0, 1, 2);
+  g.addEdge(0, 2, 3);
+  auto testee = makeProvider(g, DegreeLimits{0, false, 2});
+
+  EXPECT_EQ(expandStart(g, testee), (std::vector<std::string>{"v/1", "v/2"}));
+}
+
 }  // namespace single_server_provider_test
 }  // namespace tests
 }  // namespace arangodb
@@ -67,6 +67,7 @@
 #include "RestServer/DatabaseFeature.h"
 #include "RestServer/DatabasePathFeature.h"
 #include "RestServer/FlushFeature.h"
+#include "Metrics/Counter.h"
 #include "Metrics/MetricsFeature.h"
 #include "RestServer/QueryRegistryFeature.h"
 #include "RestServer/SystemDatabaseFeature.h"
@@ -600,6 +601,37 @@ TEST_F(IResearchAnalyzerFeatureTest, test_emplace_valid) {
   EXPECT_EQ(arangodb::iresearch::Features{}, pool->features());
 }
 
+TEST_F(IResearchAnalyzerFeatureTest, test_pool_reuse_metrics) {
+  arangodb::iresearch::IResearchAnalyzerFeature feature(server.server());
+  arangodb::iresearch::IResearchAnalyzerFeature::EmplaceResult result;
+  ASSERT_TRUE(feature
+                  .emplace(result, analyzerName(), "TestAnalyzer",
+                           VPackParser::fromJson("\"abcd\"")->slice())
+                  .ok());
+  auto pool = feature.get(analyzerName(),
+                          arangodb::QueryAnalyzerRevisions::QUERY_LATEST);
+  ASSERT_NE(pool, nullptr);
+
+  arangodb::metrics::Counter created{0, "created", "", ""};
+  arangodb::metrics::Counter reused{0, "reused", "", ""};
+  arangodb::iresearch::AnalyzerPool::setMetrics(&created, &reused);
+  {
+    // the instance created while validating the definition is reused
+    auto first = pool->get();
+    ASSERT_NE(nullptr, first);
+    // no idle instance left
+    auto second = pool->get();
+    ASSERT_NE(nullptr, second);
+  }
+  // both instances are kept by the pool
+  EXPECT_NE(nullptr, pool->get());
+  EXPECT_NE(nullptr, pool->get());
+  arangodb::iresearch::AnalyzerPool::setMetrics(nullptr, nullptr);
+
+  EXPECT_EQ(1, created.load());
+  EXPECT_EQ(3, reused.load());
+}
+
 TEST_F(IResearchAnalyzerFeatureTest, test_emplace_duplicate_valid) {
   // add duplicate valid (same name+type+properties)
   arangodb::iresearch::IResearchAnalyzerFeature feature(server.server());
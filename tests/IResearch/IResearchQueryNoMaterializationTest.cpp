@@ -982,6 +982,40 @@ TEST_P(QueryNoMaterialization, matchSortButNotEnoughAttributes) {
   EXPECT_TRUE(found);
 }
 
+TEST_P(QueryNoMaterialization, facetCounts) {
+  auto const queryString =
+      std::string("FOR d IN ") + viewName +
+      " COLLECT e = d.exist WITH COUNT INTO n SORT e RETURN [e, n]";
+
+  EXPECT_TRUE(arangodb::tests::assertRules(
+      vocbase(), queryString,
+      {arangodb::aql::OptimizerRule::handleArangoSearchViewsRule}));
+
+  auto query = arangodb::aql::Query::create(
+      arangodb::transaction::StandaloneContext::Create(vocbase()),
+      arangodb::aql::QueryString(queryString), nullptr);
+  auto const res = query->explain();
+  ASSERT_TRUE(res.data);
+  auto const explanation = res.data->slice();
+  auto found = false;
+  for (auto const node :
+       arangodb::velocypack::ArrayIterator(explanation.get("nodes"))) {
+    if (node.get("type").isEqualString("EnumerateViewNode")) {
+      // the view node counts the documents per value
+      EXPECT_TRUE(node.hasKey("outFacetCount"));
+      found = true;
+      break;
+    }
+  }
+  EXPECT_TRUE(found);
+
+  auto queryResult = arangodb::tests::executeQuery(vocbase(), queryString);
+  ASSERT_TRUE(queryResult.result.ok());
+  auto const expected = arangodb::velocypack::Parser::fromJson(
+      R"([[null, 4], ["ex0", 1], ["ex2", 1], ["ex_10", 1], ["ex_12", 1]])");
+  EXPECT_EQUAL_SLICES(expected->slice(), queryResult.data->slice());
+}
+
 INSTANTIATE_TEST_CASE_P(
     IResearch, QueryNoMaterialization,
     testing::Values(std::tuple{ViewType::kArangoSearch,
@@ -22,6 +22,7 @@
 /// @author Vasiliy Nabatchikov
 ////////////////////////////////////////////////////////////////////////////////
 
+#include <absl/strings/str_cat.h>
 #include <absl/strings/str_replace.h>
 
 #include <velocypack/Iterator.h>
@@ -366,6 +367,23 @@ class QueryScorer : public QueryTest {
       EXPECT_TRUE(expectedDocs.empty());
     }
 
+    // evaluating segments in parallel must not change the top-k scores
+    {
+      auto const queryTemplate = [](std::string_view options) {
+        return absl::StrCat(
+            "FOR d IN testView SEARCH IN_RANGE(d.name, 'A', 'Z', true, true) ",
+            options, " SORT BM25(d) DESC LIMIT 5 RETURN BM25(d)");
+      };
+      auto expected =
+          arangodb::tests::executeQuery(_vocbase, queryTemplate(""));
+      ASSERT_TRUE(expected.result.ok());
+      auto actual = arangodb::tests::executeQuery(
+          _vocbase, queryTemplate("OPTIONS { parallelism: 4 }"));
+      ASSERT_TRUE(actual.result.ok());
+      EXPECT_TRUE(arangodb::basics::VelocyPackHelper::equal(
+          expected.data->slice(), actual.data->slice(), true));
+    }
+
     // ensure subqueries outstide a loop work fine
     {
       std::string const query =
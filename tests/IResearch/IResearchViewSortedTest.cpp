@@ -28,6 +28,7 @@
 #include "analysis/analyzers.hpp"
 #include "analysis/token_attributes.hpp"
 #include <filesystem>
+#include <set>
 
 #include <velocypack/Iterator.h>
 
@@ -439,6 +440,43 @@ TEST_P(IResearchViewSortedTest, SingleField) {
     }
     EXPECT_EQ(expectedDoc, expectedDocs.end());
   }
+
+  // return range on the primary sort field, segments outside of the range
+  // are skipped
+  {
+    std::string const queries[]{
+        "FOR d IN testView SEARCH d.seq >= 3 AND d.seq < 7 RETURN d.seq",
+        "FOR d IN testView SEARCH 7 > d.seq AND d.seq >= 3 AND d.seq > 1 "
+        "RETURN d.seq",
+        "FOR d IN testView SEARCH d.seq IN 3..6 RETURN d.seq",
+    };
+
+    for (auto const& query : queries) {
+      SCOPED_TRACE(query);
+      auto queryResult = arangodb::tests::executeQuery(vocbase, query);
+      ASSERT_TRUE(queryResult.result.ok());
+
+      auto result = queryResult.data->slice();
+      ASSERT_TRUE(result.isArray());
+
+      std::set<int64_t> actual;
+      for (auto const seq : arangodb::velocypack::ArrayIterator(result)) {
+        ASSERT_TRUE(seq.isNumber());
+        actual.emplace(seq.getNumber<int64_t>());
+      }
+      EXPECT_EQ((std::set<int64_t>{3, 4, 5, 6}), actual);
+    }
+  }
+
+  // range outside of all segments
+  {
+    auto queryResult = arangodb::tests::executeQuery(
+        vocbase, "FOR d IN testView SEARCH d.seq > 100000 RETURN d");
+    ASSERT_TRUE(queryResult.result.ok());
+    auto result = queryResult.data->slice();
+    ASSERT_TRUE(result.isArray());
+    EXPECT_EQ(0, result.length());
+  }
 }
 
 TEST_P(IResearchViewSortedTest, MultipleFields) {
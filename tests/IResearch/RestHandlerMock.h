@@ -62,6 +62,7 @@ struct GeneralResponseMock : public arangodb::GeneralResponse {
   virtual bool isResponseEmpty() const noexcept override {
     return _payload.isEmpty();
   }
+  virtual std::size_t memoryUsage() const noexcept override { return 0; }
 
   GeneralResponseMock(arangodb::ResponseCode code = arangodb::ResponseCode::OK);
   virtual void addPayload(
@@ -105,6 +105,40 @@ TEST_F(VPackLoadInspectorTest, load_object) {
   EXPECT_EQ("foobar", d.s);
 }
 
+TEST_F(VPackLoadInspectorTest, load_object_with_attributes_in_any_order) {
+  builder.openObject();
+  builder.add("s", VPackValue("foobar"));
+  builder.add("b", VPackValue(true));
+  builder.add("i", VPackValue(42));
+  builder.add("d", VPackValue(123.456));
+  builder.close();
+  VPackLoadInspector inspector{builder};
+
+  Dummy d;
+  auto result = inspector.apply(d);
+  ASSERT_TRUE(result.ok());
+  EXPECT_EQ(42, d.i);
+  EXPECT_EQ(123.456, d.d);
+  EXPECT_EQ(true, d.b);
+  EXPECT_EQ("foobar", d.s);
+}
+
+TEST_F(VPackLoadInspectorTest, load_object_with_duplicate_attributes) {
+  builder.openObject();
+  builder.add("i", VPackValue(42));
+  builder.add("d", VPackValue(123.456));
+  builder.add("b", VPackValue(true));
+  builder.add("s", VPackValue("foobar"));
+  builder.add("i", VPackValue(43));
+  builder.close();
+  VPackLoadInspector inspector{builder};
+
+  Dummy d;
+  auto result = inspector.apply(d);
+  ASSERT_TRUE(result.ok()) << "Error: " << result.error();
+  EXPECT_EQ(42, d.i);
+}
+
 TEST_F(VPackLoadInspectorTest, load_nested_object) {
   builder.openObject();
   builder.add(VPackValue("dummy"));
@@ -0,0 +1,57 @@
+////////////////////////////////////////////////////////////////////////////////
+/// DISCLAIMER
+///
+/// Copyright 2014-2023 ArangoDB GmbH, Cologne, Germany
+/// Copyright 2004-2014 triAGENS GmbH, Cologne, Germany
+///
+/// Licensed under the Apache License, Version 2.0 (the "License");
+/// you may not use this file except in compliance with the License.
+/// You may obtain a copy of the License at
+///
+///     http://www.apache.org/licenses/LICENSE-2.0
+///
+/// Unless required by applicable law or agreed to in writing, software
+/// distributed under the License is distributed on an "AS IS" BASIS,
+/// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+/// See the License for the specific language governing permissions and
+/// limitations under the License.
+///
+/// Copyright holder is ArangoDB GmbH, Cologne, Germany
+///
+/// @author Jan Steemann
+////////////////////////////////////////////////////////////////////////////////
+
+#include "gtest/gtest.h"
+
+#include "Logger/LoggerStream.h"
+
+#include <iomanip>
+#include <string>
+
+using namespace arangodb;
+
+TEST(LoggerStreamTest, short_messages_use_inline_buffer) {
+  LoggerStreamBuffer buffer;
+  std::ostream out(&buffer);
+  out << "abc" << 42 << ' ' << 1.5;
+  EXPECT_EQ("abc42 1.5", buffer.view());
+}
+
+TEST(LoggerStreamTest, long_messages_spill_over) {
+  LoggerStreamBuffer buffer;
+  std::ostream out(&buffer);
+  std::string expected;
+  for (int i = 0; i < 1000; ++i) {
+    // mix single characters and strings to use both overflow paths
+    out << 'x' << std::to_string(i);
+    expected.push_back('x');
+    expected.append(std::to_string(i));
+  }
+  EXPECT_LT(LoggerStreamBuffer::kInlineSize, expected.size());
+  EXPECT_EQ(expected, buffer.view());
+
+  std::string large(10 * LoggerStreamBuffer::kInlineSize, 'y');
+  out << large;
+  expected.append(large);
+  EXPECT_EQ(expected, buffer.view());
+}
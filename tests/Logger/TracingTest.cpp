@@ -0,0 +1,98 @@
+////////////////////////////////////////////////////////////////////////////////
+/// DISCLAIMER
+///
+/// Copyright 2014-2023 ArangoDB GmbH, Cologne, Germany
+/// Copyright 2004-2014 triAGENS GmbH, Cologne, Germany
+///
+/// Licensed under the Apache License, Version 2.0 (the "License");
+/// you may not use this file except in compliance with the License.
+/// You may obtain a copy of the License at
+///
+///     http://www.apache.org/licenses/LICENSE-2.0
+///
+/// Unless required by applicable law or agreed to in writing, software
+/// distributed under the License is distributed on an "AS IS" BASIS,
+/// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+/// See the License for the specific language governing permissions and
+/// limitations under the License.
+///
+/// Copyright holder is ArangoDB GmbH, Cologne, Germany
+///
+/// @author Jan Steemann
+////////////////////////////////////////////////////////////////////////////////
+
+#include "gtest/gtest.h"
+
+#include "Logger/Tracing.h"
+
+using namespace arangodb;
+using namespace arangodb::tracing;
+
+TEST(TracingTest, traceparent_roundtrip) {
+  SpanContext context;
+  context.traceIdHigh = 0x4bf92f3577b34da6ULL;
+  context.traceIdLow = 0xa3ce929d0e0e4736ULL;
+  context.spanId = 0x00f067aa0ba902b7ULL;
+  context.sampled = true;
+
+  std::string value = context.toTraceParent();
+  EXPECT_EQ("00-4bf92f3577b34da6a3ce929d0e0e4736-00f067aa0ba902b7-01", value);
+
+  auto parsed = SpanContext::fromTraceParent(value);
+  ASSERT_TRUE(parsed.has_value());
+  EXPECT_EQ(context.traceIdHigh, parsed->traceIdHigh);
+  EXPECT_EQ(context.traceIdLow, parsed->traceIdLow);
+  EXPECT_EQ(context.spanId, parsed->spanId);
+  EXPECT_TRUE(parsed->sampled);
+
+  context.sampled = false;
+  parsed = SpanContext::fromTraceParent(context.toTraceParent());
+  ASSERT_TRUE(parsed.has_value());
+  EXPECT_FALSE(parsed->sampled);
+}
+
+TEST(TracingTest, invalid_traceparents_are_rejected) {
+  for (std::string_view value : {
+           "",
+           "00-4bf92f3577b34da6a3ce929d0e0e4736-00f067aa0ba902b7",
+           "01-4bf92f3577b34da6a3ce929d0e0e4736-00f067aa0ba902b7-01",
+           "00-4BF92F3577B34DA6A3CE929D0E0E4736-00f067aa0ba902b7-01",
+           "00-00000000000000000000000000000000-00f067aa0ba902b7-01",
+           "00-4bf92f3577b34da6a3ce929d0e0e4736-0000000000000000-01",
+           "00-4bf92f3577b34da6a3ce929d0e0e4736x00f067aa0ba902b7-01",
+           "00-4bf92f3577b34da6a3ce929d0e0e4736-00f067aa0ba902b7-0g",
+       }) {
+    EXPECT_FALSE(SpanContext::fromTraceParent(value).has_value()) << value;
+  }
+}
+
+TEST(TracingTest, spans_are_noops_if_tracing_is_off) {
+  ASSERT_FALSE(Tracer::enabled());
+
+  Span span("test", SpanKind::kInternal);
+  EXPECT_FALSE(span.isRecording());
+  EXPECT_FALSE(span.context().valid());
+  span.setAttribute("key", "value");
+  span.end();
+}
+
+TEST(TracingTest, context_scope_restores_previous_context) {
+  EXPECT_FALSE(currentContext().valid());
+
+  SpanContext outer;
+  outer.traceIdLow = 1;
+  outer.spanId = 2;
+  {
+    ContextScope outerScope(outer);
+    EXPECT_EQ(2u, currentContext().spanId);
+
+    SpanContext inner = outer;
+    inner.spanId = 3;
+    {
+      ContextScope innerScope(inner);
+      EXPECT_EQ(3u, currentContext().spanId);
+    }
+    EXPECT_EQ(2u, currentContext().spanId);
+  }
+  EXPECT_FALSE(currentContext().valid());
+}
@@ -111,6 +111,8 @@ TEST(MetricsTest, test_histogram_concurrency_same) {
   ASSERT_EQ(h.load(1), 0);
   ASSERT_EQ(h.load(2), 0);
   ASSERT_EQ(h.load(3), 0);
+  // the sum is accumulated per shard and added up when read
+  ASSERT_EQ(h.sum(), static_cast<int>(::numThreads * ::numOpsPerThread));
 }
 
 TEST(MetricsTest, test_histogram_concurrency_distributed) {
@@ -59,6 +59,9 @@ void FakeScheduler::trackEndOngoingLowPriorityTask() noexcept {
 void FakeScheduler::trackQueueTimeViolation() {
   ADB_PROD_ASSERT(false) << "not implemented";
 }
+bool FakeScheduler::admitRequest(RequestLane) noexcept { return true; }
+void FakeScheduler::releaseRequest(RequestLane) noexcept {}
+void FakeScheduler::trackRequestQueueTime(RequestLane, double) noexcept {}
 void FakeScheduler::trackQueueItemSize(std::int64_t) noexcept {
   ADB_PROD_ASSERT(false) << "not implemented";
 }
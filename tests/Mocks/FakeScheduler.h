@@ -37,6 +37,10 @@ struct FakeScheduler : Scheduler {
   void trackBeginOngoingLowPriorityTask() noexcept override;
   void trackEndOngoingLowPriorityTask() noexcept override;
   void trackQueueTimeViolation() override;
+  bool admitRequest(RequestLane lane) noexcept override;
+  void releaseRequest(RequestLane lane) noexcept override;
+  void trackRequestQueueTime(RequestLane lane,
+                             double queueTime) noexcept override;
   void trackQueueItemSize(std::int64_t) noexcept override;
   uint64_t getLastLowPriorityDequeueTime() const noexcept override;
   void setLastLowPriorityDequeueTime(uint64_t time) noexcept override;
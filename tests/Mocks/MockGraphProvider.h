@@ -302,6 +302,7 @@ class MockGraphProvider {
   auto expand(Step const& from, size_t previous,
               std::function<void(Step)> callback) -> void;
   auto clear() -> void;
+  auto prepareHeuristic(VertexType source, VertexType target) -> void {}
 
   void addVertexToBuilder(Step::Vertex const& vertex,
                           arangodb::velocypack::Builder& builder);
@@ -29,6 +29,8 @@
 #include <fuerte/connection.h>
 #include <fuerte/requests.h>
 
+#include <vector>
+
 #include "Mocks/Servers.h"
 
 #include "Metrics/Gauge.h"
@@ -608,6 +610,37 @@ TEST_F(NetworkConnectionPoolTest, test_cancel_endpoint_all) {
   EXPECT_EQ(extractCurrentMetric(), 0ull);
 }
 
+TEST_F(NetworkConnectionPoolTest, http2_connections_are_shared) {
+  ConnectionPool::Config config(metrics());
+  config.numIOThreads = 1;
+  config.maxOpenConnections = 3;
+  config.idleConnectionMilli = 10000;
+  config.verifyHosts = false;
+  config.protocol = fuerte::ProtocolType::Http2;
+
+  ConnectionPool pool(config);
+
+  bool isFromPool;
+  std::vector<ConnectionPtr> leases;
+  leases.emplace_back(pool.leaseConnection("tcp://example.org:80", isFromPool));
+  EXPECT_FALSE(isFromPool);
+  // HTTP/2 connections are filled up with concurrent streams before a new
+  // connection is opened
+  for (size_t i = 1; i < 32; ++i) {
+    leases.emplace_back(
+        pool.leaseConnection("tcp://example.org:80", isFromPool));
+    EXPECT_TRUE(isFromPool);
+    EXPECT_EQ(leases.front().get(), leases.back().get());
+  }
+  EXPECT_EQ(pool.numOpenConnections(), 1);
+
+  leases.emplace_back(pool.leaseConnection("tcp://example.org:80", isFromPool));
+  EXPECT_FALSE(isFromPool);
+  EXPECT_NE(leases.front().get(), leases.back().get());
+  EXPECT_EQ(pool.numOpenConnections(), 2);
+  EXPECT_EQ(extractCurrentMetric(), 2ull);
+}
+
 TEST_F(NetworkConnectionPoolTest, test_cancel_endpoint_some) {
   std::string endpointA = "tcp://example.org:80";
   std::string endpointB = "tcp://example.org:800";
@@ -0,0 +1,103 @@
+////////////////////////////////////////////////////////////////////////////////
+/// DISCLAIMER
+///
+/// Copyright 2014-2023 ArangoDB GmbH, Cologne, Germany
+/// Copyright 2004-2014 triAGENS GmbH, Cologne, Germany
+///
+/// Licensed under the Apache License, Version 2.0 (the "License");
+/// you may not use this file except in compliance with the License.
+/// You may obtain a copy of the License at
+///
+///     http://www.apache.org/licenses/LICENSE-2.0
+///
+/// Unless required by applicable law or agreed to in writing, software
+/// distributed under the License is distributed on an "AS IS" BASIS,
+/// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+/// See the License for the specific language governing permissions and
+/// limitations under the License.
+///
+/// Copyright holder is ArangoDB GmbH, Cologne, Germany
+///
+/// @author Jan Steemann
+////////////////////////////////////////////////////////////////////////////////
+
+#include "gtest/gtest.h"
+
+#include "Network/ServerLatencyTracker.h"
+
+using namespace arangodb;
+using namespace arangodb::network;
+
+namespace {
+void addSample(ServerLatencyTracker& tracker, std::string_view server,
+               std::chrono::milliseconds latency, bool failed = false) {
+  tracker.requestStarted(server);
+  tracker.requestFinished(server, latency, failed);
+}
+}  // namespace
+
+TEST(ServerLatencyTrackerTest, unknown_servers_are_preferred) {
+  ServerLatencyTracker tracker;
+  addSample(tracker, "PRMR-1", std::chrono::milliseconds(5));
+
+  std::vector<std::string> candidates{"PRMR-1", "PRMR-2"};
+  EXPECT_EQ(1, tracker.chooseFastest(candidates));
+  EXPECT_EQ(ServerLatencyTracker::clock::duration::zero(),
+            tracker.estimatedP95Latency("PRMR-2"));
+}
+
+TEST(ServerLatencyTrackerTest, fastest_server_is_chosen) {
+  ServerLatencyTracker tracker;
+  for (int i = 0; i < 10; ++i) {
+    addSample(tracker, "PRMR-1", std::chrono::milliseconds(20));
+    addSample(tracker, "PRMR-2", std::chrono::milliseconds(2));
+    addSample(tracker, "PRMR-3", std::chrono::milliseconds(8));
+  }
+
+  std::vector<std::string> candidates{"PRMR-1", "PRMR-2", "PRMR-3"};
+  EXPECT_EQ(1, tracker.chooseFastest(candidates));
+  EXPECT_LT(tracker.score("PRMR-2"), tracker.score("PRMR-3"));
+  EXPECT_LT(tracker.score("PRMR-3"), tracker.score("PRMR-1"));
+}
+
+TEST(ServerLatencyTrackerTest, requests_in_flight_increase_score) {
+  ServerLatencyTracker tracker;
+  addSample(tracker, "PRMR-1", std::chrono::milliseconds(2));
+  addSample(tracker, "PRMR-2", std::chrono::milliseconds(3));
+
+  std::vector<std::string> candidates{"PRMR-1", "PRMR-2"};
+  EXPECT_EQ(0, tracker.chooseFastest(candidates));
+
+  // a queue of requests on the faster server makes the other one preferable
+  for (int i = 0; i < 5; ++i) {
+    tracker.requestStarted("PRMR-1");
+  }
+  EXPECT_EQ(1, tracker.chooseFastest(candidates));
+}
+
+TEST(ServerLatencyTrackerTest, failures_are_penalized) {
+  ServerLatencyTracker tracker;
+  addSample(tracker, "PRMR-1", std::chrono::milliseconds(1), true);
+  addSample(tracker, "PRMR-2", std::chrono::milliseconds(50));
+
+  std::vector<std::string> candidates{"PRMR-1", "PRMR-2"};
+  EXPECT_EQ(1, tracker.chooseFastest(candidates));
+  EXPECT_GE(tracker.estimatedP95Latency("PRMR-1"),
+            ServerLatencyTracker::kFailurePenalty);
+}
+
+TEST(ServerLatencyTrackerTest, p95_estimation_includes_deviation) {
+  ServerLatencyTracker tracker;
+  for (int i = 0; i < 50; ++i) {
+    addSample(tracker, "PRMR-1", std::chrono::milliseconds(10));
+  }
+  auto stable = tracker.estimatedP95Latency("PRMR-1");
+  EXPECT_GE(stable, std::chrono::milliseconds(10));
+  EXPECT_LT(stable, std::chrono::milliseconds(11));
+
+  for (int i = 0; i < 50; ++i) {
+    addSample(tracker, "PRMR-1", std::chrono::milliseconds(i % 2 ? 2 : 18));
+  }
+  EXPECT_GT(tracker.estimatedP95Latency("PRMR-1"),
+            std::chrono::milliseconds(15));
+}
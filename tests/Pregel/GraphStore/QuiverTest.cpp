@@ -29,6 +29,8 @@
 #include "Pregel/GraphStore/Vertex.h"
 #include "Pregel/GraphStore/Quiver.h"
 
+#include <string>
+
 using namespace arangodb;
 using namespace arangodb::pregel;
 
@@ -54,21 +56,66 @@ TEST(PregelQuiver, vertex_and_edges) {
 
   ASSERT_EQ(v.getEdgeCount(), 0);
   for (auto d : data) {
-    auto edgeCount = v.getEdgeCount();
-    auto e = MyQuiver::EdgeType(d.first, std::move(d.second));
-    v.addEdge(std::move(e));
-    ASSERT_EQ(v.getEdgeCount(), edgeCount + 1);
+    auto e = MyQuiver::EdgeType(d.first.shard, store.storeKey(d.first.key),
+                                std::move(d.second));
+    store.addEdge(std::move(e));
   }
+  v.setKey(store.storeKey("abc"));
+  store.emplace(std::move(v));
+
+  ASSERT_EQ(store.numberOfVertices(), 1);
+  ASSERT_EQ(store.numberOfEdges(), data.size());
 
-  ASSERT_EQ(v.getEdgeCount(), data.size());
+  auto& vertex = store.vertices.front();
+  ASSERT_EQ(vertex.key(), "abc");
+  ASSERT_EQ(vertex.getEdgeCount(), data.size());
 
-  auto& edges = v.getEdges();
+  auto edges = vertex.getEdges();
   for (size_t i = 0; i < data.size(); ++i) {
-    ASSERT_EQ(edges[i]._to, data[i].first);
+    ASSERT_EQ(edges[i].to(), data[i].first);
     ASSERT_EQ(edges[i].data(), data[i].second);
   }
 }
 
+TEST(PregelQuiver, edges_stay_contiguous_across_blocks) {
+  using MyQuiver = Quiver<uint64_t, uint64_t>;
+  auto store = MyQuiver{};
+
+  // vertex i has i % 100 edges, so that edges of some vertices have to be
+  // moved to a new block
+  auto shard = [](size_t j) {
+    return PregelShard(static_cast<PregelShard::value_type>(j));
+  };
+  size_t const numVertices = 1000;
+  size_t numEdges = 0;
+  for (size_t i = 0; i < numVertices; ++i) {
+    auto v = MyQuiver::VertexType();
+    v.setKey(store.storeKey(std::to_string(i)));
+    for (size_t j = 0; j < i % 100; ++j) {
+      store.addEdge(MyQuiver::EdgeType(
+          shard(j), store.storeKey(std::to_string(i * 1000 + j)),
+          uint64_t(j)));
+    }
+    numEdges += i % 100;
+    store.emplace(std::move(v));
+  }
+  ASSERT_GT(numEdges, MyQuiver::kEdgesPerBlock);
+  ASSERT_EQ(store.numberOfVertices(), numVertices);
+  ASSERT_EQ(store.numberOfEdges(), numEdges);
+
+  for (size_t i = 0; i < numVertices; ++i) {
+    auto& vertex = store.vertices[i];
+    ASSERT_EQ(vertex.key(), std::to_string(i));
+    auto edges = vertex.getEdges();
+    ASSERT_EQ(edges.size(), i % 100);
+    for (size_t j = 0; j < edges.size(); ++j) {
+      ASSERT_EQ(edges[j].targetShard(), shard(j));
+      ASSERT_EQ(edges[j].toKey(), std::to_string(i * 1000 + j));
+      ASSERT_EQ(edges[j].data(), j);
+    }
+  }
+}
+
 TEST(PregelQuiver, storing_some_vertices) {
   using MyQuiver = Quiver<std::string, std::string>;
   auto store = MyQuiver{};
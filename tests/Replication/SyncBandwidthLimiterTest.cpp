@@ -0,0 +1,74 @@
+////////////////////////////////////////////////////////////////////////////////
+/// DISCLAIMER
+///
+/// Copyright 2014-2023 ArangoDB GmbH, Cologne, Germany
+/// Copyright 2004-2014 triAGENS GmbH, Cologne, Germany
+///
+/// Licensed under the Apache License, Version 2.0 (the "License");
+/// you may not use this file except in compliance with the License.
+/// You may obtain a copy of the License at
+///
+///     http://www.apache.org/licenses/LICENSE-2.0
+///
+/// Unless required by applicable law or agreed to in writing, software
+/// distributed under the License is distributed on an "AS IS" BASIS,
+/// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+/// See the License for the specific language governing permissions and
+/// limitations under the License.
+///
+/// Copyright holder is ArangoDB GmbH, Cologne, Germany
+///
+/// @author Jan Steemann
+////////////////////////////////////////////////////////////////////////////////
+
+#include "gtest/gtest.h"
+
+#include "Replication/SyncBandwidthLimiter.h"
+
+using namespace arangodb;
+using namespace std::chrono_literals;
+
+TEST(SyncBandwidthLimiterTest, unlimited) {
+  SyncBandwidthLimiter limiter(0);
+  auto now = SyncBandwidthLimiter::clock::now();
+  for (int i = 0; i < 100; ++i) {
+    EXPECT_EQ(SyncBandwidthLimiter::clock::duration::zero(),
+              limiter.consume(1024 * 1024 * 1024, now));
+  }
+}
+
+TEST(SyncBandwidthLimiterTest, budget_is_shared) {
+  SyncBandwidthLimiter limiter(1000);
+  auto now = SyncBandwidthLimiter::clock::now();
+
+  // one second of unused budget can be used right away
+  EXPECT_EQ(SyncBandwidthLimiter::clock::duration::zero(),
+            limiter.consume(1000, now));
+  // everything on top of that has to be waited for
+  EXPECT_EQ(500ms, limiter.consume(500, now));
+  EXPECT_EQ(1500ms, limiter.consume(1000, now));
+
+  // time passes, the budget recovers
+  EXPECT_EQ(500ms, limiter.consume(0, now + 1s));
+  EXPECT_EQ(SyncBandwidthLimiter::clock::duration::zero(),
+            limiter.consume(0, now + 2s));
+}
+
+TEST(SyncBandwidthLimiterTest, unused_budget_is_capped) {
+  SyncBandwidthLimiter limiter(1000);
+  auto now = SyncBandwidthLimiter::clock::now();
+
+  // idling for a long time does not allow sending a lot at once
+  EXPECT_EQ(1s, limiter.consume(2000, now + 1h));
+}
+
+TEST(SyncBandwidthLimiterTest, limit_can_be_changed) {
+  SyncBandwidthLimiter limiter(1000);
+  auto now = SyncBandwidthLimiter::clock::now();
+  EXPECT_EQ(1s, limiter.consume(2000, now));
+
+  limiter.setLimit(0);
+  EXPECT_EQ(0, limiter.limit());
+  EXPECT_EQ(SyncBandwidthLimiter::clock::duration::zero(),
+            limiter.consume(2000, now));
+}
@@ -0,0 +1,117 @@
+////////////////////////////////////////////////////////////////////////////////
+/// DISCLAIMER
+///
+/// Copyright 2014-2023 ArangoDB GmbH, Cologne, Germany
+/// Copyright 2004-2014 triAGENS GmbH, Cologne, Germany
+///
+/// Licensed under the Apache License, Version 2.0 (the "License");
+/// you may not use this file except in compliance with the License.
+/// You may obtain a copy of the License at
+///
+///     http://www.apache.org/licenses/LICENSE-2.0
+///
+/// Unless required by applicable law or agreed to in writing, software
+/// distributed under the License is distributed on an "AS IS" BASIS,
+/// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+/// See the License for the specific language governing permissions and
+/// limitations under the License.
+///
+/// Copyright holder is ArangoDB GmbH, Cologne, Germany
+///
+/// @author Jan Steemann
+////////////////////////////////////////////////////////////////////////////////
+
+#include "gtest/gtest.h"
+
+#include "Replication/WalTailingCache.h"
+
+using namespace arangodb;
+using namespace std::chrono_literals;
+
+namespace {
+std::shared_ptr<WalTailingCache::Entry const> makeEntry(
+    std::string body, TRI_voc_tick_t lastIncludedTick) {
+  auto entry = std::make_shared<WalTailingCache::Entry>();
+  entry->body = std::move(body);
+  entry->numMarkers = 1;
+  entry->lastIncludedTick = lastIncludedTick;
+  entry->lastScannedTick = lastIncludedTick;
+  entry->latestTick = lastIncludedTick;
+  return entry;
+}
+}  // namespace
+
+TEST(WalTailingCacheTest, disabled) {
+  WalTailingCache cache(1024 * 1024, WalTailingCache::clock::duration::zero());
+  EXPECT_FALSE(cache.enabled());
+
+  auto now = WalTailingCache::clock::now();
+  cache.store("a", makeEntry("{}\n", 1), now);
+  EXPECT_EQ(nullptr, cache.lookup("a", now));
+  EXPECT_EQ(0, cache.numEntries());
+}
+
+TEST(WalTailingCacheTest, store_and_lookup) {
+  WalTailingCache cache(1024 * 1024, 1s);
+  EXPECT_TRUE(cache.enabled());
+
+  auto now = WalTailingCache::clock::now();
+  EXPECT_EQ(nullptr, cache.lookup("a", now));
+  cache.store("a", makeEntry("{}\n", 42), now);
+
+  auto entry = cache.lookup("a", now + 500ms);
+  ASSERT_NE(nullptr, entry);
+  EXPECT_EQ("{}\n", entry->body);
+  EXPECT_EQ(42, entry->lastIncludedTick);
+  EXPECT_EQ(nullptr, cache.lookup("b", now));
+
+  // replacing an entry does not count its memory twice
+  auto memoryUsage = cache.memoryUsage();
+  cache.store("a", makeEntry("{}\n", 43), now);
+  EXPECT_EQ(memoryUsage, cache.memoryUsage());
+  EXPECT_EQ(43, cache.lookup("a", now)->lastIncludedTick);
+  EXPECT_EQ(1, cache.numEntries());
+}
+
+TEST(WalTailingCacheTest, entries_expire) {
+  WalTailingCache cache(1024 * 1024, 1s);
+
+  auto now = WalTailingCache::clock::now();
+  cache.store("a", makeEntry("{}\n", 1), now);
+  cache.store("b", makeEntry("{}\n", 2), now + 500ms);
+
+  EXPECT_EQ(nullptr, cache.lookup("a", now + 1s));
+  EXPECT_NE(nullptr, cache.lookup("b", now + 1s));
+
+  // expired entries are removed when new entries are stored
+  cache.store("c", makeEntry("{}\n", 3), now + 1s);
+  EXPECT_EQ(2, cache.numEntries());
+  cache.store("d", makeEntry("{}\n", 4), now + 2s);
+  EXPECT_EQ(1, cache.numEntries());
+
+  cache.setLimits(1024 * 1024, WalTailingCache::clock::duration::zero());
+  EXPECT_EQ(0, cache.numEntries());
+  EXPECT_EQ(0, cache.memoryUsage());
+}
+
+TEST(WalTailingCacheTest, memory_limit_is_enforced) {
+  std::string body(1000, 'x');
+  WalTailingCache cache(2500, 1h);
+
+  auto now = WalTailingCache::clock::now();
+  cache.store("a", makeEntry(body, 1), now);
+  cache.store("b", makeEntry(body, 2), now);
+  EXPECT_EQ(2, cache.numEntries());
+
+  // the oldest entry is evicted
+  cache.store("c", makeEntry(body, 3), now);
+  EXPECT_EQ(2, cache.numEntries());
+  EXPECT_EQ(nullptr, cache.lookup("a", now));
+  EXPECT_NE(nullptr, cache.lookup("c", now));
+  EXPECT_GE(2500, cache.memoryUsage());
+
+  // entries larger than the cache are not stored at all
+  cache.store("d", makeEntry(std::string(3000, 'x'), 4), now);
+  EXPECT_EQ(nullptr, cache.lookup("d", now));
+  EXPECT_EQ(2, cache.numEntries());
+}
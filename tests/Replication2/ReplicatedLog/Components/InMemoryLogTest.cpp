@@ -343,3 +343,25 @@ INSTANTIATE_TEST_CASE_P(
     ::testing::Combine(::testing::Values(LogTerm{1}, LogTerm{2}, LogTerm{3}),
                        ::testing::Values(LogIndex{1}, LogIndex{10}),
                        Distributions));
+
+TEST(InMemoryLogPayloadTest, payloads_are_shared_between_copies) {
+  auto const entry = LogEntry(LogTerm{1}, LogIndex{1},
+                              LogPayload::createFromString("foo"));
+  auto const& buffer = entry.logPayload()->sharedBuffer();
+  ASSERT_NE(nullptr, buffer);
+
+  auto const log = TestInMemoryLog{}.append(
+      InMemoryLog::log_type_persisted{entry});
+  ASSERT_TRUE(log.getFirstEntry().has_value());
+  auto const* payload = log.getFirstEntry()->entry().logPayload();
+  ASSERT_NE(nullptr, payload);
+  EXPECT_EQ(buffer, payload->sharedBuffer());
+  EXPECT_EQ("foo", payload->slice().stringView());
+
+  // stealing a shared buffer copies it and leaves the other copies intact
+  auto copy = *payload;
+  auto stolen = copy.stealBuffer();
+  EXPECT_EQ("foo", velocypack::Slice(stolen.data()).stringView());
+  EXPECT_EQ(0, copy.byteSize());
+  EXPECT_EQ("foo", entry.logPayload()->slice().stringView());
+}
@@ -335,3 +335,79 @@ TEST_F(LeaderAppendEntriesTest, propagate_largest_common_index) {
     EXPECT_EQ(request.lowestIndexToKeep, LogIndex{1});
   }
 }
+
+TEST_F(LeaderAppendEntriesTest, pipelined_append_entries) {
+  auto leaderLog = makeReplicatedLog(LogId{1});
+  auto follower = std::make_shared<FakeAbstractFollower>("follower");
+  auto leader = leaderLog->becomeLeader("leader", LogTerm{4}, {follower}, 2);
+
+  leader->triggerAsyncReplication();
+  ASSERT_EQ(follower->requests.size(), 1U);
+  {
+    auto const& req = follower->requests.front().request;
+    EXPECT_EQ(req.messageId, MessageId{1});
+    EXPECT_EQ(req.entries.size(), 1U);
+    EXPECT_EQ(req.prevLogEntry.index, LogIndex{0});
+  }
+
+  // new entries are sent without waiting for the response to the first
+  // request, continuing after the entries in flight
+  auto const secondIdx =
+      leader->insert(LogPayload::createFromString("second entry"));
+  ASSERT_EQ(secondIdx, LogIndex{2});
+  ASSERT_EQ(follower->requests.size(), 2U);
+  {
+    auto const& req = follower->requests.back().request;
+    EXPECT_EQ(req.messageId, MessageId{2});
+    EXPECT_EQ(req.entries.size(), 1U);
+    EXPECT_EQ(req.prevLogEntry.term, LogTerm{4});
+    EXPECT_EQ(req.prevLogEntry.index, LogIndex{1});
+  }
+
+  follower->resolveWithOk();
+  {
+    auto stats = std::get<LeaderStatus>(leader->getStatus().getVariant());
+    EXPECT_EQ(stats.local.commitIndex, LogIndex{1});
+  }
+  // the commit index update waits for the request in flight
+  ASSERT_EQ(follower->requests.size(), 1U);
+
+  follower->resolveWithOk();
+  {
+    auto stats = std::get<LeaderStatus>(leader->getStatus().getVariant());
+    EXPECT_EQ(stats.local.commitIndex, secondIdx);
+  }
+  ASSERT_TRUE(follower->hasPendingRequests());
+  {
+    auto const& req = follower->currentRequest();
+    EXPECT_EQ(req.messageId, MessageId{3});
+    EXPECT_EQ(req.entries.size(), 0U);
+    EXPECT_EQ(req.prevLogEntry.index, secondIdx);
+    EXPECT_EQ(req.leaderCommit, secondIdx);
+  }
+}
+
+TEST_F(LeaderAppendEntriesTest, lagging_follower_does_not_block_compaction) {
+  _optionsMock->_maxRetainedLogEntries = 2;
+  auto leaderLog = makeReplicatedLog(LogId{1});
+  auto follower1 = std::make_shared<FakeAbstractFollower>("follower1");
+  auto follower2 = std::make_shared<FakeAbstractFollower>("follower2");
+  auto leader =
+      leaderLog->becomeLeader("leader", LogTerm{4}, {follower1, follower2}, 2);
+
+  leader->triggerAsyncReplication();
+  for (int i = 0; i < 4; ++i) {
+    std::ignore = leader->insert(LogPayload::createFromString("entry"));
+  }
+
+  // follower2 never answers, while follower1 acknowledges everything
+  while (follower1->hasPendingRequests()) {
+    follower1->resolveWithOk();
+  }
+
+  auto status = std::get<LeaderStatus>(leader->getStatus().getVariant());
+  EXPECT_EQ(status.local.commitIndex, LogIndex{5});
+  // follower2 is more than two entries behind, so the leader does not keep
+  // the entries it is missing
+  EXPECT_EQ(status.lowestIndexToKeep, LogIndex{5});
+}
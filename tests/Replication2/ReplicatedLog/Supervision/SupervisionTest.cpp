@@ -513,6 +513,24 @@ TEST_F(LogSupervisionTest, test_acceptable_leader_set) {
   EXPECT_EQ(expectedAcceptable, acceptable);
 }
 
+TEST_F(LogSupervisionTest, test_pick_successor) {
+  auto localStates = std::unordered_map<ParticipantId, LogCurrentLocalState>{};
+  localStates["B"].spearhead = TermIndexPair{LogTerm{3}, LogIndex{10}};
+  localStates["C"].spearhead = TermIndexPair{LogTerm{3}, LogIndex{12}};
+  localStates["D"].spearhead = TermIndexPair{LogTerm{3}, LogIndex{15}};
+  auto const acceptable = std::vector<ParticipantId>{"B", "C", "D"};
+
+  // the participant with the most recent log is preferred
+  auto target = ParticipantsFlagsMap{
+      {"B", ParticipantFlags{}}, {"C", ParticipantFlags{}},
+      {"D", ParticipantFlags{}}};
+  EXPECT_EQ(pickSuccessor(acceptable, target, localStates), "D");
+
+  // unless it is going to be removed as well
+  target.erase("D");
+  EXPECT_EQ(pickSuccessor(acceptable, target, localStates), "C");
+}
+
 TEST_F(LogSupervisionTest, test_remove_participant_action) {
   SupervisionContext ctx;
 
@@ -75,6 +75,49 @@ TEST_F(DocumentStateFollowerTest,
   Mock::VerifyAndClearExpectations(transactionHandlerMock.get());
 }
 
+TEST_F(DocumentStateFollowerTest,
+       follower_fetches_next_snapshot_batch_before_inserting_current_one) {
+  using namespace testing;
+
+  auto transactionHandlerMock = createRealTransactionHandler();
+
+  // three batches of the same shard
+  std::vector<std::string> events;
+  std::size_t batchesSent = 0;
+  ON_CALL(*leaderInterfaceMock, nextSnapshotBatch)
+      .WillByDefault([&](SnapshotId id) {
+        events.emplace_back("fetch");
+        ++batchesSent;
+        auto payload = std::vector<int>{1, 2, 3};
+        return futures::Future<ResultT<SnapshotBatch>>{
+            std::in_place, SnapshotBatch{.snapshotId = id,
+                                         .shardId = shardId,
+                                         .hasMore = batchesSent < 3,
+                                         .payload = velocypack::serialize(
+                                             payload)}};
+      });
+  EXPECT_CALL(*transactionHandlerMock,
+              applyEntry(Matcher<ReplicatedOperation>(_)))
+      .WillRepeatedly([&](ReplicatedOperation op) {
+        if (std::holds_alternative<ReplicatedOperation::Insert>(
+                op.operation)) {
+          events.emplace_back("insert");
+        }
+        return Result{};
+      });
+  EXPECT_CALL(*leaderInterfaceMock, nextSnapshotBatch(SnapshotId{1}))
+      .Times(3);
+
+  auto follower = createFollower();
+  auto res = follower->acquireSnapshot("participantId");
+  EXPECT_TRUE(res.isReady() && res.get().ok());
+
+  EXPECT_EQ(events, (std::vector<std::string>{"fetch", "fetch", "insert",
+                                              "fetch", "insert", "insert"}));
+  Mock::VerifyAndClearExpectations(leaderInterfaceMock.get());
+  Mock::VerifyAndClearExpectations(transactionHandlerMock.get());
+}
+
 TEST_F(DocumentStateFollowerTest,
        follower_resigning_while_acquiring_snapshot_concurrently) {
   using namespace testing;
@@ -195,6 +238,38 @@ TEST_F(DocumentStateFollowerTest,
   follower->applyEntries(std::move(entryIterator));
 }
 
+TEST_F(DocumentStateFollowerTest,
+       follower_applyEntries_applies_many_transactions_concurrently) {
+  using namespace testing;
+
+  auto transactionHandlerMock = createRealTransactionHandler();
+  auto follower = createFollower();
+  auto res = follower->acquireSnapshot("participantId");
+  EXPECT_TRUE(res.isReady() && res.get().ok());
+  auto stream = std::make_shared<MockProducerStream>();
+  follower->setStream(stream);
+
+  // enough operations of independent transactions to be applied by
+  // multiple threads
+  std::vector<DocumentLogEntry> entries;
+  for (std::size_t i = 0; i < 32; ++i) {
+    for (std::uint64_t tid : {6, 10, 14, 18}) {
+      entries.emplace_back(createDocumentEntry(TransactionId{tid}));
+    }
+  }
+  entries.emplace_back(DocumentLogEntry{
+      ReplicatedOperation::buildCommitOperation(TransactionId{6})});
+
+  auto entryIterator = std::make_unique<DocumentLogEntryIterator>(entries);
+
+  EXPECT_CALL(*stream, release).Times(AtMost(1));
+  EXPECT_CALL(*transactionHandlerMock,
+              applyEntry(Matcher<ReplicatedOperation::OperationType const&>(_)))
+      .Times(129);
+  follower->applyEntries(std::move(entryIterator));
+  Mock::VerifyAndClearExpectations(transactionHandlerMock.get());
+}
+
 TEST_F(DocumentStateFollowerTest,
        follower_intermediate_commit_does_not_release) {
   using namespace testing;
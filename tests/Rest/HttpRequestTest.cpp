@@ -132,3 +132,38 @@ TEST(HttpRequestTest, testWrongUrlEncoding) {
   EXPECT_THROW(request.parseUrl(url.data(), url.size()),
                arangodb::basics::Exception);
 }
+
+TEST(HttpRequestTest, testHeaders) {
+  ConnectionInfo ci;
+  HttpRequest request(ci, 1);
+
+  std::string field("X-Arango-Some-Long-Header-Name");
+  std::string value("some value that is not stored inline");
+  request.setHeader(field, value);
+  request.setHeader("Content-Length", "1234");
+  request.setHeader("Accept", "application/x-velocypack");
+  request.setHeader("Cookie", "a=1; b=2");
+  request.setHeader("X-Foo", "bar");
+  request.setHeader("x-foo", "baz");
+
+  // the passed buffers are not modified
+  EXPECT_EQ("X-Arango-Some-Long-Header-Name", field);
+  EXPECT_EQ("some value that is not stored inline", value);
+
+  bool found = false;
+  EXPECT_EQ("some value that is not stored inline",
+            request.header("x-arango-some-long-header-name", found));
+  EXPECT_TRUE(found);
+  EXPECT_EQ("baz", request.header("x-foo", found));
+  EXPECT_TRUE(found);
+
+  // headers that are handled by the request itself are not stored
+  request.header("content-length", found);
+  EXPECT_FALSE(found);
+  request.header("accept", found);
+  EXPECT_FALSE(found);
+  EXPECT_EQ(rest::ContentType::VPACK, request.contentTypeResponse());
+
+  EXPECT_EQ("1", request.cookieValue("a"));
+  EXPECT_EQ("2", request.cookieValue("b"));
+}
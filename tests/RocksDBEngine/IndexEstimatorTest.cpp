@@ -30,6 +30,9 @@
 #include "RocksDBEngine/RocksDBMetadata.h"
 #include "RocksDBEngine/RocksDBTypes.h"
 
+#include <atomic>
+#include <thread>
+
 using namespace arangodb;
 
 // -----------------------------------------------------------------------------
@@ -462,6 +465,45 @@ TEST_F(IndexEstimatorTest, test_truncate_logic_2) {
   ASSERT_EQ(1.0, est.computeEstimate());
 }
 
+TEST_F(IndexEstimatorTest, test_concurrent_buffering) {
+  RocksDBCuckooIndexEstimatorType est(nullptr, 2048);
+  std::atomic<rocksdb::SequenceNumber> currentSeq(0);
+
+  constexpr size_t numThreads = 8;
+  constexpr size_t batchesPerThread = 100;
+
+  // every thread buffers the values 1..10 in every batch, so all values
+  // end up with the same number of occurrences
+  std::vector<std::thread> threads;
+  for (size_t t = 0; t < numThreads; ++t) {
+    threads.emplace_back([&]() {
+      for (size_t iteration = 0; iteration < batchesPerThread; ++iteration) {
+        uint64_t index = 0;
+        std::vector<uint64_t> toInsert(10);
+        std::generate(toInsert.begin(), toInsert.end(),
+                      [&index] { return ++index; });
+        auto res = est.bufferUpdates(++currentSeq, std::move(toInsert), {});
+        ASSERT_TRUE(res.ok());
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  ASSERT_TRUE(est.needToPersist());
+
+  rocksdb::SequenceNumber maxSeq = currentSeq.load();
+  std::string serialization;
+  auto format = RocksDBCuckooIndexEstimatorType::SerializeFormat::UNCOMPRESSED;
+  est.serialize(serialization, maxSeq, format);
+  ASSERT_EQ(est.appliedSeq(), maxSeq);
+  ASSERT_FALSE(est.needToPersist());
+  ASSERT_EQ(numThreads * batchesPerThread * 10, est.nrTotal());
+  ASSERT_EQ(10, est.nrUsed());
+  ASSERT_EQ(10.0 / (numThreads * batchesPerThread * 10),
+            est.computeEstimate());
+}
+
 TEST_F(IndexEstimatorTest, test_serialize_compression) {
   std::vector<uint64_t> toInsert(10000);
   constexpr uint64_t seq = 42;
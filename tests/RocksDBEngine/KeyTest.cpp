@@ -34,6 +34,9 @@
 #include "RocksDBEngine/RocksDBKeyBounds.h"
 #include "RocksDBEngine/RocksDBPrefixExtractor.h"
 #include "RocksDBEngine/RocksDBTypes.h"
+#include "RocksDBEngine/RocksDBVPackIndexFilterPolicy.h"
+
+#include <velocypack/Parser.h>
 
 using namespace arangodb;
 
@@ -788,3 +791,41 @@ TEST_F(RocksDBKeyBoundsTestBigEndian, test_hash_index) {
   EXPECT_LT(cmp->Compare(key6.string(), key7.string()), 0);
   EXPECT_LT(cmp->Compare(key4.string(), key7.string()), 0);
 }
+
+/// @brief test normalization of keys for the persistent index bloom filter
+TEST(RocksDBVPackIndexFilterPolicyTest, test_normalize_key) {
+  auto normalize = [](uint64_t objectId, std::string_view json) {
+    auto values = velocypack::Parser::fromJson(json.data(), json.size());
+    RocksDBKey key;
+    key.constructUniqueVPackIndexValue(objectId, values->slice());
+    std::string result;
+    result.resize(RocksDBVPackIndexFilterPolicy::kNormalizedKeySize);
+    RocksDBVPackIndexFilterPolicy::normalizeKey(key.string(), result.data());
+    return result;
+  };
+
+  // keys that the comparator considers equal must be normalized equally
+  EXPECT_EQ(normalize(1, "[1]"), normalize(1, "[1.0]"));
+  EXPECT_EQ(normalize(1, "[0]"), normalize(1, "[-0.0]"));
+  EXPECT_EQ(normalize(1, R"([1, "abc", null, true])"),
+            normalize(1, R"([1.0, "abc", null, true])"));
+
+  // keys with different values should differ
+  EXPECT_NE(normalize(1, "[1]"), normalize(1, "[2]"));
+  EXPECT_NE(normalize(1, R"(["abc"])"), normalize(1, R"(["abd"])"));
+  EXPECT_NE(normalize(1, "[1, 2]"), normalize(1, "[2, 1]"));
+  EXPECT_NE(normalize(1, "[null]"), normalize(1, "[false]"));
+  EXPECT_NE(normalize(1, "[1]"), normalize(2, "[1]"));
+
+  // the LocalDocumentId suffix of non-unique index keys is included
+  VPackBuilder values;
+  values(VPackValue(VPackValueType::Array))(VPackValue(1))();
+  RocksDBKey key1, key2;
+  key1.constructVPackIndexValue(1, values.slice(), LocalDocumentId(18));
+  key2.constructVPackIndexValue(1, values.slice(), LocalDocumentId(19));
+  char normalized1[RocksDBVPackIndexFilterPolicy::kNormalizedKeySize];
+  char normalized2[RocksDBVPackIndexFilterPolicy::kNormalizedKeySize];
+  RocksDBVPackIndexFilterPolicy::normalizeKey(key1.string(), &normalized1[0]);
+  RocksDBVPackIndexFilterPolicy::normalizeKey(key2.string(), &normalized2[0]);
+  EXPECT_NE(0, memcmp(&normalized1[0], &normalized2[0], sizeof(normalized1)));
+}
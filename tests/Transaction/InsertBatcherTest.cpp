@@ -0,0 +1,120 @@
+////////////////////////////////////////////////////////////////////////////////
+/// DISCLAIMER
+///
+/// Copyright 2014-2023 ArangoDB GmbH, Cologne, Germany
+/// Copyright 2004-2014 triAGENS GmbH, Cologne, Germany
+///
+/// Licensed under the Apache License, Version 2.0 (the "License");
+/// you may not use this file except in compliance with the License.
+/// You may obtain a copy of the License at
+///
+///     http://www.apache.org/licenses/LICENSE-2.0
+///
+/// Unless required by applicable law or agreed to in writing, software
+/// distributed under the License is distributed on an "AS IS" BASIS,
+/// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+/// See the License for the specific language governing permissions and
+/// limitations under the License.
+///
+/// Copyright holder is ArangoDB GmbH, Cologne, Germany
+///
+/// @author Jan Steemann
+////////////////////////////////////////////////////////////////////////////////
+
+#include "Basics/StaticStrings.h"
+#include "Transaction/InsertBatcher.h"
+#include "Utils/ExecContext.h"
+#include "Utils/OperationOptions.h"
+#include "VocBase/LogicalCollection.h"
+
+#include <velocypack/Builder.h>
+#include <velocypack/Parser.h>
+
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "ManagerSetup.h"
+#include "../IResearch/common.h"
+
+using namespace arangodb;
+
+class InsertBatcherTest : public ::testing::Test {
+ protected:
+  arangodb::tests::mocks::TransactionManagerSetup setup;
+  TRI_vocbase_t vocbase;
+  std::shared_ptr<LogicalCollection> coll;
+
+  InsertBatcherTest() : vocbase(testDBInfo(setup.server.server())) {
+    auto json =
+        VPackParser::fromJson("{ \"name\": \"testCollection\", \"id\": 42 }");
+    coll = vocbase.createCollection(json->slice());
+  }
+};
+
+TEST_F(InsertBatcherTest, single_insert) {
+  ExecContextSuperuserScope exeScope;
+  ASSERT_NE(coll, nullptr);
+
+  transaction::InsertBatcher batcher(16);
+  OperationOptions options(ExecContext::current());
+
+  auto doc = VPackParser::fromJson("{ \"_key\": \"abc\", \"value\": 1 }");
+  auto res = batcher.insert(vocbase, *coll, doc->slice(), options);
+  ASSERT_TRUE(res.ok());
+  ASSERT_TRUE(res.slice().isObject());
+  EXPECT_EQ("abc", res.slice().get(StaticStrings::KeyString).stringView());
+
+  // the same key again must fail, without affecting anything else
+  res = batcher.insert(vocbase, *coll, doc->slice(), options);
+  EXPECT_TRUE(res.is(TRI_ERROR_ARANGO_UNIQUE_CONSTRAINT_VIOLATED));
+}
+
+TEST_F(InsertBatcherTest, concurrent_inserts_report_individual_results) {
+  ExecContextSuperuserScope exeScope;
+  ASSERT_NE(coll, nullptr);
+
+  constexpr std::size_t numThreads = 8;
+  constexpr std::size_t numInserts = 100;
+
+  transaction::InsertBatcher batcher(16);
+  std::atomic<std::size_t> numOk{0};
+  std::atomic<std::size_t> numConflicts{0};
+  std::atomic<std::size_t> numOther{0};
+
+  std::vector<std::thread> threads;
+  for (std::size_t t = 0; t < numThreads; ++t) {
+    threads.emplace_back([&, t]() {
+      ExecContextSuperuserScope threadScope;
+      OperationOptions options(ExecContext::current());
+      for (std::size_t i = 0; i < numInserts; ++i) {
+        VPackBuilder doc;
+        doc.openObject();
+        // all threads compete for key "shared", all other keys are unique
+        doc.add(StaticStrings::KeyString,
+                VPackValue(i == 0 ? std::string("shared")
+                                  : std::to_string(t) + "-" +
+                                        std::to_string(i)));
+        doc.close();
+        auto res = batcher.insert(vocbase, *coll, doc.slice(), options);
+        if (res.ok()) {
+          ++numOk;
+        } else if (res.is(TRI_ERROR_ARANGO_UNIQUE_CONSTRAINT_VIOLATED)) {
+          ++numConflicts;
+        } else {
+          ++numOther;
+        }
+      }
+    });
+  }
+  for (auto& t : threads) {
+    t.join();
+  }
+
+  EXPECT_EQ(numThreads * (numInserts - 1) + 1, numOk.load());
+  EXPECT_EQ(numThreads - 1, numConflicts.load());
+  EXPECT_EQ(0, numOther.load());
+}
@@ -37,6 +37,10 @@
 
 #include <velocypack/Parser.h>
 
+#include <atomic>
+#include <thread>
+#include <vector>
+
 #include "gtest/gtest.h"
 
 #include "ManagerSetup.h"
@@ -377,6 +381,54 @@ TEST_F(TransactionManagerTest, leading_multiple_readonly_transactions) {
             transaction::Status::ABORTED);
 }
 
+TEST_F(TransactionManagerTest, concurrent_leases_of_many_transactions) {
+  std::shared_ptr<LogicalCollection> coll;
+  {
+    auto json =
+        VPackParser::fromJson("{ \"name\": \"testCollection\", \"id\": 42 }");
+    coll = vocbase.createCollection(json->slice());
+  }
+  ASSERT_NE(coll, nullptr);
+
+  auto json = arangodb::velocypack::Parser::fromJson(
+      "{ \"collections\":{\"read\": [\"42\"]}}");
+
+  std::vector<TransactionId> tids;
+  for (size_t i = 0; i < 256; ++i) {
+    tids.emplace_back(TransactionId::createLeader());
+    ASSERT_TRUE(
+        mgr->ensureManagedTrx(vocbase, tids.back(), json->slice(), false).ok());
+  }
+
+  std::atomic<size_t> leased{0};
+  std::vector<std::thread> threads;
+  for (size_t t = 0; t < 4; ++t) {
+    threads.emplace_back([&, t]() {
+      for (size_t round = 0; round < 10; ++round) {
+        for (size_t i = 0; i < tids.size(); ++i) {
+          auto const& tid = tids[(i + t * 64) % tids.size()];
+          auto ctx = mgr->leaseManagedTrx(tid, AccessMode::Type::READ, false);
+          if (ctx != nullptr) {
+            leased.fetch_add(1, std::memory_order_relaxed);
+          }
+        }
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  EXPECT_EQ(4 * 10 * tids.size(), leased.load());
+
+  for (auto const& tid : tids) {
+    ASSERT_EQ(mgr->getManagedTrxStatus(tid, vocbase.name()),
+              transaction::Status::RUNNING);
+    ASSERT_TRUE(mgr->abortManagedTrx(tid, vocbase.name()).ok());
+    ASSERT_EQ(mgr->getManagedTrxStatus(tid, vocbase.name()),
+              transaction::Status::ABORTED);
+  }
+}
+
 TEST_F(TransactionManagerTest, lock_conflict) {
   std::shared_ptr<LogicalCollection> coll;
   {
@@ -1009,3 +1009,53 @@ TEST_F(ComputedValuesTest, insertKeepNullTrue) {
                      })
                   .ok());
 }
+
+TEST_F(ComputedValuesTest, mustTrackKeysWritten) {
+  auto& vocbase = server->getSystemDatabase();
+
+  std::vector<std::string> shardKeys;
+  auto b = velocypack::Parser::fromJson(R"([
+    {"name":"foo","expression":"RETURN 1","overwrite":true,
+     "computeOn":["insert","update"]},
+    {"name":"bar","expression":"RETURN 2","overwrite":false,
+     "computeOn":["update"]}])");
+
+  auto res = ComputedValues::buildInstance(vocbase, shardKeys, b->slice());
+  ASSERT_TRUE(res.ok());
+  auto cv = res.get();
+  // "foo" overwrites existing attributes, so for inserts we don't need to
+  // know which attributes were written
+  EXPECT_FALSE(cv->mustTrackKeysWritten(ComputeValuesOn::kInsert));
+  EXPECT_TRUE(cv->mustTrackKeysWritten(ComputeValuesOn::kUpdate));
+  EXPECT_FALSE(cv->mustTrackKeysWritten(ComputeValuesOn::kReplace));
+}
+
+TEST_F(ComputedValuesTest, insertOverwriteWithoutTrackingKeys) {
+  auto& vocbase = server->getSystemDatabase();
+  auto collectionJson = velocypack::Parser::fromJson(R"({"name":"test",
+    "computedValues":[{"name":"attr","expression":"RETURN @doc.value * 2",
+                       "overwrite":true,"computeOn":["insert"]}]})");
+  auto collection = vocbase.createCollection(collectionJson->slice());
+  ASSERT_NE(nullptr, collection);
+
+  std::vector<std::string> const EMPTY;
+  std::vector<std::string> collections{"test"};
+  transaction::Methods trx(transaction::StandaloneContext::Create(vocbase),
+                           EMPTY, collections, EMPTY, transaction::Options());
+
+  EXPECT_TRUE(trx.begin().ok());
+  auto doc = velocypack::Parser::fromJson(
+      R"({"_key":"test1","attr":"old","value":21,"other":true})");
+  EXPECT_TRUE(trx.insert("test", doc->slice(), OperationOptions()).ok());
+  EXPECT_TRUE(trx.documentFastPathLocal(
+                     "test", "test1",
+                     [&](LocalDocumentId const& token, velocypack::Slice doc) {
+                       EXPECT_EQ(42, doc.get("attr").getNumber<int>());
+                       EXPECT_EQ(21, doc.get("value").getNumber<int>());
+                       EXPECT_TRUE(doc.get("other").isTrue());
+                       // the attribute is not duplicated
+                       EXPECT_EQ(6, doc.length());
+                       return true;
+                     })
+                  .ok());
+}
@@ -0,0 +1,85 @@
+////////////////////////////////////////////////////////////////////////////////
+/// DISCLAIMER
+///
+/// Copyright 2014-2023 ArangoDB GmbH, Cologne, Germany
+/// Copyright 2004-2014 triAGENS GmbH, Cologne, Germany
+///
+/// Licensed under the Apache License, Version 2.0 (the "License");
+/// you may not use this file except in compliance with the License.
+/// You may obtain a copy of the License at
+///
+///     http://www.apache.org/licenses/LICENSE-2.0
+///
+/// Unless required by applicable law or agreed to in writing, software
+/// distributed under the License is distributed on an "AS IS" BASIS,
+/// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+/// See the License for the specific language governing permissions and
+/// limitations under the License.
+///
+/// Copyright holder is ArangoDB GmbH, Cologne, Germany
+///
+/// @author Jan Steemann
+////////////////////////////////////////////////////////////////////////////////
+
+#include "VocBase/ticks.h"
+
+#include "gtest/gtest.h"
+
+#include <algorithm>
+#include <thread>
+#include <vector>
+
+TEST(TicksTest, ticks_are_increasing_per_thread) {
+  TRI_voc_tick_t last = TRI_NewTickServer();
+  for (int i = 0; i < 1000; ++i) {
+    TRI_voc_tick_t tick = TRI_NewTickServer();
+    EXPECT_LT(last, tick);
+    EXPECT_LE(tick, TRI_CurrentTickServer());
+    last = tick;
+  }
+}
+
+TEST(TicksTest, ticks_are_unique_across_threads) {
+  constexpr std::size_t numThreads = 8;
+  constexpr std::size_t numTicks = 10000;
+
+  std::vector<std::vector<TRI_voc_tick_t>> ticks(numThreads);
+  std::vector<std::thread> threads;
+  for (std::size_t i = 0; i < numThreads; ++i) {
+    threads.emplace_back([&ticks, i]() {
+      ticks[i].reserve(numTicks);
+      for (std::size_t j = 0; j < numTicks; ++j) {
+        ticks[i].push_back(TRI_NewTickServer());
+      }
+    });
+  }
+  for (auto& t : threads) {
+    t.join();
+  }
+
+  std::vector<TRI_voc_tick_t> all;
+  for (auto const& v : ticks) {
+    all.insert(all.end(), v.begin(), v.end());
+  }
+  std::sort(all.begin(), all.end());
+  EXPECT_EQ(all.end(), std::adjacent_find(all.begin(), all.end()));
+}
+
+TEST(TicksTest, update_affects_already_reserved_ticks) {
+  TRI_voc_tick_t tick = TRI_NewTickServer();
+  TRI_voc_tick_t bound = TRI_CurrentTickServer() + 1000;
+  TRI_UpdateTickServer(bound);
+  EXPECT_LT(bound, TRI_NewTickServer());
+  EXPECT_LT(tick, bound);
+}
+
+TEST(TicksTest, ranges_are_not_handed_out_again) {
+  // make sure this thread has some ticks reserved
+  TRI_NewTickServer();
+  TRI_voc_tick_t base = TRI_NewTickServerRange(1000);
+  EXPECT_LE(base + 999, TRI_CurrentTickServer());
+  for (int i = 0; i < 2000; ++i) {
+    TRI_voc_tick_t tick = TRI_NewTickServer();
+    EXPECT_TRUE(tick < base || tick >= base + 1000);
+  }
+}
@@ -178,6 +178,14 @@ TEST(Zkd_transpose, d3_multi) {
   }
 }
 
+TEST(Zkd_transpose, d3_interleave_roundtrip) {
+  auto const values = std::vector{to_byte_string_fixed_length<double>(1.5),
+                                  to_byte_string_fixed_length<double>(-42.0),
+                                  to_byte_string_fixed_length<double>(1e300)};
+  auto const res = transpose(interleave(values), values.size());
+  ASSERT_EQ(values, res);
+}
+
 TEST(Zkd_compareBox, d2_eq) {
   auto min_v =
       interleave({"00000101"_bs, "01001101"_bs});  // 00 01 00 00 01 11 00 11
@@ -29,6 +29,7 @@
 #include <thread>
 
 #include "Inspection/VPack.h"
+#include "Rest/Version.h"
 
 #include "Workload.h"
 
@@ -137,6 +138,8 @@ Report Execution::buildReport(double runtime) {
   }
 
   Report report{.timestamp = {},
+                .version = rest::Version::getServerVersion(),
+                .buildRepository = rest::Version::getBuildRepository(),
                 .config = {},
                 .configBuilder = {},
                 .threads = std::move(threadReports),
@@ -24,6 +24,7 @@
 #pragma once
 
 #include <cstddef>
+#include <optional>
 #include <variant>
 
 #include "Basics/files.h"
@@ -34,8 +35,10 @@
 
 #include "CacheOptions.h"
 #include "RocksDBOptions.h"
+#include "Workloads/AqlQuery.h"
 #include "Workloads/EdgeCache.h"
 #include "Workloads/GetByPrimaryKey.h"
+#include "Workloads/IndexEstimator.h"
 #include "Workloads/InsertDocuments.h"
 #include "Workloads/IterateDocuments.h"
 #include "Workloads/WriteWriteConflict.h"
@@ -46,13 +49,22 @@ struct IndexSetup {
   std::string name;
   std::string type;
   std::vector<std::string> fields;
+  bool unique{false};
+  bool sparse{false};
+  // required for ttl indexes
+  std::optional<double> expireAfter;
+  // required for zkd indexes
+  std::optional<std::string> fieldValueTypes;
 };
 
 template<class Inspector>
 auto inspect(Inspector& f, IndexSetup& o) {
-  return f.object(o).fields(f.field("name", o.name).fallback(""),
-                            f.field("type", o.type),
-                            f.field("fields", o.fields));
+  return f.object(o).fields(
+      f.field("name", o.name).fallback(""), f.field("type", o.type),
+      f.field("fields", o.fields), f.field("unique", o.unique).fallback(false),
+      f.field("sparse", o.sparse).fallback(false),
+      f.field("expireAfter", o.expireAfter),
+      f.field("fieldValueTypes", o.fieldValueTypes));
 }
 
 struct CollectionsSetup {
@@ -82,7 +94,8 @@ auto inspect(Inspector& f, Setup& o) {
 using WorkloadVariants = std::variant<
     workloads::WriteWriteConflict::Options, workloads::GetByPrimaryKey::Options,
     workloads::InsertDocuments::Options, workloads::IterateDocuments::Options,
-    workloads::EdgeCache::Options>;
+    workloads::EdgeCache::Options, workloads::IndexEstimator::Options,
+    workloads::AqlQuery::Options>;
 namespace workloads {
 // this inspect function must be in namespace workloads for ADL to pick it up
 template<class Inspector>
@@ -93,7 +106,9 @@ inline auto inspect(Inspector& f, WorkloadVariants& o) {
       insp::type<workloads::GetByPrimaryKey::Options>("getByPrimaryKey"),
       insp::type<workloads::InsertDocuments::Options>("insert"),
       insp::type<workloads::IterateDocuments::Options>("iterate"),
-      insp::type<workloads::EdgeCache::Options>("edgeCache"));
+      insp::type<workloads::EdgeCache::Options>("edgeCache"),
+      insp::type<workloads::IndexEstimator::Options>("indexEstimator"),
+      insp::type<workloads::AqlQuery::Options>("aql"));
 }
 }  // namespace workloads
 
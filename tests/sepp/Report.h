@@ -23,6 +23,7 @@
 
 #pragma once
 
+#include <string>
 #include <vector>
 #include "velocypack/SliceContainer.h"
 
@@ -47,6 +48,10 @@ auto inspect(Inspector& f, ThreadReport& o) {
 
 struct Report {
   std::int64_t timestamp;
+  // version and repository state of the build that produced the report, so
+  // that reports of different builds can be told apart and compared
+  std::string version;
+  std::string buildRepository;
   // TODO - rocksdb statistics
   velocypack::Slice config;
   velocypack::Builder configBuilder;
@@ -73,8 +78,10 @@ struct Report {
 
 template<class Inspector>
 auto inspect(Inspector& f, Report& o) {
-  return f.object(o).fields(f.field("timestamp", o.timestamp),        //
-                            f.field("config", o.config),              //
+  return f.object(o).fields(f.field("timestamp", o.timestamp),              //
+                            f.field("version", o.version),                  //
+                            f.field("buildRepository", o.buildRepository),  //
+                            f.field("config", o.config),                    //
                             f.field("threads", o.threads),            //
                             f.field("runtime", o.runtime),            //
                             f.field("databaseSize", o.databaseSize),  //
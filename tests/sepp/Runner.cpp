@@ -35,8 +35,10 @@
 #include "Basics/overload.h"
 #include "Execution.h"
 #include "Server.h"
+#include "Workloads/AqlQuery.h"
 #include "Workloads/EdgeCache.h"
 #include "Workloads/GetByPrimaryKey.h"
+#include "Workloads/IndexEstimator.h"
 #include "Workloads/InsertDocuments.h"
 #include "Workloads/IterateDocuments.h"
 #include "Workloads/WriteWriteConflict.h"
@@ -107,6 +109,13 @@ auto Runner::runBenchmark() -> Report {
           [](workloads::IterateDocuments::Options& opts)
               -> std::shared_ptr<Workload> {
             return std::make_shared<workloads::IterateDocuments>(opts);
+          },
+          [](workloads::IndexEstimator::Options& opts)
+              -> std::shared_ptr<Workload> {
+            return std::make_shared<workloads::IndexEstimator>(opts);
+          },
+          [](workloads::AqlQuery::Options& opts) -> std::shared_ptr<Workload> {
+            return std::make_shared<workloads::AqlQuery>(opts);
           }},
       _options.workload);
 
@@ -231,6 +240,17 @@ void Runner::createIndex(LogicalCollection& col, IndexSetup const& index) {
     builder.add(VPackValue(f));
   }
   builder.close();
+  if (!index.name.empty()) {
+    builder.add("name", index.name);
+  }
+  builder.add("unique", VPackValue(index.unique));
+  builder.add("sparse", VPackValue(index.sparse));
+  if (index.expireAfter) {
+    builder.add("expireAfter", VPackValue(*index.expireAfter));
+  }
+  if (index.fieldValueTypes) {
+    builder.add("fieldValueTypes", VPackValue(*index.fieldValueTypes));
+  }
   builder.close();
   bool created = false;
   std::ignore = col.createIndex(builder.slice(), created);
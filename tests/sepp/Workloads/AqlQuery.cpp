@@ -0,0 +1,122 @@
+////////////////////////////////////////////////////////////////////////////////
+/// DISCLAIMER
+///
+/// Copyright 2014-2023 ArangoDB GmbH, Cologne, Germany
+/// Copyright 2004-2014 triAGENS GmbH, Cologne, Germany
+///
+/// Licensed under the Apache License, Version 2.0 (the "License");
+/// you may not use this file except in compliance with the License.
+/// You may obtain a copy of the License at
+///
+///     http://www.apache.org/licenses/LICENSE-2.0
+///
+/// Unless required by applicable law or agreed to in writing, software
+/// distributed under the License is distributed on an "AS IS" BASIS,
+/// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+/// See the License for the specific language governing permissions and
+/// limitations under the License.
+///
+/// Copyright holder is ArangoDB GmbH, Cologne, Germany
+///
+/// @author Jan Steemann
+////////////////////////////////////////////////////////////////////////////////
+
+#include "AqlQuery.h"
+
+#include <stdexcept>
+
+#include "Aql/Query.h"
+#include "Aql/QueryOptions.h"
+#include "Aql/QueryResult.h"
+#include "Aql/QueryString.h"
+#include "Transaction/StandaloneContext.h"
+#include "velocypack/Builder.h"
+
+#include "Execution.h"
+#include "Server.h"
+
+namespace arangodb::sepp::workloads {
+
+auto AqlQuery::stoppingCriterion() const noexcept -> StoppingCriterion::type {
+  return _options.stop;
+}
+
+auto AqlQuery::createThreads(Execution& exec, Server& server)
+    -> WorkerThreadList {
+  ThreadOptions defaultThread;
+  defaultThread.stop = _options.stop;
+
+  if (_options.defaultThreadOptions) {
+    auto& defaultOpts = _options.defaultThreadOptions.value();
+    defaultThread.query = defaultOpts.query;
+    if (defaultOpts.bindVars.isObject()) {
+      defaultThread.bindVars = std::make_shared<velocypack::Builder>();
+      defaultThread.bindVars->add(defaultOpts.bindVars);
+    }
+    if (defaultOpts.queryOptions.isObject()) {
+      defaultThread.queryOptions = std::make_shared<velocypack::Builder>();
+      defaultThread.queryOptions->add(defaultOpts.queryOptions);
+    }
+  }
+  if (defaultThread.query.empty()) {
+    throw std::runtime_error("No query specified for aql workload");
+  }
+
+  WorkerThreadList result;
+  for (std::uint32_t i = 0; i < _options.threads; ++i) {
+    result.emplace_back(
+        std::make_unique<Thread>(defaultThread, i, exec, server));
+  }
+  return result;
+}
+
+AqlQuery::Thread::Thread(ThreadOptions options, std::uint32_t id,
+                         Execution& exec, Server& server)
+    : ExecutionThread(id, exec, server), _options(std::move(options)) {}
+
+AqlQuery::Thread::~Thread() = default;
+
+void AqlQuery::Thread::run() {
+  aql::QueryOptions queryOptions;
+  if (_options.queryOptions) {
+    queryOptions.fromVelocyPack(_options.queryOptions->slice());
+  }
+
+  auto query = aql::Query::create(
+      transaction::StandaloneContext::Create(*_server.vocbase()),
+      aql::QueryString(_options.query), _options.bindVars,
+      std::move(queryOptions));
+
+  aql::QueryResult result = query->executeSync();
+  if (result.result.fail()) {
+    throw std::runtime_error("Failed to execute query: " +
+                             std::string(result.result.errorMessage()));
+  }
+
+  ++_operations;
+  if (result.data != nullptr && result.data->slice().isArray()) {
+    _results += result.data->slice().length();
+  }
+}
+
+auto AqlQuery::Thread::report() const -> ThreadReport {
+  ThreadReport report{.data = {}, .operations = _operations};
+  report.data.openObject();
+  report.data.add("results", velocypack::Value(_results));
+  report.data.close();
+  return report;
+}
+
+auto AqlQuery::Thread::shouldStop() const noexcept -> bool {
+  if (execution().stopped()) {
+    return true;
+  }
+
+  using StopAfterOps = StoppingCriterion::NumberOfOperations;
+  if (std::holds_alternative<StopAfterOps>(_options.stop)) {
+    return _operations >= std::get<StopAfterOps>(_options.stop).count;
+  }
+  return false;
+}
+
+}  // namespace arangodb::sepp::workloads
@@ -0,0 +1,109 @@
+////////////////////////////////////////////////////////////////////////////////
+/// DISCLAIMER
+///
+/// Copyright 2014-2023 ArangoDB GmbH, Cologne, Germany
+/// Copyright 2004-2014 triAGENS GmbH, Cologne, Germany
+///
+/// Licensed under the Apache License, Version 2.0 (the "License");
+/// you may not use this file except in compliance with the License.
+/// You may obtain a copy of the License at
+///
+///     http://www.apache.org/licenses/LICENSE-2.0
+///
+/// Unless required by applicable law or agreed to in writing, software
+/// distributed under the License is distributed on an "AS IS" BASIS,
+/// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+/// See the License for the specific language governing permissions and
+/// limitations under the License.
+///
+/// Copyright holder is ArangoDB GmbH, Cologne, Germany
+///
+/// @author Jan Steemann
+////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <memory>
+#include <optional>
+#include <string>
+
+#include "Inspection/Status.h"
+#include "Inspection/Types.h"
+#include "velocypack/Builder.h"
+#include "velocypack/Slice.h"
+
+#include "ExecutionThread.h"
+#include "StoppingCriterion.h"
+#include "Workload.h"
+
+namespace arangodb::sepp::workloads {
+
+/// @brief runs an AQL query string repeatedly through the full query
+/// pipeline (parsing, optimization, execution), but in-process. this can be
+/// used for all kinds of index lookups (e.g. persistent index range scans,
+/// geo or zkd index queries) and for multi-document modifications
+struct AqlQuery : Workload {
+  struct ThreadOptions {
+    std::string query;
+    std::shared_ptr<velocypack::Builder> bindVars;
+    std::shared_ptr<velocypack::Builder> queryOptions;
+    StoppingCriterion::type stop;
+  };
+  struct Options;
+  struct Thread;
+
+  AqlQuery(Options const& options) : _options(options) {}
+
+  auto createThreads(Execution& exec, Server& server)
+      -> WorkerThreadList override;
+  auto stoppingCriterion() const noexcept -> StoppingCriterion::type override;
+
+ private:
+  Options const& _options;
+};
+
+struct AqlQuery::Options {
+  struct Thread {
+    std::string query;
+    velocypack::Slice bindVars;
+    velocypack::Slice queryOptions;
+
+    template<class Inspector>
+    friend inline auto inspect(Inspector& f, Thread& o) {
+      return f.object(o).fields(
+          f.field("query", o.query),
+          f.field("bindVars", o.bindVars).fallback(f.keep()),
+          f.field("options", o.queryOptions).fallback(f.keep()));
+    }
+  };
+
+  std::optional<Thread> defaultThreadOptions;
+  std::uint32_t threads{1};  // TODO - make variant fixed number/array of Thread
+  StoppingCriterion::type stop;
+
+  template<class Inspector>
+  friend inline auto inspect(Inspector& f, Options& o) {
+    return f.object(o).fields(f.field("default", o.defaultThreadOptions),
+                              f.field("threads", o.threads),
+                              f.field("stopAfter", o.stop));
+  }
+};
+
+struct AqlQuery::Thread : ExecutionThread {
+  Thread(ThreadOptions options, std::uint32_t id, Execution& exec,
+         Server& server);
+  ~Thread();
+
+  void run() override;
+  [[nodiscard]] auto report() const -> ThreadReport override;
+  auto shouldStop() const noexcept -> bool override;
+
+ private:
+  ThreadOptions _options;
+  // number of executed queries
+  std::uint64_t _operations{0};
+  // total number of result rows of all executed queries
+  std::uint64_t _results{0};
+};
+
+}  // namespace arangodb::sepp::workloads
@@ -66,6 +66,7 @@ auto EdgeCache::createThreads(Execution& exec, Server& server)
     defaultThread.documentsPerTrx = defaultOpts.documentsPerTrx;
     defaultThread.edgesPerVertex = defaultOpts.edgesPerVertex;
     defaultThread.readsPerEdge = defaultOpts.readsPerEdge;
+    defaultThread.readOnly = defaultOpts.readOnly;
   }
 
   WorkerThreadList result;
@@ -88,6 +89,14 @@ EdgeCache::Thread::Thread(ThreadOptions options, std::uint32_t id,
 EdgeCache::Thread::~Thread() = default;
 
 void EdgeCache::Thread::run() {
+  if (_options.readOnly) {
+    if (currentDocument == 0) {
+      executeWriteTransaction();
+    }
+    executeReadTransaction(0);
+    _operations += _options.documentsPerTrx * _options.readsPerEdge;
+    return;
+  }
   auto startDocument = currentDocument;
   executeWriteTransaction();
   executeReadTransaction(startDocument);
@@ -56,6 +56,7 @@ struct EdgeCache::Options {
     std::uint32_t documentsPerTrx;
     std::uint32_t readsPerEdge;
     std::uint64_t edgesPerVertex;
+    bool readOnly;
 
     template<class Inspector>
     friend inline auto inspect(Inspector& f, Thread& o) {
@@ -63,6 +64,7 @@ struct EdgeCache::Options {
           f.field("documentsPerTrx", o.documentsPerTrx).fallback(100u),
           f.field("edgesPerVertex", o.edgesPerVertex).fallback(10u),
           f.field("readsPerEdge", o.readsPerEdge).fallback(2u),
+          f.field("readOnly", o.readOnly).fallback(false),
           f.field("collection", o.collection));
     }
   };
@@ -84,6 +86,10 @@ struct EdgeCache::ThreadOptions {
   std::uint32_t documentsPerTrx{100};
   std::uint64_t readsPerEdge{2};
   std::uint64_t edgesPerVertex{10};
+  // if set, every thread only inserts its edges once and afterwards keeps
+  // looking them up, so that the read scalability of the edge cache can be
+  // measured by running the workload with different numbers of threads
+  bool readOnly{false};
   StoppingCriterion::type stop;
 };
 
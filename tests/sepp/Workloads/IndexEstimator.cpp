@@ -0,0 +1,141 @@
+////////////////////////////////////////////////////////////////////////////////
+/// DISCLAIMER
+///
+/// Copyright 2014-2022 ArangoDB GmbH, Cologne, Germany
+/// Copyright 2004-2014 triAGENS GmbH, Cologne, Germany
+///
+/// Licensed under the Apache License, Version 2.0 (the "License");
+/// you may not use this file except in compliance with the License.
+/// You may obtain a copy of the License at
+///
+///     http://www.apache.org/licenses/LICENSE-2.0
+///
+/// Unless required by applicable law or agreed to in writing, software
+/// distributed under the License is distributed on an "AS IS" BASIS,
+/// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+/// See the License for the specific language governing permissions and
+/// limitations under the License.
+///
+/// Copyright holder is ArangoDB GmbH, Cologne, Germany
+///
+/// @author Jan Steemann
+////////////////////////////////////////////////////////////////////////////////
+
+#include "IndexEstimator.h"
+
+#include <stdexcept>
+
+#include "velocypack/Builder.h"
+
+#include "Execution.h"
+
+namespace arangodb::sepp::workloads {
+
+IndexEstimator::IndexEstimator(Options const& options)
+    : _options(options), _estimator(nullptr, options.estimatorSize) {}
+
+IndexEstimator::~IndexEstimator() = default;
+
+auto IndexEstimator::stoppingCriterion() const noexcept
+    -> StoppingCriterion::type {
+  return _options.stop;
+}
+
+auto IndexEstimator::createThreads(Execution& exec, Server& server)
+    -> WorkerThreadList {
+  ThreadOptions defaultThread;
+  defaultThread.stop = _options.stop;
+
+  if (_options.defaultThreadOptions) {
+    auto& defaultOpts = _options.defaultThreadOptions.value();
+    defaultThread.keysPerTrx = defaultOpts.keysPerTrx;
+    defaultThread.removalsPerTrx = defaultOpts.removalsPerTrx;
+    defaultThread.serializeInterval = defaultOpts.serializeInterval;
+    defaultThread.distinctKeys = defaultOpts.distinctKeys;
+  }
+  if (defaultThread.keysPerTrx == 0 || defaultThread.distinctKeys == 0) {
+    throw std::runtime_error(
+        "keysPerTrx and distinctKeys must be greater than 0");
+  }
+
+  WorkerThreadList result;
+  for (std::uint32_t i = 0; i < _options.threads; ++i) {
+    result.emplace_back(std::make_unique<Thread>(
+        defaultThread, _estimator, _sequence, i, exec, server));
+  }
+  return result;
+}
+
+IndexEstimator::Thread::Thread(ThreadOptions options,
+                               RocksDBCuckooIndexEstimatorType& estimator,
+                               std::atomic<rocksdb::SequenceNumber>& sequence,
+                               std::uint32_t id, Execution& exec,
+                               Server& server)
+    : ExecutionThread(id, exec, server),
+      _options(std::move(options)),
+      _estimator(estimator),
+      _sequence(sequence),
+      _random(id) {}
+
+IndexEstimator::Thread::~Thread() = default;
+
+void IndexEstimator::Thread::run() {
+  std::uniform_int_distribution<std::uint64_t> dist(1, _options.distinctKeys);
+
+  // simulate the index updates of a single transaction commit
+  std::vector<std::uint64_t> inserts;
+  inserts.reserve(_options.keysPerTrx);
+  for (std::uint32_t i = 0; i < _options.keysPerTrx; ++i) {
+    inserts.emplace_back(dist(_random));
+  }
+  std::vector<std::uint64_t> removals;
+  removals.reserve(_options.removalsPerTrx);
+  for (std::uint32_t i = 0; i < _options.removalsPerTrx; ++i) {
+    removals.emplace_back(dist(_random));
+  }
+
+  auto seq = _sequence.fetch_add(1, std::memory_order_relaxed) + 1;
+  auto res =
+      _estimator.bufferUpdates(seq, std::move(inserts), std::move(removals));
+  if (res.fail()) {
+    throw std::runtime_error("Failed to buffer estimator updates: " +
+                             std::string(res.errorMessage()));
+  }
+  ++_operations;
+
+  if (id() == 0 && _options.serializeInterval > 0 &&
+      _operations % _options.serializeInterval == 0) {
+    // apply and persist the buffered updates, as the settings manager does
+    _serialized.clear();
+    _estimator.serialize(
+        _serialized, _sequence.load(std::memory_order_relaxed),
+        RocksDBCuckooIndexEstimatorType::SerializeFormat::COMPRESSED);
+    ++_serializations;
+  }
+}
+
+auto IndexEstimator::Thread::report() const -> ThreadReport {
+  velocypack::Builder data;
+  data.openObject();
+  if (id() == 0) {
+    data.add("serializations", VPackValue(_serializations));
+    data.add("serializedSize", VPackValue(_serialized.size()));
+    data.add("estimate", VPackValue(_estimator.computeEstimate()));
+  }
+  data.close();
+  return {.data = std::move(data), .operations = _operations};
+}
+
+auto IndexEstimator::Thread::shouldStop() const noexcept -> bool {
+  if (execution().stopped()) {
+    return true;
+  }
+
+  using StopAfterOps = StoppingCriterion::NumberOfOperations;
+  if (std::holds_alternative<StopAfterOps>(_options.stop)) {
+    return _operations >= std::get<StopAfterOps>(_options.stop).count;
+  }
+  return false;
+}
+
+}  // namespace arangodb::sepp::workloads
@@ -0,0 +1,125 @@
+////////////////////////////////////////////////////////////////////////////////
+/// DISCLAIMER
+///
+/// Copyright 2014-2022 ArangoDB GmbH, Cologne, Germany
+/// Copyright 2004-2014 triAGENS GmbH, Cologne, Germany
+///
+/// Licensed under the Apache License, Version 2.0 (the "License");
+/// you may not use this file except in compliance with the License.
+/// You may obtain a copy of the License at
+///
+///     http://www.apache.org/licenses/LICENSE-2.0
+///
+/// Unless required by applicable law or agreed to in writing, software
+/// distributed under the License is distributed on an "AS IS" BASIS,
+/// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+/// See the License for the specific language governing permissions and
+/// limitations under the License.
+///
+/// Copyright holder is ArangoDB GmbH, Cologne, Germany
+///
+/// @author Jan Steemann
+////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <optional>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "Inspection/Status.h"
+#include "Inspection/Types.h"
+#include "RocksDBEngine/RocksDBCuckooIndexEstimator.h"
+
+#include "ExecutionThread.h"
+#include "StoppingCriterion.h"
+#include "Workload.h"
+
+namespace arangodb::sepp::workloads {
+
+// measures the overhead of buffering index estimator updates from many
+// concurrent writers, without the other costs of actual document inserts.
+// all threads buffer updates into the same estimator, and the first thread
+// periodically applies and serializes them, as the settings manager does
+struct IndexEstimator : Workload {
+  struct ThreadOptions;
+  struct Options;
+  struct Thread;
+
+  IndexEstimator(Options const& options);
+  ~IndexEstimator();
+
+  auto createThreads(Execution& exec, Server& server)
+      -> WorkerThreadList override;
+  auto stoppingCriterion() const noexcept -> StoppingCriterion::type override;
+
+ private:
+  Options const& _options;
+  RocksDBCuckooIndexEstimatorType _estimator;
+  std::atomic<rocksdb::SequenceNumber> _sequence{0};
+};
+
+struct IndexEstimator::Options {
+  struct Thread {
+    std::uint32_t keysPerTrx;
+    std::uint32_t removalsPerTrx;
+    std::uint32_t serializeInterval;
+    std::uint64_t distinctKeys;
+
+    template<class Inspector>
+    friend inline auto inspect(Inspector& f, Thread& o) {
+      return f.object(o).fields(
+          f.field("keysPerTrx", o.keysPerTrx).fallback(10u),
+          f.field("removalsPerTrx", o.removalsPerTrx).fallback(0u),
+          f.field("serializeInterval", o.serializeInterval).fallback(1000u),
+          f.field("distinctKeys", o.distinctKeys).fallback(100000u));
+    }
+  };
+
+  std::optional<Thread> defaultThreadOptions;
+  std::uint32_t threads{32};
+  std::uint64_t estimatorSize{1000000};
+  StoppingCriterion::type stop;
+
+  template<class Inspector>
+  friend inline auto inspect(Inspector& f, Options& o) {
+    return f.object(o).fields(
+        f.field("default", o.defaultThreadOptions),
+        f.field("threads", o.threads),
+        f.field("estimatorSize", o.estimatorSize).fallback(1000000u),
+        f.field("stopAfter", o.stop));
+  }
+};
+
+struct IndexEstimator::ThreadOptions {
+  std::uint32_t keysPerTrx{10};
+  std::uint32_t removalsPerTrx{0};
+  std::uint32_t serializeInterval{1000};
+  std::uint64_t distinctKeys{100000};
+  StoppingCriterion::type stop;
+};
+
+struct IndexEstimator::Thread : ExecutionThread {
+  Thread(ThreadOptions options, RocksDBCuckooIndexEstimatorType& estimator,
+         std::atomic<rocksdb::SequenceNumber>& sequence, std::uint32_t id,
+         Execution& exec, Server& server);
+  ~Thread();
+
+  void run() override;
+  [[nodiscard]] auto report() const -> ThreadReport override;
+  auto shouldStop() const noexcept -> bool override;
+
+ private:
+  ThreadOptions _options;
+  RocksDBCuckooIndexEstimatorType& _estimator;
+  std::atomic<rocksdb::SequenceNumber>& _sequence;
+  std::mt19937_64 _random;
+  std::uint64_t _operations{0};
+  std::uint64_t _serializations{0};
+  std::string _serialized;
+};
+
+}  // namespace arangodb::sepp::workloads
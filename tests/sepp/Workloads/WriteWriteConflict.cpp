@@ -89,13 +89,17 @@ void WriteWriteConflict::Thread::run() {
   }
 
   transaction::Options trxOpts;
-  trxOpts.delaySnapshot = _options.delaySnapshot;
+  trxOpts.delaySnapshot = _options.delaySnapshot && !_options.optimistic;
+  trxOpts.optimistic = _options.optimistic;
 
   for (;;) {
     SingleCollectionTransaction trx(
         transaction::StandaloneContext::Create(*_server.vocbase()),
         _options.collection, AccessMode::Type::WRITE, trxOpts);
-    trx.addHint(transaction::Hints::Hint::SINGLE_OPERATION);
+    if (!_options.optimistic) {
+      // optimistic mode is not used for single operations
+      trx.addHint(transaction::Hints::Hint::SINGLE_OPERATION);
+    }
 
     {
       auto res = trx.begin();
@@ -131,7 +135,10 @@ void WriteWriteConflict::Thread::run() {
 
     {
       auto res = trx.commit();
-      if (!res.ok()) {
+      if (res.is(TRI_ERROR_ARANGO_CONFLICT) && _options.optimistic) {
+        // optimistic transactions detect conflicts only when committing
+        ++_conflicts;
+      } else if (!res.ok()) {
         throw std::runtime_error("Failed to commit trx: " +
                                  std::string(res.errorMessage()));
       }
@@ -72,13 +72,16 @@ struct WriteWriteConflict::Options {
     std::string collection;
     OperationType operation;
     bool delaySnapshot;
+    // defer key locks until commit. delaySnapshot is ignored in this case
+    bool optimistic;
 
     template<class Inspector>
     friend inline auto inspect(Inspector& f, Thread& o) {
       return f.object(o).fields(
           f.field("collection", o.collection),
           f.field("operation", o.operation),
-          f.field("delaySnapshot", o.delaySnapshot).fallback(true));
+          f.field("delaySnapshot", o.delaySnapshot).fallback(true),
+          f.field("optimistic", o.optimistic).fallback(false));
     }
   };
 